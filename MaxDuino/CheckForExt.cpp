@@ -4,6 +4,7 @@
 #include "processing_state.h"
 #include "file_utils.h"
 #include "ayplay.h"
+#include "snapshot.h"
 #include "casProcessing.h"
 #include "MaxProcessing.h"
 #ifdef Use_MZF
@@ -18,30 +19,160 @@
 #ifdef Use_c64
   #include "c64tap.h"
 #endif
+#ifdef Use_CSW
+  #include "csw.h"
+#endif
+#ifdef Use_WAV
+  #include "wav.h"
+#endif
+#ifdef Use_MXW
+  #include "mxw.h"
+#endif
+#ifdef Use_UEF_GZ
+  #include "inflate.h"
+#endif
+
+namespace {
+// Formats with a magic number at the start of the file
+enum class SNIFF : byte {
+  NONE,
+  TZX,
+  UEF,
+  CSW,
+  C64,
+  AY,
+  CAS,
+};
+
+struct SNIFF_MAGIC {
+  const byte *magic;
+  byte len;
+  SNIFF format;
+};
+
+const byte TZXMagic[] PROGMEM = { 'Z','X','T','a','p','e','!',0x1A };
+#ifdef Use_UEF
+const byte UEFMagic[] PROGMEM = { 'U','E','F',' ','F','i','l','e','!' };
+#endif
+#ifdef Use_CSW
+const byte CSWMagic[] PROGMEM = { 'C','o','m','p','r','e','s','s','e','d',' ','S','q','u','a','r','e',' ','W','a','v','e',0x1A };
+#endif
+#ifdef AYPLAY
+const byte AYMagic[] PROGMEM = { 'Z','X','A','Y','E','M','U','L' };
+#endif
+#ifdef Use_CAS
+const byte CASMagic[] PROGMEM = { 0x1F,0xA6,0xDE,0xBA,0xCC,0x13,0x7D,0x74 };  // MSX
+#endif
+
+const SNIFF_MAGIC sniffMagic[] PROGMEM = {
+  { TZXMagic, sizeof(TZXMagic), SNIFF::TZX },
+#ifdef Use_UEF
+  { UEFMagic, sizeof(UEFMagic), SNIFF::UEF },
+#endif
+#ifdef Use_CSW
+  { CSWMagic, sizeof(CSWMagic), SNIFF::CSW },
+#endif
+#ifdef AYPLAY
+  { AYMagic, sizeof(AYMagic), SNIFF::AY },
+#endif
+#ifdef Use_CAS
+  { CASMagic, sizeof(CASMagic), SNIFF::CAS },
+#endif
+};
+
+constexpr byte SNIFF_SIZE = 23;   // the longest magic (CSW), and the C64 TAP header (20)
+
+SNIFF sniff(byte *head) {
+  // the one read of the start of the file: readfile keeps the window it
+  // came in (a sector, or READAHEAD_SIZE), so the header reads of whichever
+  // format is picked are served from RAM
+  const word n = readfile_bytes(head, SNIFF_SIZE, 0);
+  for (byte i = 0; i < sizeof(sniffMagic)/sizeof(sniffMagic[0]); i++) {
+    SNIFF_MAGIC m;
+    memcpy_P(&m, &sniffMagic[i], sizeof(m));
+    if (n >= m.len && memcmp_P(head, m.magic, m.len) == 0) return m.format;
+  }
+#ifdef Use_c64
+  // sets up the TAP's header state as it checks it
+  if (n >= 20 && c64tap_is_header(head, filesize)) return SNIFF::C64;
+#endif
+  return SNIFF::NONE;
+}
+
+#ifdef Use_CAS
+void cas_open(byte first) {
+  casduino = CASDUINO_FILETYPE::CASDUINO;
+  invert=false;
+  #if defined(Use_DRAGON)
+    if (first == 0x55) {
+      invert=true;
+      casduino = CASDUINO_FILETYPE::DRAGONMODE;
+      cas_period=249;
+      cas_frac=0;
+      count_r=255;
+    }
+  #endif         
+  cas_scan();
+}
+#endif
+} // anonymous namespace
 
 void checkForEXT(const char * const filenameExt) {
-  //Check for .xxx file extension as these have no header
+  //Check for a magic number first, so a file with the wrong extension
+  //still plays as what it is, then for .xxx file extensions as these have no header
 
 #ifdef Use_CAS
   casduino = CASDUINO_FILETYPE::NONE;
 #endif
 
-  if (!strcasecmp_P(filenameExt, PSTR("tap"))) {
+  byte head[SNIFF_SIZE] = {0};
+  switch (sniff(head)) {
+    case SNIFF::TZX:
+      // left at TASK::INIT, and TZXProcess reads the header from the window
+      #ifdef ID11CDTspeedup
+      if (!strcasecmp_P(filenameExt, PSTR("cdt"))) AMScdt = true;
+      #endif
+      return;
+#ifdef Use_UEF
+    case SNIFF::UEF:
+      currentTask=TASK::GETUEFHEADER;
+      currentID=BLOCKID::UEF;
+      return;
+#endif
+#ifdef Use_CSW
+    case SNIFF::CSW:
+      csw_init();
+      return;
+#endif
 #ifdef Use_c64
-    if (readfile(20, bytesRead) == 20 && c64tap_is_header(filebuffer, filesize)) {
+    case SNIFF::C64:
       c64tap_init();
       return;
-    }
 #endif
+#ifdef AYPLAY
+    case SNIFF::AY:
+      currentTask=TASK::GETAYHEADER;
+      currentID=BLOCKID::AYO;
+      AYPASS_hdrptr = AYPASS_STEP::HDRSTART;
+      return;
+#endif
+#ifdef Use_CAS
+    case SNIFF::CAS:
+      cas_open(head[0]);
+      return;
+#endif
+    default:
+      break;
+  }
+
+  if (!strcasecmp_P(filenameExt, PSTR("tap"))) {
     currentTask=TASK::PROCESSID;
     currentID=BLOCKID::TAP;
-    readfile(1,bytesRead);
-    if (filebuffer[0] == 0x1A) {
+    if (head[0] == 0x1A) {
       currentID=BLOCKID::JTAP;    
     }   
     #ifdef tapORIC
-      //readfile(1,bytesRead);
-      if (filebuffer[0] == 0x16) {
+      if (head[0] == 0x16) {
         currentID=BLOCKID::ORIC;
       }
     #endif
@@ -56,6 +187,24 @@ void checkForEXT(const char * const filenameExt) {
   }
 
 
+#ifdef Use_CSW
+  else if (!strcasecmp_P(filenameExt, PSTR("csw"))) {
+    csw_init();
+  }
+#endif
+#ifdef Use_WAV
+  else if (!strcasecmp_P(filenameExt, PSTR("wav"))) {
+    wav_init();
+  }
+#endif
+#ifdef Use_MXW
+  else if (!strcasecmp_P(filenameExt, PSTR("mxw"))) {
+    mxw_init(false);
+  }
+  else if (!strcasecmp_P(filenameExt, PSTR("mxp"))) {
+    mxw_init(true);
+  }
+#endif
 #ifdef Use_CAQ
 else if (!strcasecmp_P(filenameExt, PSTR("caq"))) {
   caq_init();
@@ -68,8 +217,17 @@ else if (!strcasecmp_P(filenameExt, PSTR("caq"))) {
     AYPASS_hdrptr = AYPASS_STEP::HDRSTART;
   }
 #endif
+#ifdef Use_SNAPSHOT
+  else if (!strcasecmp_P(filenameExt, PSTR("sna")) ||
+           !strcasecmp_P(filenameExt, PSTR("z80"))) {
+    snap_init(filenameExt);
+  }
+#endif
 #ifdef Use_UEF
   else if (!strcasecmp_P(filenameExt, PSTR("uef"))) {
+  #ifdef Use_UEF_GZ
+    gz_open();    // gzip'd UEF: from here on reads see the uncompressed data
+  #endif
     currentTask=TASK::GETUEFHEADER;
     currentID=BLOCKID::UEF;
   }
@@ -94,17 +252,7 @@ else if (!strcasecmp_P(filenameExt, PSTR("caq"))) {
 #endif
 #ifdef Use_CAS
   else if (!strcasecmp_P(filenameExt, PSTR("cas"))) {
-    casduino = CASDUINO_FILETYPE::CASDUINO;
-    invert=false;
-    #if defined(Use_DRAGON)
-      readfile(1,bytesRead);
-      if (filebuffer[0] == 0x55) {
-        invert=true;
-        casduino = CASDUINO_FILETYPE::DRAGONMODE;
-        cas_period=249;
-        count_r=255;
-      }
-    #endif         
+    cas_open(head[0]);
   }
 #endif
 #ifdef ID11CDTspeedup  
@@ -113,3 +261,55 @@ else if (!strcasecmp_P(filenameExt, PSTR("caq"))) {
   }
 #endif  
 }
+
+bool is_playable(const char *name) {
+  // the extensions above, and the ones that play as TZX (anything else
+  // would too, but isn't a tape)
+  const char *ext = strrchr(name, '.');
+  if (ext == nullptr) return false;
+  ext++;
+  return !strcasecmp_P(ext, PSTR("tzx")) ||
+         !strcasecmp_P(ext, PSTR("tsx")) ||
+         !strcasecmp_P(ext, PSTR("cdt")) ||
+         !strcasecmp_P(ext, PSTR("tap")) ||
+         !strcasecmp_P(ext, PSTR("p")) ||
+         !strcasecmp_P(ext, PSTR("o"))
+#ifdef Use_CSW
+      || !strcasecmp_P(ext, PSTR("csw"))
+#endif
+#ifdef Use_WAV
+      || !strcasecmp_P(ext, PSTR("wav"))
+#endif
+#ifdef Use_MXW
+      || !strcasecmp_P(ext, PSTR("mxw"))
+      || !strcasecmp_P(ext, PSTR("mxp"))
+#endif
+#ifdef Use_CAQ
+      || !strcasecmp_P(ext, PSTR("caq"))
+#endif
+#ifdef AYPLAY
+      || !strcasecmp_P(ext, PSTR("ay"))
+#endif
+#ifdef Use_SNAPSHOT
+      || !strcasecmp_P(ext, PSTR("sna"))
+      || !strcasecmp_P(ext, PSTR("z80"))
+#endif
+#ifdef Use_UEF
+      || !strcasecmp_P(ext, PSTR("uef"))
+#endif
+#ifdef Use_MZF
+      || !strcasecmp_P(ext, PSTR("mzf"))
+      || !strcasecmp_P(ext, PSTR("mzt"))
+      || !strcasecmp_P(ext, PSTR("m12"))
+#endif
+#ifdef Use_MTX
+      || !strcasecmp_P(ext, PSTR("mtx"))
+#endif
+#ifdef Use_CAS
+      || !strcasecmp_P(ext, PSTR("cas"))
+#endif
+#ifdef Use_ZIP
+      || !strcasecmp_P(ext, PSTR("zip"))     // (to go into, zip.h)
+#endif
+      ;
+}
@@ -3,4 +3,7 @@
 
 void checkForEXT(const char * const filenameExt);
 
+// Whether name has an extension checkForEXT knows, or one of the TZX family
+bool is_playable(const char *name);
+
 #endif // CHECK_FOR_EXT_H_INCLUDED
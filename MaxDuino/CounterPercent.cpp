@@ -4,202 +4,164 @@
 #include "Display.h"
 #include "utils.h"
 #include "file_utils.h"
+#include "tzxprogram.h"
+#include "buffer.h"
+#include "profile.h"
 
 byte currpct = 100;
 unsigned int lcdsegs = 0;
 
 static unsigned long timeDiff2 = 0;
 static byte newpct = 0;
-
-void lcdTime() {
-  if (millis() - timeDiff2 > 1000) {   // check switch every second 
-    timeDiff2 = millis();           // get current millisecond count
-
-    #ifdef LCDSCREEN16x2
-
-      if (lcdsegs % 10 != 0) {
-        // ultima cifra 1,2,3,4,5,6,7,8,9
-        utoa(lcdsegs%10,PlayBytes,10);
-        lcd.setCursor(15,0);
-        lcd.print(PlayBytes);
-      }
-      else if (lcdsegs % CNTRBASE != 0) {
-        // es 10,20,30,40,50,60,70,80,90,110,120,..
-        utoa(lcdsegs%CNTRBASE,PlayBytes,10);
-        lcd.setCursor(14,0);
-        lcd.print(PlayBytes);
-      }
-      else if (lcdsegs % (CNTRBASE*10) != 0) {
-        // es 100,200,300,400,500,600,700,800,900,1100,..
-        utoa(lcdsegs%(CNTRBASE*10)/CNTRBASE*100,PlayBytes,10);
-        lcd.setCursor(13,0);
-        lcd.print(PlayBytes);
-      } 
-      else {
-        // es 000,1000,2000,...
-        lcd.setCursor(13,0);
-        lcd.print('0');
-        lcd.print('0');
-        lcd.print('0');
-      }
-
-      lcdsegs++;
+static byte shownpct = 0xFF;        // 0xFF: nothing shown yet
+static unsigned long pctBytesRead = 0;
+
+// The counter and the percentage share one row.  What's on it is kept in
+// shown[], so each update only sends the glyphs that have changed, and
+// runs of changed glyphs are sent without moving the cursor in between.
+// These run from TZXLoop only once every buffer page is full, so the I2C
+// (or SPI) traffic happens while the ISR has the most data in hand.  Even
+// then, a glyph at a time: as soon as the ISR has emptied a page, sending
+// stops and the rest waits in wanted[] for lcdCatchUp, so the card read
+// always goes first and a slow display can't run the buffer dry.
+#ifdef P8544
+  #define CNTR_ROW 3
+  #define CNTR_COL 11
+  #define PCT_COL 0
+#else
+  #define CNTR_ROW 0
+  #define CNTR_COL 13
+  #define PCT_COL 8
+#endif
+
+static char shown[CNTR_COL+3-PCT_COL];
+static char wanted[CNTR_COL+3-PCT_COL];   // 0 where nothing has been put
+static bool owed = false;                 // wanted[] has glyphs that haven't gone out
+
+static void sendGlyphs() {
+  byte cursor = 0xFF;   // where the display's cursor is now, if we know
+  for (byte col = PCT_COL; col < CNTR_COL+3; col++) {
+    const char w = wanted[col-PCT_COL];
+    char &c = shown[col-PCT_COL];
+    if (w == 0 || c == w) continue;
+    if (buffer_has_room()) return;    // the ISR has taken a page: fill it first
+    c = w;
+
+    #if defined(LCDSCREEN16x2) || defined(P8544)
+      if (cursor != col) lcd.setCursor(col,CNTR_ROW);
+      lcd.print(w);
     #endif
 
     #ifdef OLED1306
       #ifdef XY2force
-        if (lcdsegs % 10 != 0) {
-          // ultima cifra 1,2,3,4,5,6,7,8,9
-          utoa(lcdsegs%10,(char *)input,10);
-          sendStrXY((char *)input,15,0);
-        }
-        else if (lcdsegs % CNTRBASE != 0) {
-          // es 10,20,30,40,50,60,70,80,90,110,120,..
-          utoa((lcdsegs % CNTRBASE)/10,(char *)input,10);
-          input[1]='0';
-          input[2]=0;
-          sendStrXY((char *)input,14,0);
-        }
-        else if (lcdsegs % (CNTRBASE*10) != 0) {
-          // es 100,200,300,400,500,600,700,800,900,1100,..
-          utoa((lcdsegs % (CNTRBASE*10))/CNTRBASE,(char *)input,10);
-          input[1]='0';
-          input[2]='0';
-          input[3]=0;
-          sendStrXY((char *)input,13,0);
-        }
-        else {
-          // es 000,1000,2000,...
-          sendStrXY("000",13,0);
-        }
-
-        lcdsegs++;
-
-      #else // not XY2force
-
-        if (lcdsegs % 10 != 0) {
-          // ultima cifra 1,2,3,4,5,6,7,8,9
-          setXY(15,0);
-          sendChar(48+lcdsegs%10);
-        }
-        else if (lcdsegs % CNTRBASE != 0) {
-          // es 10,20,30,40,50,60,70,80,90,110,120,..
-          setXY(14,0);
-          sendChar(48+(lcdsegs%CNTRBASE)/10);
-          sendChar('0');
-        } else if (lcdsegs % (CNTRBASE*10) != 0) {
-          // es 100,200,300,400,500,600,700,800,900,1100,..
-          setXY(13,0);
-          sendChar(48+(lcdsegs % (CNTRBASE*10))/CNTRBASE);
-          sendChar('0');
-          sendChar('0');
-        } else {
-          // es 000,1000,2000,...
-          setXY(13,0);
-          sendChar('0');
-          sendChar('0');
-          sendChar('0');
-        }
-
-        lcdsegs++; 
-
+        const char g[2] = {w, 0};
+        sendStrXY(g,col,CNTR_ROW);
+      #else
+        if (cursor != col) setXY(col,CNTR_ROW);
+        sendChar(w);
       #endif
     #endif
-
-    #ifdef P8544
-      if (lcdsegs % 10 != 0) {
-        // ultima cifra 1,2,3,4,5,6,7,8,9
-        utoa(lcdsegs%10,PlayBytes,10);
-        lcd.setCursor(13,3);
-        lcd.print(PlayBytes);
-      }
-      else if (lcdsegs % CNTRBASE != 0) {
-        // es 10,20,30,40,50,60,70,80,90,110,120,..
-        utoa(lcdsegs%CNTRBASE,PlayBytes,10);
-        lcd.setCursor(12,3);
-        lcd.print(PlayBytes);
-      }
-      else if (lcdsegs % (CNTRBASE*10) != 0) {
-        // es 100,200,300,400,500,600,700,800,900,1100,..
-        utoa(lcdsegs%(CNTRBASE*10)/CNTRBASE*100,PlayBytes,10);
-        lcd.setCursor(11,3);
-        lcd.print(PlayBytes);
-      }
-      else {
-        // es 000,1000,2000,...
-        lcd.setCursor(11,3);
-        lcd.print('0');
-        lcd.print('0');
-        lcd.print('0');
-      }
-    #endif
+    cursor = col+1;
   }
+  owed = false;
 }
 
-void lcdPercent() {
-  newpct=(100 * bytesRead)/filesize;                   
+static void putGlyphs(const char *s, byte col) {
+  for (; *s; ++s, ++col) wanted[col-PCT_COL] = *s;
+  owed = true;
+  sendGlyphs();
+}
+
+void lcdCatchUp() {
+  if (owed) sendGlyphs();
+}
+
+static void digits3(word v, char *s) {
+  // sss, or m:ss with CNTRBASE 60 (no room for the separator)
+  if (v >= CNTRBASE*10) v = CNTRBASE*10-1;
+  s[0] = '0' + v/CNTRBASE;
+  s[1] = '0' + (v%CNTRBASE)/10;
+  s[2] = '0' + v%10;
+  s[3] = 0;
+}
+
+static void checkRedrawn() {
+  // currpct is set back to 100 whenever the row has been written over
+  // (play, resume, block jump), so everything has to go out again
   if (currpct==100) {
-      currpct= 0;
+    currpct = 0;
+    shownpct = 0xFF;
+    pctBytesRead = 0xFFFFFFFF;
+    for (byte i = 0; i < sizeof(shown); i++) shown[i] = wanted[i] = 0;
+    owed = false;
   }
+}
 
-  if (((newpct>currpct) || currpct==0) && (newpct % 1 == 0)) {
-    #ifdef LCDSCREEN16x2            
-      lcd.setCursor(8,0);
-      lcd.print(newpct);lcd.print('%');
-    #endif             
+#ifdef TAPE_TIME_LEFT
+static void showSeconds(word secs, byte col) {
+  char s[5];
+  digits3(secs, s);
+  if (col == PCT_COL) {   // covers the '%' where the percentage was
+    s[3] = ' ';
+    s[4] = 0;
+  }
+  putGlyphs(s, col);
+}
+#endif // TAPE_TIME_LEFT
 
-    #ifdef OLED1306
-      #ifdef XY2force
-        if (newpct <10) {
-          input[0]=' ';
-          input[1]=48+(newpct%10);
-          input[2]='%';
-          input[3]=0;
-          sendStrXY((char *)input,8,0);
-        }
-        else if (newpct <100) {
-          input[0]=48+(newpct/10);
-          input[1]=48+(newpct%10);
-          input[2]='%';
-          input[3]=0;
-          sendStrXY((char *)input,8,0);
-        }
-        else {
-          input[0]='1';
-          input[1]='0';
-          input[2]='0';
-          input[3]='%';
-          input[4]=0;
-          sendStrXY((char *)input,8,0);
-        }
-                                          
-      #else // not XY2force
-        if (newpct <10) {
-          setXY(8,0);
-          sendChar(' ');
-          sendChar(48+newpct%10);
-        }
-        else if (newpct <100) {
-          setXY(8,0);
-          sendChar(48+newpct/10);
-          sendChar(48+newpct%10);
-        }
-        else {
-          setXY(8,0);
-          sendChar('1');
-          sendChar('0');
-          sendChar('0');
-        }
-
-        sendChar('%');             
-      #endif                   
+void lcdTime() {
+  PROFILE_SCOPE(LCDTIME);
+  if (millis() - timeDiff2 > 1000) {   // check switch every second 
+    timeDiff2 = millis();           // get current millisecond count
+    checkRedrawn();
+
+    #ifdef TAPE_TIME_LEFT
+      tzxprog_tick();
+      word blockLeft, tapeLeft;
+      if (tzxprog_time_left(blockLeft, tapeLeft)) {
+        showSeconds(tapeLeft, CNTR_COL);
+        showSeconds(blockLeft, PCT_COL);
+        lcdsegs++;
+        return;
+      }
     #endif
 
-    #ifdef P8544
-      lcd.setCursor(0,3);
-      lcd.print(newpct);lcd.print('%');
-    #endif
-    
-    currpct = newpct;
+    char s[4];
+    digits3(lcdsegs % (CNTRBASE*10), s);
+    putGlyphs(s, CNTR_COL);
+    lcdsegs++;
+  }
+}
+
+void lcdPercent() {
+  checkRedrawn();
+  #ifdef TAPE_TIME_LEFT
+  if (tzxprog_timed()) return;    // the block's time left is shown there instead
+  #endif
+  if (bytesRead == pctBytesRead) return;   // nothing new to divide out
+  pctBytesRead = bytesRead;
+
+  #ifdef TZX_PROGRAM
+  newpct=tzxprog_percent();
+  #else
+  newpct=(100 * bytesRead)/filesize;
+  #endif                   
+
+  if (shownpct==0xFF || newpct>shownpct) {
+    char s[5];
+    if (newpct < 100) {
+      s[0] = (newpct < 10) ? ' ' : '0' + newpct/10;
+      s[1] = '0' + newpct%10;
+      s[2] = '%';
+      s[3] = ' ';
+    } else {
+      s[0] = '1';
+      s[1] = '0';
+      s[2] = '0';
+      s[3] = '%';
+    }
+    s[4] = 0;
+    putGlyphs(s, PCT_COL);
+    shownpct = newpct;
   }
 }
@@ -3,8 +3,9 @@
 
 void lcdTime();
 void lcdPercent();
+void lcdCatchUp();           // send whatever lcdTime and lcdPercent had to leave
 
-extern byte currpct;
+extern byte currpct;         // set to 100 after writing over the counter row, to have it all drawn again
 extern unsigned int lcdsegs;
 
 #endif // COUNTER_PERCENT_H_INCLUDED
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "i2c.h"
 #include "preferences.h"
 #include "current_settings.h"
+#include "serqueue.h"
 
 #if defined(RECORD_EEPROM_LOGO) || defined(LOAD_EEPROM_LOGO)
 #include "EEPROM_wrappers.h"
@@ -24,6 +25,97 @@
     #include "EEPROM_wrappers.h"
   #endif
 
+#ifdef OLED_SPI
+  //==========================================================//
+  // 4-wire SPI: D/C low for commands, high for data, and no address
+  // or control bytes.  The SD card shares the bus, so every transfer is
+  // wrapped in SPI.beginTransaction (SdFat does the same) and only ever
+  // happens from the main loop, never from the ISR.
+  #include <SPI.h>
+
+  const SPISettings oledSPISettings(OLED_SPI_CLOCK, MSBFIRST, SPI_MODE0);
+
+  void oled_spi_begin(bool data)
+  {
+    SPI.beginTransaction(oledSPISettings);
+    digitalWrite(OLED_SPI_DC, data ? HIGH : LOW);
+    digitalWrite(OLED_SPI_CS, LOW);
+  }
+
+  void oled_spi_end()
+  {
+    digitalWrite(OLED_SPI_CS, HIGH);
+    SPI.endTransaction();
+  }
+
+  void oled_spi_init()
+  {
+    pinMode(OLED_SPI_CS, OUTPUT);
+    digitalWrite(OLED_SPI_CS, HIGH);
+    pinMode(OLED_SPI_DC, OUTPUT);
+    #ifdef OLED_SPI_RST
+      pinMode(OLED_SPI_RST, OUTPUT);
+      digitalWrite(OLED_SPI_RST, LOW);
+      delay(10);
+      digitalWrite(OLED_SPI_RST, HIGH);
+      delay(10);
+    #endif
+    SPI.begin();
+  }
+
+  void sendcommand(unsigned char com)
+  {
+    oled_spi_begin(false);
+    SPI.transfer(com);
+    oled_spi_end();
+  }
+
+  void SendByte(unsigned char data)
+  {
+    oled_spi_begin(true);
+    SPI.transfer(data);
+    oled_spi_end();
+  }
+
+  // no transmit buffer to fill, so a run is one transaction however long
+  void oled_data_begin()
+  {
+    oled_spi_begin(true);
+  }
+
+  void oled_data(unsigned char data)
+  {
+    SPI.transfer(data);
+  }
+
+  void oled_data_end()
+  {
+    oled_spi_end();
+  }
+
+  void sendChar(unsigned char data)
+  {
+    oled_spi_begin(true);
+    for(int i=0;i<8;i++) {
+      SPI.transfer(pgm_read_byte(myFont[data-0x20]+i));
+    }
+    oled_spi_end();
+  }
+
+  // Set the cursor position in a 16 COL * 2 ROW map.
+  void setXY(unsigned char col,unsigned char row)
+  {
+    oled_spi_begin(false);
+    SPI.transfer(0xb0+(row)); //set page address (row)
+    #ifdef OLED1106_1_3
+      SPI.transfer( 0x02+(8*(col %2)) ); //set low col address
+    #else
+      SPI.transfer( 0x00+(8*(col %2)) ); //set low col address
+    #endif
+    SPI.transfer(0x10+((col /2) %16)); //set high col address
+    oled_spi_end();
+  }
+#else
   //==========================================================//
   // Used to send commands to the display.
   void sendcommand(unsigned char com)
@@ -45,6 +137,40 @@
     mx_i2c_end(); // stop transmitting
   }
 
+  //==========================================================//
+  // Streaming data writes: one i2c transaction for a whole run of bytes
+  // (a string, a row, a page) instead of a start/stop per byte or per glyph.
+  // Wire has a small transmit buffer, so long runs are split into chunks.
+  #if (I2C_Library_Used == _I2C_Impl_SoftI2CMaster)
+    #define OLED_I2C_CHUNK 128  // bit-banged, no buffer limit (one 128 column page)
+  #else
+    #define OLED_I2C_CHUNK 16   // fits the smallest Wire/SoftWire buffer (32 bytes)
+  #endif
+
+  byte oled_stream_count;
+
+  void oled_data_begin()
+  {
+    mx_i2c_start(OLED_address);
+    mx_i2c_write(0x40); //data mode
+    oled_stream_count = 0;
+  }
+
+  void oled_data(unsigned char data)
+  {
+    if (oled_stream_count == OLED_I2C_CHUNK) {
+      mx_i2c_end();
+      oled_data_begin();
+    }
+    mx_i2c_write(data);
+    oled_stream_count++;
+  }
+
+  void oled_data_end()
+  {
+    mx_i2c_end();
+  }
+
   //==========================================================//
   // Prints a display char (not just a byte)
   // being multiples of 8. This means we have 16 COLS (0-15)
@@ -81,19 +207,22 @@
     mx_i2c_write(0x10+((col /2) %16)); //set high col address 
     mx_i2c_end();         
   }   
+#endif // OLED_SPI
 
   //==========================================================//
   // Prints a string regardless the cursor position.
   void sendStr(const char *string)
   {
     unsigned char i=0;
+    oled_data_begin();
     while(*string)
     {
       for(i=0;i<8;i++) {
-        SendByte(pgm_read_byte(myFont[*string-0x20]+i));
+        oled_data(pgm_read_byte(myFont[*string-0x20]+i));
       }
       string++;
     }
+    oled_data_end();
  
  /*
       const char *stringC=string;
@@ -118,26 +247,26 @@
     #ifdef XY
       setXY(X,Y);
       unsigned char i=0;
+      oled_data_begin();
       while(*string)
       {
         #ifdef OLED1306_128_64
-          for(i=0;i<8;i++)  SendByte(pgm_read_byte(myFont[*string-0x20]+i));
+          for(i=0;i<8;i++)  oled_data(pgm_read_byte(myFont[*string-0x20]+i));
         #else
-          for(i=0;i<4;i++)  SendByte(pgm_read_byte(myFont[*string-0x20]+i));    
+          for(i=0;i<4;i++)  oled_data(pgm_read_byte(myFont[*string-0x20]+i));    
         #endif
         string++;
       }
+      oled_data_end();
     #endif
   
-    #if defined(XY2) && not defined(DoubleFont)
+    #if defined(XY2) && not defined(DoubleFont) && not defined(XY2_PRESCALED)
       int Xh=X, Xl=X;
       const char *stringL=string, *stringH=string;
 
       setXY(Xl,Y);
+      oled_data_begin();
       while(*stringL) {
-        mx_i2c_start(OLED_address);
-        mx_i2c_write(0x40);
-
         for(int i=0;i<8;i++){
           int ril=(pgm_read_byte(myFont[*stringL-0x20]+i));
           //int il=(pgm_read_byte(&DFONT[ril & 0x0F]));
@@ -158,22 +287,17 @@
           if (bitRead(ril,3)) il|= 64+128;
 */
 
-          //mx_i2c_start(OLED_address);
-          //mx_i2c_write(0x40);
-          mx_i2c_write(il);
-          //mx_i2c_end();
+          oled_data(il);
         }
 
-        mx_i2c_end();
         Xl++;    
         stringL++;
       }
+      oled_data_end();
     
       setXY(Xh,Y+1);
+      oled_data_begin();
       while(*stringH){      
-        mx_i2c_start(OLED_address);
-        mx_i2c_write(0x40);           
-        
         for(int i=0;i<8;i++){
           int rih=(pgm_read_byte(myFont[*stringH-0x20]+i));
           //int ih=(pgm_read_byte(&DFONT[rih >>4]));
@@ -193,51 +317,45 @@
           if (bitRead(rih,6)) ih|= 16+32;
           if (bitRead(rih,7)) ih|= 64+128;
 */
-          //mx_i2c_start(OLED_address);
-          //mx_i2c_write(0x40);  
-          mx_i2c_write(ih);
-          //mx_i2c_end();          
+          oled_data(ih);
         }
 
-        mx_i2c_end();
         Xh++;    
         stringH++;
       }
+      oled_data_end();
     
-    #endif // defined(XY2) && not defined(DoubleFont)
+    #endif // defined(XY2) && not defined(DoubleFont) && not defined(XY2_PRESCALED)
 
-  #if defined(XY2) && defined(DoubleFont)
+  #if defined(XY2) && (defined(DoubleFont) || defined(XY2_PRESCALED))
     int Xh=X, Xl=X;
     const char *stringL=string, *stringH=string;
   
     setXY(Xl,Y);
+    oled_data_begin();
     while(*stringL) {
-      mx_i2c_start(OLED_address);
-      mx_i2c_write(0x40); 
-    
       for(int i=0;i<8;i++){
         int ril=(pgm_read_byte(myFont[*stringL-0x20]+i));
-        mx_i2c_write(ril);
+        oled_data(ril);
       }
-      mx_i2c_end();
       Xl++;    
       stringL++;
     }
+    oled_data_end();
   
     setXY (Xh,Y+1);
+    oled_data_begin();
     while(*stringH) {
-      mx_i2c_start(OLED_address);
-      mx_i2c_write(0x40); 
       for(int i=0;i<8;i++){
         int rih=(pgm_read_byte(myFont[*stringH-0x20]+i+8));
-        mx_i2c_write(rih);
+        oled_data(rih);
       }
-      mx_i2c_end();
       Xh++;    
       stringH++;
     }
+    oled_data_end();
   
-    #endif // defined(XY2) && defined(DoubleFont)
+    #endif // defined(XY2) && (defined(DoubleFont) || defined(XY2_PRESCALED))
   }
 
   //==========================================================//
@@ -282,10 +400,12 @@
     { 
       setXY(0,k);    
       {
+        oled_data_begin();
         for(i=0;i<128;i++)
         {
-          SendByte(0);         //clear all COL
+          oled_data(0);         //clear all COL
         }
+        oled_data_end();
       }
     }
   }
@@ -294,7 +414,14 @@
   // Inits oled and draws logo at startup
   void init_OLED(void)
   {
-    mx_i2c_init();
+    #ifdef OLED_SPI
+      oled_spi_init();
+    #else
+      mx_i2c_init();
+      #ifdef I2C_AUTOCLOCK
+        i2c_autoclock(OLED_address);   // before anything's queued (AsyncTWI polls for the ACKs)
+      #endif
+    #endif
 
     /*
     sequence := { direct_value | escape_sequence }
@@ -375,6 +502,9 @@
     #if defined(LOAD_EEPROM_LOGO)
       byte t;
     #endif
+    #if defined(LOAD_MEM_LOGO) || defined(RECORD_EEPROM_LOGO)
+      LogoReader rd(logo);
+    #endif
 
     #if defined(OLED1306_128_64) || defined(video64text32)
       for(int j=0;j<8;j++) {
@@ -382,14 +512,28 @@
       for(int j=0;j<4;j++) {
     #endif
       setXY(0,j);
+      #if defined(LOAD_MEM_LOGO) || defined(LOAD_EEPROM_LOGO)
+        oled_data_begin();       // the page in one go
+      #endif
+      #if defined(RECORD_EEPROM_LOGO) && defined(EEPROM_LOGO_COMPRESS) && defined(OLED1306_128_64)
+        LogoReader below(logo);  // the page under this one, which goes into the same EEPROM bytes
+        if (j%2 == 0) below.skip((j+1)*128);
+      #endif
       for(int i=0;i<128;i++)     // show 128* 32 Logo
       {
+        #if defined(LOAD_MEM_LOGO) || defined(RECORD_EEPROM_LOGO)
+          const byte b = rd.next();
+        #endif
+        #if defined(RECORD_EEPROM_LOGO) && defined(EEPROM_LOGO_COMPRESS) && defined(OLED1306_128_64)
+          const byte bBelow = (j%2 == 0) ? below.next() : 0;
+        #endif
+
         #ifdef LOAD_MEM_LOGO
-          SendByte(pgm_read_byte(logo+j*128+i));
+          oled_data(b);
         #endif
 
         #if defined(RECORD_EEPROM_LOGO) && not defined(EEPROM_LOGO_COMPRESS)
-          EEPROM_put(j*128+i, pgm_read_byte(logo+j*128+i));
+          EEPROM_put(j*128+i, b);
         #endif
 
         #if defined(RECORD_EEPROM_LOGO) && defined(EEPROM_LOGO_COMPRESS)
@@ -399,7 +543,7 @@
                 byte nl=0;
                 byte rnl=0;
                 byte nb=0;
-                rnl = pgm_read_byte(logo+j*128+i);
+                rnl = b;
                 for(nb=0;nb<4;nb++) {
                   if (bitRead (rnl,nb*2)) {
                     nl |= (1 << nb);
@@ -408,7 +552,7 @@
                 byte nh=0;
                 byte rnh=0;
                 byte nc=0;
-                rnh = pgm_read_byte(logo+(j+1)*128+i);
+                rnh = bBelow;
                 for(nc=0;nc<4;nc++) {
                   if (bitRead (rnh,nc*2)) {
                     nh |= (1 << nc);
@@ -419,14 +563,14 @@
               } 
 
             #else
-              EEPROM_put(j*64+i/2, pgm_read_byte(logo+j*128+i));
+              EEPROM_put(j*64+i/2, b);
             #endif
           }
         #endif   
 
         #if defined(LOAD_EEPROM_LOGO) && not defined(EEPROM_LOGO_COMPRESS)
           EEPROM_get(j*128+i, t);
-          SendByte(t);
+          oled_data(t);
         #endif
 
         #if defined(LOAD_EEPROM_LOGO) && defined(EEPROM_LOGO_COMPRESS)
@@ -464,10 +608,13 @@
               EEPROM_get(j*64+i/2, t);
             #endif
           }
-          SendByte(t);
+          oled_data(t);
         #endif   
     
       }  
+      #if defined(LOAD_MEM_LOGO) || defined(LOAD_EEPROM_LOGO)
+        oled_data_end();
+      #endif
     }
     #if defined(LOAD_MEM_LOGO) || defined(LOAD_EEPROM_LOGO)
       sendcommand(0xAF);    //display on
@@ -479,18 +626,22 @@
 
 #elif defined(P8544)
 
-  pcd8544 lcd(dc_pin, reset_pin, cs_pin);
+  #ifdef P8544_SPI
+    P8544Spi lcd(dc_pin, reset_pin, cs_pin);
+  #else
+    pcd8544 lcd(dc_pin, reset_pin, cs_pin);
+  #endif
 
-  void bitmap2(uint8_t bdata[], uint8_t rows, uint8_t columns)
+  void bitmap2(const uint8_t bdata[], uint8_t rows, uint8_t columns)
   {
     uint8_t row, column;
-    uint16_t  i; // de tipo word para poder leer mas de 256 bytes
     uint8_t toprow = 0;
     uint8_t startcolumn = 0;
-    for (row = 0, i = 0; row < rows; row++) {
+    LogoReader rd(bdata);
+    for (row = 0; row < rows; row++) {
       lcd.gotoRc(row+toprow, startcolumn);
       for (column = 0; column < columns; column++) {
-        lcd.data(pgm_read_byte(&bdata[i++]));
+        lcd.data(rd.next());
       }
     }
   }
@@ -510,6 +661,45 @@ byte scrollPos = 0;                 //Stores scrolling text position
 //unsigned long scrollTime = millis() + scrollWait;
 unsigned long scrollTime = 0;
 
+#if defined(OLED1306) && defined(XY)
+// What the scrolling line shows (0 = not known), so each scroll step only
+// sends the span of glyphs that changed, in one i2c transaction, instead
+// of a setXY and a transaction per character through printtext
+char scrollShown[16];
+
+void scrollForget() {
+  for (byte i = 0; i < 16; i++) scrollShown[i] = 0;
+}
+
+void scrollLine(const char *text) {
+  char line[16];
+  byte first = 16;
+  byte last = 0;
+  bool end = false;
+  for (byte i = 0; i < 16; i++) {
+    if (!end && text[i] == '\0') end = true;
+    line[i] = end ? ' ' : text[i];
+    if (line[i] != scrollShown[i]) {
+      if (first == 16) first = i;
+      last = i;
+    }
+  }
+  if (first == 16) return;    // nothing changed
+
+  setXY(first, lineaxy);
+  oled_data_begin();
+  for (byte i = first; i <= last; i++) {
+    for (byte c = 0; c < 8; c++) {
+      oled_data(pgm_read_byte(myFont[line[i]-0x20]+c));
+    }
+    scrollShown[i] = line[i];
+  }
+  oled_data_end();
+}
+#else
+void scrollForget() {}
+#endif
+
 void scrollText(char* text, bool is_dir){
   if(millis()<scrollTime)
     return;
@@ -543,13 +733,14 @@ void scrollText(char* text, bool is_dir){
   char outtext[17];
   byte i=0;
   byte p=scrollPos;
+  const size_t len=strlen(text);
   if(is_dir) {
     outtext[0]='>';
     i++;
   }
   for(;i<16;i++,p++)
   {
-    if(p<strlen(text)) 
+    if(p<len) 
     {
       outtext[i]=text[p];
     } else {
@@ -557,7 +748,11 @@ void scrollText(char* text, bool is_dir){
     }
   }
   outtext[16]='\0';
-  printtext(outtext,lineaxy);
+    #ifdef XY
+    scrollLine(outtext);
+    #else
+    printtext(outtext,lineaxy);
+    #endif
   #endif
 
   #ifdef P8544
@@ -590,6 +785,7 @@ void scrollText(char* text, bool is_dir){
 
 void scrollText(char* text, bool is_dir, byte scroll_pos) {
   // this variant resets the scroll position and timer, so printing is immediate
+  scrollForget();
   scrollPos = scroll_pos;
   scrollTime = 0;
   scrollText(text, is_dir);
@@ -598,8 +794,13 @@ void scrollText(char* text, bool is_dir, byte scroll_pos) {
 char fline[17];
 
 void printtext2F(const char* text, int l) {  //Print text to screen. 
+  #if defined(OLED1306) && defined(XY)
+    if (l == lineaxy) scrollForget();
+  #endif
   
-  #ifdef SERIALSCREEN
+  #ifdef SERIAL_QUEUE
+  serq_lineF(text);
+  #elif defined(SERIALSCREEN)
   Serial.println(reinterpret_cast <const __FlashStringHelper *> (text));
   #endif
   
@@ -637,8 +838,13 @@ void printtext2F(const char* text, int l) {  //Print text to screen.
 }
 
 void printtextF(const char* text, int l) {  //Print text to screen. 
+  #if defined(OLED1306) && defined(XY)
+    if (l == lineaxy) scrollForget();
+  #endif
   
-  #ifdef SERIALSCREEN
+  #ifdef SERIAL_QUEUE
+    serq_lineF(text);
+  #elif defined(SERIALSCREEN)
     Serial.println(reinterpret_cast <const __FlashStringHelper *> (text));
   #endif
   
@@ -688,8 +894,13 @@ void printtextF(const char* text, int l) {  //Print text to screen.
 }
 
 void printtext(char* text, int l) {  //Print text to screen. 
+  #if defined(OLED1306) && defined(XY)
+    if (l == lineaxy) scrollForget();
+  #endif
   
-  #ifdef SERIALSCREEN
+  #ifdef SERIAL_QUEUE
+    serq_line(text);
+  #elif defined(SERIALSCREEN)
     Serial.println(text);
   #endif
   
@@ -827,8 +1038,18 @@ void OledStatusLine() {
 }
 #endif // defined(OLED1306)
 
+#ifdef SCROLL_WHILE_PLAYING
+void scrollTextPlaying(char* text) {
+  // from TZXLoop, only when the buffer is full (see lcdTime)
+  if(millis()<scrollTime || strlen(text)<=SCREENSIZE)
+    return;
+  scrollText(text, false);
+}
+#endif
+
 void scrollTextReset()
 {
+  scrollForget();
   scrollTime=millis()+scrollWait;
   scrollPos=0;
 }
@@ -10,10 +10,21 @@
 
 #elif defined(OLED1306)
   #define SCREENSIZE 16
+  #ifdef OLED_SPI
+    #if !defined(OLED_SPI_CS) || !defined(OLED_SPI_DC)
+      #error OLED_SPI needs OLED_SPI_CS and OLED_SPI_DC (and optionally OLED_SPI_RST) set to the display pins
+    #endif
+    #ifndef OLED_SPI_CLOCK
+      #define OLED_SPI_CLOCK 8000000L   // SSD1306 and SH1106 are good for 10MHz
+    #endif
+  #endif
   void sendcommand(unsigned char com);
   void SendByte(unsigned char data);
   void sendChar(unsigned char data);
   void setXY(unsigned char col,unsigned char row);
+  void oled_data_begin();           // a run of data bytes in one transaction (split as the bus needs)
+  void oled_data(unsigned char data);
+  void oled_data_end();
   void sendStr(const char *string);
   void sendStrXY(const char *string, int X, int Y);
   void reset_display(void);
@@ -22,7 +33,7 @@
   void clear_display(void);
   void init_OLED(void);
 
-  #if defined(XY2) && not defined(DoubleFont)
+  #if defined(XY2) && not defined(DoubleFont) && not defined(XY2_PRESCALED)
     PROGMEM const byte DFONT[16] = { 0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F, 0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF };
   #endif
 
@@ -37,6 +48,10 @@
 
 #elif defined(P8544)
   #define SCREENSIZE 14
+  #ifdef P8544_SPI
+    #include "pcd8544spi.h"
+    extern P8544Spi lcd;
+  #endif
   void bitmap2(uint8_t bdata[], uint8_t rows, uint8_t columns);
   void P8544_splash (void);
 
@@ -58,6 +73,9 @@
 void scrollText(char* text, bool is_dir);
 void scrollText(char* text, bool is_dir, byte scroll_pos);
 void scrollTextReset();
+#ifdef SCROLL_WHILE_PLAYING
+void scrollTextPlaying(char* text);
+#endif
 void printtext2F(const char* text, int l);
 void printtextF(const char* text, int l);
 void printtext(char* text, int l);
@@ -1,4 +1,5 @@
 // platform-independent wrapper for common eeprom interface
+// (EEPROM_update writes a byte only if it has changed and, on the ESP8266, doesn't commit)
 
 #ifndef EEPROM_H_INCLUDED
 #define EEPROM_H_INCLUDED
@@ -9,37 +10,57 @@
   #include <EEPROM.h>
   #define EEPROM_put EEPROM.put
   #define EEPROM_get EEPROM.get
+  #define EEPROM_update EEPROM.update
 
 #elif defined(__arm__) && defined(__STM32F1__)
   #include <EEPROM.h>
-  uint8_t EEPROM_get(uint16_t address, byte &data) {
+  inline uint8_t EEPROM_get(uint16_t address, byte &data) {
     if (EEPROM.init()==EEPROM_OK) {
       data = (byte)(EEPROM.read(address) & 0xff);  
       return true;  
     } else 
       return false;
   } 
-  uint8_t EEPROM_put(uint16_t address, byte data) {
+  inline uint8_t EEPROM_put(uint16_t address, byte data) {
     if (EEPROM.init()==EEPROM_OK) {
       EEPROM.write(address, (uint16_t) data); 
       return true;    
     } else
       return false;
   }
+  inline void EEPROM_update(uint16_t address, byte data) {
+    byte old;
+    if (!EEPROM_get(address, old) || old != data) EEPROM_put(address, data);
+  }
   
 #elif defined(ESP8266)
   #include <ESP_EEPROM.h>
-  uint8_t EEPROM_get(uint16_t address, byte &data) {
-      EEPROM.begin(512);
+  // begin() reloads the RAM copy from flash, which would lose anything
+  // written but not committed, so only do it once.  1024 so that
+  // BLOCK_EEPROM_START and EEPROM_CONFIG_BYTEPOS are inside it.
+  inline void EEPROM_begin() {
+      static bool begun = false;
+      if (!begun) {
+        EEPROM.begin(1024);
+        begun = true;
+      }
+  }
+  inline uint8_t EEPROM_get(uint16_t address, byte &data) {
+      EEPROM_begin();
       EEPROM.get(address, data) ;  
       return true;     
   }
-  uint8_t EEPROM_put(uint16_t address, byte data) {
-      EEPROM.begin(512);
+  inline uint8_t EEPROM_put(uint16_t address, byte data) {
+      EEPROM_begin();
       EEPROM.put(address, data); 
       EEPROM.commit();
       return true;      
   }
+  inline void EEPROM_update(uint16_t address, byte data) {
+      byte old;
+      EEPROM_get(address, old);
+      if (old != data) EEPROM.put(address, data);
+  }
 #endif
   
 #endif // EEPROM_H_INCLUDED
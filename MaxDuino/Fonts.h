@@ -38,6 +38,17 @@
   #else
     #define _FONT FONT8x16_DEFAULT
   #endif
+#elif defined(XY2) && defined(XY2_PRESCALED)
+  // the 8x8 font, already doubled to 8x16 by fonts/scale_fonts.py
+  #define _FONTHEIGHT 16
+  #define _FONTPATH fonts/8x8x2/font_
+  #ifdef FONT
+    #define _FONT FONT
+  #elif defined(FONT8x8)
+    #define _FONT FONT8x8
+  #else
+    #define _FONT FONT8x8_DEFAULT
+  #endif
 #else
   #define _FONTHEIGHT 8
   #define _FONTPATH fonts/8x8/font_
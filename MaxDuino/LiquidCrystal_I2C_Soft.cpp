@@ -8,6 +8,20 @@
 #include "i2c.h"
 #include <inttypes.h>
 
+// Writes go out in bursts: one I2C transaction carries the PCF8574 states
+// for as many HD44780 nibbles (and their enable strobes) as fit, rather than
+// a start and stop for every edge.  The expander's outputs change as each
+// byte is acked, so the bus time is what spaces them: one byte is far longer
+// than the enable pulse needs, and LCD_EXEC_PAD repeats of the idle state
+// after each write stand in for the delay while it executes.
+namespace {
+constexpr unsigned LCD_BYTE_US = 9000000UL / I2CCLOCK;    // 9 clocks a byte (rounded down: a slower bus only adds)
+constexpr byte LCD_EXEC_US = 50;                           // as pulseEnable: a write needs >37us
+constexpr byte LCD_EXEC_PAD = (LCD_EXEC_US + LCD_BYTE_US - 1) / LCD_BYTE_US - 1;  // the next strobe is a byte on already
+constexpr byte LCD_WRITE_BYTES = 4 + LCD_EXEC_PAD;
+constexpr byte LCD_BURST = 28;                             // bytes a transaction, inside Wire's 32 and TWI_QUEUE_SIZE
+}
+
 #if defined(ARDUINO) && ARDUINO >= 100
 
 inline size_t LiquidCrystal_I2C::write(uint8_t value) {
@@ -15,6 +29,15 @@ inline size_t LiquidCrystal_I2C::write(uint8_t value) {
 	return 1;
 }
 
+size_t LiquidCrystal_I2C::write(const uint8_t *buffer, size_t size) {
+	for (size_t done = 0; done < size; ) {
+		const uint8_t n = (size - done > 255) ? 255 : size - done;
+		burst(buffer + done, n, Rs);
+		done += n;
+	}
+	return size;
+}
+
 #else
 #include "WProgram.h"
 
@@ -206,8 +229,7 @@ void LiquidCrystal_I2C::noAutoscroll(void) {
 void LiquidCrystal_I2C::createChar(uint8_t location, uint8_t charmap[]) {
 	location &= 0x7; // we only have 8 locations 0-7
 	command(LCD_SETCGRAMADDR | (location << 3));
-	for (byte i=0; i<8; i++)
-		mx_i2c_write(charmap[i]);
+	burst(charmap, 8, Rs);
 }
 
 // Turn the (optional) backlight off/on
@@ -234,10 +256,30 @@ inline void LiquidCrystal_I2C::command(uint8_t value) {
 
 // write either command or data
 void LiquidCrystal_I2C::send(uint8_t value, uint8_t mode) {
-	uint8_t highnib=value&0xf0;
-	uint8_t lownib=(value<<4)&0xf0;
-	write4bits((highnib)|mode);
-	write4bits((lownib)|mode); 
+	burst(&value, 1, mode);
+}
+
+// n writes, all with the same RS
+void LiquidCrystal_I2C::burst(const uint8_t *p, uint8_t n, uint8_t mode) {
+	const uint8_t bits = mode | _backlightval;
+	byte used = LCD_BURST;
+	for (uint8_t i = 0; i < n; i++) {
+		const uint8_t hi = (p[i] & 0xf0) | bits;
+		const uint8_t lo = (p[i] << 4) | bits;
+		if (used + LCD_WRITE_BYTES > LCD_BURST) {
+			if (i) mx_i2c_end();
+			mx_i2c_start(_Addr);
+			mx_i2c_write(hi);	// RS settles before the first strobe
+			used = 1;
+		}
+		mx_i2c_write(hi | En);
+		mx_i2c_write(hi);	// latched on the falling edge
+		mx_i2c_write(lo | En);
+		mx_i2c_write(lo);
+		for (byte k = 0; k < LCD_EXEC_PAD; k++) mx_i2c_write(lo);
+		used += LCD_WRITE_BYTES;
+	}
+	if (n) mx_i2c_end();
 }
 
 void LiquidCrystal_I2C::write4bits(uint8_t value) {
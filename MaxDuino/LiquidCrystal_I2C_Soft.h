@@ -84,6 +84,8 @@ public:
   void setCursor(uint8_t, uint8_t); 
 #if defined(ARDUINO) && ARDUINO >= 100
   virtual size_t write(uint8_t);
+  virtual size_t write(const uint8_t *buffer, size_t size);  // a whole string at once (see burst)
+  using Print::write;
 #else
   virtual void write(uint8_t);
 #endif
@@ -117,6 +119,7 @@ private:
   void write4bits(uint8_t);
   void expanderWrite(uint8_t);
   void pulseEnable(uint8_t);
+  void burst(const uint8_t *p, uint8_t n, uint8_t mode);
   uint8_t _Addr;
   uint8_t _displayfunction;
   uint8_t _displaycontrol;
@@ -78,7 +78,7 @@
 
 const unsigned char logo1 [] PROGMEM = {
 #include LOGO_header(_LOGO1PATH, _LOGO)
-}
+};
 
 const unsigned char logo2 [] PROGMEM = {
 #include LOGO_header(_LOGO2PATH, _LOGO)
@@ -86,8 +86,39 @@ const unsigned char logo2 [] PROGMEM = {
 
 const unsigned char logo [] PROGMEM = {
 #include LOGO_header(_LOGOPATH, _LOGO)
-}
+};
 
 #endif // P8544
 
+//==========================================================//
+
+#if defined(OLED1306) || defined(P8544)
+// The logo a byte at a time, as it's stored: just the bytes, or run length
+// coded if the logo file has LOGO_IS_RLE (see logos/logo_rle.py)
+struct LogoReader {
+  const unsigned char *p;
+  byte left = 0;          // bytes still to come from this run
+  bool repeat = false;
+
+  explicit LogoReader(const unsigned char *logo) : p(logo) {}
+
+  byte next() {
+  #ifdef LOGO_IS_RLE
+    if (left == 0) {
+      const byte n = pgm_read_byte(p++);
+      repeat = n & 0x80;
+      left = repeat ? n - 0x7E : n + 1;
+    }
+    left--;
+    if (repeat) return pgm_read_byte(left ? p : p++);
+  #endif
+    return pgm_read_byte(p++);
+  }
+
+  void skip(word n) {
+    while (n--) next();
+  }
+};
+#endif
+
 #endif // LOGOS_H_INCLUDED
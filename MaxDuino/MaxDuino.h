@@ -12,6 +12,7 @@
 // processing.cpp can call stopFile and seekFile, which are defined in MaxDuino.ino
 void stopFile();
 void seekFile();
+void fileEnded();   // instead of stopFile, when a file has played right through
 
 //TZX block list - uncomment as supported
 enum BLOCKID
@@ -23,7 +24,7 @@ enum BLOCKID
   ID13 = 0x13,    //Sequence of pulses of various lengths
   ID14 = 0x14,    //Pure data block
   ID15 = 0x15,    //Direct recording block
-//  ID18 = 0x18,    //CSW recording block
+  ID18 = 0x18,    //CSW recording block
   ID19 = 0x19,    //Generalized data block (NB hacked for zx81 only, will not work for anything else)
   ID20 = 0x20,    //Pause (silence) or 'Stop the tape' command
   ID21 = 0x21,    //Group start
@@ -44,6 +45,10 @@ enum BLOCKID
   ID4B = 0x4B,    //Kansas City block (MSX/BBC/Acorn/...)
   ID5A = 0x5A,    //Glue block (90 dec, ASCII Letter 'Z')
   IDPAUSE = 0x80, //Custom Pause processing
+  WAV = 0xF0,     //WAV capture, squared up as it plays (see wav.h)
+  SNAP = 0xF1,    //Spectrum snapshot, played as ROM blocks (see snapshot.h)
+  MXW = 0xF2,     //Pre-rendered buffer words (see mxw.h)
+  CSW = 0xF3,     //CSW file (Compressed Square Wave)
   C64TAP = 0xF4,  //Commodore C64/C16 TAP image
   MTX = 0xF5,     //Memotech MTX image
   CAQ = 0xF6,     //Mattel Aquarius CAQ cassette image
@@ -108,24 +113,53 @@ enum class BLOCKTASK : byte
 
 #ifdef Use_CAQ
   // tasks for CAQ processing
-  CAQ_START_BIT,
-  CAQ_DATA_BITS,
-  CAQ_STOP_BIT1,
-  CAQ_STOP_BIT2,
-  CAQ_DONE
+  CAQ_NEXT_BYTE,
+  CAQ_BYTE
 #endif
 };
 
-//Spectrum Standards
-#define PILOTLENGTH           619
-#define SYNCFIRST             191
-#define SYNCSECOND            210
-#define ZEROPULSE             244
-#define ONEPULSE              489
+//Spectrum Standards, in T-states (see StandardTimings)
+#define PILOTLENGTH           2168
+#define SYNCFIRST             667
+#define SYNCSECOND            735
+#define ZEROPULSE             855
+#define ONEPULSE              1710
 #define PILOTNUMBERL          8063
 #define PILOTNUMBERH          3223
 #define PAUSELENGTH           1000   
 
+#ifdef TAPSPEEDUP
+// No turbo loader is sent ahead of the .tap: its own BASIC LOADs each
+// block through LD-BYTES in ROM, which has no RAM hook to divert, so a
+// loader would never get control (Use_SNAPSHOT can, as it writes the
+// program itself).  The speed-up is only what LD-BYTES still takes.
+//
+// What the ROM's LD-BYTES will still take.  It waits a second after the
+// first edge and then wants 256 pilot pulses, so 2400 (about 1.5s) is
+// plenty; and it only tells the bits apart by whether two edges take
+// more or less than about 2400 T-states, with about 450 T-states of
+// overhead before each edge.  So a zero can come down to 2 x 600, which
+// leaves it further from the line than the standard one pulse is.
+#define TAPSPEEDUP_PILOT      2400
+#define TAPSPEEDUP_ZERO       600
+#endif
+
+#ifdef PILOT_TRIM
+// The most pilot the ROM loaders are given, for blocks in their own format.
+// The Spectrum's as TAPSPEEDUP_PILOT.  The CPC's firmware averages 256
+// pulses after it has settled on the pilot.  And the MSX BIOS wants about
+// 1111 cycles of header, where a (CAS) header unit is 11 one bits.
+#ifndef PILOT_TRIM_ZX
+#define PILOT_TRIM_ZX         2400
+#endif
+#ifndef PILOT_TRIM_CPC
+#define PILOT_TRIM_CPC        1024
+#endif
+#ifndef PILOT_TRIM_CAS
+#define PILOT_TRIM_CAS        160
+#endif
+#endif
+
 //Main Variables
 extern bool pauseOn;                   //Pause state
 extern byte start;                     //Currently playing flag
@@ -149,5 +183,16 @@ extern byte jtapflag;
 #define DEBUG 0
 
 void block_mem_oled();
+#if defined(OLED1306) && defined(OLEDPRINTBLOCK)
+void block_show();      // draw what block_mem_oled left, once the buffer is full
+#endif
+
+#ifdef BLOCKID_INTO_MEM
+void block_table_clear();
+#endif
+#if defined(BLOCKID_NOMEM_SEARCH) || defined(BLOCK_SD_INDEX)
+bool SkipBlockHeader(unsigned long &blockStart, bool &counted);
+bool TZXJump(unsigned long from, int disp);
+#endif
 
 #endif // MAXDUINO_H_INCLUDED
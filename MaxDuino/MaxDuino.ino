@@ -167,10 +167,39 @@
 #include "USBStorage.h"
 #include "power.h"
 #include "record.h"
-
-#ifdef BLOCK_EEPROM_PUT
-#include "EEPROM_wrappers.h"
-#endif
+#include "blockindex.h"
+#include "tzxprogram.h"
+#include "tzxmeta.h"
+#include "uef.h"
+#include "csw.h"
+#include "scrub.h"
+#include "wifiservice.h"
+#include "netstream.h"
+#include "cdcstream.h"
+#include "sertrace.h"
+#include "blockcheck.h"
+#include "mxw.h"
+#include "CheckForExt.h"
+#include "baudcache.h"
+
+#include "blockstore.h"
+#include "dirview.h"
+#include "namecache.h"
+#include "dirscan.h"
+#include "lastfile.h"
+#include "ramwatch.h"
+#include "motorsense.h"
+#include "fanout.h"
+#include "station2.h"
+#include "zip.h"
+#include "rateprobe.h"
+#include "playlog.h"
+#include "serqueue.h"
+#include "hostctl.h"
+#include "soak.h"
+#include "flashlib.h"
+#include "sdswap.h"
+#include "encoder.h"
 
 SdFat sd;                           //Initialise Sd card 
 SdBaseFile _tmpdirs[2]; // internal file pointers.  (*currentDir points to either _tmpdirs[0] or _tmpdirs[1] and the other is 'scratch')
@@ -178,16 +207,15 @@ SdBaseFile *currentDir = &_tmpdirs[0];  // SD card directory
 byte _alt_tmp_dir = 1; // which of the _tmpdirs is scratch (we flip this between 0 and 1)
 
 #ifdef FREERAM
-  #define filenameLength 160
-  #define nMaxPrevSubDirs 7  
+  #define nMaxPrevSubDirs 12  
 #else 
-  #define filenameLength 255
-  #define nMaxPrevSubDirs 10  
+  #define nMaxPrevSubDirs 20  
 #endif
 
 char fileName[filenameLength + 1];    //Current filename
 char prevSubDir[SCREENSIZE+1];
 uint16_t DirFilePos[nMaxPrevSubDirs];  //File Positions in Directory to be restored (also, history of subdirectories)
+uint16_t DirMaxFile[nMaxPrevSubDirs];  //maxFile of each parent directory, so going back up doesn't need to rescan it
 byte subdir = 0;
 
 #ifndef NO_MOTOR
@@ -203,6 +231,33 @@ uint16_t maxFile;                   //Total number of files in directory
 bool dirEmpty;                      //flag if directory is completely empty
 uint16_t oldMinFile = 0;
 uint16_t oldMaxFile = 0;
+#ifdef AUTO_ADVANCE
+  uint16_t nextFile = 0;            // file to play when the current one ends
+  bool nextFileFound = false;
+  bool nextFileLooked = false;      // nextFile/nextFileFound are up to date for the current playback
+  bool autoPlay = false;            // the main loop should start playing currentFile
+#endif
+#if defined(FAST_BOOT) || defined(SD_HOTSWAP)
+  #define MAXFILE_UNKNOWN 0xFFFF    // (in DirMaxFile) a level resumed into at power on (or after a card change), never counted
+#endif
+#ifdef FAST_BOOT
+  bool scanPending = false;         // currentDir is still being counted, maxFile is only as far as currentFile
+  uint32_t scanPos;                 // where the count has got to in currentDir
+  uint16_t scanMax;
+  bool scanEmpty;
+#endif
+#if defined(OLED1306) && defined(OLEDPRINTBLOCK)
+  bool blockToShow = false;         // block_mem_oled has a block for block_show
+  word shownBlock;
+  byte shownID;
+#endif
+#ifdef RESUME_CHECKPOINT
+  bool resumeOffered = false;       // the first PLAY goes on to cpBlock, in the file resumed into at power on
+  bool checkpointDirty = false;     // a block has started since cpBlock was written
+  word cpBlock;
+  unsigned long cpPos;
+  byte cpID;
+#endif
 
 #ifdef SHOW_DIRNAMES
   #define fnameLength  5
@@ -210,6 +265,16 @@ uint16_t oldMaxFile = 0;
   char oldMaxFileName[fnameLength];
 #endif
 
+#ifdef Use_ZIP
+  uint16_t zipMaxFile;              // the directory's maxFile, to go back to (the zip is zip_archive())
+#endif
+#ifdef FLASH_LIBRARY
+  uint16_t libMaxFile;              // the root's maxFile and currentFile, to go back to
+  uint16_t libFile;
+  bool libDirEmpty;
+  bool cardMissing = false;         // started in the library with no card in, so there's no going back
+#endif
+
 bool isDir;                         //Is the current file a directory
 unsigned long timeDiff = 0;         //button debounce
 
@@ -221,8 +286,28 @@ unsigned long timeDiff = 0;         //button debounce
 char PlayBytes[17];
 
 #ifdef BLOCKID_INTO_MEM 
-unsigned long blockOffset[maxblock];
-byte blockID[maxblock];
+// Where each block starts, in the top 24 bits, with its ID in the low 8;
+// 0 for one not reached yet.  Without BLKBIGSIZE block is a byte, so no
+// more than 256 entries are any use.
+#if !defined(BLKBIGSIZE) && BLOCK_TABLE_SIZE > 256
+  #define BLOCK_TABLE_ENTRIES 256
+#else
+  #define BLOCK_TABLE_ENTRIES BLOCK_TABLE_SIZE
+#endif
+// With BLOCK_SD_INDEX the numbering carries on past the table and the
+// sidecar index finds the rest; otherwise it goes round the table.
+#if defined(BLOCK_SD_INDEX) && defined(BLKBIGSIZE)
+  #define BLOCK_LAST 0xFFFF
+#elif defined(BLOCK_SD_INDEX)
+  #define BLOCK_LAST 0xFF
+#else
+  #define BLOCK_LAST (BLOCK_TABLE_ENTRIES-1)
+#endif
+uint32_t blockTable[BLOCK_TABLE_ENTRIES];
+
+void block_table_clear() {
+  memset(blockTable, 0, sizeof(blockTable));
+}
 #endif
 
 #ifdef BLKBIGSIZE
@@ -250,8 +335,20 @@ bool firstBlockPause = false;
 #endif
 
 void setup() {
+  #ifdef RAM_WATCH
+    ramwatch_paint();
+  #endif
   pinsetup();
+  #ifdef MOTOR_IRQ
+    motor_sense_setup();
+  #endif
+  #ifdef FAST_BOOT
+    UniSetup();                     // the output is set up and held low before anything slow
+  #endif
   pinMode(chipSelect, OUTPUT);      //Setup SD card chipselect pin
+  #if defined(OLED_SPI) || defined(P8544_SPI)
+    digitalWrite(chipSelect, HIGH);   // keep the card off the bus while the display is set up
+  #endif
 
   #ifdef LCDSCREEN16x2
     lcd.init();                     //Initialise LCD (16x2 type)
@@ -268,11 +365,17 @@ void setup() {
   #ifdef SERIALSCREEN
   Serial.begin(115200);
   #endif
+  #ifdef CDC_STREAM
+  setup_cdc_stream();
+  #endif
+  #ifdef SERIAL_TRACE
+  setup_serial_trace();
+  #endif
   
   #ifdef OLED1306
     init_OLED();
-    #if (!SPLASH_SCREEN)
-      #if defined(LOAD_MEM_LOGO) || defined(LOAD_EEPROM_LOGO)
+    #if (!SPLASH_SCREEN) || defined(FAST_BOOT)
+      #if (defined(LOAD_MEM_LOGO) || defined(LOAD_EEPROM_LOGO)) && !defined(FAST_BOOT)
         delay(1500);             // Show logo
       #endif
       reset_display();           // Clear logo and load saved mode
@@ -288,12 +391,17 @@ void setup() {
   #ifdef P8544 
     lcd.begin();
     analogWrite (backlight_pin, 20);
-    P8544_splash(); 
+    #ifndef FAST_BOOT
+      P8544_splash(); 
+    #endif
   #endif
 
   setup_buttons();
+  #ifdef ROTARY_ENCODER
+  setup_encoder();
+  #endif
  
-  #ifdef SPLASH_SCREEN
+  #if defined(SPLASH_SCREEN) && !defined(FAST_BOOT)
     while (!button_any()){
       delay(100);                // Show logo (OLED) or text (LCD) and remains until a button is pressed.
     }   
@@ -309,15 +417,31 @@ void setup() {
     #endif
   #endif
 
-  while (!sd.begin(chipSelect, SD_SPI_CLOCK_SPEED)) {
+#ifdef FLASH_LIBRARY
+  lib_begin();
+#endif
+  while (!cardBegin()) {
     //Start SD card and check it's working
     printtextF(PSTR("No SD Card"),0);
     delay(50);
+    #ifdef CDC_STREAM
+    if (cdc_poll()) break;    // the host can send a file to play without a card
+    #endif
+    #ifdef FLASH_LIBRARY
+    if (lib_present()) {      // or there's the library
+      cardMissing = true;
+      break;
+    }
+    #endif
     #ifdef SOFT_POWER_OFF
     check_power_off_key();
     #endif
   }    
 
+  #ifdef SD_HOTSWAP
+  sdswap_mounted();
+  #endif
+
   #ifdef USB_STORAGE_ENABLED
   usb_detach();
   delay(500);
@@ -326,10 +450,21 @@ void setup() {
   #endif
 
   changeDirRoot();
-  UniSetup();                       //Setup TZX specific options
+  #ifndef FAST_BOOT
+    UniSetup();                       //Setup TZX specific options
+  #endif
+
+  #ifdef WIFI_SERVICE
+  setup_wifi_service();
+  #endif
+  #ifdef HOST_CONTROL
+  setup_host_control();
+  #endif
     
-  printtextF(PSTR("Reset.."),0);
-  delay(500);
+  #ifndef FAST_BOOT
+    printtextF(PSTR("Reset.."),0);
+    delay(500);
+  #endif
   
   #ifdef LCDSCREEN16x2
     lcd.clear();
@@ -339,29 +474,136 @@ void setup() {
     lcd.clear();
   #endif
        
+  #ifdef FAST_BOOT
+    if (!resumeLastFile())          //straight back to the last file played, counting the directory later
+  #endif
   getMaxFile();                     //get the total number of files in the directory
 
   seekFile();            //move to the first file in the directory
+  #ifdef FLASH_LIBRARY
+    if (cardMissing) changeDirLib();
+  #endif
+  #ifdef RESUME_CHECKPOINT
+    if (resumeOffered) {
+      // it hadn't finished: PLAY carries on from the block it had got to
+      strcpy_P(PlayBytes, PSTR("PLAY: blk "));
+      utoa(cpBlock, PlayBytes+strlen(PlayBytes), 10);
+      printtext(PlayBytes,0);
+    }
+  #endif
 
   #ifdef LOAD_EEPROM_SETTINGS
     loadEEPROM();
   #endif  
 
+  #ifdef RATE_PROBE
+    rateprobe_load();               // what the speed-ups hold back to
+  #endif
+
   #if defined(OLED1306) && defined(OSTATUSLINE)
     OledStatusLine();
   #endif
 }
 
+bool cardBegin() {
+  // mount the card (setup, and SD_HOTSWAP's remount)
+#if defined(SD_SDIO)
+  return sd.begin(SdioConfig(FIFO_SDIO));
+#elif defined(SD_CLOCK_PROBE)
+  return sdProbeBegin();
+#elif defined(SD_RAW_READ) && ENABLE_DEDICATED_SPI && !defined(OLED_SPI) && !defined(P8544_SPI) && !defined(USB_STORAGE_TASK)
+  // a dedicated SPI card keeps its multi-sector read going between readSectors calls
+  // (not with an SPI display, which needs the bus between reads)
+  return sd.begin(SdSpiConfig(chipSelect, DEDICATED_SPI, SD_SPI_CLOCK_SPEED));
+#else
+  return sd.begin(chipSelect, SD_SPI_CLOCK_SPEED);
+#endif
+}
+
+#ifdef SD_CLOCK_PROBE
+bool sdProbeBegin() {
+  // mount the card at the fastest of SD_PROBE_CLOCKS that it reads back reliably at
+  // (sd_probe).  Dedicated SPI is tried first at each, where it's enabled, then shared
+  static const byte clocks[] PROGMEM = { SD_PROBE_CLOCKS };
+  for (byte i=0; i<sizeof(clocks); i++) {
+    const uint32_t clock = SD_SCK_MHZ(pgm_read_byte(clocks+i));
+    #if ENABLE_DEDICATED_SPI && !defined(OLED_SPI) && !defined(P8544_SPI) && !defined(USB_STORAGE_TASK)
+      if (sd.begin(SdSpiConfig(chipSelect, DEDICATED_SPI, clock)) && sd_probe()) return true;
+    #endif
+    if (sd.begin(SdSpiConfig(chipSelect, SHARED_SPI, clock)) && sd_probe()) return true;
+  }
+  return false;
+}
+#endif
+
 extern unsigned long soft_poweroff_timer;
 
+// Longest the main loop spends filling the buffer in one go before the
+// display, buttons and motor get a turn
+#define FILL_BUDGET_US 2000
+
 void loop(void) {
+  #ifdef RAM_WATCH
+    ramwatch_sample();
+  #endif
+  #ifdef SERIAL_QUEUE
+    serq_service();
+  #endif
+  #ifdef IDLE_CLOCK
+    // down while there's nothing to time (playFile and start_recording put it back first)
+    if(start==0 && !is_recording()) cpu_clock(false);
+  #endif
   if(start==1)
   {
     //TZXLoop only runs if a file is playing, and keeps the buffer full.
-    UniLoop();
+    //Filling comes first: keep at it while any page is free (up to the
+    //budget), and only then fall through to the UI work below
+    const unsigned long fillStart = micros();
+    do {
+      UniLoop();
+    } while (start==1 && !pauseOn && buffer_has_room() && micros() - fillStart < FILL_BUDGET_US);
+    #ifdef RESUME_CHECKPOINT
+      if (checkpointDirty && start==1 && (pauseOn || !buffer_has_room())) {
+        // with the buffer full (or paused) there's time to write where it's got to
+        checkpointDirty = false;
+        lastfile_checkpoint(cpBlock, cpPos, cpID);
+      }
+    #endif
+    #ifdef BLOCK_CHECK
+      if (start==1 && !buffer_has_room()) blockcheck_service();   // while the pilot plays from the buffer
+    #endif
+    #ifdef NET_STREAM
+      net_service();    // keep the network ahead of the player
+    #endif
+    #ifdef SERIAL_TRACE
+      trace_service();
+    #endif
+    #ifdef AUTO_ADVANCE
+      if(EndOfFile && !nextFileLooked) findNextFile();
+    #endif
   } else {
+    #ifdef Use_Rec
+      // every time round, not only at the 50ms checks: the Nano's pages
+      // fill in a few tens of ms
+      recording_loop();
+    #endif
+    #ifdef Use_Rec_Monitor
+      if (!is_recording())    // the recorder has the output
+    #endif
     WRITE_LOW;    
   }
+
+  #ifdef AUTO_ADVANCE
+    if(autoPlay && start==0) {
+      //the last file played to the end, so carry on with the next one
+      playFile();
+      #ifndef NO_MOTOR
+      if (mselectMask){  
+        oldMotorState = 0;
+      }
+      #endif
+    }
+  #endif
   
   #ifdef Use_Rec
     if(start==0 && !is_recording() && (strlen(fileName)> SCREENSIZE)) {
@@ -377,9 +619,29 @@ void loop(void) {
     }
   #endif
 
+  #ifdef FAST_BOOT
+    if(scanPending && start==0) scanStep();   // a sector's worth of the count at a time
+  #endif
+  #ifdef REC_COMPACT
+    if(start==0 && !is_recording() && recording_compact()) {
+      // a recording has been swapped for its compacted copy
+      getMaxFile();
+      seekFile();
+    }
+  #endif
+
   #ifndef NO_MOTOR
     motorState=digitalRead(btnMotor);
   #endif
+  #ifdef MOTOR_IRQ
+    motor_sense_arm(start==1 && mselectMask);
+  #endif
+  #ifdef FANOUT_MOTOR
+    fanout_motor(start==1 && mselectMask);
+  #endif
+  #ifdef STATION2
+    station2_loop();
+  #endif
   
   #if (SPLASH_SCREEN && TIMEOUT_RESET)
     if (millis() - timeDiff_reset > 1000) //check timeout reset every second
@@ -429,9 +691,15 @@ void loop(void) {
         #endif
 
         recording_loop();
-        if (button_stop()) {
+        #ifdef REC_USES_BUTTON_ADC
+          // the ADC buttons can't be read while the recorder has the ADC
+          bool (*stop_button)() = button_rec;
+        #else
+          bool (*stop_button)() = button_stop;
+        #endif
+        if (stop_button()) {
           stop_recording();
-          debounce(button_stop);
+          debounce(stop_button);
 
         // Refresh UI and return to main browser screen (same behavior as when
         // the user exits the menu). The new recording file may have changed
@@ -465,33 +733,150 @@ void loop(void) {
     }
   #endif
 
-    if(button_play()) {
-      //Handle Play/Pause button
-      if(start==0) {
-        //If no file is play, start playback
-        playFile();
-        #ifndef NO_MOTOR
-        if (mselectMask){  
-          //Start in pause if Motor Control is selected
-          oldMotorState = 0;
+  #ifdef CDC_STREAM
+    if (start==0 && cdc_poll() && cdc_open()) {
+      isDir = 0;
+      playFile();
+    }
+  #endif
+
+  #ifdef USB_STORAGE_POLLED
+    if (start==0) usb_storage_loop();
+  #endif
+  #ifdef USB_STORAGE_ENABLED
+    if (start==0 && usb_storage_changed()) {
+      // the host wrote to the card: remount, so nothing cached is stale, and go back to the root
+      sd.volumeBegin();
+      subdir=0;
+      changeDirRoot();
+      getMaxFile();
+      seekFile();
+    }
+  #endif
+  #ifdef SD_HOTSWAP
+    if (!LIB_BROWSING && !stream_active() && sdswap_changed(start==0)) {
+      if (start==1) stopFile();     // (the card's already gone)
+      cardSwapped();
+    }
+  #endif
+
+  #ifdef WIFI_SERVICE
+    wifi_service_loop();
+    word wifiArg;
+    switch (wifi_take_command(wifiArg)) {
+      case WIFI_CMD::PLAY:
+        if (start==0 && *wifi_select_name()) selectFileByName(wifi_select_name());
+        if (start==0 || pauseOn) playPause();
+        break;
+      case WIFI_CMD::PAUSE:
+        if (start==1) playPause();
+        break;
+      case WIFI_CMD::STOP:
+        if (start==1) stopFile();
+        break;
+      case WIFI_CMD::BLOCK:
+        if (start==1 && pauseOn) {
+          block = wifiArg;
+          firstBlockPause = false;
+          GetAndPlayBlock();
         }
-        #endif
-        delay(50);
-        
-      } else {
-        //If a file is playing, pause or unpause the file                  
-        if (!pauseOn) {
-          printtext2F(PSTR("Paused  "),0);
-          jblks =1; 
-          firstBlockPause = true;
-        } else  {
-          printtext2F(PSTR("Playing      "),0);
-          currpct=100;
-          firstBlockPause = false;      
+        break;
+    #ifdef NET_STREAM
+      case WIFI_CMD::STREAM:
+        if (start==0 && net_open(wifi_stream_url())) {
+          isDir = 0;
+          playFile();
         }
-        pauseOn = !pauseOn;
-      }
-      
+        break;
+    #endif
+    #ifdef MXW_RENDER
+      case WIFI_CMD::RENDER:
+        if (start==0 && selectFileByName(wifi_select_name())) renderFile();
+        break;
+      case WIFI_CMD::RENDER_ALL:
+        if (start==0) renderAll();
+        break;
+    #endif
+      case WIFI_CMD::RESCAN:
+        if (start==0) {
+          getMaxFile();
+          seekFile();
+        }
+        break;
+      default:
+        break;
+    }
+  #endif
+
+  #ifdef HOST_CONTROL
+    word hostArg;
+    switch (const HOST_CMD hostCmd = host_take_command(hostArg)) {
+      case HOST_CMD::SELECT:
+        if (start==1) host_done(HOST_RESULT::BAD_STATE);
+        else host_done(selectFileByPath(host_path()) ? HOST_RESULT::OK : HOST_RESULT::NOT_FOUND);
+        break;
+      case HOST_CMD::PLAY:
+        if (start==1 && !pauseOn) {
+          host_done(HOST_RESULT::BAD_STATE);
+        } else if (start==0 && (dirEmpty || isDir)) {
+          host_done(HOST_RESULT::NOT_FOUND);
+        } else {
+          playPause();
+          host_done(HOST_RESULT::OK);
+        }
+        break;
+      case HOST_CMD::PAUSE:
+      case HOST_CMD::STOP:
+        if (start==0) {
+          host_done(HOST_RESULT::BAD_STATE);
+        } else {
+          if (hostCmd == HOST_CMD::PAUSE) playPause();
+          else stopFile();
+          host_done(HOST_RESULT::OK);
+        }
+        break;
+      case HOST_CMD::BLOCK:
+        if (start==0 || !pauseOn) {
+          host_done(HOST_RESULT::BAD_STATE);
+        } else {
+          block = hostArg;
+          firstBlockPause = false;
+          GetAndPlayBlock();
+          host_done(HOST_RESULT::OK);
+        }
+        break;
+      case HOST_CMD::BAUD:
+        if (hostArg < 300 || hostArg > 6000) {
+          host_done(HOST_RESULT::BAD_ARG);
+        } else if (start==0) {
+          BAUDRATE = hostArg;
+          host_done(HOST_RESULT::OK);
+        } else {
+          #ifdef LIVE_BAUD
+            LiveBaudSet(hostArg);     // from the next block, as the menu does
+            host_done(HOST_RESULT::OK);
+          #else
+            host_done(HOST_RESULT::BAD_STATE);
+          #endif
+        }
+        break;
+      default:
+        break;
+    }
+  #endif
+
+  #ifdef RESUME_CHECKPOINT
+    if(resumeOffered && !button_play() && button_any()) resumeOffered = false;
+  #endif
+  #ifdef FAST_BOOT
+    if(scanPending && start==0 && !button_play() && button_any()) {
+      // everything but PLAY needs the whole directory
+      scanFinish();
+    }
+  #endif
+
+    if(button_play()) {
+      playPause();
       debounce(button_play);
     }
 
@@ -639,6 +1024,26 @@ void loop(void) {
     #endif
   #endif // btnRoot_AS_PIVOT
 
+  #if defined(Use_MENU) && !defined(RECORD_EEPROM_LOGO)
+    if(button_root() && start==1 && !pauseOn
+                            #ifdef btnRoot_AS_PIVOT
+                                  && button_stop()
+                            #endif
+                                  ){                 // menu while playing (its waits keep the buffer filled)
+      menuMode();
+      if(start==1) {
+        printtextF(PSTR("Playing"),0);
+        scrollText(fileName, isDir, 0);
+      } else {
+        seekFile();                   // it came to the end while the menu was open
+      }
+      #if defined(OLED1306) && defined(OSTATUSLINE)
+        OledStatusLine();
+      #endif
+      debounce(button_root);
+    }
+  #endif
+
   if(button_root() && start==0
                           #ifdef btnRoot_AS_PIVOT
                                 && button_stop()
@@ -694,6 +1099,35 @@ void loop(void) {
     debounce(button_stop);
   }
 
+  #ifdef LIVE_BAUD
+    if(start==1 && !pauseOn) {
+      // down for faster, up for slower: a step per press, from the next block.  Not
+      // debounce(), which would hold up filling the buffer until it's let go
+      static bool liveBaudHeld = false;
+      const bool _up = button_up();
+      const bool _down = button_down();
+      if((_up || _down) && !liveBaudHeld) {
+        char text[12];
+        utoa(LiveBaudStep(_down), text, 10);
+        strcat_P(text, PSTR(" baud"));
+        printtext(text, 0);
+      }
+      liveBaudHeld = _up || _down;
+    }
+  #endif
+
+  #ifdef FLASH_LIBRARY
+  if(button_stop() && start==0 && lib_browsing) {             // out of the library, back to the card
+    changeDirLibParent();
+    debounce(button_stop);
+  } else
+  #endif
+  #ifdef Use_ZIP
+  if(button_stop() && start==0 && zip_browsing) {             // out of the zip
+    changeDirZipParent();
+    debounce(button_stop);
+  } else
+  #endif
   if(button_stop() && start==0 && subdir >0) {               // back subdir
     #if (SPLASH_SCREEN && TIMEOUT_RESET)
         timeout_reset = TIMEOUT_RESET;
@@ -702,19 +1136,28 @@ void loop(void) {
 
     debounce(button_stop);   
   }
+  #ifdef FLASH_LIBRARY
+  else if(button_stop() && start==0 && subdir==0 && !ZIP_ACTIVE && lib_present()) {   // at the root: into the library
+    changeDirLib();
+    debounce(button_stop);
+  }
+  #endif
      
   #ifdef BLOCKMODE
     if(button_up() && start==1 && pauseOn
                                   #ifdef btnRoot_AS_PIVOT
                                             && !button_root()
+                                  #endif
+                                  #ifdef BLOCK_SCRUB
+                                            && !scrub_held(button_up, false)
                                   #endif
                                           ){             //  up block sequential search                                                                 
       firstBlockPause = false;
       #ifdef BLOCKID_INTO_MEM
         oldMinBlock = 0;
-        oldMaxBlock = maxblock;
+        oldMaxBlock = (BLOCK_LAST < 255) ? BLOCK_LAST : 255;
         if (block > 0) block--;
-        else block = maxblock;      
+        else block = BLOCK_LAST;      
       #endif
       #if defined(BLOCK_EEPROM_PUT)
         oldMinBlock = 0;
@@ -744,6 +1187,22 @@ void loop(void) {
     #endif
   #endif // BLOCKMODE
 
+  #if defined(BLOCK_SCRUB) && !defined(BLOCKMODE)
+    if(button_up() && start==1 && pauseOn) {    // scrub back through the current block
+      scrub_held(button_up, false);
+      debounce(button_up);
+    }
+    if(button_down() && start==1 && pauseOn) {  // scrub forward through the current block
+      scrub_held(button_down, true);
+      debounce(button_down);
+    }
+  #endif
+
+  #ifdef ROTARY_ENCODER
+    if (start==0) encoderBrowse();
+    else encoder_take();            // (turns while playing are dropped)
+  #endif
+
   if(button_up() && start==0
                         #ifdef btnRoot_AS_PIVOT
                               && !button_root()
@@ -755,8 +1214,12 @@ void loop(void) {
     #endif
     //Move up a file in the directory
     scrollTextReset();
-    upFile();
-    debouncemax(button_up);
+    #ifdef FAST_BROWSE
+      browseHeld(button_up, true);
+    #else
+      upFile();
+      debouncemax(button_up);
+    #endif
   }
 
   #ifdef btnRoot_AS_PIVOT
@@ -766,7 +1229,11 @@ void loop(void) {
       #endif
       //Move up a file in the directory
       scrollTextReset();
-      upHalfSearchFile();
+      #ifdef FAST_BROWSE
+        letterJump(true);
+      #else
+        upHalfSearchFile();
+      #endif
       debounce(button_up);
     }
   #endif
@@ -813,18 +1280,21 @@ void loop(void) {
     if(button_down() && start==1 && pauseOn
                                           #ifdef btnRoot_AS_PIVOT
                                                 && !button_root()
+                                          #endif
+                                          #ifdef BLOCK_SCRUB
+                                                && !scrub_held(button_down, true)
                                           #endif
                                                 ){      // down block sequential search                                                           
 
       #ifdef BLOCKID_INTO_MEM
         oldMinBlock = 0;
-        oldMaxBlock = maxblock;
+        oldMaxBlock = (BLOCK_LAST < 255) ? BLOCK_LAST : 255;
         if (firstBlockPause) {
           firstBlockPause = false;
           if (block > 0) block--;
-          else block = maxblock;
+          else block = BLOCK_LAST;
         } else {
-          if (block < maxblock) block++;
+          if (block < BLOCK_LAST) block++;
           else block = 0;       
         }             
       #endif
@@ -875,8 +1345,12 @@ void loop(void) {
     #endif
     //Move down a file in the directory
     scrollTextReset();
-    downFile();
-    debouncemax(button_down);
+    #ifdef FAST_BROWSE
+      browseHeld(button_down, false);
+    #else
+      downFile();
+      debouncemax(button_down);
+    #endif
   }
 
   #ifdef btnRoot_AS_PIVOT
@@ -886,7 +1360,11 @@ void loop(void) {
       #endif
       //Move down a file in the directory
       scrollTextReset();
-      downHalfSearchFile();
+      #ifdef FAST_BROWSE
+        letterJump(false);
+      #else
+        downHalfSearchFile();
+      #endif
       debounce(button_down);
     }
   #endif
@@ -895,19 +1373,45 @@ void loop(void) {
     if(start==1 && (oldMotorState!=motorState) && mselectMask) {  
       //if file is playing and motor control is on then handle current motor state
       //Motor control works by pulling the btnMotor pin to ground to play, and NC to stop
+      #ifdef MOTOR_IRQ
+        // the interrupt has already held (or released) the output: this is just the screen,
+        // and a pause from the play button or an ID20 that the motor starting ends as before
+        const bool motorIrq = motor_sense_irq();
+      #else
+        const bool motorIrq = false;
+      #endif
       if(motorState==1 && !pauseOn) {
+        if (!motorIrq) SetPause(true);
         printtext2F(PSTR("PAUSED  "),0);
-        pauseOn = true;
       } 
-      if(motorState==0 && pauseOn) {
+      else if(motorState==0 && (pauseOn || motorIrq)) {
+        if (pauseOn) SetPause(false);
         printtext2F(PSTR("PLAYing "),0);
-        pauseOn = false;
       }
       scrollText(fileName, isDir, 0);
       oldMotorState=motorState;
     }
   #endif
   }
+
+  #ifdef LOW_POWER_IDLE
+    // nothing to do until the next button check: stopped, or paused with
+    // the buffer full (SetPause has stopped the timer)
+    if ((start==0 || (pauseOn && !buffer_has_room()))
+      #ifdef Use_Rec
+        && !is_recording()
+      #endif
+      #ifdef FAST_BOOT
+        && !scanPending
+      #endif
+      #ifdef AUTO_ADVANCE
+        && !autoPlay
+      #endif
+        ) {
+      const unsigned long _since = millis() - timeDiff;
+      idle_sleep(_since < 50 ? 50 - _since : 0);
+    }
+  #endif
 }
 
 void upFile() {    
@@ -916,6 +1420,27 @@ void upFile() {
   if (dirEmpty) return;
   oldMinFile = 0;
   oldMaxFile = maxFile;
+#if defined(Use_ZIP) || defined(FLASH_LIBRARY)
+  if (ZIP_ACTIVE || LIB_BROWSING) {
+    // every member index is one
+    currentFile = currentFile ? currentFile-1 : maxFile;
+    seekFile();
+    return;
+  }
+#endif
+#ifdef SORTED_DIR
+  viewPos = viewPos ? viewPos-1 : maxFile;
+  currentFile = dirview_file(viewPos);
+  seekFile();
+  return;
+#endif
+#ifdef NAME_CACHE
+  // the window knows which entries are there, so no opening our way back
+  if (namecache_prev(currentFile)) {
+    seekFile();
+    return;
+  }
+#endif
   while(currentFile!=0)
   {
     currentFile--;
@@ -944,6 +1469,19 @@ void downFile() {
   if (dirEmpty) return;
   oldMinFile = 0;
   oldMaxFile = maxFile;
+#if defined(Use_ZIP) || defined(FLASH_LIBRARY)
+  if (ZIP_ACTIVE || LIB_BROWSING) {
+    currentFile = (currentFile < maxFile) ? currentFile+1 : 0;
+    seekFile();
+    return;
+  }
+#endif
+#ifdef SORTED_DIR
+  viewPos = (viewPos < maxFile) ? viewPos+1 : 0;
+  currentFile = dirview_file(viewPos);
+  seekFile();
+  return;
+#endif
   currentFile++;
   if (currentFile>maxFile) { currentFile=0; }
   seekFile();
@@ -953,6 +1491,20 @@ void upHalfSearchFile() {
   //move up to half-pos between oldMinFile and currentFile
   if (dirEmpty) return;
 
+#ifdef SORTED_DIR
+  #if defined(Use_ZIP) || defined(FLASH_LIBRARY)
+  if (!ZIP_ACTIVE && !LIB_BROWSING)      // (a zip's members aren't in the view, nor the library's)
+  #endif
+  {
+    if (viewPos >oldMinFile) {
+      oldMaxFile = viewPos;
+      viewPos = oldMinFile + (oldMaxFile - oldMinFile)/2;
+      currentFile = dirview_file(viewPos);
+      seekFile();
+    }
+    return;
+  }
+#endif
   if (currentFile >oldMinFile) {
     oldMaxFile = currentFile;
     currentFile = oldMinFile + (oldMaxFile - oldMinFile)/2;
@@ -964,6 +1516,20 @@ void downHalfSearchFile() {
   //move down to half-pos between currentFile amd oldMaxFile
   if (dirEmpty) return;
 
+#ifdef SORTED_DIR
+  #if defined(Use_ZIP) || defined(FLASH_LIBRARY)
+  if (!ZIP_ACTIVE && !LIB_BROWSING)
+  #endif
+  {
+    if (viewPos <oldMaxFile) {
+      oldMinFile = viewPos;
+      viewPos = oldMinFile + 1+ (oldMaxFile - oldMinFile)/2;
+      currentFile = dirview_file(viewPos);
+      seekFile();
+    }
+    return;
+  }
+#endif
   if (currentFile <oldMaxFile) {
     oldMinFile = currentFile;
     currentFile = oldMinFile + 1+ (oldMaxFile - oldMinFile)/2;
@@ -971,42 +1537,179 @@ void downHalfSearchFile() {
   } 
 }
 
-void seekFile() {    
-  //move to a set position in the directory, store the filename, and display the name on screen.
-  entry.close(); // precautionary, and seems harmless if entry is already closed
-  if (dirEmpty)
-  {
-    strcpy_P(fileName, PSTR("[EMPTY]"));
-  }
-  else
-  {
-    while (!entry.open(currentDir, currentFile, O_RDONLY) && currentFile<maxFile)
-    {
-      // if entry.open fails, when given an index, sdfat 2.1.2 automatically adjust curPosition to the next good entry
-      // (which means that we can just retry calling open, passing in curPosition)
-      // but sdfat 1.1.4 does not automatically adjust curPosition, so we cannot do that trick.
-      // We cannot call openNext, because (with sdfat 2.1.2) the position has ALREADY been adjusted, so you will actually
-      // miss a file.
-      // so need to do this manually (to support both library versions), via incrementing currentFile manually
-      currentFile++;
-    }
+#ifdef FAST_BROWSE
+void browseHeld(bool (*button_fn)(), bool up) {
+  // one step as usual, then while the button stays down keep stepping, 10
+  // at a time after 10 steps and 100 at a time after 10 more.  Only the
+  // position is shown on the way; the name is looked up where it stops
+  if (dirEmpty) return;
+  if (up) upFile(); else downFile();
+  debouncemax(button_fn);
+  if (!button_fn()) return;
+  #if defined(Use_ZIP) || defined(FLASH_LIBRARY)
+  if (ZIP_ACTIVE || LIB_BROWSING) return;   // one at a time in a zip, or the library
+  #endif
 
-    entry.getName(fileName,filenameLength);
-    filesize = entry.fileSize();
-    if(entry.isDir() || !strcmp(fileName, "ROOT")) { isDir=1; } else { isDir=0; }
-    entry.close();
+  word step = 1;
+  byte steps = 0;
+  while (button_fn()) {
+    if (up) viewPos = (viewPos > step) ? viewPos-step : 0;
+    else viewPos = (maxFile - viewPos > step) ? viewPos+step : maxFile;
+    utoa(viewPos+1, PlayBytes, 10);
+    strcat_P(PlayBytes, PSTR(" / "));
+    utoa(maxFile+1, PlayBytes+strlen(PlayBytes), 10);
+    printtext(PlayBytes, 0);
+    if (++steps == 10 && step < 100) {
+      step *= 10;
+      steps = 0;
+    }
+    button_wait();
   }
+  currentFile = dirview_file(viewPos);
+  seekFile();
+}
 
-  if (isDir==1) {
-    if (subdir >0)strcpy(PlayBytes,prevSubDir);
-    else strcpy_P(PlayBytes, P_PRODUCT_NAME);
-    #ifdef P8544
-      printtext("                 ",3);
-    #endif
-    
+void letterJump(bool up) {
+  // to the start of the next (or previous) initial letter
+  if (dirEmpty) return;
+  #if defined(Use_ZIP) || defined(FLASH_LIBRARY)
+  if (ZIP_ACTIVE || LIB_BROWSING) return;
+  #endif
+  oldMinFile = 0;
+  oldMaxFile = maxFile;
+  viewPos = dirview_letter(viewPos, up);
+  currentFile = dirview_file(viewPos);
+  seekFile();
+}
+#endif
+
+#ifdef ROTARY_ENCODER
+void encoderBrowse() {
+  // stopped: move by what the encoder's turned (encoder.h).  While it's
+  // turning only the position is shown; the name's looked up once it stops
+  static bool turning = false;
+  static unsigned long lastTurn;
+  const int n = encoder_take();
+  if (n == 0) {
+    if (turning && millis() - lastTurn >= ENCODER_SETTLE) {
+      turning = false;
+      #ifdef SORTED_DIR
+        if (!ZIP_ACTIVE && !LIB_BROWSING) currentFile = dirview_file(viewPos);
+      #endif
+      seekFile();
+    }
+    return;
+  }
+  if (dirEmpty) return;
+  #if (SPLASH_SCREEN && TIMEOUT_RESET)
+    timeout_reset = TIMEOUT_RESET;
+  #endif
+  scrollTextReset();
+  if (!turning && (n == 1 || n == -1)) {
+    // a click on its own
+    if (n > 0) downFile(); else upFile();
+    return;
+  }
+  oldMinFile = 0;
+  oldMaxFile = maxFile;
+  // where in the view, or (unsorted, in a zip or the library) the directory
+  uint16_t *pos = &currentFile;
+  #ifdef SORTED_DIR
+    if (!ZIP_ACTIVE && !LIB_BROWSING) pos = &viewPos;
+  #endif
+  if (n < 0) *pos = ((uint16_t)-n < *pos) ? *pos + n : 0;
+  else *pos = (maxFile - *pos > (uint16_t)n) ? *pos + n : maxFile;
+  utoa(*pos+1, PlayBytes, 10);
+  strcat_P(PlayBytes, PSTR(" / "));
+  utoa(maxFile+1, PlayBytes+strlen(PlayBytes), 10);
+  printtext(PlayBytes, 0);
+  turning = true;
+  lastTurn = millis();
+}
+#endif
+
+#ifdef NAME_CACHE
+bool seekCached(bool &dir) {
+  // seekFile from the name window, reading a new one if currentFile is outside it
+  if (namecache_get(currentFile, fileName, filesize, dir)) return true;
+  #ifndef SORTED_DIR
+    // (the sorted view jumps about the directory, so there just open it)
+    if (!namecache_covers(currentFile)) {
+      namecache_fill(currentFile);
+      return namecache_get(currentFile, fileName, filesize, dir);
+    }
+  #endif
+  return false;
+}
+#endif
+
+void seekFile() {    
+  //move to a set position in the directory, store the filename, and display the name on screen.
+  entry.close(); // precautionary, and seems harmless if entry is already closed
+  #ifdef NAME_CACHE
+    bool cachedDir;
+  #endif
+  if (dirEmpty)
+  {
+    strcpy_P(fileName, PSTR("[EMPTY]"));
+  }
+  else
+  #ifdef Use_ZIP
+  if (zip_browsing)
+  {
+    zip_member(currentFile, fileName, filesize);
+    isDir = 0;
+  }
+  else
+  #endif
+  #ifdef FLASH_LIBRARY
+  if (lib_browsing)
+  {
+    lib_member(currentFile, fileName, filesize);
+    isDir = 0;
+  }
+  else
+  #endif
+  #ifdef NAME_CACHE
+  if (seekCached(cachedDir))
+  {
+    isDir = cachedDir ? 1 : 0;
+  }
+  else
+  #endif
+  {
+    while (!entry.open(currentDir, currentFile, O_RDONLY) && currentFile<maxFile)
+    {
+      // if entry.open fails, when given an index, sdfat 2.1.2 automatically adjust curPosition to the next good entry
+      // (which means that we can just retry calling open, passing in curPosition)
+      // but sdfat 1.1.4 does not automatically adjust curPosition, so we cannot do that trick.
+      // We cannot call openNext, because (with sdfat 2.1.2) the position has ALREADY been adjusted, so you will actually
+      // miss a file.
+      // so need to do this manually (to support both library versions), via incrementing currentFile manually
+      currentFile++;
+    }
+
+    get_name(entry, fileName);
+    filesize = entry.fileSize();
+    if(entry.isDir() || !strcmp(fileName, "ROOT")) { isDir=1; } else { isDir=0; }
+    entry.close();
+  }
+
+  if (isDir==1) {
+    if (subdir >0)strcpy(PlayBytes,prevSubDir);
+    else strcpy_P(PlayBytes, P_PRODUCT_NAME);
+    #ifdef P8544
+      printtext("                 ",3);
+    #endif
+    
   } else {
-    ultoa(filesize,PlayBytes,10);
-    strcat_P(PlayBytes,PSTR(" bytes"));
+    #ifdef TZX_META
+    if (!tzxmeta_get(PlayBytes, sizeof(PlayBytes)-1))
+    #endif
+    {
+      ultoa(filesize,PlayBytes,10);
+      strcat_P(PlayBytes,PSTR(" bytes"));
+    }
     #ifdef P8544
       printtext("                 ",3);
     #endif
@@ -1014,13 +1717,126 @@ void seekFile() {
 
   printtext(PlayBytes,0);
   scrollText(fileName, isDir, 0);
-  #ifdef SERIALSCREEN
+  #ifdef SERIAL_QUEUE
+    serq_line(fileName);
+  #elif defined(SERIALSCREEN)
     Serial.println(fileName);
   #endif
 }
 
+#ifdef AUTO_ADVANCE
+void findNextFile() {
+  // look for the next (non directory) entry after currentFile.  Done while
+  // the end of the current file is still playing, so the directory walk is out
+  // of the way by the time it's needed
+  #ifdef SORTED_DIR
+    findFileFrom(viewPos+1);
+  #else
+    findFileFrom(currentFile+1);
+  #endif
+}
+
+void findFileFrom(uint16_t from) {
+  // the first (non directory) entry from position from on (in the view, with
+  // SORTED_DIR).  entry may still be open, so this needs a file of its own
+  nextFileLooked = true;
+  nextFileFound = false;
+  #ifdef Use_ZIP
+  if (zip_browsing) {
+    // the member
+    nextFileFound = from <= maxFile;
+    nextFile = from;
+    return;
+  }
+  #endif
+  SdBaseFile f;
+#ifdef SORTED_DIR
+  // (the view has the directories first)
+  for (uint16_t v = from; v <= maxFile; v++) {
+    const uint16_t i = dirview_file(v);
+#else
+  for (uint16_t i = from; i <= maxFile; i++) {
+#endif
+    if (f.open(currentDir, i, O_RDONLY)) {
+      const bool dir = f.isDir();
+      f.close();
+      if (!dir) {
+        nextFile = i;
+        nextFileFound = true;
+        return;
+      }
+    }
+  }
+}
+#endif
+
+void fileEnded() {
+  // playback reached the end of the file (rather than being stopped)
+  #ifdef PLAY_LOG
+    playlog_clean();
+  #endif
+  #ifdef BAUD_CACHE
+    baudcache_played(true);
+  #endif
+  if (stream_active()) {
+    // nothing to advance to, the next SD file isn't the next in the stream
+    stopFile();
+    return;
+  }
+  #ifdef RESUME_CHECKPOINT
+    // all the way through, so nothing to come back to
+    checkpointDirty = false;
+    lastfile_checkpoint(0, 0, 0);
+  #endif
+  #if defined(FAST_BOOT) && defined(AUTO_ADVANCE)
+    if (scanPending) {
+      // resumed at power on and played before the count finished: there's no
+      // next file until it has (and dirview_build needs entry)
+      entry.close();
+      scanFinish();
+      nextFileLooked = false;
+    }
+  #endif
+  #ifdef SOAK_TEST
+    if (soakMode != SOAK::OFF) {
+      // the next pass: the same file again, or the next in the folder and round to the first
+      if (soakMode == SOAK::FOLDER) {
+        if (!nextFileLooked) findNextFile();
+        if (!nextFileFound) findFileFrom(0);
+        if (nextFileFound) currentFile = nextFile;
+        #ifdef SORTED_DIR
+          viewPos = dirview_find(currentFile);
+        #endif
+      }
+      UniStop();
+      soak_pass();
+      autoPlay = true;
+      return;
+    }
+  #endif
+  #ifdef AUTO_ADVANCE
+    if (!nextFileLooked) findNextFile();
+    if (nextFileFound) {
+      currentFile = nextFile;
+      #ifdef SORTED_DIR
+        viewPos = dirview_find(currentFile);
+      #endif
+      UniStop();            // seekFile in here picks up the next file's name and size
+      autoPlay = true;
+      return;
+    }
+  #endif
+  stopFile();
+}
+
 void stopFile() {
+  #ifdef BAUD_CACHE
+    if(start==1) baudcache_played(false);   // (a no-op if fileEnded got there first)
+  #endif
   UniStop();
+  #ifdef SOAK_TEST
+    soak_end();
+  #endif
   if(start==1){
     printtextF(PSTR("Stopped"),0);
     #ifdef P8544
@@ -1036,38 +1852,440 @@ void playFile() {
     //If selected file is a directory move into directory
     changeDir();
   }
-  else if (!dirEmpty) 
+  #ifdef Use_ZIP
+  else if (!zip_browsing && !dirEmpty && zip_is_archive(fileName)) {
+    changeDirZip();
+  }
+  #endif
+  else if (!dirEmpty || stream_active())
   {
+  #ifdef IDLE_CLOCK
+    cpu_clock(true);      // before the file's read, and long before the first edge
+  #endif
+  #ifdef AUTO_ADVANCE
+    nextFileLooked = false;
+    autoPlay = false;
+  #endif
+  #ifdef FAST_BOOT
+    #ifdef Use_ZIP
+    if (!zip_browsing)    // (it would be the zip's member index as a directory position)
+    #endif
+    #ifdef FLASH_LIBRARY
+    if (!lib_browsing)
+    #endif
+    if (!stream_active()) lastfile_save(subdir, DirFilePos, currentFile, filesize);
+  #endif
+  #ifdef RESUME_CHECKPOINT
+    checkpointDirty = false;
+  #endif
+  #ifdef PLAY_LOG
+    playlog_start();
+  #endif
+  #ifdef SOAK_TEST
+    soak_start();
+  #endif
+  #ifdef INSTANT_PLAY
+    // start the output first, the display can catch up afterwards
+    pauseOn = false;
+    currpct=100;
+    lcdsegs=0;
+    UniPlay();
+    printtextF(PSTR("Playing"),0);
+    scrollText(fileName, isDir, 0);
+  #else
     printtextF(PSTR("Playing"),0);
     pauseOn = false;
     scrollText(fileName, isDir, 0);
     currpct=100;
     lcdsegs=0;
     UniPlay();
+  #endif
       #ifdef P8544
         lcd.gotoRc(3,38);
         lcd.bitmap(Play, 1, 6);
       #endif      
+      #ifdef P8544_SPI
+        lcd.defer(true);            // from here UniLoop sends the changes, between refills
+      #endif
     start=1;       
   }    
 }
 
+#ifdef MXW_RENDER
+void renderFile() {
+  // run the selected file through the player into a .mxp file
+  if (isDir==1 || dirEmpty) return;
+  printtextF(PSTR("Rendering.."),0);
+  const bool ok = mxw_render();
+  #ifdef AUTO_ADVANCE
+    autoPlay = false;       // fileEnded lines up the next file, but this wasn't a play
+  #endif
+  printtextF(ok ? PSTR("Rendered") : PSTR("Render failed"),0);
+  getMaxFile();             // the .mxp is in the listing now
+  seekFile();
+}
+
+void renderAll() {
+  // renderFile for each file the player knows in the current directory
+  // (as the listing was when it started: the .mxp files aren't taken in),
+  // with a line for each in /MXWRENDER.TXT
+  if (dirEmpty) return;
+  const uint16_t last = maxFile;
+  bool first = true;
+  for (uint16_t v = 0; v <= last; v++) {
+  #ifdef SORTED_DIR
+    currentFile = dirview_file(v);
+    viewPos = v;
+  #else
+    currentFile = v;
+  #endif
+    seekFile();
+    if (isDir==1 || !is_playable(fileName)) continue;
+    #ifdef Use_ZIP
+    if (zip_is_archive(fileName)) continue;
+    #endif
+    const char *dot = strrchr(fileName, '.');
+    if (!strcasecmp_P(dot+1, PSTR("mxw")) || !strcasecmp_P(dot+1, PSTR("mxp"))) continue;
+    printtext(fileName,0);
+    mxw_report(first, mxw_render());
+    first = false;
+  }
+  #ifdef AUTO_ADVANCE
+    autoPlay = false;
+  #endif
+  printtextF(PSTR("Rendered all"),0);
+  getMaxFile();
+  seekFile();
+}
+#endif
+
+void playPause() {
+  //Handle Play/Pause button
+  if(start==0) {
+    //If no file is play, start playback
+    playFile();
+    #ifdef RESUME_CHECKPOINT
+      if (resumeOffered) resumeCheckpoint();
+    #endif
+    #ifndef NO_MOTOR
+    if (mselectMask){  
+      //Start in pause if Motor Control is selected
+      oldMotorState = 0;
+    }
+    #endif
+    delay(50);
+    
+  } else {
+    //If a file is playing, pause or unpause the file                  
+    if (!pauseOn) {
+      printtext2F(PSTR("Paused  "),0);
+      jblks =1; 
+      firstBlockPause = true;
+    } else  {
+      printtext2F(PSTR("Playing      "),0);
+      currpct=100;
+      firstBlockPause = false;      
+    }
+    SetPause(!pauseOn);
+  }
+}
+
+#if defined(WIFI_SERVICE) || defined(HOST_CONTROL)
+bool selectFileByName(const char *name) {
+  // select the entry called name in the current directory
+  if (dirEmpty) return false;
+#ifdef SORTED_DIR
+  // only what's in the view can be selected (maxFile is its last entry)
+  for (uint16_t v = 0; v <= maxFile; v++) {
+    const uint16_t i = dirview_file(v);
+#else
+  for (uint16_t i = 0; i <= maxFile; i++) {
+#endif
+    if (entry.open(currentDir, i, O_RDONLY)) {
+      get_name(entry, fileName);
+      entry.close();
+      if (!strcasecmp(fileName, name)) {
+        currentFile = i;
+        #ifdef SORTED_DIR
+          viewPos = v;
+        #endif
+        seekFile();
+        return true;
+      }
+    }
+  }
+  seekFile();   // puts back the current file's name
+  return false;
+}
+#endif
+
+#ifdef HOST_CONTROL
+bool selectFileByPath(const char *path) {
+  // from the root, down through each directory in path, to select the entry at its end
+  #ifdef FAST_BOOT
+    if (scanPending) scanFinish();
+  #endif
+  subdir=0;
+  changeDirRoot();
+  getMaxFile();
+  seekFile();
+  char part[64];
+  while (*path) {
+    if (*path == '/') {
+      path++;
+      continue;
+    }
+    const char *end = strchr(path, '/');
+    const size_t n = end ? (size_t)(end - path) : strlen(path);
+    if (n >= sizeof(part)) return false;
+    memcpy(part, path, n);
+    part[n] = '\0';
+    path += n;
+    if (!selectFileByName(part)) return false;
+    while (*path == '/') path++;
+    if (*path) {
+      if (!isDir) return false;     // a file in the middle of the path
+      changeDir();
+    }
+  }
+  return true;
+}
+#endif
+
 void getMaxFile() {    
   // gets the total files in the current directory and stores the number in maxFile
   // and also gets the file index of the last file found in this directory
+  #ifdef Use_ZIP
+    zip_leave();      // a new count of the directory, so no longer inside a zip of it
+  #endif
+  #ifdef FLASH_LIBRARY
+    lib_browsing = false;
+  #endif
   currentDir->rewind();
   maxFile = 0;
   dirEmpty=true;
+  #ifdef FAST_BOOT
+    scanPending = false;
+  #endif
+  #ifdef NAME_CACHE
+    namecache_clear();
+  #endif
+  #ifdef EXFAT_SCAN
+  if (dirscan_begin(0)) {
+    // exFAT: the directory a few sectors at a time, rather than an openNext per file
+    const DirScanEntry *d;
+    while ((d = dirscan_next()) != nullptr) {
+      maxFile = d->pos;
+      #ifdef NAME_CACHE
+        namecache_add(*d);
+      #endif
+      dirEmpty=false;
+    }
+  } else
+  #endif
   while(entry.openNext(currentDir, O_RDONLY)) {
     maxFile = currentDir->curPosition()/32-1;
+    #ifdef NAME_CACHE
+      namecache_add(maxFile);   // the first window's worth, while we're passing
+    #endif
     dirEmpty=false;
     entry.close();
   }
   currentDir->rewind(); // precautionary but I think might be unnecessary since we're using currentFile everywhere else now
+#ifdef SORTED_DIR
+  // from here on maxFile is the last entry of the view, not of the directory
+  viewPos = 0;
+  if (!dirEmpty) {
+    dirview_build();
+    dirEmpty = (dirview_count() == 0);
+    maxFile = dirEmpty ? 0 : dirview_count()-1;
+  }
+  oldMinFile = 0;
+  oldMaxFile = maxFile;
+  currentFile = dirEmpty ? 0 : dirview_file(0);
+#else
   oldMinFile = 0;
   oldMaxFile = maxFile;
   currentFile = 0;
+#endif
+}
+
+#if defined(FAST_BOOT) || defined(SD_HOTSWAP)
+bool openDirPath(byte depth) {
+  // from the root, down through the directories at DirFilePos[0] to [depth-1]
+  // (DirMaxFile is left for each to be counted when it's gone back up to).
+  // If one of them isn't a directory, back at the root
+  for (byte i=0; i<depth; i++) {
+    if (!_tmpdirs[_alt_tmp_dir].open(currentDir, DirFilePos[i], O_RDONLY) || !_tmpdirs[_alt_tmp_dir].isDir()) {
+      _tmpdirs[_alt_tmp_dir].close();
+      changeDirRoot();
+      return false;
+    }
+    // flip the dir pointers so currentDir is now the newly opened dir and tmpdir points to the spare
+    currentDir = &_tmpdirs[_alt_tmp_dir];
+    _alt_tmp_dir = 1-_alt_tmp_dir;
+    _tmpdirs[_alt_tmp_dir].close(); // closes the old dir
+    DirMaxFile[i] = MAXFILE_UNKNOWN;
+  }
+  return true;
 }
+#endif
+
+#ifdef SD_HOTSWAP
+void cardSwapped() {
+  // the card's been taken out, or changed (sdswap.h): wait for one, mount it as
+  // setup does, and go back to where we were if it has the same directory there
+  const byte depth = subdir;
+  const uint16_t file = ZIP_ENTRY(currentFile);
+  char was[SCREENSIZE+1];
+  strcpy(was, prevSubDir);
+  entry.close();
+  _tmpdirs[0].close();
+  _tmpdirs[1].close();
+  readahead_invalidate();
+  while (!cardBegin()) {
+    printtextF(PSTR("No SD Card"),0);
+    delay(50);
+    #ifdef SOFT_POWER_OFF
+    check_power_off_key();
+    #endif
+  }
+  sdswap_mounted();
+  #ifdef RATE_PROBE
+    rateprobe_load();               // the new card's
+  #endif
+  subdir = 0;
+  changeDirRoot();
+  if (depth > 0 && openDirPath(depth)) {
+    // and the same directory, not just one at the same place
+    get_name(*currentDir, fileName);
+    fileName[SCREENSIZE] = '\0';
+    if (!strcmp(fileName, was)) {
+      subdir = depth;
+      strcpy(prevSubDir, was);
+    } else {
+      changeDirRoot();
+    }
+  }
+  getMaxFile();                     // the listing, sorted view and name window, from the new card
+  if (subdir == depth && !dirEmpty) {
+    // and the file that was selected, if it's still there
+    #ifdef SORTED_DIR
+      viewPos = dirview_find(file);
+      currentFile = dirview_file(viewPos);
+    #else
+      if (file <= maxFile) currentFile = file;
+    #endif
+  }
+  seekFile();
+}
+#endif
+
+#ifdef FAST_BOOT
+bool resumeLastFile() {
+  // at power on, open the directory of the last file played (lastfile.h) and select
+  // that file, without counting the directory first, so it can be played at once.
+  // The count is done afterwards (scanStep) while nothing else is going on
+  uint16_t file;
+  unsigned long size;
+  const byte depth = lastfile_load(DirFilePos, nMaxPrevSubDirs, file, size);
+  if (depth == LASTFILE_NONE) return false;
+  if (!openDirPath(depth)) return false;
+  // and check it's the same file, in case the card has been changed
+  bool same = entry.open(currentDir, file, O_RDONLY) && !entry.isDir() && entry.fileSize() == size;
+  entry.close();
+  if (!same) {
+    changeDirRoot();
+    return false;
+  }
+  subdir = depth;
+  if (subdir>0) {
+    get_name(*currentDir, fileName);
+    fileName[SCREENSIZE] = '\0';
+    strcpy(prevSubDir, fileName);
+  }
+  currentFile = file;
+  maxFile = file;
+  dirEmpty = false;
+  oldMinFile = 0;
+  oldMaxFile = maxFile;
+
+  // the count starts from the top, as getMaxFile's does
+  #ifdef NAME_CACHE
+    namecache_clear();
+  #endif
+  scanPos = 0;
+  scanMax = 0;
+  scanEmpty = true;
+  scanPending = true;
+  #ifdef RESUME_CHECKPOINT
+    resumeOffered = lastfile_resume_block(cpBlock, cpPos, cpID);
+  #endif
+  return true;
+}
+
+void scanDone() {
+  // as the end of getMaxFile, but leaving currentFile where it is
+  currentDir->rewind();
+  scanPending = false;
+  maxFile = scanMax;
+  dirEmpty = scanEmpty;
+#ifdef SORTED_DIR
+  if (!dirEmpty) {
+    dirview_build();
+    dirEmpty = (dirview_count() == 0);
+    maxFile = dirEmpty ? 0 : dirview_count()-1;
+  }
+  viewPos = dirEmpty ? 0 : dirview_find(currentFile);
+  if (!dirEmpty && dirview_file(viewPos) != currentFile) {
+    currentFile = dirview_file(viewPos);
+    if (start==0) seekFile();
+  }
+#endif
+  oldMinFile = 0;
+  oldMaxFile = maxFile;
+}
+
+void scanStep() {
+  // count the next sector's worth (16 entries) of currentDir.  Anything else
+  // may have moved the directory's position in between, hence scanPos
+  SdBaseFile f;
+  currentDir->seekSet(scanPos);
+  for (byte i=0; i<16; i++) {
+    if (!f.openNext(currentDir, O_RDONLY)) {
+      scanDone();
+      return;
+    }
+    scanMax = currentDir->curPosition()/32-1;
+    scanEmpty = false;
+    f.close();
+  }
+  scanPos = currentDir->curPosition();
+}
+
+void scanFinish() {
+  while (scanPending) scanStep();
+}
+#endif
+
+#ifdef RESUME_CHECKPOINT
+void resumeCheckpoint() {
+  // the first PLAY after power on, on the file resumed into: on to the block it had
+  // got to.  Whichever table GetAndPlayBlock looks in isn't filled that far yet, so
+  // the block goes in first (UEF, CAS and MXP have their own, built as they open)
+  resumeOffered = false;
+  if (start==0) return;
+  block = cpBlock;
+  #ifdef BLOCKID_INTO_MEM
+    if (block < BLOCK_TABLE_ENTRIES && cpPos < 0x1000000UL) blockTable[block] = (cpPos << 8) | cpID;
+  #endif
+  #ifdef BLOCK_EEPROM_PUT
+    blockstore_put(block, cpPos, cpID);
+  #endif
+  GetAndPlayBlock();
+  lastfile_checkpoint(cpBlock, cpPos, cpID);   // playFile put it back to the top
+}
+#endif
 
 void changeDir() {    
   // change directory (to whatever is currently the selected fileName)
@@ -1085,6 +2303,7 @@ void changeDir() {
   {
     if (subdir < nMaxPrevSubDirs) {
       DirFilePos[subdir] = currentFile;
+      DirMaxFile[subdir] = maxFile;
       subdir++;
       // but, also, stash the current filename as the parent (prevSubDir) for display
       // (but we only keep one prevSubDir, we no longer need to store them all)
@@ -1101,35 +2320,167 @@ void changeDir() {
   seekFile();
 }
 
+#ifdef Use_ZIP
+void changeDirZip()
+{
+  // into the selected zip, as into a directory: its members are the files,
+  // and stop comes back out (zip.h).  subdir stays as it is
+  if (!zip_enter(currentFile)) {
+    printtextF(PSTR("Not Valid File"), 0);
+    return;
+  }
+  zipMaxFile = maxFile;
+  dirEmpty = (zip_count() == 0);
+  maxFile = dirEmpty ? 0 : zip_count()-1;
+  currentFile = 0;
+  oldMinFile = 0;
+  oldMaxFile = maxFile;
+  seekFile();
+}
+
+void changeDirZipParent()
+{
+  // back to the zip's own entry, in the directory's view as it was
+  currentFile = zip_archive();
+  zip_leave();
+  maxFile = zipMaxFile;
+  dirEmpty = false;
+  oldMinFile = 0;
+  oldMaxFile = maxFile;
+  #ifdef SORTED_DIR
+    viewPos = dirview_find(currentFile);
+  #endif
+  seekFile();
+}
+#endif
+
+#ifdef FLASH_LIBRARY
+void changeDirLib()
+{
+  // into the library in flash, from the root, as into a directory (flashlib.h)
+  libMaxFile = maxFile;
+  libFile = currentFile;
+  libDirEmpty = dirEmpty;
+  lib_browsing = true;
+  dirEmpty = (lib_count() == 0);
+  maxFile = dirEmpty ? 0 : lib_count()-1;
+  currentFile = 0;
+  oldMinFile = 0;
+  oldMaxFile = maxFile;
+  seekFile();
+}
+
+void changeDirLibParent()
+{
+  // back to the root as it was; with no card there's nothing to go back to
+  if (cardMissing) return;
+  lib_browsing = false;
+  currentFile = libFile;
+  maxFile = libMaxFile;
+  dirEmpty = libDirEmpty;
+  oldMinFile = 0;
+  oldMaxFile = maxFile;
+  #ifdef SORTED_DIR
+    viewPos = dirview_find(currentFile);
+  #endif
+  seekFile();
+}
+#endif
+
+bool openParentDir(SdBaseFile &parent, SdBaseFile *dir, byte depth)
+{
+  // open the directory above dir, which is depth levels below root.  Every FAT
+  // subdirectory has ".." as its second entry, so that's one open - except one
+  // level down, where ".." says cluster 0 rather than where the root is.
+  // exFAT has no dot entries, hence checking the name
+  parent.close();
+  if (depth <= 1) return parent.open("/", O_RDONLY);
+  if (parent.open(dir, 1, O_RDONLY)) {
+    char name[3] = "";
+    if (parent.isDir() && parent.getName(name, sizeof(name)) && !strcmp(name, "..")) return true;
+    parent.close();
+  }
+  return false;
+}
+
 void changeDirParent()
 {
-  // change up to parent directory.
-  // get to parent folder via re-navigating the same sequence of directories, starting at root
-  // (slow-ish but, honestly, not very slow. and requires very little memory to keep a deep stack of parents
-  // since you only need to store one file index, not a whole filename, for each directory level)
-  // Note to self : does sdfat now support any better way of doing this e.g. is there a link back to parent like ".."  ?
+  // change up to parent directory, normally through its ".." entry (openParentDir).
+  // Only one file index per level is kept (DirFilePos), to put the cursor back on
+  // the directory we came out of, and to get the parent's own name for display
+  // (its entry in the grandparent, which is reached the same way).
+  // Where there's no ".." this falls back to re-navigating the same sequence of
+  // directories from root, reopening each level by index.  Either way the
+  // expensive part, counting the files, isn't done: the parent's maxFile was
+  // remembered on the way down and is reused here.
   subdir--;
   uint16_t this_directory=DirFilePos[subdir]; // remember what directory we are in currently
 
-  changeDirRoot();
-  if(subdir>0)
+  #ifdef NAME_CACHE
+    namecache_clear();    // it had the directory we're leaving
+  #endif
+  if (openParentDir(_tmpdirs[_alt_tmp_dir], currentDir, subdir+1)) {
+    // flip the dir pointers so currentDir is now the parent and tmpdir points to the spare
+    currentDir = &_tmpdirs[_alt_tmp_dir];
+    _alt_tmp_dir = 1-_alt_tmp_dir;
+    _tmpdirs[_alt_tmp_dir].close(); // closes the old dir
+    if (subdir>0) {
+      // the parent's name, from its entry in the grandparent
+      SdBaseFile grandparent;
+      prevSubDir[0] = '\0';
+      if (openParentDir(grandparent, currentDir, subdir) &&
+          entry.open(&grandparent, DirFilePos[subdir-1], O_RDONLY)) {
+        get_name(entry, fileName);
+        entry.close();
+        fileName[SCREENSIZE] = '\0';
+        strcpy(prevSubDir, fileName);
+      }
+      grandparent.close();
+    }
+  }
+  else
   {
-    for(int i=0; i<subdir; i++)
+    changeDirRoot();
+    if(subdir>0)
     {
-      _tmpdirs[_alt_tmp_dir].open(currentDir, DirFilePos[i], O_RDONLY);
-      // flip the dir pointers so currentDir is now the newly opened dir and tmpdir points to the spare
-      currentDir = &_tmpdirs[_alt_tmp_dir];
-      _alt_tmp_dir = 1-_alt_tmp_dir;
-      _tmpdirs[_alt_tmp_dir].close(); // closes the old dir
-    }
-    // get the filename of the last directory we opened, because this is now the prevSubDir for display
-    currentDir->getName(fileName, filenameLength);
-    fileName[SCREENSIZE] = '\0'; // copy only the piece we need. small cheat here - we terminate the string where we want it to end...
-    strcpy(prevSubDir, fileName);
+      for(int i=0; i<subdir; i++)
+      {
+        _tmpdirs[_alt_tmp_dir].open(currentDir, DirFilePos[i], O_RDONLY);
+        // flip the dir pointers so currentDir is now the newly opened dir and tmpdir points to the spare
+        currentDir = &_tmpdirs[_alt_tmp_dir];
+        _alt_tmp_dir = 1-_alt_tmp_dir;
+        _tmpdirs[_alt_tmp_dir].close(); // closes the old dir
+      }
+      // get the filename of the last directory we opened, because this is now the prevSubDir for display
+      get_name(*currentDir, fileName);
+      fileName[SCREENSIZE] = '\0'; // copy only the piece we need. small cheat here - we terminate the string where we want it to end...
+      strcpy(prevSubDir, fileName);
+    }
   }
    
-  getMaxFile();
+  #if defined(FAST_BOOT) || defined(SD_HOTSWAP)
+    if (DirMaxFile[subdir] == MAXFILE_UNKNOWN) {
+      // resumed into from power on (or after a card change), so this level has never been counted
+      getMaxFile();
+      currentFile = this_directory;
+      #ifdef SORTED_DIR
+        viewPos = dirview_find(this_directory);
+      #endif
+      seekFile();
+      return;
+    }
+  #endif
+  // parent can't be empty, we came from one of its entries
+  maxFile = DirMaxFile[subdir];
+  dirEmpty = false;
+  oldMinFile = 0;
+  oldMaxFile = maxFile;
   currentFile = this_directory; // select the directory we were in, as the current file in the parent
+  #ifdef SORTED_DIR
+    // only the current directory's view is kept, so list the parent again
+    dirview_build();
+    viewPos = dirview_find(this_directory);
+  #endif
   seekFile(); // don't forget that this will put the real filename back into fileName 
 }
 
@@ -1141,6 +2492,9 @@ void changeDirRoot()
 
 void SetPlayBlock()
 {
+  #if defined(OLED1306) && defined(OLEDPRINTBLOCK)
+    blockToShow = false;    // this is the one to show now
+  #endif
   printtextF(PSTR(" "),0);
   #ifdef LCDSCREEN16x2
     lcd.setCursor(0,0);
@@ -1150,7 +2504,9 @@ void SetPlayBlock()
     lcd.print(currentID,HEX); // Block ID en hex
   #endif
 
-  #ifdef SERIALSCREEN
+  #ifdef SERIAL_QUEUE
+    serq_block(block, currentID);
+  #elif defined(SERIALSCREEN)
     Serial.print(F("BLK:"));
     Serial.print(block, DEC);
     Serial.print(F(" ID:"));
@@ -1238,150 +2594,317 @@ void SetPlayBlock()
   }
 }
 
+#if defined(BLOCKID_NOMEM_SEARCH) || defined(BLOCK_SD_INDEX)
+bool SkipBlockHeader(unsigned long &blockStart, bool &counted)
+{
+  // Reads the block header at bytesRead and moves bytesRead on to the next block.
+  // blockStart is set to where this block started (for TZX, the ID byte).
+  // counted is set if this block is included in the block numbering
+  // (with OLEDBLKMATCH only blocks that match the live oled block count are counted).
+  // Returns false at end of file.
+  if(ReadByte()) {      
+    blockStart=bytesRead-1;      
+    switch(currentID) {
+      case BLOCKID::TAP:
+      case BLOCKID::JTAP:
+        bytesRead--;
+        break;
+      default:
+        currentID = outByte;  //TZX with blocks GETID
+        break;
+    }                    
+  }
+  else {
+    return false;
+  }
+
+  #if defined(OLEDBLKMATCH)
+    counted = false;
+  #else
+    counted = true;
+  #endif
+
+  switch(currentID) {
+    case BLOCKID::ID10:
+                bytesRead+=2;     //Pause                
+                if(ReadWord()) bytesRead += outWord; //Length of data that follow
+                #if defined(OLEDBLKMATCH)
+                  counted = true;
+                #endif
+                break;
+    case BLOCKID::ID11:
+                bytesRead+=15; //lPilot,lSynch1,lSynch2,lZ,lO,lP,LB,Pause
+                if(ReadLong()) bytesRead += outLong;
+                #if defined(OLEDBLKMATCH)
+                  counted = true;
+                #endif                      
+                break;
+    case BLOCKID::ID12:
+                bytesRead+=4;
+                break;
+    case BLOCKID::ID13:
+                if(ReadByte()) bytesRead += (long(outByte) * 2);
+                break;
+    case BLOCKID::ID14:
+                bytesRead+=7;
+                if(ReadLong()) bytesRead += outLong;
+                /*
+                  #if defined(OLEDBLKMATCH) //&& defined(BLOCKID14_IN)
+                    counted = true;
+                  #endif 
+                */                   
+                break;
+    case BLOCKID::ID15:
+                bytesRead+=5;
+                if(ReadLong()) bytesRead += outLong;
+                #if defined(OLEDBLKMATCH)
+                  counted = true;
+                #endif                     
+                break;
+    case BLOCKID::ID18:
+                if(ReadDword()) bytesRead += outLong;
+                #if defined(OLEDBLKMATCH)
+                  counted = true;
+                #endif
+                break;
+    case BLOCKID::ID19:
+                if(ReadDword()) bytesRead += outLong;
+                #if defined(OLEDBLKMATCH) //&& defined(BLOCKID19_IN)
+                  counted = true;
+                #endif          
+                break;
+    case BLOCKID::ID20:
+                bytesRead+=2;
+                break;
+    case BLOCKID::ID21:
+                if(ReadByte()) bytesRead += outByte;
+                #if defined(OLEDBLKMATCH) && defined(BLOCKID21_IN)
+                  counted = true;
+                #endif          
+                break;
+    case BLOCKID::ID22:
+                break;
+    case BLOCKID::ID23:
+                bytesRead+=2;
+                break;
+    case BLOCKID::ID24:
+                bytesRead+=2;
+                break;
+    case BLOCKID::ID25:
+                break;
+    case BLOCKID::ID26:
+                if(ReadWord()) bytesRead += (long(outWord) * 2);
+                break;
+    case BLOCKID::ID27:
+                break;
+    case BLOCKID::ID28:
+                if(ReadWord()) bytesRead += outWord;
+                break;
+    case BLOCKID::ID2A:
+                bytesRead+=4;
+                break;
+    case BLOCKID::ID2B:
+                bytesRead+=5;
+                break;
+    case BLOCKID::ID30:
+                if (ReadByte()) bytesRead += outByte;                                            
+                break;
+    case BLOCKID::ID31:
+                bytesRead+=1;         
+                if(ReadByte()) bytesRead += outByte; 
+                break;
+    case BLOCKID::ID32:
+                if(ReadWord()) bytesRead += outWord;
+                break;
+    case BLOCKID::ID33:
+                if(ReadByte()) bytesRead += (long(outByte) * 3);
+                break;
+    case BLOCKID::ID35:
+                bytesRead += 0x10;
+                if(ReadDword()) bytesRead += outLong;
+                break;
+    case BLOCKID::ID4B:
+                if(ReadDword()) bytesRead += outLong;
+                #if defined(OLEDBLKMATCH)
+                  counted = true;
+                #endif          
+                break;
+    case BLOCKID::JTAP:                  
+    case BLOCKID::TAP:
+                if(ReadWord()) bytesRead += outWord;
+                #if defined(OLEDBLKMATCH) && defined(BLOCKTAP_IN)
+                  counted = true;
+                #endif           
+                break;
+  }
+  return true;
+}
+
+bool TZXJump(unsigned long from, int disp)
+{
+  // For ID23/ID26/ID27: move bytesRead to the block disp blocks on from the
+  // one at from (its ID byte), and block to the counted blocks before it.
+  // Every block counts towards disp, as in the TZX spec.  Returns false,
+  // leaving bytesRead alone, if the target is outside the file.
+  unsigned long offset;
+  word blk;
+  #ifdef TZX_PROGRAM
+    if (tzxprog_jump(from, disp, offset, blk)) {
+      bytesRead = offset;
+      block = blk;
+      return true;
+    }
+  #endif
+  #ifdef BLOCK_SD_INDEX
+    if (blockindex_jump(from, disp, offset, blk)) {
+      bytesRead = offset;
+      block = blk;
+      return true;
+    }
+  #endif
+
+  // no table or index to hand: walk the headers from the start, once to
+  // number the block at from, and again to get to the target
+  const unsigned long savedBytesRead = bytesRead;
+  const byte savedID = currentID;
+  unsigned long blockStart;
+  bool counted;
+  long n = 0;
+  bytesRead = 10;   //TZX with blocks skip TZXHeader
+  while (SkipBlockHeader(blockStart, counted) && blockStart != from) n++;
+  const long target = n + disp;
+  bool found = false;
+  if (blockStart == from && target >= 0) {
+    bytesRead = 10;
+    n = 0;
+    blk = 0;
+    while (SkipBlockHeader(blockStart, counted)) {
+      if (n++ == target) {
+        found = true;
+        break;
+      }
+      if (counted) blk++;
+    }
+  }
+  currentID = savedID;
+  if (!found) {
+    bytesRead = savedBytesRead;
+    return false;
+  }
+  bytesRead = blockStart;
+  block = blk;
+  return true;
+}
+#endif
+
 void GetAndPlayBlock()
 {
+  #ifdef PLAY_LOG
+    playlog_jump();
+  #endif
+  #if defined(Use_CSW) && defined(Use_UEF_GZ)
+    csw_leave();      // paused inside a Z-RLE ID18
+  #endif
+  #ifdef UEF_INDEX
+    // a UEF goes by BBC file rather than by block
+    word uefblock = block;
+    if (uef_jump_block(uefblock)) {
+      block = uefblock;
+      SetPlayBlock();
+      printtext(uefName, lineaxy);
+      return;
+    }
+  #endif
+  #ifdef Use_CAS
+    // a .cas goes by the headers found when it opened
+    word casblock = block;
+    if (cas_jump_block(casblock)) {
+      block = casblock;
+      SetPlayBlock();
+      return;
+    }
+  #endif
+  #ifdef Use_MXW
+    // a .mxp has its own table of where the blocks start
+    word mxwblock = block;
+    if (mxw_jump_block(mxwblock)) {
+      block = mxwblock;
+      SetPlayBlock();
+      return;
+    }
+  #endif
   #ifdef BLOCKID_INTO_MEM
-    bytesRead=blockOffset[block%maxblock];
-    currentID=blockID[block%maxblock];   
+    #ifdef BLOCK_SD_INDEX
+      word spillblock = block;
+      unsigned long spillOffset;
+      byte spillID;
+    #endif
+    if (block < BLOCK_TABLE_ENTRIES && blockTable[block] != 0) {
+      bytesRead = blockTable[block] >> 8;
+      currentID = blockTable[block] & 0xFF;
+    }
+    #ifdef BLOCK_SD_INDEX
+    else if (blockindex_lookup(spillblock, spillOffset, spillID)) {
+      // past the table, or not reached yet: the sidecar index has it
+      block = spillblock;
+      bytesRead = spillOffset;
+      currentID = spillID;
+    }
+    #endif
+    else {
+      // not reached yet, so go back to the first block
+      block = 0;
+      bytesRead = blockTable[0] >> 8;
+      currentID = blockTable[0] & 0xFF;
+    }
   #endif
   #ifdef BLOCK_EEPROM_PUT
-    EEPROM_get(BLOCK_EEPROM_START+5*block, bytesRead);
-    EEPROM_get(BLOCK_EEPROM_START+4+5*block, currentID);
+    blockstore_get(block, bytesRead, currentID);
   #endif
   #ifdef BLOCKID_NOMEM_SEARCH 
     unsigned long oldbytesRead=0;
-    switch(currentID) {
-      case BLOCKID::TAP:
-      case BLOCKID::JTAP:
-        bytesRead=0;      
-        break;
-      default:
-        bytesRead=10;   //TZX with blocks skip TZXHeader
-        break;
-    }       
-    #ifdef BLKBIGSIZE
-      unsigned int i = 0;
-    #else
-      byte i = 0;
-    #endif      
-
-    while (i<= block) {
-      if(ReadByte()) {      
-        oldbytesRead=bytesRead-1;      
-        switch(currentID) {
-          case BLOCKID::TAP:
-          case BLOCKID::JTAP:
-            bytesRead--;
-            break;
-          default:
-            currentID = outByte;  //TZX with blocks GETID
-            break;
-        }                    
+    #if defined(TZX_PROGRAM) || defined(BLOCK_SD_INDEX)
+      word idxblock = block;
+      byte idxID;
+    #endif
+    #ifdef TZX_PROGRAM
+      if (tzxprog_lookup(idxblock, oldbytesRead, idxID)) {
+        block = idxblock;
+        currentID = idxID;
       }
-      else {
-        block = i-1;
-        break;
+      else
+    #endif
+    #ifdef BLOCK_SD_INDEX
+      if (blockindex_lookup(idxblock, oldbytesRead, idxID)) {
+        block = idxblock;
+        currentID = idxID;
       }
-        
+      else
+    #endif
+    {
       switch(currentID) {
-        case BLOCKID::ID10:
-                    bytesRead+=2;     //Pause                
-                    if(ReadWord()) bytesRead += outWord; //Length of data that follow
-                    #if defined(OLEDBLKMATCH)
-                      i++;
-                    #endif
-                    break;
-        case BLOCKID::ID11:
-                    bytesRead+=15; //lPilot,lSynch1,lSynch2,lZ,lO,lP,LB,Pause
-                    if(ReadLong()) bytesRead += outLong;
-                    #if defined(OLEDBLKMATCH)
-                      i++;
-                    #endif                      
-                    break;
-        case BLOCKID::ID12:
-                    bytesRead+=4;
-                    break;
-        case BLOCKID::ID13:
-                    if(ReadByte()) bytesRead += (long(outByte) * 2);
-                    break;
-        case BLOCKID::ID14:
-                    bytesRead+=7;
-                    if(ReadLong()) bytesRead += outLong;
-                    /*
-                      #if defined(OLEDBLKMATCH) //&& defined(BLOCKID14_IN)
-                        i++;
-                      #endif 
-                    */                   
-                    break;
-        case BLOCKID::ID15:
-                    bytesRead+=5;
-                    if(ReadLong()) bytesRead += outLong;
-                    #if defined(OLEDBLKMATCH)
-                      i++;
-                    #endif                     
-                    break;
-        case BLOCKID::ID19:
-                    if(ReadDword()) bytesRead += outLong;
-                    #if defined(OLEDBLKMATCH) //&& defined(BLOCKID19_IN)
-                      i++;
-                    #endif          
-                    break;
-        case BLOCKID::ID20:
-                    bytesRead+=2;
-                    break;
-        case BLOCKID::ID21:
-                    if(ReadByte()) bytesRead += outByte;
-                    #if defined(OLEDBLKMATCH) && defined(BLOCKID21_IN)
-                      i++;
-                    #endif          
-                    break;
-        case BLOCKID::ID22:
-                    break;
-        case BLOCKID::ID24:
-                    bytesRead+=2;
-                    break;
-        case BLOCKID::ID25:
-                    break;
-        case BLOCKID::ID2A:
-                    bytesRead+=4;
-                    break;
-        case BLOCKID::ID2B:
-                    bytesRead+=5;
-                    break;
-        case BLOCKID::ID30:
-                    if (ReadByte()) bytesRead += outByte;                                            
-                    break;
-        case BLOCKID::ID31:
-                    bytesRead+=1;         
-                    if(ReadByte()) bytesRead += outByte; 
-                    break;
-        case BLOCKID::ID32:
-                    if(ReadWord()) bytesRead += outWord;
-                    break;
-        case BLOCKID::ID33:
-                    if(ReadByte()) bytesRead += (long(outByte) * 3);
-                    break;
-        case BLOCKID::ID35:
-                    bytesRead += 0x10;
-                    if(ReadDword()) bytesRead += outLong;
-                    break;
-        case BLOCKID::ID4B:
-                    if(ReadDword()) bytesRead += outLong;
-                    #if defined(OLEDBLKMATCH)
-                      i++;
-                    #endif          
-                    break;
-        case BLOCKID::JTAP:                  
         case BLOCKID::TAP:
-                    if(ReadWord()) bytesRead += outWord;
-                    #if defined(OLEDBLKMATCH) && defined(BLOCKTAP_IN)
-                      i++;
-                    #endif           
-                    break;
+        case BLOCKID::JTAP:
+          bytesRead=0;      
+          break;
+        default:
+          bytesRead=10;   //TZX with blocks skip TZXHeader
+          break;
+      }       
+      #ifdef BLKBIGSIZE
+        unsigned int i = 0;
+      #else
+        byte i = 0;
+      #endif      
+
+      while (i<= block) {
+        bool counted;
+        if (!SkipBlockHeader(oldbytesRead, counted)) {
+          block = i-1;
+          break;
+        }
+        if (counted) i++;
       }
-      #if not defined(OLEDBLKMATCH)
-        i++;
-      #endif  
     }
 
     bytesRead=oldbytesRead;
@@ -1418,66 +2941,67 @@ void str4cpy(char *dest, const char *src)
 void GetFileName(uint16_t pos)
 {
   entry.close(); // precautionary, and seems harmless if entry is already closed
+  #ifdef Use_ZIP
+  if (zip_browsing) {
+    unsigned long size;
+    zip_member(pos, fileName, size);
+    return;
+  }
+  #endif
+  #ifdef FLASH_LIBRARY
+  if (lib_browsing) {
+    unsigned long size;
+    lib_member(pos, fileName, size);
+    return;
+  }
+  #endif
+  #ifdef NAME_CACHE
+    unsigned long size;
+    bool dir;
+    if (namecache_get(pos, fileName, size, dir)) return;
+  #endif
   if (entry.open(currentDir, pos, O_RDONLY))
   {
-    entry.getName(fileName,filenameLength);
+    get_name(entry, fileName);
   }
   entry.close();
 }
 
 void block_mem_oled()
 {
+  #ifdef PLAY_LOG
+    playlog_block();
+  #endif
+  #if defined(BLOCKID_INTO_MEM) || defined(BLOCK_EEPROM_PUT) || defined(RESUME_CHECKPOINT)
+    // the ID byte has been read by now, and GetAndPlayBlock reads it again
+    // (TAP has none, and is at its length word)
+    const unsigned long blockStart = (currentID == BLOCKID::TAP || currentID == BLOCKID::JTAP) ? bytesRead : bytesRead-1;
+  #endif
   #ifdef BLOCKID_INTO_MEM
-    blockOffset[block%maxblock] = bytesRead;
-    blockID[block%maxblock] = currentID;
+    if (block < BLOCK_TABLE_ENTRIES) {
+      blockTable[block] = (blockStart < 0x1000000UL) ? (blockStart << 8) | currentID : 0;
+    }
   #endif
   #ifdef BLOCK_EEPROM_PUT
-    EEPROM_put(BLOCK_EEPROM_START+5*block, bytesRead);
-    EEPROM_put(BLOCK_EEPROM_START+4+5*block, currentID);
+    blockstore_put(block, blockStart, currentID);
+  #endif
+  #ifdef RESUME_CHECKPOINT
+    // written from loop() once the buffer's full
+    cpBlock = block;
+    cpPos = blockStart;
+    cpID = currentID;
+    checkpointDirty = true;
   #endif
 
   #if defined(OLED1306) && defined(OLEDPRINTBLOCK) 
-    #ifdef XY
-      setXY(7,2);
-      sendChar(pgm_read_byte(HEX_CHAR+(currentID>>4)));sendChar(pgm_read_byte(HEX_CHAR+(currentID&0x0f)));
-      setXY(14,2);
-      if ((block%10) == 0) sendChar('0'+(block/10)%10);  
-      setXY(15,2);
-      sendChar('0'+block%10);
-    #endif
-    #if defined(XY2) && not defined(OLED1306_128_64)
-      setXY(9,1);
-      sendChar(pgm_read_byte(HEX_CHAR+(currentID>>4)));sendChar(pgm_read_byte(HEX_CHAR+(currentID&0x0f)));
-      setXY(12,1);
-      if ((block%10) == 0) sendChar('0'+(block/10)%10);
-      setXY(13,1);sendChar('0'+block%10);
-    #endif
-    #if defined(XY2) && defined(OLED1306_128_64)
-      #ifdef XY2force
-        input[0]=pgm_read_byte(HEX_CHAR+(currentID>>4));
-        input[1]=pgm_read_byte(HEX_CHAR+(currentID&0x0f));
-        input[2]=0;
-        sendStrXY((char *)input,7,4);
-        if ((block%10) == 0) {
-          utoa((block/10)%10,(char *)input,10);
-          sendStrXY((char *)input,14,4);
-        }
-        input[0]='0'+block%10;
-        input[1]=0;
-        sendStrXY((char *)input,15,4);
-      #else                      
-        setXY(7,4);
-        sendChar(pgm_read_byte(HEX_CHAR+(currentID>>4)));sendChar(pgm_read_byte(HEX_CHAR+(currentID&0x0f)));
-        setXY(14,4);
-        if ((block%10) == 0) sendChar('0'+(block/10)%10);
-        setXY(15,4);
-        sendChar('0'+block%10);
-      #endif
-    #endif                    
+    // drawn by block_show, from TZXLoop once the buffer is full again
+    shownBlock = block;
+    shownID = currentID;
+    blockToShow = true;
   #endif
 
   #if defined(BLOCKID_INTO_MEM)
-    if (block < maxblock) block++;
+    if (block < BLOCK_LAST) block++;
     else block = 0;
   #endif
   #if defined(BLOCK_EEPROM_PUT) 
@@ -1488,3 +3012,50 @@ void block_mem_oled()
     block++;
   #endif             
 }
+
+#if defined(OLED1306) && defined(OLEDPRINTBLOCK)
+void block_show()
+{
+  // the ID and number of the block block_mem_oled saw start, left until the
+  // card has filled the buffer so the display doesn't hold up the read
+  if (!blockToShow) return;
+  blockToShow = false;
+  #ifdef XY
+    setXY(7,2);
+    sendChar(pgm_read_byte(HEX_CHAR+(shownID>>4)));sendChar(pgm_read_byte(HEX_CHAR+(shownID&0x0f)));
+    setXY(14,2);
+    if ((shownBlock%10) == 0) sendChar('0'+(shownBlock/10)%10);  
+    setXY(15,2);
+    sendChar('0'+shownBlock%10);
+  #endif
+  #if defined(XY2) && not defined(OLED1306_128_64)
+    setXY(9,1);
+    sendChar(pgm_read_byte(HEX_CHAR+(shownID>>4)));sendChar(pgm_read_byte(HEX_CHAR+(shownID&0x0f)));
+    setXY(12,1);
+    if ((shownBlock%10) == 0) sendChar('0'+(shownBlock/10)%10);
+    setXY(13,1);sendChar('0'+shownBlock%10);
+  #endif
+  #if defined(XY2) && defined(OLED1306_128_64)
+    #ifdef XY2force
+      input[0]=pgm_read_byte(HEX_CHAR+(shownID>>4));
+      input[1]=pgm_read_byte(HEX_CHAR+(shownID&0x0f));
+      input[2]=0;
+      sendStrXY((char *)input,7,4);
+      if ((shownBlock%10) == 0) {
+        utoa((shownBlock/10)%10,(char *)input,10);
+        sendStrXY((char *)input,14,4);
+      }
+      input[0]='0'+shownBlock%10;
+      input[1]=0;
+      sendStrXY((char *)input,15,4);
+    #else                      
+      setXY(7,4);
+      sendChar(pgm_read_byte(HEX_CHAR+(shownID>>4)));sendChar(pgm_read_byte(HEX_CHAR+(shownID&0x0f)));
+      setXY(14,4);
+      if ((shownBlock%10) == 0) sendChar('0'+(shownBlock/10)%10);
+      setXY(15,4);
+      sendChar('0'+shownBlock%10);
+    #endif
+  #endif
+}
+#endif
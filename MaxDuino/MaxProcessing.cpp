@@ -13,14 +13,43 @@
 #include "MaxDuino.h" // want to refactor and get rid
 #include "MaxProcessing.h"
 #include "CheckForExt.h"
+#include "tzxprogram.h"
+#include "tzxmeta.h"
+#include "gdb.h"
+#include "csw.h"
+#include "wav.h"
+#include "inflate.h"
+#include "zip.h"
+#include "outputstats.h"
+#include "scrub.h"
 #include "current_settings.h"
 #include "pinSetup.h"
 #include "buttons.h"
 #include "utils.h"
+#include "bytesrc.h"
+#include "netstream.h"
+#include "ramimage.h"
+#include "flashcache.h"
+#include "sddma.h"
+#include "USBStorage.h"
+#include "cdcstream.h"
+#include "mxw.h"
+#include "baudcache.h"
+#include "blockstore.h"
+#include "profile.h"
+#include "edgeverify.h"
+#include "sertrace.h"
+#include "loopcache.h"
+#include "blockcheck.h"
+#include "fanout.h"
+#include "rateprobe.h"
+#include "playlog.h"
+#include "flashlib.h"
 
 // submodules
 #include "zx8081.h"
 #include "ayplay.h"
+#include "snapshot.h"
 #include "uef.h"
 #include "oric.h"
 #include "kansas_4b.h"
@@ -44,9 +73,21 @@ word pauseLength=0;
 unsigned long bytesToRead=0;
 bool EndOfFile=false;
 unsigned long loopStart=0;
+#if defined(BLOCKID_NOMEM_SEARCH) || defined(BLOCK_SD_INDEX)
+unsigned long callBlock=0;        // ID26 being played: where it starts
+word callCount=0;                 // how many calls it has (0 none)
+word callNext=0;                  // the one to make at the next ID27
+#endif
 
 PROGMEM const byte TZXTape[7] = {'Z','X','T','a','p','e','!'};
 
+#ifdef ISR_VARIANTS
+timerCallback playIsr = wave2;    // the ISR for this file's stream, from UniPlay (see isr.h)
+#define PLAY_ISR playIsr
+#else
+#define PLAY_ISR wave2
+#endif
+
 #ifdef ID11CDTspeedup
 bool AMScdt = false;
 #endif
@@ -56,8 +97,10 @@ word loopCount=0;
 byte seqPulses=0;
 word temppause=0;
 bool forcePause0 = false;
+bool underrunPause = false;       // stop the tape at the end of the current block
+bool underrunSlowdown = false;    // drop to the next slower speed on the next play
 byte currentByte=0;
-byte bitChecksum = 0;     // For oric and uef:  0:Even 1:Odd number of one bits  For AY: checksum byte
+byte bitChecksum = 0;     // For oric and uef:  0:Even 1:Odd number of one bits
 
 word pilotPulses=0;
 word pilotLength=0;
@@ -68,15 +111,101 @@ word onePulse=0;
 byte uefpassforZero=2;
 //byte passforOne=4;
 byte jtapflag=255;
-byte jpass=0;
 
-word TickToUs(word ticks) {
-  // returns (ticks/3.5)+0.5 
-  /* Hagen Patzke optimization */
-  return (word)((((long(ticks) << 2) + 7) >> 1) / 7);
+// Rounding error carried from pulse to pulse, in 1/7 us (1 T-state = 2/7 us),
+// so that a long run of T-state timed pulses adds up to the exact length
+// instead of drifting by up to 0.5us per pulse
+byte tickCarry=3;
+byte zeroFrac=0;  // 1/7 us left over from zeroPulse
+byte oneFrac=0;   // 1/7 us left over from onePulse
+
+word TickToUsFrac(word ticks, byte &frac) {
+  // returns ticks/3.5 rounded down, and the remainder in 1/7 us
+  frac = TickFrac(ticks);
+  return TickToUsDown(ticks);
+}
+
+#ifdef ZX_SPEED
+void StandardTimings() {
+  // the Spectrum ROM timings, sped up to ZXSPEED%: once a block, in T-states
+  // so the fractions come out as an ID11 giving the shorter timings
+  // (and no faster than RATE_PROBE found pulse pairs keep up at)
+  const word speed = rateprobe_speed(RATE_BITS, ZXSPEED, TickToUs(ZEROPULSE));
+  const word zero = (unsigned long)ZEROPULSE * 100 / speed;
+  const word one = (unsigned long)ONEPULSE * 100 / speed;
+  pilotLength = TickToUs((unsigned long)PILOTLENGTH * 100 / speed);
+  sync1Length = TickToUs((unsigned long)SYNCFIRST * 100 / speed);
+  sync2Length = TickToUs((unsigned long)SYNCSECOND * 100 / speed);
+  zeroPulse = TickToUsDown(zero);
+  zeroFrac = TickFrac(zero);
+  onePulse = TickToUsDown(one);
+  oneFrac = TickFrac(one);
+}
+#else
+void StandardTimings() {
+  // the Spectrum ROM timings: the same, to the 1/7 us, as an ID11 giving them
+  pilotLength = TickToUs(PILOTLENGTH);
+  sync1Length = TickToUs(SYNCFIRST);
+  sync2Length = TickToUs(SYNCSECOND);
+  zeroPulse = TickToUsDown(ZEROPULSE);
+  zeroFrac = TickFrac(ZEROPULSE);
+  onePulse = TickToUsDown(ONEPULSE);
+  oneFrac = TickFrac(ONEPULSE);
+}
+#endif
+
+#ifdef ID11CDTspeedup
+void CDTSpeedup(word *t) {
+  // The CPC ROM times the bits against the pilot, so a block loads at any
+  // speed as long as its timings keep their proportions.  Scale them all so
+  // the zero comes out at BAUDRATE's, but never slow a block down
+  word target;
+  switch(BAUDRATE){
+    case 2400: target = 583; break;   // 2000 High baudrate
+    case 3150:
+    case 3600: target = 333; break;   // 3500 Max ROM baudrate
+    case 3850: target = 292; break;   // 4000 Specvar loader baudrate
+    default:   target = 1167; break;  // 1000 Normal baudrate
+  }
+  if (target < CDT_MIN_ZERO) target = CDT_MIN_ZERO;
+  const word floor = rateprobe_floor(RATE_BITS);   // what this build's been seen to keep up with
+  if (TickToUs(target) < floor) target = (floor * 7 + 1) / 2;
+  const word zero = t[3];
+  if (zero <= target) return;
+  for (byte i = 0; i < 5; i++) {
+    t[i] = ((unsigned long)t[i] * target + zero/2) / zero;
+  }
+}
+#endif
+
+word TickToUsCarry(word ticks) {
+  // TickToUs for a pulse in a sequence: the remainder goes into tickCarry
+  byte frac;
+  word us = TickToUsFrac(ticks, frac);
+  tickCarry += frac;
+  if(tickCarry>=7) {
+    tickCarry -= 7;
+    us++;
+  }
+  return us;
 }
 
 void UniPlay(){
+  if (underrunSlowdown) {
+    // the last play couldn't keep the buffer full, so give this one more time per pulse
+    switch(BAUDRATE) {
+      case 3850: BAUDRATE = 3600; break;
+      case 3600: BAUDRATE = 3150; break;
+      case 3150: BAUDRATE = 2400; break;
+      case 2400: BAUDRATE = 1200; break;
+    }
+    underrunSlowdown = false;
+  }
+#ifdef BAUD_CACHE
+  baudcache_apply();    // a file that's played through before starts at the speed it did
+#endif
+  underrunPause = false;
+
   // initialise scale and period based on current BAUDRATE
   // (although these could be overridden later e.g. during checkForEXT, depending on file type)
   #ifdef Use_CAS
@@ -84,22 +213,80 @@ void UniPlay(){
   #endif
 
   // on entry, currentFile is already pointing to the file entry you want to play
-  // and fileName is already set
-  if(!entry.open(currentDir, currentFile, O_RDONLY)) {
+  // and fileName is already set (or, streaming, net_open or cdc_open has set fileName and filesize)
+  // (inside a zip, currentFile is the member and entry is the zip, see zip.h)
+#ifdef FLASH_LIBRARY
+  if(lib_browsing) lib_open(currentFile);     // and in the library, it's the entry there (flashlib.h)
+#endif
+  if(!stream_active())
+  if(!entry.open(currentDir, ZIP_ENTRY(currentFile), O_RDONLY)) {
   //  printtextF(PSTR("Error Opening File"),0);
   }
+  readahead_invalidate();
+#ifdef Use_UEF_GZ
+  #ifdef Use_CSW
+    csw_leave();      // stopped inside a Z-RLE ID18
+  #endif
+  gz_close();
+#endif
+#ifdef Use_ZIP
+  if(zip_browsing && !stream_active()) zip_open_member(currentFile);
+#endif
+#ifdef RAM_PLAY
+  if(!stream_active() && !ZIP_ACTIVE) ram_load();
+#endif
+#ifdef FLASH_CACHE
+  #ifdef RAM_PLAY
+  if(!ram_active)
+  #endif
+  if(!stream_active() && !ZIP_ACTIVE) flash_open();
+#endif
 
 #ifdef ID11CDTspeedup
   AMScdt = false;
 #endif
   block=0;                                    // Initial block when starting
+#if defined(BLOCKID_NOMEM_SEARCH) || defined(BLOCK_SD_INDEX)
+  callCount=0;
+#endif
+#ifdef BLOCKID_INTO_MEM
+  block_table_clear();
+#endif
+#ifdef BLOCK_EEPROM_PUT
+  blockstore_begin();
+#endif
   currentBit=0;                               // fallo reproducción de .tap tras .tzx
   bytesRead=0;                                //start of file
   currentTask=TASK::INIT;                     //
   const char * filenameExt = strrchr(fileName,'.') + 1;
   checkForEXT(filenameExt);
+  #ifdef Use_c64
+  c64Stream = (currentID == BLOCKID::C64TAP);
+  #endif
+  #ifdef ISR_VARIANTS
+  playIsr = wave2;
+  #ifdef Use_c64
+  if (c64Stream) playIsr = wave_c64;
+  #endif
+  #ifdef Use_CAS
+  if (casduino != CASDUINO_FILETYPE::NONE) playIsr = wave_direct;
+  #endif
+  #endif
+  #ifdef TZX_PROGRAM
+  tzxprog_build();
+  #endif
+  #ifdef TZX_META
+  tzxmeta_scan();
+  #endif
   isStopped=false;
-  
+
+  // the high rate streams get the biggest pages the board has room for
+  buffer_set_size(
+#ifdef Use_CAS
+    casduino != CASDUINO_FILETYPE::NONE ||
+#endif
+    currentTask == TASK::INIT ||              // TZX, TSX, CDT: the header is read later
+    currentID == BLOCKID::CSW || currentID == BLOCKID::C64TAP || currentID == BLOCKID::WAV);
   clearBuffer();
 
   // for CAS/DRAGON:
@@ -115,19 +302,99 @@ void UniPlay(){
   uefpassforZero=2;
   //passforOne=4;
   jtapflag=255;
+  bytesrc_clear();
+  tickCarry=3;
+  zeroFrac=0;
+  oneFrac=0;
 
   reset_output_state();
+#ifdef OUTPUT_STATS
+  stats_reset();
+#endif
+#ifdef PROFILE
+  prof_reset();
+#endif
+#ifdef EDGE_VERIFY
+  verify_reset();
+#endif
+#ifdef SERIAL_TRACE
+  trace_start();
+#endif
+#ifdef LOOP_CACHE
+  loop_cache_clear();
+#endif
+#ifdef BLOCK_CHECK
+  blockcheck_clear();
+#endif
+#ifdef MXW_RENDER
+  if (mxwRendering) return;                  // mxw_render fills the pages itself, with no timer
+#endif
+#ifdef INSTANT_PLAY
+  // fill the first page now, so there's something to play the moment the
+  // timer starts (instead of a 100ms wait and then a page of silence)
+  writepos = 0;
+  do {
+    UniLoop();
+  } while (!isStopped && writepos<buffsize);
+  if (!entry.isOpen() && !stream_active()) return;  // the whole file fitted in less than a page, and has finished
+  start_on_write_page();
+  Timer.initialize(1000);
+#else
   Timer.initialize(100000); //100ms pause prevents anything bad happening before we're ready
-  Timer.attachInterrupt(wave2);
+#endif
+  Timer.attachInterrupt(PLAY_ISR);
 }
 
 void UniStop() {
   Timer.stop();
+#if defined(OUTPUT_STATS) && defined(SERIALSCREEN)
+  stats_print();
+#endif
+#ifdef PROFILE
+  prof_print();
+#endif
+#ifdef EDGE_VERIFY
+  verify_print();
+#endif
   isStopped=true;
   start=0;
+#ifdef SD_DMA_READ
+  readahead_invalidate();                     // a background read has the card until it's done
+#endif
+#ifdef FLASH_CACHE
+  flash_store();                              // while the file is still open
+#endif
   entry.close();                              //Close file
+#ifdef LIVE_BAUD
+  LiveBaudApply();                            // one that didn't reach a block is still what was chosen
+#endif
+#ifdef BAUD_CACHE
+  baudcache_restore();
+#endif
+#ifdef RAM_PLAY
+  ram_close();
+#endif
+#ifdef FLASH_CACHE
+  flash_close();
+#endif
+#ifdef NET_STREAM
+  net_close();
+#endif
+#ifdef CDC_STREAM
+  cdc_close();
+#endif
+#ifdef FLASH_LIBRARY
+  lib_close();
+#endif
+#ifdef PLAY_LOG
+  playlog_stop();                             // the timer's stopped, so the card's free
+#endif
+#ifdef P8544_SPI
+  lcd.defer(false);                           // and what's still waiting goes to the display
+#endif
   seekFile(); 
   bytesRead=0;                                // reset read bytes PlayBytes
+  bytesrc_clear();
 #ifdef AYPLAY
   AYPASS_hdrptr = AYPASS_STEP::HDRSTART; // reset AY flag
 #endif
@@ -138,30 +405,19 @@ void UniStop() {
 }
 
 bool getNextDataByte() {
-  if(ReadByte()) {            //Read in a byte
-    currentByte = outByte;
-    #ifdef AYPLAY
-    if (AYPASS_hdrptr == AYPASS_STEP::WRITE_FLAG_BYTE) {
-      currentByte = 0xFF;                 // Only insert first DATA byte if sending AY TAP DATA Block and don't decrement counter
-      AYPASS_hdrptr = AYPASS_STEP::WRITE_CHECKSUM; // set Checksum flag to be sent when EOF reached
-      bytesRead += -1;                    // rollback ptr and compensate for dummy read byte
-      bytesToRead += 2;                   // add 2 bytes to read as we send 0xFF (data flag header byte) and chksum at the end of the block
-    } else {
-    #endif
-      bytesToRead += -1;
-
-    if (currentID==BLOCKID::JTAP && jpass == 0) {
-      currentByte = jtapflag;
-      jpass = 1;
-      bytesRead += -1;
-      bytesToRead += 1;     
-    } 
-    
-    #ifdef AYPLAY
+  if(bytesrc_queued()) {
+    // the block has bytes that aren't in the file (flag, header, checksum), see bytesrc.h
+    if(!bytesrc_next(currentByte)) {
+      pass = 0;
+      if(bytesRead>=filesize) EndOfFile=true;
+      currentBlockTask = BLOCKTASK::PAUSE; // this also handles jumping to GetID if there is no pause (pauseLength==0)
+      return false;
     }
-    bitChecksum ^= currentByte;    // keep calculating checksum
-    #endif
-    
+    bytesToRead += -1;
+  } else if(ReadByte()) {            //Read in a byte
+    currentByte = outByte;
+    bytesToRead += -1;
+
     if(bytesToRead == 0) {                  //Check for end of data block
       pass = 0;
       bytesRead -= 1;                      //rewind a byte if we've reached the end
@@ -169,24 +425,15 @@ bool getNextDataByte() {
       return false;  // exit
     }
   } else {                         // If we reached the EOF
-    
-  #ifdef AYPLAY
-    // Check if need to send checksum
-    if (AYPASS_hdrptr == AYPASS_STEP::WRITE_CHECKSUM)
-    {
-      currentByte = bitChecksum;          // send calculated chksum
-      bytesToRead += 1;                   // add one byte to read
-      AYPASS_hdrptr = AYPASS_STEP::FINISHED; // Reset flag to end block
-    }
-    else
-  #endif
-    {
-      EndOfFile=true;  
-      currentBlockTask = BLOCKTASK::PAUSE; // this also handles EOF case when pauseLength==0
-      return false;                           // return here if normal TAP or TZX  
-    }
+    EndOfFile=true;  
+    currentBlockTask = BLOCKTASK::PAUSE; // this also handles EOF case when pauseLength==0
+    return false;                           // return here if normal TAP or TZX  
   }
 
+  #ifdef BLOCK_SCRUB
+  scrub_track();
+  #endif
+
   if(bytesToRead!=1) {                      //If we're not reading the last byte play all 8 bits
     currentBit=8;
   } else {
@@ -204,10 +451,29 @@ void writeData() {
     pass=0;
   }
 
+  byte frac;
   if(currentByte&0x80){                       //Set next period depending on value of bit 0
     currentPeriod = onePulse;
+    frac = oneFrac;
   } else {
     currentPeriod = zeroPulse;
+    frac = zeroFrac;
+  }
+  if(pass==0 && currentPeriod && currentPeriod<PULSE_PAIR_MAX) {
+    // both halves of the bit in one buffer word
+    tickCarry += frac<<1;
+    if(tickCarry>=14) {
+      tickCarry -= 14;
+      currentPeriod++;
+    }
+    currentPeriod |= PULSE_PAIR_FLAG;
+    pass=1;
+  } else {
+    tickCarry += frac;
+    if(tickCarry>=7) {
+      tickCarry -= 7;
+      currentPeriod++;
+    }
   }
   pass+=1;
   
@@ -218,12 +484,98 @@ void writeData() {
   }    
 }
 
+bool canWriteDataByte8() {
+  // Can the next data byte go through writeDataByte8?  Standard/turbo/pure
+  // data (or a TAP or AY) on a byte boundary, not the last two bytes of the block
+  // (so getNextDataByte's end of block handling and usedBitsInLastByte
+  // can't apply), both bit periods fit a pulse pair word, and there's room
+  // for all 8 words without hitting buffsize
+  if(currentTask!=TASK::PROCESSID || currentBlockTask!=BLOCKTASK::TDATA) return false;
+  if(currentBit!=0 || bytesToRead<3 || writepos+16>buffsize) return false;
+  if(currentID!=BLOCKID::ID10 && currentID!=BLOCKID::ID11 &&
+     currentID!=BLOCKID::ID14 && currentID!=BLOCKID::TAP && currentID!=BLOCKID::JTAP
+#ifdef AYPLAY
+            && currentID!=BLOCKID::AYO
+#endif
+#ifdef Use_SNAPSHOT
+            && currentID!=BLOCKID::SNAP
+#endif
+            ) {
+    return false;
+  }
+  return (zeroPulse && zeroPulse<PULSE_PAIR_MAX && onePulse && onePulse<PULSE_PAIR_MAX);
+}
+
+void writeDataByte8() {
+  // Equivalent to 8 calls of writeData() for one whole byte, but without
+  // 8 trips through TZXLoop / TZXProcess and the block switch ladder.
+  // One pulse pair word per bit, so 16 bytes go into the wbuffer.
+  // Only called when canWriteDataByte8() says so.
+  if (!getNextDataByte()) // false == no more bytes
+    return;
+
+  const word _one = onePulse | PULSE_PAIR_FLAG;
+  const word _zero = zeroPulse | PULSE_PAIR_FLAG;
+  const byte _onefrac = oneFrac<<1;
+  const byte _zerofrac = zeroFrac<<1;
+  byte _b = currentByte;
+  volatile byte * _wb = writeBuffer+writepos;
+  for(byte i=8; i>0; --i)
+  {
+    word _p;
+    if(_b&0x80) {
+      _p = _one;
+      tickCarry += _onefrac;
+    } else {
+      _p = _zero;
+      tickCarry += _zerofrac;
+    }
+    if(tickCarry>=14) {                     // same carry as writeData
+      tickCarry -= 14;
+      _p++;
+    }
+    const byte _b1 = _p /256;
+    const byte _b2 = _p %256;
+    *_wb = _b1;
+    *(_wb+1) = _b2;
+    _wb += 2;
+    _b <<= 1;
+  }
+  writepos += 16;
+  currentBit = 0;
+  pass = 0;
+}
+
+void writeRepeat() {
+  // Emit up to PULSE_TONE_MAX of the remaining pilotPulses as one repeat
+  // (two buffer words: the count now, the period on the next TZXLoop pass),
+  // which wave2 then plays out on its own
+  const word n = (pilotPulses > PULSE_TONE_MAX) ? PULSE_TONE_MAX : pilotPulses;
+  pilotPulses -= n;
+  currentPeriod = PULSE_REPEAT_FLAG | n;
+  pendingWord = pilotLength;
+}
+
+#ifdef FAST_GAPS
+// A pause between blocks, cut to FASTGAP ms (when it's on).  A pause 0
+// (forcePause0) never comes through here, and in a TZX the pause before an
+// ID2A is left alone: that's where a loader wants the tape stopped, and it
+// may still be busy with the header it just loaded.
+word trim_gap(word ms, bool tzx) {
+  if (FASTGAP == 0 || ms <= FASTGAP) return ms;
+  if (tzx && readfile(1, bytesRead) == 1 && filebuffer[0] == 0x2A) return ms;
+  return FASTGAP;
+}
+#endif
+
 void StandardBlock() {
   //Standard Block Playback
   switch (currentBlockTask) {
     case BLOCKTASK::PILOT:
       //Start with Pilot Pulses
-      if(!pilotPulses--) {
+      if(pilotPulses>1) {
+        writeRepeat();
+      } else if(!pilotPulses--) {
         currentBlockTask = BLOCKTASK::SYNC1;
       } else {
         currentPeriod = pilotLength;
@@ -244,27 +596,16 @@ void StandardBlock() {
     
     case BLOCKTASK::TDATA:
       //Data Playback
-#ifdef AYPLAY
-      if (currentID==BLOCKID::AYO && AYPASS_hdrptr <= AYPASS_STEP::HDREND)
-      {
-        WriteAYHeader(); // write TAP Header data from String Vector
-      }
-      else
-      {
-        writeData();
-      }
-#else
       writeData();
-#endif
       break;
     
     case BLOCKTASK::PAUSE:
       //Close block with a pause
-      if((currentID!=BLOCKID::TAP)&&(currentID!=BLOCKID::JTAP)&&(currentID!=BLOCKID::AYO)) {                  // Check if we have !=AYO too
-        temppause = pauseLength;
+      if((currentID!=BLOCKID::TAP)&&(currentID!=BLOCKID::JTAP)&&(currentID!=BLOCKID::AYO)&&(currentID!=BLOCKID::SNAP)) {                  // Check if we have !=AYO too
+        temppause = trim_gap(pauseLength, true);
         currentID = BLOCKID::IDPAUSE;
       } else {
-        currentPeriod = pauseLength;
+        currentPeriod = trim_gap(pauseLength, false);
         bitSet(currentPeriod, 15);
         currentBlockTask = BLOCKTASK::READPARAM;
       }
@@ -276,7 +617,9 @@ void StandardBlock() {
 
 void PureToneBlock() {
   //Pure Tone Block - Long string of pulses with the same length
-  if(!pilotPulses--) {
+  if(pilotPulses>1) {
+    writeRepeat();
+  } else if(!pilotPulses--) {
     currentTask = TASK::GETID;
   } else {
     currentPeriod = pilotLength;
@@ -285,14 +628,40 @@ void PureToneBlock() {
 
 void PulseSequenceBlock() {
   //Pulse Sequence Block - String of pulses each with a different length
-  //Mainly used in speedload blocks
-  if(!seqPulses--) {
+  //Mainly used in speedload blocks.  As many of them as fit are read
+  //straight into the page in one go, and turned from ticks into periods
+  //where they are
+  currentPeriod = 0;
+  if(!seqPulses) {
     currentTask = TASK::GETID;
-  } else {
-    if(ReadWord()) {
-      currentPeriod = TickToUs(outWord);    
+    return;
+  }
+  buffpos_t _n = (buffsize - writepos) / 2;
+  if(_n > seqPulses) _n = seqPulses;
+  volatile byte * const _wb = writeBuffer+writepos;
+  _n = readfile_bytes(_wb, _n*2, bytesRead) / 2;
+  if(_n == 0) {
+    seqPulses = 0;                          //end of file
+    return;
+  }
+  buffpos_t _r = 0;                         //words read so far, and written
+  buffpos_t _w = 0;
+  for(; _r < _n; _r++) {
+    const word _us = TickToUsCarry(word(_wb[2*_r+1], _wb[2*_r]));
+    if(_us > 0x3FFF) {
+      queue_hold(true, false, _us);         //too long for a plain period
+      _r++;
+      break;
+    }
+    if(_us) {                               //(a 0 was never written)
+      _wb[2*_w] = _us /256;
+      _wb[2*_w+1] = _us %256;
+      _w++;
     }
   }
+  bytesRead += 2*_r;
+  seqPulses -= _r;
+  writepos += 2*_w;
 }
 
 void PureDataBlock() {
@@ -303,17 +672,70 @@ void PureDataBlock() {
     break;
     
     case BLOCKTASK::PAUSE:
-      temppause = pauseLength;
+      temppause = trim_gap(pauseLength, true);
       currentID = BLOCKID::IDPAUSE;
     break;
   }
 }
 
+#if defined(DIRECT_SPEED) || defined(DIRECT_RUNS)
+// An ID15 sped up past DIRECT_MIN_SAMPLE (or any, with DIRECT_RUNS): rather
+// than an interrupt for every sample, each run of samples at one level goes
+// out as one held period (queue_hold), so there's only one per edge.  The run lengths carry their
+// fractions of a us on from one to the next, so the speed comes out exact.
+bool directMerge = false;
+unsigned long directSample256;    // the sample period, in 1/256 us
+byte directRunByte;               // what's left of the byte, leftmost bit next
+byte directRunBits = 0;
+bool directRunHigh;
+word directRun = 0;               // samples in the run so far
+byte directRunFrac = 0;
+
+void direct_run_out() {
+  const unsigned long t = directRun * directSample256 + directRunFrac;
+  directRunFrac = t & 0xFF;
+  queue_hold(false, directRunHigh, (t >> 8) ? (t >> 8) : 1);
+  directRun = 0;
+}
+
+void writeDataDirectMerged() {
+  // one run per call: the queue only holds one
+  currentPeriod = 0;
+  pausing = false;
+  for (;;) {
+    if (directRunBits == 0) {
+      if (!getNextDataByte()) {
+        // the end of the block (which getNextDataByte has moved on to its pause)
+        if (directRun) direct_run_out();
+        return;
+      }
+      directRunByte = currentByte;
+      directRunBits = currentBit;
+    }
+    const bool high = directRunByte & 0x80;
+    if (directRun && (high != directRunHigh || directRun == 0xFFFF)) {
+      direct_run_out();
+      return;
+    }
+    directRunHigh = high;
+    directRun++;
+    directRunByte <<= 1;
+    directRunBits--;
+  }
+}
+#endif
+
 void writeDataDirect() {
   // Push byte from file into the buffer, with minimal processing.
   // One byte (8 bits) from file turns directly into one entry in the buffer
   // that encapsulates the DirectRecording mode (plus an extra entry at the
   // start to indicate the sample period))
+#if defined(DIRECT_SPEED) || defined(DIRECT_RUNS)
+  if (directMerge) {
+    writeDataDirectMerged();
+    return;
+  }
+#endif
   if (!getNextDataByte()) // false == no more bytes
   {
     currentPeriod = 0;
@@ -341,6 +763,29 @@ void writeDataDirect16() {
   // This actually bypasses several passes of the TZXLoop / TZXProcess steps
   // This will only be called if there are > 8 more bytes still to read AND
   // space in the output buffer to write 16 bytes without hitting buffsize
+
+  // Usual case: take all 8 bytes in one readfile() (a straight copy out of the
+  // read-ahead window) instead of 8 trips through getNextDataByte/ReadByte.
+  // With >= 16 bytes left in the block none of getNextDataByte's end of
+  // block / EOF handling can apply to these 8 bytes.
+  if(readfile(8, bytesRead)==8)
+  {
+    bytesRead += 8;
+    bytesToRead -= 8;
+    volatile byte * _wb = writeBuffer+writepos;
+    for(byte i=0; i<8; i++)
+    {
+      const byte _b1 = filebuffer[i];
+      *_wb = 0x47; // = ((1<<14) + (7<<8))>>8
+      *(_wb+1) = _b1;
+      _wb += 2;
+    }
+    writepos += 16;
+    currentByte = filebuffer[7];
+    currentBit = 8;
+    return;
+  }
+
   for(byte iter=8; iter>0; --iter)
   {
     if (!getNextDataByte()) // false == no more bytes
@@ -361,33 +806,118 @@ void writeDataDirect16() {
     //     writeBuffer[writepos+1] = currentPeriod %256;   //add period to the buffer
     //
     // but we don't even need to use currentPeriod variable for this, we can do directly:
-    // Also note that the following code takes as much as possible out of the noInterrupts section;
-    // on Nano328p there are only 2 assembly instructions between noInterrupts() and interrupts())
-    // 5e7a:	f8 94       	cli
-    // 5e7c:	20 82       	st	Z, r2
-    // 5e7e:	81 83       	std	Z+1, r24	; 0x01
-    // 5e80:	78 94       	sei
 
     const byte _b1 = currentByte;
     volatile byte * _wb = writeBuffer+writepos;
-    noInterrupts();                       //Pause interrupts while we add a period to the buffer
     *_wb = 0x47; // = ((1<<14) + (7<<8))>>8
     *(_wb+1) = _b1;
-    interrupts();
     writepos+=2;
   }
 }
 
 
+void SetPause(bool pause) {
+  // pause or resume the output straight away, rather than on the next UniLoop.
+  // UniLoop keeps filling the buffer while paused, so on resume the ISR has
+  // data waiting and the first edge comes out on its next tick
+#ifdef LOW_POWER_IDLE
+  bool _change = pause != pauseOn;
+  #ifdef MXW_RENDER
+  if (mxwRendering) _change = false;        // there's no timer to stop
+  #endif
+#endif
+  noInterrupts();
+  pauseOn = pause;
+  isStopped = pause;
+  interrupts();
+#ifdef PLAY_LOG
+  playlog_pause(pause);
+#endif
+#ifdef LOW_POWER_IDLE
+  // nothing to time while paused, so the timer stops as well (and loop()
+  // can sleep), and starts again from a short tick on resume
+  if (_change && pause) {
+    Timer.stop();
+  } else if (_change) {
+    Timer.initialize(1000);
+    Timer.attachInterrupt(PLAY_ISR);
+  }
+#endif
+#ifdef BLOCK_EEPROM_PUT
+  if (pause) blockstore_flush();
+#endif
+}
+
+#ifdef LIVE_BAUD
+word pendingBaud = 0;       // from up/down while playing, 0 if none
+
+word LiveBaudNext() {
+  return pendingBaud ? pendingBaud : BAUDRATE;
+}
+
+void LiveBaudSet(word baud) {
+  pendingBaud = (baud == BAUDRATE) ? 0 : baud;
+}
+
+word LiveBaudStep(bool faster) {
+  // the same steps as the menu, and as underrunSlowdown
+  word baud = LiveBaudNext();
+  if (faster) {
+    switch(baud) {
+      case 1200: baud = 2400; break;
+      case 2400: baud = 3150; break;
+      case 3150: baud = 3600; break;
+      case 3600: baud = 3850; break;
+    }
+  } else {
+    switch(baud) {
+      case 3850: baud = 3600; break;
+      case 3600: baud = 3150; break;
+      case 3150: baud = 2400; break;
+      case 2400: baud = 1200; break;
+    }
+  }
+  LiveBaudSet(baud);
+  return baud;
+}
+
+bool LiveBaudApply() {
+  // between blocks, so nothing already in the buffer (or half way through a block) changes
+  if (!pendingBaud) return false;
+  BAUDRATE = pendingBaud;
+  pendingBaud = 0;
+  return true;
+}
+#endif
+
 void ForcePauseAfter0() {
-  pauseOn=true;
-  printtext2F(PSTR("PAUSED* "),0);
+  SetPause(true);
+  if (underrunPause) {
+    printtext2F(PSTR("UNDERRUN"),0);
+  } else {
+    printtext2F(PSTR("PAUSED* "),0);
+  }
   forcePause0=false;
+  underrunPause=false;
   return;  
 }
 
+void OutputUnderrun() {
+  // The ISR ran out of buffered data and played silence, so whatever is loading
+  // has probably lost this block.  Changing speed mid-file would break it further,
+  // so stop at the end of the block and slow down when the file is played again
+  underrunPause = true;
+  underrunSlowdown = true;
+#ifdef PLAY_LOG
+  playlog_underrun();
+#endif
+}
+
 void UniSetup() {
   INIT_OUTPORT;
+  #ifdef FANOUT_PINS
+    fanout_setup();
+  #endif
   isStopped=true;
   pinState=LOW;
   WRITE_LOW;
@@ -409,7 +939,65 @@ void ReadTZXHeader() {
   HeaderFail();
 }
 
+// Blocks (and whole file formats) that are handled by one function of their
+// own.  The first pass through TZXProcess for one of these IDs finds its
+// handler here, and from then on TZXLoop calls it directly for as long as
+// the block lasts, without going through the task and block ID switches.
+typedef void (*BLOCK_PROCESS)();
+struct BLOCK_HANDLER {
+  byte id;
+  BLOCK_PROCESS process;
+};
+
+const BLOCK_HANDLER blockHandlers[] PROGMEM = {
+  { BLOCKID::ID4B, tzx_process_blockid_kansas_4b },
+  { BLOCKID::ZXP, tzx_process_blockid_zx8081_zxp },
+  { BLOCKID::ZXO, tzx_process_blockid_zx8081_zxo },
+#ifdef tapORIC
+  { BLOCKID::ORIC, tzx_process_blockid_oric },
+#endif
+#ifdef Use_CAQ
+  { BLOCKID::CAQ, caq_process },
+#endif
+#ifdef Use_CSW
+  { BLOCKID::CSW, csw_process },
+#endif
+#ifdef Use_WAV
+  { BLOCKID::WAV, wav_process },
+#endif
+#ifdef Use_MZF
+  { BLOCKID::MZF, mzf_process },
+#endif
+#ifdef Use_MTX
+  { BLOCKID::MTX, mtx_process },
+#endif
+#ifdef Use_c64
+  { BLOCKID::C64TAP, c64tap_process },
+#endif
+#ifdef Use_MXW
+  { BLOCKID::MXW, mxw_process },
+#endif
+};
+
+byte handlerID = 0;                 // the ID blockHandler was looked up for
+BLOCK_PROCESS blockHandler = nullptr;
+
+BLOCK_PROCESS block_handler() {
+  if(currentID != handlerID) {
+    handlerID = currentID;
+    blockHandler = nullptr;
+    for(byte i=0; i<sizeof(blockHandlers)/sizeof(blockHandlers[0]); i++) {
+      if(pgm_read_byte(&blockHandlers[i].id) == currentID) {
+        blockHandler = (BLOCK_PROCESS)pgm_read_ptr(&blockHandlers[i].process);
+        break;
+      }
+    }
+  }
+  return blockHandler;
+}
+
 void TZXProcess() {
+  PROFILE_SCOPE(TZXPROCESS);
   if(currentBlockTask==BLOCKTASK::ID15_TDATA)
   {
     // shortcut for ID15 handler for performance
@@ -459,14 +1047,24 @@ void TZXProcess() {
     
     case TASK::GETID:
       //grab 1 byte ID
+      #ifdef TZX_PROGRAM
+      if(tzxprog_next(currentID)) {
+        // ID came from the pre-parsed block table
+      } else
+      #endif
       if(ReadByte()) {
         currentID = outByte;
       } else {
         currentID = BLOCKID::IDEOF;
       }
+      #ifdef LIVE_BAUD
+      LiveBaudApply();
+      #endif
       //reset data block values
       currentBit=0;
       pass=0;
+      zeroFrac=0;
+      oneFrac=0;
       //set current task to PROCESSID
       currentTask = TASK::PROCESSID;
       currentBlockTask = BLOCKTASK::READPARAM;
@@ -474,6 +1072,10 @@ void TZXProcess() {
 
     case TASK::PROCESSID:
       //ID Processing
+      if(block_handler()) {
+        blockHandler();
+        break;
+      }
       switch(currentID) {
         case BLOCKID::ID10:
           //Process ID10 - Standard Block
@@ -485,6 +1087,9 @@ void TZXProcess() {
               }
               if(ReadWord()) {
                 bytesToRead = outWord +1;
+                #ifdef BLOCK_CHECK
+                blockcheck_start(bytesRead, outWord);
+                #endif
               }
               if(ReadByte()) {
                 if(outByte == 0) {
@@ -494,11 +1099,11 @@ void TZXProcess() {
                 }
                 bytesRead += -1;
               }
-              pilotLength = PILOTLENGTH;
-              sync1Length = SYNCFIRST;
-              sync2Length = SYNCSECOND;
-              zeroPulse = ZEROPULSE;
-              onePulse = ONEPULSE;
+              #ifdef PILOT_TRIM
+              // a standard speed block is for the ROM loader
+              if (pilotPulses > PILOT_TRIM_ZX) pilotPulses = PILOT_TRIM_ZX;
+              #endif
+              StandardTimings();
               currentBlockTask = BLOCKTASK::PILOT;
               usedBitsInLastByte=8;
               break;
@@ -526,54 +1131,24 @@ void TZXProcess() {
                 sync2Length = TickToUs(outWord);
               }          
               if(ReadWord()) {
-                zeroPulse = TickToUs(outWord);
+                zeroPulse = TickToUsFrac(outWord, zeroFrac);
               }
               if(ReadWord()) {
-                onePulse = TickToUs(outWord);
+                onePulse = TickToUsFrac(outWord, oneFrac);
               }          
             #else    
-              if (TSXCONTROLzxpolarityUEFSWITCHPARITY && AMScdt){ 
-                bytesRead += 10;
-                switch(BAUDRATE){
-                  case 1200: // 1000 Normal baudrate
-                    //zeroPulse = TickToUs(1167);
-                    pilotLength = onePulse = 666;
-                    sync1Length = sync2Length = zeroPulse = 333;                                           
-                    break;
-                  case 2400: // 2000 High baudrate
-                    //zeroPulse = TickToUs(583);
-                    pilotLength = onePulse = 334;
-                    sync1Length = sync2Length = zeroPulse = 167; 
-                    break;
-                  case 3150:
-                  case 3600: // 3500 Max ROM baudrate
-                    //zeroPulse = TickToUs(333);
-                    pilotLength = onePulse = 190;
-                    sync1Length = sync2Length = zeroPulse = 95;                    
-                    break;
-                  case 3850: // 4000 Specvar loader baudrate
-                    //zeroPulse = TickToUs(292);
-                    pilotLength = onePulse = 166;
-                    sync1Length = sync2Length = zeroPulse = 83;                      
-                    break;
-                }                                                                                                   
-              } else {
-                if(ReadWord()) {
-                  pilotLength = TickToUs(outWord);
-                }
-                if(ReadWord()) {
-                  sync1Length = TickToUs(outWord);
-                }
-                if(ReadWord()) {
-                  sync2Length = TickToUs(outWord);
-                }                             
-                if(ReadWord()) {
-                  zeroPulse = TickToUs(outWord);
-                }
-                if(ReadWord()) {
-                  onePulse = TickToUs(outWord);
+              {
+                word t[5] = {0, 0, 0, 0, 0};    // pilot, sync1, sync2, zero, one
+                for (byte i = 0; i < 5; i++) {
+                  if(ReadWord()) t[i] = outWord;
                 }
-              }    
+                if (TSXCONTROLzxpolarityUEFSWITCHPARITY && AMScdt) CDTSpeedup(t);
+                pilotLength = TickToUs(t[0]);
+                sync1Length = TickToUs(t[1]);
+                sync2Length = TickToUs(t[2]);
+                zeroPulse = TickToUsFrac(t[3], zeroFrac);
+                onePulse = TickToUsFrac(t[4], oneFrac);
+              }
             #endif
                             
               if(ReadWord()) {
@@ -588,6 +1163,13 @@ void TZXProcess() {
               if(ReadLong()) {
                 bytesToRead = outLong +1;
               }
+            #if defined(PILOT_TRIM) && defined(ID11CDTspeedup)
+              // the CPC firmware's blocks start with its sync byte, 0x2C for
+              // a header or 0x16 for data; anything else may be a turbo loader
+              if (AMScdt && pilotPulses > PILOT_TRIM_CPC && readfile(1, bytesRead) == 1
+                  && (filebuffer[0] == 0x2C || filebuffer[0] == 0x16))
+                pilotPulses = PILOT_TRIM_CPC;
+            #endif
               currentBlockTask = BLOCKTASK::PILOT;
             break;
           
@@ -629,10 +1211,10 @@ void TZXProcess() {
           //process ID14 - Pure Data Block             
           if(currentBlockTask==BLOCKTASK::READPARAM) {
             if(ReadWord()) {
-              zeroPulse = TickToUs(outWord); 
+              zeroPulse = TickToUsFrac(outWord, zeroFrac); 
             }
             if(ReadWord()) {
-              onePulse = TickToUs(outWord); 
+              onePulse = TickToUsFrac(outWord, oneFrac); 
             }
             if(ReadByte()) {
               usedBitsInLastByte = outByte;
@@ -658,6 +1240,29 @@ void TZXProcess() {
           if(ReadWord()) {     
             SampleLength = TickToUs(outWord);
           }
+          #if defined(DIRECT_SPEED) || defined(DIRECT_RUNS)
+          #ifdef DIRECT_SPEED
+          const word speed = rateprobe_speed(RATE_DIRECT, DIRECTSPEED, SampleLength);
+          #else
+          const word speed = 100;
+          #endif
+          // the sample period to 1/256 us (ticks are 1/3.5 us), which the ISR
+          // makes up with directSampleFrac, or the runs carry on (directMerge)
+          directSample256 = ((unsigned long)outWord * 51200UL) / (7UL * speed);
+          #ifdef DIRECT_RUNS
+          directMerge = true;
+          #else
+          directMerge = speed != 100 && directSample256 < DIRECT_MIN_SAMPLE * 256UL;
+          #endif
+          if (speed == 100 && !directMerge) directSample256 = SampleLength << 8;   // as it always was
+          SampleLength = directSample256 >> 8;
+          directRunBits = 0;
+          directRun = 0;
+          directRunFrac = 0;
+          #ifdef Use_CAS
+          directNextFrac = directSample256 & 0xFF;
+          #endif
+          #endif
           if(ReadWord()) {      
             //Pause after this block in milliseconds
             pauseLength = outWord;  
@@ -673,6 +1278,9 @@ void TZXProcess() {
             //currentID=BLOCKID::UNKNOWN;
           }            
           currentBlockTask=BLOCKTASK::ID15_TDATA;
+          #ifdef BLOCK_SCRUB
+          scrub_track_direct(SampleLength);
+          #endif
 
             // and write the sample period information to the output using this format:
             // 011sssssssssssss  = 0x6000 + S
@@ -684,9 +1292,12 @@ void TZXProcess() {
             // +-- always 0
 
             currentPeriod = SampleLength | 0x6000;
+            #if defined(DIRECT_SPEED) || defined(DIRECT_RUNS)
+            if (directMerge) currentPeriod = 0;   // no sample period: the runs are plain held periods
+            #endif
 
           } else if(currentBlockTask==BLOCKTASK::PAUSE) {
-            temppause = pauseLength;
+            temppause = trim_gap(pauseLength, true);
             currentID = BLOCKID::IDPAUSE;                     
           } else {
             writeDataDirect();
@@ -694,8 +1305,18 @@ void TZXProcess() {
           break;
 
 
+      #ifdef Use_CSW
+        case BLOCKID::ID18:
+          //Process ID18 - CSW recording block
+          tzx_process_blockid_id18();
+          break;
+      #endif
+
         case BLOCKID::ID19:
           //Process ID19 - Generalized data block
+          #ifdef Use_GDB
+            if (gdb_process()) break;  // anything but the ZX81 layout handled below
+          #endif
           switch (currentBlockTask) {
             case BLOCKTASK::READPARAM:
               #ifdef BLOCKID19_IN      
@@ -717,6 +1338,7 @@ void TZXProcess() {
                 bytesToRead += -88; // pauseLength + SYMDEFs
               #endif
               //currentBlockTask=PAUSE;
+              pass=0;                       // ZX8081DataBlock starts on a byte boundary
               currentBlockTask=BLOCKTASK::TDATA;
               break;
           /*
@@ -737,7 +1359,7 @@ void TZXProcess() {
           if(ReadWord()) {
             if(outWord>0) {
               forcePause0=false;          // pause0 FALSE
-              temppause = outWord;
+              temppause = trim_gap(outWord, true);
             } else {                    // If Pause duration is 0 ms then Stop The Tape
               forcePause0=true;          // pause0 TRUE
             }
@@ -762,11 +1384,25 @@ void TZXProcess() {
           currentTask = TASK::GETID;
           break;
 
+        case BLOCKID::ID23:
+          //Process ID23 - Jump to block
+          if(ReadWord()) {
+            #if defined(BLOCKID_NOMEM_SEARCH) || defined(BLOCK_SD_INDEX)
+            // 0 would jump to itself for ever, so carry on instead
+            if(outWord!=0) TZXJump(bytesRead-3, (int)outWord);
+            #endif
+          }
+          currentTask = TASK::GETID;
+          break;
+
         case BLOCKID::ID24:
           //Process ID24 - Loop Start          
           if(ReadWord()) {
             loopCount = outWord;
             loopStart = bytesRead;
+            #ifdef LOOP_CACHE
+            loop_cache_clear();
+            #endif
           }
           currentTask = TASK::GETID;
           break;
@@ -775,11 +1411,66 @@ void TZXProcess() {
           //Process ID25 - Loop End          
           loopCount += -1;
           if(loopCount!=0) {
+            #ifdef TZX_PROGRAM
+            tzxprog_looped += bytesRead - loopStart;
+            #endif
+            #ifdef LOOP_CACHE
+            loop_cache_store(loopStart, bytesRead);
+            #endif
             bytesRead = loopStart;
           } 
           currentTask = TASK::GETID;
           break;
 
+        case BLOCKID::ID26:
+          //Process ID26 - Call sequence
+          if(ReadWord()) {
+            #if defined(BLOCKID_NOMEM_SEARCH) || defined(BLOCK_SD_INDEX)
+            callBlock = bytesRead-3;
+            const word calls = outWord;
+            callCount = 0;
+            if(calls!=0 && ReadWord() && TZXJump(callBlock, (int)outWord)) {
+              callCount = calls;
+              callNext = 1;
+            }
+            else bytesRead = callBlock+3 + long(calls)*2;
+            #else
+            bytesRead += long(outWord)*2;
+            #endif
+          }
+          currentTask = TASK::GETID;
+          break;
+
+        case BLOCKID::ID27:
+          //Process ID27 - Return from sequence
+          #if defined(BLOCKID_NOMEM_SEARCH) || defined(BLOCK_SD_INDEX)
+          if(callCount!=0) {
+            // the next call in the list, or on past the ID26 after the last
+            const unsigned long after = callBlock+3 + long(callCount)*2;
+            bool jumped = false;
+            if(callNext < callCount) {
+              bytesRead = callBlock+3 + long(callNext)*2;
+              callNext++;
+              jumped = ReadWord() && TZXJump(callBlock, (int)outWord);
+            }
+            if(!jumped) {
+              callCount = 0;
+              if(!TZXJump(callBlock, 1)) bytesRead = after;
+            }
+          }
+          #endif
+          currentTask = TASK::GETID;
+          break;
+
+        case BLOCKID::ID28:
+          //Process ID28 - Select block
+          //No menu to pick from, so play on into the next block
+          if(ReadWord()) {
+            bytesRead += outWord;
+          }
+          currentTask = TASK::GETID;
+          break;
+
         case BLOCKID::ID2A:
           //Skip//        
           bytesRead+=4;
@@ -850,40 +1541,12 @@ void TZXProcess() {
           currentTask = TASK::GETID;
           break;
         
-        case BLOCKID::ID4B:
-          tzx_process_blockid_kansas_4b();
-          break; // Case_ID4B
-
         case BLOCKID::ID5A:
           // Glue block; nothing to do (skip it)
           bytesRead += 9;
           currentTask = TASK::GETID;
           break;
 
-      #ifdef Use_CAQ
-        case BLOCKID::CAQ:
-          caq_process();
-          break;
-      #endif
-
-      #ifdef Use_MZF
-        case BLOCKID::MZF:
-          mzf_process();
-          break;
-      #endif
-
-      #ifdef Use_MTX
-        case BLOCKID::MTX:
-          mtx_process();
-          break;
-      #endif
-
-      #ifdef Use_c64
-        case BLOCKID::C64TAP:
-          c64tap_process();
-          break;
-      #endif
-
         case BLOCKID::JTAP:
       /*    //Jupiter Tap file block
           switch(currentBlockTask) {                 
@@ -933,12 +1596,18 @@ void TZXProcess() {
               if(ReadWord()) {
                 bytesToRead = outWord+1;
               }
+              bytesrc_clear();
 
               switch(currentID) {
 
                 case BLOCKID::JTAP:
-                  jpass = 0; 
                   jtapflag ^= 0xFF;
+                  if(bytesRead < filesize) {
+                    // the flag byte isn't in the file, so it goes in ahead of the block
+                    bytesrc_fill(jtapflag, 1);
+                    bytesrc_file(bytesToRead-1);
+                    bytesToRead += 1;
+                  }
                   if(jtapflag == 0) {
                     pilotPulses = 4096 + 1; //SP:8063 //JP:4096
                   } else {
@@ -956,7 +1625,9 @@ void TZXProcess() {
 
                 case BLOCKID::TAP:
                 default:
-                
+                  #ifdef BLOCK_CHECK
+                  blockcheck_start(bytesRead, bytesToRead-1);
+                  #endif
                   if(ReadByte()) {
                     if(outByte == 0) {
                       pilotPulses = PILOTNUMBERL + 1;
@@ -965,11 +1636,17 @@ void TZXProcess() {
                     }
                     bytesRead += -1;
                   }
-                  pilotLength = PILOTLENGTH;
-                  sync1Length = SYNCFIRST;
-                  sync2Length = SYNCSECOND;
-                  zeroPulse = ZEROPULSE;
-                  onePulse = ONEPULSE;
+                  StandardTimings();
+                #ifdef PILOT_TRIM
+                  if (pilotPulses > PILOT_TRIM_ZX + 1) pilotPulses = PILOT_TRIM_ZX + 1;
+                #endif
+                #ifdef TAPSPEEDUP
+                  // a .tap is always for the ROM loader, so it gets the
+                  // shortest timings the ROM still reads right
+                  if (pilotPulses > TAPSPEEDUP_PILOT) pilotPulses = TAPSPEEDUP_PILOT;
+                  zeroPulse = TickToUsDown(TAPSPEEDUP_ZERO);
+                  zeroFrac = TickFrac(TAPSPEEDUP_ZERO);
+                #endif
                   currentBlockTask = BLOCKTASK::PILOT;
                   usedBitsInLastByte=8;               
                   break;                                 
@@ -982,14 +1659,6 @@ void TZXProcess() {
           }
           break; // Case for combined BLOCKID TAP & JTAP
 
-        case BLOCKID::ZXP:
-          tzx_process_blockid_zx8081_zxp();
-          break; // Case ZXP
-        
-        case BLOCKID::ZXO:
-          tzx_process_blockid_zx8081_zxo();
-          break; // Case ZXO
-        
       #ifdef AYPLAY
         case BLOCKID::AYO:                           //AY File - Pure AY file block - no header, must emulate it
           switch(currentBlockTask) {
@@ -1001,21 +1670,19 @@ void TZXProcess() {
                                           // name of the AY file (max 10 bytes) which we will display as "ZXAYFile " followed by the 
                                           // length of the block (word), checksum plus 0xFF to indicate next block is DATA.
                                           // 13 00[00 03(5A 58 41 59 46 49 4C 45 2E 49)1A 0B 00 C0 00 80]21<->[1C 0B FF<AYFILE>CHK]
-              pilotLength = PILOTLENGTH;
-              sync1Length = SYNCFIRST;
-              sync2Length = SYNCSECOND;
-              zeroPulse = ZEROPULSE;
-              onePulse = ONEPULSE;
-              currentBlockTask = BLOCKTASK::PILOT;    // now send pilot, SYNC1, SYNC2 and TDATA (writeheader() from String Vector on 1st pass then writeData() on second)
-              bitChecksum = 0;
+              StandardTimings();
+              currentBlockTask = BLOCKTASK::PILOT;    // now send pilot, SYNC1, SYNC2 and TDATA (the header built by ReadAYHeader on 1st pass then the file on second)
               bytesRead = 0;
               if (AYPASS_hdrptr == AYPASS_STEP::HDRSTART){
                 pilotPulses = PILOTNUMBERL + 1;
               } else {
                 // already sent header, so now send data block (shorter pilot)
                 pilotPulses = PILOTNUMBERH + 1;
-                bytesToRead = filesize+5;   // set length of file to be read plus data byte and CHKSUM (and 2 block LEN bytes)
               }
+              #ifdef PILOT_TRIM
+              if (pilotPulses > PILOT_TRIM_ZX + 1) pilotPulses = PILOT_TRIM_ZX + 1;
+              #endif
+              ay_queue_block();
               usedBitsInLastByte=8;
               break;
 
@@ -1026,12 +1693,35 @@ void TZXProcess() {
           break; // Case AYO
       #endif
 
-      #ifdef tapORIC
-        case BLOCKID::ORIC:
-          tzx_process_blockid_oric();
-          break;
-      #endif // tapORIC
-                
+      #ifdef Use_SNAPSHOT
+        case BLOCKID::SNAP:                          //Snapshot - made up ROM blocks, see snapshot.h
+          switch(currentBlockTask) {
+            case BLOCKTASK::READPARAM:
+              if (!snap_queue_block()) {
+                currentID = BLOCKID::IDEOF;
+                break;
+              }
+              StandardTimings();
+              #ifdef PILOT_TRIM
+              if (pilotPulses > PILOT_TRIM_ZX + 1) pilotPulses = PILOT_TRIM_ZX + 1;
+              #endif
+              #ifdef TAPSPEEDUP
+              // all of it goes through the ROM's LD-BYTES, as a .tap does
+              if (pilotPulses > TAPSPEEDUP_PILOT) pilotPulses = TAPSPEEDUP_PILOT;
+              zeroPulse = TickToUsDown(TAPSPEEDUP_ZERO);
+              zeroFrac = TickFrac(TAPSPEEDUP_ZERO);
+              #endif
+              currentBlockTask = BLOCKTASK::PILOT;
+              usedBitsInLastByte=8;
+              break;
+
+            default:
+              StandardBlock();
+              break;
+          }
+          break; // Case SNAP
+      #endif
+
         case BLOCKID::IDPAUSE:
           if(temppause>0) {
             if(temppause > MAXPAUSE_PERIOD) {
@@ -1043,7 +1733,7 @@ void TZXProcess() {
             }
             bitSet(currentPeriod, 15);
           } else {
-            if (forcePause0) { // Stop the Tape
+            if (forcePause0 || underrunPause) { // Stop the Tape
               if(!count_r==0) {
                 currentPeriod = 32769;
                 count_r += -1;
@@ -1060,16 +1750,15 @@ void TZXProcess() {
           break;
     
         case BLOCKID::IDEOF:
-          //Handle end of file
-          if(!count_r==0) {
-            currentPeriod = 10;
-            bitSet(currentPeriod, 15);
-            bitSet(currentPeriod, 13);
-            count_r += -1;
-          } else {
-            stopFile();
+          //Handle end of file: pad on until the ISR has played everything before the padding
+          if(count_r==0 && buffer_played_out()) {
+            fileEnded();
             return;
-          }       
+          }
+          currentPeriod = 10;
+          bitSet(currentPeriod, 15);
+          bitSet(currentPeriod, 13);
+          if(count_r!=0 && --count_r==0) buffer_mark_end();
           break; 
         
         default:
@@ -1107,6 +1796,9 @@ void TZXProcess() {
             //lcd.print(String(bytesRead,HEX) + " - L: " + String(loopCount, DEC));
             utoa(bytesRead,PlayBytes,16);
             lcd.print(PlayBytes) ;  lcd.print(" - L: "); lcd.print(loopCount);
+            #ifdef P8544_SPI
+              lcd.flush();
+            #endif
           #endif
 
           noInterrupts();  
@@ -1123,55 +1815,150 @@ void TZXProcess() {
   } // end of CurrentTask switch statement
 }
 
+word pauseStart(word _p) {
+  // the players ask for a pause with bit 15 set: _p ms, or with bit 13 as
+  // well (the 'ending' pause), an edge and then _p us.  Returns the first
+  // word, and queues the rest of the pause (see queue_hold)
+  if(bitRead(_p, 13)) {
+    _p &= 0x1FFF;
+    if(_p > SEGMENT_MAX) {
+      queue_hold(true, false, _p);
+      return 0;
+    }
+    return _p ? (SEGMENT_FLAG | SEGMENT_TOGGLE | _p) : 0;
+  }
+  _p &= 0x1FFF;
+  if(_p == 0) return 0;
+  const bool _high = TSXCONTROLzxpolarityUEFSWITCHPARITY;   // the level a pause ends on
+  if(pausing) {
+    // carrying on from another pause: no edge this time
+    queue_hold(false, _high, _p * 1000ul);
+    return 0;
+  }
+  // a pause after pulses starts with an edge and 1.5ms at that level,
+  // and the first ms of the pause goes towards that
+  pausing = true;
+  queue_hold(false, _high, (_p > 1) ? (_p - 1) * 1000ul : 1);   // still go to that level
+  return SEGMENT_FLAG | SEGMENT_TOGGLE | 1500;
+}
+
 void TZXLoop() {   
-  if(currentBlockTask == BLOCKTASK::ID15_TDATA && writepos+16<=buffsize && bytesToRead>=16)
+  #ifdef SD_DMA_READ
+  sd_dma_poll();      // the next window coming in from the card meanwhile
+  #endif
+  if(currentBlockTask == BLOCKTASK::ID15_TDATA && !queuedCount && writepos+16<=buffsize && bytesToRead>=16
+  #if defined(DIRECT_SPEED) || defined(DIRECT_RUNS)
+     && !directMerge
+  #endif
+    )
   {
     // shortcut for ID15 handler for performance
     // write 8 input bytes (=16 output bytes to buffer)
     // ALSO: skips the lcd updates (SHOW_CNTR, SHOW_PCT) entirely
+    pausing = false;
     writeDataDirect16();
     return;
   }
 
+  if(!pendingWord && !queuedCount && canWriteDataByte8())
+  {
+    // same again for standard/turbo data: one whole byte (8 pulse pair
+    // words) per call, also skipping the lcd updates
+    pausing = false;
+    writeDataByte8();
+    return;
+  }
+
   if(writepos<buffsize){                    // Keep filling until full
-    TZXProcess();                           //generate the next period to add to the buffer
-    if(currentPeriod>0) {
+    bool _queued = false;
+    if(pendingWord) {
+      currentPeriod = pendingWord;          //second word of a repeat
+      pendingWord = 0;
+    } else if(queuedCount) {
+      currentPeriod = queued_word();        //the rest of a pause, or a long period
+      _queued = true;
+    } else {
+      const buffpos_t _before = writepos;
+      if(blockHandler && currentID==handlerID && currentTask==TASK::PROCESSID) {
+        currentPeriod = 0;
+        blockHandler();                     //straight to the block's own handler, see blockHandlers
+      } else {
+        TZXProcess();                       //generate the next period to add to the buffer
+      }
+      if(writepos != _before) pausing = false;   // the handler wrote its own words (pwm_write)
+      if((currentPeriod & SEGMENT_MASK) == SEGMENT_FLAG && currentID != BLOCKID::C64TAP) {
+        currentPeriod = pauseStart(currentPeriod);   //turn a pause into segments and long periods for wave2
+      } else if(currentPeriod>0) {
+        pausing = false;
+      }
+    }
+    if(currentPeriod>0 || _queued) {
       //add period to the buffer
       const byte _b1 = currentPeriod /256;
       const byte _b2 = currentPeriod %256;
       volatile byte * _wb = writeBuffer+writepos;
-      noInterrupts();                       //Pause interrupts while we add a period to the buffer
       *_wb = _b1;
       *(_wb+1) = _b2;
-      interrupts();
       writepos+=2;
     }
   } else {
+    #if defined(OLED1306) && defined(OLEDPRINTBLOCK)
+      block_show();
+    #endif
     if (!pauseOn) {
+    #if defined(SHOW_CNTR) || defined(SHOW_PCT)
+      lcdCatchUp();
+    #endif
     #if defined(SHOW_CNTR)
       lcdTime();          
     #endif
     #if defined(SHOW_PCT)          
       lcdPercent();
     #endif
+    #if defined(SCROLL_WHILE_PLAYING)
+      scrollTextPlaying(fileName);
+    #endif
     }
   } 
 }
 
 void UniLoop() {
-  bool _copybuff;
-  noInterrupts();
-  //Pause interrupts to prevent var reads and copy values out
+  static byte underrunsSeen = 0;
   isStopped = pauseOn;
-  _copybuff = morebuff;
-  morebuff = false;
-  interrupts();
 
-  if(_copybuff)
+  const byte _underruns = underruns;      // only the ISR writes it, so no need to stop it
+  if(_underruns != underrunsSeen)
+  {
+    underrunsSeen = _underruns;
+    OutputUnderrun();
+  }
+
+  if(writepos>=buffsize && next_write_page())
   {
-    //Buffer has swapped, start from the beginning of the new page
+    //Page full and there is a free page ahead of the ISR, so keep filling
     writepos=0;
   }
+ #ifdef READAHEAD_PREFETCH
+  else if(writepos>=buffsize)
+  {
+    //The ring is full (the ISR is in a long pause, say): get the next window from the card meanwhile
+    readahead_prefetch();
+  }
+ #endif
+ #ifdef USB_STORAGE_POLLED
+  if(writepos>=buffsize)
+  {
+    //and the host's reads of the card, likewise
+    usb_storage_loop();
+  }
+ #endif
+ #ifdef P8544_SPI
+  if(writepos>=buffsize)
+  {
+    //and a row of what's changed on the display
+    lcd.update();
+  }
+ #endif
 
  #ifdef Use_CAS
     if (casduino!=CASDUINO_FILETYPE::NONE)
@@ -10,7 +10,32 @@ void UniStop();
 
 void HeaderFail();
 void ForcePauseAfter0();
-word TickToUs(word ticks);
+void SetPause(bool pause);
+#ifdef LIVE_BAUD
+// up/down while playing: the next speed to (or from) whichever is pending,
+// which goes into BAUDRATE at the next block (LiveBaudApply)
+word LiveBaudStep(bool faster);
+bool LiveBaudApply();       // at a block boundary: true if BAUDRATE changed
+void LiveBaudSet(word baud);  // the same, for a speed from the menu
+word LiveBaudNext();        // the speed pending, or BAUDRATE
+#endif
+void OutputUnderrun();
+#ifdef FAST_GAPS
+word trim_gap(word ms, bool tzx);
+#else
+inline word trim_gap(word ms, bool) { return ms; }
+#endif
+// T-states (1/3500000 s) to us.  constexpr, so the fixed timings
+// (Spectrum standards and the like) are worked out at compile time
+constexpr word TickToUs(word ticks) {
+  // returns (ticks/3.5)+0.5
+  /* Hagen Patzke optimization */
+  return (word)((((long(ticks) << 2) + 7) >> 1) / 7);
+}
+constexpr word TickToUsDown(word ticks) { return (long(ticks) << 1) / 7; }  // rounded down
+constexpr byte TickFrac(word ticks) { return (long(ticks) << 1) % 7; }       // and the rest, in 1/7 us
+word TickToUsFrac(word ticks, byte &frac);
+word TickToUsCarry(word ticks);
 
 extern word currentPeriod;
 extern word pauseLength;
@@ -33,6 +58,9 @@ extern byte uefpassforZero;
 
 #ifdef ID11CDTspeedup
 extern bool AMScdt;
+#ifndef CDT_MIN_ZERO
+  #define CDT_MIN_ZERO 292          // shortest zero, in T-states, any block is sped up to (check with OUTPUT_STATS before lowering)
+#endif
 #endif
 
 
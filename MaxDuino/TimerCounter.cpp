@@ -1,6 +1,7 @@
 #include "configs.h"
 #include "Arduino.h"
 #include "TimerCounter.h"
+#include "hwconfig.h"
 
 /*
  *  Interrupt and PWM utilities for 16 bit Timer1 on ATmega168/328
@@ -9,83 +10,369 @@
 
 timerCallback isrCallback = NULL;
 
-#if defined(__arm__) && defined(__STM32F1__)
+#if !defined(ESP32)
+// A period longer than the timer can count in one go (a long pause, say)
+// runs as pieces of up to TIMER_LONG_PIECE: setPeriod starts the first, and
+// the timer's own interrupt the rest, only calling back into the isr once
+// the whole period is up.  (The ESP32 timers count far enough already.)
+#define TIMER_LONG_PIECE 1000000UL
+volatile unsigned long longRest = 0;    // us of the period still to run after this piece
+
+ISR_CODE unsigned long long_piece(unsigned long microseconds)
+{
+  // the piece of microseconds to run now; no piece is under half
+  // TIMER_LONG_PIECE, so the last one isn't cut too short to time
+  longRest = 0;
+  if (microseconds <= TIMER_LONG_PIECE)
+    return microseconds;
+  unsigned long n = TIMER_LONG_PIECE;
+  if (microseconds < 2*TIMER_LONG_PIECE)
+    n = microseconds / 2;
+  longRest = microseconds - n;
+  return n;
+}
+
+ISR_CODE bool long_next()
+{
+  // in the timer interrupt: true if it was only the end of a piece, and
+  // the next one has been started
+  if (longRest == 0)
+    return false;
+  Timer.setPeriod(longRest);
+  return true;
+}
+#endif
+
+#ifdef AVR_FAST_ISR
+// The timer interrupt plays the common edges itself, in assembly: a plain
+// period or the first half of a pulse pair, mid page, with no repeat, long
+// period or prescaler on the go.  It only saves the few registers it uses,
+// and keeps the read position and the level in GPIOR1 and GPIOR2 (readpos
+// and pinState are those registers, see buffer.h and isr.h) so they take a
+// single in/out.  Anything else goes on to the full handler, which calls the
+// isr as before and then leaves GPIOR0 bit 0 set if the next edge may be
+// tried the fast way.  Changing the prescaler, stopping or starting the
+// timer clear it.
+#if !defined(__AVR_ATmega328P__) && !defined(__AVR_ATmega4809__) && !defined(__AVR_ATmega4808__)
+  #error AVR_FAST_ISR is for the 328P and the 4808/4809
+#endif
+#if defined(OUTPUT_STATS) || defined(EDGE_VERIFY) || defined(PROFILE) || defined(RAM_WATCH)
+  #error AVR_FAST_ISR skips the hooks of OUTPUT_STATS, EDGE_VERIFY, PROFILE and RAM_WATCH
+#endif
+#if BUFFER_PAGE_MAX > 255
+  #error AVR_FAST_ISR keeps readpos in one byte
+#endif
+#ifndef OUTPUT_REG
+  #error AVR_FAST_ISR needs OUTPUT_REG and OUTPUT_BIT (pinSetup.h) for the output pin
+#endif
+#include "buffer.h"
+#include "isr.h"
+#include "pinSetup.h"
+#include "motorsense.h"
+#define FAST_ARMED GPIOR0
+
+inline bool fast_next(bool clockOk)
+{
+  // may the next edge go the fast way (plain periods and pulse pairs mean what they do to wave2)
+  return clockOk && longRest == 0 && repeatRemaining == 0 && isrCallback == wave2
+#ifdef Use_c64
+    && !c64Stream                            // 1aaaaaaa... is a C64 half-wave pair, not a pulse pair
+#endif
+    ;
+}
+
+// the start of the fast path, the same on both: r23-r25 and Z (and SREG)
+// saved, nothing playing the slow way, then Z at the word and r25:r24
+// (high:low) the word itself, and the plain ones moved past
+#define FAST_ISR_HEAD \
+  "sbis %[armed], 0\n\t" \
+  "jmp " FAST_FULL "\n\t" \
+  "push r24\n\t" \
+  "in r24, __SREG__\n\t" \
+  "push r24\n\t" \
+  "push r23\n\t" \
+  "push r25\n\t" \
+  "push r30\n\t" \
+  "push r31\n\t" \
+  FAST_ISR_HOLD \
+  "lds r24, %[stopped]\n\t" \
+  "tst r24\n\t" \
+  "brne 8f\n\t" \
+  "in r23, %[pos]\n\t"             /* readpos < buffsize-2: the word, and the next, are on this page */ \
+  "lds r24, %[size]\n\t" \
+  "subi r24, 2\n\t" \
+  "cp r23, r24\n\t" \
+  "brsh 8f\n\t" \
+  "lds r30, %[buf]\n\t" \
+  "lds r31, %[buf]+1\n\t" \
+  "add r30, r23\n\t" \
+  "brcc 1f\n\t" \
+  "inc r31\n\t" \
+  "1:\n\t" \
+  "ld r25, Z\n\t" \
+  "ldd r24, Z+1\n\t" \
+  "cpi r25, %[limit]\n\t" \
+  "brlo 2f\n\t" \
+  "mov r23, r25\n\t"               /* 111ppppp: a pulse pair, left as a plain p for its second edge */ \
+  "andi r23, 0xE0\n\t" \
+  "cpi r23, 0xE0\n\t" \
+  "brne 8f\n\t" \
+  "andi r25, 0x1F\n\t" \
+  "cpi r25, %[limit]\n\t" \
+  "brsh 8f\n\t" \
+  "st Z, r25\n\t" \
+  "rjmp 3f\n\t" \
+  "2:\n\t"                         /* a plain period, not 0 */ \
+  "mov r23, r25\n\t" \
+  "or r23, r24\n\t" \
+  "breq 8f\n\t" \
+  "in r23, %[pos]\n\t" \
+  "subi r23, -2\n\t" \
+  "out %[pos], r23\n\t" \
+  "3:\n\t"
+
+// the end of it: the edge, then back (or on to the full handler from 8:)
+#define FAST_ISR_TAIL \
+  "in r23, %[level]\n\t" \
+  "tst r23\n\t" \
+  "brne 4f\n\t" \
+  "ldi r23, 1\n\t" \
+  "out %[level], r23\n\t" \
+  "sbi %[port], %[bit]\n\t" \
+  "rjmp 5f\n\t" \
+  "4:\n\t" \
+  "clr r23\n\t" \
+  "out %[level], r23\n\t" \
+  "cbi %[port], %[bit]\n\t" \
+  "5:\n\t" \
+  "pop r31\n\t" \
+  "pop r30\n\t" \
+  "pop r25\n\t" \
+  "pop r23\n\t" \
+  "pop r24\n\t" \
+  "out __SREG__, r24\n\t" \
+  "pop r24\n\t" \
+  "reti\n\t" \
+  "8:\n\t" \
+  "pop r31\n\t" \
+  "pop r30\n\t" \
+  "pop r25\n\t" \
+  "pop r23\n\t" \
+  "pop r24\n\t" \
+  "out __SREG__, r24\n\t" \
+  "pop r24\n\t" \
+  "jmp " FAST_FULL "\n\t"
+
+#ifdef MOTOR_IRQ
+  #define FAST_ISR_HOLD "lds r24, %[hold]\n\t" "tst r24\n\t" "brne 8f\n\t"
+  #define FAST_ISR_HOLD_ARG [hold] "i" (&motorHold),
+#else
+  #define FAST_ISR_HOLD
+  #define FAST_ISR_HOLD_ARG
+#endif
+
+#define FAST_ISR_ARGS \
+  [armed] "I" (_SFR_IO_ADDR(FAST_ARMED)), \
+  [pos] "I" (_SFR_IO_ADDR(GPIOR1)), \
+  [level] "I" (_SFR_IO_ADDR(GPIOR2)), \
+  [port] "I" (_SFR_IO_ADDR(OUTPUT_REG)), \
+  [bit] "I" (OUTPUT_BIT), \
+  FAST_ISR_HOLD_ARG \
+  [stopped] "i" (&isStopped), \
+  [size] "i" (&buffsize), \
+  [buf] "i" (&readBuffer)
+#endif // AVR_FAST_ISR
+
+#if defined(__arm__) && defined(__STM32F1__) && defined(TIM1_OUTPUT)
+
+// TIM1's compare unit drives the output pin (PA9, which is TIM1_CH2) itself,
+// the way OC1A_OUTPUT does on the 328P: each update (the counter wrapping
+// to 0) is a match with CCR2 = 0, which sets or clears the pin in hardware,
+// so an edge lands on the timer clock however late the interrupt that
+// follows is.  ARR and PSC are preloaded, so the update also starts the
+// length the interrupt before left for it; the interrupt then only calls
+// wave2 for the edge after and leaves its level (WRITE_HIGH/WRITE_LOW set
+// tim1Level, see pinSetup.h) in OC2M and its length in ARR and PSC.  So
+// wave2 runs one edge ahead of the pin, and the first period from
+// initialize() is played twice (at the level the pin is at).
+#include "pinSetup.h"
+#ifdef FANOUT_PINS
+  #error TIM1_OUTPUT drives PA9 alone, so not FANOUT_PINS as well
+#endif
+
+#define TIM1_REGS TIMER1->regs.adv
+#define OC2M_ACTIVE    (0b001 << 12)    // OC2REF set at the match
+#define OC2M_INACTIVE  (0b010 << 12)    // cleared at the match
+#define OC2M_FORCE_HI  (0b101 << 12)
+#define OC2M_FORCE_LO  (0b100 << 12)
+#define OC2M_MASK      (0b111 << 12)
+
+volatile byte tim1Level = LOW;
+volatile unsigned long ocNext = 0;      // us of the level after the one that's loaded
+
+TimerCounter::TimerCounter() {};
+
+static void tim1_load(unsigned long microseconds)
+{
+  // the length of the next update's level: taken up at that update, with
+  // the prescaler and all, so what's counting now isn't rescaled
+  const unsigned long ticks = microseconds ? microseconds * (F_CPU / 1000000) : 1;
+  const unsigned long prescale = (ticks - 1) >> 16;   // +1 divides it into 16 bits
+  const unsigned long count = ticks / (prescale + 1);
+  TIM1_REGS->PSC = prescale;
+  TIM1_REGS->ARR = count ? count - 1 : 0;
+}
+
+static inline void tim1_level(byte level, bool force)
+{
+  TIM1_REGS->CCMR1 = (TIM1_REGS->CCMR1 & ~OC2M_MASK) |
+    (force ? (level ? OC2M_FORCE_HI : OC2M_FORCE_LO) : (level ? OC2M_ACTIVE : OC2M_INACTIVE));
+}
+
+static void tim1_update()
+{
+  // the update has just set the pin (and started the length loaded for it): load the next
+  if (longRest) {
+    tim1_load(long_piece(longRest));   // the same level again while a long period runs in pieces
+    return;
+  }
+  if (isrCallback)
+    (*isrCallback)();
+  else
+    ocNext = 1000;
+  tim1_load(long_piece(ocNext));
+  tim1_level(tim1Level, false);
+}
+
+void TimerCounter::initialize(unsigned long microseconds)
+{
+  TIM1_REGS->CR1 = TIMER_CR1_ARPE | TIMER_CR1_URS;    // stopped; only the counter wrapping is an update interrupt
+  TIM1_REGS->DIER = 0;
+  tim1_level(tim1Level, true);          // at the level the pin is at now, before it's handed over
+  TIM1_REGS->CCR2 = 0;
+  TIM1_REGS->CCER |= TIMER_CCER_CC2E;
+  TIM1_REGS->BDTR |= TIMER_BDTR_MOE;
+  gpio_set_mode(GPIOA, 9, GPIO_AF_OUTPUT_PP);
+  longRest = 0;
+  ocNext = microseconds;
+  tim1_load(long_piece(microseconds));
+  TIM1_REGS->EGR = TIMER_EGR_UG;        // into ARR and PSC, from 0
+  TIM1_REGS->SR = 0;
+  tim1_level(tim1Level, false);
+  TIM1_REGS->CR1 |= TIMER_CR1_CEN;
+}
+
+void TimerCounter::setPeriod(unsigned long microseconds)
+{
+  ocNext = microseconds;                // starts at the update after next
+}
+
+void TimerCounter::stop()
+{
+  TIM1_REGS->CR1 &= ~TIMER_CR1_CEN;
+  TIM1_REGS->DIER = 0;
+  gpio_set_mode(GPIOA, 9, GPIO_OUTPUT_PP);   // back to the ODR, which WRITE_HIGH/WRITE_LOW kept alongside
+  longRest = 0;
+}
+
+void TimerCounter::attachInterrupt(timerCallback isr)
+{
+  isrCallback = isr;
+  TIM1_REGS->SR = 0;
+  timer_attach_interrupt(TIMER1, TIMER_UPDATE_INTERRUPT, tim1_update);
+  // above the rest, as with TIM2 below
+  nvic_irq_set_priority(NVIC_TIMER1_UP, 0);
+}
+
+#elif defined(__arm__) && defined(__STM32F1__)
 //clase derivada
 class HwTimerCounter:public HardwareTimer
 {
+  private:
+    uint32 _current_prescale = 0;
+
+    void setPrescale(uint32 factor) __attribute__((always_inline)) {
+      // the prescaler only changes for the odd very long period, so skip
+      // rewriting it for the usual run of normal pulses
+      if (factor != _current_prescale) {
+        _current_prescale = factor;
+        this->setPrescaleFactor(factor);
+      }
+    }
+
   public:
     HwTimerCounter(uint8 timerNum) : HardwareTimer(timerNum) {};
     void setSTM32Period(unsigned long microseconds) __attribute__((always_inline)) {
       
 /*    if (microseconds < 65536/36) {
-      this->setPrescaleFactor(F_CPU/1000000/36);
+      this->setPrescale(F_CPU/1000000/36);
       this->setOverflow(microseconds*36);
     }else
     if (microseconds < 65536/18) {
-      this->setPrescaleFactor(F_CPU/1000000/18);
+      this->setPrescale(F_CPU/1000000/18);
       this->setOverflow(microseconds*18);
     }else */
     if (microseconds < 65536/24) {
-      this->setPrescaleFactor(F_CPU/1000000/24);
+      this->setPrescale(F_CPU/1000000/24);
       this->setOverflow(microseconds*24);
     }else    
 /*    if (microseconds < 65536/16) {
-      this->setPrescaleFactor(F_CPU/1000000/16);
+      this->setPrescale(F_CPU/1000000/16);
       this->setOverflow(microseconds*16);
     }else */
     if (microseconds < 65536/8) {
-      this->setPrescaleFactor(F_CPU/1000000/8);
+      this->setPrescale(F_CPU/1000000/8);
       this->setOverflow(microseconds*8);
     }else
     if (microseconds < 65536/4) {
-      this->setPrescaleFactor(F_CPU/1000000/4);
+      this->setPrescale(F_CPU/1000000/4);
       this->setOverflow(microseconds*4);
     }else
     if (microseconds < 65536/2) {
-      this->setPrescaleFactor(F_CPU/1000000/2);
+      this->setPrescale(F_CPU/1000000/2);
       this->setOverflow(microseconds*2);
     }else
     if (microseconds < 65536) {
-      this->setPrescaleFactor(F_CPU/1000000);
+      this->setPrescale(F_CPU/1000000);
       this->setOverflow(microseconds);
     }else
     if (microseconds < 65536*2) {
-      this->setPrescaleFactor(F_CPU/1000000*2);
+      this->setPrescale(F_CPU/1000000*2);
       this->setOverflow(microseconds/2);
     }else
     if (microseconds < 65536*4) {
-      this->setPrescaleFactor(F_CPU/1000000*4);
+      this->setPrescale(F_CPU/1000000*4);
       this->setOverflow(microseconds/4);
     }else
     if (microseconds < 65536*8) {
-      this->setPrescaleFactor(F_CPU/1000000*8);
+      this->setPrescale(F_CPU/1000000*8);
       this->setOverflow(microseconds/8);
     }else
 /*    if (microseconds < 65536*16) {
-      this->setPrescaleFactor(F_CPU/1000000*16);
+      this->setPrescale(F_CPU/1000000*16);
       this->setOverflow(microseconds/16);
     }else
     if (microseconds < 65536*32) {
-      this->setPrescaleFactor(F_CPU/1000000*32);
+      this->setPrescale(F_CPU/1000000*32);
       this->setOverflow(microseconds/32);
     }else */
     if (microseconds < 65536*64) {
-      this->setPrescaleFactor(F_CPU/1000000*64);
+      this->setPrescale(F_CPU/1000000*64);
       this->setOverflow(microseconds/64);
     }else
 /*    if (microseconds < 65536*128) {
-      this->setPrescaleFactor(F_CPU/1000000*128);
+      this->setPrescale(F_CPU/1000000*128);
       this->setOverflow(microseconds/128);
     }else
     if (microseconds < 65536*256) {
-      this->setPrescaleFactor(F_CPU/1000000*256);
+      this->setPrescale(F_CPU/1000000*256);
       this->setOverflow(microseconds/256);
     }else */
     if (microseconds < 65536*512) {                                    
-      this->setPrescaleFactor(F_CPU/1000000*512);
+      this->setPrescale(F_CPU/1000000*512);
       this->setOverflow(microseconds/512);
     }else {                           
-      this->setPrescaleFactor(F_CPU/1000000*512);
+      this->setPrescale(F_CPU/1000000*512);
       this->setOverflow(65535);      
     }
     this->refresh();
@@ -100,6 +387,7 @@ TimerCounter::TimerCounter() {};
 void TimerCounter::stop()
 {
   timer_instance.pause();
+  longRest = 0;
 }
 
 void TimerCounter::initialize(unsigned long period)
@@ -110,13 +398,23 @@ void TimerCounter::initialize(unsigned long period)
 
 void TimerCounter::setPeriod(unsigned long period)
 {
-  timer_instance.setSTM32Period(period);
+  timer_instance.setSTM32Period(long_piece(period));
+}
+
+void onTimer()
+{
+  if (!long_next() && isrCallback)
+    (*isrCallback)();
 }
 
 void TimerCounter::attachInterrupt(timerCallback isr)
 {
   // behaviour of other timers is to attach interrupt and resume
-  timer_instance.attachInterrupt(TIMER_CHANNEL, isr);
+  isrCallback = isr;
+  timer_instance.attachInterrupt(TIMER_CHANNEL, onTimer);
+  // libmaple starts every interrupt at the lowest priority (15): the
+  // playback timer goes above the lot, so irq_mask() leaves it running
+  nvic_irq_set_priority(NVIC_TIMER2, 0);
   timer_instance.resume();
 }
 
@@ -125,12 +423,30 @@ void TimerCounter::attachInterrupt(timerCallback isr)
 #define TIMER1_RESOLUTION 65536UL  // Timer1 is 16 bit
 
 unsigned long _current_microseconds;
+unsigned char _current_ctrla;  // clock select | enable last written to CTRLA (0 = stopped)
 TimerCounter::TimerCounter()
 {
     _current_microseconds = 0;
+    _current_ctrla = 0;
+}
+
+static inline void set_ctrla(unsigned char ctrla) {
+    // only touch CTRLA when the prescaler (or the enable bit) actually changes
+    if (ctrla != _current_ctrla) {
+        _current_ctrla = ctrla;
+        TCA0.SINGLE.CTRLA = ctrla;
+#ifdef AVR_FAST_ISR
+        FAST_ARMED = 0;
+#endif
+    }
 }
 
 void TimerCounter::initialize(unsigned long microseconds) {
+#ifdef AVR_FAST_ISR
+    FAST_ARMED = 0;
+#endif
+    _current_ctrla = 0;
+    _current_microseconds = 0;
     // turn off split mode (enabled at startup on TCA0 for MegaCoreX).
     // Ensure timer is stopped for this:
     TCA0.SINGLE.CTRLA &= ~(TCA_SINGLE_ENABLE_bm);     //stop the timer   
@@ -154,6 +470,7 @@ void TimerCounter::setPeriod(unsigned long microseconds) {
     unsigned short pwmPeriod;
     unsigned char clockSelectBits;
 
+    microseconds = long_piece(microseconds);
     if (_current_microseconds == microseconds)
     {
         // nothing to do - timer is already set for the correct
@@ -164,6 +481,13 @@ void TimerCounter::setPeriod(unsigned long microseconds) {
 
     _current_microseconds = microseconds;
 
+    if (microseconds < TIMER1_RESOLUTION / (F_CPU / 1000000)) {
+      // fast path for normal pulses: no prescaler, 16 bit arithmetic only
+      TCA0.SINGLE.PER = (unsigned short)microseconds * (unsigned short)(F_CPU / 1000000);
+      set_ctrla(TCA_SINGLE_CLKSEL_DIV1_gc | TCA_SINGLE_ENABLE_bm);
+      return;
+    }
+
     //DSBOTTOM: the counter runs backwards after TOP, interrupt is at BOTTOM so divide microseconds by 2
     //const unsigned long cycles = (F_CPU / 1000000) * microseconds;
 
@@ -229,7 +553,7 @@ void TimerCounter::setPeriod(unsigned long microseconds) {
     TCA0.SINGLE.PER = pwmPeriod;
     //TCA0.SINGLE.PER = cycles / 64;
                                         // set clock source and start timer
-    TCA0.SINGLE.CTRLA = clockSelectBits | TCA_SINGLE_ENABLE_bm;
+    set_ctrla(clockSelectBits | TCA_SINGLE_ENABLE_bm);
 }
 
 void TimerCounter::stop() {
@@ -237,6 +561,12 @@ void TimerCounter::stop() {
     //TCA0.SINGLE.CTRLB=TCA_SINGLE_WGMODE_NORMAL_gc;
     //TCA0.SINGLE.CTRLA =0;
     TCA0.SINGLE.CTRLA &= ~(TCA_SINGLE_ENABLE_bm);
+    _current_ctrla = 0;
+    _current_microseconds = 0;
+    longRest = 0;
+#ifdef AVR_FAST_ISR
+    FAST_ARMED = 0;
+#endif
 }
 
 void TimerCounter::attachInterrupt(timerCallback isr) {
@@ -246,27 +576,219 @@ void TimerCounter::attachInterrupt(timerCallback isr) {
     TCA0.SINGLE.INTCTRL |= TCA_SINGLE_OVF_bm;
 }
 
+#ifdef AVR_FAST_ISR
+#if F_CPU != 16000000L
+  #error AVR_FAST_ISR works out the period as us*16 (a 16MHz clock)
+#endif
+
+#define FAST_FULL "__vector_tca0_full"
+extern "C" void __vector_tca0_full() __attribute__((signal, used, externally_visible));
+void __vector_tca0_full()
+{
+  if (!long_next() && isrCallback)
+    (*isrCallback)();
+  /* The interrupt flag has to be cleared manually */
+  TCA0.SINGLE.INTFLAGS = TCA_SINGLE_OVF_bm;
+  FAST_ARMED = fast_next(_current_ctrla == (TCA_SINGLE_CLKSEL_DIV1_gc | TCA_SINGLE_ENABLE_bm));
+}
+
+ISR(TCA0_OVF_vect, ISR_NAKED)
+{
+  // PER = us*16, low byte first, and _current_microseconds to match for setPeriod
+  asm volatile(
+    FAST_ISR_HEAD
+    "ldi r23, %[ovf]\n\t"
+    "sts %[flags], r23\n\t"
+    "sts %[cur], r24\n\t"
+    "sts %[cur]+1, r25\n\t"
+    "clr r23\n\t"
+    "sts %[cur]+2, r23\n\t"
+    "sts %[cur]+3, r23\n\t"
+    ".rept 4\n\t"
+    "lsl r24\n\t"
+    "rol r25\n\t"
+    ".endr\n\t"
+    "sts %[per], r24\n\t"
+    "sts %[per]+1, r25\n\t"
+    FAST_ISR_TAIL
+    :: FAST_ISR_ARGS,
+    [limit] "M" (0x10),          // under 4096us: no prescaler
+    [ovf] "M" (TCA_SINGLE_OVF_bm),
+    [flags] "n" (_SFR_MEM_ADDR(TCA0_SINGLE_INTFLAGS)),
+    [per] "n" (_SFR_MEM_ADDR(TCA0_SINGLE_PER)),
+    [cur] "i" (&_current_microseconds)
+  );
+}
+#else
 ISR(TCA0_OVF_vect)
 {
-  if (isrCallback)
+  if (!long_next() && isrCallback)
     (*isrCallback)();
   /* The interrupt flag has to be cleared manually */
   TCA0.SINGLE.INTFLAGS = TCA_SINGLE_OVF_bm;
 }  
+#endif
+
+#elif defined(__AVR_ATmega328P__) && defined(OC1A_OUTPUT)
+
+// Timer1's compare unit drives the output pin (9, which is OC1A) itself: in
+// CTC mode each match with OCR1A sets or clears it, in hardware, so an edge
+// lands on the timer clock however late the interrupt that follows is
+// (a noInterrupts() in the main loop, another interrupt).  The interrupt
+// then only gets ready for the next match: it gives the level that has just
+// been set its length, and calls wave2 for the edge after, whose level
+// (WRITE_HIGH/WRITE_LOW set ocLevel, see pinSetup.h) is set or cleared at
+// the next match, and whose period setPeriod keeps until then.  So wave2
+// runs one edge ahead of the pin, and the first period from initialize()
+// is played twice (at the level the pin is at).
+#include "pinSetup.h"
+#if defined(AVR_FAST_ISR)
+  #error OC1A_OUTPUT has an interrupt of its own, so not AVR_FAST_ISR as well
+#endif
+#ifndef OC1A_PIN_OK
+  #error OC1A_OUTPUT needs the output on pin 9 (OC1A)
+#endif
+
+#define TIMER1_RESOLUTION 65536UL  // Timer1 is 16 bit
+#define TIMER1_FAST_MAX_US (TIMER1_RESOLUTION / (F_CPU / 1000000))   // no prescaler (4ms at 16MHz)
+
+volatile byte ocLevel = LOW;
+volatile unsigned long ocNext = 0;       // us of the level set at the next match
+static unsigned char _current_clock_select = 0;
+
+TimerCounter::TimerCounter(){};
+
+static void oc_program(unsigned long microseconds)
+{
+  // the length of what's playing now, counted from the match just gone
+  unsigned char clockSelectBits;
+  unsigned long ticks;
+  if (microseconds < TIMER1_FAST_MAX_US) {
+    clockSelectBits = _BV(CS10);
+    ticks = microseconds * (F_CPU / 1000000);
+  } else {
+    const unsigned long cycles = (F_CPU / 1000000) * microseconds;
+    if (cycles < TIMER1_RESOLUTION * 8) {
+      clockSelectBits = _BV(CS11);
+      ticks = cycles / 8;
+    } else if (cycles < TIMER1_RESOLUTION * 64) {
+      clockSelectBits = _BV(CS11) | _BV(CS10);
+      ticks = cycles / 64;
+    } else if (cycles < TIMER1_RESOLUTION * 256) {
+      clockSelectBits = _BV(CS12);
+      ticks = cycles / 256;
+    } else {
+      clockSelectBits = _BV(CS12) | _BV(CS10);
+      ticks = (cycles < TIMER1_RESOLUTION * 1024) ? cycles / 1024 : TIMER1_RESOLUTION;
+    }
+  }
+  OCR1A = ticks ? ticks - 1 : 0;
+  if (clockSelectBits != _current_clock_select) {
+    // a new prescaler would scale what's been counted since the match as well
+    _current_clock_select = clockSelectBits;
+    TCNT1 = 0;
+    TCCR1B = _BV(WGM12) | clockSelectBits;
+  } else if (TCNT1 >= OCR1A) {
+    // (too short to have been ready for) the match is the next tick
+    TCNT1 = OCR1A ? OCR1A - 1 : 0;
+  }
+}
+
+static inline void oc_preload(byte level)
+{
+  // set (or clear) OC1A at the next match
+  TCCR1A = level ? (_BV(COM1A1) | _BV(COM1A0)) : _BV(COM1A1);
+}
+
+void TimerCounter::initialize(unsigned long microseconds) {
+    TCCR1B = 0;                 // stop the timer
+    _current_clock_select = 0;
+    oc_preload(ocLevel);        // connected, and at the level the pin is at now
+    TCCR1C = _BV(FOC1A);
+    TCNT1 = 0;
+    longRest = 0;
+    ocNext = microseconds;
+    oc_program(long_piece(microseconds));
+}
+
+void TimerCounter::setPeriod(unsigned long microseconds) {
+    ocNext = microseconds;      // starts at the next match
+}
+
+void TimerCounter::stop() {
+    TCCR1B = 0;
+    TCCR1A = 0;                 // the pin goes back to PORTB, which WRITE_HIGH/WRITE_LOW kept alongside
+    TIMSK1 = 0;
+    _current_clock_select = 0;
+    longRest = 0;
+}
+
+void TimerCounter::attachInterrupt(timerCallback isr) {
+    isrCallback = isr;
+    TIFR1 = _BV(OCF1A);
+    TIMSK1 = _BV(OCIE1A);
+}
+
+ISR(TIMER1_COMPA_vect)
+{
+  // the match has just set the pin: how long it stays, then the next edge
+  oc_program(long_piece(longRest ? longRest : ocNext));
+  if (longRest == 0) {
+    if (isrCallback)
+      (*isrCallback)();
+    else
+      ocNext = 1000;
+  }
+  oc_preload(ocLevel);          // (the same level again while a long period runs in pieces)
+}
 
 #elif defined(__AVR_ATmega328P__) || defined ( __AVR_ATmega2560__) || defined(__AVR_ATmega32U4__)
+#ifdef OC1A_OUTPUT
+  #error OC1A_OUTPUT is for the 328P (its output, pin 9, is OC1A)
+#endif
 
 #define TIMER1_RESOLUTION 65536UL  // Timer1 is 16 bit
 
+// Longest period (in microseconds) that fits in ICR1 with no prescaler.
+// At 16MHz this is 8ms, which covers practically every data/pilot/sync pulse,
+// so the ISR can skip the 32 bit multiply and prescaler cascade for those.
+#define TIMER1_FAST_MAX_US (TIMER1_RESOLUTION / (F_CPU / 2000000))
+
+static unsigned char _current_clock_select = 0;  // CS1x bits last written to TCCR1B (0 = stopped)
+
 TimerCounter::TimerCounter(){};
 
+static inline void set_clock_select(unsigned char clockSelectBits) {
+    // only rewrite TCCR1B when the prescaler actually changes
+    if (clockSelectBits != _current_clock_select) {
+      _current_clock_select = clockSelectBits;
+      TCCR1B = _BV(WGM13) | clockSelectBits; // starts the timer
+#ifdef AVR_FAST_ISR
+      FAST_ARMED = 0;
+#endif
+    }
+}
+
 void TimerCounter::initialize(unsigned long microseconds) {
+#ifdef AVR_FAST_ISR
+    FAST_ARMED = 0;
+#endif
     TCCR1B = _BV(WGM13);        // set mode as phase and frequency correct pwm, stop the timer
     TCCR1A = 0;                 // clear control register A 
+    _current_clock_select = 0;
     setPeriod(microseconds);
 }
 
 void TimerCounter::setPeriod(unsigned long microseconds) {
+    if (microseconds < TIMER1_FAST_MAX_US) {
+      longRest = 0;
+      // fast path: 16 bit arithmetic only
+      ICR1 = (unsigned short)microseconds * (unsigned short)(F_CPU / 2000000);
+      set_clock_select(_BV(CS10));
+      return;
+    }
+
+    microseconds = long_piece(microseconds);
     const unsigned long cycles = (F_CPU / 2000000) * microseconds;
     unsigned short pwmPeriod;
     unsigned char clockSelectBits;
@@ -295,11 +817,16 @@ void TimerCounter::setPeriod(unsigned long microseconds) {
     pwmPeriod = TIMER1_RESOLUTION - 1;
     }
     ICR1 = pwmPeriod;
-    TCCR1B = _BV(WGM13) | clockSelectBits; // starts the timer
+    set_clock_select(clockSelectBits);
 }
 
 void TimerCounter::stop() {
     TCCR1B = _BV(WGM13);
+    _current_clock_select = 0;
+    longRest = 0;
+#ifdef AVR_FAST_ISR
+    FAST_ARMED = 0;
+#endif
 }
 
 void TimerCounter::attachInterrupt(timerCallback isr) {
@@ -307,11 +834,46 @@ void TimerCounter::attachInterrupt(timerCallback isr) {
     TIMSK1 = _BV(TOIE1);
 }
 
+#ifdef AVR_FAST_ISR
+#if !defined(__AVR_ATmega328P__) || (F_CPU != 16000000L && F_CPU != 8000000L)
+  #error AVR_FAST_ISR works out the period as a shift of us (a 16 or 8MHz 328P)
+#endif
+
+#define FAST_FULL "__vector_timer1_full"
+extern "C" void __vector_timer1_full() __attribute__((signal, used, externally_visible));
+void __vector_timer1_full()
+{
+  if (!long_next() && isrCallback)
+    (*isrCallback)();
+  FAST_ARMED = fast_next(_current_clock_select == _BV(CS10));
+}
+
+ISR(TIMER1_OVF_vect, ISR_NAKED)
+{
+  // ICR1 = us*(F_CPU/2000000), as setPeriod's fast path, high byte first
+  asm volatile(
+    FAST_ISR_HEAD
+    ".rept %[shift]\n\t"
+    "lsl r24\n\t"
+    "rol r25\n\t"
+    ".endr\n\t"
+    "sts %[icrh], r25\n\t"
+    "sts %[icrl], r24\n\t"
+    FAST_ISR_TAIL
+    :: FAST_ISR_ARGS,
+    [limit] "M" (TIMER1_FAST_MAX_US >> 8),
+    [shift] "M" (F_CPU == 16000000L ? 3 : 2),
+    [icrh] "n" (_SFR_MEM_ADDR(ICR1H)),
+    [icrl] "n" (_SFR_MEM_ADDR(ICR1L))
+  );
+}
+#else
 ISR(TIMER1_OVF_vect)
 {
-  if (isrCallback)
+  if (!long_next() && isrCallback)
     (*isrCallback)();
 }
+#endif
 
 #elif defined(__SAMD21__)
   // The following, including the MyTC3Timer class, is a modified version of SAMDTimer (from SAMD_TimerInterrupt)
@@ -325,7 +887,71 @@ ISR(TIMER1_OVF_vect)
   // the same logic as SAMD_TimerInterrupt, and therefore also cannot be used by this project...
   
   static timerCallback TC3_callback;
-  
+
+#ifdef DAC_OUTPUT
+  #include "pinSetup.h"
+
+  // An edge from wave2 (WRITE_HIGH/WRITE_LOW) starts a ramp on the DAC:
+  // the first step goes out straight away, and TC3 then ticks every
+  // DAC_SLEW_US through the rest before handing whatever is left of the
+  // period wave2 asked for back to the timer.
+  word dacLevel = DAC_OUTPUT_LOW;
+  word dacFrom;
+  word dacTarget;
+  byte dacStep = 0;               // steps of the current ramp written so far, 0 = none running
+  bool dacRampOn = false;         // only while TC3 is running, so edges from the main loop are immediate
+  unsigned long dacRest;          // us of the period still to go after the ramp
+  unsigned long _requested_microseconds;
+
+  void dac_write(word level)
+  {
+    while (DAC->STATUS.bit.SYNCBUSY);
+    DAC->DATA.reg = level;
+    dacLevel = level;
+  }
+
+  void dac_init()
+  {
+    analogWriteResolution(10);
+    analogWrite(outputPin, DAC_OUTPUT_LOW);   // sets up and enables the DAC
+    dacLevel = DAC_OUTPUT_LOW;
+    dacStep = 0;
+  }
+
+  void dac_edge(word level)
+  {
+    if (DAC_SLEW_STEPS == 0 || !dacRampOn || level == dacLevel)
+    {
+      dac_write(level);
+      dacStep = 0;
+      return;
+    }
+    dacFrom = dacLevel;
+    dacTarget = level;
+    dacStep = 1;
+    dac_write(dacFrom + ((int)dacTarget - (int)dacFrom) / DAC_SLEW_STEPS);
+  }
+
+  bool dac_ramp_tick()
+  {
+    // the next step of a running ramp, true if this tick was one
+    if (dacStep == 0)
+      return false;
+    dacStep++;
+    if (dacStep >= DAC_SLEW_STEPS)
+    {
+      dac_write(dacTarget);
+      dacStep = 0;
+      Timer.setPeriod(dacRest);
+    }
+    else
+    {
+      dac_write(dacFrom + ((int)dacTarget - (int)dacFrom) * dacStep / DAC_SLEW_STEPS);
+    }
+    return true;
+  }
+#endif
+
   void TC3_Handler()
   {
     // get timer struct
@@ -334,8 +960,31 @@ ISR(TIMER1_OVF_vect)
     // If the compare register matching the timer count, trigger this interrupt
     if (TC->INTFLAG.bit.MC0 == 1) 
     {
-      if (TC3_callback)
+    #ifdef DAC_OUTPUT
+      if (!long_next() && !dac_ramp_tick() && TC3_callback)
+      {
         (*TC3_callback)();
+        if (dacStep)
+        {
+          // wave2 has started a ramp: run it first, out of the period it set
+          const unsigned long ramp = (unsigned long)(DAC_SLEW_STEPS - 1) * DAC_SLEW_US;
+          if (_requested_microseconds > ramp + 20)
+          {
+            dacRest = _requested_microseconds - ramp;
+            Timer.setPeriod(DAC_SLEW_US);
+          }
+          else
+          {
+            // too short an edge to ramp
+            dac_write(dacTarget);
+            dacStep = 0;
+          }
+        }
+      }
+    #else
+      if (!long_next() && TC3_callback)
+        (*TC3_callback)();
+    #endif
       TC->INTFLAG.bit.MC0 = 1; // write 1 here, to clear the interrupt tr
     }
   }
@@ -344,9 +993,11 @@ ISR(TIMER1_OVF_vect)
 #include "Arduino.h"
   
 unsigned long _current_microseconds;
+uint32_t _current_prescaler;
 TimerCounter::TimerCounter()
 {
   _current_microseconds = 0;
+  _current_prescaler = TC_CTRLA_PRESCALER_DIV1;
   TC3_callback = NULL;
 }
     
@@ -380,6 +1031,10 @@ void TimerCounter::initialize(unsigned long microseconds=1000)
 void TimerCounter::setPeriod(unsigned long microseconds)
 {
   TcCount16* _Timer = SAMD_TC3;
+#ifdef DAC_OUTPUT
+  _requested_microseconds = microseconds;   // all of it, for a ramp to come out of
+#endif
+  microseconds = long_piece(microseconds);
   if (_current_microseconds == microseconds)
   {
     // nothing to do - timer is already set for the correct
@@ -394,11 +1049,7 @@ void TimerCounter::setPeriod(unsigned long microseconds)
   {
     microseconds = 20;
   }
-  // 2. avoid wraparound for periods longer than the maximum permitted with the widest prescaler
-  if (microseconds > 1398080)
-  {
-    microseconds = 1398080;
-  }
+  // (long_piece keeps it under the 1398080us the widest prescaler can count)
   // if the adjusted microseconds matches what we previously configured
   // then again nothing to do, timer will repeat as planned
   if (_current_microseconds == microseconds)
@@ -407,63 +1058,75 @@ void TimerCounter::setPeriod(unsigned long microseconds)
   // otherwise, set new timer registers
   
   _current_microseconds = microseconds;
-  
-  bool ctrla_enabled = _Timer->CTRLA.reg & TC_CTRLA_ENABLE;
-  
-  _Timer->CTRLA.reg &= ~TC_CTRLA_ENABLE;
-  while (_Timer->STATUS.bit.SYNCBUSY);
-
-  _Timer->CTRLA.reg &= ~(TC_CTRLA_PRESCALER_DIV1024 | TC_CTRLA_PRESCALER_DIV256 | TC_CTRLA_PRESCALER_DIV64 | TC_CTRLA_PRESCALER_DIV16 | TC_CTRLA_PRESCALER_DIV8 | TC_CTRLA_PRESCALER_DIV4 | TC_CTRLA_PRESCALER_DIV2 | TC_CTRLA_PRESCALER_DIV1);
-  while (_Timer->STATUS.bit.SYNCBUSY);
 
   uint32_t cycles = (F_CPU/1000000) * microseconds;
+  uint32_t prescaler;
   if (cycles > (65535*256)) 
   {
     // Set prescaler to 1024
-    _Timer->CTRLA.reg |= TC_CTRLA_PRESCALER_DIV1024;
+    prescaler = TC_CTRLA_PRESCALER_DIV1024;
     cycles >>= 10;
   } 
   else if (cycles > (65535*64))
   {
     // Set prescaler to 256
-    _Timer->CTRLA.reg |= TC_CTRLA_PRESCALER_DIV256;
+    prescaler = TC_CTRLA_PRESCALER_DIV256;
     cycles >>= 8;
   } 
   else if (cycles > (65535*16))
   {
     // Set prescaler to 64
-    _Timer->CTRLA.reg |= TC_CTRLA_PRESCALER_DIV64;
+    prescaler = TC_CTRLA_PRESCALER_DIV64;
     cycles >>= 6;
   } 
   else if (cycles > (65535*8))
   {
     // Set prescaler to 16
-    _Timer->CTRLA.reg |= TC_CTRLA_PRESCALER_DIV16;
+    prescaler = TC_CTRLA_PRESCALER_DIV16;
     cycles >>= 4;
   } 
   else if (cycles > (65535*4))
   {
     // Set prescaler to 8
-    _Timer->CTRLA.reg |= TC_CTRLA_PRESCALER_DIV8;
+    prescaler = TC_CTRLA_PRESCALER_DIV8;
     cycles >>= 3;
   } 
   else if (cycles > (65535*2))
   {
     // Set prescaler to 4
-    _Timer->CTRLA.reg |= TC_CTRLA_PRESCALER_DIV4;
+    prescaler = TC_CTRLA_PRESCALER_DIV4;
     cycles >>= 2;
   } 
   else if (cycles > 65535)
   {
     // Set prescaler to 2
-    _Timer->CTRLA.reg |= TC_CTRLA_PRESCALER_DIV2;
+    prescaler = TC_CTRLA_PRESCALER_DIV2;
     cycles >>= 1;
   } 
   else
   {
     // Set prescaler to 1, cycles is unchanged
-    _Timer->CTRLA.reg |= TC_CTRLA_PRESCALER_DIV1;
+    prescaler = TC_CTRLA_PRESCALER_DIV1;
+  }
+
+  if (prescaler == _current_prescaler)
+  {
+    // prescaler didn't change, so just set the new compare value.
+    // This is the usual case (all normal pulses use DIV1) and avoids
+    // the disable/reconfigure/enable sequence and its SYNCBUSY waits
+    _Timer->CC[0].reg = cycles;
+    while (_Timer->STATUS.bit.SYNCBUSY);
+    return;
   }
+  _current_prescaler = prescaler;
+
+  bool ctrla_enabled = _Timer->CTRLA.reg & TC_CTRLA_ENABLE;
+  
+  _Timer->CTRLA.reg &= ~TC_CTRLA_ENABLE;
+  while (_Timer->STATUS.bit.SYNCBUSY);
+
+  _Timer->CTRLA.reg &= ~(TC_CTRLA_PRESCALER_DIV1024 | TC_CTRLA_PRESCALER_DIV256 | TC_CTRLA_PRESCALER_DIV64 | TC_CTRLA_PRESCALER_DIV16 | TC_CTRLA_PRESCALER_DIV8 | TC_CTRLA_PRESCALER_DIV4 | TC_CTRLA_PRESCALER_DIV2 | TC_CTRLA_PRESCALER_DIV1);
+  _Timer->CTRLA.reg |= prescaler;
   while (_Timer->STATUS.bit.SYNCBUSY);
 
   _Timer->CC[0].reg = cycles;
@@ -476,9 +1139,6 @@ void TimerCounter::setPeriod(unsigned long microseconds)
     while (_Timer->STATUS.bit.SYNCBUSY); // per datasheet, sync is not required when just setting the enabled bit
   }
 
-//    TODO: make this only disable/enable the timer (via CTRLA) if the prescaler actually changed
-//    (if prescaler didn't change, you could just set the new CC[0].reg , which should be super quick to do)
-
 //    TODO use the fancy code instead
 //      // Make sure the count is in a proportional position to where it was
 //      // to prevent any jitter or disconnect when changing the compare value.
@@ -520,13 +1180,46 @@ void TimerCounter::stop()
   SAMD_TC3->INTENCLR.reg = 0;
   SAMD_TC3->INTENCLR.bit.MC0 = 1;
   NVIC_DisableIRQ(TC3_IRQn);
+  longRest = 0;
+
+#ifdef DAC_OUTPUT
+  dacRampOn = false;
+  if (dacStep)
+  {
+    dac_write(dacTarget);
+    dacStep = 0;
+  }
+#endif
 
   interrupts();
 }
 
+static void set_priorities()
+{
+  // the core leaves most interrupts at 0, the top, alongside TC3: the ones
+  // that can take a while (USB, the SERCOMs for SD and the display, DMAC,
+  // pin changes) go down a level, under the playback timer.  SysTick is
+  // already at 2
+  NVIC_SetPriority(TC3_IRQn, 0);
+  NVIC_SetPriority(USB_IRQn, 1);
+  NVIC_SetPriority(DMAC_IRQn, 1);
+  NVIC_SetPriority(EIC_IRQn, 1);
+  NVIC_SetPriority(SERCOM0_IRQn, 1);
+  NVIC_SetPriority(SERCOM1_IRQn, 1);
+  NVIC_SetPriority(SERCOM2_IRQn, 1);
+  NVIC_SetPriority(SERCOM3_IRQn, 1);
+#ifdef SERCOM4
+  NVIC_SetPriority(SERCOM4_IRQn, 1);
+#endif
+#ifdef SERCOM5
+  NVIC_SetPriority(SERCOM5_IRQn, 1);
+#endif
+}
+
 void TimerCounter::attachInterrupt(timerCallback isr)
 {
   noInterrupts();
+  set_priorities();
 
   TcCount16* _Timer = SAMD_TC3;
 
@@ -535,6 +1228,9 @@ void TimerCounter::attachInterrupt(timerCallback isr)
   while (_Timer->STATUS.bit.SYNCBUSY);
   
   TC3_callback = isr;
+#ifdef DAC_OUTPUT
+  dacRampOn = true;
+#endif
   
   // Enable the compare interrupt
   SAMD_TC3->INTENSET.reg = 0;
@@ -548,9 +1244,190 @@ void TimerCounter::attachInterrupt(timerCallback isr)
   interrupts();
 }
 
+#elif defined(ESP32) && defined(RMT_OUTPUT)
+
+// The output pin belongs to the RMT, which plays level/duration items from
+// its own memory with hardware timing.  The driver's translator refills
+// half of that memory at a time from the RMT interrupt, and each edge it
+// needs comes from wave2() as usual: WRITE_HIGH/WRITE_LOW set rmtLevel,
+// and setPeriod() says how long it lasts.  So edge timing no longer
+// depends on how quickly an interrupt gets serviced, only on the refill
+// keeping ahead (24 items, i.e. 48 edges or more).
+#include "driver/rmt.h"
+#include "pinSetup.h"
+
+#define RMT_OUT_CHANNEL   RMT_CHANNEL_0
+#define RMT_MAX_TICKS     32767           // 15 bit duration, in us at clk_div 80
+#define RMT_ENDLESS       0x7FFFFFFF      // "samples" to ask for, the translator never runs out
+
+volatile byte rmtLevel = LOW;
+bool rmtInstalled = false;
+unsigned long rmtLeft = 0;                // us still to play at rmtLevel
+const byte rmtSource = 0;                 // the driver wants a buffer, the translator ignores it
+
+ISR_CODE void TimerCounter::setPeriod(unsigned long microseconds)
+{
+  rmtLeft = microseconds ? microseconds : 1;  // a 0 duration would end the transmission
+}
+
+ISR_CODE rmt_item32_t rmt_next_item()
+{
+  // two halves per item; a period longer than one half spans several
+  word d[2];
+  byte l[2];
+  for (byte h = 0; h < 2; h++)
+  {
+    if (rmtLeft == 0)
+    {
+      if (isrCallback)
+        (*isrCallback)();
+      else
+        rmtLeft = 1000;
+    }
+    d[h] = (rmtLeft > RMT_MAX_TICKS) ? RMT_MAX_TICKS : rmtLeft;
+    l[h] = rmtLevel;
+    rmtLeft -= d[h];
+  }
+  rmt_item32_t item;
+  item.duration0 = d[0];
+  item.level0 = l[0];
+  item.duration1 = d[1];
+  item.level1 = l[1];
+  return item;
+}
+
+ISR_CODE void rmt_fill(const void *src, rmt_item32_t *dest, size_t src_size,
+                       size_t wanted_num, size_t *translated_size, size_t *item_num)
+{
+  for (size_t i = 0; i < wanted_num; i++)
+    dest[i] = rmt_next_item();
+  *translated_size = wanted_num;
+  *item_num = wanted_num;
+}
+
+TimerCounter::TimerCounter()
+{
+  isrCallback = NULL;
+}
+
+void TimerCounter::initialize(unsigned long microseconds=1000000)
+{
+  isrCallback = NULL;
+  if (!rmtInstalled)
+  {
+    rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t)outputPin, RMT_OUT_CHANNEL);
+    config.clk_div = 80;                  // 80MHz APB clock, so 1 tick per us
+    config.tx_config.idle_output_en = true;
+    config.tx_config.idle_level = RMT_IDLE_LEVEL_LOW;
+    rmt_config(&config);
+    rmt_driver_install(RMT_OUT_CHANNEL, 0, 0);
+    rmt_translator_init(RMT_OUT_CHANNEL, rmt_fill);
+    rmtInstalled = true;
+  }
+  setPeriod(microseconds);
+}
+
+void TimerCounter::stop()
+{
+  // The driver only frees its tx semaphore when a transmission runs to
+  // the end, which this one never does.  So stop it and uninstall the
+  // driver (which doesn't wait, we never ask it to), and initialize()
+  // sets it up again for the next file
+  if (rmtInstalled)
+  {
+    rmt_tx_stop(RMT_OUT_CHANNEL);
+    rmt_driver_uninstall(RMT_OUT_CHANNEL);
+    rmtInstalled = false;
+  }
+}
+
+void TimerCounter::attachInterrupt(timerCallback isr)
+{
+  // the first edge comes after the period given to initialize()
+  isrCallback = isr;
+  if (rmtInstalled)
+    rmt_write_sample(RMT_OUT_CHANNEL, &rmtSource, RMT_ENDLESS, false);
+}
+
+#elif defined(ESP32) && defined(CONFIG_IDF_TARGET_ESP32C3)
+
+// The C3 has one core, so the output interrupt shares it with everything
+// else: rather than the core's timer API (whose timerAlarmWrite goes through
+// the IDF driver, with its checks and spinlock, every period), timer group 0's
+// timer 0 is driven through its registers directly.  It counts up in us from
+// the APB clock and reloads to 0 at each alarm; the IRAM interrupt clears the
+// flag, lets the callback write the next alarm value, and rearms the alarm
+// (which the hardware turns off each time it fires).
+#include "soc/timer_group_reg.h"
+#include "soc/periph_defs.h"
+#include "esp_intr_alloc.h"
+
+intr_handle_t timerIntr = NULL;
+
+ISR_CODE void onTimer(void *)
+{
+  REG_WRITE(TIMG_INT_CLR_TIMERS_REG(0), TIMG_T0_INT_CLR);
+  if (isrCallback)
+    (*isrCallback)();
+  REG_SET_BIT(TIMG_T0CONFIG_REG(0), TIMG_T0_ALARM_EN);
+}
+
+ISR_CODE void timer_restart()
+{
+  // count from 0 again, so the alarm is never already behind the counter
+  REG_WRITE(TIMG_T0LOADLO_REG(0), 0);
+  REG_WRITE(TIMG_T0LOADHI_REG(0), 0);
+  REG_WRITE(TIMG_T0LOAD_REG(0), 1);
+}
+
+TimerCounter::TimerCounter()
+{
+  isrCallback = NULL;
+}
+
+void TimerCounter::initialize(unsigned long microseconds=1000000)
+{
+  isrCallback = NULL;
+  if (timerIntr==NULL)
+  {
+    REG_WRITE(TIMG_T0CONFIG_REG(0), TIMG_T0_INCREASE | TIMG_T0_AUTORELOAD |
+              ((getApbFrequency()/1000000) << TIMG_T0_DIVIDER_S));
+    timer_restart();
+    setPeriod(microseconds);
+    REG_CLR_BIT(TIMG_INT_ENA_TIMERS_REG(0), TIMG_T0_INT_ENA);
+    REG_WRITE(TIMG_INT_CLR_TIMERS_REG(0), TIMG_T0_INT_CLR);
+    esp_intr_alloc(ETS_TG0_T0_LEVEL_INTR_SOURCE, ESP_INTR_FLAG_IRAM, onTimer, NULL, &timerIntr);
+    REG_SET_BIT(TIMG_T0CONFIG_REG(0), TIMG_T0_EN);
+  }
+}
+
+ISR_CODE void TimerCounter::setPeriod(unsigned long microseconds)
+{
+  REG_WRITE(TIMG_T0ALARMLO_REG(0), microseconds);
+  REG_WRITE(TIMG_T0ALARMHI_REG(0), 0);
+}
+
+void TimerCounter::stop()
+{
+  if (timerIntr!=NULL)
+  {
+    REG_CLR_BIT(TIMG_T0CONFIG_REG(0), TIMG_T0_ALARM_EN);
+    REG_CLR_BIT(TIMG_INT_ENA_TIMERS_REG(0), TIMG_T0_INT_ENA);
+  }
+}
+
+void TimerCounter::attachInterrupt(timerCallback isr)
+{
+  isrCallback = isr;
+  timer_restart();
+  REG_WRITE(TIMG_INT_CLR_TIMERS_REG(0), TIMG_T0_INT_CLR);
+  REG_SET_BIT(TIMG_INT_ENA_TIMERS_REG(0), TIMG_T0_INT_ENA);
+  REG_SET_BIT(TIMG_T0CONFIG_REG(0), TIMG_T0_ALARM_EN);
+}
+
 #elif defined(ESP32)
 
-void ARDUINO_ISR_ATTR onTimer(){
+void ISR_CODE onTimer(){
   // just call the callback
   if (isrCallback)
     (*isrCallback)();
@@ -575,7 +1452,7 @@ void TimerCounter::initialize(unsigned long microseconds=1000000)
   }
 }
 
-void TimerCounter::setPeriod(unsigned long microseconds)
+ISR_CODE void TimerCounter::setPeriod(unsigned long microseconds)
 {
   timerAlarmWrite(timer, microseconds, true);
 }
@@ -594,9 +1471,15 @@ void TimerCounter::attachInterrupt(timerCallback isr)
 
 #elif defined(ESP8266)
 
-void IRAM_ATTR onTimer(){
-  // just call the callback
-  if (isrCallback)
+// Divide CPU freq in Hz (e.g. 80000000) by 1e6 (=> 80) to determine how many ticks per microsecond
+// DIV16 to reduce this by a factor of 16
+#define T1_TICKS_PER_US ((F_CPU/1000000)/16)
+#define T1_MIN_TICKS    (10 * T1_TICKS_PER_US)
+
+uint32_t t1Load;    // ticks last written to timer1, which it reloaded with at the last interrupt
+
+void ISR_CODE onTimer(){
+  if (!long_next() && isrCallback)
     (*isrCallback)();
 }
 
@@ -608,34 +1491,169 @@ TimerCounter::TimerCounter()
 void TimerCounter::initialize(unsigned long microseconds=1000000)
 {
   isrCallback = NULL;
-  // Divide CPU freq in Hz (e.g. 80000000) by 1e6 (=> 80) to determine how many ticks per microsecond
-  // DIV16 to reduce this by a factor of 16
   // ESP8266 timer1 is only 23 bits
   // So 1000000 us (=1 second) would need 1000000 * (80/16) ticks = 5000000 ticks
   // (which is less than 2^23 i.e. 8338608)
   timer1_isr_init();
   timer1_attachInterrupt(onTimer);
-  timer1_write(microseconds*((F_CPU/1000000)/16));
+  t1Load = microseconds * T1_TICKS_PER_US;
+  timer1_write(t1Load);
   timer1_enable(TIM_DIV16, TIM_EDGE, TIM_LOOP);
 }
 
-void TimerCounter::setPeriod(unsigned long microseconds)
+ISR_CODE void TimerCounter::setPeriod(unsigned long microseconds)
 {
-  timer1_write(microseconds*((F_CPU/1000000)/16));
+  // Writing the load register restarts the count, so whatever time wave2
+  // took to get here would be added to every period.  The counter has been
+  // running down from t1Load since the interrupt: take that much off.
+  uint32_t ticks = long_piece(microseconds) * T1_TICKS_PER_US;
+  const uint32_t now = T1V;
+  const uint32_t spent = (now < t1Load) ? t1Load - now : 0;
+  ticks = (ticks > spent + T1_MIN_TICKS) ? ticks - spent : T1_MIN_TICKS;
+  t1Load = ticks;          // what it reloads with at the next interrupt
+  timer1_write(ticks);
   // timer1_write also (re)enables edge interrupts
 }
 
 void TimerCounter::stop()
 {
   timer1_disable();
+  longRest = 0;
 }
 
 void TimerCounter::attachInterrupt(void (*isr)())
 {
   isrCallback = isr;
+  timer1_attachInterrupt(onTimer);
   timer1_enable(TIM_DIV16, TIM_EDGE, TIM_LOOP);
 }
 
+#elif defined(ARDUINO_ARCH_RP2040)
+
+// The output pin belongs to a PIO state machine, which plays level/duration
+// words from its TX FIFO with cycle exact timing: pull a word, put bit 0 on
+// the pin, and count the other 31 bits down.  Its FIFO not full interrupt
+// tops it up, and each edge comes from wave2() as usual: WRITE_HIGH/WRITE_LOW
+// set pioLevel, and setPeriod() says how long it lasts.  As with the ESP32's
+// RMT, edge timing no longer depends on how quickly an interrupt is serviced,
+// only on the refill keeping ahead (8 edges, with the FIFOs joined).
+// With FANOUT_PINS the level goes out on those pins as well, one bit each,
+// and the count has that many bits fewer, so long periods take several words.
+#include "hardware/pio.h"
+#include "hardware/clocks.h"
+#include "hardware/irq.h"
+#include "pinSetup.h"
+#include "fanout.h"
+
+#define PIO_TICKS_PER_US  8               // state machine clock, 8MHz
+#define PIO_WORD_CYCLES   4               // pull, out, out, and the last jmp
+#ifdef FANOUT_PINS
+  #define PIO_OUT_PINS    (1 + fanoutCount)
+#else
+  #define PIO_OUT_PINS    1
+#endif
+#define PIO_LEVEL_BITS    ((1ul << PIO_OUT_PINS) - 1)
+#define PIO_MAX_US        ((0xFFFFFFFFUL >> PIO_OUT_PINS) / PIO_TICKS_PER_US)
+
+static uint16_t pioPulseCode[] = {
+  0x80a0,   //  pull block
+  0x6001,   //  out pins, PIO_OUT_PINS        (1 here, set in initialize)
+  0x603f,   //  out x, 32-PIO_OUT_PINS        (31 here)
+  0x0043,   //  jmp x--, 3
+};
+static const struct pio_program pioPulseProgram = {
+  pioPulseCode, 4, -1,
+};
+
+PIO const pioOut = pio0;
+uint pioSm = 0;
+uint pioOffset = 0;
+bool pioClaimed = false;
+volatile byte pioLevel = LOW;
+unsigned long pioLeft = 0;                // us to play at pioLevel, 0 once queued
+
+ISR_CODE void TimerCounter::setPeriod(unsigned long microseconds)
+{
+  pioLeft = microseconds ? microseconds : 1;
+}
+
+ISR_CODE void pio_refill()
+{
+  while (!pio_sm_is_tx_fifo_full(pioOut, pioSm))
+  {
+    if (pioLeft == 0)
+    {
+      if (isrCallback)
+        (*isrCallback)();
+      else
+        pioLeft = 1000;
+    }
+    const unsigned long us = (pioLeft > PIO_MAX_US) ? PIO_MAX_US : pioLeft;
+    pioLeft -= us;
+    uint32_t ticks = us * PIO_TICKS_PER_US;
+    ticks = (ticks > PIO_WORD_CYCLES) ? ticks - PIO_WORD_CYCLES : 0;
+    pio_sm_put(pioOut, pioSm, (ticks << PIO_OUT_PINS) | (pioLevel ? PIO_LEVEL_BITS : 0));
+  }
+}
+
+TimerCounter::TimerCounter()
+{
+  isrCallback = NULL;
+}
+
+void TimerCounter::initialize(unsigned long microseconds=1000000)
+{
+  isrCallback = NULL;
+  if (!pioClaimed)
+  {
+    pioSm = pio_claim_unused_sm(pioOut, true);
+    pioPulseCode[1] = pio_encode_out(pio_pins, PIO_OUT_PINS);
+    pioPulseCode[2] = pio_encode_out(pio_x, 32 - PIO_OUT_PINS);
+    pioOffset = pio_add_program(pioOut, &pioPulseProgram);
+    pio_gpio_init(pioOut, outputPin);
+    pio_sm_set_consecutive_pindirs(pioOut, pioSm, outputPin, PIO_OUT_PINS, true);
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, pioOffset, pioOffset + pioPulseProgram.length - 1);
+    sm_config_set_out_pins(&c, outputPin, PIO_OUT_PINS);
+    sm_config_set_out_shift(&c, true, false, 32);   // bit 0 first, no autopull
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+    sm_config_set_clkdiv(&c, (float)clock_get_hz(clk_sys) / (1000000UL * PIO_TICKS_PER_US));
+    pio_sm_init(pioOut, pioSm, pioOffset, &c);
+    irq_set_exclusive_handler(PIO0_IRQ_0, pio_refill);
+    irq_set_priority(PIO0_IRQ_0, 0);
+    pio_sm_set_enabled(pioOut, pioSm, true);
+    pioClaimed = true;
+  }
+  setPeriod(microseconds);
+}
+
+void TimerCounter::stop()
+{
+  // drop what's queued and leave the pin low, as the RMT's idle level
+  if (pioClaimed)
+  {
+    irq_set_enabled(PIO0_IRQ_0, false);
+    pio_set_irq0_source_enabled(pioOut, (pio_interrupt_source)(pis_sm0_tx_fifo_not_full + pioSm), false);
+    pio_sm_set_enabled(pioOut, pioSm, false);
+    pio_sm_clear_fifos(pioOut, pioSm);
+    pio_sm_restart(pioOut, pioSm);
+    pio_sm_exec(pioOut, pioSm, pio_encode_jmp(pioOffset));
+    pio_sm_set_pins_with_mask(pioOut, pioSm, 0, PIO_LEVEL_BITS << outputPin);
+    pio_sm_set_enabled(pioOut, pioSm, true);    // waiting at pull for the next file
+  }
+}
+
+void TimerCounter::attachInterrupt(timerCallback isr)
+{
+  // the first edge comes after the period given to initialize()
+  isrCallback = isr;
+  if (pioClaimed)
+  {
+    pio_set_irq0_source_enabled(pioOut, (pio_interrupt_source)(pis_sm0_tx_fifo_not_full + pioSm), true);
+    irq_set_enabled(PIO0_IRQ_0, true);
+  }
+}
+
 #else
 #error Missing definition of TimerCounter / unsupported device
 #endif
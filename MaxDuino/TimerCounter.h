@@ -1,6 +1,8 @@
 #ifndef TIMER_H_INCLUDED
 #define TIMER_H_INCLUDED
 
+#include "Arduino.h"
+
 typedef void (*timerCallback) ();
 
 class TimerCounter
@@ -14,4 +16,32 @@ class TimerCounter
 };
 extern TimerCounter& Timer;
 
+// attachInterrupt() also puts the playback timer's interrupt above the
+// others (USB, SD and display SERCOMs, DMAC, pin changes) on the ARM
+// boards, so their handlers can't hold an edge up.  irq_mask() holds off
+// only those lower ones, with the timer still running, for data shared
+// with them and not with the timer: BASEPRI on the STM32F1 (a Cortex-M3).
+// The SAMD21's M0+ has no such mask, so there (and on the rest) it's
+// noInterrupts() after all.
+#if defined(__arm__) && defined(__STM32F1__)
+  #define IRQ_MASK_LEVEL 0x10         // priority 1 and below (4 bits, at the top of the byte)
+  static inline uint32_t irq_mask() {
+    uint32_t old;
+    asm volatile ("MRS %0, basepri" : "=r" (old));
+    asm volatile ("MSR basepri, %0" : : "r" (IRQ_MASK_LEVEL) : "memory");
+    return old;
+  }
+  static inline void irq_unmask(uint32_t old) {
+    asm volatile ("MSR basepri, %0" : : "r" (old) : "memory");
+  }
+#else
+  static inline uint32_t irq_mask() {
+    noInterrupts();
+    return 0;
+  }
+  static inline void irq_unmask(uint32_t) {
+    interrupts();
+  }
+#endif
+
 #endif // TIMER_H_INCLUDED
\ No newline at end of file
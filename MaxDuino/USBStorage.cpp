@@ -18,18 +18,79 @@
 
 #ifdef USB_STORAGE_ENABLED
 
-#include "Adafruit_TinyUSB.h"
+#include "USBStorage.h"
 #include "file_utils.h"
+#include "MaxDuino.h"
 
+#if defined(ESP32)
+// ESP32-S2/S3: the core's own TinyUSB, on the chip's USB-OTG port
+#include "USB.h"
+#include "USBMSC.h"
+USBMSC usb_msc;
+#elif defined(USB_STORAGE_POLLED)
+// STM32F1: the maple core's USBComposite, on the USB device peripheral
+#include <USBComposite.h>
+USBMassStorage MassStorage;
+#else
+#include "Adafruit_TinyUSB.h"
 Adafruit_USBD_MSC usb_msc;
+#endif
+
+// While a file is playing the card is shared with the player, so the host
+// sees it write protected and each READ10 callback reads no more than
+// MSC_PLAY_SECTORS before handing back (TinyUSB asks again for the rest).
+// That keeps every callback to around a millisecond of card time, and the
+// player gets its turn between them.
+#ifndef MSC_PLAY_SECTORS
+  #define MSC_PLAY_SECTORS 1
+#endif
+
+// After the host has written, and then left the card alone for this long,
+// the main loop remounts the volume and rescans (usb_storage_changed()),
+// since what SdFat has cached about the card may be stale.
+#define MSC_SETTLE_MS 1000
+
+bool msc_dirty = false;
+unsigned long msc_last_write;
+
+// Writes are collected here while they run on from each other, and go to
+// the card as one multi-sector write: when the run breaks, when the cache
+// is full, before a read of the same sectors, and at the end of each WRITE10
+// (msc_flush_cb).  TinyUSB hands over one endpoint buffer (often a single
+// sector) per callback, so without this every sector is its own card write.
+// The ESP32 core has no end-of-WRITE10 callback, so there each callback's
+// buffer (CONFIG_TINYUSB_MSC_BUFSIZE, 4K by default) goes to the card as
+// one write before it returns, rather than sitting in the cache.
+#ifndef USB_STORAGE_POLLED
+#ifndef MSC_CACHE_SECTORS
+  #define MSC_CACHE_SECTORS 8
+#endif
+
+uint8_t msc_cache[MSC_CACHE_SECTORS*512];
+uint32_t msc_cache_lba;
+uint32_t msc_cache_count = 0;   // sectors in msc_cache, starting at msc_cache_lba
+
+bool msc_cache_flush()
+{
+  if (msc_cache_count == 0) return true;
+  const bool ok = sd.card()->writeSectors(msc_cache_lba, msc_cache, msc_cache_count);
+  msc_cache_count = 0;
+  return ok;
+}
 
 // Callback invoked when received READ10 command.
 // Copy disk's data to buffer (up to bufsize) and
 // return number of copied bytes (must be multiple of block size)
 int32_t msc_read_cb (uint32_t lba, void* buffer, uint32_t bufsize)
 {
-  (void) bufsize;
-  return sd.card()->readSector(lba, (uint8_t*) buffer) ? 512 : -1;
+  uint32_t count = bufsize / 512;
+  if (start==1 && count > MSC_PLAY_SECTORS) count = MSC_PLAY_SECTORS;
+  if (msc_cache_count && lba < msc_cache_lba + msc_cache_count && msc_cache_lba < lba + count)
+  {
+    // reading back something not written yet
+    if (!msc_cache_flush()) return -1;
+  }
+  return sd.card()->readSectors(lba, (uint8_t*) buffer, count) ? count*512 : -1;
 }
 
 // Callback invoked when received WRITE10 command.
@@ -37,17 +98,135 @@ int32_t msc_read_cb (uint32_t lba, void* buffer, uint32_t bufsize)
 // return number of written bytes (must be multiple of block size)
 int32_t msc_write_cb (uint32_t lba, uint8_t* buffer, uint32_t bufsize)
 {
-  (void) bufsize;
-  return sd.card()->writeSector(lba, buffer) ? 512 : -1;
+  if (start==1) return -1;     // write protected while playing, see msc_writable_cb
+  msc_dirty = true;
+  msc_last_write = millis();
+  uint32_t count = bufsize / 512;
+  const uint32_t written = count*512;
+  while (count)
+  {
+    if (msc_cache_count && (lba != msc_cache_lba + msc_cache_count || msc_cache_count == MSC_CACHE_SECTORS))
+    {
+      if (!msc_cache_flush()) return -1;
+    }
+    if (msc_cache_count == 0) msc_cache_lba = lba;
+    uint32_t n = MSC_CACHE_SECTORS - msc_cache_count;
+    if (n > count) n = count;
+    memcpy(msc_cache + msc_cache_count*512, buffer, n*512);
+    msc_cache_count += n;
+    lba += n;
+    buffer += n*512;
+    count -= n;
+  }
+#if defined(ESP32)
+  if (!msc_cache_flush()) return -1;
+#endif
+  return written;
 }
 
 // Callback invoked when WRITE10 command is completed (status received and accepted by host).
 // used to flush any pending cache.
 void msc_flush_cb (void)
 {
-  // nothing to do
+  msc_cache_flush();
+  msc_last_write = millis();
 }
 
+// Callback invoked to check if the unit is writable:
+// only while stopped, so the host never writes under the player
+bool msc_writable_cb (void)
+{
+  return start==0;
+}
+#else
+constexpr uint32_t msc_cache_count = 0;
+#endif
+
+bool usb_storage_changed()
+{
+  if (!msc_dirty || msc_cache_count || millis() - msc_last_write < MSC_SETTLE_MS) return false;
+  msc_dirty = false;
+  return true;
+}
+
+#if defined(ESP32)
+int32_t msc_read_esp32(uint32_t lba, uint32_t offset, void* buffer, uint32_t bufsize)
+{
+  if (offset) return -1;      // always whole sectors, as the block size is 512
+  return msc_read_cb(lba, buffer, bufsize);
+}
+
+int32_t msc_write_esp32(uint32_t lba, uint32_t offset, uint8_t* buffer, uint32_t bufsize)
+{
+  if (offset) return -1;
+  return msc_write_cb(lba, buffer, bufsize);
+}
+
+// the USB stack stays up (it's the serial port too): the host just sees
+// the card taken out, and put back
+void usb_detach()
+{
+  usb_msc.mediaPresent(false);
+}
+
+void usb_retach()
+{
+  usb_msc.mediaPresent(true);
+}
+
+void setup_usb_storage()
+{
+  usb_msc.vendorID("MaxDuino");
+  usb_msc.productID("SD Card");
+  usb_msc.productRevision("1.0");
+  usb_msc.onRead(msc_read_esp32);
+  usb_msc.onWrite(msc_write_esp32);
+  usb_msc.mediaPresent(true);
+  usb_msc.begin(sd.card()->sectorCount(), 512);
+  USB.begin();
+}
+
+#elif defined(USB_STORAGE_POLLED)
+// Each callback is a whole SCSI transfer, so goes to the card as one
+// multi-sector read or write (nothing to collect in msc_cache)
+bool msc_read_stm32(uint8_t *buffer, uint32_t lba, uint16_t count)
+{
+  return sd.card()->readSectors(lba, buffer, count);
+}
+
+bool msc_write_stm32(const uint8_t *buffer, uint32_t lba, uint16_t count)
+{
+  if (start==1) return false;   // there's no write protect to show the host, so it's refused
+  msc_dirty = true;
+  msc_last_write = millis();
+  return sd.card()->writeSectors(lba, buffer, count);
+}
+
+void usb_storage_loop()
+{
+  MassStorage.loop();
+}
+
+void usb_detach()
+{
+  USBComposite.end();
+}
+
+void usb_retach()
+{
+  // (setup_usb_storage starts it)
+}
+
+void setup_usb_storage()
+{
+  USBComposite.setManufacturerString("MaxDuino");
+  USBComposite.setProductString("SD Card");
+  MassStorage.setDriveData(0, sd.card()->sectorCount(), msc_read_stm32, msc_write_stm32);
+  MassStorage.registerComponent();
+  USBComposite.begin();
+}
+
+#else
 void usb_detach()
 {
   //usb_msc.detach();
@@ -67,6 +246,7 @@ void setup_usb_storage()
 
   // Set read write callback
   usb_msc.setReadWriteCallback(msc_read_cb, msc_write_cb, msc_flush_cb);
+  usb_msc.setWritableCallback(msc_writable_cb);
 
   // Still initialize MSC but tell usb stack that MSC is not ready to read/write
   // If we don't initialize, board will be enumerated as CDC only
@@ -81,5 +261,6 @@ void setup_usb_storage()
   // MSC is ready for read/write
   usb_msc.setUnitReady(true);
 }
+#endif
 
 #endif
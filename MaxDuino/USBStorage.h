@@ -3,9 +3,35 @@
 #define USBSTORAGE_H_INCLUDED
 
 #ifdef USB_STORAGE_ENABLED
+
+#if defined(ESP32)
+  // the MSC callbacks run in the core's USB task, alongside loop(), so the
+  // card stays on shared SPI: each SdFat call then holds the SPI bus lock
+  // for the whole of its transfer, and the two never interleave on the card
+  #if !defined(CONFIG_IDF_TARGET_ESP32S2) && !defined(CONFIG_IDF_TARGET_ESP32S3)
+    #error USB_STORAGE_ENABLED on ESP32 needs an S2 or S3 (USB-OTG)
+  #endif
+  #if ARDUINO_USB_MODE
+    #error USB_STORAGE_ENABLED needs Tools > USB Mode: USB-OTG (TinyUSB)
+  #endif
+  #define USB_STORAGE_TASK
+#endif
+
+#if defined(__arm__) && defined(__STM32F1__)
+  // the maple core's USBComposite: its MSC callbacks only run from
+  // usb_storage_loop(), which the main loop calls while stopped, and
+  // TZXLoop while the output ring is full (so the host's reads come out
+  // of the player's slack).  It takes the USB port over, so there is no
+  // USB serial port alongside
+  #define USB_STORAGE_POLLED
+  void usb_storage_loop();
+#endif
+
 void setup_usb_storage();
 void usb_detach();
 void usb_retach();
+// true (once) when the host has written to the card and has since gone quiet
+bool usb_storage_changed();
 #endif
 
 #endif // USBSTORAGE_H_INCLUDED
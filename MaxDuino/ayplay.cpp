@@ -4,62 +4,72 @@
 #include "processing_state.h"
 #include "file_utils.h"
 #include "MaxProcessing.h"
+#include "bytesrc.h"
 
 #ifdef AYPLAY
 
-PROGMEM const byte TAPHdr[20] = {0x0,0x0,0x3,'Z','X','A','Y','E','M','U','L',' ',' ',0x1A,0xB,0x0,0xC0,0x0,0x80,0x6E}; // 
-PROGMEM const byte * const AYFile = TAPHdr+3;  // added additional AY file header check
+#define AY_HEADER_SIZE 19   // flag byte, 17 byte header, checksum
 
-byte AYPASS_hdrptr = AYPASS_STEP::HDRSTART;
+// flag and 17 byte header, with the name and length filled in from the file
+PROGMEM const byte TAPHdr[AY_HEADER_SIZE-1] = {0x0,0x3,'Z','X','A','Y','E','M','U','L',' ',' ',0x1A,0xB,0x0,0xC0,0x0,0x80}; // 
+PROGMEM const byte * const AYFile = TAPHdr+2;  // added additional AY file header check
 
-void WriteAYHeader() {
-  //Convert byte from HDR Vector String into string of pulses and calculate checksum. One pulse per pass
-  if(currentBit==0) {                         //Check for byte end/new byte                         
-    if(AYPASS_hdrptr==AYPASS_STEP::HDREND) { // If we've reached end of header block send checksum byte
-      currentByte = bitChecksum;
-      AYPASS_hdrptr = AYPASS_STEP::WRITE_FLAG_BYTE; // for next TDATA section we'll write the 0xFF flag before the AY data
-      currentBlockTask = BLOCKTASK::PAUSE;   // we've finished outputting the TAP header so now PAUSE and send DATA block normally from file
-      return;
-    }
-    ++AYPASS_hdrptr;                 // increase header string vector pointer
-    currentByte = pgm_read_byte(TAPHdr+AYPASS_hdrptr);
-    if (AYPASS_hdrptr>=AYPASS_STEP::FILENAME_START && AYPASS_hdrptr<=AYPASS_STEP::FILENAME_END) {
-      if (size_t(AYPASS_hdrptr-AYPASS_STEP::FILENAME_START) < strlen(fileName)) {
-        currentByte = fileName[AYPASS_hdrptr-AYPASS_STEP::FILENAME_START];
-        if (currentByte<0x20 || currentByte>0x7f) {
-          currentByte = '?';
+namespace {
+constexpr byte FILENAME_START = 2;
+constexpr byte FILENAME_END = 11;
+constexpr byte LEN_LOW_BYTE = 12;
+constexpr byte LEN_HIGH_BYTE = 13;
+
+byte ayHeader[AY_HEADER_SIZE];
+
+void build_header() {
+  // The whole header block, checksum included, is made once here so it can
+  // be played like any other data block
+  byte chk = 0;
+  for (byte i = 0; i < AY_HEADER_SIZE-1; ++i) {
+    byte b = pgm_read_byte(TAPHdr+i);
+    if (i>=FILENAME_START && i<=FILENAME_END) {
+      if (size_t(i-FILENAME_START) < strlen(fileName)) {
+        b = fileName[i-FILENAME_START];
+        if (b<0x20 || b>0x7f) {
+          b = '?';
         }
       } else {
-        currentByte = ' ';
+        b = ' ';
       }
+    } else if (i==LEN_LOW_BYTE) {      // insert calculated block length
+      b = lowByte(filesize);
+    } else if (i==LEN_HIGH_BYTE) {
+      b = highByte(filesize);
     }
-    else if(AYPASS_hdrptr==AYPASS_STEP::LEN_LOW_BYTE){ // insert calculated block length minus LEN bytes
-      currentByte = lowByte(filesize);
-    } else if(AYPASS_hdrptr==AYPASS_STEP::LEN_HIGH_BYTE){
-      currentByte = highByte(filesize);
-    }
-    bitChecksum ^= currentByte;    // Keep track of Chksum
-    currentBit=8;
-    pass=0; 
-  } //End if currentBit == 0
+    ayHeader[i] = b;
+    chk ^= b;
+  }
+  ayHeader[AY_HEADER_SIZE-1] = chk;
+}
+} // namespace
+
+byte AYPASS_hdrptr = AYPASS_STEP::HDRSTART;
 
-  if(currentByte&0x80) {                       //Set next period depending on value of bit 0
-    currentPeriod = onePulse;
+void ay_queue_block() {
+  bytesrc_clear();
+  if (AYPASS_hdrptr == AYPASS_STEP::HDRSTART) {
+    bytesrc_ram(ayHeader, AY_HEADER_SIZE);
+    bytesToRead = AY_HEADER_SIZE + 1;
+    AYPASS_hdrptr = AYPASS_STEP::DATA;    // for next TDATA section we'll write the 0xFF flag before the AY data
   } else {
-    currentPeriod = zeroPulse;
+    bytesrc_fill(0xFF, 1);                // data flag header byte
+    bytesrc_file(filesize);
+    bytesrc_xorsum();
+    bytesToRead = filesize + 3;
   }
-  pass+=1;                                    //Data is played as 2 x pulses
-  if(pass==2) {
-    currentByte <<= 1;                        //Shift along to the next bit
-    currentBit += -1;
-    pass=0;  
-  }    
 }
 
 void ReadAYHeader() {
   //Read and check first 8 bytes for a TZX header
   if(readfile(8, 0)==8 && memcmp_P(filebuffer, AYFile, 8)==0) {
     bytesRead = 0;
+    build_header();
     return;
   }
   HeaderFail();
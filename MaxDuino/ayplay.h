@@ -4,18 +4,13 @@
 #include "Arduino.h"
 
 #ifdef AYPLAY
-void WriteAYHeader();
 void ReadAYHeader();
+// queue the next block's bytes (bytesrc.h): the TAP header made up by
+// ReadAYHeader, then the file with the 0xFF flag and checksum around it
+void ay_queue_block();
 enum AYPASS_STEP : byte {
   HDRSTART = 0,
-  FILENAME_START = 3,
-  FILENAME_END = 12,
-  LEN_LOW_BYTE = 13,
-  LEN_HIGH_BYTE = 14,
-  HDREND = 19,
-  WRITE_FLAG_BYTE = 20,
-  WRITE_CHECKSUM = 21,
-  FINISHED = 22,
+  DATA = 1,
 };
 extern byte AYPASS_hdrptr;
 #endif
@@ -0,0 +1,112 @@
+#include "configs.h"
+#include "baudcache.h"
+
+#ifdef BAUD_CACHE
+
+#include "file_utils.h"
+#include "current_settings.h"
+
+namespace {
+// file layout: BAUD_CACHE_SLOTS records of
+//   4 bytes  FNV-1a hash of the file name (little endian, as are the others)
+//   4 bytes  file size
+//   2 bytes  BAUDRATE it last played through at, 0 for an empty slot
+constexpr byte REC_SIZE = 10;
+const char DB_PATH[] PROGMEM = "/MAXBAUD.DAT";
+
+word menuBaud = 0;        // the menu's BAUDRATE while a saved one is in use, 0 if not
+bool playing = false;     // between apply and played, while the file is the one applied
+
+unsigned long name_hash(const char *s) {
+  unsigned long h = 2166136261UL;
+  while (*s) {
+    h ^= (byte)*s++;
+    h *= 16777619UL;
+  }
+  return h;
+}
+
+void put_le32(byte *p, unsigned long v) {
+  p[0] = v;
+  p[1] = v >> 8;
+  p[2] = v >> 16;
+  p[3] = v >> 24;
+}
+
+unsigned long get_le32(const byte *p) {
+  return ((unsigned long)word(p[3], p[2]) << 16) | word(p[1], p[0]);
+}
+
+unsigned long hash;
+byte rec[REC_SIZE];
+
+unsigned long slot_pos() {
+  hash = name_hash(fileName);
+  return ((hash ^ filesize) % BAUD_CACHE_SLOTS) * REC_SIZE;
+}
+
+bool open_db(SdBaseFile &db, oflag_t flags) {
+  char path[sizeof(DB_PATH)];
+  strcpy_P(path, DB_PATH);
+  return db.open(path, flags);
+}
+} // anonymous namespace
+
+void baudcache_apply() {
+  playing = false;
+  if (stream_active()) return;
+  playing = true;
+
+  SdBaseFile db;
+  const unsigned long pos = slot_pos();
+  if (!open_db(db, O_RDONLY)) return;
+  if (db.seekSet(pos) && db.read(rec, REC_SIZE) == REC_SIZE &&
+      get_le32(rec) == hash && get_le32(rec+4) == filesize) {
+    const word saved = word(rec[9], rec[8]);
+    if (saved && saved != BAUDRATE) {
+      if (menuBaud == 0) menuBaud = BAUDRATE;
+      BAUDRATE = saved;
+    }
+  }
+  db.close();
+}
+
+void baudcache_played(bool played) {
+  if (!playing) return;
+  playing = false;
+
+  SdBaseFile db;
+  const unsigned long pos = slot_pos();
+  if (!open_db(db, O_RDWR | O_CREAT)) return;
+  if (played) {
+    put_le32(rec, hash);
+    put_le32(rec+4, filesize);
+    rec[8] = BAUDRATE & 0xFF;
+    rec[9] = BAUDRATE >> 8;
+  } else {
+    // only forget it if the slot is this file's
+    if (!db.seekSet(pos) || db.read(rec, REC_SIZE) != REC_SIZE ||
+        get_le32(rec) != hash || get_le32(rec+4) != filesize) {
+      db.close();
+      return;
+    }
+    rec[8] = rec[9] = 0;
+  }
+  // a new file is grown to the slot with zeros (empty slots) on the way
+  if (db.fileSize() < pos) {
+    const byte zero[REC_SIZE] = {0};
+    db.seekEnd();
+    while (db.fileSize() < pos && db.write(zero, REC_SIZE) == REC_SIZE) {}
+  }
+  if (db.seekSet(pos)) db.write(rec, REC_SIZE);
+  db.close();
+}
+
+void baudcache_restore() {
+  if (menuBaud) {
+    BAUDRATE = menuBaud;
+    menuBaud = 0;
+  }
+}
+
+#endif // BAUD_CACHE
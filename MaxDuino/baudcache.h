@@ -0,0 +1,31 @@
+#ifndef BAUDCACHE_H_INCLUDED
+#define BAUDCACHE_H_INCLUDED
+
+#include "Arduino.h"
+#include "configs.h"
+
+// Per-file speed memory.  When a file plays right through to the end, the
+// BAUDRATE it played at is saved against it (a hash of its name, and its
+// size) in /MAXBAUD.DAT on the SD card; the next time it's played, it
+// starts at that speed instead of the menu's.  Stopping a file before the
+// end forgets its speed, in case that was a failed load, so the next play
+// is back on the menu setting.  The menu's BAUDRATE comes back on stop.
+
+#ifdef BAUD_CACHE
+
+#ifndef BAUD_CACHE_SLOTS
+  #define BAUD_CACHE_SLOTS 128      // files remembered (one slot each, a clash replaces the older one)
+#endif
+
+// At the start of UniPlay: switch BAUDRATE to the speed saved for fileName, if there is one
+void baudcache_apply();
+
+// When playback stops: played is true if the file got all the way to the end
+void baudcache_played(bool played);
+
+// From UniStop: put the menu's BAUDRATE back
+void baudcache_restore();
+
+#endif // BAUD_CACHE
+
+#endif // BAUDCACHE_H_INCLUDED
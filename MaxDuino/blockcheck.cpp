@@ -0,0 +1,52 @@
+#include "configs.h"
+#include "blockcheck.h"
+
+#ifdef BLOCK_CHECK
+
+#include "file_utils.h"
+#include "Display.h"
+
+namespace {
+unsigned long chkStart;   // the block's flag byte
+unsigned long chkPos;     // next byte to check
+unsigned long chkEnd;     // 0 when there's no check under way
+byte chkSum;
+} // anonymous namespace
+
+void blockcheck_clear() {
+  chkEnd = 0;
+}
+
+void blockcheck_start(unsigned long p, word len) {
+  chkStart = p;
+  chkPos = p;
+  chkEnd = len ? p + len : 0;
+  chkSum = 0;
+}
+
+void blockcheck_service() {
+  if (chkEnd == 0) return;
+  if (bytesRead > chkStart) {
+    // the data has started going out before the check got to the end
+    chkEnd = 0;
+    return;
+  }
+  byte buf[BLOCK_CHECK_STEP];
+  word n = (chkEnd - chkPos < BLOCK_CHECK_STEP) ? chkEnd - chkPos : BLOCK_CHECK_STEP;
+  n = readfile_bytes(buf, n, chkPos);
+  if (n == 0) {
+    // cut short by the end of the file: the block will fail anyway
+    chkSum = 0xFF;
+    chkPos = chkEnd;
+  }
+  for (word i = 0; i < n; i++) chkSum ^= buf[i];
+  chkPos += n;
+  if (chkPos < chkEnd) return;
+
+  chkEnd = 0;
+  if (chkSum != 0) {
+    printtext2F(PSTR("CHECKSUM"),0);
+  }
+}
+
+#endif // BLOCK_CHECK
@@ -0,0 +1,31 @@
+#ifndef BLOCKCHECK_H_INCLUDED
+#define BLOCKCHECK_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef BLOCK_CHECK
+#include "Arduino.h"
+
+// Checks the XOR checksum of each .tap and TZX ID10 block (the ROM's,
+// flag to checksum byte, which XOR to 0) while its pilot tone plays, so a
+// corrupt block shows CHECKSUM on the screen before its data goes out,
+// rather than as a failed load minutes later.  The data is read from the
+// main loop while the buffer is full, a BLOCK_CHECK_STEP at a time.  If the
+// pilot runs out first the check is dropped, so it never competes with
+// playback for the read-ahead window.
+
+#ifndef BLOCK_CHECK_STEP
+  #define BLOCK_CHECK_STEP 64     // bytes checked per call
+#endif
+
+// From READPARAM: the block's len bytes start at p (its flag byte)
+void blockcheck_start(unsigned long p, word len);
+
+// From loop() while playing with the buffer full
+void blockcheck_service();
+
+// At the start of each file
+void blockcheck_clear();
+#endif
+
+#endif // BLOCKCHECK_H_INCLUDED
@@ -0,0 +1,184 @@
+#include "configs.h"
+#include "blockindex.h"
+
+#ifdef BLOCK_SD_INDEX
+
+#include "file_utils.h"
+#include "Display.h" // for HEX_CHAR
+#include "MaxDuino.h"
+#include "processing_state.h"
+
+namespace {
+// file layout:
+//   4 bytes  'MXB2'
+//   4 bytes  size of the indexed file (little endian), so a stale index is rebuilt
+//   4 bytes  how many counted blocks follow (little endian)
+//   then 5 bytes per counted block: 4 bytes offset (little endian), 1 byte block ID
+//   then the same for every block, counted or not, for the TZX flow control blocks
+// the header is written last, so an index cut short is never valid
+constexpr byte IDX_HEADER_SIZE = 12;
+constexpr byte IDX_ENTRY_SIZE = 5;
+const char IDX_DIR[] PROGMEM = "/BLKIDX";
+
+SdBaseFile idxFile;
+char idxPath[sizeof("/BLKIDX/12345678.IDX")];
+unsigned long countedEntries;   // read from the header by idx_valid
+
+void put_le32(byte *p, unsigned long v) {
+  p[0] = v;
+  p[1] = v >> 8;
+  p[2] = v >> 16;
+  p[3] = v >> 24;
+}
+
+unsigned long get_le32(const byte *p) {
+  return ((unsigned long)word(p[3], p[2]) << 16) | word(p[1], p[0]);
+}
+
+void make_idx_path() {
+  // name the index after the first sector of the file: unique per card, survives
+  // renames, and changes if the file is rewritten
+  unsigned long key = entry.firstSector();
+  strcpy_P(idxPath, IDX_DIR);
+  char *p = idxPath + sizeof(IDX_DIR) - 1;
+  *p++ = '/';
+  for (int8_t shift = 28; shift >= 0; shift -= 4) {
+    *p++ = pgm_read_byte(HEX_CHAR + ((key >> shift) & 0x0f));
+  }
+  strcpy_P(p, PSTR(".IDX"));
+}
+
+bool idx_valid() {
+  byte hdr[IDX_HEADER_SIZE];
+  if (idxFile.read(hdr, IDX_HEADER_SIZE) != IDX_HEADER_SIZE) return false;
+  if (!(hdr[0]=='M' && hdr[1]=='X' && hdr[2]=='B' && hdr[3]=='2' && get_le32(hdr+4) == entry.fileSize())) return false;
+  countedEntries = get_le32(hdr+8);
+  return IDX_HEADER_SIZE + countedEntries * IDX_ENTRY_SIZE <= idxFile.fileSize();
+}
+
+bool walk_into_index(bool countedOnly, unsigned long &entries) {
+  // one pass over the block headers, same rules as the block search in GetAndPlayBlock
+  switch(currentID) {
+    case BLOCKID::TAP:
+    case BLOCKID::JTAP:
+      bytesRead=0;
+      break;
+    default:
+      bytesRead=10;   //TZX with blocks skip TZXHeader
+      break;
+  }
+  byte rec[IDX_ENTRY_SIZE];
+  unsigned long blockStart;
+  bool counted;
+  const byte fileID = currentID;
+  entries = 0;
+  while (SkipBlockHeader(blockStart, counted)) {
+    if (counted || !countedOnly) {
+      put_le32(rec, blockStart);
+      rec[4] = (byte)currentID;
+      if (idxFile.write(rec, IDX_ENTRY_SIZE) != IDX_ENTRY_SIZE) return false;
+      entries++;
+    }
+  }
+  currentID = fileID;   // so the second pass starts the same way
+  return true;
+}
+
+bool build_index() {
+  char dir[sizeof(IDX_DIR)];
+  strcpy_P(dir, IDX_DIR);
+  if (!sd.exists(dir)) sd.mkdir(dir);
+  if (!idxFile.open(idxPath, O_WRONLY | O_CREAT | O_TRUNC)) return false;
+
+  byte rec[IDX_HEADER_SIZE] = {0};
+  bool ok = idxFile.write(rec, IDX_HEADER_SIZE) == IDX_HEADER_SIZE;
+
+  // walk the whole file twice: the counted blocks, then all of them
+  const unsigned long savedBytesRead = bytesRead;
+  const byte savedID = currentID;
+  unsigned long counted, all;
+  ok = ok && walk_into_index(true, counted) && walk_into_index(false, all);
+  bytesRead = savedBytesRead;
+  currentID = savedID;
+
+  if (ok) {
+    rec[0]='M'; rec[1]='X'; rec[2]='B'; rec[3]='2';
+    put_le32(rec+4, entry.fileSize());
+    put_le32(rec+8, counted);
+    ok = idxFile.seekSet(0) && idxFile.write(rec, IDX_HEADER_SIZE) == IDX_HEADER_SIZE;
+  }
+
+  idxFile.close();
+  if (!ok) sd.remove(idxPath); // don't leave a partial index behind
+  return ok;
+}
+
+bool open_index() {
+  make_idx_path();
+  if (!idxFile.open(idxPath, O_RDONLY) || !idx_valid()) {
+    idxFile.close();
+    if (!build_index() || !idxFile.open(idxPath, O_RDONLY) || !idx_valid()) {
+      idxFile.close();
+      return false;
+    }
+  }
+  return true;
+}
+
+bool read_entry(unsigned long first, unsigned long i, unsigned long &offset, byte &id) {
+  byte rec[IDX_ENTRY_SIZE];
+  if (!idxFile.seekSet(IDX_HEADER_SIZE + (first + i) * IDX_ENTRY_SIZE) ||
+      idxFile.read(rec, IDX_ENTRY_SIZE) != IDX_ENTRY_SIZE) return false;
+  offset = get_le32(rec);
+  id = rec[4];
+  return true;
+}
+
+bool lower_bound(unsigned long first, unsigned long entries, unsigned long offset, unsigned long &i) {
+  // the first of the entries at or past offset (they're in file order)
+  unsigned long lo = 0;
+  unsigned long hi = entries;
+  while (lo < hi) {
+    const unsigned long mid = lo + (hi-lo)/2;
+    unsigned long o;
+    byte id;
+    if (!read_entry(first, mid, o, id)) return false;
+    if (o < offset) lo = mid+1;
+    else hi = mid;
+  }
+  i = lo;
+  return true;
+}
+} // anonymous namespace
+
+bool blockindex_lookup(word &blk, unsigned long &offset, byte &id) {
+  if (!open_index()) return false;
+
+  bool ok = false;
+  if (countedEntries > 0) {
+    if (blk >= countedEntries) blk = countedEntries-1;
+    ok = read_entry(0, blk, offset, id);
+  }
+  idxFile.close();
+  return ok;
+}
+
+bool blockindex_jump(unsigned long from, int disp, unsigned long &offset, word &blk) {
+  if (!open_index()) return false;
+
+  const unsigned long all = (idxFile.fileSize() - IDX_HEADER_SIZE) / IDX_ENTRY_SIZE - countedEntries;
+  unsigned long i, before;
+  byte id;
+  bool ok = lower_bound(countedEntries, all, from, i) && read_entry(countedEntries, i, offset, id) && offset == from;
+  if (ok) {
+    const long target = (long)i + disp;
+    ok = target >= 0 && (unsigned long)target < all &&
+         read_entry(countedEntries, target, offset, id) &&
+         lower_bound(0, countedEntries, offset, before);
+    blk = before;
+  }
+  idxFile.close();
+  return ok;
+}
+
+#endif // BLOCK_SD_INDEX
@@ -0,0 +1,30 @@
+#ifndef BLOCKINDEX_H_INCLUDED
+#define BLOCKINDEX_H_INCLUDED
+
+#include "Arduino.h"
+#include "configs.h"
+
+// Sidecar block index for BLOCKID_NOMEM_SEARCH.
+// The first time a block is selected in a file, the whole file is walked once
+// and the start offset + ID of every block is written to /BLKIDX/<sector>.IDX
+// on the SD card.  Later jumps (in this or any later session) are one small read.
+
+#ifdef BLOCK_SD_INDEX
+
+// Look up block number blk of the currently open entry.
+// On success sets offset (file position of the block ID byte, or of the
+// length word for TAP) and id, and returns true.  If blk is past the last
+// block, blk is clamped to the last block.
+// Returns false if no index could be read or built (caller falls back to searching).
+bool blockindex_lookup(word &blk, unsigned long &offset, byte &id);
+
+// For the TZX flow control blocks (ID23 jump, ID26 call, ID27 return): the
+// block disp blocks on from the one at offset from, counting every block as
+// the TZX spec does.  Sets offset to where it starts and blk to how many
+// counted blocks come before it.  Returns false if from isn't the start of
+// a block, or the target is outside the file.
+bool blockindex_jump(unsigned long from, int disp, unsigned long &offset, word &blk);
+
+#endif // BLOCK_SD_INDEX
+
+#endif // BLOCKINDEX_H_INCLUDED
@@ -0,0 +1,86 @@
+#include "blockstore.h"
+
+#ifdef BLOCK_EEPROM_PUT
+
+#include "EEPROM_wrappers.h"
+
+#define BLOCKSTORE_RING_POS (BLOCK_EEPROM_START + 5*BLOCKSTORE_SLOTS)
+
+namespace {
+struct Pending {
+  word blk;
+  unsigned long pos;
+  byte id;
+};
+Pending pending[BLOCKSTORE_BATCH];
+byte pendingCount = 0;
+byte ringStart = 0xFF;    // 0xFF: not read from EEPROM yet
+byte ringUsed = 0;        // how many slots this tape's table has reached
+
+word slot_addr(word blk) {
+  return BLOCK_EEPROM_START + 5*((ringStart + blk) % BLOCKSTORE_SLOTS);
+}
+
+void write_oldest() {
+  const Pending &e = pending[0];
+  const word a = slot_addr(e.blk);
+  for (byte i = 0; i < 4; i++) EEPROM_update(a+i, (byte)(e.pos >> (8*i)));
+  EEPROM_update(a+4, e.id);
+  pendingCount--;
+  for (byte i = 0; i < pendingCount; i++) pending[i] = pending[i+1];
+}
+} // namespace
+
+void blockstore_begin() {
+  if (ringStart == 0xFF) {
+    EEPROM_get(BLOCKSTORE_RING_POS, ringStart);
+    if (ringStart >= BLOCKSTORE_SLOTS) ringStart = 0;   // never written
+  } else {
+    ringStart = (ringStart + ringUsed) % BLOCKSTORE_SLOTS;
+  }
+  ringUsed = 0;
+  pendingCount = 0;
+}
+
+void blockstore_put(word blk, unsigned long pos, byte id) {
+  if (ringStart == 0xFF || blk >= BLOCKSTORE_SLOTS) return;
+  if (blk >= ringUsed) ringUsed = blk+1;
+  for (byte i = 0; i < pendingCount; i++) {
+    if (pending[i].blk == blk) {
+      pending[i].pos = pos;
+      pending[i].id = id;
+      return;
+    }
+  }
+  if (pendingCount == BLOCKSTORE_BATCH) write_oldest();
+  pending[pendingCount].blk = blk;
+  pending[pendingCount].pos = pos;
+  pending[pendingCount].id = id;
+  pendingCount++;
+}
+
+void blockstore_get(word blk, unsigned long &pos, byte &id) {
+  for (byte i = 0; i < pendingCount; i++) {
+    if (pending[i].blk == blk) {
+      pos = pending[i].pos;
+      id = pending[i].id;
+      return;
+    }
+  }
+  const word a = slot_addr(blk % BLOCKSTORE_SLOTS);
+  pos = 0;
+  for (byte i = 4; i-- > 0; ) {
+    byte b;
+    EEPROM_get(a+i, b);
+    pos = (pos << 8) | b;
+  }
+  EEPROM_get(a+4, id);
+}
+
+void blockstore_flush() {
+  if (ringStart == 0xFF) return;
+  while (pendingCount) write_oldest();
+  EEPROM_update(BLOCKSTORE_RING_POS, ringStart);
+}
+
+#endif // BLOCK_EEPROM_PUT
@@ -0,0 +1,32 @@
+#ifndef BLOCKSTORE_H_INCLUDED
+#define BLOCKSTORE_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef BLOCK_EEPROM_PUT
+#include "Arduino.h"
+
+// Where each block started, for jumping back to it (BLOCK_EEPROM_PUT).
+// Entries collect in RAM and go to EEPROM a batch at a time when playback
+// pauses; only once the batch is full does one go out during playback, so
+// a run of short turbo blocks costs no more than the old one write each,
+// and usually nothing until the pause.  On the ESP8266 the writes only go
+// to its RAM copy of the flash and are never committed for this, since the
+// table doesn't need to outlive the tape.
+//
+// Each tape's table starts where the last one ended, round a ring of
+// BLOCKSTORE_SLOTS entries, so the first blocks of every tape don't keep
+// landing on the same few cells.
+
+#define BLOCKSTORE_SLOTS 100      // blocks 0-99, 5 bytes each from BLOCK_EEPROM_START, then the ring start
+#ifndef BLOCKSTORE_BATCH
+  #define BLOCKSTORE_BATCH 8
+#endif
+
+void blockstore_begin();          // a new tape: its table goes after the last one
+void blockstore_put(word blk, unsigned long pos, byte id);
+void blockstore_get(word blk, unsigned long &pos, byte &id);
+void blockstore_flush();          // write out the batch, while there's time (paused)
+#endif
+
+#endif // BLOCKSTORE_H_INCLUDED
@@ -1,19 +1,194 @@
 #include "buffer.h"
+#include "outputstats.h"
+#include "mxw.h"
+#include "sertrace.h"
 
-volatile bool morebuff = false;
-byte readpos = 0; // only used within the ISR, never accessed outside, so doesn't need to be volatile
-byte writepos = 0; // only used within the main loop, never accessed by ISR, so doesn't need to be volatile
-volatile byte wbuffer[2][buffsize];
-volatile byte * volatile writeBuffer=wbuffer[0]; // the pointer itself is volatile (since the ISR can swap readBuffer/writeBuffer)
-volatile byte * readBuffer=wbuffer[1]; // this pointer is not volatile since this pointer is only manipulated by the ISR, not code outside the ISR
+buffpos_t buffsize = BUFFER_PAGE_SMALL;
+#ifndef AVR_FAST_ISR
+buffpos_t readpos = 0; // only used within the ISR, never accessed outside, so doesn't need to be volatile
+#endif
+buffpos_t writepos = 0; // only used within the main loop, never accessed by ISR, so doesn't need to be volatile
+volatile byte wbuffer[BUFFER_PAGES*BUFFER_PAGE_MAX];
+volatile byte * writeBuffer=wbuffer; // only moved by the main loop (next_write_page)
+volatile byte * readBuffer=wbuffer+(BUFFER_PAGES-1)*BUFFER_PAGE_SMALL; // only moved by the ISR (next_read_page)
+
+// wbuffer is a ring of pages.  The main loop fills writePage, the ISR plays readPage.
+// The main loop may run ahead onto any page up to (but not including) readPage,
+// and the ISR may play any page up to (but not including) publishedPage.
+// Each of the three is a single byte with only one side writing it, so neither
+// side masks interrupts: a page belongs to the main loop until it is full and
+// published, and from then on to the ISR until it moves past it.
+// With BUFFER_PAGES == 2 this behaves like the original double buffer.
+volatile byte writePage = 0;
+volatile byte readPage = BUFFER_PAGES-1;
+volatile byte publishedPage = 0;   // main loop: writePage, or the page after it once it's full
+
+// set once the main loop has filled its first page, so the ISR waiting
+// for it during the startup pause isn't counted as an underrun
+volatile bool underrunArmed = false;
+volatile byte underruns = 0;    // ISR only, counts up (and wraps)
+bool waiting = false;           // ISR: waiting for the main loop, already counted
+
+// for buffer_played_out: pages each side has moved on to (both wrap)
+byte pagesWritten = 0;          // main loop
+volatile byte pagesRead = 0;    // ISR
+byte endPage = 0;
+
+word pendingWord = 0;
+word repeatRemaining = 0;
+word repeatPeriod = 0;
+word repeatAlt = 0;
+byte repeatPairs = 0;
+word queuedWords[3];
+byte queuedCount = 0;
+byte queuedNext = 0;
+bool pausing = false;
+
+// the pages are buffsize apart, packed at the front of wbuffer
+static inline volatile byte * page(byte p)
+{
+  return wbuffer + (word)p*buffsize;
+}
+
+void buffer_set_size(bool highRate)
+{
+  buffsize = highRate ? BUFFER_PAGE_MAX : BUFFER_PAGE_SMALL;
+}
+
+void queue_hold(bool toggle, bool high, unsigned long us)
+{
+  if (us <= SEGMENT_MAX)
+  {
+    queuedWords[queuedCount++] = SEGMENT_FLAG | (toggle ? SEGMENT_TOGGLE : (high ? SEGMENT_HIGH : 0)) | (word)us;
+    return;
+  }
+  queuedWords[queuedCount++] = LONG_PERIOD_FLAG | (toggle ? 0 : (LONG_PERIOD_SET | (high ? LONG_PERIOD_HIGH : 0)));
+  queuedWords[queuedCount++] = us >> 16;      // can be 0, so these don't go through currentPeriod
+  queuedWords[queuedCount++] = us & 0xFFFF;
+}
+
+word queued_word(void)
+{
+  const word w = queuedWords[queuedNext++];
+  if (queuedNext == queuedCount)
+  {
+    queuedNext = 0;
+    queuedCount = 0;
+  }
+  return w;
+}
 
 void clearBuffer(void)
 {
+  // the ISR only ever plays pages the main loop has filled since, so
+  // there's no need to clear the pages themselves
   noInterrupts();
-  for(byte i=0;i<buffsize;i++)
+  writePage = 0;
+  readPage = BUFFER_PAGES-1;
+  publishedPage = 0;
+  writeBuffer = page(writePage);
+  readBuffer = page(readPage);
+  readpos = buffsize;           // the ISR waits at the end of the page before the first one
+  pendingWord = 0;
+  repeatRemaining = 0;
+  repeatAlt = 0;
+  repeatPairs = 0;
+  queuedCount = 0;
+  queuedNext = 0;
+  pausing = false;
+  underrunArmed = false;
+  waiting = false;
+  pagesWritten = 0;
+  pagesRead = 0;
+  interrupts();
+}
+
+bool next_write_page(void)
+{
+  // called from the main loop when writeBuffer is full: hands it to the
+  // ISR, and moves on to the next page if the ISR isn't still playing it
+  byte nextPage = writePage+1;
+  if (nextPage == BUFFER_PAGES) nextPage = 0;
+  publishedPage = nextPage;     // after the words themselves, which are all volatile stores
+  underrunArmed = true;
+  if (nextPage == readPage) return false;
+#ifdef SERIAL_TRACE
+  trace_page(writeBuffer, buffsize);
+#endif
+  writePage = nextPage;
+  writeBuffer = page(nextPage);
+  pagesWritten++;
+  return true;
+}
+
+void buffer_mark_end(void)
+{
+  endPage = pagesWritten;
+}
+
+bool buffer_played_out(void)
+{
+  // the ISR is on a page after the one buffer_mark_end was called on
+  // (pagesRead-1 is the page it's on; the ISR is never more than
+  // BUFFER_PAGES behind, so the difference fits in a signed byte)
+#ifdef MXW_RENDER
+  if (mxwRendering) return true;   // no ISR: mxw_render writes each page out as it fills
+#endif
+  return (int8_t)(pagesRead - endPage) >= 2;
+}
+
+bool buffer_has_room(void)
+{
+  // called from the main loop: is there still a page (or the rest of one)
+  // for TZXLoop to fill, or is everything up to readPage full?
+  if (writepos < buffsize) return true;
+  byte nextPage = writePage+1;
+  if (nextPage == BUFFER_PAGES) nextPage = 0;
+  return nextPage != readPage;
+}
+
+#ifdef INSTANT_PLAY
+void start_on_write_page(void)
+{
+  // called before the timer is started, once the main loop has filled
+  // writeBuffer: the ISR plays it straight away, since clearBuffer leaves
+  // the ISR waiting just in front of it
+  if (next_write_page()) writepos = 0;
+}
+#endif
+
+ISR_CODE bool read_page_ready(void)
+{
+  // from the ISR: has the main loop published the page after readPage?
+  byte nextPage = readPage+1;
+  if (nextPage == BUFFER_PAGES) nextPage = 0;
+  if (nextPage != publishedPage) return true;
+  if (underrunArmed && !waiting)
   {
-    wbuffer[0][i]=0;
-    wbuffer[1][i]=0;
+    // underrun: the main loop hasn't finished it.  The ISR holds the output
+    // where it is until the page is ready, rather than play a part-written one;
+    // it never writes the page itself, so nothing here costs more than a compare
+    waiting = true;
+    underruns++;
+#ifdef OUTPUT_STATS
+    stats_underrun();
+#endif
   }
-  interrupts();
+  return false;
+}
+
+ISR_CODE bool next_read_page(void)
+{
+  // called from the ISR when it has played the whole of readBuffer
+  if (!read_page_ready()) return false;
+  byte nextPage = readPage+1;
+  if (nextPage == BUFFER_PAGES) nextPage = 0;
+  readPage = nextPage;
+  readBuffer = page(nextPage);
+  pagesRead++;
+  waiting = false;
+#ifdef OUTPUT_STATS
+  stats_page_swap((writePage + BUFFER_PAGES - nextPage) % BUFFER_PAGES, nextPage == writePage);
+#endif
+  return true;
 }
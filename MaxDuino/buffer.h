@@ -3,21 +3,97 @@
 
 #include "Arduino.h" // for types
 #include "configs.h"
+#include "hwconfig.h"
 
 /* With latest casprocessing logic, buffsize can be any multiple of 2.
+   It is the page size for the file being played, set by buffer_set_size
+   (see BUFFER_PAGE_MAX in hwconfig.h).
 */
-#ifdef LARGEBUFFER
-  #define buffsize 254
+#if BUFFER_PAGE_MAX > 255
+  typedef word buffpos_t;
 #else
-  #define buffsize 176
+  typedef byte buffpos_t;   // the small AVRs keep 8-bit positions in the ISR
 #endif
+#if (BUFFER_PAGE_MAX % 2) || (BUFFER_PAGE_SMALL % 2) || BUFFER_PAGE_SMALL > BUFFER_PAGE_MAX
+  #error BUFFER_PAGE_MAX and BUFFER_PAGE_SMALL must be even, and SMALL no bigger than MAX
+#endif
+
+// Buffer word encodings, besides a plain pulse period (0..0x3FFF us) and
+// the direct recording words (see wave2):
+//   10thnnnnnnnnnnnn             timed segment: toggle the output (t), or else set it
+//                                high (h) or low, then hold it for n us.  For short
+//                                pauses, and the edge that starts a pause
+//   111ppppppppppppp             pulse pair: two edges of p us each (p < 0x2000)
+//   11000nnnnnnnnnnn pppp...     repeat: n edges of the period in the next word (n > 0).
+//                                wave2 runs the whole count itself, so a pilot or a tone
+//                                takes a few words rather than a word per pulse
+//   110sh00000000000 hhhhhhhhhhhhhhhh llllllllllllllll
+//                                long period (a repeat with n == 0): toggle the output, or
+//                                with s set it high (h) or low, then hold it for the 32 bit
+//                                count of us in the next two words.  For long pauses and
+//                                C64 long pulses; the timer runs it in one go
+//   1101000nnnnnnnnn aaaaaaaabbbbbbbb
+//                                alternating repeat: n edges, a then b then a ... in 2us
+//                                units, for runs of pulses with unequal halves
+//   1101100nnnnnnnnn aaaaaaaabbbbbbbb
+//                                alternating pairs: n edges, a a b b a a ..., for runs of
+//                                alternating short and long pulses (Dragon leaders)
+#define PULSE_PAIR_FLAG     0xE000
+#define PULSE_REPEAT_FLAG   0xC000
+#define PULSE_FLAG_MASK     0xE000
+#define PULSE_PAIR_MAX      0x1FFF
+#define PULSE_REPEAT_MAX    255      // what the players that count in bytes ask for at once
+#define PULSE_TONE_MAX      0x07FF   // the most one repeat word can hold (clearBuffer ends it early on a block jump)
+#define PULSE_REPEAT_ALT    0x1000
+#define PULSE_REPEAT_ALT_SHIFT 1
+#define PULSE_REPEAT_PAIRS  0x0800   // with PULSE_REPEAT_ALT
+#define SEGMENT_FLAG        0x8000
+#define SEGMENT_MASK        0xC000
+#define SEGMENT_TOGGLE      0x2000
+#define SEGMENT_HIGH        0x1000
+#define SEGMENT_MAX         0x0FFF
+#define LONG_PERIOD_FLAG    0xC000
+#define LONG_PERIOD_MASK    0xE7FF
+#define LONG_PERIOD_SET     0x1000
+#define LONG_PERIOD_HIGH    0x0800
+
+extern word pendingWord;         // second word of a repeat, written by the main loop on its next pass
+extern word repeatRemaining;     // ISR: edges left in the current repeat
+extern word repeatPeriod;        // ISR: period of the current repeat
+extern word repeatAlt;           // ISR: the other period of an alternating repeat, 0 if not
+extern byte repeatPairs;         // ISR: alternating pairs: 1 before the first edge of a pair, 2 before the second, 0 if not
+extern byte queuedCount;         // main loop: words queued by queue_hold, still to be written
+extern bool pausing;             // main loop: the last word it wrote was part of a pause
 
-extern volatile bool morebuff;
-extern byte readpos;
-extern byte writepos;
-extern volatile byte wbuffer[2][buffsize];
-extern volatile byte * volatile writeBuffer;
+extern volatile byte underruns;  // ISR: times it had to wait for the main loop to finish a page (counts up, and wraps)
+extern buffpos_t buffsize;
+#ifdef AVR_FAST_ISR
+  #define readpos GPIOR1   // for the assembly fast path (see TimerCounter.cpp)
+#else
+extern buffpos_t readpos;
+#endif
+extern buffpos_t writepos;
+extern volatile byte wbuffer[BUFFER_PAGES*BUFFER_PAGE_MAX];
+extern volatile byte * writeBuffer;
 extern volatile byte * readBuffer;
+void buffer_set_size(bool highRate);   // before clearBuffer, with the timer stopped
+// Queue a hold of the output for us (toggled, or set high or low): a segment
+// if it's short enough, a long period otherwise.  The main loop writes the
+// queued words ahead of anything else (see queued_word)
+void queue_hold(bool toggle, bool high, unsigned long us);
+word queued_word(void);
 void clearBuffer(void);
+bool next_write_page(void);
+bool buffer_has_room(void);
+// At the end of a file the players pad the output until everything before
+// the padding has played, since the ISR never plays a page that isn't full:
+// buffer_mark_end after the last real word, then pad on until buffer_played_out
+void buffer_mark_end(void);
+bool buffer_played_out(void);
+bool read_page_ready(void);   // ISR
+bool next_read_page(void);    // ISR: false if it has to wait for the main loop
+#ifdef INSTANT_PLAY
+void start_on_write_page(void);
+#endif
 
 #endif // BUFFER_H_INCLUDED
@@ -2,6 +2,9 @@
 #include "Arduino.h"
 #include "buttons.h"
 #include "pinSetup.h"
+#include "MaxDuino.h"
+#include "MaxProcessing.h"
+#include "record.h"
 
 bool lastbtn=true;
 
@@ -123,10 +126,24 @@ bool button_rec() {
 
 
 // common:
+// Wait one 50ms debounce step, but keep the buffer (or the recorder) fed
+// meanwhile, the same as loop() would.  Holding a key down (e.g. PLAY to
+// unpause, REC to resume) then never starves the output.
+void button_wait() {
+  const unsigned long t = millis();
+  do {
+    if (start==1) {
+      UniLoop();
+    } else if (is_recording()) {
+      recording_loop();
+    }
+  } while (millis() - t < 50);
+}
+
 void debounce(bool (*button_fn)()) {
   while(button_fn()) {
     //prevent button repeats by waiting until the button is released.
-    delay(50);
+    button_wait();
   }
 }
 
@@ -137,12 +154,12 @@ void debouncemax(bool (*button_fn)())
   for(byte i=4; i>0; i--)
   {
     if (!button_fn()) break;
-    delay(50);
+    button_wait();
   }
 }
 
 void checkLastButton()
 {
   if(!button_down() && !button_up() && !button_play() && !button_stop()) lastbtn=false; 
-  delay(50);
+  button_wait();
 }
@@ -16,6 +16,7 @@ bool button_root();
 bool button_rec();
 #endif
 
+void button_wait();
 void debounce(bool (*)());
 void debouncemax(bool (*)());
 
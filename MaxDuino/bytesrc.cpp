@@ -0,0 +1,91 @@
+#include "configs.h"
+#include "bytesrc.h"
+#include "file_utils.h"
+
+namespace {
+enum class PIECE : byte { RAM, FILL, FILE, FUNC, XORSUM };
+
+struct BYTESRC_PIECE {
+  PIECE kind;
+  byte value;           // FILL
+  const byte *ptr;      // RAM
+  byte (*fn)();         // FUNC
+  word len;             // bytes still to come
+};
+
+BYTESRC_PIECE pieces[BYTESRC_MAX];
+byte pieceCount = 0;
+byte head = 0;          // piece being played
+byte sum = 0;
+
+void push(PIECE kind, const byte *p, byte value, word len, byte (*fn)() = nullptr) {
+  if (len == 0 || pieceCount >= BYTESRC_MAX) return;
+  BYTESRC_PIECE &piece = pieces[pieceCount++];
+  piece.kind = kind;
+  piece.value = value;
+  piece.ptr = p;
+  piece.fn = fn;
+  piece.len = len;
+}
+} // namespace
+
+void bytesrc_clear() {
+  pieceCount = 0;
+  head = 0;
+  sum = 0;
+}
+
+void bytesrc_ram(const byte *p, word len) {
+  push(PIECE::RAM, p, 0, len);
+}
+
+void bytesrc_fill(byte value, word count) {
+  push(PIECE::FILL, nullptr, value, count);
+}
+
+void bytesrc_file(word len) {
+  push(PIECE::FILE, nullptr, 0, len);
+}
+
+void bytesrc_func(byte (*next)(), word len) {
+  push(PIECE::FUNC, nullptr, 0, len, next);
+}
+
+void bytesrc_xorsum() {
+  push(PIECE::XORSUM, nullptr, 0, 1);
+}
+
+bool bytesrc_queued() {
+  return pieceCount != 0;
+}
+
+bool bytesrc_next(byte &b) {
+  while (head < pieceCount) {
+    BYTESRC_PIECE &piece = pieces[head];
+    switch (piece.kind) {
+      case PIECE::RAM:
+        b = *piece.ptr++;
+        break;
+      case PIECE::FILL:
+        b = piece.value;
+        break;
+      case PIECE::FILE:
+        if (!ReadByte()) {
+          head++;             // on to whatever follows the file
+          continue;
+        }
+        b = outByte;
+        break;
+      case PIECE::FUNC:
+        b = piece.fn();
+        break;
+      case PIECE::XORSUM:
+        b = sum;
+        break;
+    }
+    if (--piece.len == 0) head++;
+    sum ^= b;
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,29 @@
+#ifndef BYTESRC_H_INCLUDED
+#define BYTESRC_H_INCLUDED
+
+#include "Arduino.h"
+
+// Where a block's data bytes come from, when they aren't just the file:
+// a flag byte the file leaves out, a header made up in RAM, a checksum.
+// The block queues its pieces in order when it starts and then pulls
+// every byte through bytesrc_next(), so nothing has to roll bytesRead or
+// bytesToRead back to slip a byte in.  File pieces are read with ReadByte,
+// so they still come out of the read-ahead.
+
+#define BYTESRC_MAX 3       // pieces per block
+
+void bytesrc_clear();
+void bytesrc_ram(const byte *p, word len);   // len bytes from RAM (left alone while they play)
+void bytesrc_fill(byte value, word count);   // count copies of one byte
+void bytesrc_file(word len);                 // len bytes of the file, from bytesRead on
+void bytesrc_func(byte (*next)(), word len);  // len bytes from next(), for data worked out as it plays
+void bytesrc_xorsum();                       // XOR of every byte pulled since bytesrc_clear
+
+// true from the first piece queued until bytesrc_clear
+bool bytesrc_queued();
+
+// The next byte, false once all the pieces are used up.  A file piece that
+// runs into the end of the file is cut short.
+bool bytesrc_next(byte &b);
+
+#endif // BYTESRC_H_INCLUDED
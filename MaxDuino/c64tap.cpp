@@ -4,6 +4,7 @@
 
 #include <string.h>
 
+#include "buffer.h"
 #include "file_utils.h"
 #include "processing_state.h"
 #include "MaxDuino.h"
@@ -15,7 +16,12 @@ constexpr byte C64TAP_HEADER_SIZE = 20;
 constexpr byte C64TAP_VERSION_V0 = 0;
 constexpr byte C64TAP_VERSION_V2 = 2;
 constexpr word C64TAP_MAX_INLINE_US = 0x3FFF;
-constexpr word C64TAP_LONG_PULSE_OPCODE = 0xC000;
+// v2 half-waves: two short ones in one word, 1aaaaaaabbbbbbbb in 4us units
+// (b is never 0, so this can't be a long period)
+constexpr word C64TAP_HALF_PAIR_FLAG = 0x8000;
+constexpr byte C64TAP_HALF_PAIR_SHIFT = 2;
+constexpr word C64TAP_HALF_PAIR_MAX_A = 0x7F;
+constexpr word C64TAP_HALF_PAIR_MAX_B = 0xFF;
 
 constexpr byte C64TAP_MACHINE_C64 = 0;
 constexpr byte C64TAP_MACHINE_VIC = 1;
@@ -30,10 +36,12 @@ byte c64tapVersion = 0;
 byte c64tapMachine = C64TAP_MACHINE_C64;
 byte c64tapVideo = C64TAP_VIDEO_PAL;
 unsigned long c64tapEndPos = C64TAP_HEADER_SIZE;
-unsigned long c64tapSavedPeriod = 0;
+unsigned long c64tapUsPerCycle = 0;     // 16.16 fixed point, from cycles_per_second()
+word c64tapFraction = 0;                // part of a us left over from the last pulse, 16 bit fraction
+unsigned long c64tapCarryUs = 0;        // what a half-wave pair couldn't express in its 4us units
+unsigned long c64tapSavedCycles = 0;    // second half of a v0/v1 pulse
 bool c64tapEmitSavedPeriod = false;
-unsigned long c64tapPendingLongPeriodUs = 0;
-byte c64tapPendingLongStage = 0;
+unsigned long c64tapSavedUs = 0;        // v2 half-wave read ahead that couldn't be paired
 
 bool header_matches(const byte *header, const char *magic) {
   for (byte i = 0; i < 12; ++i) {
@@ -63,22 +71,23 @@ unsigned long cycles_per_second() {
   }
 }
 
-unsigned long cycles_to_us(const unsigned long cycles) {
-  const unsigned long cps = cycles_per_second();
-  const unsigned long long numerator = (unsigned long long)cycles * 1000000ULL + (cps / 2);
-  const unsigned long periodUs = (unsigned long)(numerator / cps);
+unsigned long cycles_to_us(unsigned long cycles) {
+  // cycles * us per cycle, with no divide.  Whatever fraction of a us is
+  // left over is carried into the next pulse, so rounding never builds up
+  // over a long run of pulses.  The top bits (only set for 24 bit v1/v2
+  // lengths) are multiplied separately so nothing overflows 32 bits.
+  if (cycles > 0xFFFFFFUL) {
+    cycles = 0xFFFFFFUL;
+  }
+  const unsigned long hi = (cycles >> 15) * c64tapUsPerCycle;                // in 1/2 us
+  const unsigned long lo = (cycles & 0x7FFFUL) * c64tapUsPerCycle + c64tapFraction + ((hi & 1) << 15);
+  c64tapFraction = (word)lo;
+  const unsigned long periodUs = (hi >> 1) + (lo >> 16) + c64tapCarryUs;
+  c64tapCarryUs = 0;
   return (periodUs == 0) ? 1UL : periodUs;
 }
 
-unsigned long clamp_half_period(const unsigned long fullPeriodUs) {
-  unsigned long halfPeriodUs = fullPeriodUs / 2;
-  if (halfPeriodUs == 0) {
-    halfPeriodUs = 1UL;
-  }
-  return halfPeriodUs;
-}
-
-bool read_next_period(unsigned long &periodUs) {
+bool read_next_cycles(unsigned long &cycles) {
   if (bytesRead >= c64tapEndPos) {
     return false;
   }
@@ -87,7 +96,7 @@ bool read_next_period(unsigned long &periodUs) {
     return false;
   }
 
-  unsigned long cycles = 0;
+  cycles = 0;
   if (outByte != 0) {
     cycles = (unsigned long)outByte * 8UL;
   } else if (c64tapVersion == C64TAP_VERSION_V0) {
@@ -98,8 +107,6 @@ bool read_next_period(unsigned long &periodUs) {
     }
     cycles = outLong;
   }
-
-  periodUs = cycles_to_us(cycles);
   return true;
 }
 
@@ -114,41 +121,57 @@ void set_header_state(const byte *header, unsigned long fileSize) {
   const unsigned long availableLength = (fileSize >= C64TAP_HEADER_SIZE) ? (fileSize - C64TAP_HEADER_SIZE) : 0;
   const unsigned long dataLength = (declaredLength <= availableLength) ? declaredLength : availableLength;
   c64tapEndPos = C64TAP_HEADER_SIZE + dataLength;
-  c64tapSavedPeriod = 0;
+  // the machine's clock only changes with the file, so the ratio is
+  // worked out once here rather than dividing for every pulse
+  const unsigned long cps = cycles_per_second();
+  c64tapUsPerCycle = (unsigned long)(((1000000ULL << 16) + cps / 2) / cps);
+  c64tapFraction = 0;
+  c64tapCarryUs = 0;
+  c64tapSavedCycles = 0;
   c64tapEmitSavedPeriod = false;
-  c64tapPendingLongPeriodUs = 0;
-  c64tapPendingLongStage = 0;
-}
-
-void begin_long_pulse_output(const unsigned long periodUs) {
-  c64tapPendingLongPeriodUs = periodUs;
-  c64tapPendingLongStage = 2;
-  currentPeriod = C64TAP_LONG_PULSE_OPCODE;
+  c64tapSavedUs = 0;
 }
 
-void emit_period(const unsigned long periodUs) {
+void emit_us(const unsigned long periodUs) {
   if (periodUs <= C64TAP_MAX_INLINE_US) {
     currentPeriod = (word)periodUs;
-  } else {
-    begin_long_pulse_output(periodUs);
+    return;
   }
+
+  // long pulse: an edge and then a long period, which TZXLoop writes on
+  // its next passes
+  queue_hold(true, false, periodUs);
+  currentPeriod = 0;
 }
 
-bool emit_pending_long_pulse_word() {
-  if (c64tapPendingLongStage == 0) {
-    return false;
+void emit_cycles(const unsigned long cycles) {
+  emit_us(cycles_to_us(cycles));
+}
+
+void emit_half_waves(const unsigned long firstUs) {
+  // v2: try to put this half-wave and the next in one word, which halves
+  // the buffer used by the short pulses of turbo loaders.  Both are cut
+  // to 4us units (the TAP itself is in 8 cycle steps), the remainder
+  // carried on as usual.
+  const unsigned long a = firstUs >> C64TAP_HALF_PAIR_SHIFT;
+  unsigned long cycles = 0;
+  if (a == 0 || a > C64TAP_HALF_PAIR_MAX_A || !read_next_cycles(cycles)) {
+    emit_us(firstUs);
+    return;
   }
 
-  if (c64tapPendingLongStage == 2) {
-    currentPeriod = (word)(c64tapPendingLongPeriodUs & 0xFFFFUL);
-    c64tapPendingLongStage = 1;
-  } else {
-    currentPeriod = (word)((c64tapPendingLongPeriodUs >> 16) & 0xFFFFUL);
-    c64tapPendingLongPeriodUs = 0;
-    c64tapPendingLongStage = 0;
+  const unsigned long aRest = firstUs - (a << C64TAP_HALF_PAIR_SHIFT);
+  const unsigned long secondUs = cycles_to_us(cycles);
+  const unsigned long b = (secondUs + aRest) >> C64TAP_HALF_PAIR_SHIFT;
+  if (b == 0 || b > C64TAP_HALF_PAIR_MAX_B) {
+    // doesn't fit, so both go out as they are
+    emit_us(firstUs);
+    c64tapSavedUs = secondUs;
+    return;
   }
 
-  return true;
+  c64tapCarryUs = (secondUs + aRest) - (b << C64TAP_HALF_PAIR_SHIFT);
+  currentPeriod = C64TAP_HALF_PAIR_FLAG | (word)(a << 8) | (word)b;
 }
 
 } // namespace
@@ -180,18 +203,20 @@ void c64tap_init() {
 }
 
 void c64tap_process() {
-  if (emit_pending_long_pulse_word()) {
+  if (c64tapSavedUs) {
+    emit_us(c64tapSavedUs);
+    c64tapSavedUs = 0;
     return;
   }
 
   if (c64tapEmitSavedPeriod) {
-    emit_period(c64tapSavedPeriod);
+    emit_cycles(c64tapSavedCycles);
     c64tapEmitSavedPeriod = false;
     return;
   }
 
-  unsigned long periodUs = 0;
-  if (!read_next_period(periodUs)) {
+  unsigned long cycles = 0;
+  if (!read_next_cycles(cycles)) {
     currentID = BLOCKID::IDEOF;
     return;
   }
@@ -199,13 +224,14 @@ void c64tap_process() {
   // TAP v0/v1 stores the time between successive edges, i.e. a full pulse period.
   // MaxDuino emits one timer interval per edge transition, so those formats must
   // be split into two equal half-waves. TAP v2 already stores half-wave lengths.
+  // The split is done in cycles, so an odd length isn't rounded twice.
   if (c64tapVersion != C64TAP_VERSION_V2) {
-    const unsigned long halfPeriodUs = clamp_half_period(periodUs);
-    emit_period(halfPeriodUs);
-    c64tapSavedPeriod = halfPeriodUs;
+    const unsigned long firstHalf = cycles / 2;
+    emit_cycles(firstHalf);
+    c64tapSavedCycles = cycles - firstHalf;
     c64tapEmitSavedPeriod = true;
   } else {
-    emit_period(periodUs);
+    emit_half_waves(cycles_to_us(cycles));
   }
 }
 
@@ -9,10 +9,13 @@
 #include "file_utils.h"
 #include "isr.h"
 #include "casProcessing.h"
+#include "MaxProcessing.h"
 #include "buffer.h"
 #include "processing_state.h"
 #include "current_settings.h"
 #include "TimerCounter.h"
+#include "MaxDuino.h"
+#include "rateprobe.h"
 
 word bitword;
 byte fileStage=0;
@@ -22,9 +25,136 @@ CAS_TYPE cas_currentType = CAS_TYPE::Nothing;
 
 byte cas_scale; // gets set when you call setBaud
 byte cas_period; // gets set when you call setBaud
+byte cas_frac;   // and the fraction of a us on top, in 1/256ths
+#ifdef CAS_TURBO_LOADER
+byte casFileNo = 0;             // files started: the first is the loader, at Baud Rate
+#endif
+#if defined(CAS_TURBO_LOADER) || defined(LIVE_BAUD)
+bool casRatePending = false;    // the rate has changed, and the ISR needs telling
+#endif
 
 PROGMEM const byte HEADER[8] = { 0x1F, 0xA6, 0xDE, 0xBA, 0xCC, 0x13, 0x7D, 0x74 };
 
+// Output levels (1 = high, first level in the top bit) for the next two bits
+// of bitword, lowest bit first.  "0" is ___/""" and "1" is _/"\_/"
+PROGMEM const byte CAS_PAIR_LEVELS[4] = { 0x33, 0x53, 0x35, 0x55 };
+
+#if defined(Use_DRAGON)
+// Same for DRAGONMODE, where a "1" is a single short pulse _/" (2 levels).
+// Indexed by the next four bits of bitword, each entry packs as many whole
+// bits as fit in 8 levels:  uuuunnnnbbbbbbbb = bits used, number of levels, levels
+#if defined(Use_Dragon_sLeader)
+bool leaderPrimed = false;   // the last byte out was a 0x55, see writeLeader
+#endif
+PROGMEM const word DRAGON_LEVELS[16] = {
+  0x2833, 0x264C, 0x2634, 0x3853, 0x2833, 0x384D, 0x3835, 0x3654,
+  0x2833, 0x264C, 0x2634, 0x3853, 0x2833, 0x384D, 0x3835, 0x4855,
+};
+#endif
+
+// Where the blocks start, found by one pass over the file when it opens
+// (cas_scan).  For CASDUINO these are the headers: playback then knows each
+// one is coming rather than comparing 8 bytes against HEADER at every byte,
+// and if there are more than CAS_MAX_BLOCKS the rest are found the old way.
+// For DRAGONMODE they are the leaders before each name file block, so a
+// block jump goes to the start of a file.
+unsigned long casBlocks[CAS_MAX_BLOCKS];
+byte casBlockCount = 0;
+byte casNextBlock = 0;          // the first block not yet started
+unsigned long casScanEnd = 0;   // casBlocks has every header before here
+
+void cas_scan()
+{
+  casBlockCount = 0;
+  casNextBlock = 0;
+  casScanEnd = 0;
+  unsigned long p = 0;
+  byte matched = 0;
+#if defined(Use_DRAGON)
+  unsigned long runStart = 0;   // where the latest run of 0x55 began
+  unsigned long last = 0;       // the last 4 bytes, newest lowest
+#endif
+  byte n;
+  while ((n = readfile(16, p)) > 0) {
+    for (byte i = 0; i < n; i++) {
+      const byte b = filebuffer[i];
+      unsigned long at;
+#if defined(Use_DRAGON)
+      if (casduino == CASDUINO_FILETYPE::DRAGONMODE) {
+        // leader, sync, block type 0 (name file) and its length, 15
+        if (b == 0x55 && (byte)last != 0x55) runStart = p + i;
+        last = (last << 8) | b;
+        if (last != 0x553C000FUL) continue;
+        at = runStart;
+      }
+      else
+#endif
+      {
+        // a rolling match: the bytes of HEADER are all different, so on a
+        // mismatch the only partial match left is a new first byte
+        if (b != pgm_read_byte(HEADER + matched)) {
+          matched = (b == pgm_read_byte(HEADER)) ? 1 : 0;
+          continue;
+        }
+        if (++matched < 8) continue;
+        matched = 0;
+        at = p + i - 7;
+      }
+      if (casBlockCount == CAS_MAX_BLOCKS) {
+        casScanEnd = at;
+        return;
+      }
+      casBlocks[casBlockCount++] = at;
+    }
+    p += n;
+  }
+  casScanEnd = 0xFFFFFFFFUL;
+}
+
+bool cas_header_here()
+{
+  // is there a HEADER at bytesRead?
+  if (bytesRead < casScanEnd) {
+    while (casNextBlock < casBlockCount && casBlocks[casNextBlock] < bytesRead) casNextBlock++;
+    if (casNextBlock == casBlockCount || casBlocks[casNextBlock] != bytesRead) return false;
+    // a new block: count and show it, as the tape formats do
+    block_mem_oled();
+    casNextBlock++;
+    return true;
+  }
+  return readfile(8,bytesRead)==8 && !memcmp_P(filebuffer, HEADER,8);
+}
+
+bool cas_jump_block(word &blk)
+{
+  if (casduino == CASDUINO_FILETYPE::NONE || casBlockCount == 0) return false;
+  if (blk >= casBlockCount) blk = casBlockCount-1;
+  // start again from there, as at the start of the file
+  bytesRead = casBlocks[blk];
+  casNextBlock = blk;
+  currentBit = 0;
+  fileStage = 0;
+  cas_currentType = CAS_TYPE::Nothing;
+  currentTask = TASK::GETFILEHEADER;
+#ifdef CAS_TURBO_LOADER
+  // the loader is the first two blocks, its header and its data
+  if (blk <= 1 && casFileNo >= 2) {
+    cas_rate(BAUDRATE);
+    casRatePending = true;
+  }
+  casFileNo = (blk <= 1) ? 0 : 1;
+#endif
+#if defined(Use_DRAGON)
+  if (casduino == CASDUINO_FILETYPE::DRAGONMODE) {
+    count_r = 255;
+  #if defined(Use_Dragon_sLeader)
+    leaderPrimed = false;
+  #endif
+  }
+#endif
+  return true;
+}
+
 bool cas_file_match(const byte matchval)
 {
   // simply return true if all bytes between filebuffer and filebuffer+9
@@ -34,6 +164,23 @@ bool cas_file_match(const byte matchval)
   return true;
 }
 
+#ifdef DIRECT_RUNS
+byte casRunFrac = 0;
+
+void cas_run_out(bool high, word run, word sample256)
+{
+  // run samples at one level as a segment word, the fraction of a us carried on
+  const unsigned long t = (unsigned long)run * sample256 + casRunFrac;
+  casRunFrac = t & 0xFF;
+  const word us = (t >> 8) ? (t >> 8) : 1;
+  const word w = SEGMENT_FLAG | (high ? SEGMENT_HIGH : 0) | us;
+  volatile byte * _wb = writeBuffer+writepos;
+  *_wb = w >> 8;
+  *(_wb+1) = w & 0xFF;
+  writepos+=2;
+}
+#endif
+
 void bits_to_pulses()
 {
   // converts from a packed representation of bits to output (bitword)
@@ -72,73 +219,104 @@ void bits_to_pulses()
   // ||+-- always 0
   // |+-- always 1
   // +-- always 0
+  //
+  // Rather than building that up one level at a time, the levels come from
+  // lookup tables: CAS_PAIR_LEVELS gives the 8 levels of the next two bits, and
+  // DRAGON_LEVELS gives as many whole bits of the next four as fit in 8 levels
+  // (a DRAGONMODE "1" is only 2 levels, so anything from 2 to 4 bits).
+  // A bit is never split across output words, so nbits may be less than 8.
+  // Output words are written until bitword runs out or the buffer is full.
+  //
+  // With DIRECT_RUNS the levels go out as one held period (a segment word)
+  // per run of samples at one level instead, so the ISR only sees the edges.
+  // A run is cut at the end of each call, which for a CAS byte is an edge
+  // anyway (stop bits end high, the start bit starts low).
 
-  byte bits = 0;
-  byte bitpos = 1<<7;
-  byte nbits = 0;
-  while(bitpos>0 && currentBit!=0)
+#ifdef DIRECT_RUNS
+  const word sample256 = word(cas_period, cas_frac);
+  const word runMax = SEGMENT_MAX / (cas_period + 1);   // the longest run one segment word holds
+  bool runHigh = false;
+  word run = 0;
+  while (currentBit!=0 && writepos+2*9<=buffsize)   // room for a group's runs and the one before
+#else
+  while (currentBit!=0 && writepos<buffsize)
+#endif
   {
-    while (pass<4 && bitpos>0)
+    byte bits;
+    byte nbits;
+    byte used;
+
+    if (bitword & 0x8000)
     {
-      if (bitword & 0x8000)
+      // signifies 'force low', rather than a bit to be output as a pattern
+      used = (currentBit >= 2) ? 2 : 1;
+      nbits = used * 4;
+      bits = 0;
+    }
+  #if defined(Use_DRAGON)
+    else if (casduino == CASDUINO_FILETYPE::DRAGONMODE)
+    {
+      const word levels = pgm_read_word(&DRAGON_LEVELS[bitword & 0x0F]);
+      used = levels >> 12;
+      if (used <= currentBit)
       {
-        // signifies 'force low', rather than a bit to be output as a pattern
-        if (invert) bits |= bitpos;
+        nbits = (levels >> 8) & 0x0F;
+        bits = levels & 0xFF;
       }
       else
       {
-        switch (bitword & 0x0001) {
-          case 0:
-            if(pass==0 || pass==1) {
-              if (invert) bits |= bitpos;
-            } else {
-              if (!invert) bits |= bitpos;
-            }
-            break;
-
-          case 1:
-            if(pass==0 || pass==2) {
-              if (invert) bits |= bitpos;
-            } else {
-              if (!invert) bits |= bitpos;
-            }
-            #if defined(Use_DRAGON)
-            if(casduino == CASDUINO_FILETYPE::DRAGONMODE && pass == 1) {
-              pass=3;
-            }
-            #endif
-            break;
-        }
+        // fewer bits left than the table entry covers, so do just the next one
+        used = 1;
+        nbits = (bitword & 0x0001) ? 2 : 4;
+        bits = (bitword & 0x0001) ? 0x40 : 0x30;
       }
-
-      bitpos>>=1;
-      nbits++;
-      pass++;
     }
-
-    if(pass==4)
+  #endif
+    else
     {
-      pass=0;
-      if (currentBit)
+      if (currentBit >= 2)
       {
-        currentBit--;
-        if (!(bitword & 0x8000))
-          bitword >>= 1;
+        used = 2;
+        nbits = 8;
+        bits = pgm_read_byte(&CAS_PAIR_LEVELS[bitword & 0x0003]);
+      }
+      else
+      {
+        used = 1;
+        nbits = 4;
+        bits = pgm_read_byte(&CAS_PAIR_LEVELS[bitword & 0x0001]) & 0xF0;
       }
     }
-  }
 
-  if (nbits)
-  {
-    // we have >0 (at most 8) pulse levels for some bits(s), so put this in the output buffer
-    // and move on to the next bit(s)
+    if (invert) bits = ~bits; // levels past nbits are never played, so it doesn't matter what they hold
+
+    currentBit -= used;
+    if (!(bitword & 0x8000))
+      bitword >>= used;
+
+  #ifdef DIRECT_RUNS
+    for (; nbits; nbits--, bits <<= 1)
+    {
+      const bool high = bits & 0x80;
+      if (run && (high != runHigh || run == runMax))
+      {
+        cas_run_out(runHigh, run, sample256);
+        run = 0;
+      }
+      runHigh = high;
+      run++;
+    }
+  #else
+    // put this in the output buffer and move on to the next bit(s)
     volatile byte * _wb = writeBuffer+writepos;
-    noInterrupts();                       //Pause interrupts while we add a period to the buffer
     *_wb = 0x40 + (nbits-1); // = (1<<14)>>8;
     *(_wb+1) = bits;
-    interrupts();
     writepos+=2;
+  #endif
   }
+#ifdef DIRECT_RUNS
+  if (run) cas_run_out(runHigh, run, sample256);
+#endif
 }
 
 void writeByte(byte b)
@@ -177,6 +355,9 @@ void writeByte(byte b)
     //                   \______/
     //                     data
     bitword = b;
+  #if defined(Use_Dragon_sLeader)
+    leaderPrimed = (b == 0x55);
+  #endif
   }
 #endif
 }
@@ -186,6 +367,9 @@ void writeSilence()
   // write a 'low' output
   bitword = 0x8000;
   currentBit = (byte)casduino;
+#if defined(Use_DRAGON) && defined(Use_Dragon_sLeader)
+  leaderPrimed = false;
+#endif
 }
 
 void writeHeader()
@@ -199,17 +383,19 @@ void process()
 {
   if(cas_currentType==CAS_TYPE::typeEOF)
   {
-    if(count_r) {
+    if(count_r==0 && buffer_played_out()) {
+      fileEnded();
+    } else {
       writeSilence();
-      count_r--;
-    } else stopFile();    
+      if(count_r!=0 && --count_r==0) buffer_mark_end();
+    }
     return;
   }
   if(currentTask==TASK::GETFILEHEADER || currentTask==TASK::CAS_wData)
   {
-    if(readfile(8,bytesRead))
+    if(readfile(1,bytesRead))
     {
-      if(!memcmp_P(filebuffer, HEADER,8)) {
+      if(cas_header_here()) {
         if(fileStage==0) 
         {
           currentTask = TASK::CAS_lookType;
@@ -232,6 +418,16 @@ void process()
 
   if(currentTask==TASK::CAS_lookType)
   {
+  #ifdef CAS_TURBO_LOADER
+    if (casFileNo < 2 && ++casFileNo == 2 && CASBAUDRATE) {
+      // the loader has gone: the rest at CAS Baud
+      cas_rate(CASBAUDRATE);
+      casRatePending = true;
+    }
+  #endif
+  #ifdef LIVE_BAUD
+    if (LiveBaudApply()) cas_baud_changed();
+  #endif
     currentTask = TASK::CAS_wSilence;
     count_r = LONG_SILENCE*cas_scale;
     fileStage=1;       
@@ -265,11 +461,17 @@ void process()
       {
         //count_r=LONG_HEADER*cas_scale;
         count_r=LONG_HEADER; 
+        #ifdef PILOT_TRIM
+        count_r=PILOT_TRIM_CAS*cas_scale;
+        #endif
         fileStage+=1;
       } else 
       {
         count_r=SHORT_HEADER*cas_scale;
         //count_r=SHORT_HEADER;
+        #ifdef PILOT_TRIM
+        if(count_r>PILOT_TRIM_CAS*cas_scale) count_r=PILOT_TRIM_CAS*cas_scale;
+        #endif
         if(cas_currentType==CAS_TYPE::Ascii) {
           fileStage+=1;
         } else {
@@ -302,22 +504,86 @@ void process()
 }
 
 #if defined(Use_DRAGON)
+#if defined(Use_Dragon_sLeader)
+// Leader bytes (0x55) after the first of a run go out as one alternating
+// pairs repeat (see buffer.h) of up to DRAGON_LEADER_MAX bytes, so wave2 plays
+// the leader itself rather than each byte coming through bits_to_pulses.
+// A 0x55 written the usual way first leaves the output where the repeat's
+// first toggle expects it.  The periods are in 2us units, so the short
+// half is rounded (125 for 249).
+#define DRAGON_LEADER_MAX (PULSE_REPEAT_MAX/4)
+
+byte leader_room()
+{
+  // how many leader bytes can go out as a repeat now, 0 to write one as usual
+  return (leaderPrimed && writepos+4 <= buffsize) ? DRAGON_LEADER_MAX : 0;
+}
+
+void writeLeader(byte n)
+{
+  // n times: a "1" (two short edges) then a "0" (two long ones)
+  const word _rep = PULSE_REPEAT_FLAG | PULSE_REPEAT_ALT | PULSE_REPEAT_PAIRS | (n*4);
+  const word _ab = (((cas_period+1) >> PULSE_REPEAT_ALT_SHIFT) << 8) | cas_period;
+  volatile byte * _wb = writeBuffer+writepos;
+  *_wb = _rep /256;
+  *(_wb+1) = _rep %256;
+  *(_wb+2) = _ab /256;
+  *(_wb+3) = _ab %256;
+  writepos+=4;
+}
+
+void leaderFromFile()
+{
+  // filebuffer[0], at bytesRead, is a 0x55: play it and the ones after it
+  const byte n = leader_room();
+  if (n == 0) {
+    writeByte(0x55);
+    bytesRead+=1;
+    count_r--;
+    return;
+  }
+  byte k = 0;
+  while (k < n && readfile(1,bytesRead)==1 && filebuffer[0]==0x55) {
+    k++;
+    bytesRead+=1;
+  }
+  count_r -= k;
+  writeLeader(k);
+}
+
+void leaderPad()
+{
+  // the leader in the file was short (count_r >= 0): make it up
+  const byte n = leader_room();
+  if (n == 0) {
+    writeByte(0x55);
+    count_r--;
+    return;
+  }
+  const byte k = (count_r+1 < n) ? count_r+1 : n;
+  count_r -= k;
+  writeLeader(k);
+}
+#endif
+
 void processDragon()
 {
+  if (casNextBlock < casBlockCount && bytesRead >= casBlocks[casNextBlock]) {
+    // a new file: count and show it, as the tape formats do
+    block_mem_oled();
+    casNextBlock++;
+  }
   lastByte=filebuffer[0];
   if((readfile(1,bytesRead))==1)
   {
     #if defined(Use_Dragon_sLeader) && not defined(Expand_All)
     if(currentTask==TASK::GETFILEHEADER) {
       if(filebuffer[0] == 0x55) {
-       writeByte(0x55); 
-       bytesRead+=1;
-       count_r--;
+       leaderFromFile();
       } else {
         //currentTask=TASK::CAS_wHeader;
         if(count_r>=0) {
-          writeByte(0x55);
-          count_r--;
+          leaderPad();
         } else {    
           if (fileStage > 0) currentTask=TASK::CAS_wData;
           else {
@@ -347,14 +613,11 @@ void processDragon()
   #if defined(Use_Dragon_sLeader) && defined(Expand_All)
     if(currentTask==TASK::GETFILEHEADER) {
       if(filebuffer[0] == 0x55) {
-       writeByte(0x55); 
-       bytesRead+=1;
-       count_r--;
+       leaderFromFile();
       } else {
        //currentTask=TASK::CAS_wHeader;
         if(count_r>=0) {
-          writeByte(0x55);
-          count_r--;
+          leaderPad();
         } else {
           //count_r= 119;
           count_r = 2;      
@@ -385,14 +648,11 @@ void processDragon()
       }
     } else if(currentTask==TASK::CAS_lookLeader) { 
       if(filebuffer[0] == 0x55) {
-        writeByte(0x55); 
-        bytesRead+=1;
-        count_r--;
+        leaderFromFile();
       } else {
         //currentTask=TASK::CAS_wNewLeader;
         if(count_r>=0) {
-          writeByte(0x55);
-          count_r--;
+          leaderPad();
         } else {   
           currentTask=TASK::CAS_wData;
         }
@@ -421,17 +681,34 @@ void processDragon()
       currentTask=TASK::CAS_wSilence;
     }    
     if(currentTask==TASK::CAS_wSilence) {
-      if(count_r) {
-        writeSilence();
-        count_r--;
+      if(count_r==0 && buffer_played_out()) {
+        fileEnded();
       } else {
-        stopFile();
+        writeSilence();
+        if(count_r!=0 && --count_r==0) buffer_mark_end();
       }
     }
   }
 }
 #endif // defined(Use_DRAGON)
 
+void writeSamplePeriod()
+{
+#ifdef DIRECT_RUNS
+  // the runs are plain segment words, there's no sample period to give the ISR
+  casRunFrac = 0;
+#else
+  const word _currentPeriod = cas_period | 0x6000;
+  const byte _b1 = _currentPeriod /256;
+  const byte _b2 = _currentPeriod %256;
+  volatile byte * _wb = writeBuffer+writepos;
+  *_wb = _b1;
+  *(_wb+1) = _b2;
+  directNextFrac = cas_frac;    // the ISR takes it up with the period
+  writepos+=2;
+#endif
+}
+
 void casduinoLoop()
 {
   if (writepos<buffsize)
@@ -440,17 +717,15 @@ void casduinoLoop()
     if(currentTask==TASK::INIT)
     {
       currentTask=TASK::GETFILEHEADER;
-
-      const word _currentPeriod = cas_period | 0x6000;
-      const byte _b1 = _currentPeriod /256;
-      const byte _b2 = _currentPeriod %256;
-      volatile byte * _wb = writeBuffer+writepos;
-      noInterrupts();                       //Pause interrupts while we add a period to the buffer
-      *_wb = _b1;
-      *(_wb+1) = _b2;
-      interrupts();
-      writepos+=2;
+      writeSamplePeriod();
+    }
+  #if defined(CAS_TURBO_LOADER) || defined(LIVE_BAUD)
+    else if(casRatePending && currentBit==0)
+    {
+      casRatePending = false;
+      writeSamplePeriod();
     }
+  #endif
     else
     {
       if(currentBit==0)
@@ -471,7 +746,13 @@ void casduinoLoop()
   }
   else
   {
+    #if defined(OLED1306) && defined(OLEDPRINTBLOCK)
+      block_show();
+    #endif
     if (!pauseOn) {      
+    #if defined(SHOW_CNTR) || defined(SHOW_PCT)
+      lcdCatchUp();
+    #endif
     #if defined(SHOW_CNTR)
       lcdTime();          
     #endif
@@ -482,33 +763,51 @@ void casduinoLoop()
   } 
 }
 
+void cas_rate(word baud)
+{
+  // a bit is 4 samples, so a sample is 1000000/(4*baud) us.  The whole us
+  // go in the sample period word and the rest is made up by the ISR (see
+  // directSampleFrac), so any rate comes out exactly, rather than the
+  // nearest whole period (70us for "3600", which is really 3571 baud).
+#ifdef DIRECT_SPEED
+  const word speed = rateprobe_speed(RATE_CAS, DIRECTSPEED, 250000UL / baud);   // (no faster than RATE_PROBE found)
+  const unsigned long sample = (64000000UL / baud) * 100 / speed;   // in 1/256 us, sped up
+#else
+  const unsigned long sample = 64000000UL / baud;   // in 1/256 us
+#endif
+  cas_period = sample >> 8;
+  cas_frac = sample & 0xFF;
+  cas_scale = 1 + baud/3600;   // silences are counted in samples, so stretch them out at the fast rates
+}
+
+#ifdef LIVE_BAUD
+void cas_baud_changed()
+{
+  // unless it's on CAS Baud, which BAUDRATE doesn't change
+#if defined(CAS_TURBO_LOADER)
+  if (casFileNo >= 2 && CASBAUDRATE) return;
+#elif defined(CAS_BAUD_RANGE)
+  if (CASBAUDRATE) return;
+#endif
+  cas_rate(BAUDRATE);
+  casRatePending = true;
+}
+#endif
+
 void setCASBaud()
 {
-  switch(BAUDRATE) {
-    case 1200:
-      cas_scale=1;
-      cas_period=208;
-      break;
-    case 2400:
-      cas_scale=1;
-      cas_period=104;
-      break;
-    case 3150:
-      cas_scale=1;
-      cas_period=80;
-      break;
-    case 3600:
-      //cas_scale=2713/1200;
-      cas_scale=2;
-      //cas_period=93; //2700 baudios
-      //cas_period = TickToUs(243);
-      cas_period=70; //3571 bauds=1000000/4/70 con period 70us, 3675 baudios con period=68 
-      break;      
-    case 3850:
-      cas_scale=2;
-      cas_period = 65; //3850 baudios con period=65
-      break;
-  }
+#if defined(CAS_TURBO_LOADER) || defined(LIVE_BAUD)
+  casRatePending = false;
+#endif
+#if defined(CAS_TURBO_LOADER)
+  casFileNo = 0;
+  const word baud = BAUDRATE;   // for the loader, then CAS Baud (see casProcessing.h)
+#elif defined(CAS_BAUD_RANGE)
+  const word baud = CASBAUDRATE ? CASBAUDRATE : BAUDRATE;
+#else
+  const word baud = BAUDRATE;
+#endif
+  cas_rate(baud);
   Timer.stop();
 }
 
@@ -7,6 +7,7 @@
 
 /* Header Definitions */
 extern PROGMEM const byte HEADER[8];
+extern PROGMEM const byte CAS_PAIR_LEVELS[4];   // the 8 levels of the next two bits
 const byte CAS_ASCII = 0xEA;
 const byte CAS_BINF = 0xD0;
 const byte CAS_BASIC = 0xD3;
@@ -20,8 +21,51 @@ extern bool invert;
 void casduinoLoop();
 
 void setCASBaud();
+void cas_rate(word baud);   // cas_period, cas_frac and cas_scale for baud
+#ifdef LIVE_BAUD
+void cas_baud_changed();    // BAUDRATE changed while playing: the next header on at it
+#endif
+
+// block list for CAS and Dragon files, built by cas_scan when the file opens
+#ifndef CAS_MAX_BLOCKS
+  #if defined(__AVR_ATmega328P__)
+    #define CAS_MAX_BLOCKS 8
+  #else
+    #define CAS_MAX_BLOCKS 32
+  #endif
+#endif
+void cas_scan();
+// Block jump: false if this isn't a CAS file with blocks, so the usual search goes ahead
+bool cas_jump_block(word &blk);
 extern byte cas_scale; // gets set when you call setCAsBaud
 extern byte cas_period; // gets set when you call setCASBaud
+extern byte cas_frac;   // gets set when you call setCASBaud
+
+#ifdef CAS_BAUD_RANGE
+  // the CAS menu rate runs from CAS_BAUD_MIN to CAS_BAUD_MAX (4 digits at most) in CAS_BAUD_STEP steps
+  #ifndef CAS_BAUD_MIN
+    #define CAS_BAUD_MIN 1200
+  #endif
+  #ifndef CAS_BAUD_MAX
+    #define CAS_BAUD_MAX 6000
+  #endif
+  #ifndef CAS_BAUD_STEP
+    #define CAS_BAUD_STEP 50
+  #endif
+#endif
+
+#ifdef CAS_TURBO_LOADER
+  // For .cas files that start with a turbo loader (a BINF the BIOS loads,
+  // which then reads the rest itself, faster than the BIOS can): the first
+  // file goes at Baud Rate, and the ones after it at CAS Baud.
+  // No loader is made up for files without one: TAPIN and the rest of the
+  // BIOS tape routines are in ROM with no RAM hook, so there's nothing a
+  // BINF could patch, and the program's own BLOAD/CLOAD/RUN still go at
+  // what the BIOS reads
+  #ifndef CAS_BAUD_RANGE
+    #error CAS_TURBO_LOADER needs CAS_BAUD_RANGE, for the CAS Baud the rest go at
+  #endif
+#endif
 
 #endif // Use_CAS
 
@@ -0,0 +1,98 @@
+#include "cdcstream.h"
+
+#ifdef CDC_STREAM
+
+#if !defined(USE_TINYUSB)
+  #error CDC_STREAM needs a TinyUSB board
+#endif
+#if defined(SERIALSCREEN)
+  #error CDC_STREAM uses the serial port itself, so not with SERIALSCREEN
+#endif
+
+#include "file_utils.h"
+
+#define CDC_LINE_MAX  80
+#define CDC_NAME_MAX  (filenameLength-1)   // fileName holds filenameLength (file_utils.h)
+
+bool cdc_active = false;
+
+namespace {
+char line[CDC_LINE_MAX+1];
+byte lineLen = 0;
+bool pending = false;
+unsigned long cdcSize = 0;
+} // namespace
+
+void setup_cdc_stream() {
+  Serial.begin(115200);     // the baud rate means nothing over USB
+}
+
+bool cdc_poll() {
+  while (!pending && Serial.available() > 0) {
+    const char c = Serial.read();
+    if (c == '\r') continue;
+    if (c != '\n') {
+      if (lineLen < CDC_LINE_MAX) line[lineLen++] = c;
+      continue;
+    }
+    line[lineLen] = '\0';
+    lineLen = 0;
+    pending = (strncmp_P(line, PSTR("PLAY "), 5) == 0);
+  }
+  return pending;
+}
+
+bool cdc_open() {
+  if (!pending) return false;
+  pending = false;
+  char *name;
+  cdcSize = strtoul(line+5, &name, 10);
+  if (cdcSize == 0) return false;
+  while (*name == ' ') name++;
+  if (*name == '\0') return false;   // the name is needed for its extension
+  strncpy(fileName, name, CDC_NAME_MAX);
+  fileName[CDC_NAME_MAX] = '\0';
+  filesize = cdcSize;
+  cdc_active = true;
+  return true;
+}
+
+void cdc_close() {
+  if (!cdc_active) return;
+  cdc_active = false;
+  Serial.print(F("END\n"));
+}
+
+word cdc_read(unsigned long pos, byte *dst, word n) {
+  if (!cdc_active || pos >= cdcSize) return 0;
+  if (n > cdcSize - pos) n = cdcSize - pos;
+
+  // anything still here is left over from a request that timed out
+  while (Serial.available() > 0) Serial.read();
+
+  Serial.print('R');
+  Serial.print(' ');
+  Serial.print(pos);
+  Serial.print(' ');
+  Serial.print(n);
+  Serial.print('\n');
+  Serial.flush();
+
+  word got = 0;
+  unsigned long t = millis();
+  while (got < n) {
+    const int avail = Serial.available();
+    if (avail > 0) {
+      const word want = n - got;
+      got += Serial.readBytes(dst + got, ((word)avail < want) ? (word)avail : want);
+      t = millis();
+    } else if (millis() - t > CDC_TIMEOUT) {
+      break;
+    } else {
+      yield();
+    }
+  }
+  return got;
+}
+
+#endif // CDC_STREAM
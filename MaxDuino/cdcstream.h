@@ -0,0 +1,43 @@
+#ifndef CDCSTREAM_H_INCLUDED
+#define CDCSTREAM_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef CDC_STREAM
+#include "Arduino.h"
+
+// Plays a tape image sent over the USB serial port (TinyUSB boards), so no
+// SD card is needed.  The device pulls: each time readfile() runs off its
+// read-ahead window it asks the host for the next slice, and it only does
+// that while the output buffer has a page free to fill.  So the host is
+// paced by the output buffer, and the jumps back that TZX loops need are
+// just another request.  Lines are text, data is raw:
+//
+//   host:   PLAY <size> <name>\n     (while stopped)
+//   device: R <pos> <len>\n          host answers with exactly len bytes
+//   device: END\n                    stopped, host can let go
+//
+// Like NET_STREAM, only the formats that read through readfile() can be
+// played this way.
+
+#ifndef CDC_TIMEOUT
+  #define CDC_TIMEOUT 1000    // ms without a byte before a read gives up
+#endif
+
+extern bool cdc_active;
+
+void setup_cdc_stream();
+
+// While stopped: collect a PLAY request from the host; true once one is waiting
+bool cdc_poll();
+
+// Start on the waiting request: sets filesize, and fileName
+bool cdc_open();
+
+void cdc_close();
+
+// Read up to n bytes starting at pos into dst; returns how many
+word cdc_read(unsigned long pos, byte *dst, word n);
+#endif
+
+#endif // CDCSTREAM_H_INCLUDED
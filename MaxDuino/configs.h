@@ -50,6 +50,11 @@
     #define CONFIGFILE _CONFIG_FILE_DEFAULT_WEMOS_D1MINI_ESP8266
     #endif
     #define CONFIG_PATH userARDUINO_ESP8266_WEMOS_D1MINI
+  #elif defined(ARDUINO_ARCH_RP2040)
+    #ifndef CONFIGFILE
+    #define CONFIGFILE _CONFIG_FILE_DEFAULT_RP2040
+    #endif
+    #define CONFIG_PATH userRP2040config
   #else //__AVR_ATmega328P__
     #include "userconfig.h" // legacy
     #ifndef CONFIGFILE
@@ -0,0 +1,173 @@
+#include "csw.h"
+
+#ifdef Use_CSW
+
+#include "file_utils.h"
+#include "processing_state.h"
+#include "MaxDuino.h"
+#include "MaxProcessing.h"
+#include "inflate.h"
+
+namespace {
+
+constexpr byte CSW_COMPRESSION_RLE = 1;
+constexpr word CSW_MAX_US = 0x3FFF;       // longest plain pulse word in the buffer
+const char CSWMagic[] PROGMEM = "Compressed Square Wave\x1A";
+constexpr byte CSW_MAGIC_SIZE = 23;
+
+unsigned long cswUsPerSample;             // us per sample, 24.8 fixed point
+unsigned long cswEnd;                     // file position where the pulses end
+#ifdef Use_UEF_GZ
+constexpr byte CSW_COMPRESSION_ZRLE = 2;
+constexpr unsigned long CSW_TO_THE_END = 0xFFFFFFFFUL;   // an inflated stream ends by itself
+unsigned long cswResume = 0;              // Z-RLE ID18: where the TZX goes on after it (0 if not inflating)
+
+bool open_zrle() {
+  // the pulses are inflated as they're read, from bytesRead: it then counts in them
+  if (!gz_open_zlib(bytesRead)) return false;
+  bytesRead = 0;
+  return true;
+}
+#endif
+
+void set_rate(const unsigned long rate) {
+  cswUsPerSample = rate ? (256000000UL + rate/2) / rate : 256;
+}
+
+bool next_pulse() {
+  // Decode the next RLE pulse into currentPeriod; false at the end of the data.
+  // A 0 byte means the length follows as a dword.
+  if (bytesRead >= cswEnd || !ReadByte()) return false;
+  unsigned long samples = outByte;
+  if (samples == 0) {
+    if (!ReadDword()) return false;
+    samples = outLong;
+  }
+  // the 24.8 multiply would overflow past this, and it's a long silence anyway
+  const unsigned long maxSamples = 0xFFFFFFFFUL / cswUsPerSample;
+  const unsigned long us = (samples > maxSamples) ? 0xFFFFFFFFUL >> 8 : (samples * cswUsPerSample + 128) >> 8;
+  if (us <= CSW_MAX_US) {
+    currentPeriod = us ? us : 1;
+  } else {
+    // too long for a pulse word, so play it as silence
+    const unsigned long ms = us / 1000;
+    currentPeriod = (ms > MAXPAUSE_PERIOD) ? MAXPAUSE_PERIOD : ms;
+    bitSet(currentPeriod, 15);
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+void csw_init() {
+  // header: 23 byte signature, major and minor version, then
+  //   v1: word sample rate, byte compression type, byte flags, 3 reserved
+  //   v2: dword sample rate, dword pulse count, byte compression type, byte flags,
+  //       byte header extension length, 16 byte encoding application, extension
+  bool ok = true;
+  bytesRead = 0;
+  for (byte i = 0; ok && i < CSW_MAGIC_SIZE; i++) {
+    ok = ReadByte() && outByte == pgm_read_byte(CSWMagic + i);
+  }
+
+  byte compression = 0;
+  if (ok) {
+    ok = ReadByte();
+    const byte major = outByte;
+    bytesRead++;              // minor version
+    if (ok && major == 1) {
+      if (ReadWord()) set_rate(outWord);
+      if (ReadByte()) compression = outByte;
+      bytesRead = 0x20;
+    } else if (ok && major == 2) {
+      if (ReadDword()) set_rate(outLong);
+      bytesRead += 4;         // pulse count
+      if (ReadByte()) compression = outByte;
+      bytesRead++;            // flags
+      byte ext = 0;
+      if (ReadByte()) ext = outByte;
+      bytesRead += 16 + ext;
+    } else {
+      ok = false;
+    }
+  }
+
+  // not one it can play: csw_process reports it once playback starts
+  cswEnd = (ok && compression == CSW_COMPRESSION_RLE) ? filesize : 0;
+#ifdef Use_UEF_GZ
+  if (ok && compression == CSW_COMPRESSION_ZRLE && open_zrle()) cswEnd = CSW_TO_THE_END;
+#endif
+  currentTask = TASK::PROCESSID;
+  currentID = BLOCKID::CSW;
+}
+
+void csw_process() {
+  if (cswEnd == 0) {
+    HeaderFail();
+    return;
+  }
+  if (!next_pulse()) {
+    EndOfFile = true;
+    currentID = BLOCKID::IDEOF;
+  }
+}
+
+void tzx_process_blockid_id18() {
+  switch (currentBlockTask) {
+    case BLOCKTASK::READPARAM: {
+      block_mem_oled();
+#ifdef Use_UEF_GZ
+      cswResume = 0;
+#endif
+      // dword block length, word pause, 3 byte sample rate, byte compression,
+      // dword pulse count, then the data
+      cswEnd = bytesRead;
+      if (ReadDword()) cswEnd += 4 + outLong;
+      if (ReadWord()) pauseLength = outWord;
+      if (ReadLong()) set_rate(outLong);
+      byte compression = 0;
+      if (ReadByte()) compression = outByte;
+      bytesRead += 4;
+      if (compression == CSW_COMPRESSION_RLE) {
+        currentBlockTask = BLOCKTASK::TDATA;
+#ifdef Use_UEF_GZ
+      } else if (compression == CSW_COMPRESSION_ZRLE && open_zrle()) {
+        cswResume = cswEnd;
+        cswEnd = CSW_TO_THE_END;
+        currentBlockTask = BLOCKTASK::TDATA;
+#endif
+      } else {
+        currentBlockTask = BLOCKTASK::PAUSE;
+      }
+      break;
+    }
+
+    case BLOCKTASK::TDATA:
+      if (next_pulse()) break;
+      currentBlockTask = BLOCKTASK::PAUSE;
+      // fallthrough->
+
+    case BLOCKTASK::PAUSE:
+    default:
+#ifdef Use_UEF_GZ
+      csw_leave();
+#endif
+      bytesRead = cswEnd;
+      temppause = pauseLength;
+      currentID = BLOCKID::IDPAUSE;
+      break;
+  }
+}
+
+#ifdef Use_UEF_GZ
+void csw_leave() {
+  if (!cswResume) return;
+  gz_close();
+  readahead_invalidate();     // it had the inflated pulses
+  cswEnd = cswResume;
+  bytesRead = cswResume;
+  cswResume = 0;
+}
+#endif
+
+#endif // Use_CSW
@@ -0,0 +1,31 @@
+#ifndef CSW_H_INCLUDED
+#define CSW_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef Use_CSW
+#include "Arduino.h"
+
+// CSW (Compressed Square Wave) playback: TZX ID18 blocks and .csw files.
+// CSW-1 RLE is decoded as it streams, one pulse per buffer word.
+// Z-RLE (zlib) data is inflated on the way, on the boards that build the
+// inflater (Use_UEF_GZ); without it those ID18 blocks are skipped and those
+// .csw files are rejected.
+
+// .csw file: check the header and start playback (called from checkForEXT)
+void csw_init();
+
+// Process one step of a .csw file (BLOCKID::CSW)
+void csw_process();
+
+// Process one step of a TZX ID18 block
+void tzx_process_blockid_id18();
+
+#ifdef Use_UEF_GZ
+// Before bytesRead is moved to another block: if it was inside a Z-RLE
+// ID18, reads go back to the TZX itself
+void csw_leave();
+#endif
+#endif
+
+#endif // CSW_H_INCLUDED
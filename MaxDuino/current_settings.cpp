@@ -5,6 +5,18 @@
 #include "casProcessing.h"
 
 word BAUDRATE = DEFAULT_BAUDRATE;
+#ifdef CAS_BAUD_RANGE
+word CASBAUDRATE = 0;
+#endif
+#ifdef DIRECT_SPEED
+word DIRECTSPEED = 100;
+#endif
+#ifdef ZX_SPEED
+word ZXSPEED = 100;
+#endif
+#ifdef FAST_GAPS
+word FASTGAP = FAST_GAPS_DEFAULT;
+#endif
 // TODO really the following should only be defined ifndef NO_MOTOR
 // but the order of #includes is wrong and we only define NO_MOTOR later :-/
 bool mselectMask = DEFAULT_MSELECTMASK;
@@ -1,6 +1,29 @@
 #include "Arduino.h" // for types
+#include "configs.h"
 
 extern word BAUDRATE;
+#ifdef CAS_BAUD_RANGE
+extern word CASBAUDRATE;   // .cas playback rate, 0 to follow BAUDRATE
+#endif
+#ifdef DIRECT_SPEED
+// ID15 direct recordings (and .cas samples) at this % of their recorded rate
+#define DIRECT_SPEED_MAX 400
+#define DIRECT_SPEED_STEP 25
+extern word DIRECTSPEED;
+#endif
+#ifdef ZX_SPEED
+// standard speed Spectrum blocks (ID10, .tap) at this % of the ROM's timings
+#define ZX_SPEED_MAX 130
+#define ZX_SPEED_STEP 5
+extern word ZXSPEED;
+#endif
+#ifdef FAST_GAPS
+// pauses between blocks cut to at most this many ms, 0 to play them as recorded
+#ifndef FAST_GAPS_DEFAULT
+#define FAST_GAPS_DEFAULT 0
+#endif
+extern word FASTGAP;
+#endif
 extern bool mselectMask;
 extern bool TSXCONTROLzxpolarityUEFSWITCHPARITY;
 extern bool skip2A;
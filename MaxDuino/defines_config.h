@@ -46,4 +46,8 @@
 #define _CONFIG_FILE_DEFAULT_WEMOS_D1MINI_ESP8266 NO_SUFFIX
 #endif
 
+#ifndef _CONFIG_FILE_DEFAULT_RP2040
+#define _CONFIG_FILE_DEFAULT_RP2040 NO_SUFFIX
+#endif
+
 #endif // DEFINES_CONFIG_H_INCLUDED
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "configs.h"
+#include "dirscan.h"
+
+#ifdef EXFAT_SCAN
+
+#include "hwconfig.h"
+#include "file_utils.h"
+
+#if DIRSCAN_BUF % 512
+  #error DIRSCAN_BUF must be a multiple of 512
+#endif
+
+namespace {
+// exFAT directory entry types
+constexpr byte TYPE_END    = 0x00;
+constexpr byte TYPE_FILE   = 0x85;
+constexpr byte TYPE_STREAM = 0xC0;
+constexpr byte TYPE_NAME   = 0xC1;
+constexpr byte ATTR_DIR    = 0x10;
+
+byte buf[DIRSCAN_BUF];
+word bufLen = 0;
+word bufAt = 0;
+uint16_t bufPos = 0;        // directory position of buf[0]
+bool ended = false;
+DirScanEntry found;
+
+bool refill() {
+  if (ended) return false;
+  bufPos += bufLen / 32;
+  const int n = currentDir->read(buf, DIRSCAN_BUF);
+  bufLen = (n > 0) ? (n & ~31) : 0;
+  bufAt = 0;
+  if (bufLen == 0) ended = true;
+  return bufLen != 0;
+}
+} // anonymous namespace
+
+bool dirscan_begin(uint16_t from) {
+#ifdef FAT_TYPE_EXFAT
+  if (sd.fatType() != FAT_TYPE_EXFAT) return false;
+  if (!currentDir->seekSet(32UL * from)) return false;
+  bufPos = from;
+  bufLen = 0;
+  bufAt = 0;
+  ended = false;
+  return true;
+#else
+  (void)from;
+  return false;     // an SdFat build without exFAT
+#endif
+}
+
+const DirScanEntry *dirscan_next() {
+  byte secondaries = 0;     // still to come in the set being read, 0 while looking for one
+  byte nameLen = 0;
+  byte got = 0;
+  for (;;) {
+    if (bufAt == bufLen && !refill()) return nullptr;
+    const byte *d = buf + bufAt;
+    const uint16_t pos = bufPos + bufAt/32;
+    bufAt += 32;
+
+    if (d[0] == TYPE_END) {
+      ended = true;
+      return nullptr;
+    }
+    if (d[0] == TYPE_FILE) {
+      // (a set cut short is dropped, as SdFat does)
+      secondaries = d[1];
+      found.pos = pos;
+      found.dir = (d[4] & ATTR_DIR) != 0;
+      found.size = 0;
+      found.name[0] = '\0';
+      nameLen = 0;
+      got = 0;
+      if (secondaries < 2) secondaries = 0;
+      continue;
+    }
+    if (secondaries == 0) continue;   // unused, deleted, or the volume's own entries
+
+    if (d[0] == TYPE_STREAM) {
+      nameLen = d[3];
+      // the data length is 64 bit; more than 4GB won't play anyway
+      found.size = ((unsigned long)word(d[27], d[26]) << 16) | word(d[25], d[24]);
+    } else if (d[0] == TYPE_NAME) {
+      for (byte i = 0; i < 15 && got < nameLen; i++, got++) {
+        const word c = word(d[3+2*i], d[2+2*i]);
+        found.name[got] = (c >= 0x20 && c < 0x80) ? c : '?';
+      }
+      found.name[got] = '\0';
+    } else if (d[0] < 0x80) {
+      secondaries = 0;    // a deleted entry inside the set: it's not whole
+      continue;
+    }
+    if (--secondaries == 0 && nameLen && got == nameLen) return &found;
+  }
+}
+
+#endif // EXFAT_SCAN
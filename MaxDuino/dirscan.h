@@ -0,0 +1,37 @@
+#ifndef DIRSCAN_H_INCLUDED
+#define DIRSCAN_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef EXFAT_SCAN
+#include "Arduino.h"
+
+// Bulk directory reads for exFAT cards (EXFAT_SCAN).  An exFAT file is a
+// set of three or more 32 byte entries (file, stream, then the name 15
+// UTF-16 characters at a time), so openNext() and getName() go through a
+// handful of entries, and the cache, per file.  Here currentDir is read
+// DIRSCAN_BUF bytes at a time (hwconfig.h) with one multi-sector read, and
+// the sets are picked apart in RAM as they go by.  getMaxFile, the
+// NAME_CACHE window and the SORTED_DIR view read the directory this way on
+// exFAT, and with openNext() as before on FAT.
+//
+// pos is the set's first entry: what entry.open(currentDir, pos) takes.
+// Names are ASCII, anything else as '?'.
+
+struct DirScanEntry {
+  uint16_t pos;
+  unsigned long size;
+  bool dir;
+  char name[256];
+};
+
+// Start reading currentDir at directory position from; false (do it with
+// openNext) if it isn't on an exFAT volume
+bool dirscan_begin(uint16_t from);
+
+// The next file or directory, or null at the end.  Leaves currentDir
+// somewhere past it, so callers rewind it as they would after openNext
+const DirScanEntry *dirscan_next();
+#endif
+
+#endif // DIRSCAN_H_INCLUDED
@@ -0,0 +1,233 @@
+#include "configs.h"
+#include "dirview.h"
+
+#ifdef SORTED_DIR
+
+#include "hwconfig.h"
+#include "file_utils.h"
+#include "CheckForExt.h"
+#include "dirscan.h"
+
+#define DIRVIEW_KEY  8      // leading bytes compared in RAM: a file/dir flag, then the name
+#define DIRVIEW_NAME 64     // longest name compared when the keys are the same
+
+uint16_t viewPos = 0;
+
+namespace {
+struct ViewEntry {
+  char key[DIRVIEW_KEY];
+  uint16_t pos;
+};
+ViewEntry win[DIRVIEW_RAM];
+uint16_t winCount = 0;
+uint16_t viewCount = 0;
+bool spilled = false;       // the view is in IDX_PATH, not win
+const char IDX_PATH[] PROGMEM = "/MAXDIR.IDX";
+
+bool open_idx(SdBaseFile &idx, oflag_t flags) {
+  char path[sizeof(IDX_PATH)];
+  strcpy_P(path, IDX_PATH);
+  return idx.open(path, flags);
+}
+
+void make_key(ViewEntry &e, const char *name, bool dir, uint16_t pos) {
+  e.key[0] = dir ? 0 : 1;
+  byte i = 1;
+  for (; i < DIRVIEW_KEY && *name; i++) e.key[i] = toupper((unsigned char)*name++);
+  for (; i < DIRVIEW_KEY; i++) e.key[i] = 0;
+  e.pos = pos;
+}
+
+int compare(const ViewEntry &a, const char *aName, const ViewEntry &b) {
+  // a (whose whole name is aName) against b, by key, then whole name, then position
+  int c = memcmp(a.key, b.key, DIRVIEW_KEY);
+  if (c) return c;
+  if (a.key[DIRVIEW_KEY-1]) {
+    // both names are longer than the key: fetch b's, without losing our place in the directory
+    const uint32_t here = currentDir->curPosition();
+    SdBaseFile f;
+    char bName[DIRVIEW_NAME];
+    bName[0] = '\0';
+    if (f.open(currentDir, b.pos, O_RDONLY)) {
+      f.getName(bName, sizeof(bName));
+      f.close();
+    }
+    currentDir->seekSet(here);
+    c = strcasecmp(aName, bName);
+    if (c) return c;
+  }
+  return (a.pos > b.pos) - (a.pos < b.pos);
+}
+
+bool more;
+
+void offer(const char *name, bool dir, uint16_t pos, const ViewEntry *after) {
+  // one directory entry for fill_window
+  if (!dir && !is_playable(name)) return;
+
+  ViewEntry e;
+  make_key(e, name, dir, pos);
+  if (after && compare(e, name, *after) <= 0) return;
+  if (winCount == DIRVIEW_RAM && compare(e, name, win[winCount-1]) >= 0) {
+    more = true;
+    return;
+  }
+  // binary search for where it goes
+  uint16_t lo = 0, hi = winCount;
+  while (lo < hi) {
+    const uint16_t mid = (lo + hi) / 2;
+    if (compare(e, name, win[mid]) < 0) hi = mid;
+    else lo = mid + 1;
+  }
+  if (winCount == DIRVIEW_RAM) {
+    more = true;      // the last one drops off the end
+  } else {
+    winCount++;
+  }
+  memmove(&win[lo+1], &win[lo], (winCount-1-lo) * sizeof(ViewEntry));
+  win[lo] = e;
+}
+
+bool fill_window(const ViewEntry *after) {
+  // the DIRVIEW_RAM smallest entries after *after (all of them if null), in
+  // order, into win.  Returns true if there were more than fitted.
+  more = false;
+  winCount = 0;
+#ifdef EXFAT_SCAN
+  if (dirscan_begin(0)) {
+    const DirScanEntry *d;
+    while ((d = dirscan_next()) != nullptr) {
+      offer(d->name, d->dir || !strcmp(d->name, "ROOT"), d->pos, after);
+    }
+    currentDir->rewind();
+    return more;
+  }
+#endif
+  char name[DIRVIEW_NAME];
+  currentDir->rewind();
+  while (entry.openNext(currentDir, O_RDONLY)) {
+    const uint16_t pos = currentDir->curPosition()/32-1;
+    entry.getName(name, sizeof(name));
+    const bool dir = entry.isDir() || !strcmp(name, "ROOT");
+    entry.close();
+    offer(name, dir, pos, after);
+  }
+  currentDir->rewind();
+  return more;
+}
+} // anonymous namespace
+
+void dirview_build() {
+  viewPos = 0;
+  spilled = false;
+  bool more = fill_window(nullptr);
+  viewCount = winCount;
+  if (!more) return;
+
+  // too many for RAM: write them out a window at a time, each pass
+  // carrying on from the last entry of the one before
+  SdBaseFile idx;
+  if (!open_idx(idx, O_RDWR | O_CREAT | O_TRUNC)) return;   // the first DIRVIEW_RAM will have to do
+  spilled = true;
+  viewCount = 0;
+  for (;;) {
+    for (uint16_t i = 0; i < winCount; i++) {
+      const byte b[2] = { (byte)win[i].pos, (byte)(win[i].pos >> 8) };
+      idx.write(b, 2);
+    }
+    viewCount += winCount;
+    if (!more) break;
+    const ViewEntry last = win[winCount-1];
+    more = fill_window(&last);
+  }
+  idx.close();
+}
+
+uint16_t dirview_count() {
+  return viewCount;
+}
+
+uint16_t dirview_file(uint16_t i) {
+  if (!spilled) return (i < winCount) ? win[i].pos : 0;
+  SdBaseFile idx;
+  byte b[2] = {0, 0};
+  if (open_idx(idx, O_RDONLY)) {
+    if (idx.seekSet(2UL*i)) idx.read(b, 2);
+    idx.close();
+  }
+  return word(b[1], b[0]);
+}
+
+uint16_t dirview_find(uint16_t file) {
+  if (!spilled) {
+    for (uint16_t i = 0; i < winCount; i++) {
+      if (win[i].pos == file) return i;
+    }
+    return 0;
+  }
+  SdBaseFile idx;
+  uint16_t found = 0;
+  if (open_idx(idx, O_RDONLY)) {
+    byte b[2];
+    for (uint16_t i = 0; i < viewCount && idx.read(b, 2) == 2; i++) {
+      if (word(b[1], b[0]) == file) {
+        found = i;
+        break;
+      }
+    }
+    idx.close();
+  }
+  return found;
+}
+
+namespace {
+uint16_t initial(uint16_t i) {
+  // what the letter jumps go by: the dir/file flag, then the first letter
+  if (!spilled) return word(win[i].key[0], win[i].key[1]);
+  SdBaseFile f;
+  char name[DIRVIEW_NAME] = "";
+  bool dir = false;
+  if (f.open(currentDir, dirview_file(i), O_RDONLY)) {
+    f.getName(name, sizeof(name));
+    dir = f.isDir() || !strcmp(name, "ROOT");
+    f.close();
+  }
+  return word(dir ? 0 : 1, toupper((unsigned char)name[0]));
+}
+
+uint16_t first_above(uint16_t lo, uint16_t hi, uint16_t letter) {
+  // first entry in [lo, hi) whose initial is above letter (hi if none).
+  // The view is in order, so a binary search: a few names even when spilled
+  while (lo < hi) {
+    const uint16_t mid = (lo + hi) / 2;
+    if (initial(mid) > letter) hi = mid;
+    else lo = mid + 1;
+  }
+  return lo;
+}
+
+uint16_t group_start(uint16_t i) {
+  // first entry with the same initial as i
+  const uint16_t letter = initial(i);
+  uint16_t lo = 0, hi = i;
+  while (lo < hi) {
+    const uint16_t mid = (lo + hi) / 2;
+    if (initial(mid) < letter) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+} // anonymous namespace
+
+uint16_t dirview_letter(uint16_t i, bool up) {
+  if (viewCount == 0) return 0;
+  if (!up) {
+    const uint16_t next = first_above(i+1, viewCount, initial(i));
+    return (next < viewCount) ? next : 0;
+  }
+  const uint16_t start = group_start(i);
+  if (start < i) return start;    // first back to the start of this letter
+  return group_start(start ? start-1 : viewCount-1);
+}
+
+#endif // SORTED_DIR
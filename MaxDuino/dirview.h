@@ -0,0 +1,34 @@
+#ifndef DIRVIEW_H_INCLUDED
+#define DIRVIEW_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef SORTED_DIR
+#include "Arduino.h"
+
+// Sorted, filtered directory listing (SORTED_DIR).  Built once when a
+// directory is opened: directories first, then the files the player knows
+// (is_playable), each group in name order.  The view is a list of
+// directory positions (the currentFile numbers), so moving through it is
+// just indexing.  Up to DIRVIEW_RAM entries (hwconfig.h) are kept in RAM;
+// a bigger directory is listed into /MAXDIR.IDX on the card instead, a
+// DIRVIEW_RAM-sized slice per pass over the directory.
+
+extern uint16_t viewPos;                  // where currentFile is in the view
+
+void dirview_build();                     // list currentDir; returns with it rewound
+uint16_t dirview_count();                 // entries in the view
+uint16_t dirview_file(uint16_t i);        // directory position of view entry i
+uint16_t dirview_find(uint16_t file);     // view entry of directory position file (0 if it isn't there)
+
+// The view entry that starts the next (or, up, the previous) initial
+// letter after entry i, going round at the ends.  Directories count as a
+// group of their own before the files.
+uint16_t dirview_letter(uint16_t i, bool up);
+#endif
+
+#if defined(FAST_BROWSE) && !defined(SORTED_DIR)
+  #error FAST_BROWSE needs SORTED_DIR
+#endif
+
+#endif // DIRVIEW_H_INCLUDED
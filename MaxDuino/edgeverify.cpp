@@ -0,0 +1,181 @@
+#include "configs.h"
+#include "hwconfig.h"
+#include "edgeverify.h"
+
+#ifdef EDGE_VERIFY
+
+namespace {
+#if defined(__AVR_ATmega2560__)
+constexpr byte EV_TICKS = 2;                // timer 5 at clk/8: counts per us
+#else
+constexpr byte EV_TICKS = 1;                // micros()
+#endif
+constexpr byte EV_RING = 16;                // must be a power of 2
+constexpr byte EV_BUCKETS = 8;              // |error| under 1, 2, 4 .. 64us, and the rest
+
+// intended time between edges (in us, 0 for one not to check), written by
+// wave2 and taken by the input's interrupt
+volatile unsigned long ring[EV_RING];
+volatile byte ringHead;
+volatile byte ringTail;
+
+// wave2's side
+byte lastLevel;
+unsigned long sinceEdge;
+bool sinceValid;
+word unseen;          // edges wave2 made that the input never took off the ring
+
+// the input's side
+unsigned long lastEdge;
+unsigned long edges;
+word late;
+word missed;          // an interval that was two of the intended ones: the input didn't see an edge
+word extra;           // an edge wave2 didn't make
+long errMin;
+long errMax;
+long drift;
+unsigned long hist[EV_BUCKETS];
+
+#if defined(__AVR_ATmega2560__)
+volatile word overflows;
+#endif
+
+ISR_CODE void edge(unsigned long t) {
+  const unsigned long actual = t - lastEdge;
+  lastEdge = t;
+  byte tail = ringTail;
+  if (tail == ringHead) {
+    extra++;
+    return;
+  }
+  unsigned long expected = ring[tail] * EV_TICKS;
+  tail = (tail + 1) & (EV_RING-1);
+  if (expected == 0) {
+    // the first edge, or the first after a stop: nothing to measure from
+    ringTail = tail;
+    return;
+  }
+  while (tail != ringHead && ring[tail] && actual > expected + ring[tail] * EV_TICKS / 2) {
+    expected += ring[tail] * EV_TICKS;
+    tail = (tail + 1) & (EV_RING-1);
+    missed++;
+  }
+  ringTail = tail;
+
+  const long err = (long)(actual - expected);
+  edges++;
+  drift += err;
+  if (err < errMin) errMin = err;
+  if (err > errMax) errMax = err;
+  const unsigned long mag = (err < 0) ? -err : err;
+  byte b = 0;
+  while (b < EV_BUCKETS-1 && mag >= ((unsigned long)EV_TICKS << b)) b++;
+  hist[b]++;
+  if (mag > (unsigned long)EDGE_VERIFY_LATE * EV_TICKS) late++;
+}
+
+#if defined(__AVR_ATmega2560__)
+ISR(TIMER5_OVF_vect)
+{
+  overflows++;
+}
+
+ISR(TIMER5_CAPT_vect)
+{
+  const word c = ICR5;
+  unsigned long o = overflows;
+  if ((TIFR5 & _BV(TOV5)) && c < 0x8000) o++;
+  TCCR5B ^= _BV(ICES5);                     // both edges: look for the other one next
+  TIFR5 = _BV(ICF5);                        // changing the edge can set the flag
+  edge((o << 16) | c);
+}
+#else
+ISR_CODE void pin_edge() {
+  edge(micros());
+}
+#endif
+
+void print_us(long ticks) {
+  Serial.print(ticks / EV_TICKS);
+  if (EV_TICKS == 2 && (ticks & 1)) Serial.print(F(".5"));
+}
+}
+
+void verify_reset() {
+  pinMode(EDGE_VERIFY_PIN, INPUT);
+  noInterrupts();
+  ringHead = 0;
+  ringTail = 0;
+  lastLevel = LOW;
+  sinceEdge = 0;
+  sinceValid = false;
+  unseen = 0;
+  lastEdge = 0;
+  edges = 0;
+  late = 0;
+  missed = 0;
+  extra = 0;
+  errMin = 0x7FFFFFFFL;
+  errMax = -0x7FFFFFFFL;
+  drift = 0;
+  for (byte i = 0; i < EV_BUCKETS; i++) hist[i] = 0;
+#if defined(__AVR_ATmega2560__)
+  overflows = 0;
+  TCCR5A = 0;                               // normal mode, counts 0..0xFFFF and wraps
+  TCCR5B = _BV(ICNC5) | _BV(CS51) | (digitalRead(EDGE_VERIFY_PIN) ? 0 : _BV(ICES5));  // clk/8, first edge away from the level now
+  TCNT5 = 0;
+  TIFR5 = _BV(ICF5) | _BV(TOV5);
+  TIMSK5 = _BV(ICIE5) | _BV(TOIE5);
+#endif
+  interrupts();
+#if !defined(__AVR_ATmega2560__)
+  attachInterrupt(digitalPinToInterrupt(EDGE_VERIFY_PIN), pin_edge, CHANGE);
+#endif
+}
+
+ISR_CODE void verify_period(byte level, unsigned long period) {
+  if (level != lastLevel) {
+    // an edge went out at the start of this period: queue the time since the last one
+    lastLevel = level;
+    const byte next = (ringHead + 1) & (EV_RING-1);
+    if (next == ringTail) {
+      unseen++;
+    } else {
+      ring[ringHead] = sinceValid ? sinceEdge : 0;
+      ringHead = next;
+    }
+    sinceEdge = 0;
+    sinceValid = true;
+  }
+  if (period == 0) sinceValid = false;
+  sinceEdge += period;
+}
+
+void verify_print() {
+  if (edges == 0 && extra == 0 && unseen == 0) return;
+  Serial.println(F("-- edge verify --"));
+  Serial.print(F("Edges: "));
+  Serial.print(edges);
+  Serial.print(F(" late: "));
+  Serial.print(late);
+  Serial.print(F(" missed: "));
+  Serial.print(missed + unseen);
+  Serial.print(F(" extra: "));
+  Serial.println(extra);
+  if (edges == 0) return;
+  Serial.print(F("Error us min/max: "));
+  print_us(errMin);
+  Serial.print('/');
+  print_us(errMax);
+  Serial.print(F(" drift: "));
+  print_us(drift);
+  Serial.println();
+  Serial.print(F("|error| <1/2/4/8/16/32/64us, more: "));
+  for (byte i = 0; i < EV_BUCKETS; i++) {
+    if (i) Serial.print('/');
+    Serial.print(hist[i]);
+  }
+  Serial.println();
+}
+
+#endif // EDGE_VERIFY
@@ -0,0 +1,42 @@
+#ifndef EDGEVERIFY_H_INCLUDED
+#define EDGEVERIFY_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef EDGE_VERIFY
+#include "Arduino.h"
+
+// Loopback check of the real output timing, for per-board turbo limits.
+// Wire the output pin to EDGE_VERIFY_PIN.  wave2 queues the time it meant
+// between each pair of edges, and every edge seen on the input is timed and
+// checked against it.  Printed over the serial port when playback stops:
+// a histogram of the error, how many edges were late, and any that were
+// missed or came from nowhere.
+//
+// On a Mega the input is timer 5's input capture (ICP5, pin 48), so the
+// edge is timed by the hardware to 0.5us.  Elsewhere it's a pin interrupt
+// timed with micros(), which adds that interrupt's own latency (and on a
+// 16MHz AVR, micros() only has 4us resolution).  Don't pause while testing:
+// the edge after a pause is bound to be late.
+
+#ifndef SERIALSCREEN
+  #error EDGE_VERIFY prints over the serial port, so needs SERIALSCREEN
+#endif
+
+#if defined(__AVR_ATmega2560__)
+  #undef EDGE_VERIFY_PIN
+  #define EDGE_VERIFY_PIN 48
+#elif !defined(EDGE_VERIFY_PIN)
+  #error EDGE_VERIFY needs EDGE_VERIFY_PIN, an input that can take a pin change interrupt
+#endif
+
+#ifndef EDGE_VERIFY_LATE
+  #define EDGE_VERIFY_LATE 8    // us off the intended period for an edge to count as late
+#endif
+
+void verify_reset();                              // start of each file
+void verify_period(byte level, unsigned long period);  // last thing in wave2: the level now, and the period just set
+void verify_print();                              // end of each file
+#endif
+
+#endif // EDGEVERIFY_H_INCLUDED
@@ -0,0 +1,51 @@
+#include "configs.h"
+#include "encoder.h"
+
+#ifdef ROTARY_ENCODER
+
+#include "hwconfig.h"
+
+namespace {
+// the quarter step for each (last A B, this A B): 0 for no change, or a bounce.
+// In RAM, not flash, for the ISR (which may run while an ESP's flash is being written)
+int8_t QUARTER[16] = { 0, -1, 1, 0,  1, 0, 0, -1,  -1, 0, 0, 1,  0, 1, -1, 0 };
+
+volatile int turned = 0;            // entries, not yet taken
+byte last;                          // A B as the ISR last saw them
+int8_t quarters = 0;                // toward the next click
+unsigned long lastClick = 0;
+
+ISR_CODE void encoder_isr() {
+  last = ((last << 2) | (digitalRead(ENCODER_A) << 1) | digitalRead(ENCODER_B)) & 0x0F;
+  quarters += QUARTER[last];
+  if (quarters < ENCODER_DETENT && quarters > -ENCODER_DETENT) return;
+  const unsigned long now = millis();
+  const unsigned long gap = now - lastClick;
+  lastClick = now;
+  const int step = (gap < ENCODER_FAST) ? ENCODER_FAST_STEP : (gap < ENCODER_QUICK) ? ENCODER_QUICK_STEP : 1;
+#ifdef ENCODER_REVERSE
+  turned += (quarters > 0) ? -step : step;
+#else
+  turned += (quarters > 0) ? step : -step;
+#endif
+  quarters = 0;
+}
+} // anonymous namespace
+
+void setup_encoder() {
+  pinMode(ENCODER_A, INPUT_PULLUP);
+  pinMode(ENCODER_B, INPUT_PULLUP);
+  last = (digitalRead(ENCODER_A) << 1) | digitalRead(ENCODER_B);
+  attachInterrupt(digitalPinToInterrupt(ENCODER_A), encoder_isr, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(ENCODER_B), encoder_isr, CHANGE);
+}
+
+int encoder_take() {
+  noInterrupts();
+  const int n = turned;
+  turned = 0;
+  interrupts();
+  return n;
+}
+
+#endif // ROTARY_ENCODER
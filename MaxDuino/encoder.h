@@ -0,0 +1,53 @@
+#ifndef ENCODER_H_INCLUDED
+#define ENCODER_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef ROTARY_ENCODER
+#include "Arduino.h"
+
+// A quadrature rotary encoder for the browser, alongside up and down.  Both
+// its pins interrupt on each change and the ISR decodes the turns, so none
+// are missed however long the main loop takes; the faster it's turned the
+// more entries each click moves (a click within ENCODER_FAST ms of the last
+// is ENCODER_FAST_STEP of them, within ENCODER_QUICK ms ENCODER_QUICK_STEP).
+// The main loop takes what's been turned since it last looked, and while
+// it's still turning only shows the position ("123 / 4567"); the name is
+// looked up once it's stopped for ENCODER_SETTLE ms, so a directory of
+// thousands goes by in a few turns with SORTED_DIR (or NAME_CACHE) doing
+// the lookup.  A single slow click is the same as up or down.  Its push
+// switch, if it has one, can be wired to play.
+//
+// ENCODER_A and ENCODER_B must be pins that can interrupt (attachInterrupt),
+// e.g. 2 and 3 on a Nano; clockwise is down the list (ENCODER_REVERSE for
+// the other way).  Only the browser takes it, not the menu.
+
+#if !defined(ENCODER_A) || !defined(ENCODER_B)
+  #error ROTARY_ENCODER needs ENCODER_A and ENCODER_B set to its two pins
+#endif
+
+#ifndef ENCODER_DETENT
+  #define ENCODER_DETENT 4          // quarter steps (pin changes) per click
+#endif
+#ifndef ENCODER_FAST
+  #define ENCODER_FAST 12           // ms between clicks
+#endif
+#ifndef ENCODER_FAST_STEP
+  #define ENCODER_FAST_STEP 50
+#endif
+#ifndef ENCODER_QUICK
+  #define ENCODER_QUICK 40
+#endif
+#ifndef ENCODER_QUICK_STEP
+  #define ENCODER_QUICK_STEP 5
+#endif
+#ifndef ENCODER_SETTLE
+  #define ENCODER_SETTLE 250        // ms at rest before the name's looked up
+#endif
+
+void setup_encoder();
+// Entries turned since the last call, + down the list, - up
+int encoder_take();
+#endif
+
+#endif // ENCODER_H_INCLUDED
@@ -0,0 +1,106 @@
+#include "configs.h"
+#include "fanout.h"
+
+#ifdef FANOUT_PINS
+
+#if defined(ARDUINO_ARCH_RP2040)
+#include "hardware/pio.h"
+#include "hardware/gpio.h"
+#elif defined(__STM32F1__)
+volatile uint32_t fanHigh;                // BSRR words: set the high pins and clear the low ones
+volatile uint32_t fanLow;
+#else
+#include "soc/gpio_sig_map.h"
+volatile uint32_t fanMask;                // outputPin and the FANOUT_PINS still playing
+#endif
+
+namespace {
+#ifdef FANOUT_MOTOR
+uint16_t held = 0;                        // bit i: FANOUT_PINS[i]'s machine has its motor off
+#endif
+
+bool inverted(byte i) {
+  return (FANOUT_INVERT >> i) & 1;
+}
+
+#if defined(ARDUINO_ARCH_RP2040)
+void fanout_pin(byte i, bool hold) {
+  const byte pin = fanoutPins[i];
+  if (hold)
+    gpio_set_outover(pin, gpio_get(pin) ? GPIO_OVERRIDE_HIGH : GPIO_OVERRIDE_LOW);
+  else
+    gpio_set_outover(pin, inverted(i) ? GPIO_OVERRIDE_INVERT : GPIO_OVERRIDE_NORMAL);
+}
+#else
+void fanout_masks(uint16_t hold) {
+#if defined(__STM32F1__)
+  uint32_t high = 1ul << PIN_MAP[outputPin].gpio_bit;
+  uint32_t low = high << 16;
+  for (byte i = 0; i < fanoutCount; i++) {
+    if ((hold >> i) & 1) continue;
+    if (PIN_MAP[fanoutPins[i]].gpio_device != GPIOA) continue;   // not one store away
+    const uint32_t bit = 1ul << PIN_MAP[fanoutPins[i]].gpio_bit;
+    if (inverted(i)) {
+      high |= bit << 16;
+      low |= bit;
+    } else {
+      high |= bit;
+      low |= bit << 16;
+    }
+  }
+  noInterrupts();
+  fanHigh = high;
+  fanLow = low;
+  interrupts();
+#else
+  uint32_t mask = 1ul << outputPin;
+  for (byte i = 0; i < fanoutCount; i++)
+    if (!((hold >> i) & 1))
+      mask |= 1ul << fanoutPins[i];
+  fanMask = mask;
+#endif
+}
+#endif
+}
+
+void fanout_setup() {
+  for (byte i = 0; i < fanoutCount; i++) {
+#if defined(ARDUINO_ARCH_RP2040)
+    // the PIO that drives outputPin drives these too (see TimerCounter.cpp)
+    pio_gpio_init(pio0, fanoutPins[i]);
+    fanout_pin(i, false);
+#else
+    pinMode(fanoutPins[i], OUTPUT);
+  #if defined(CONFIG_IDF_TARGET_ESP32C3)
+    pinMatrixOutAttach(fanoutPins[i], SIG_GPIO_OUT_IDX, inverted(i), false);
+  #endif
+#endif
+#ifdef FANOUT_MOTOR
+    pinMode(fanoutMotor[i], INPUT_PULLUP);
+#endif
+  }
+#if !defined(ARDUINO_ARCH_RP2040)
+  fanout_masks(0);
+#endif
+}
+
+#ifdef FANOUT_MOTOR
+void fanout_motor(bool on) {
+  uint16_t hold = 0;
+  if (on)
+    for (byte i = 0; i < fanoutCount; i++)
+      if (digitalRead(fanoutMotor[i]))    // high (NC) is motor off
+        hold |= 1u << i;
+  if (hold == held) return;
+#if defined(ARDUINO_ARCH_RP2040)
+  for (byte i = 0; i < fanoutCount; i++)
+    if (((hold ^ held) >> i) & 1)
+      fanout_pin(i, (hold >> i) & 1);
+#else
+  fanout_masks(hold);
+#endif
+  held = hold;
+}
+#endif
+
+#endif // FANOUT_PINS
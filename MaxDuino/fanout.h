@@ -0,0 +1,65 @@
+#ifndef FANOUT_H_INCLUDED
+#define FANOUT_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef FANOUT_PINS
+#include "Arduino.h"
+#include "pinSetup.h"
+
+// FANOUT_PINS: more outputs playing the same signal as outputPin, for
+// loading one tape onto a row of machines at once.  Each edge is still one
+// store, to a mask of all the pins, so every machine gets the same timing
+// and there's no extra work in the isr per pin:
+//  - STM32: BSRR on GPIOA, so the pins have to be on port A with PA9
+//  - ESP32-C3: out_w1ts/out_w1tc (not with RMT_OUTPUT)
+//  - RP2040: the PIO's out pins, so the pins have to carry on one by one
+//    from outputPin (e.g. outputPin 0, FANOUT_PINS 1, 2, 3)
+//
+// FANOUT_INVERT is a bitmask (bit 0 the first of FANOUT_PINS) of outputs
+// with the level the other way up, for a machine that wants the opposite
+// polarity to the rest; the TSX/ZX polarity setting still turns them all
+// over together.  It's done in the mask (STM32) or by the pin's own output
+// inverter (ESP32-C3 GPIO matrix, RP2040 output override).
+//
+// FANOUT_MOTOR gives each of FANOUT_PINS its own motor sense input.  While
+// playing with motor control on, an output whose machine has its motor off
+// is dropped from the mask and holds its level, and picks up again when it
+// comes back on.  The pause for outputPin's own machine is still btnMotor's.
+
+#if !defined(__STM32F1__) && !defined(CONFIG_IDF_TARGET_ESP32C3) && !defined(ARDUINO_ARCH_RP2040)
+  #error FANOUT_PINS is for the STM32, ESP32-C3 and RP2040 boards
+#endif
+#if defined(RMT_OUTPUT)
+  #error FANOUT_PINS drives the pins from GPIO, not with RMT_OUTPUT
+#endif
+#if defined(DAC_OUTPUT)
+  #error FANOUT_PINS is for digital outputs, not DAC_OUTPUT
+#endif
+
+#ifndef FANOUT_INVERT
+  #define FANOUT_INVERT 0
+#endif
+
+constexpr byte fanoutPins[] = { FANOUT_PINS };
+constexpr byte fanoutCount = sizeof(fanoutPins);
+
+#ifdef FANOUT_MOTOR
+constexpr byte fanoutMotor[] = { FANOUT_MOTOR };
+static_assert(sizeof(fanoutMotor) == fanoutCount, "FANOUT_MOTOR needs one pin for each of FANOUT_PINS");
+#endif
+
+#if defined(ARDUINO_ARCH_RP2040)
+constexpr bool fanout_follows(byte i) {
+  return i >= fanoutCount || (fanoutPins[i] == outputPin + 1 + i && fanout_follows(i + 1));
+}
+static_assert(fanout_follows(0), "on the RP2040, FANOUT_PINS have to follow on from outputPin");
+#endif
+
+void fanout_setup();                      // in UniSetup, after INIT_OUTPORT
+#ifdef FANOUT_MOTOR
+void fanout_motor(bool on);               // each loop: playing, with motor control on
+#endif
+#endif
+
+#endif // FANOUT_H_INCLUDED
@@ -2,6 +2,18 @@
 #include "file_utils.h"
 #include "sdfat_config.h"
 #include <SdFat.h>
+#if defined(SD_SDIO) && !HAS_SDIO_CLASS
+  #error SD_SDIO needs SdFat's SdioCard, which this board doesn't have (HAS_SDIO_CLASS)
+#endif
+#include "inflate.h"
+#include "netstream.h"
+#include "cdcstream.h"
+#include "ramimage.h"
+#include "flashcache.h"
+#include "loopcache.h"
+#include "flashlib.h"
+#include "sddma.h"
+#include "profile.h"
 
 SdBaseFile entry;  // SD card file
 unsigned long bytesRead=0;
@@ -9,17 +21,365 @@ unsigned long filesize;
 byte lastByte;
 _readout_type readout;
 
-byte filebuffer[20]; // used for small reads from files (readfile, ReadByte, etc use this), sized for the largest small header read
+byte filebuffer[20]; // used for small reads from files (readfile, ReadByte, etc use this), sized for the largest small header read
+
+// Read-ahead window over the open file.  readfile() is called for every 1-4 byte
+// read during playback, so rather than seekSet+read on the card each time, we
+// keep one aligned slice of the file in RAM and only go back to the card when
+// the requested bytes fall outside it.
+#ifdef READAHEAD_PREFETCH
+// and a second, for the window after it (see readahead_prefetch): a fill
+// that wants that one just swaps the two over
+byte readahead_bufs[2][READAHEAD_SIZE];
+byte *readahead = readahead_bufs[0];
+byte *prefetch = readahead_bufs[1];
+unsigned long prefetch_base = 0;
+word prefetch_len = 0;   // 0 = nothing read ahead
+#ifdef SD_DMA_READ
+bool prefetch_dma = false;  // prefetch is being read in the background (sddma.h)
+#endif
+#elif defined(FLASH_LIBRARY)
+byte readahead_buf[READAHEAD_SIZE];
+byte *readahead = readahead_buf;   // (a pointer, to point into the library, see below)
+#else
+byte readahead[READAHEAD_SIZE];
+#endif
+unsigned long readahead_base = 0;
+word readahead_len = 0;  // 0 = window empty / invalid
+#ifdef FLASH_LIBRARY
+// while the library plays, readahead points into its mapping (flashlib.h):
+// this is the buffer it had, for the next fill to go back to
+byte *readahead_own = nullptr;
+#endif
+
+#ifdef SD_RAW_READ
+#if (READAHEAD_SIZE % 512) != 0
+  #error SD_RAW_READ reads whole sectors into the read-ahead window, so READAHEAD_SIZE must be a multiple of 512
+#endif
+// If entry sits in one contiguous run of sectors, the window is filled with
+// sd.card()->readSectors() straight from the card, skipping the FAT chain
+// and the file's own cache.  Sequential fills then carry on the card's
+// multi-sector read (on a dedicated SPI card, see setup)
+bool raw_checked = false;
+uint32_t raw_sector = 0;     // first sector of entry, 0 = not contiguous
+unsigned long raw_size = 0;
+
+bool raw_read(byte *dst, unsigned long base, word &len)
+{
+  if (!raw_checked) {
+    raw_checked = true;
+    uint32_t bgn, end;
+    raw_sector = entry.contiguousRange(&bgn, &end) ? bgn : 0;
+    raw_size = entry.fileSize();
+  }
+  if (raw_sector == 0) return false;
+  if (base < raw_size &&
+      sd.card()->readSectors(raw_sector + (base >> 9), dst, READAHEAD_SIZE >> 9)) {
+    const unsigned long left = raw_size - base;
+    len = (left < READAHEAD_SIZE) ? left : READAHEAD_SIZE;
+  }
+  return true;
+}
+
+bool raw_fill()
+{
+  return raw_read(readahead, readahead_base, readahead_len);
+}
+#endif
+
+#ifdef SD_DMA_READ
+void prefetch_settle()
+{
+  // the background read done (or given up on), so the card is free again
+  if (!prefetch_dma) return;
+  prefetch_dma = false;
+  const unsigned long left = raw_size - prefetch_base;
+  prefetch_len = !sd_dma_wait() ? 0 : (left < READAHEAD_SIZE) ? left : READAHEAD_SIZE;
+}
+#endif
+
+#ifdef SD_CLOCK_PROBE
+#if READAHEAD_SIZE < 512
+  #error SD_CLOCK_PROBE reads whole sectors into the read-ahead window, so READAHEAD_SIZE must be at least 512
+#endif
+namespace {
+bool probe_read(uint32_t sector, word &sum1, word &sum2)
+{
+  // Fletcher-16 of the window's worth of sectors from sector
+  if (!sd.card()->readSectors(sector, readahead, READAHEAD_SIZE >> 9)) return false;
+  word a = 0, b = 0;
+  for (word i = 0; i < READAHEAD_SIZE; i++) {
+    a = (a + readahead[i]) % 255;
+    b = (b + a) % 255;
+  }
+  sum1 = a;
+  sum2 = b;
+  return true;
+}
+} // namespace
+
+bool sd_probe()
+{
+  // Read the start, middle and end of the card twice over.  A clock that's too
+  // fast for the card (or the wiring) shows up as a failed read, a CRC error
+  // with USE_SD_CRC, or data that differs between the two.  The window is
+  // borrowed for it, nothing is open yet
+  readahead_len = 0;
+  const uint32_t count = sd.card()->sectorCount();
+  const uint32_t n = READAHEAD_SIZE >> 9;
+  if (count < 3*n) return false;
+  const uint32_t at[3] = { 0, count/2, count-n };
+  for (byte i = 0; i < 3; i++) {
+    word a1, b1, a2, b2;
+    if (!probe_read(at[i], a1, b1) || !probe_read(at[i], a2, b2)) return false;
+    if (a1 != a2 || b1 != b2) return false;
+  }
+  return true;
+}
+#endif
+
+bool stream_active()
+{
+#ifdef FLASH_LIBRARY
+  if(lib_active) return true;
+#endif
+#ifdef NET_STREAM
+  if(net_active) return true;
+#endif
+#ifdef CDC_STREAM
+  if(cdc_active) return true;
+#endif
+  return false;
+}
+
+void get_name(SdBaseFile &f, char *name)
+{
+  if (f.getName(name, filenameLength) == 0) {
+    // too long to fit
+    #ifdef NAME_WINDOW
+      f.getSFN(name, filenameLength);
+    #else
+      name[0] = '\0';
+    #endif
+  }
+}
+
+void readahead_invalidate()
+{
+#ifdef SD_DMA_READ
+  prefetch_settle();
+#endif
+  readahead_len = 0;
+#ifdef FLASH_LIBRARY
+  if (readahead_own) {
+    readahead = readahead_own;
+    readahead_own = nullptr;
+  }
+#endif
+#ifdef READAHEAD_PREFETCH
+  prefetch_len = 0;
+#endif
+#ifdef SD_RAW_READ
+  raw_checked = false;
+#endif
+}
+
+bool readahead_fill(unsigned long p)
+{
+  PROFILE_SCOPE(READAHEAD_FILL);
+  // align the window start so that full-sector reads line up with the card sectors
+  readahead_base = p & ~((unsigned long)(READAHEAD_SIZE-1));
+  readahead_len = 0;
+#ifdef FLASH_LIBRARY
+  if (readahead_own) {
+    readahead = readahead_own;
+    readahead_own = nullptr;
+  }
+#endif
+#ifdef SD_DMA_READ
+  prefetch_settle();
+#endif
+#ifdef READAHEAD_PREFETCH
+  if (prefetch_len && prefetch_base == readahead_base) {
+    // read while the ring was full
+    byte *const _b = readahead;
+    readahead = prefetch;
+    prefetch = _b;
+    readahead_len = prefetch_len;
+    prefetch_len = 0;
+    #ifdef SD_DMA_READ
+    readahead_prefetch();     // and the one after, while this one plays
+    #endif
+    return (p - readahead_base) < readahead_len;
+  }
+#endif
+#ifdef LOOP_CACHE
+  {
+    // inside a loop body that's been kept: the window starts at p, from RAM
+    const word n = loop_cache_read(p, readahead, READAHEAD_SIZE);
+    if (n) {
+      readahead_base = p;
+      readahead_len = n;
+      return true;
+    }
+  }
+#endif
+#ifdef Use_UEF_GZ
+  if(gz_active) {
+    // gzip'd file: the window is filled from the uncompressed stream
+    readahead_len = gz_read(readahead_base, readahead, READAHEAD_SIZE);
+    return (p - readahead_base) < readahead_len;
+  }
+#endif
+#ifdef NET_STREAM
+  if(net_active) {
+    // streamed from a URL: the window is filled from the network ring
+    readahead_len = net_read(readahead_base, readahead, READAHEAD_SIZE);
+    return (p - readahead_base) < readahead_len;
+  }
+#endif
+#ifdef CDC_STREAM
+  if(cdc_active) {
+    // sent over USB: ask the host for the window
+    readahead_len = cdc_read(readahead_base, readahead, READAHEAD_SIZE);
+    return (p - readahead_base) < readahead_len;
+  }
+#endif
+#ifdef RAM_PLAY
+  if(ram_active) {
+    // loaded whole as it opened: the window is filled from RAM
+    readahead_len = ram_read(readahead_base, readahead, READAHEAD_SIZE);
+    return (p - readahead_base) < readahead_len;
+  }
+#endif
+#ifdef FLASH_CACHE
+  if(flash_active) {
+    // played before: the window is filled from the copy in flash, not the card
+    readahead_len = flash_read(readahead_base, readahead, READAHEAD_SIZE);
+    return (p - readahead_base) < readahead_len;
+  }
+#endif
+#ifdef FLASH_LIBRARY
+  if(lib_active) {
+    // in the library: the window is the file's own bytes in the mapping, no copy
+    readahead_own = readahead;
+    readahead = (byte *)lib_window(readahead_base, 0x8000, readahead_len);
+    return (p - readahead_base) < readahead_len;
+  }
+#endif
+#ifdef SD_RAW_READ
+  if(raw_fill()) {
+    #ifdef SD_DMA_READ
+    readahead_prefetch();
+    #endif
+    return (p - readahead_base) < readahead_len;
+  }
+#endif
+  if(entry.seekSet(readahead_base)) {
+    int r = entry.read(readahead, READAHEAD_SIZE);
+    if (r > 0) readahead_len = r;
+  }
+  return (p - readahead_base) < readahead_len;
+}
+
+#ifdef READAHEAD_PREFETCH
+void readahead_prefetch()
+{
+  // The output ring is full, so the main loop has nothing to do until the
+  // ISR moves on (a long pause, say): read the window after this one now.
+  // The card's wait for a cluster change, or its own busy time, then comes
+  // out of the ISR's slack instead of out of the ring when it runs down
+  if (readahead_len != READAHEAD_SIZE || (readahead_base & (READAHEAD_SIZE-1))) return;   // the end, or a loop cache slice
+  const unsigned long next = readahead_base + READAHEAD_SIZE;
+  if (prefetch_len && prefetch_base == next) return;
+#ifdef SD_DMA_READ
+  if (prefetch_dma && prefetch_base == next) return;
+  prefetch_settle();
+#endif
+  if (!entry.isOpen() || stream_active() || next >= filesize) return;
+#ifdef Use_UEF_GZ
+  if (gz_active) return;
+#endif
+#ifdef RAM_PLAY
+  if (ram_active) return;           // nothing to wait for
+#endif
+#ifdef FLASH_CACHE
+  if (flash_active) return;
+#endif
+  prefetch_base = next;
+  prefetch_len = 0;
+#ifdef SD_DMA_READ
+  if (raw_checked && raw_sector) {
+    // in the background: prefetch_settle finishes it
+    prefetch_dma = sd_dma_start(prefetch, raw_sector + (next >> 9), READAHEAD_SIZE >> 9);
+    return;
+  }
+#endif
+#ifdef SD_RAW_READ
+  if (raw_read(prefetch, next, prefetch_len)) return;
+#endif
+  if (entry.seekSet(next)) {
+    int r = entry.read(prefetch, READAHEAD_SIZE);
+    if (r > 0) prefetch_len = r;
+  }
+}
+#endif
+
 byte readfile(byte nbytes, unsigned long p)
 {
   byte i=0;
-  if(entry.seekSet(p)) {
-    i=entry.read(filebuffer, nbytes);
-  } 
+  while(i<nbytes) {
+    if(readahead_len==0 || p<readahead_base || (p-readahead_base)>=readahead_len) {
+      if(!readahead_fill(p)) break; // end of file (or read error)
+    }
+    word offset = p - readahead_base;
+    while(i<nbytes && offset<readahead_len) {
+      filebuffer[i++] = readahead[offset++];
+      p++;
+    }
+  }
+  return i;
+}
+
+word readfile_words(volatile byte *dst, word n, unsigned long p)
+{
+  // p and n are even, and the window starts on a power of 2, so a word is
+  // never split between two fills
+  word i=0;
+  while(i<n) {
+    if(readahead_len==0 || p<readahead_base || (p-readahead_base)+1>=readahead_len) {
+      if(!readahead_fill(p) || (p-readahead_base)+1>=readahead_len) break; // end of file
+    }
+    word offset = p - readahead_base;
+    while(i<n && offset+1<readahead_len) {
+      dst[i] = readahead[offset];
+      dst[i+1] = readahead[offset+1];
+      i += 2;
+      offset += 2;
+      p += 2;
+    }
+  }
+  return i;
+}
+
+word readfile_bytes(volatile byte *dst, word n, unsigned long p)
+{
+  word i=0;
+  while(i<n) {
+    if(readahead_len==0 || p<readahead_base || (p-readahead_base)>=readahead_len) {
+      if(!readahead_fill(p)) break; // end of file (or read error)
+    }
+    word offset = p - readahead_base;
+    while(i<n && offset<readahead_len) {
+      dst[i++] = readahead[offset++];
+      p++;
+    }
+  }
   return i;
 }
 
 byte ReadByte() {
+  PROFILE_SCOPE(READBYTE);
   //Read a byte from the file, and move file position on one if successful
   //Always reads from bytesRead, which is the current position in the file
   if(readfile(1, bytesRead)==1)
@@ -15,10 +15,53 @@ extern unsigned long bytesRead;
 extern uint16_t currentFile; //File index (per filesystem) of current file, relative to current directory (pointed to by currentDir)
 extern char fileName[];
 
+// fileName holds filenameLength chars.  NAME_WINDOW keeps only that many of
+// each name (for the small boards); a name too long for it is shown as its
+// 8.3 short name, which still has the extension the players go by.
+#if defined(NAME_WINDOW)
+  #ifndef FAT16_32_Only
+    #error NAME_WINDOW falls back to the FAT 8.3 names, so needs FAT16_32_Only
+  #endif
+  #define filenameLength NAME_WINDOW
+#elif defined(FREERAM)
+  #define filenameLength 160
+#else
+  #define filenameLength 255
+#endif
+
+// f's name into name (filenameLength+1 chars)
+void get_name(SdBaseFile &f, char *name);
+
 extern byte filebuffer[]; // used for small reads from files (readfile, ReadByte, etc use this), sized for the largest small header read
 extern byte lastByte;
 
+// Size of the read-ahead window used by readfile().  Must be a power of 2.
+// A full 512 byte sector where there is RAM to spare, a smaller slice on the
+// small AVRs.  Can be overridden in userconfig.
+#ifndef READAHEAD_SIZE
+  #if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega32U4__)
+    #define READAHEAD_SIZE 64
+  #elif defined(MEGA_DEEP)
+    #define READAHEAD_SIZE 1024
+  #else
+    #define READAHEAD_SIZE 512
+  #endif
+#endif
+
+void readahead_invalidate(); // call whenever entry is (re)opened
+#ifdef READAHEAD_PREFETCH
+void readahead_prefetch();   // main loop, while the output ring is full: read the next window ahead
+                             // (with SD_DMA_READ, also as each window is filled, in the background)
+#endif
+#ifdef SD_CLOCK_PROBE
+bool sd_probe();             // just after sd.begin: do reads at this clock come back the same twice?
+#endif
+bool stream_active();        // true while the file is streamed (NET_STREAM, CDC_STREAM, FLASH_LIBRARY) rather than read from entry
 byte readfile(byte nbytes, unsigned long p);
+// Copy n bytes (even) of the file from p straight into the output buffer at dst, a word at a time; returns how many
+word readfile_words(volatile byte *dst, word n, unsigned long p);
+// The same for any n and p, a byte at a time
+word readfile_bytes(volatile byte *dst, word n, unsigned long p);
 byte ReadByte();
 byte ReadWord();
 byte ReadLong();
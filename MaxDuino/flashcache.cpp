@@ -0,0 +1,172 @@
+#include "configs.h"
+#include "flashcache.h"
+
+#ifdef FLASH_CACHE
+
+#if !defined(ESP32)
+  #error FLASH_CACHE needs an ESP32 (LittleFS in its flash)
+#endif
+
+#include <LittleFS.h>
+#include "file_utils.h"
+#include "MaxDuino.h"
+
+bool flash_active = false;
+
+namespace {
+// /fc/index holds the slots as they are here: which copies there are (each
+// in /fc/<key>), and when each was last played
+struct Slot {
+  uint32_t key;       // 0 = empty
+  uint32_t size;
+  uint32_t played;    // playCount when it last started, the smallest goes first
+};
+Slot slots[FLASH_CACHE_FILES];
+uint32_t playCount = 0;
+bool tried = false;
+bool mounted = false;
+
+fs::File copy;        // the flash copy, while flash_active
+uint32_t key = 0;     // entry's, when it could be kept (0 if not)
+byte chunk[512];      // flash_store's, card to flash
+
+const char INDEX_PATH[] = "/fc/index";
+
+bool mount() {
+  if (!tried) {
+    tried = true;
+    mounted = LittleFS.begin(true);   // formats the partition the first time
+    if (mounted) {
+      LittleFS.mkdir("/fc");
+      fs::File f = LittleFS.open(INDEX_PATH, "r");
+      if (!f || f.read((uint8_t *)slots, sizeof(slots)) != sizeof(slots)) memset(slots, 0, sizeof(slots));
+      if (f) f.close();
+      for (byte i = 0; i < FLASH_CACHE_FILES; i++) {
+        if (slots[i].played > playCount) playCount = slots[i].played;
+      }
+    }
+  }
+  return mounted;
+}
+
+void save_index() {
+  fs::File f = LittleFS.open(INDEX_PATH, "w");
+  if (!f) return;
+  f.write((const uint8_t *)slots, sizeof(slots));
+  f.close();
+}
+
+void copy_path(char *path, uint32_t k) {
+  sprintf(path, "/fc/%08lx", (unsigned long)k);
+}
+
+uint32_t entry_key() {
+  // FNV-1a of the name, then the first sector
+  uint32_t h = 2166136261UL;
+  for (const char *s = fileName; *s; s++) {
+    h ^= (byte)*s;
+    h *= 16777619UL;
+  }
+  h ^= entry.firstSector();
+  h *= 16777619UL;
+  return h ? h : 1;
+}
+
+void drop(byte i) {
+  char path[16];
+  copy_path(path, slots[i].key);
+  LittleFS.remove(path);
+  slots[i].key = 0;
+}
+
+int oldest() {
+  // the copy played longest ago, -1 if there are none
+  int o = -1;
+  for (byte i = 0; i < FLASH_CACHE_FILES; i++) {
+    if (slots[i].key && (o < 0 || slots[i].played < slots[o].played)) o = i;
+  }
+  return o;
+}
+} // anonymous namespace
+
+bool flash_open() {
+  flash_close();
+  const uint32_t size = entry.fileSize();
+  if (size == 0 || size > FLASH_CACHE_MAX || !mount()) return false;
+  key = entry_key();
+  for (byte i = 0; i < FLASH_CACHE_FILES; i++) {
+    if (slots[i].key != key || slots[i].size != size) continue;
+    char path[16];
+    copy_path(path, key);
+    copy = LittleFS.open(path, "r");
+    if (copy && copy.size() == size) {
+      slots[i].played = ++playCount;
+      save_index();
+      flash_active = true;
+      return true;
+    }
+    // lost (power off while it was written, say): it's copied again at the stop
+    if (copy) copy.close();
+    drop(i);
+    save_index();
+    return false;
+  }
+  return false;
+}
+
+void flash_store() {
+  if (flash_active || key == 0) return;
+  const uint32_t size = entry.fileSize();
+
+  // a free slot, and the room, the copies played longest ago going to make them
+  int slot = -1;
+  for (byte i = 0; i < FLASH_CACHE_FILES && slot < 0; i++) {
+    if (slots[i].key == 0) slot = i;
+  }
+  if (slot < 0) {
+    slot = oldest();
+    drop(slot);
+  }
+  while (LittleFS.totalBytes() - LittleFS.usedBytes() < size + FLASH_CACHE_SPARE) {
+    const int o = oldest();
+    if (o < 0) {
+      save_index();
+      return;
+    }
+    drop(o);
+  }
+
+  char path[16];
+  copy_path(path, key);
+  fs::File f = LittleFS.open(path, "w");
+  bool ok = f && entry.seekSet(0);
+  uint32_t done = 0;
+  while (ok && done < size) {
+    const int n = entry.read(chunk, sizeof(chunk));
+    ok = n > 0 && f.write(chunk, n) == (size_t)n;
+    done += n;
+  }
+  if (f) f.close();
+  if (ok) {
+    slots[slot].key = key;
+    slots[slot].size = size;
+    slots[slot].played = ++playCount;
+  } else {
+    LittleFS.remove(path);
+  }
+  save_index();
+}
+
+void flash_close() {
+  if (copy) copy.close();
+  flash_active = false;
+  key = 0;
+}
+
+word flash_read(unsigned long pos, byte *dst, word n) {
+  if (!copy.seek(pos)) return 0;
+  const int r = copy.read(dst, n);
+  return (r > 0) ? r : 0;
+}
+
+#endif // FLASH_CACHE
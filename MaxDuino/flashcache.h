@@ -0,0 +1,41 @@
+#ifndef FLASHCACHE_H_INCLUDED
+#define FLASHCACHE_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef FLASH_CACHE
+#include "Arduino.h"
+
+// Keeps copies of the most recently played files in the ESP32's own flash
+// (LittleFS, in the board's spiffs partition).  A file that played from the
+// card is copied over when it stops, while nothing is playing; the next time
+// it starts, readfile() and friends fill their window from the copy and the
+// card is only read for the directory.  When flash or the index is full the
+// copy played longest ago goes first.  A file is known by its name, size and
+// first sector on the card, so one that's replaced (on the card, over USB or
+// WiFi) isn't mistaken for its old copy.  The gzip'd UEF, MZF and MTX readers
+// go to entry themselves, so are still read from the card.
+
+#ifndef FLASH_CACHE_FILES
+  #define FLASH_CACHE_FILES 32      // copies kept at most
+#endif
+#ifndef FLASH_CACHE_MAX
+  #define FLASH_CACHE_MAX 262144    // the biggest file that's copied
+#endif
+#define FLASH_CACHE_SPARE 16384     // flash left free after a copy, for LittleFS itself
+
+extern bool flash_active;
+
+// From UniPlay with entry open: play from the flash copy if there is one; returns flash_active
+bool flash_open();
+
+// From UniStop with entry still open: copy it to flash if it played from the card
+void flash_store();
+
+void flash_close();
+
+// Read up to n bytes starting at pos into dst; returns how many
+word flash_read(unsigned long pos, byte *dst, word n);
+#endif
+
+#endif // FLASHCACHE_H_INCLUDED
@@ -0,0 +1,96 @@
+#include "configs.h"
+#include "flashlib.h"
+
+#ifdef FLASH_LIBRARY
+
+#include "file_utils.h"
+#include <esp_partition.h>
+
+bool lib_browsing = false;
+bool lib_active = false;
+
+namespace {
+struct LibEntry {
+  char name[FLASH_LIBRARY_NAME];
+  uint32_t offset;
+  uint32_t size;
+};
+static_assert(sizeof(LibEntry) == 64, "the library's index entries are 64 bytes");
+constexpr uint32_t HEADER_SIZE = 8;
+
+const byte *base = nullptr;       // the partition, mapped
+uint32_t partSize = 0;
+uint16_t count = 0;
+const LibEntry *table = nullptr;
+const byte *playing = nullptr;    // the open entry's bytes
+unsigned long playingSize = 0;
+
+uint16_t get16(const byte *p) {
+  return p[0] | (p[1] << 8);
+}
+} // anonymous namespace
+
+bool lib_begin() {
+  if (base) return count != 0;
+  const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+    (esp_partition_subtype_t)FLASH_LIBRARY_SUBTYPE, FLASH_LIBRARY_LABEL);
+  if (!part) return false;
+  const void *p;
+  spi_flash_mmap_handle_t handle;   // kept for good: the mapping's there until power off
+  if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &p, &handle) != ESP_OK) return false;
+  base = (const byte *)p;
+  partSize = part->size;
+  if (memcmp(base, "MXLB", 4) != 0) return false;
+  const uint16_t n = get16(base + 4);
+  if (HEADER_SIZE + (uint32_t)n * sizeof(LibEntry) > partSize) return false;
+  table = (const LibEntry *)(base + HEADER_SIZE);
+  // an entry that runs off the end of the partition means the image is bad (or cut short): none of it
+  for (uint16_t i = 0; i < n; i++) {
+    if (table[i].offset > partSize || table[i].size > partSize - table[i].offset) return false;
+  }
+  count = n;
+  return count != 0;
+}
+
+bool lib_present() {
+  return count != 0;
+}
+
+uint16_t lib_count() {
+  return count;
+}
+
+bool lib_member(uint16_t i, char *name, unsigned long &size) {
+  if (i >= count) return false;
+  const byte most = (filenameLength < FLASH_LIBRARY_NAME - 1) ? filenameLength : FLASH_LIBRARY_NAME - 1;
+  const byte n = strnlen(table[i].name, most);
+  memcpy(name, table[i].name, n);
+  name[n] = '\0';
+  size = table[i].size;
+  return true;
+}
+
+bool lib_open(uint16_t i) {
+  lib_active = false;
+  if (i >= count) return false;
+  playing = base + table[i].offset;
+  playingSize = table[i].size;
+  filesize = playingSize;
+  lib_active = true;
+  return true;
+}
+
+void lib_close() {
+  lib_active = false;
+  playing = nullptr;
+  playingSize = 0;
+}
+
+const byte *lib_window(unsigned long pos, word max, word &len) {
+  len = 0;
+  if (!lib_active || pos >= playingSize) return playing;
+  len = (playingSize - pos < max) ? playingSize - pos : max;
+  return playing + pos;
+}
+
+#endif // FLASH_LIBRARY
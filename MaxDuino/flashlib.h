@@ -0,0 +1,58 @@
+#ifndef FLASHLIB_H_INCLUDED
+#define FLASHLIB_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef FLASH_LIBRARY
+#include "Arduino.h"
+
+// A fixed library of tapes in a flash partition of its own (ESP32), for
+// a player that has to work with no card in.  The partition is mapped
+// whole at startup (esp_partition_mmap), and a file in it plays with the
+// read-ahead window pointed straight at its bytes in the mapping: no copy,
+// and no card, FAT or seek in the way.
+//
+// In the browser it's a directory: stop at the root goes into it, and
+// stop comes back out (as a zip's members, each entry is one step).  With
+// no card in, the player starts in it.  It plays as NET_STREAM's files do
+// (stream_active), so the gzip'd UEF, MZF and MTX readers, which go to
+// entry themselves, can't play from it.
+//
+// tools/mklib.py builds the image: a header, then an index, then the files
+//   "MXLB", count (2 bytes), 0 (2)
+//   count entries of name (56, 0 padded), offset from the start (4), size (4)
+// all little endian.  The partition is a data partition of subtype
+// FLASH_LIBRARY_SUBTYPE called FLASH_LIBRARY_LABEL (see mklib.py).
+
+#if !defined(ESP32)
+  #error FLASH_LIBRARY maps an ESP32 flash partition
+#endif
+
+#ifndef FLASH_LIBRARY_LABEL
+  #define FLASH_LIBRARY_LABEL "tapes"
+#endif
+#ifndef FLASH_LIBRARY_SUBTYPE
+  #define FLASH_LIBRARY_SUBTYPE 0x40  // one of the custom data subtypes
+#endif
+#define FLASH_LIBRARY_NAME 56         // the most of a name kept, with its 0
+
+extern bool lib_browsing;     // in the library: currentFile is an entry, 0 to lib_count()-1
+extern bool lib_active;       // playing from it
+
+bool lib_begin();             // setup: map the partition; false if there isn't a library in it
+bool lib_present();
+uint16_t lib_count();
+// entry i's name (filenameLength+1 chars) and size
+bool lib_member(uint16_t i, char *name, unsigned long &size);
+// From UniPlay: play entry i (sets filesize); returns lib_active
+bool lib_open(uint16_t i);
+void lib_close();
+// The file's bytes from pos, in the mapping: len is how many (up to max)
+const byte *lib_window(unsigned long pos, word max, word &len);
+
+#define LIB_BROWSING lib_browsing
+#else
+#define LIB_BROWSING false
+#endif
+
+#endif // FLASHLIB_H_INCLUDED
@@ -0,0 +1,96 @@
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x3F,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x30,0xFF,0x30,0xFF,0x30,0x00,0x00,0x00,0x03,0x3F,0x03,0x3F,0x03,0x00,0x00,
+0x00,0x30,0xCC,0xFF,0xCC,0x0C,0x00,0x00,0x00,0x0C,0x0C,0x3F,0x0C,0x03,0x00,0x00,
+0x00,0x0F,0x0F,0xC0,0x30,0x0C,0x00,0x00,0x00,0x0C,0x03,0x00,0x3C,0x3C,0x00,0x00,
+0x00,0x3C,0xC3,0x33,0x0C,0x00,0x00,0x00,0x00,0x0F,0x30,0x33,0x0C,0x33,0x00,0x00,
+0x00,0x00,0x33,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0xF0,0x0C,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x0C,0x30,0x00,0x00,0x00,0x00,
+0x00,0x03,0x0C,0xF0,0x00,0x00,0x00,0x00,0x00,0x30,0x0C,0x03,0x00,0x00,0x00,0x00,
+0x00,0xC0,0xCC,0xF0,0xCC,0xC0,0x00,0x00,0x00,0x00,0x0C,0x03,0x0C,0x00,0x00,0x00,
+0x00,0xC0,0xC0,0xFC,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x3C,0x00,0x00,0x00,0x00,0x00,
+0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x3C,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0xC0,0x30,0x0C,0x00,0x00,0x00,0x0C,0x03,0x00,0x00,0x00,0x00,0x00,
+0x00,0xFC,0x03,0xC3,0x33,0xFC,0x00,0x00,0x00,0x0F,0x33,0x30,0x30,0x0F,0x00,0x00,
+0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x3F,0x30,0x00,0x00,0x00,
+0x00,0x0C,0x03,0xC3,0xC3,0x3C,0x00,0x00,0x00,0x3C,0x33,0x30,0x30,0x30,0x00,0x00,
+0x00,0x0C,0x03,0xC3,0xC3,0x3C,0x00,0x00,0x00,0x0C,0x30,0x30,0x30,0x0F,0x00,0x00,
+0x00,0xC0,0x30,0x0C,0xFF,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x3F,0x03,0x00,0x00,
+0x00,0x3F,0x33,0x33,0x33,0xC3,0x00,0x00,0x00,0x0C,0x30,0x30,0x30,0x0F,0x00,0x00,
+0x00,0xF0,0xCC,0xC3,0xC3,0x00,0x00,0x00,0x00,0x0F,0x30,0x30,0x30,0x0F,0x00,0x00,
+0x00,0x03,0x03,0xC3,0x33,0x0F,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,
+0x00,0x3C,0xC3,0xC3,0xC3,0x3C,0x00,0x00,0x00,0x0F,0x30,0x30,0x30,0x0F,0x00,0x00,
+0x00,0x3C,0xC3,0xC3,0xC3,0xFC,0x00,0x00,0x00,0x00,0x30,0x30,0x0C,0x03,0x00,0x00,
+0x00,0x00,0x3C,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x0F,0x00,0x00,0x00,0x00,
+0x00,0x00,0xF0,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x3C,0x00,0x00,0x00,0x00,
+0x00,0xC0,0x30,0x0C,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x0C,0x30,0x00,0x00,0x00,
+0x00,0x30,0x30,0x30,0x30,0x30,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x00,0x00,
+0x00,0x03,0x0C,0x30,0xC0,0x00,0x00,0x00,0x00,0x30,0x0C,0x03,0x00,0x00,0x00,0x00,
+0x00,0x0C,0x03,0x03,0xC3,0x3C,0x00,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x00,
+0x00,0x0C,0xC3,0xC3,0x03,0xFC,0x00,0x00,0x00,0x0F,0x30,0x3F,0x30,0x0F,0x00,0x00,
+0x00,0xFC,0xC3,0xC3,0xC3,0xFC,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,
+0x00,0xFF,0xC3,0xC3,0xC3,0x3C,0x00,0x00,0x00,0x3F,0x30,0x30,0x30,0x0F,0x00,0x00,
+0x00,0xFC,0x03,0x03,0x03,0x0C,0x00,0x00,0x00,0x0F,0x30,0x30,0x30,0x0C,0x00,0x00,
+0x00,0xFF,0x03,0x03,0x0C,0xF0,0x00,0x00,0x00,0x3F,0x30,0x30,0x0C,0x03,0x00,0x00,
+0x00,0xFF,0xC3,0xC3,0xC3,0x03,0x00,0x00,0x00,0x3F,0x30,0x30,0x30,0x30,0x00,0x00,
+0x00,0xFF,0xC3,0xC3,0xC3,0x03,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0xFC,0x03,0x03,0x03,0x0C,0x00,0x00,0x00,0x0F,0x30,0x30,0x33,0x3F,0x00,0x00,
+0x00,0xFF,0xC0,0xC0,0xC0,0xFF,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,
+0x00,0x03,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x30,0x3F,0x30,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x03,0xFF,0x03,0x00,0x00,0x00,0x0C,0x30,0x30,0x0F,0x00,0x00,0x00,
+0x00,0xFF,0xC0,0x30,0x0C,0x03,0x00,0x00,0x00,0x3F,0x00,0x03,0x0C,0x30,0x00,0x00,
+0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x30,0x30,0x30,0x30,0x00,0x00,
+0x00,0xFF,0x0C,0xF0,0x0C,0xFF,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,
+0x00,0xFF,0x30,0xC0,0x00,0xFF,0x00,0x00,0x00,0x3F,0x00,0x00,0x03,0x3F,0x00,0x00,
+0x00,0xFC,0x03,0x03,0x03,0xFC,0x00,0x00,0x00,0x0F,0x30,0x30,0x30,0x0F,0x00,0x00,
+0x00,0xFF,0xC3,0xC3,0xC3,0x3C,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0xFC,0x03,0x03,0x03,0xFC,0x00,0x00,0x00,0x0F,0x30,0x33,0x0C,0x33,0x00,0x00,
+0x00,0xFF,0xC3,0xC3,0xC3,0x3C,0x00,0x00,0x00,0x3F,0x00,0x03,0x0C,0x30,0x00,0x00,
+0x00,0x3C,0xC3,0xC3,0xC3,0x0C,0x00,0x00,0x00,0x0C,0x30,0x30,0x30,0x0F,0x00,0x00,
+0x00,0x03,0x03,0xFF,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,
+0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x0F,0x30,0x30,0x30,0x0F,0x00,0x00,
+0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x03,0x0C,0x30,0x0C,0x03,0x00,0x00,
+0x00,0xFF,0x00,0xC0,0x00,0xFF,0x00,0x00,0x00,0x0F,0x30,0x0F,0x30,0x0F,0x00,0x00,
+0x00,0x0F,0x30,0xC0,0x30,0x0F,0x00,0x00,0x00,0x3C,0x03,0x00,0x03,0x3C,0x00,0x00,
+0x00,0x0F,0x30,0xC0,0x30,0x0F,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,
+0x00,0x03,0x03,0xC3,0x33,0x0F,0x00,0x00,0x00,0x3C,0x33,0x30,0x30,0x30,0x00,0x00,
+0x00,0xFF,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x3F,0x30,0x30,0x00,0x00,0x00,0x00,
+0x00,0x0C,0x30,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0C,0x00,0x00,
+0x00,0x03,0x03,0xFF,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x3F,0x00,0x00,0x00,0x00,
+0x00,0x30,0x0C,0x03,0x0C,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,
+0x00,0x03,0x0C,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x30,0x30,0x30,0xC0,0x00,0x00,0x00,0x0C,0x33,0x33,0x33,0x3F,0x00,0x00,
+0x00,0xFF,0xC0,0x30,0x30,0xC0,0x00,0x00,0x00,0x3F,0x30,0x30,0x30,0x0F,0x00,0x00,
+0x00,0xC0,0x30,0x30,0xC0,0x00,0x00,0x00,0x00,0x0F,0x30,0x30,0x0C,0x00,0x00,0x00,
+0x00,0xC0,0x30,0x30,0xC0,0xFF,0x00,0x00,0x00,0x0F,0x30,0x30,0x30,0x3F,0x00,0x00,
+0x00,0xC0,0x30,0x30,0x30,0xC0,0x00,0x00,0x00,0x0F,0x33,0x33,0x33,0x03,0x00,0x00,
+0x00,0xC0,0xFC,0xC3,0x0C,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,
+0x00,0xC0,0x30,0x30,0x30,0xF0,0x00,0x00,0x00,0x03,0xCC,0xCC,0xCC,0x3F,0x00,0x00,
+0x00,0xFF,0xC0,0x30,0x30,0xC0,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,
+0x00,0x00,0xF3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x30,0xF3,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0x3F,0x00,0x00,0x00,0x00,
+0x00,0xFF,0x00,0xC0,0x30,0x00,0x00,0x00,0x00,0x3F,0x03,0x0C,0x30,0x00,0x00,0x00,
+0x00,0x03,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x3F,0x30,0x00,0x00,0x00,0x00,
+0x00,0xF0,0x30,0xC0,0x30,0xC0,0x00,0x00,0x00,0x3F,0x00,0x03,0x00,0x3F,0x00,0x00,
+0x00,0xF0,0xC0,0x30,0xF0,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x00,
+0x00,0xC0,0x30,0x30,0xC0,0x00,0x00,0x00,0x00,0x0F,0x30,0x30,0x0F,0x00,0x00,0x00,
+0x00,0xF0,0x30,0x30,0xC0,0x00,0x00,0x00,0x00,0xFF,0x0C,0x0C,0x03,0x00,0x00,0x00,
+0x00,0xC0,0x30,0x30,0xF0,0x00,0x00,0x00,0x00,0x03,0x0C,0x0C,0xFF,0x00,0x00,0x00,
+0x00,0x00,0xF0,0xC0,0x30,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,
+0x00,0xC0,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x30,0x33,0x33,0x0C,0x00,0x00,0x00,
+0x00,0x30,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x30,0x00,0x00,0x00,0x00,
+0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x0F,0x30,0x30,0x3F,0x00,0x00,0x00,
+0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x03,0x0C,0x30,0x0C,0x03,0x00,0x00,
+0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x0F,0x30,0x0F,0x30,0x0F,0x00,0x00,
+0x00,0x30,0xC0,0x00,0xC0,0x30,0x00,0x00,0x00,0x30,0x0C,0x03,0x0C,0x30,0x00,0x00,
+0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x03,0xCC,0xCC,0x3F,0x00,0x00,0x00,
+0x00,0x30,0x30,0x30,0xF0,0x30,0x00,0x00,0x00,0x30,0x3C,0x33,0x30,0x30,0x00,0x00,
+0x00,0xC0,0x3C,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x30,0x00,0x00,0x00,0x00,
+0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,
+0x00,0x03,0x3C,0xC0,0x00,0x00,0x00,0x00,0x00,0x30,0x0F,0x00,0x00,0x00,0x00,0x00,
+0x00,0x0C,0x03,0x03,0x0C,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x0C,0x33,0x33,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
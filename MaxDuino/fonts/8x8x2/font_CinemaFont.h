@@ -0,0 +1,96 @@
+//0x08,0x08,0x20,0x5F,  // size 8x8, first 32, count 95
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// SPC
+0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x3C,0x3C,0x3C,0x00,0x00,0x00,// symbol '!'
+0x30,0x3F,0x0F,0x00,0x30,0x3F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// symbol '"'
+0x3C,0xFF,0xFF,0x3C,0x3C,0xFF,0x3C,0x00,0x0F,0x3F,0x3F,0x0F,0x0F,0x3F,0x0F,0x00,// symbol '#'
+0x30,0xFC,0xFC,0xCF,0xCF,0xCC,0x0C,0x00,0x0C,0x0C,0x3C,0x3C,0x0F,0x0F,0x03,0x00,// symbol '$'
+0x0C,0x33,0xF3,0xFC,0xFC,0x3F,0x0C,0x00,0x0C,0x3F,0x0F,0x0F,0x33,0x33,0x0C,0x00,// symbol '%'
+0x3C,0xFF,0xFF,0xC3,0xC3,0xF0,0xC0,0x00,0x0F,0x3F,0x3F,0x30,0x30,0x0F,0x30,0x00,// symbol '&'
+0x00,0x30,0x3F,0x3F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// symbol '''
+0x00,0xF0,0xFC,0xFF,0x0F,0x03,0x03,0x00,0x00,0x03,0x0F,0x3F,0x3C,0x30,0x30,0x00,// symbol '('
+0x00,0x03,0x03,0x0F,0xFF,0xFC,0xF0,0x00,0x00,0x30,0x30,0x3C,0x3F,0x0F,0x03,0x00,// symbol ')'
+0xC0,0xFC,0xFC,0xF0,0xFC,0xFC,0xC0,0x00,0x00,0x0F,0x0F,0x03,0x0F,0x0F,0x00,0x00,// symbol '*'
+0xC0,0xC0,0xFC,0xFC,0xFC,0xC0,0xC0,0x00,0x00,0x00,0x0F,0x0F,0x0F,0x00,0x00,0x00,// symbol '+'
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFC,0x3C,0x00,0x00,0x00,// symbol ','
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,0x00,// symbol '-'
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x3C,0x3C,0x00,0x00,0x00,// symbol '.'
+0x00,0x00,0xC0,0xF0,0xFC,0x3F,0x0F,0x00,0x3C,0x3F,0x0F,0x03,0x00,0x00,0x00,0x00,// symbol '/'
+0xF0,0xFC,0xFF,0x03,0x03,0x0C,0xF0,0x00,0x03,0x0F,0x3F,0x30,0x30,0x0C,0x03,0x00,// digit '0'
+0x00,0x0C,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x30,0x3F,0x3F,0x3F,0x30,0x00,0x00,// digit '1'
+0x0C,0x03,0x03,0xC3,0xFF,0xFF,0x3C,0x00,0x30,0x3C,0x3F,0x3F,0x33,0x30,0x30,0x00,// digit '2'
+0x0C,0x03,0xC3,0xC3,0xFF,0xFF,0x3C,0x00,0x0C,0x30,0x30,0x30,0x3F,0x3F,0x0F,0x00,// digit '3'
+0xC0,0x30,0x0C,0xFF,0xFF,0xFF,0x00,0x00,0x03,0x03,0x03,0x3F,0x3F,0x3F,0x03,0x00,// digit '4'
+0x3F,0x33,0x33,0x33,0xF3,0xF3,0xC3,0x00,0x0C,0x30,0x30,0x30,0x3F,0x3F,0x0F,0x00,// digit '5'
+0xF0,0xFC,0xFF,0xCF,0xC3,0xC0,0x00,0x00,0x0F,0x3F,0x3F,0x30,0x30,0x30,0x0F,0x00,// digit '6'
+0x03,0x03,0x03,0xC3,0xFF,0xFF,0x3F,0x00,0x00,0x00,0x3F,0x3F,0x3F,0x00,0x00,0x00,// digit '7'
+0x3C,0xFF,0xFF,0xF3,0xC3,0xC3,0x3C,0x00,0x0F,0x30,0x30,0x33,0x3F,0x3F,0x0F,0x00,// digit '8'
+0x3C,0xC3,0xC3,0xC3,0xFF,0xFF,0xFC,0x00,0x00,0x30,0x3C,0x3F,0x0F,0x03,0x00,0x00,// digit '9'
+0x00,0x00,0xF0,0xF0,0xF0,0x00,0x00,0x00,0x00,0x00,0x3C,0x3C,0x3C,0x00,0x00,0x00,// symbol ':'
+0x00,0x00,0xF0,0xF0,0xF0,0x00,0x00,0x00,0x00,0xC0,0xFC,0xFC,0x3C,0x00,0x00,0x00,// symbol ';'
+0x00,0xC0,0xF0,0xFC,0x3F,0x0F,0x03,0x00,0x00,0x00,0x03,0x0F,0x3F,0x3C,0x30,0x00,// symbol '<'
+0x00,0x30,0x30,0x30,0x30,0x30,0x30,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,0x00,// symbol '='
+0x00,0x03,0x0F,0x3F,0xFC,0xF0,0xC0,0x00,0x00,0x30,0x3C,0x3F,0x0F,0x03,0x00,0x00,// symbol '>'
+0x0C,0x03,0x03,0xC3,0xFF,0xFF,0x3C,0x00,0x00,0x00,0x3C,0x3C,0x3C,0x00,0x00,0x00,// symbol '?'
+0xFC,0xFF,0xFF,0x03,0xC3,0x33,0xFC,0x00,0x0F,0x3F,0x3F,0x30,0x33,0x33,0x33,0x00,// symbol '@'
+0xF0,0xFC,0xFF,0x0F,0x03,0x0C,0xF0,0x00,0x3F,0x3F,0x3F,0x03,0x03,0x03,0x3F,0x00,// eng 'A'
+0xFF,0xFF,0xFF,0xC3,0xC3,0xC3,0x3C,0x00,0x3F,0x3F,0x3F,0x30,0x30,0x30,0x0F,0x00,// eng 'B'
+0xFC,0xFF,0xFF,0x03,0x03,0x03,0x3C,0x00,0x0F,0x3F,0x3F,0x30,0x30,0x30,0x0F,0x00,// eng 'C'
+0xFF,0xFF,0xFF,0x03,0x03,0x0C,0xF0,0x00,0x3F,0x3F,0x3F,0x30,0x30,0x0C,0x03,0x00,// eng 'D'
+0xFF,0xFF,0xFF,0xC3,0xC3,0x03,0x03,0x00,0x3F,0x3F,0x3F,0x30,0x30,0x30,0x30,0x00,// eng 'E'
+0xFF,0xFF,0xFF,0xC3,0xC3,0x03,0x03,0x00,0x3F,0x3F,0x3F,0x00,0x00,0x00,0x00,0x00,// eng 'F'
+0xFC,0xFF,0xFF,0x03,0xC3,0xC3,0xCC,0x00,0x0F,0x3F,0x3F,0x30,0x30,0x0C,0x3F,0x00,// eng 'G'
+0xFF,0xFF,0xFF,0xC0,0xC0,0xC0,0xFF,0x00,0x3F,0x3F,0x3F,0x00,0x00,0x00,0x3F,0x00,// eng 'H'
+0x00,0x03,0xFF,0xFF,0xFF,0x03,0x00,0x00,0x00,0x30,0x3F,0x3F,0x3F,0x30,0x00,0x00,// eng 'I'
+0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x0F,0x30,0x30,0x30,0x3F,0x3F,0x0F,0x00,// eng 'J'
+0xFF,0xFF,0xFF,0xC0,0xC0,0x30,0x0F,0x00,0x3F,0x3F,0x3F,0x00,0x00,0x03,0x3C,0x00,// eng 'K'
+0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x3F,0x3F,0x3F,0x30,0x30,0x30,0x30,0x00,// eng 'L'
+0xFF,0xFF,0xFC,0xF0,0xF0,0xFC,0xFF,0x00,0x3F,0x3F,0x3F,0x00,0x03,0x00,0x3F,0x00,// eng 'M'
+0xFF,0xFF,0xFC,0xF0,0xC0,0x00,0xFF,0x00,0x3F,0x3F,0x3F,0x00,0x03,0x0F,0x3F,0x00,// eng 'N'
+0xFC,0xFF,0xFF,0x03,0x03,0x03,0xFC,0x00,0x0F,0x3F,0x3F,0x30,0x30,0x30,0x0F,0x00,// eng 'O'
+0xFF,0xFF,0xFF,0x03,0x03,0x03,0xFC,0x00,0x3F,0x3F,0x3F,0x03,0x03,0x03,0x00,0x00,// eng 'P'
+0xFC,0xFF,0xFF,0x03,0xC3,0x03,0xFC,0x00,0x0F,0x3F,0x3F,0x30,0x0C,0x03,0x3C,0x00,// eng 'Q'
+0xFF,0xFF,0xFF,0xC3,0xC3,0xC3,0x3C,0x00,0x3F,0x3F,0x3F,0x00,0x03,0x0C,0x30,0x00,// eng 'R'
+0x3C,0xFF,0xFF,0xC3,0xC3,0xC3,0x0C,0x00,0x0C,0x30,0x30,0x30,0x3F,0x3F,0x0F,0x00,// eng 'S'
+0x03,0x03,0xFF,0xFF,0xFF,0x03,0x03,0x00,0x00,0x00,0x3F,0x3F,0x3F,0x00,0x00,0x00,// eng 'T'
+0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x00,0x0F,0x3F,0x3F,0x30,0x30,0x30,0x0F,0x00,// eng 'U'
+0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x00,0x03,0x0F,0x3F,0x3C,0x30,0x0C,0x03,0x00,// eng 'V'
+0xFF,0xFF,0xFF,0xC0,0xF0,0xC0,0xFF,0x00,0x3F,0x3F,0x0F,0x03,0x03,0x0F,0x3F,0x00,// eng 'W'
+0x0F,0x3F,0xFF,0xF0,0xF0,0x0C,0x03,0x00,0x30,0x0C,0x03,0x03,0x3F,0x3F,0x3C,0x00,// eng 'X'
+0x0F,0x3F,0xFF,0xF0,0xC0,0xF0,0x0F,0x00,0x0C,0x30,0x30,0x0F,0x03,0x00,0x00,0x00,// eng 'Y'
+0x03,0x03,0xC3,0xF3,0xFF,0x3F,0x0F,0x00,0x3C,0x3F,0x3F,0x33,0x30,0x30,0x30,0x00,// eng 'Z'
+0x00,0xFF,0xFF,0xFF,0x03,0x03,0x00,0x00,0x00,0x3F,0x3F,0x3F,0x30,0x30,0x00,0x00,// symbol '['
+0x0F,0x3F,0xFC,0xF0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0F,0x3F,0x3C,0x00,// symbol '\'
+0x00,0x03,0x03,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x30,0x30,0x3F,0x3F,0x3F,0x00,0x00,// symbol ']'
+0xC0,0xF0,0xFC,0xFF,0xFC,0xF0,0xC0,0x00,0x00,0x00,0x3F,0x3F,0x3F,0x00,0x00,0x00,// symbol '^'
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,// symbol '_'
+0xC0,0xFC,0xFF,0xFF,0xC3,0xC3,0x0C,0x00,0x30,0x3F,0x3F,0x3F,0x30,0x30,0x30,0x00,// symbol '`'
+0x00,0x30,0x30,0x30,0xF0,0xF0,0xC0,0x00,0x0C,0x33,0x33,0x33,0x3F,0x3F,0x3F,0x00,// eng 'a'
+0xFF,0xFF,0xFF,0x30,0x30,0x30,0xC0,0x00,0x3F,0x3F,0x3F,0x30,0x30,0x30,0x0F,0x00,// eng 'b'
+0xC0,0xF0,0xF0,0x30,0x30,0x30,0xC0,0x00,0x0F,0x3F,0x3F,0x30,0x30,0x30,0x0C,0x00,// eng 'c'
+0xC0,0x30,0x30,0x30,0xFF,0xFF,0xFF,0x00,0x0F,0x30,0x30,0x30,0x3F,0x3F,0x3F,0x00,// eng 'd'
+0xC0,0xF0,0xF0,0x30,0x30,0x30,0xC0,0x00,0x0F,0x3F,0x3F,0x33,0x33,0x33,0x33,0x00,// eng 'e'
+0xC0,0xFC,0xFF,0xFF,0xC3,0x03,0x3C,0x00,0x00,0x3F,0x3F,0x3F,0x00,0x00,0x00,0x00,// eng 'f'
+0xC0,0x30,0x30,0x30,0xF0,0xF0,0xF0,0x00,0x03,0xCC,0xCC,0xCC,0xFF,0xFF,0x3F,0x00,// eng 'g'
+0xFF,0xFF,0xFF,0x30,0x30,0x30,0xC0,0x00,0x3F,0x3F,0x3F,0x00,0x00,0x00,0x3F,0x00,// eng 'h'
+0x00,0x00,0xF3,0xF3,0xF3,0x00,0x00,0x00,0x00,0x00,0x3F,0x3F,0x3F,0x00,0x00,0x00,// eng 'i'
+0x00,0x00,0x00,0x00,0xF3,0xF3,0xF3,0x00,0x3C,0xC0,0xC0,0xC0,0xFF,0xFF,0x3F,0x00,// eng 'j'
+0xFF,0xFF,0xFF,0x00,0x00,0xC0,0x30,0x00,0x3F,0x3F,0x3F,0x03,0x03,0x0C,0x30,0x00,// eng 'k'
+0x00,0x00,0x03,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x3F,0x3F,0x3F,0x00,0x00,// eng 'l'
+0xF0,0xF0,0xF0,0x30,0xC0,0x30,0xC0,0x00,0x3F,0x3F,0x3F,0x00,0x3F,0x00,0x3F,0x00,// eng 'm'
+0xF0,0xF0,0xF0,0x30,0x30,0x30,0xC0,0x00,0x3F,0x3F,0x3F,0x00,0x00,0x00,0x3F,0x00,// eng 'n'
+0xC0,0xF0,0xF0,0x30,0x30,0x30,0xC0,0x00,0x0F,0x3F,0x3F,0x30,0x30,0x30,0x0F,0x00,// eng 'o'
+0xF0,0xF0,0xF0,0x30,0x30,0x30,0xC0,0x00,0xFF,0xFF,0xFF,0x0C,0x0C,0x0C,0x03,0x00,// eng 'p'
+0xC0,0x30,0x30,0x30,0xF0,0xF0,0xF0,0x00,0x03,0x0C,0x0C,0x0C,0xFF,0xFF,0xFF,0x00,// eng 'q'
+0xF0,0xF0,0xF0,0x30,0x30,0x30,0xC0,0x00,0x3F,0x3F,0x3F,0x00,0x00,0x00,0x03,0x00,// eng 'r'
+0xC0,0xF0,0xF0,0xF0,0x30,0x30,0x30,0x00,0x30,0x33,0x33,0x3F,0x3F,0x3F,0x0C,0x00,// eng 's'
+0x30,0xFF,0xFF,0xFF,0x30,0x00,0x00,0x00,0x00,0x0F,0x3F,0x3F,0x30,0x30,0x0F,0x00,// eng 't'
+0xF0,0x00,0x00,0x00,0xF0,0xF0,0xF0,0x00,0x0F,0x30,0x30,0x30,0x3F,0x3F,0x3F,0x00,// eng 'u'
+0xF0,0xF0,0xF0,0x00,0x00,0x00,0xF0,0x00,0x03,0x0F,0x3F,0x3C,0x30,0x0C,0x03,0x00,// eng 'v'
+0xF0,0xF0,0xF0,0x00,0xF0,0x00,0xF0,0x00,0x0F,0x3F,0x3F,0x30,0x0F,0x30,0x0F,0x00,// eng 'w'
+0x30,0xF0,0xF0,0xC0,0xC0,0xC0,0x30,0x00,0x30,0x0C,0x0F,0x0F,0x3F,0x3C,0x30,0x00,// eng 'x'
+0xF0,0x00,0x00,0x00,0xF0,0xF0,0xF0,0x00,0x03,0xCC,0xCC,0xCC,0xFF,0xFF,0x3F,0x00,// eng 'y'
+0x30,0x30,0x30,0xF0,0xF0,0xF0,0x30,0x00,0x30,0x3C,0x3F,0x3F,0x33,0x30,0x30,0x00,// eng 'z'
+0xC0,0xC0,0xFC,0xFF,0x3F,0x03,0x03,0x00,0x00,0x00,0x0F,0x3F,0x3F,0x30,0x30,0x00,// symbol '{'
+0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x3F,0x3F,0x3F,0x00,0x00,0x00,// symbol '|'
+0x03,0x03,0x3F,0xFF,0xFC,0xC0,0xC0,0x00,0x30,0x30,0x3F,0x3F,0x0F,0x00,0x00,0x00,// symbol '}'
+0x3C,0x0F,0x0F,0x3F,0x3C,0x30,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// symbol '~'
@@ -0,0 +1,96 @@
+//0x08,0x08,0x20,0x5F,  // size 8x8, first 32, count 95
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// SPC
+0x00,0x00,0xFF,0x03,0xFF,0xFC,0x00,0x00,0x00,0x00,0x3F,0xF3,0xFF,0xFF,0x00,0x00,// symbol '!'
+0xFF,0xC3,0xFF,0xFC,0xFF,0xC3,0xFF,0xFC,0x00,0x03,0x03,0x03,0x00,0x03,0x03,0x03,// symbol '"'
+0xFC,0xCF,0x03,0xCF,0x03,0xCF,0xFC,0xF0,0x0F,0x3C,0xF0,0xFC,0xF0,0xFC,0x3F,0x0F,// symbol '#'
+0xFC,0xCF,0x33,0x03,0x33,0xF3,0xFF,0xFC,0x3F,0xF3,0xF3,0xF0,0xF3,0xFC,0x3F,0x0F,// symbol '$'
+0x3F,0xF3,0xFF,0x3C,0xCF,0xF3,0xFF,0xFC,0x3F,0xF3,0xFC,0xFF,0x3F,0xF3,0xFF,0xFC,// symbol '%'
+0xFC,0xCF,0x33,0x33,0x0F,0x3C,0xF0,0xC0,0x0F,0x3C,0xF3,0xF3,0xF0,0xF3,0xFF,0xFF,// symbol '&'
+0x00,0x00,0xFF,0xC3,0xFF,0xFC,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x00,0x00,// symbol '''
+0x00,0xFC,0x0F,0xF3,0xFF,0xFC,0x00,0x00,0x00,0x0F,0x3C,0xF3,0xFF,0xFC,0x00,0x00,// symbol '('
+0x00,0x3F,0xF3,0x0F,0xFC,0xF0,0x00,0x00,0x00,0x3F,0xF3,0xFC,0xFF,0x3F,0x00,0x00,// symbol ')'
+0xFC,0xCC,0x3F,0x03,0x3F,0xCC,0xFC,0xF0,0x0F,0x3C,0x3F,0xF0,0xFF,0xFC,0x3F,0x3F,// symbol '*'
+0xF0,0x30,0x3F,0x03,0x3F,0x3C,0xF0,0xC0,0x03,0x0F,0x3F,0xF0,0xFF,0xFF,0x0F,0x0F,// symbol '+'
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xF3,0xF3,0xFF,0xFC,0x00,0x00,// symbol ','
+0xF0,0x30,0x30,0x30,0x30,0x30,0xF0,0xC0,0x03,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,// symbol '-'
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xF3,0xFF,0xFC,0x00,0x00,// symbol '.'
+0x00,0xC0,0xF0,0x3C,0xCF,0xF3,0xFF,0x3C,0x3F,0xF3,0xFC,0x3F,0x0F,0x03,0x00,0x00,// symbol '/'
+0xFC,0x0F,0xF3,0x33,0xC3,0x0F,0xFC,0xF0,0x0F,0x3C,0xF0,0xF3,0xF3,0xFC,0x3F,0x0F,// digit '0'
+0x00,0xFC,0xCF,0x03,0xFF,0xFC,0x00,0x00,0x00,0x3F,0xF3,0xF0,0xF3,0xFF,0xFC,0x00,// digit '1'
+0xFF,0xF3,0x33,0x33,0x33,0xCF,0xFC,0xF0,0x3F,0xF0,0xF3,0xF3,0xF3,0xF3,0xFF,0xFC,// digit '2'
+0x3F,0xF3,0xF3,0x33,0x33,0xCF,0xFC,0xF0,0x3F,0xF3,0xF3,0xF3,0xF3,0xFC,0x3F,0x0F,// digit '3'
+0xF0,0x3C,0xCF,0xF3,0x03,0xFF,0xFC,0x00,0x0F,0x3C,0x3C,0xFC,0xF0,0xFC,0x3F,0x0F,// digit '4'
+0xFF,0x03,0x33,0x33,0x33,0xF3,0xFF,0x3C,0x3F,0xF3,0xF3,0xF3,0xF3,0xFC,0x3F,0x0F,// digit '5'
+0xFC,0x0F,0x33,0x33,0x33,0xFF,0xFC,0x00,0x0F,0x3C,0xF3,0xF3,0xF3,0xFC,0x3F,0x0F,// digit '6'
+0x3F,0xF3,0xF3,0xF3,0x33,0xC3,0xFF,0xFC,0x00,0x00,0x3F,0xF0,0xFF,0xFF,0x03,0x00,// digit '7'
+0xFC,0xCF,0x33,0x33,0x33,0xCF,0xFC,0xF0,0x0F,0x3C,0xF3,0xF3,0xF3,0xFC,0x3F,0x0F,// digit '8'
+0xFC,0xCF,0x33,0x33,0x33,0x0F,0xFC,0xF0,0x00,0x3F,0xF3,0xF3,0xFC,0x3F,0x0F,0x03,// digit '9'
+0x00,0x00,0x3F,0xF3,0xFF,0xFC,0x00,0x00,0x00,0x00,0x3F,0xF3,0xFF,0xFC,0x00,0x00,// symbol ':'
+0x00,0x00,0x3F,0xF3,0xFF,0xFC,0x00,0x00,0x00,0x3F,0xF3,0xF3,0xFF,0xFC,0x00,0x00,// symbol ';'
+0x00,0xF0,0x3C,0xCF,0xF3,0xFF,0xFC,0x00,0x00,0x03,0x0F,0x3C,0xF3,0xFF,0xFC,0x00,// symbol '<'
+0xFC,0xCC,0xCC,0xCC,0xCC,0xFC,0xF0,0x00,0x0F,0x3C,0x3C,0x3C,0x3C,0x3F,0x3F,0x00,// symbol '='
+0x00,0x3F,0xF3,0xCF,0x3C,0xF0,0xC0,0x00,0x00,0x3F,0xF3,0xFC,0x3F,0x0F,0x03,0x00,// symbol '>'
+0x3F,0xF3,0xF3,0x33,0x33,0xCF,0xFC,0xF0,0x00,0x00,0x3F,0xF3,0xFF,0xFF,0x03,0x00,// symbol '?'
+0xFC,0x0F,0xF3,0x03,0x33,0x0F,0xFC,0xF0,0x0F,0x3C,0xF3,0xF3,0xF3,0xF3,0xFF,0xFF,// symbol '@'
+0xFC,0x0F,0x33,0x33,0x33,0x0F,0xFC,0xF0,0x3F,0xF0,0xFF,0xFF,0x3F,0xF0,0xFF,0xFF,// eng 'A'
+0xFF,0x03,0x33,0x33,0x33,0xCF,0xFC,0xF0,0x3F,0xF0,0xF3,0xF3,0xF3,0xFC,0xFF,0x3C,// eng 'B'
+0xFC,0x0F,0xF3,0xF3,0xF3,0xF3,0xFF,0xFC,0x0F,0x3C,0xF3,0xF3,0xF3,0xF3,0xFF,0xFC,// eng 'C'
+0xFF,0x03,0xF3,0xF3,0xF3,0x0F,0xFC,0xF0,0x3F,0xF0,0xF3,0xF3,0xF3,0xFC,0x3F,0x0F,// eng 'D'
+0xFF,0x03,0x33,0x33,0xF3,0xF3,0xFF,0xFC,0x3F,0xF0,0xF3,0xF3,0xF3,0xF3,0xFF,0xFC,// eng 'E'
+0xFF,0x03,0x33,0x33,0xF3,0xF3,0xFF,0xFC,0x3F,0xF0,0xFF,0xFF,0x0F,0x0F,0x00,0x00,// eng 'F'
+0xFC,0x0F,0xF3,0xF3,0xF3,0x33,0xFF,0xFC,0x0F,0x3C,0xF3,0xF3,0xF3,0xF0,0xFF,0xFF,// eng 'G'
+0xFF,0x03,0x3F,0x30,0x3F,0x03,0xFF,0xFC,0x3F,0xF0,0xFF,0xFF,0x3F,0xF0,0xFF,0xFF,// eng 'H'
+0x3F,0xF3,0xF3,0x03,0xF3,0xF3,0xFF,0xFC,0x3F,0xF3,0xF3,0xF0,0xF3,0xF3,0xFF,0xFC,// eng 'I'
+0xC0,0xC0,0xC0,0x00,0xFF,0x03,0xFF,0xFC,0x0F,0x3C,0xF3,0xF3,0xF3,0xFC,0xFF,0x3F,// eng 'J'
+0xFF,0x03,0x3F,0x3C,0xCF,0xF3,0xFF,0xFC,0x3F,0xF0,0xFF,0xFF,0x3C,0xF3,0xFF,0xFC,// eng 'K'
+0xFF,0x03,0xFF,0xFC,0x00,0x00,0x00,0x00,0x3F,0xF0,0xF3,0xF3,0xF3,0xF3,0xFF,0xFC,// eng 'L'
+0xFF,0x03,0xCF,0x3C,0xCF,0x03,0xFF,0xFC,0x3F,0xF0,0xFF,0xFC,0x3F,0xF0,0xFF,0xFF,// eng 'M'
+0xFF,0x03,0xCF,0x3C,0xFF,0x03,0xFF,0xFC,0x3F,0xF0,0xFF,0xFF,0x3C,0xF0,0xFF,0xFF,// eng 'N'
+0xFC,0x0F,0xF3,0xF3,0xF3,0x0F,0xFC,0xF0,0x0F,0x3C,0xF3,0xF3,0xF3,0xFC,0x3F,0x0F,// eng 'O'
+0xFF,0x03,0x33,0x33,0x33,0xCF,0xFC,0xF0,0x3F,0xF0,0xFF,0xFF,0x0F,0x0F,0x03,0x00,// eng 'P'
+0xFC,0x0F,0xF3,0x33,0xF3,0x0F,0xFC,0xF0,0x0F,0x3C,0xF3,0xF3,0xFC,0x33,0xFF,0xF3,// eng 'Q'
+0xFF,0x03,0x33,0x33,0x33,0xCF,0xFC,0xF0,0x3F,0xF0,0xFF,0xFF,0x3C,0xF3,0xFF,0xFF,// eng 'R'
+0xFC,0xCF,0x33,0x33,0x33,0xF3,0xFF,0x3C,0x3F,0xF3,0xF3,0xF3,0xF3,0xFC,0x3F,0x0F,// eng 'S'
+0x3F,0xF3,0xF3,0x03,0xF3,0xF3,0xFF,0xFC,0x00,0x00,0x3F,0xF0,0xFF,0xFF,0x00,0x00,// eng 'T'
+0xFF,0x03,0xFF,0xFC,0xFF,0x03,0xFF,0xFC,0x0F,0x3C,0xF3,0xF3,0xF3,0xFC,0x3F,0x0F,// eng 'U'
+0xFF,0x03,0xFF,0xFC,0xFF,0x03,0xFF,0xFC,0x03,0x0F,0x3C,0xF3,0xFC,0x3F,0x0F,0x03,// eng 'V'
+0xFF,0x03,0xFF,0x3C,0xFF,0x03,0xFF,0xFC,0x0F,0x3C,0xF3,0xFC,0xF3,0xFC,0x3F,0x0F,// eng 'W'
+0x3F,0xF3,0xCF,0x3C,0xCF,0xF3,0xFF,0xFC,0x3F,0xF3,0xFC,0xFF,0x3C,0xF3,0xFF,0xFC,// eng 'X'
+0x3F,0xF3,0xCF,0x3C,0xCF,0xF3,0xFF,0x3C,0x00,0x00,0x3F,0xF0,0xFF,0xFF,0x00,0x00,// eng 'Y'
+0x3F,0xF3,0xF3,0x33,0xC3,0xF3,0xFF,0xFC,0x3F,0xF3,0xF0,0xF3,0xF3,0xF3,0xFF,0xFC,// eng 'Z'
+0x00,0xFF,0x03,0xF3,0xF3,0xFF,0xFC,0x00,0x00,0x3F,0xF0,0xF3,0xF3,0xFF,0xFC,0x00,// symbol '['
+0x3F,0xF3,0xCF,0x3C,0xF0,0xC0,0x00,0x00,0x00,0x00,0x03,0x0F,0x3C,0xF3,0xFF,0xFC,// symbol '\'
+0x00,0x3F,0xF3,0xF3,0x03,0xFF,0xFC,0x00,0x00,0x3F,0xF3,0xF3,0xF0,0xFF,0xFF,0x00,// symbol ']'
+0xF0,0x3C,0xCF,0x03,0xCF,0x3C,0xF0,0xC0,0x03,0x0F,0x3F,0xF0,0xFF,0xFF,0x0F,0x0F,// symbol '^'
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xF3,0xF3,0xF3,0xF3,0xF3,0xFF,0xFC,// symbol '_'
+0xF0,0x3C,0x0F,0x33,0xF3,0xF3,0xFF,0xFC,0x3F,0xF3,0xF0,0xF3,0xF3,0xF3,0xFF,0xFC,// symbol '`'
+0xF0,0x3C,0xCC,0xCC,0xCC,0x0C,0xFC,0xF0,0x0F,0x3C,0xF3,0xF3,0xFC,0xF0,0xFF,0xFF,// eng 'a'
+0xFF,0x03,0xCF,0xCC,0xCC,0x3C,0xF0,0xC0,0x3F,0xF0,0xF3,0xF3,0xF3,0xFC,0x3F,0x0F,// eng 'b'
+0xF0,0x3C,0xCC,0xCC,0xCC,0xCC,0xFC,0xF0,0x0F,0x3C,0xF3,0xF3,0xF3,0xF3,0xFF,0xFC,// eng 'c'
+0xF0,0x3C,0xCC,0xCC,0xCF,0x03,0xFF,0xFC,0x0F,0x3C,0xF3,0xF3,0xF3,0xF0,0xFF,0xFF,// eng 'd'
+0xF0,0x3C,0xCC,0xCC,0x0C,0xFC,0xF0,0x00,0x0F,0x3C,0xF3,0xF0,0xF3,0xF3,0xFF,0xFF,// eng 'e'
+0xF0,0x3C,0x0F,0x33,0xF3,0xFF,0x3C,0x00,0x03,0x3F,0xF0,0xFF,0xFF,0x03,0x00,0x00,// eng 'f'
+0xFC,0xCF,0x33,0x33,0x33,0x03,0xFF,0xFC,0x00,0x3F,0xF3,0xF3,0xF3,0xFC,0x3F,0x0F,// eng 'g'
+0xFF,0x03,0x3F,0x30,0x30,0xF0,0xC0,0x00,0x3F,0xF0,0xFF,0xFF,0x3F,0xF0,0xFF,0xFF,// eng 'h'
+0x00,0x00,0xFF,0x33,0xFF,0x3C,0x00,0x00,0x00,0x00,0x3F,0xF0,0xFF,0xFF,0x00,0x00,// eng 'i'
+0x00,0x00,0x00,0xFF,0x33,0xFF,0x3C,0x00,0x00,0x3F,0xF3,0xF3,0xFC,0x3F,0x0F,0x00,// eng 'j'
+0xFF,0x03,0x3F,0x3C,0xCC,0xFC,0xF0,0x00,0x3F,0xF0,0xFF,0xFF,0x3C,0xF3,0xFF,0xFC,// eng 'k'
+0x00,0x3F,0xF3,0x03,0xFF,0xFC,0x00,0x00,0x00,0x00,0x3F,0xF0,0xFF,0xFF,0x00,0x00,// eng 'l'
+0xFC,0x0C,0xCC,0x3C,0xCC,0x3C,0xF0,0xC0,0x3F,0xF0,0xFF,0xF0,0xFF,0xF0,0xFF,0xFF,// eng 'm'
+0xFC,0x0C,0x3C,0xCC,0xCC,0x3C,0xF0,0xC0,0x3F,0xF0,0xFF,0xFF,0x3F,0xF0,0xFF,0xFF,// eng 'n'
+0xF0,0x3C,0xCC,0xCC,0xCC,0x3C,0xF0,0xC0,0x0F,0x3C,0xF3,0xF3,0xF3,0xFC,0x3F,0x0F,// eng 'o'
+0xFC,0x0C,0xCC,0xCC,0xCC,0x3C,0xF0,0xC0,0x3F,0xF0,0xFC,0xFC,0x3C,0x3F,0x0F,0x03,// eng 'p'
+0xF0,0x3C,0xCC,0xCC,0xCC,0x0C,0xFC,0xF0,0x03,0x0F,0x3C,0x3C,0xFC,0xF0,0xFF,0xFF,// eng 'q'
+0xFC,0x0C,0x3C,0xCC,0xCC,0x3C,0xF0,0xC0,0x3F,0xF0,0xFF,0xFF,0x03,0x0F,0x0F,0x0F,// eng 'r'
+0xF0,0x3C,0x0C,0xCC,0xCC,0xFC,0x30,0x00,0x3F,0xF3,0xF3,0xF0,0xFC,0x3F,0x0F,0x00,// eng 's'
+0xFC,0xCF,0x03,0xCF,0xFC,0xF0,0x00,0x00,0x00,0x0F,0x3C,0xF3,0xF3,0xFF,0xFC,0x00,// eng 't'
+0xFC,0x0C,0xFC,0xC0,0xFC,0x0C,0xFC,0xF0,0x0F,0x3C,0xF3,0xF3,0xFC,0x30,0xFF,0xFF,// eng 'u'
+0xFC,0x0C,0xFC,0xC0,0xFC,0x0C,0xFC,0xF0,0x03,0x0F,0x3C,0xF3,0xFC,0x3F,0x0F,0x03,// eng 'v'
+0xFC,0x0C,0xFC,0x30,0xFC,0x0C,0xFC,0xF0,0x0F,0x3C,0xF3,0xFC,0xF3,0xFC,0x3F,0x0F,// eng 'w'
+0xFC,0xCC,0x3C,0x30,0x3C,0xCC,0xFC,0xF0,0x3F,0xF3,0xFC,0xFF,0x3C,0xF3,0xFF,0xFC,// eng 'x'
+0xFC,0xCC,0x3C,0x30,0x3C,0x0C,0xFC,0xF0,0x00,0x3F,0xF3,0xF3,0xF3,0xFC,0x3F,0x0F,// eng 'y'
+0xFC,0xCC,0xCC,0x0C,0x0C,0xCC,0xFC,0xF0,0x3F,0xF3,0xF0,0xF3,0xF3,0xF3,0xFF,0xFC,// eng 'z'
+0xF0,0x30,0x3F,0xC3,0xF3,0xF3,0xFF,0xFC,0x03,0x03,0x3F,0xF0,0xF3,0xF3,0xFF,0xFC,// symbol '{'
+0x00,0x00,0xFF,0x03,0xFF,0xFC,0x00,0x00,0x00,0x00,0x3F,0xF0,0xFF,0xFF,0x00,0x00,// symbol '|'
+0x3F,0xF3,0xF3,0xC3,0x3F,0x30,0xF0,0xC0,0x3F,0xF3,0xF3,0xF0,0xFF,0xFF,0x0F,0x0F,// symbol '}'
+0xC0,0xF0,0x30,0x30,0xF0,0x30,0xF0,0xC0,0x0F,0x3C,0x3F,0x0C,0x3C,0x3F,0x0F,0x03,// symbol '~'
@@ -0,0 +1,96 @@
+//0x08,0x08,0x20,0x5F,  // size 8x8, first 32, count 95
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// SPC
+0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x33,0x00,0x00,0x00,// symbol '!'
+0x00,0x00,0x3F,0x00,0x3F,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// symbol '"'
+0x00,0x30,0xFC,0x30,0xFC,0xFC,0x30,0x00,0x00,0x03,0x0F,0x03,0x0F,0x0F,0x03,0x00,// symbol '#'
+0x00,0x00,0xFC,0xFC,0xCC,0xCF,0x0C,0x00,0x00,0x0C,0x3C,0x0C,0x0F,0x0F,0x00,0x00,// symbol '$'
+0x3F,0x33,0x3F,0xCF,0x30,0x0C,0x03,0x00,0x30,0x0C,0x03,0x3C,0x33,0x3F,0x3F,0x00,// symbol '%'
+0x3F,0xFF,0xC3,0x3F,0x00,0xC0,0x00,0x00,0x3F,0x3F,0x30,0x33,0x3F,0x33,0x30,0x00,// symbol '&'
+0x00,0x00,0x30,0x3F,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// symbol '''
+0x00,0x00,0xF0,0xFC,0x0F,0x00,0x00,0x00,0x00,0x00,0x03,0x0F,0x3C,0x00,0x00,0x00,// symbol '('
+0x00,0x00,0x0F,0xFC,0xF0,0x00,0x00,0x00,0x00,0x00,0x3C,0x0F,0x03,0x00,0x00,0x00,// symbol ')'
+0x00,0xC0,0xC0,0xFC,0xC0,0xC0,0x00,0x00,0x00,0x00,0x0F,0x03,0x0F,0x00,0x00,0x00,// symbol '*'
+0x00,0xC0,0xC0,0xFC,0xFC,0xC0,0xC0,0x00,0x00,0x00,0x00,0x0F,0x0F,0x00,0x00,0x00,// symbol '+'
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFC,0xFC,0x00,0x00,0x00,// symbol ','
+0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// symbol '-'
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x3C,0x00,0x00,0x00,// symbol '.'
+0x00,0x00,0x00,0xC0,0xF0,0x3C,0x0F,0x00,0x30,0x3C,0x0F,0x03,0x00,0x00,0x00,0x00,// symbol '/'
+0x00,0xFF,0xFF,0x03,0x03,0x03,0xFF,0x00,0x00,0x3F,0x3F,0x30,0x30,0x30,0x3F,0x00,// digit '0'
+0x00,0x00,0x03,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00,// digit '1'
+0x00,0xC0,0xCF,0xC3,0xC3,0xFF,0xFF,0x00,0x00,0x3F,0x30,0x30,0x30,0x30,0x3C,0x00,// digit '2'
+0x00,0x00,0x0F,0xC3,0xC3,0xFF,0x3F,0x00,0x00,0x3C,0x30,0x30,0x30,0x3F,0x3F,0x00,// digit '3'
+0x00,0xF0,0x0C,0x03,0xFF,0xFF,0x00,0x00,0x00,0x03,0x03,0x33,0x3F,0x3F,0x33,0x00,// digit '4'
+0x00,0xFF,0xC3,0xC3,0xC3,0xCF,0xC0,0x00,0x00,0x3C,0x30,0x30,0x30,0x3F,0x0F,0x00,// digit '5'
+0x00,0xFF,0xFF,0xC3,0xC3,0xCF,0xC0,0x00,0x00,0x3F,0x3F,0x30,0x30,0x30,0x3F,0x00,// digit '6'
+0x00,0x0F,0x03,0xC3,0xC3,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3F,0x00,// digit '7'
+0x00,0x3F,0xC3,0xC3,0xC3,0xFF,0x3F,0x00,0x00,0x3F,0x30,0x30,0x30,0x3F,0x3F,0x00,// digit '8'
+0x00,0xFF,0xC3,0xC3,0x33,0xFF,0xFF,0x00,0x00,0x00,0x30,0x30,0x3C,0x0F,0x03,0x00,// digit '9'
+0x00,0x00,0x00,0x3C,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x3C,0x00,0x00,0x00,// symbol ':'
+0x00,0x00,0x00,0x3C,0x3C,0x00,0x00,0x00,0x00,0x00,0xC0,0xFC,0xFC,0x00,0x00,0x00,// symbol ';'
+0x00,0xC0,0xF0,0x3C,0x0F,0x03,0x00,0x00,0x00,0x00,0x03,0x0F,0x3C,0x30,0x00,0x00,// symbol '<'
+0x00,0x30,0x30,0x30,0x30,0x30,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x00,0x00,// symbol '='
+0x00,0x03,0x0F,0x3C,0xF0,0xC0,0x00,0x00,0x00,0x30,0x3C,0x0F,0x03,0x00,0x00,0x00,// symbol '>'
+0x00,0x0F,0x03,0xC3,0xC3,0xFF,0xFF,0x00,0x00,0x00,0x30,0x33,0x00,0x00,0x00,0x00,// symbol '?'
+0x00,0xFF,0x03,0xF3,0x33,0xFF,0xFF,0x00,0x00,0x3F,0x30,0x33,0x33,0x33,0x03,0x00,// symbol '@'
+0x00,0xFF,0xC3,0xC3,0xC3,0xFF,0xFF,0x00,0x30,0x3F,0x30,0x00,0x30,0x3F,0x3F,0x30,// eng 'A'
+0x03,0xFF,0x03,0xC3,0xC3,0xFF,0x3F,0x00,0x30,0x3F,0x30,0x30,0x30,0x3F,0x3F,0x00,// eng 'B'
+0x00,0xFF,0xFF,0x03,0x03,0x0C,0x0F,0x00,0x00,0x3F,0x3F,0x30,0x30,0x30,0x3C,0x00,// eng 'C'
+0x03,0xFF,0x03,0x03,0x03,0xFF,0xFF,0x00,0x30,0x3F,0x30,0x30,0x30,0x3F,0x3F,0x00,// eng 'D'
+0x03,0xFF,0xFF,0xC3,0xC3,0xC3,0x0F,0x00,0x30,0x3F,0x3F,0x30,0x30,0x30,0x3C,0x00,// eng 'E'
+0x03,0xFF,0xFF,0xC3,0xC3,0xC3,0x0F,0x00,0x30,0x3F,0x3F,0x30,0x30,0x00,0x00,0x00,// eng 'F'
+0xFF,0xFF,0x03,0x03,0x0C,0x0F,0x00,0x00,0x3F,0x3F,0x30,0x30,0x33,0x3F,0x03,0x00,// eng 'G'
+0x03,0xFF,0xFF,0xC0,0xC3,0xFF,0x03,0x00,0x30,0x3F,0x3F,0x00,0x30,0x3F,0x30,0x00,// eng 'H'
+0x00,0x03,0x03,0xFF,0xFF,0x03,0x03,0x00,0x00,0x30,0x30,0x3F,0x3F,0x30,0x30,0x00,// eng 'I'
+0x00,0x00,0x03,0xFF,0xFF,0x03,0x00,0x00,0x00,0xC0,0xC0,0xFF,0xFF,0x00,0x00,0x00,// eng 'J'
+0x03,0xFF,0xFF,0xC3,0x30,0x0F,0x03,0x00,0x30,0x3F,0x3F,0x30,0x03,0x3C,0x30,0x00,// eng 'K'
+0x03,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x30,0x3F,0x3F,0x30,0x30,0x3C,0x00,0x00,// eng 'L'
+0x03,0xFF,0x03,0xFF,0x03,0xFF,0xFF,0x03,0x30,0x3F,0x30,0x03,0x30,0x3F,0x3F,0x30,// eng 'M'
+0x03,0xFF,0x03,0x03,0xFF,0xFF,0x00,0x00,0x30,0x3F,0x00,0x30,0x3F,0x3F,0x30,0x00,// eng 'N'
+0x00,0xFF,0x03,0x03,0x03,0xFF,0xFF,0x00,0x00,0x3F,0x30,0x30,0x30,0x3F,0x3F,0x00,// eng 'O'
+0x03,0xFF,0xFF,0x03,0xC3,0xC3,0xFF,0x00,0x30,0x3F,0x3F,0x30,0x00,0x00,0x00,0x00,// eng 'P'
+0xFF,0xFF,0x03,0x03,0x03,0x03,0xFF,0x00,0x3F,0x3F,0x30,0x30,0x3F,0xF0,0x3F,0x00,// eng 'Q'
+0x03,0xFF,0xFF,0xC3,0xC3,0xC3,0xFF,0x00,0x30,0x3F,0x3F,0x00,0x33,0x3C,0x30,0x00,// eng 'R'
+0x00,0xFF,0xC3,0xC3,0xC3,0xCC,0xCF,0x00,0x00,0x3C,0x30,0x30,0x30,0x3F,0x3F,0x00,// eng 'S'
+0x00,0x0F,0x03,0xFF,0xFF,0x03,0x0F,0x00,0x00,0x00,0x30,0x3F,0x3F,0x30,0x00,0x00,// eng 'T'
+0x03,0xFF,0x03,0x00,0xFF,0xFF,0x03,0x00,0x00,0x3F,0x30,0x30,0x3F,0x3F,0x00,0x00,// eng 'U'
+0x03,0x3F,0xC3,0xC0,0xFF,0x3F,0x03,0x00,0x00,0x00,0x03,0x3F,0x03,0x00,0x00,0x00,// eng 'V'
+0x03,0xFF,0x03,0xF0,0xF0,0x03,0xFF,0x03,0x00,0x3F,0x3F,0x0F,0x0F,0x3F,0x3F,0x00,// eng 'W'
+0x03,0x3F,0xFF,0xC0,0xC0,0x3F,0x03,0x00,0x30,0x3F,0x3F,0x00,0x00,0x3F,0x30,0x00,// eng 'X'
+0x03,0xFF,0xC0,0xC0,0xFF,0xFF,0x03,0x00,0x00,0x30,0x30,0x30,0x3F,0x3F,0x00,0x00,// eng 'Y'
+0x00,0x0F,0x03,0xC3,0xF3,0x3F,0x0F,0x00,0x00,0x3C,0x3F,0x3F,0x30,0x30,0x3C,0x00,// eng 'Z'
+0x00,0x00,0xFF,0xFF,0x03,0x03,0x00,0x00,0x00,0x00,0x3F,0x3F,0x30,0x30,0x00,0x00,// symbol '['
+0x0F,0x3C,0xF0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0F,0x3C,0x30,0x00,// symbol '\'
+0x00,0x00,0x03,0x03,0xFF,0xFF,0x00,0x00,0x00,0x00,0x30,0x30,0x3F,0x3F,0x00,0x00,// symbol ']'
+0xC0,0xF0,0x3C,0x0F,0x3C,0xF0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// symbol '^'
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,// symbol '_'
+0xC0,0xFF,0xFF,0xC3,0xC3,0x0F,0x00,0x00,0x30,0x3F,0x3F,0x30,0x30,0x30,0x3C,0x00,// symbol '`'
+0x00,0x00,0x30,0x30,0xF0,0xF0,0x00,0x00,0x00,0x3F,0x33,0x33,0x3F,0x3F,0x30,0x00,// eng 'a'
+0x03,0xFF,0xFF,0xC0,0x30,0x30,0xF0,0x00,0x00,0x3F,0x3F,0x30,0x30,0x30,0x3F,0x00,// eng 'b'
+0x00,0xF0,0xF0,0x30,0x30,0xF0,0x00,0x00,0x00,0x3F,0x3F,0x30,0x30,0x30,0x3C,0x00,// eng 'c'
+0x00,0xF0,0x30,0x30,0x33,0xFF,0xFF,0x00,0x00,0x3F,0x30,0x30,0x0C,0x3F,0x3F,0x30,// eng 'd'
+0x00,0xF0,0xF0,0x30,0x30,0x30,0xF0,0x00,0x00,0x3F,0x3F,0x33,0x33,0x33,0x33,0x00,// eng 'e'
+0x00,0xC0,0xFF,0xFF,0xC3,0xCF,0x00,0x00,0x00,0x30,0x3F,0x3F,0x30,0x00,0x00,0x00,// eng 'f'
+0x00,0xF0,0x30,0x30,0x30,0xC0,0xF0,0x30,0x00,0xCF,0xCC,0xCC,0xC3,0xFF,0xFF,0x00,// eng 'g'
+0x03,0xFF,0xFF,0x30,0x30,0xF0,0x00,0x00,0x30,0x3F,0x3F,0x30,0x00,0x3F,0x30,0x00,// eng 'h'
+0x00,0x00,0x30,0xF3,0xF3,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3F,0x30,0x00,0x00,// eng 'i'
+0x00,0x00,0x30,0xF3,0xF3,0x00,0x00,0x00,0x00,0xC0,0xC0,0xFF,0xFF,0x00,0x00,0x00,// eng 'j'
+0x03,0xFF,0xFF,0x00,0xC0,0x30,0x30,0x00,0x30,0x3F,0x3F,0x03,0x0C,0x30,0x30,0x00,// eng 'k'
+0x00,0x00,0x03,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3F,0x30,0x00,0x00,// eng 'l'
+0x30,0xF0,0x30,0xF0,0x30,0xF0,0xF0,0x00,0x30,0x3F,0x00,0x3F,0x00,0x3F,0x3F,0x30,// eng 'm'
+0x30,0xF0,0xF0,0x30,0x30,0xF0,0x00,0x00,0x30,0x3F,0x3F,0x00,0x30,0x3F,0x30,0x00,// eng 'n'
+0x00,0xF0,0x30,0x30,0x30,0xF0,0xF0,0x00,0x00,0x3F,0x30,0x30,0x30,0x3F,0x3F,0x00,// eng 'o'
+0x30,0xF0,0xF0,0x30,0x30,0x30,0xF0,0x00,0xC0,0xFF,0xFF,0xC3,0x0C,0x0C,0x0F,0x00,// eng 'p'
+0x00,0xF0,0x30,0x30,0x30,0xF0,0xF0,0x30,0x00,0x0F,0x0C,0x0C,0xC3,0xFF,0xFF,0xC0,// eng 'q'
+0x00,0x30,0xF0,0xC0,0x30,0x30,0xF0,0x00,0x00,0x30,0x3F,0x3F,0x30,0x00,0x00,0x00,// eng 'r'
+0x00,0xF0,0x30,0x30,0x30,0x30,0x00,0x00,0x00,0x33,0x33,0x33,0x33,0x3F,0x3F,0x00,// eng 's'
+0x00,0x30,0xFF,0xFF,0x30,0x30,0x00,0x00,0x00,0x00,0x3F,0x3F,0x30,0x30,0x3C,0x00,// eng 't'
+0x30,0xF0,0x00,0x00,0x30,0xF0,0xF0,0x00,0x00,0x3F,0x30,0x30,0x0C,0x3F,0x3F,0x30,// eng 'u'
+0x30,0xF0,0xF0,0x00,0x30,0xF0,0x30,0x00,0x00,0x3F,0x3F,0x0C,0x03,0x00,0x00,0x00,// eng 'v'
+0x30,0xF0,0x30,0x00,0x30,0xF0,0xF0,0x30,0x00,0x3F,0x30,0x3F,0x30,0x3F,0x3F,0x00,// eng 'w'
+0x30,0xF0,0xF0,0x00,0x00,0xF0,0x30,0x00,0x30,0x3C,0x3F,0x03,0x03,0x3C,0x30,0x00,// eng 'x'
+0x30,0xF0,0x30,0x00,0xF0,0xF0,0x30,0x00,0xC0,0xCF,0xCC,0xCC,0xFF,0xFF,0x00,0x00,// eng 'y'
+0x00,0xF0,0x30,0x30,0xF0,0xF0,0x30,0x00,0x00,0x30,0x3C,0x3F,0x33,0x30,0x3C,0x00,// eng 'z'
+0x00,0xC0,0xC0,0xFF,0x3F,0x03,0x03,0x00,0x00,0x00,0x00,0x3F,0x3F,0x30,0x30,0x00,// symbol '{'
+0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00,// symbol '|'
+0x00,0x03,0x03,0x3F,0xFF,0xC0,0xC0,0x00,0x00,0x30,0x30,0x3F,0x3F,0x00,0x00,0x00,// symbol '}'
+0x00,0x0F,0x03,0x0F,0x0C,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// symbol '~'
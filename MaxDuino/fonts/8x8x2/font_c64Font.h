@@ -0,0 +1,100 @@
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,
+0x00,0x00,0x3F,0x3F,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x30,0xFF,0xFF,0x30,0x30,0xFF,0xFF,0x00,0x03,0x3F,0x3F,0x03,0x03,0x3F,0x3F,
+0x00,0x00,0x30,0xFC,0xCF,0xCF,0xCC,0x0C,0x00,0x00,0x0C,0x0C,0x3C,0x3C,0x0F,0x03,
+0x00,0x00,0x0F,0x0F,0xC0,0xF0,0x3C,0x0F,0x00,0x00,0x3C,0x0F,0x03,0x00,0x3C,0x3C,
+0x00,0x00,0x0C,0xFF,0xF3,0xF3,0x3F,0x0C,0x00,0x00,0x0F,0x3F,0x30,0x30,0x3F,0x3F,
+0x00,0x00,0x00,0x00,0x30,0x3C,0x0F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0xF0,0xFC,0x0F,0x03,0x00,0x00,0x00,0x00,0x03,0x0F,0x3C,0x30,0x00,
+0x00,0x00,0x00,0x03,0x0F,0xFC,0xF0,0x00,0x00,0x00,0x00,0x30,0x3C,0x0F,0x03,0x00,
+0x00,0xC0,0xCC,0xFC,0xF0,0xF0,0xFC,0xCC,0x00,0x00,0x0C,0x0F,0x03,0x03,0x0F,0x0C,
+0x00,0x00,0xC0,0xC0,0xFC,0xFC,0xC0,0xC0,0x00,0x00,0x00,0x00,0x0F,0x0F,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFC,0x3C,0x00,0x00,
+0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x3C,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0xC0,0xF0,0x3C,0x00,0x00,0x30,0x3C,0x0F,0x03,0x00,0x00,
+0x00,0x00,0xFC,0xFF,0xC3,0x33,0xFF,0xFC,0x00,0x00,0x0F,0x3F,0x30,0x30,0x3F,0x0F,
+0x00,0x00,0x00,0x30,0xFF,0xFF,0x00,0x00,0x00,0x00,0x30,0x30,0x3F,0x3F,0x30,0x30,
+0x00,0x00,0x0C,0x0F,0x03,0xC3,0xFF,0x3C,0x00,0x00,0x3C,0x3F,0x33,0x30,0x30,0x30,
+0x00,0x00,0x0C,0x0F,0xC3,0xC3,0xFF,0x3C,0x00,0x00,0x0C,0x3C,0x30,0x30,0x3F,0x0F,
+0x00,0x00,0xC0,0xC0,0x30,0x3C,0xFF,0xFF,0x00,0x00,0x03,0x03,0x03,0x03,0x3F,0x3F,
+0x00,0x00,0x3F,0x3F,0x33,0x33,0xF3,0xC3,0x00,0x00,0x0C,0x3C,0x30,0x30,0x3F,0x0F,
+0x00,0x00,0xFC,0xFF,0xC3,0xC3,0xCF,0x0C,0x00,0x00,0x0F,0x3F,0x30,0x30,0x3F,0x0F,
+0x00,0x00,0x0F,0x0F,0xC3,0xF3,0x3F,0x0F,0x00,0x00,0x00,0x00,0x3F,0x3F,0x00,0x00,
+0x00,0x00,0x3C,0xFF,0xC3,0xC3,0xFF,0x3C,0x00,0x00,0x0F,0x3F,0x30,0x30,0x3F,0x0F,
+0x00,0x00,0x3C,0xFF,0xC3,0xC3,0xFF,0xFC,0x00,0x00,0x0C,0x3C,0x30,0x30,0x3F,0x0F,
+0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x0C,0x00,0x00,
+0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0xC0,0xFC,0x3C,0x00,0x00,
+0x00,0x00,0xC0,0xF0,0x3C,0x0F,0x03,0x03,0x00,0x00,0x00,0x03,0x0F,0x3C,0x30,0x30,
+0x00,0x00,0x30,0x30,0x30,0x30,0x30,0x30,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,
+0x00,0x00,0x03,0x03,0x0F,0x3C,0xF0,0xC0,0x00,0x00,0x30,0x30,0x3C,0x0F,0x03,0x00,
+0x00,0x00,0x0C,0x0F,0x03,0xC3,0xFF,0x3C,0x00,0x00,0x00,0x00,0x33,0x33,0x00,0x00,
+0x00,0x00,0xFC,0xFF,0x03,0xF3,0xFF,0xFC,0x00,0x00,0x0F,0x3F,0x30,0x30,0x30,0x0C,
+0x00,0x00,0xF0,0xFC,0xCF,0xCF,0xFC,0xF0,0x00,0x00,0x3F,0x3F,0x00,0x00,0x3F,0x3F,
+0x00,0x00,0xFF,0xFF,0xC3,0xC3,0xFF,0x3C,0x00,0x00,0x3F,0x3F,0x30,0x30,0x3F,0x0F,
+0x00,0x00,0xFC,0xFF,0x03,0x03,0x0F,0x0C,0x00,0x00,0x0F,0x3F,0x30,0x30,0x3C,0x0C,
+0x00,0x00,0xFF,0xFF,0x03,0x0F,0xFC,0xF0,0x00,0x00,0x3F,0x3F,0x30,0x3C,0x0F,0x03,
+0x00,0x00,0xFF,0xFF,0xC3,0xC3,0x03,0x03,0x00,0x00,0x3F,0x3F,0x30,0x30,0x30,0x30,
+0x00,0x00,0xFF,0xFF,0xC3,0xC3,0x03,0x03,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00,0x00,
+0x00,0x00,0xFC,0xFF,0x03,0xC3,0xCF,0xCC,0x00,0x00,0x0F,0x3F,0x30,0x30,0x3F,0x0F,
+0x00,0x00,0xFF,0xFF,0xC0,0xC0,0xFF,0xFF,0x00,0x00,0x3F,0x3F,0x00,0x00,0x3F,0x3F,
+0x00,0x00,0x00,0x03,0xFF,0xFF,0x03,0x00,0x00,0x00,0x00,0x30,0x3F,0x3F,0x30,0x00,
+0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0x03,0x00,0x00,0x0C,0x3C,0x30,0x3F,0x0F,0x00,
+0x00,0x00,0xFF,0xFF,0xF0,0x3C,0x0F,0x03,0x00,0x00,0x3F,0x3F,0x03,0x0F,0x3C,0x30,
+0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3F,0x30,0x30,0x30,0x30,
+0x00,0x00,0xFF,0xFF,0x3C,0xF0,0x3C,0xFF,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00,0x3F,
+0x00,0x00,0xFF,0xFF,0xFC,0xF0,0xFF,0xFF,0x00,0x00,0x3F,0x3F,0x00,0x03,0x3F,0x3F,
+0x00,0x00,0xFC,0xFF,0x03,0x03,0xFF,0xFC,0x00,0x00,0x0F,0x3F,0x30,0x30,0x3F,0x0F,
+0x00,0x00,0xFF,0xFF,0xC3,0xC3,0xFF,0x3C,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00,0x00,
+0x00,0x00,0xFC,0xFF,0x03,0x03,0xFF,0xFC,0x00,0x00,0x03,0x0F,0x0C,0x3C,0x3F,0x33,
+0x00,0x00,0xFF,0xFF,0xC3,0xC3,0xFF,0x3C,0x00,0x00,0x3F,0x3F,0x03,0x0F,0x3C,0x30,
+0x00,0x00,0x3C,0xFF,0xC3,0xC3,0xCF,0x0C,0x00,0x00,0x0C,0x3C,0x30,0x30,0x3F,0x0F,
+0x00,0x00,0x03,0x03,0xFF,0xFF,0x03,0x03,0x00,0x00,0x00,0x00,0x3F,0x3F,0x00,0x00,
+0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x0F,0x3F,0x30,0x30,0x3F,0x0F,
+0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x03,0x0F,0x3C,0x3C,0x0F,0x03,
+0x00,0x00,0xFF,0xFF,0x00,0xC0,0x00,0xFF,0x00,0x00,0x3F,0x3F,0x0F,0x03,0x0F,0x3F,
+0x00,0x00,0x0F,0x3F,0xF0,0xF0,0x3F,0x0F,0x00,0x00,0x3C,0x3F,0x03,0x03,0x3F,0x3C,
+0x00,0x00,0x3F,0xFF,0xC0,0xC0,0xFF,0x3F,0x00,0x00,0x00,0x00,0x3F,0x3F,0x00,0x00,
+0x00,0x00,0x03,0x03,0xC3,0xF3,0x3F,0x0F,0x00,0x00,0x3C,0x3F,0x33,0x30,0x30,0x30,
+0x00,0x00,0x03,0x03,0xFF,0xFF,0x00,0x00,0x00,0x00,0x30,0x30,0x3F,0x3F,0x00,0x00,
+0x3C,0xF0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0F,0x3C,0x30,0x00,0x00,// 0x00,0x00,0x40,0x60,0x30,0x18,0x0c,0x06, */
+0x00,0x0C,0xC3,0xC3,0xFC,0xF0,0xC0,0x00,0x00,0x0C,0x30,0x30,0x33,0x3F,0x3C,0x30,
+0x00,0x00,0xFF,0xFF,0x03,0x03,0x00,0x00,0x00,0x00,0x3F,0x3F,0x30,0x30,0x00,0x00,
+0x00,0x00,0xFC,0x0C,0x0C,0x00,0x00,0x00,0x00,0x00,0x3F,0x30,0x30,0x00,0x00,0x00,// [
+0x00,0x30,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0C,0x30,0x00,0x00,// <backslash>
+0x00,0x00,0x0C,0x0C,0xFC,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x3F,0x00,0x00,0x00,// ] */
+0x00,0xC0,0x30,0xFC,0x30,0xC0,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,
+0x00,0x03,0x0F,0x3C,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x30,0x30,0x30,0xF0,0xC0,0x00,0x00,0x0C,0x3F,0x33,0x33,0x3F,0x3F,
+0x00,0x00,0xFC,0xFC,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x3F,0x3F,0x30,0x30,0x3F,0x0F,
+0x00,0x00,0xC0,0xF0,0x30,0x30,0x30,0x00,0x00,0x00,0x0F,0x3F,0x30,0x30,0x30,0x00,
+0x00,0x00,0x00,0xC0,0xC0,0xC0,0xFC,0xFC,0x00,0x00,0x0F,0x3F,0x30,0x30,0x3F,0x3F,
+0x00,0x00,0xC0,0xF0,0x30,0x30,0xF0,0xC0,0x00,0x00,0x0F,0x3F,0x33,0x33,0x33,0x03,
+0x00,0x00,0x00,0xC0,0xF0,0xFC,0xCC,0xCC,0x00,0x00,0x00,0x00,0x3F,0x3F,0x00,0x00,
+0x00,0x00,0xC0,0xF0,0x30,0x30,0xF0,0xF0,0x00,0x00,0xC3,0xCF,0xCC,0xCC,0xFF,0x3F,
+0x00,0x00,0xFC,0xFC,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x3F,0x3F,0x00,0x00,0x3F,0x3F,
+0x00,0x00,0x00,0xC0,0xCC,0xCC,0x00,0x00,0x00,0x00,0x00,0x30,0x3F,0x3F,0x30,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0xCC,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xFF,0x3F,
+0x00,0x00,0xFC,0xFC,0x00,0xC0,0xC0,0x00,0x00,0x00,0x3F,0x3F,0x03,0x0F,0x3C,0x30,
+0x00,0x00,0x00,0x0C,0xFC,0xFC,0x00,0x00,0x00,0x00,0x00,0x30,0x3F,0x3F,0x30,0x00,
+0x00,0x00,0xF0,0xF0,0xC0,0xC0,0xF0,0xF0,0x00,0x00,0x3F,0x3F,0x03,0x0F,0x03,0x3F,
+0x00,0x00,0xF0,0xF0,0x30,0x30,0xF0,0xC0,0x00,0x00,0x3F,0x3F,0x00,0x00,0x3F,0x3F,
+0x00,0x00,0xC0,0xF0,0x30,0x30,0xF0,0xC0,0x00,0x00,0x0F,0x3F,0x30,0x30,0x3F,0x0F,
+0x00,0x00,0xF0,0xF0,0x30,0x30,0xF0,0xC0,0x00,0x00,0xFF,0xFF,0x0C,0x0C,0x0F,0x03,
+0x00,0x00,0xC0,0xF0,0x30,0x30,0xF0,0xF0,0x00,0x00,0x03,0x0F,0x0C,0x0C,0xFF,0xFF,
+0x00,0x00,0xF0,0xF0,0x30,0x30,0xF0,0xC0,0x00,0x00,0x3F,0x3F,0x00,0x00,0x00,0x00,
+0x00,0x00,0xC0,0xF0,0x30,0x30,0x30,0x30,0x00,0x00,0x30,0x33,0x33,0x33,0x3F,0x0C,
+0x00,0x00,0x30,0x30,0xFC,0xFC,0x30,0x30,0x00,0x00,0x00,0x00,0x0F,0x3F,0x30,0x30,
+0x00,0x00,0xF0,0xF0,0x00,0x00,0xF0,0xF0,0x00,0x00,0x0F,0x3F,0x30,0x30,0x3F,0x3F,
+0x00,0x00,0xF0,0xF0,0x00,0x00,0xF0,0xF0,0x00,0x00,0x03,0x0F,0x3C,0x3C,0x0F,0x03,
+0x00,0x00,0xF0,0xF0,0x00,0xC0,0x00,0xF0,0x00,0x00,0x03,0x3F,0x3F,0x0F,0x3F,0x3F,
+0x00,0x00,0x30,0xF0,0xC0,0xC0,0xF0,0x30,0x00,0x00,0x30,0x3C,0x0F,0x0F,0x3C,0x30,
+0x00,0x00,0xF0,0xF0,0x00,0x00,0xF0,0xF0,0x00,0x00,0xC3,0xCF,0xCC,0xFC,0x3F,0x0F,
+0x00,0x00,0x30,0x30,0x30,0xF0,0xF0,0x30,0x00,0x00,0x30,0x3C,0x3F,0x33,0x30,0x30,
+0x00,0xC0,0xC0,0x3C,0x0C,0x0C,0x00,0x00,0x00,0x00,0x00,0x3F,0x30,0x30,0x00,0x00,
+0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,
+0x00,0x0C,0x0C,0x3C,0xC0,0xC0,0x00,0x00,0x00,0x30,0x30,0x3F,0x00,0x00,0x00,0x00,
+0x00,0x00,0x30,0x0C,0x30,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
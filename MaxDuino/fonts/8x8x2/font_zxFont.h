@@ -0,0 +1,95 @@
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// SPC
+0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x00,// symbol '!'
+0x00,0x00,0x00,0x0F,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// symbol '"'
+0x00,0x30,0xFC,0x30,0x30,0xFC,0x30,0x00,0x00,0x0C,0x3F,0x0C,0x0C,0x3F,0x0C,0x00,// symbol '#'
+0x00,0xFC,0xCC,0xFF,0xCC,0xCC,0x00,0x00,0x00,0x0C,0x0C,0x3F,0x0C,0x0F,0x00,0x00,// symbol '$'
+0x00,0x3C,0x3C,0x00,0xC0,0x30,0x0C,0x00,0x00,0x30,0x0C,0x03,0x00,0x3C,0x3C,0x00,// symbol '%'
+0x00,0x00,0x30,0xCC,0x30,0x00,0x00,0x00,0x00,0x0C,0x33,0x30,0x33,0x0C,0x33,0x00,// symbol '&'
+0x00,0x00,0x00,0x30,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// symbol '''
+0x00,0x00,0x00,0xF0,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x30,0x00,0x00,0x00,// symbol '('
+0x00,0x00,0x00,0x0C,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x0F,0x00,0x00,0x00,// symbol ')'
+0x00,0x00,0x30,0xC0,0x30,0x00,0x00,0x00,0x00,0x03,0x33,0x0F,0x33,0x03,0x00,0x00,// symbol '*'
+0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x3F,0x03,0x03,0x00,0x00,// symbol '+'
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x3C,0x00,0x00,0x00,// symbol ','
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x00,0x00,// symbol '-'
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x3C,0x00,0x00,0x00,// symbol '.'
+0x00,0x00,0x00,0x00,0xC0,0x30,0x00,0x00,0x00,0x30,0x0C,0x03,0x00,0x00,0x00,0x00,// symbol '/'
+0xF0,0x0C,0x0C,0xCC,0x3C,0xF0,0x00,0x00,0x0F,0x3C,0x33,0x30,0x30,0x0F,0x00,0x00,// digit '0'
+0x30,0x0C,0xFC,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x3F,0x30,0x30,0x00,0x00,0x00,// digit '1'
+0x30,0x0C,0x0C,0x0C,0x0C,0xF0,0x00,0x00,0x3C,0x33,0x33,0x33,0x33,0x30,0x00,0x00,// digit '2'
+0x30,0x0C,0x0C,0xCC,0xCC,0x30,0x00,0x00,0x0C,0x30,0x30,0x30,0x30,0x0F,0x00,0x00,// digit '3'
+0x00,0xC0,0x30,0xFC,0x00,0x00,0x00,0x00,0x0F,0x0C,0x0C,0x3F,0x0C,0x0C,0x00,0x00,// digit '4'
+0xFC,0xCC,0xCC,0xCC,0xCC,0x0C,0x00,0x00,0x0C,0x30,0x30,0x30,0x30,0x0F,0x00,0x00,// digit '5'
+0xF0,0xCC,0xCC,0xCC,0xCC,0x00,0x00,0x00,0x0F,0x30,0x30,0x30,0x30,0x0F,0x00,0x00,// digit '6'
+0x0C,0x0C,0x0C,0x0C,0xCC,0x3C,0x00,0x00,0x00,0x00,0x3C,0x03,0x00,0x00,0x00,0x00,// digit '7'
+0x30,0xCC,0xCC,0xCC,0xCC,0x30,0x00,0x00,0x0F,0x30,0x30,0x30,0x30,0x0F,0x00,0x00,// digit '8'
+0xF0,0x0C,0x0C,0x0C,0x0C,0xF0,0x00,0x00,0x00,0x33,0x33,0x33,0x33,0x0F,0x00,0x00,// digit '9'
+0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,// symbol ':'
+0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x3C,0x00,0x00,0x00,0x00,// symbol ';'
+0x00,0x00,0x00,0xC0,0x30,0x00,0x00,0x00,0x00,0x00,0x03,0x0C,0x30,0x00,0x00,0x00,// symbol '<'
+0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x0C,0x0C,0x0C,0x0C,0x0C,0x00,0x00,// symbol '='
+0x00,0x00,0x30,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x0C,0x03,0x00,0x00,0x00,// symbol '>'
+0x00,0x30,0x0C,0x0C,0x0C,0xCC,0x30,0x00,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x00,// symbol '?'
+0x00,0xF0,0x0C,0xCC,0x3C,0xCC,0xF0,0x00,0x00,0x0F,0x30,0x33,0x33,0x33,0x03,0x00,// symbol '@'
+0xF0,0x0C,0x0C,0x0C,0x0C,0xF0,0x00,0x00,0x3F,0x03,0x03,0x03,0x03,0x3F,0x00,0x00,// eng 'A'
+0xFC,0xCC,0xCC,0xCC,0xCC,0x30,0x00,0x00,0x3F,0x30,0x30,0x30,0x30,0x0F,0x00,0x00,// eng 'B'
+0xF0,0x0C,0x0C,0x0C,0x0C,0x30,0x00,0x00,0x0F,0x30,0x30,0x30,0x30,0x0C,0x00,0x00,// eng 'C'
+0xFC,0x0C,0x0C,0x0C,0x30,0xC0,0x00,0x00,0x3F,0x30,0x30,0x30,0x0C,0x03,0x00,0x00,// eng 'D'
+0xFC,0xCC,0xCC,0xCC,0xCC,0x0C,0x00,0x00,0x3F,0x30,0x30,0x30,0x30,0x30,0x00,0x00,// eng 'E'
+0xFC,0xCC,0xCC,0xCC,0xCC,0x0C,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// eng 'F'
+0xF0,0x0C,0x0C,0x0C,0x0C,0x30,0x00,0x00,0x0F,0x30,0x30,0x33,0x33,0x0F,0x00,0x00,// eng 'G'
+0xFC,0xC0,0xC0,0xC0,0xC0,0xFC,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,// eng 'H'
+0x00,0x0C,0x0C,0xFC,0x0C,0x0C,0x00,0x00,0x00,0x30,0x30,0x3F,0x30,0x30,0x00,0x00,// eng 'I'
+0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x0F,0x30,0x30,0x30,0x30,0x0F,0x00,0x00,// eng 'J'
+0xFC,0xC0,0xC0,0x30,0x0C,0x00,0x00,0x00,0x3F,0x00,0x00,0x03,0x0C,0x30,0x00,0x00,// eng 'K'
+0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x30,0x30,0x30,0x30,0x30,0x00,0x00,// eng 'L'
+0xFC,0x30,0xC0,0xC0,0x30,0xFC,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,// eng 'M'
+0xFC,0x30,0xC0,0x00,0x00,0xFC,0x00,0x00,0x3F,0x00,0x00,0x03,0x0C,0x3F,0x00,0x00,// eng 'N'
+0xF0,0x0C,0x0C,0x0C,0x0C,0xF0,0x00,0x00,0x0F,0x30,0x30,0x30,0x30,0x0F,0x00,0x00,// eng 'O'
+0xFC,0x0C,0x0C,0x0C,0x0C,0xF0,0x00,0x00,0x3F,0x03,0x03,0x03,0x03,0x00,0x00,0x00,// eng 'P'
+0xF0,0x0C,0x0C,0x0C,0x0C,0xF0,0x00,0x00,0x0F,0x30,0x33,0x3C,0x30,0x0F,0x00,0x00,// eng 'Q'
+0xFC,0x0C,0x0C,0x0C,0x0C,0xF0,0x00,0x00,0x3F,0x03,0x03,0x03,0x0F,0x30,0x00,0x00,// eng 'R'
+0x30,0xCC,0xCC,0xCC,0xCC,0x00,0x00,0x00,0x0C,0x30,0x30,0x30,0x30,0x0F,0x00,0x00,// eng 'S'
+0x0C,0x0C,0x0C,0xFC,0x0C,0x0C,0x0C,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,// eng 'T'
+0xFC,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x0F,0x30,0x30,0x30,0x30,0x0F,0x00,0x00,// eng 'U'
+0xFC,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x03,0x0C,0x30,0x30,0x0C,0x03,0x00,0x00,// eng 'V'
+0xFC,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x0F,0x30,0x0C,0x0C,0x30,0x0F,0x00,0x00,// eng 'W'
+0x0C,0x30,0xC0,0xC0,0x30,0x0C,0x00,0x00,0x30,0x0C,0x03,0x03,0x0C,0x30,0x00,0x00,// eng 'X'
+0x0C,0x30,0xC0,0x00,0xC0,0x30,0x0C,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,// eng 'Y'
+0x0C,0x0C,0x0C,0xCC,0x3C,0x0C,0x00,0x00,0x30,0x3C,0x33,0x30,0x30,0x30,0x00,0x00,// eng 'Z'
+0x00,0x00,0xFC,0x0C,0x0C,0x00,0x00,0x00,0x00,0x00,0x3F,0x30,0x30,0x00,0x00,0x00,// symbol '['
+0x00,0x30,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0C,0x30,0x00,0x00,// symbol '\'
+0x00,0x00,0x0C,0x0C,0xFC,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x3F,0x00,0x00,0x00,// symbol ']'
+0x00,0xC0,0x30,0xFC,0x30,0xC0,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,// symbol '^'
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,// symbol '_'
+0xF0,0x0C,0xC3,0x33,0x33,0x03,0x0C,0xF0,0x0F,0x30,0xC3,0xCC,0xCC,0xC0,0x30,0x0F,// symbol '`'
+0x00,0x00,0x30,0x30,0x30,0xC0,0x00,0x00,0x00,0x0C,0x33,0x33,0x33,0x3F,0x00,0x00,// eng 'a'
+0x00,0xFC,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x3F,0x30,0x30,0x30,0x0F,0x00,0x00,// eng 'b'
+0x00,0x00,0xC0,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x0F,0x30,0x30,0x30,0x00,0x00,// eng 'c'
+0x00,0x00,0xC0,0xC0,0xC0,0xFC,0x00,0x00,0x00,0x0F,0x30,0x30,0x30,0x3F,0x00,0x00,// eng 'd'
+0x00,0xC0,0x30,0x30,0x30,0xC0,0x00,0x00,0x00,0x0F,0x33,0x33,0x33,0x30,0x00,0x00,// eng 'e'
+0x00,0x00,0x00,0xF0,0xCC,0x0C,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,// eng 'f'
+0x00,0xC0,0x30,0x30,0x30,0x30,0xF0,0x00,0x00,0x03,0xCC,0xCC,0xCC,0xCC,0x3F,0x00,// eng 'g'
+0x00,0xFC,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,// eng 'h'
+0x00,0x00,0x00,0xC0,0xCC,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x3F,0x30,0x00,0x00,// eng 'i'
+0x00,0x00,0x00,0x00,0x00,0xCC,0x00,0x00,0x00,0x00,0x30,0xC0,0xC0,0x3F,0x00,0x00,// eng 'j'
+0x00,0xFC,0xC0,0x30,0x00,0x00,0x00,0x00,0x00,0x3F,0x03,0x0C,0x30,0x00,0x00,0x00,// eng 'k'
+0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x30,0x30,0x00,0x00,// eng 'l'
+0x00,0xF0,0x30,0xC0,0x30,0xC0,0x00,0x00,0x00,0x3F,0x00,0x3F,0x00,0x3F,0x00,0x00,// eng 'm'
+0x00,0xF0,0x30,0x30,0x30,0xC0,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,// eng 'n'
+0x00,0xC0,0x30,0x30,0x30,0xC0,0x00,0x00,0x00,0x0F,0x30,0x30,0x30,0x0F,0x00,0x00,// eng 'o'
+0x00,0xF0,0x30,0x30,0x30,0xC0,0x00,0x00,0x00,0xFF,0x0C,0x0C,0x0C,0x03,0x00,0x00,// eng 'p'
+0x00,0xC0,0x30,0x30,0x30,0xF0,0x00,0x00,0x00,0x03,0x0C,0x0C,0x0C,0xFF,0xC0,0x00,// eng 'q'
+0x00,0x00,0xC0,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,// eng 'r'
+0x00,0xC0,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x30,0x33,0x33,0x33,0x0C,0x00,0x00,// eng 's'
+0x00,0x00,0x30,0xFC,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x30,0x30,0x00,0x00,// eng 't'
+0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x0F,0x30,0x30,0x30,0x0F,0x00,0x00,// eng 'u'
+0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x0F,0x30,0x0F,0x00,0x00,0x00,// eng 'v'
+0x00,0xF0,0x00,0xC0,0x00,0xF0,0x00,0x00,0x00,0x0F,0x30,0x0F,0x30,0x0F,0x00,0x00,// eng 'w'
+0x00,0x30,0xC0,0x00,0xC0,0x30,0x00,0x00,0x00,0x30,0x0C,0x03,0x0C,0x30,0x00,0x00,// eng 'x'
+0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x03,0xCC,0xCC,0xCC,0x3F,0x00,0x00,// eng 'y'
+0x00,0x30,0x30,0x30,0xF0,0x30,0x00,0x00,0x00,0x30,0x3C,0x33,0x30,0x30,0x00,0x00,// eng 'z'
+0x00,0xC0,0xC0,0x3C,0x0C,0x0C,0x00,0x00,0x00,0x00,0x00,0x3F,0x30,0x30,0x00,0x00,// symbol '{'
+0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,// symbol '|'
+0x00,0x0C,0x0C,0x3C,0xC0,0xC0,0x00,0x00,0x00,0x30,0x30,0x3F,0x00,0x00,0x00,0x00,// symbol '}'
+0x00,0x00,0x30,0x0C,0x30,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,// symbol '~'  
@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+"""Pre-scale the 8x8 fonts to double height, for XY2_PRESCALED.
+
+Reads each fonts/8x8 file and writes the same name to fonts/8x8x2, 16 bytes
+a character: the 8 columns of the top page, then the 8 of the bottom, each
+bit of the glyph doubled (the same as the DFONT table does at run time).
+
+    python3 scale_fonts.py            (all of them)
+    python3 scale_fonts.py font_MyFont.h
+"""
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SRC = os.path.join(HERE, '8x8')
+DST = os.path.join(HERE, '8x8x2')
+
+
+def double(nibble):
+    out = 0
+    for b in range(4):
+        if nibble & (1 << b):
+            out |= 3 << (b * 2)
+    return out
+
+
+def convert(name):
+    with open(os.path.join(SRC, name), newline='') as f:
+        text = f.read()
+    eol = '\r\n' if '\r\n' in text else '\n'
+    lines = []
+    for line in text.splitlines():
+        code, sep, comment = line.partition('//')
+        data = [int(x, 16) for x in re.findall(r'0x[0-9a-fA-F]{2}', code)]
+        if not data:
+            if line.strip():
+                lines.append(line)
+            continue
+        # one character a line
+        scaled = [double(b & 0x0F) for b in data] + [double(b >> 4) for b in data]
+        lines.append(','.join('0x%02X' % b for b in scaled) + ',' + (sep + comment if sep else ''))
+    with open(os.path.join(DST, name), 'w', newline='') as f:
+        f.write(eol.join(lines) + eol)
+
+
+if __name__ == '__main__':
+    names = sys.argv[1:] or sorted(n for n in os.listdir(SRC) if n.endswith('.h'))
+    for n in names:
+        convert(os.path.basename(n))
@@ -0,0 +1,292 @@
+#include "gdb.h"
+
+#ifdef Use_GDB
+
+#include "file_utils.h"
+#include "processing_state.h"
+#include "buffer.h"
+#include "MaxDuino.h"
+#include "MaxProcessing.h"
+
+namespace {
+
+constexpr word GDB_MAX_US = 0x3FFF;   // longest plain pulse word in the buffer
+
+// symbol table, pilot symbols first then data symbols
+byte symFlags[GDB_MAX_SYMBOLS];       // bits 0-1: 0 edge, 1 no edge, 2 force low, 3 force high
+word symFirst[GDB_MAX_SYMBOLS];       // index into pulses[]
+byte symCount[GDB_MAX_SYMBOLS];       // number of pulses (up to the first 0)
+word pulses[GDB_MAX_PULSES];          // pulse lengths in us
+word nSymbols;
+word nPulses;
+
+bool zx81Layout = false;
+unsigned long blockEnd;
+unsigned long dataSymbols;            // TOTD
+unsigned long dataStart;              // file position of the data stream
+unsigned long symbolsLeft;            // pilot: PRLE entries left, data: symbols left
+word dataBase;                        // index of data symbol 0 in the symbol table
+byte dataBits;                        // bits per data symbol
+byte dataByte;                        // data stream byte being unpacked
+byte bitsLeft;                        // bits left in dataByte
+
+word sym;                             // symbol being played
+byte symPulse;                        // next pulse in it
+word symRepeats;                      // pilot: repeats left of sym (including this one)
+bool symPlaying = false;
+byte level;                           // 0 = low, tracks our own edges
+word pending;                         // length of the pulse in progress (not yet written)
+
+bool read_symdefs(const byte alphabet, const byte maxPulses) {
+  // alphabet symbols of maxPulses pulses each; 0 means 256
+  const word n = alphabet ? alphabet : 256;
+  for (word s = 0; s < n; s++) {
+    if (nSymbols == GDB_MAX_SYMBOLS) return false;
+    if (!ReadByte()) return false;
+    symFlags[nSymbols] = outByte & 0x03;
+    symFirst[nSymbols] = nPulses;
+    byte c = 0;
+    bool ended = false;
+    for (byte p = 0; p < maxPulses; p++) {
+      if (!ReadWord()) return false;
+      if (outWord == 0) ended = true;
+      if (ended) continue;
+      if (nPulses == GDB_MAX_PULSES) return false;
+      word us = TickToUs(outWord);
+      if (us > GDB_MAX_US) us = GDB_MAX_US;
+      if (us == 0) us = 1;
+      pulses[nPulses++] = us;
+      c++;
+    }
+    symCount[nSymbols++] = c;
+  }
+  return true;
+}
+
+void start_data() {
+  bytesRead = dataStart;
+  symbolsLeft = dataSymbols;
+  bitsLeft = 0;
+  currentBlockTask = BLOCKTASK::TDATA;
+}
+
+bool is_zx81_layout() {
+  // peek at the header: no pilot/sync stream and 2 data symbols of 18 pulses
+  // is how ZX81 .P files are converted
+  if (readfile(18, bytesRead) != 18) return false;
+  const bool noPilot = !filebuffer[6] && !filebuffer[7] && !filebuffer[8] && !filebuffer[9];
+  return noPilot && filebuffer[16] == 18 && filebuffer[17] == 2;
+}
+
+bool read_header() {
+  // bytesRead is just after the ID byte
+  const unsigned long start = bytesRead;
+  unsigned long totp = 0;
+  blockEnd = start;
+  byte npp = 0, asp = 0, npd = 0, asd = 0;
+  if (ReadDword()) blockEnd = start + 4 + outLong;
+  if (ReadWord()) pauseLength = outWord;
+  if (ReadDword()) totp = outLong;
+  if (ReadByte()) npp = outByte;
+  if (ReadByte()) asp = outByte;
+  dataSymbols = 0;
+  if (ReadDword()) dataSymbols = outLong;
+  if (ReadByte()) npd = outByte;
+  if (ReadByte()) asd = outByte;
+
+  nSymbols = 0;
+  nPulses = 0;
+  bool ok = true;
+  unsigned long pilotStart = 0;
+  if (totp > 0) {
+    ok = read_symdefs(asp, npp);
+    pilotStart = bytesRead;
+    bytesRead += totp * 3;    // PRLE: symbol byte + repeat word
+  }
+  dataBase = nSymbols;
+  dataBits = 0;
+  if (ok && dataSymbols > 0) {
+    ok = read_symdefs(asd, npd);
+    // bits per symbol = ceil(log2(ASD)), ASD 0 means 256
+    const word n = asd ? asd : 256;
+    while ((word(1) << dataBits) < n) dataBits++;
+  }
+  dataStart = bytesRead;
+  if (!ok) return false;
+
+  symPlaying = false;
+  pending = 0;
+  level = 0;    // a block normally starts after a pause, with the signal low
+  if (totp > 0) {
+    symbolsLeft = totp;
+    bytesRead = pilotStart;
+    currentBlockTask = BLOCKTASK::PILOT;
+  } else {
+    start_data();
+  }
+  return true;
+}
+
+bool next_symbol() {
+  // Move to the next symbol of the current stream; false at the end of it
+  if (currentBlockTask == BLOCKTASK::PILOT) {
+    if (symPlaying && --symRepeats > 0) {
+      symPulse = 0;
+      return true;
+    }
+    while (symbolsLeft > 0) {
+      symbolsLeft--;
+      byte s = 0;
+      if (ReadByte()) s = outByte;
+      if (ReadWord()) symRepeats = outWord;
+      if (symRepeats == 0 || s >= dataBase) continue;
+      sym = s;
+      symPulse = 0;
+      symPlaying = true;
+      return true;
+    }
+    return false;
+  }
+
+  if (symbolsLeft == 0) return false;
+  symbolsLeft--;
+  word s = 0;
+  for (byte b = dataBits; b > 0; b--) {
+    if (bitsLeft == 0) {
+      if (!ReadByte()) return false;
+      dataByte = outByte;
+      bitsLeft = 8;
+    }
+    s = (s << 1) | ((dataByte & 0x80) ? 1 : 0);
+    dataByte <<= 1;
+    bitsLeft--;
+  }
+  if (dataBase + s >= nSymbols) s = 0;
+  sym = dataBase + s;
+  symPulse = 0;
+  symPlaying = true;
+  return true;
+}
+
+bool next_pulse(word &us, bool &edge) {
+  // Next pulse of the current stream, and whether it starts with an edge
+  while (!symPlaying || symPulse >= symCount[sym]) {
+    if (!next_symbol()) {
+      symPlaying = false;
+      return false;
+    }
+  }
+  us = pulses[symFirst[sym] + symPulse];
+  if (symPulse == 0) {
+    switch (symFlags[sym]) {
+      case 1: edge = false; break;
+      case 2: edge = (level == 1); break;
+      case 3: edge = (level == 0); break;
+      default: edge = true; break;
+    }
+  } else {
+    edge = true;
+  }
+  symPulse++;
+  return true;
+}
+
+bool pilot_run(word &us, word &reps) {
+  // At the start of a PRLE run of a plain single pulse symbol?
+  if (currentBlockTask != BLOCKTASK::PILOT || !symPlaying || symPulse != 0) return false;
+  if (symCount[sym] != 1 || symFlags[sym] != 0 || symRepeats < 3) return false;
+  us = pulses[symFirst[sym]];
+  reps = symRepeats;
+  return true;
+}
+
+void end_block() {
+  if (pending) {
+    currentPeriod = pending;
+    pending = 0;
+    return;
+  }
+  bytesRead = blockEnd;
+  temppause = trim_gap(pauseLength, true);
+  currentID = BLOCKID::IDPAUSE;
+}
+
+void play() {
+  // One buffer word per call: the pulse in progress is written once the
+  // next pulse is known to start with an edge (a pulse without one just
+  // makes it longer)
+  word us;
+  bool edge;
+  word reps;
+  for (;;) {
+    if (pending && pilot_run(us, reps)) {
+      // flush first, the run starts with an edge
+      currentPeriod = pending;
+      pending = 0;
+      return;
+    }
+    if (!pending && pilot_run(us, reps)) {
+      // all but the last pulse of the run as one repeat word, the last one
+      // stays pending in case the next symbol continues it
+      const word n = (reps-1 > PULSE_TONE_MAX) ? PULSE_TONE_MAX : reps-1;
+      symRepeats -= n;
+      level ^= (n & 1);
+      currentPeriod = PULSE_REPEAT_FLAG | n;
+      pendingWord = us;
+      return;
+    }
+    if (!next_pulse(us, edge)) {
+      if (currentBlockTask == BLOCKTASK::PILOT && dataSymbols > 0) {
+        // pilot done, on to the data stream
+        start_data();
+        continue;
+      }
+      end_block();
+      return;
+    }
+    if (!edge && pending) {
+      pending = (pending + us > GDB_MAX_US) ? GDB_MAX_US : pending + us;
+      continue;
+    }
+    // an edge (or the first pulse of the block, which can't stretch a
+    // pulse already in the buffer)
+    level ^= 1;
+    const word prev = pending;
+    pending = us;
+    if (prev) {
+      currentPeriod = prev;
+      return;
+    }
+  }
+}
+
+} // anonymous namespace
+
+bool gdb_process() {
+  switch (currentBlockTask) {
+    case BLOCKTASK::READPARAM:
+      zx81Layout = is_zx81_layout();
+      if (zx81Layout) return false;
+      #ifdef BLOCKID19_IN
+        block_mem_oled();
+      #endif
+      if (!read_header()) {
+        // symbol tables don't fit in RAM: skip the block
+        bytesRead = blockEnd;
+        temppause = pauseLength;
+        currentID = BLOCKID::IDPAUSE;
+      }
+      return true;
+
+    case BLOCKTASK::PILOT:
+    case BLOCKTASK::TDATA:
+      if (zx81Layout) return false;
+      play();
+      return true;
+
+    default:
+      return !zx81Layout;
+  }
+}
+
+#endif // Use_GDB
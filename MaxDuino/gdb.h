@@ -0,0 +1,34 @@
+#ifndef GDB_H_INCLUDED
+#define GDB_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef Use_GDB
+#include "Arduino.h"
+
+// TZX ID19 Generalized Data Block.
+// The pilot/sync and data symbol definitions are read into RAM (as us) when
+// the block starts, then the PRLE pilot stream and the bit packed data stream
+// are played out of the file by table lookup.
+// Blocks laid out like the ZX81 conversions (no pilot, 2 data symbols of 18
+// pulses) are left to the ZX8081 code, which has its own speedup.
+
+#ifndef GDB_MAX_SYMBOLS
+  #if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega32U4__)
+    #define GDB_MAX_SYMBOLS 8
+    #define GDB_MAX_PULSES 32
+  #elif defined(__AVR__)
+    #define GDB_MAX_SYMBOLS 64
+    #define GDB_MAX_PULSES 256
+  #else
+    #define GDB_MAX_SYMBOLS 512   // full pilot + data alphabets
+    #define GDB_MAX_PULSES 1024
+  #endif
+#endif
+
+// Process the current ID19 block task.  Returns false if the block is
+// for the ZX8081 handler instead (nothing done).
+bool gdb_process();
+#endif
+
+#endif // GDB_H_INCLUDED
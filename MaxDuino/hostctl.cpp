@@ -0,0 +1,171 @@
+#include "configs.h"
+#include "hostctl.h"
+
+#ifdef HOST_CONTROL
+
+#include "file_utils.h"
+#include "MaxDuino.h"
+#include "processing_state.h"
+#include "current_settings.h"
+#include "buffer.h"
+
+namespace {
+constexpr byte SYNC_IN = 0xA5;
+constexpr byte SYNC_OUT = 0x5A;
+constexpr byte MAX_PAYLOAD = 64;
+
+enum class RX : byte { SYNC, CMD, LEN, DATA, SUM };
+
+RX rx = RX::SYNC;
+byte rxCmd;
+byte rxLen;
+byte rxPos;
+byte rxSum;
+byte rxData[MAX_PAYLOAD + 1];     // +1: SELECT's path ends in a 0 here
+unsigned long rxLast;
+HOST_CMD waiting = HOST_CMD::NONE;    // taken by loop(), not yet answered
+
+void reply(byte cmd, HOST_RESULT result, const byte *data = nullptr, byte n = 0) {
+  byte sum = cmd + (n + 1) + (byte)result;
+  Serial.write(SYNC_OUT);
+  Serial.write(cmd);
+  Serial.write(n + 1);
+  Serial.write((byte)result);
+  for (byte i = 0; i < n; i++) {
+    Serial.write(data[i]);
+    sum += data[i];
+  }
+  Serial.write(sum);
+}
+
+byte *put16(byte *p, word v) {
+  *p++ = v >> 8;
+  *p++ = v & 0xFF;
+  return p;
+}
+
+byte *put32(byte *p, unsigned long v) {
+  p = put16(p, v >> 16);
+  return put16(p, v & 0xFFFF);
+}
+
+void send_status() {
+  byte s[14 + MAX_PAYLOAD];
+  byte *p = s;
+  *p++ = (start==0) ? 0 : (pauseOn ? 2 : 1);
+  p = put16(p, block);
+  *p++ = currentID;
+  p = put32(p, bytesRead);
+  p = put32(p, filesize);
+  p = put16(p, BAUDRATE);
+  const byte n = strnlen(fileName, MAX_PAYLOAD);
+  memcpy(p, fileName, n);
+  reply((byte)HOST_CMD::STATUS, HOST_RESULT::OK, s, (p - s) + n);
+}
+
+void send_stats() {
+  byte s[5];
+  s[0] = underruns;
+  put32(s + 1, millis());
+  reply((byte)HOST_CMD::STATS, HOST_RESULT::OK, s, sizeof(s));
+}
+
+// A whole frame in: answer it, or hand it to loop()
+HOST_CMD frame(word &arg) {
+  const HOST_CMD cmd = (HOST_CMD)rxCmd;
+  switch (cmd) {
+    case HOST_CMD::STATUS:
+    case HOST_CMD::STATS:
+    case HOST_CMD::PLAY:
+    case HOST_CMD::PAUSE:
+    case HOST_CMD::STOP:
+      if (rxLen != 0) break;
+      if (cmd == HOST_CMD::STATUS) {
+        send_status();
+        return HOST_CMD::NONE;
+      }
+      if (cmd == HOST_CMD::STATS) {
+        send_stats();
+        return HOST_CMD::NONE;
+      }
+      return cmd;
+    case HOST_CMD::BLOCK:
+    case HOST_CMD::BAUD:
+      if (rxLen != 2) break;
+      arg = (rxData[0] << 8) | rxData[1];
+      return cmd;
+    case HOST_CMD::SELECT:
+      if (rxLen == 0) break;
+      rxData[rxLen] = '\0';
+      return cmd;
+    default:
+      reply(rxCmd, HOST_RESULT::UNKNOWN);
+      return HOST_CMD::NONE;
+  }
+  reply(rxCmd, HOST_RESULT::BAD_FRAME);
+  return HOST_CMD::NONE;
+}
+} // anonymous namespace
+
+void setup_host_control() {
+#ifndef SERIALSCREEN
+  Serial.begin(HOST_CONTROL_BAUD);
+#endif
+}
+
+HOST_CMD host_take_command(word &arg) {
+  if (waiting != HOST_CMD::NONE) return HOST_CMD::NONE;   // the last one isn't answered yet
+  if (rx != RX::SYNC && millis() - rxLast > HOST_CONTROL_TIMEOUT) rx = RX::SYNC;
+  for (byte i = 0; i < HOST_CONTROL_BYTES && Serial.available() > 0; i++) {
+    const byte b = Serial.read();
+    rxLast = millis();
+    switch (rx) {
+      case RX::SYNC:
+        if (b == SYNC_IN) rx = RX::CMD;
+        break;
+      case RX::CMD:
+        rxCmd = b;
+        rxSum = b;
+        rx = RX::LEN;
+        break;
+      case RX::LEN:
+        rxLen = b;
+        rxSum += b;
+        rxPos = 0;
+        if (rxLen > MAX_PAYLOAD) {
+          reply(rxCmd, HOST_RESULT::BAD_FRAME);
+          rx = RX::SYNC;
+        } else {
+          rx = rxLen ? RX::DATA : RX::SUM;
+        }
+        break;
+      case RX::DATA:
+        rxData[rxPos++] = b;
+        rxSum += b;
+        if (rxPos == rxLen) rx = RX::SUM;
+        break;
+      case RX::SUM:
+        rx = RX::SYNC;
+        if (b != rxSum) {
+          reply(rxCmd, HOST_RESULT::BAD_FRAME);
+          break;
+        }
+        waiting = frame(arg);
+        if (waiting != HOST_CMD::NONE) return waiting;
+        break;
+    }
+  }
+  return HOST_CMD::NONE;
+}
+
+const char *host_path() {
+  return (const char *)rxData;
+}
+
+void host_done(HOST_RESULT result) {
+  if (waiting == HOST_CMD::NONE) return;
+  reply((byte)waiting, result);
+  waiting = HOST_CMD::NONE;
+}
+
+#endif // HOST_CONTROL
@@ -0,0 +1,79 @@
+#ifndef HOSTCTL_H_INCLUDED
+#define HOSTCTL_H_INCLUDED
+
+#include "configs.h"
+#include "Arduino.h"
+
+#ifdef HOST_CONTROL
+
+// Remote control over the serial port (the USB one, on a board that has
+// it), for a host driving test runs with no one at the buttons.  Frames
+// both ways are
+//
+//   sync, cmd, len, len bytes, sum      (sum: the 8 bit sum of cmd, len and the bytes)
+//
+// with sync 0xA5 from the host and 0x5A back.  Numbers are high byte first.
+// Each command gets one reply with the same cmd, its first byte a result
+// (HOST_RESULT); status and stats add more after it.  A command is only
+// taken once the last has been answered, so the host sends one and waits.
+//
+//   0x01 STATUS            state (0 stopped, 1 playing, 2 paused), block (2), ID,
+//                          position (4), file size (4), baud (2), name
+//   0x02 STATS             underruns (the ISR's count, which wraps), ms since power on (4)
+//   0x10 SELECT path       stopped: "/GAMES/JSW.TZX", from the root; a directory selects it
+//   0x11 PLAY              play the selected file, or unpause
+//   0x12 PAUSE             pause / unpause
+//   0x13 STOP
+//   0x14 BLOCK n (2)       paused: jump to block n
+//   0x15 BAUD n (2)        the speed for TSX/UEF/etc, as the menu's Baud Rate
+//
+// Bytes are read a few at a time from loop() and the commands carried out
+// there, the same way as the matching button, like WIFI_SERVICE's.  A frame
+// that stops part way is dropped after HOST_CONTROL_TIMEOUT, and one with a
+// bad sum is answered BAD_FRAME, so a host can always get back in step.
+// SERIALSCREEN lines can come in between frames.
+
+#if defined(CDC_STREAM) || defined(SERIAL_TRACE)
+  #error HOST_CONTROL needs the serial port (CDC_STREAM and SERIAL_TRACE want it to themselves)
+#endif
+
+#ifndef HOST_CONTROL_BAUD
+  #define HOST_CONTROL_BAUD 115200   // (SERIALSCREEN's, if that's set too)
+#endif
+#ifndef HOST_CONTROL_TIMEOUT
+  #define HOST_CONTROL_TIMEOUT 200   // ms between the bytes of a frame before it's dropped
+#endif
+#ifndef HOST_CONTROL_BYTES
+  #define HOST_CONTROL_BYTES 16      // the most read each time round loop()
+#endif
+
+enum class HOST_CMD : byte {
+  NONE = 0x00,
+  STATUS = 0x01,
+  STATS = 0x02,
+  SELECT = 0x10,
+  PLAY = 0x11,
+  PAUSE = 0x12,
+  STOP = 0x13,
+  BLOCK = 0x14,
+  BAUD = 0x15,
+};
+
+enum class HOST_RESULT : byte {
+  OK,
+  BAD_STATE,      // not now (playing when it has to be stopped, say)
+  NOT_FOUND,      // no such file, or block
+  BAD_ARG,
+  BAD_FRAME,      // the sum was wrong, or the length for the command
+  UNKNOWN,        // no such command
+};
+
+void setup_host_control();
+// Read what's come in (up to HOST_CONTROL_BYTES), answering STATUS and STATS
+// itself; anything else is returned for loop() to do and answer with host_done
+HOST_CMD host_take_command(word &arg);   // arg: the block for BLOCK, the speed for BAUD
+const char *host_path();                 // for SELECT
+void host_done(HOST_RESULT result);
+#endif
+
+#endif // HOSTCTL_H_INCLUDED
@@ -1,5 +1,166 @@
 #ifndef HWCONFIG_H_INCLUDED
 #define HWCONFIG_H_INCLUDED
 
+// MEGA_DEEP: spend the Mega2560's 8K on depth, for heavy turbo use:
+// an 8 page (2K) output ring, a 256 block BLOCKID_INTO_MEM table, two
+// sectors of read-ahead and bigger SORTED_DIR / NAME_CACHE windows.
+// Each can still be overridden on its own.
+#if defined(MEGA_DEEP) && !defined(__AVR_ATmega2560__)
+  #error MEGA_DEEP is for the Mega2560
+#endif
+
+// Number of buffsize pages in the ring between the main loop (TZXLoop/casduinoLoop)
+// and the output ISR.  2 is the classic double buffer.  Boards with RAM to spare
+// can let the main loop run several pages ahead, which rides out longer stalls
+// (SD cluster changes, OLED updates) without an audible glitch.
+#ifndef BUFFER_PAGES
+  #if defined(__arm__) || defined(ESP32) || defined(ESP8266) || defined(MEGA_DEEP)
+    #define BUFFER_PAGES 8
+  #elif defined(__AVR_ATmega2560__) || defined(__AVR_ATmega4809__) || defined(__AVR_ATmega4808__)
+    #define BUFFER_PAGES 3
+  #else
+    #define BUFFER_PAGES 2
+  #endif
+#endif
+
+// Bytes in each page (a multiple of 2).  buffer_set_size picks the page size
+// per file: BUFFER_PAGE_MAX for the formats with high word rates (CAS and
+// Dragon, the TZX family with its ID15/ID18/ID19 streams, CSW, C64 TAP),
+// where a bigger ring rides out longer stalls, and BUFFER_PAGE_SMALL for the
+// rest, so a block jump or pause doesn't play out a long tail of old words.
+#ifndef BUFFER_PAGE_MAX
+  #if defined(ESP32) || defined(ARDUINO_ARCH_RP2040)
+    #define BUFFER_PAGE_MAX 2048
+  #elif defined(ESP8266)
+    #define BUFFER_PAGE_MAX 1024
+  #elif defined(__arm__)
+    #define BUFFER_PAGE_MAX 512
+  #elif defined(LARGEBUFFER) || defined(__AVR_ATmega2560__) || defined(__AVR_ATmega4809__) || defined(__AVR_ATmega4808__)
+    #define BUFFER_PAGE_MAX 254
+  #else
+    #define BUFFER_PAGE_MAX 176
+  #endif
+#endif
+#ifndef BUFFER_PAGE_SMALL
+  #if BUFFER_PAGE_MAX > 256
+    #define BUFFER_PAGE_SMALL 256
+  #else
+    #define BUFFER_PAGE_SMALL BUFFER_PAGE_MAX
+  #endif
+#endif
+
+// Entries in the BLOCKID_INTO_MEM block table, 4 bytes each (a 24-bit
+// offset and the ID).  The small AVRs keep to the config's maxblock.
+#ifndef BLOCK_TABLE_SIZE
+  #if defined(ESP32)
+    #define BLOCK_TABLE_SIZE 2048
+  #elif defined(__arm__) || defined(ESP8266)
+    #define BLOCK_TABLE_SIZE 1024
+  #elif defined(MEGA_DEEP)
+    #define BLOCK_TABLE_SIZE 256
+  #elif defined(__AVR_ATmega2560__)
+    #define BLOCK_TABLE_SIZE 128
+  #else
+    #define BLOCK_TABLE_SIZE (maxblock+1)
+  #endif
+#endif
+
+// Entries of a SORTED_DIR listing kept in RAM, 10 bytes each; a bigger
+// directory's listing goes to the SD card.
+#ifndef DIRVIEW_RAM
+  #if defined(ESP32)
+    #define DIRVIEW_RAM 1024
+  #elif defined(__arm__) || defined(ESP8266)
+    #define DIRVIEW_RAM 256
+  #elif defined(MEGA_DEEP)
+    #define DIRVIEW_RAM 128
+  #elif defined(__AVR_ATmega2560__)
+    #define DIRVIEW_RAM 64
+  #else
+    #define DIRVIEW_RAM 16
+  #endif
+#endif
+
+// NAME_CACHE window: how many directory entries, and the longest name kept
+#ifndef NAMECACHE_ENTRIES
+  #if defined(ESP32) || defined(__arm__) || defined(ESP8266)
+    #define NAMECACHE_ENTRIES 32
+  #elif defined(MEGA_DEEP)
+    #define NAMECACHE_ENTRIES 16
+  #elif defined(__AVR_ATmega2560__)
+    #define NAMECACHE_ENTRIES 8
+  #else
+    #define NAMECACHE_ENTRIES 4
+  #endif
+#endif
+#ifndef NAMECACHE_LEN
+  #if defined(ESP32) || defined(__arm__) || defined(ESP8266)
+    #define NAMECACHE_LEN 47
+  #else
+    #define NAMECACHE_LEN 23
+  #endif
+#endif
+
+// DIRECT_SPEED: the shortest direct recording sample the ISR is given one
+// at a time, in us.  A sped up ID15 with shorter samples goes out as one
+// period per run of samples at one level instead (see writeDataDirectMerged)
+#ifndef DIRECT_MIN_SAMPLE
+  #if defined(ESP32) || defined(ESP8266)
+    #define DIRECT_MIN_SAMPLE 5
+  #elif defined(__arm__)
+    #define DIRECT_MIN_SAMPLE 8
+  #else
+    #define DIRECT_MIN_SAMPLE 20
+  #endif
+#endif
+
+// RAM_PLAY: the biggest file that's played from a copy in RAM
+#ifndef RAM_PLAY_SIZE
+  #if defined(ESP32) || defined(ARDUINO_ARCH_RP2040)
+    #define RAM_PLAY_SIZE 65536
+  #elif defined(ESP8266)
+    #define RAM_PLAY_SIZE 24576
+  #else
+    #define RAM_PLAY_SIZE 8192      // the STM32F103 only has 20K
+  #endif
+#endif
+
+// LOOP_CACHE: the biggest ID24/ID25 loop body that's replayed from RAM
+#ifndef LOOP_CACHE_SIZE
+  #if defined(ESP32)
+    #define LOOP_CACHE_SIZE 16384
+  #elif defined(ESP8266)
+    #define LOOP_CACHE_SIZE 8192
+  #elif defined(__arm__)
+    #define LOOP_CACHE_SIZE 4096
+  #else
+    #define LOOP_CACHE_SIZE 1024
+  #endif
+#endif
+
+// EXFAT_SCAN read buffer: how much of the directory is read from the card at once
+#ifndef DIRSCAN_BUF
+  #if defined(ESP32)
+    #define DIRSCAN_BUF 4096
+  #elif defined(__arm__) || defined(ESP8266)
+    #define DIRSCAN_BUF 2048
+  #else
+    #define DIRSCAN_BUF 512
+  #endif
+#endif
+
+// Code the output ISR runs.  On the ESP cores anything called from an
+// interrupt should be in IRAM, otherwise a flash cache miss (the main loop
+// reading flash constants, or WiFi on the ESP8266) stalls the edge, or on
+// the ESP8266 faults outright.  The RP2040 runs from flash through its XIP
+// cache too, so its refill goes in RAM as well.  The other cores run from
+// flash anyway.
+#if defined(ESP32) || defined(ESP8266)
+  #define ISR_CODE IRAM_ATTR
+#elif defined(ARDUINO_ARCH_RP2040)
+  #define ISR_CODE __not_in_flash("maxduino")
+#else
+  #define ISR_CODE
+#endif
 
 #endif // HWCONFIG_H_INCLUDED
@@ -6,9 +6,209 @@
   #undef USE_SOFT_I2C_MASTER_H_AS_PLAIN_INCLUDE
   #undef _SOFTI2C_HPP
   #include <SoftI2CMaster.h>
+#elif (I2C_Library_Used == _I2C_Impl_AsyncTWI)
+  #include <util/twi.h>
+
+  // Queue layout, per transaction: [address][length][length data bytes]
+  // The writer fills in length at twi_async_end and only then commits the
+  // transaction, so the ISR never starts sending a half-built one.
+  namespace {
+  volatile byte twiq[TWI_QUEUE_SIZE];
+  volatile byte twiq_tail = 0;       // next byte the ISR will send
+  volatile byte twiq_committed = 0;  // end of the last complete transaction
+  byte twiq_head = 0;                // next free byte (writer only)
+  byte twiq_txn_start;               // header of the transaction being built
+  byte twiq_txn_len;
+  volatile bool twi_busy = false;
+  byte twi_remaining;                // data bytes left in the transaction on the bus (ISR only)
+
+  inline byte twiq_next(byte p) {
+    return (p+1) & (TWI_QUEUE_SIZE-1);
+  }
+
+  void twiq_put(byte b) {
+    const byte nxt = twiq_next(twiq_head);
+    while (nxt == twiq_tail) {
+      // queue full, wait for the ISR to drain some
+    }
+    twiq[twiq_head] = b;
+    twiq_head = nxt;
+  }
+
+  inline void twi_send_start() {
+    TWCR = _BV(TWINT) | _BV(TWSTA) | _BV(TWEN) | _BV(TWIE);
+  }
+
+  inline void twi_send_byte(byte b) {
+    TWDR = b;
+    TWCR = _BV(TWINT) | _BV(TWEN) | _BV(TWIE);
+  }
+
+  inline void twi_send_stop() {
+    TWCR = _BV(TWINT) | _BV(TWSTO) | _BV(TWEN);
+    twi_busy = false;
+  }
+
+  inline byte twiq_pop() {
+    const byte b = twiq[twiq_tail];
+    twiq_tail = twiq_next(twiq_tail);
+    return b;
+  }
+  } // anonymous namespace
+
+  ISR(TWI_vect)
+  {
+    switch(TW_STATUS) {
+      case TW_START:
+      case TW_REP_START:
+        {
+          const byte addr = twiq_pop();
+          twi_remaining = twiq_pop();
+          twi_send_byte((addr<<1) | TW_WRITE);
+        }
+        break;
+
+      case TW_MT_SLA_ACK:
+      case TW_MT_DATA_ACK:
+        if (twi_remaining) {
+          twi_remaining--;
+          twi_send_byte(twiq_pop());
+        } else if (twiq_tail != twiq_committed) {
+          twi_send_start(); // repeated start straight into the next queued transaction
+        } else {
+          twi_send_stop();
+        }
+        break;
+
+      default:
+        // NACK or bus error: drop the rest of this transaction
+        twiq_tail = (twiq_tail + twi_remaining) & (TWI_QUEUE_SIZE-1);
+        twi_remaining = 0;
+        twi_send_stop();
+        break;
+    }
+  }
+
+  void twi_async_init(void)
+  {
+    // internal pullups, as Wire does
+    SDA_PORT |= _BV(SDA_PIN);
+    SCL_PORT |= _BV(SCL_PIN);
+    TWSR = 0; // prescaler 1
+    TWBR = ((F_CPU / I2CCLOCK) - 16) / 2;
+    TWCR = _BV(TWEN);
+  }
+
+  void twi_async_start(uint8_t addr)
+  {
+    twiq_txn_start = twiq_head;
+    twiq_txn_len = 0;
+    twiq_put(addr);
+    twiq_put(0); // length, filled in by twi_async_end
+  }
+
+  void twi_async_write(uint8_t value)
+  {
+    twiq_put(value);
+    twiq_txn_len++;
+  }
+
+  void twi_async_end(void)
+  {
+    twiq[twiq_next(twiq_txn_start)] = twiq_txn_len;
+    noInterrupts();
+    twiq_committed = twiq_head;
+    if (!twi_busy) {
+      while (TWCR & _BV(TWSTO)) {} // previous stop still going out
+      twi_busy = true;
+      twi_send_start();
+    }
+    interrupts();
+  }
+
+  #ifdef I2C_AUTOCLOCK
+  // Polled transactions for i2c_autoclock, which runs before anything is
+  // queued (and so with the interrupt never enabled), so it can see the ACKs
+  namespace {
+  bool twi_poll(byte twcr, byte expect)
+  {
+    TWCR = twcr;
+    for (word i = 0; !(TWCR & _BV(TWINT)); i++) {
+      if (i == 0xFFFF) return false;   // the bus is stuck
+    }
+    return TW_STATUS == expect;
+  }
+
+  void twi_poll_stop()
+  {
+    TWCR = _BV(TWINT) | _BV(TWSTO) | _BV(TWEN);
+    while (TWCR & _BV(TWSTO)) {}
+  }
+  } // anonymous namespace
+
+  void twi_async_clock(unsigned long hz)
+  {
+    TWBR = (F_CPU / hz > 16) ? ((F_CPU / hz) - 16) / 2 : 0;
+  }
+
+  bool twi_async_probe(uint8_t addr)
+  {
+    // a NOP command (0xE3): acked all the way through if the display is keeping up
+    const bool ok = twi_poll(_BV(TWINT) | _BV(TWSTA) | _BV(TWEN), TW_START)
+      && (TWDR = (addr<<1) | TW_WRITE, twi_poll(_BV(TWINT) | _BV(TWEN), TW_MT_SLA_ACK))
+      && (TWDR = 0x80, twi_poll(_BV(TWINT) | _BV(TWEN), TW_MT_DATA_ACK))
+      && (TWDR = 0xE3, twi_poll(_BV(TWINT) | _BV(TWEN), TW_MT_DATA_ACK));
+    twi_poll_stop();
+    return ok;
+  }
+
+  int twi_async_status(uint8_t addr)
+  {
+    // one byte read back (the SH1106's status), -1 if it isn't acked
+    int status = -1;
+    if (twi_poll(_BV(TWINT) | _BV(TWSTA) | _BV(TWEN), TW_START)
+      && (TWDR = (addr<<1) | TW_READ, twi_poll(_BV(TWINT) | _BV(TWEN), TW_MR_SLA_ACK))
+      && twi_poll(_BV(TWINT) | _BV(TWEN), TW_MR_DATA_NACK)) {
+      status = TWDR;
+    }
+    twi_poll_stop();
+    return status;
+  }
+  #endif
+
 #elif (I2C_Library_Used == _I2C_Impl_SoftWire)
   #include <SoftWire.h>
   SoftWire Wire = SoftWire();  
 #else
   #include <Wire.h>
 #endif
+
+#ifdef I2C_AUTOCLOCK
+namespace {
+// fastest first; only those above I2CCLOCK are tried
+const unsigned long AUTOCLOCKS[] PROGMEM = {1000000UL, 800000UL, 600000UL};
+}
+
+unsigned long i2cClock = I2CCLOCK;
+
+unsigned long i2c_autoclock(uint8_t addr)
+{
+  const int status = mx_i2c_status(addr);    // at I2CCLOCK, to compare with
+  for (byte c = 0; c < sizeof(AUTOCLOCKS)/sizeof(AUTOCLOCKS[0]); c++) {
+    const unsigned long hz = pgm_read_dword(&AUTOCLOCKS[c]);
+    if (hz <= I2CCLOCK) break;
+    mx_i2c_clock(hz);
+    bool ok = true;
+    for (byte t = 0; ok && t < I2C_AUTOCLOCK_TRIES; t++) {
+      ok = mx_i2c_probe(addr) && (status < 0 || mx_i2c_status(addr) == status);
+    }
+    if (ok) {
+      i2cClock = hz;
+      return hz;
+    }
+  }
+  mx_i2c_clock(I2CCLOCK);
+  i2cClock = I2CCLOCK;
+  return I2CCLOCK;
+}
+#endif
@@ -20,6 +20,8 @@
     #define I2C_Library_Used (_I2C_Impl_SoftI2CMaster)
   #elif I2C_Library_Preference == _I2C_Impl_SoftWire
     #define I2C_Library_Used (_I2C_Impl_SoftWire)
+  #elif I2C_Library_Preference == _I2C_Impl_AsyncTWI
+    #define I2C_Library_Used (_I2C_Impl_AsyncTWI)
   #else
     #warning Wire library uses a lot of firmware space, you would be better off using SoftI2CMaster
     #define I2C_Library_Used (_I2C_Impl_Wire)
@@ -31,6 +33,9 @@
   #if I2C_Library_Preference == _I2C_Impl_SoftWire
     #warning This chip does not support SoftWire. Using default.
   #endif
+  #if I2C_Library_Preference == _I2C_Impl_AsyncTWI
+    #warning This chip does not support AsyncTWI. Using default.
+  #endif
   #define I2C_Library_Used (_I2C_Impl_Wire)
 #endif
 
@@ -65,6 +70,36 @@
   #define mx_i2c_write(byte) i2c_write(byte)
   #define mx_i2c_end() i2c_stop()
 
+  #ifdef I2C_AUTOCLOCK
+    #error I2C_AUTOCLOCK can't change SoftI2CMaster's clock (it's fixed when it's compiled), use Wire or AsyncTWI
+  #endif
+
+#elif (I2C_Library_Used == _I2C_Impl_AsyncTWI)
+  // Interrupt driven hardware TWI.  start/write/end only queue the transaction;
+  // the TWI interrupt sends it while the main loop carries on filling the buffer.
+  // Only blocks if the queue is full.  A single transaction must fit in the queue.
+  #ifndef TWI_QUEUE_SIZE
+    #define TWI_QUEUE_SIZE 64  // must be a power of 2
+  #endif
+  void twi_async_init(void);
+  void twi_async_start(uint8_t addr);
+  void twi_async_write(uint8_t value);
+  void twi_async_end(void);
+
+  #define mx_i2c_init() twi_async_init()
+  #define mx_i2c_start(address) twi_async_start(address)
+  #define mx_i2c_write(byte) twi_async_write(byte)
+  #define mx_i2c_end() twi_async_end()
+
+  #ifdef I2C_AUTOCLOCK
+    void twi_async_clock(unsigned long hz);
+    bool twi_async_probe(uint8_t addr);
+    int twi_async_status(uint8_t addr);
+    #define mx_i2c_clock(hz) twi_async_clock(hz)
+    #define mx_i2c_probe(address) twi_async_probe(address)
+    #define mx_i2c_status(address) twi_async_status(address)
+  #endif
+
 #else
   // Wire or SoftWire
   #if (I2C_Library_Used == _I2C_Impl_SoftWire)
@@ -81,10 +116,35 @@
   #define mx_i2c_write(byte) Wire.write(byte)
   #define mx_i2c_end() Wire.endTransmission()
 
+  #ifdef I2C_AUTOCLOCK
+    #if (I2C_Library_Used == _I2C_Impl_SoftWire)
+      #error I2C_AUTOCLOCK can't change SoftWire's clock, use Wire or AsyncTWI
+    #endif
+    #define mx_i2c_clock(hz) Wire.setClock(hz)
+    // a NOP command (0xE3), acked all the way through if the display is keeping up
+    #define mx_i2c_probe(address) (Wire.beginTransmission(address),\
+                                   Wire.write(0x80), Wire.write(0xE3),\
+                                   Wire.endTransmission() == 0)
+    // one byte read back (the SH1106's status), -1 if it isn't acked
+    #define mx_i2c_status(address) (Wire.requestFrom((uint8_t)(address), (uint8_t)1) == 1 ? Wire.read() : -1)
+  #endif
+
+#endif
+
+#ifdef I2C_AUTOCLOCK
+  #ifndef I2C_AUTOCLOCK_TRIES
+    #define I2C_AUTOCLOCK_TRIES 32    // transactions each clock has to get through without a miss
+  #endif
+  // From init_OLED: try the display at faster clocks than I2CCLOCK and stay
+  // at the fastest it keeps up with (or go back to I2CCLOCK)
+  unsigned long i2c_autoclock(uint8_t addr);
+  extern unsigned long i2cClock;       // what it settled on
 #endif
 
 #if defined(P8544)
-  #include <pcd8544.h>
+  #ifndef P8544_SPI
+    #include <pcd8544.h>
+  #endif
   #define ADMAX 1023
   #define ADPIN 0
   #include <avr/pgmspace.h>
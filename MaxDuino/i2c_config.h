@@ -7,8 +7,10 @@
 #ifndef I2C_Library_Preference
 #define I2C_Library_Preference _I2C_Impl_SoftI2CMaster
 //#define I2C_Library_Preference _I2C_Impl_SoftWire
+//#define I2C_Library_Preference _I2C_Impl_AsyncTWI  // AVR hardware TWI, interrupt driven: writes are queued and sent in the background
 #endif
 
 #define I2CFAST // if defined, I2C bus runs at 400kHz, instead of 100kHz default
+//#define I2C_AUTOCLOCK // at startup, try the OLED at up to 1MHz (Fast-mode Plus) and keep the fastest it keeps up with (Wire or AsyncTWI)
 
 #endif // I2C_CONFIG_H_INCLUDED
@@ -0,0 +1,377 @@
+#include "configs.h"
+#include "inflate.h"
+
+#ifdef Use_UEF_GZ
+
+#include "file_utils.h"
+
+bool gz_active = false;
+
+namespace {
+
+constexpr byte GZ_FEXTRA = 0x04;
+constexpr byte GZ_FNAME = 0x08;
+constexpr byte GZ_FCOMMENT = 0x10;
+constexpr byte GZ_FHCRC = 0x02;
+constexpr word GZ_WINDOW_MASK = GZ_WINDOW - 1;
+
+enum class GZSTATE : byte {
+  NEWBLOCK,
+  STORED,
+  HUFF,
+  DONE,
+};
+
+struct Huffman {
+  word count[16];     // number of codes of each length
+  word symbol[288];   // symbols ordered by code
+};
+
+// deflate length and distance codes: base value and extra bits
+const word LEN_BASE[29] PROGMEM = {
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+const byte LEN_EXTRA[29] PROGMEM = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+const word DIST_BASE[30] PROGMEM = {
+  1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+  257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+const byte DIST_EXTRA[30] PROGMEM = {
+  0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+  7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+const byte CLEN_ORDER[19] PROGMEM = {
+  16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+Huffman litTree;
+Huffman distTree;
+
+byte window[GZ_WINDOW];
+word winPos;
+unsigned long outPos;             // uncompressed position of the next byte
+unsigned long dataStart;          // file position of the deflate stream
+#ifdef Use_ZIP
+bool stored = false;              // a stored zip member: read as it is, from anywhere
+#endif
+
+byte inbuf[64];
+byte inPos;
+byte inLen;
+bool inEOF;
+unsigned long bitBuf;
+byte bitCnt;
+
+GZSTATE state;
+bool finalBlock;
+word storedLeft;
+word matchLen;
+word matchDist;
+
+byte in_byte() {
+  if (inPos >= inLen) {
+    const int r = entry.read(inbuf, sizeof(inbuf));
+    if (r <= 0) {
+      inEOF = true;
+      return 0;
+    }
+    inLen = r;
+    inPos = 0;
+  }
+  return inbuf[inPos++];
+}
+
+word bits(const byte n) {
+  // next n (<= 16) bits, lsb first
+  while (bitCnt < n) {
+    bitBuf |= (unsigned long)in_byte() << bitCnt;
+    bitCnt += 8;
+  }
+  const word v = bitBuf & ((1UL << n) - 1);
+  bitBuf >>= n;
+  bitCnt -= n;
+  return v;
+}
+
+void build(Huffman &h, const byte *lengths, const word n) {
+  word offs[16];
+  for (byte i = 0; i < 16; i++) h.count[i] = 0;
+  for (word i = 0; i < n; i++) h.count[lengths[i]]++;
+  h.count[0] = 0;
+  word sum = 0;
+  for (byte i = 0; i < 16; i++) {
+    offs[i] = sum;
+    sum += h.count[i];
+  }
+  for (word i = 0; i < n; i++) {
+    if (lengths[i]) h.symbol[offs[lengths[i]]++] = i;
+  }
+}
+
+int decode(const Huffman &h) {
+  // canonical codes, one bit at a time
+  int code = 0;
+  int first = 0;
+  int index = 0;
+  for (byte len = 1; len < 16; len++) {
+    code |= bits(1);
+    const int count = h.count[len];
+    if (code - count < first) return h.symbol[index + (code - first)];
+    index += count;
+    first += count;
+    first <<= 1;
+    code <<= 1;
+  }
+  return -1;
+}
+
+void fixed_trees() {
+  byte lengths[288];
+  word i = 0;
+  for (; i < 144; i++) lengths[i] = 8;
+  for (; i < 256; i++) lengths[i] = 9;
+  for (; i < 280; i++) lengths[i] = 7;
+  for (; i < 288; i++) lengths[i] = 8;
+  build(litTree, lengths, 288);
+  for (i = 0; i < 30; i++) lengths[i] = 5;
+  build(distTree, lengths, 30);
+}
+
+bool dynamic_trees() {
+  byte lengths[288+32];
+  const word nlen = bits(5) + 257;
+  const word ndist = bits(5) + 1;
+  const byte ncode = bits(4) + 4;
+  if (nlen > 286 || ndist > 30) return false;
+
+  for (byte i = 0; i < 19; i++) lengths[i] = 0;
+  for (byte i = 0; i < ncode; i++) lengths[pgm_read_byte(CLEN_ORDER + i)] = bits(3);
+  build(litTree, lengths, 19);   // code length codes, borrowing litTree
+
+  word i = 0;
+  while (i < nlen + ndist) {
+    int sym = decode(litTree);
+    if (sym < 0) return false;
+    if (sym < 16) {
+      lengths[i++] = sym;
+      continue;
+    }
+    byte len = 0;
+    word rep;
+    if (sym == 16) {
+      if (i == 0) return false;
+      len = lengths[i-1];
+      rep = 3 + bits(2);
+    } else if (sym == 17) {
+      rep = 3 + bits(3);
+    } else {
+      rep = 11 + bits(7);
+    }
+    if (i + rep > nlen + ndist) return false;
+    while (rep--) lengths[i++] = len;
+  }
+  build(litTree, lengths, nlen);
+  build(distTree, lengths + nlen, ndist);
+  return true;
+}
+
+void put(const byte b) {
+  window[winPos] = b;
+  winPos = (winPos + 1) & GZ_WINDOW_MASK;
+  outPos++;
+}
+
+bool next_byte(byte &b) {
+  for (;;) {
+    if (inEOF) state = GZSTATE::DONE;
+    if (matchLen) {
+      b = window[(winPos - matchDist) & GZ_WINDOW_MASK];
+      matchLen--;
+      put(b);
+      return true;
+    }
+    switch (state) {
+      case GZSTATE::NEWBLOCK: {
+        if (finalBlock) {
+          state = GZSTATE::DONE;
+          break;
+        }
+        finalBlock = bits(1);
+        const byte type = bits(2);
+        if (type == 0) {
+          // stored: byte aligned length and its complement
+          bitBuf = 0;
+          bitCnt = 0;
+          storedLeft = bits(16);
+          if ((word)~bits(16) != storedLeft) state = GZSTATE::DONE;
+          else state = GZSTATE::STORED;
+        } else if (type == 1) {
+          fixed_trees();
+          state = GZSTATE::HUFF;
+        } else if (type == 2 && dynamic_trees()) {
+          state = GZSTATE::HUFF;
+        } else {
+          state = GZSTATE::DONE;
+        }
+        break;
+      }
+
+      case GZSTATE::STORED:
+        if (storedLeft == 0) {
+          state = GZSTATE::NEWBLOCK;
+          break;
+        }
+        storedLeft--;
+        b = bits(8);
+        put(b);
+        return true;
+
+      case GZSTATE::HUFF: {
+        int sym = decode(litTree);
+        if (sym < 0) {
+          state = GZSTATE::DONE;
+          break;
+        }
+        if (sym < 256) {
+          b = sym;
+          put(b);
+          return true;
+        }
+        if (sym == 256) {
+          state = GZSTATE::NEWBLOCK;
+          break;
+        }
+        sym -= 257;
+        if (sym >= 29) {
+          state = GZSTATE::DONE;
+          break;
+        }
+        const word len = pgm_read_word(LEN_BASE + sym) + bits(pgm_read_byte(LEN_EXTRA + sym));
+        const int dsym = decode(distTree);
+        if (dsym < 0 || dsym >= 30) {
+          state = GZSTATE::DONE;
+          break;
+        }
+        const word dist = pgm_read_word(DIST_BASE + dsym) + bits(pgm_read_byte(DIST_EXTRA + dsym));
+        if (dist > outPos || dist > GZ_WINDOW) {
+          // corrupt, or a back reference past what we keep
+          state = GZSTATE::DONE;
+          break;
+        }
+        matchLen = len;
+        matchDist = dist;
+        break;
+      }
+
+      case GZSTATE::DONE:
+      default:
+        return false;
+    }
+  }
+}
+
+void restart() {
+  entry.seekSet(dataStart);
+  inPos = 0;
+  inLen = 0;
+  inEOF = false;
+  bitBuf = 0;
+  bitCnt = 0;
+  winPos = 0;
+  outPos = 0;
+  state = GZSTATE::NEWBLOCK;
+  finalBlock = false;
+  matchLen = 0;
+}
+
+bool skip_string() {
+  byte c;
+  do {
+    if (entry.read(&c, 1) != 1) return false;
+  } while (c);
+  return true;
+}
+} // anonymous namespace
+
+bool gz_open() {
+  // gzip header: 1f 8b, method 8 (deflate), flags, mtime, xfl, os, then
+  // optional extra field, file name, comment and header crc
+  byte hdr[10];
+  if (!entry.seekSet(0) || entry.read(hdr, 10) != 10) return false;
+  if (hdr[0] != 0x1f || hdr[1] != 0x8b || hdr[2] != 8) return false;
+  const byte flags = hdr[3];
+  if (flags & GZ_FEXTRA) {
+    if (entry.read(hdr, 2) != 2) return false;
+    entry.seekCur(word(hdr[1], hdr[0]));
+  }
+  if ((flags & GZ_FNAME) && !skip_string()) return false;
+  if ((flags & GZ_FCOMMENT) && !skip_string()) return false;
+  if (flags & GZ_FHCRC) entry.seekCur(2);
+  dataStart = entry.curPosition();
+
+  // uncompressed size (mod 2^32) is the last 4 bytes of the file
+  if (!entry.seekSet(entry.fileSize()-4) || entry.read(hdr, 4) != 4) return false;
+  filesize = ((unsigned long)word(hdr[3], hdr[2]) << 16) | word(hdr[1], hdr[0]);
+
+#ifdef Use_ZIP
+  stored = false;
+#endif
+  restart();
+  gz_active = true;
+  readahead_invalidate();
+  return true;
+}
+
+#ifdef Use_ZIP
+void gz_open_raw(unsigned long start, unsigned long size, bool isStored) {
+  dataStart = start;
+  filesize = size;
+  stored = isStored;
+  restart();
+  gz_active = true;
+  readahead_invalidate();
+}
+#endif
+
+bool gz_open_zlib(unsigned long start) {
+  // CMF: method 8 (deflate), FLG: no preset dictionary, and the pair a multiple of 31
+  // one stream at a time: not from inside a gzip'd file or a zip member
+  if (gz_active) return false;
+  byte hdr[2];
+  if (!entry.seekSet(start) || entry.read(hdr, 2) != 2) return false;
+  if ((hdr[0] & 0x0F) != 8 || (hdr[1] & 0x20) || word(hdr[0], hdr[1]) % 31) return false;
+  dataStart = start + 2;
+#ifdef Use_ZIP
+  stored = false;
+#endif
+  restart();
+  gz_active = true;
+  readahead_invalidate();
+  return true;
+}
+
+void gz_close() {
+  gz_active = false;
+}
+
+word gz_read(unsigned long pos, byte *dst, word n) {
+#ifdef Use_ZIP
+  if (stored) {
+    if (pos >= filesize || !entry.seekSet(dataStart + pos)) return 0;
+    if (n > filesize - pos) n = filesize - pos;
+    const int r = entry.read(dst, n);
+    return (r > 0) ? r : 0;
+  }
+#endif
+  if (pos < outPos) restart();
+  byte b;
+  while (outPos < pos) {
+    if (!next_byte(b)) return 0;
+  }
+  word i = 0;
+  while (i < n && next_byte(b)) {
+    dst[i++] = b;
+  }
+  return i;
+}
+
+#endif // Use_UEF_GZ
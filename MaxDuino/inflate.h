@@ -0,0 +1,48 @@
+#ifndef INFLATE_H_INCLUDED
+#define INFLATE_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef Use_UEF_GZ
+#include "Arduino.h"
+
+// Streaming inflate for gzip'd files (nearly every UEF in the wild).
+// While active, readfile() and friends see the decompressed data: bytesRead
+// and filesize are positions in the uncompressed stream.  Reading forwards
+// is streamed; reading backwards starts decompressing again from the top.
+//
+// GZ_WINDOW is the deflate history kept in RAM.  gzip always compresses with
+// a 32K window, so anything smaller only works for files made by tools that
+// were told to use a smaller one; a back reference past the window is
+// treated as the end of the file.
+
+#ifndef GZ_WINDOW
+  #define GZ_WINDOW 32768   // must be a power of 2
+#endif
+
+extern bool gz_active;
+
+// If the open entry is gzip'd, start inflating it and return true
+// (and set filesize to the uncompressed size).
+bool gz_open();
+
+#ifdef Use_ZIP
+// The same for a zip member (zip.h): a raw deflate stream, or a stored one,
+// of size bytes from start in entry.
+void gz_open_raw(unsigned long start, unsigned long size, bool stored);
+#endif
+
+// A zlib stream (2 byte header, deflate, then its checksum) from start in
+// entry, as in CSW-2's Z-RLE: read from position 0 until it ends, which it
+// does by itself, so filesize is left as it is.  False if it isn't one, or a stream is
+// already being inflated.
+bool gz_open_zlib(unsigned long start);
+
+// Stop treating entry as gzip'd (call whenever entry is (re)opened)
+void gz_close();
+
+// Read up to n uncompressed bytes starting at pos into dst; returns how many
+word gz_read(unsigned long pos, byte *dst, word n);
+#endif
+
+#endif // INFLATE_H_INCLUDED
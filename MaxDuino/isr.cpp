@@ -5,121 +5,236 @@
 #include "current_settings.h"
 #include "processing_state.h"
 #include "TimerCounter.h"
+#include "outputstats.h"
+#include "profile.h"
+#include "edgeverify.h"
+#include "ramwatch.h"
+#include "motorsense.h"
 
 namespace {
 #ifdef Use_c64
-constexpr word LONG_PULSE_OPCODE = 0xC000;
-constexpr unsigned long LONG_PULSE_CHUNK_US = 50000UL;
-unsigned long longPulseRemaining = 0;
+constexpr word HALF_PAIR_FLAG = 0x8000;      // 1aaaaaaabbbbbbbb, two half-waves in 4us units
+constexpr byte HALF_PAIR_SHIFT = 2;
 #endif
 
-void swap_read_buffer_page() {
-  volatile byte * tmp = readBuffer;
-  readBuffer = writeBuffer;
-  writeBuffer = tmp;
-  morebuff = true;
-}
-
-void advance_read_word() {
+ISR_CODE void advance_read_word() {
   readpos += 2;
-  if(readpos >= buffsize)
+  if(readpos >= buffsize && next_read_page())
   {
     readpos = 0;
-    swap_read_buffer_page();
   }
+  // otherwise readpos stays at the end of the page until the next one is ready
+}
+
+ISR_CODE byte extra_words(word w) {
+  // the words that go with this one: two for a long period, one for a
+  // repeat or a direct recording header
+  if ((w & LONG_PERIOD_MASK) == LONG_PERIOD_FLAG) return 2;
+  return ((w & PULSE_FLAG_MASK) == PULSE_REPEAT_FLAG || (w & PULSE_FLAG_MASK) == 0x6000) ? 1 : 0;
 }
 }
 
 
+// while stopped, how often wave2 looks to see if it should start again.
+// Kept short so the first edge after a resume (e.g. motor on) isn't held up
+#define STOPPED_TICK 1000
+// and while waiting for the main loop to finish a page
+#define WAITING_TICK 250
+
 //ISR Variables accessed/written by main loop
 volatile byte isStopped=false;
+#ifndef AVR_FAST_ISR
 volatile byte pinState=LOW;
-volatile bool isPauseBlock = false;
-volatile bool wasPauseBlock = false;
+#endif
+#ifdef Use_CAS
+volatile byte directSampleFrac = 0;
+volatile byte directNextFrac = 0;
+#endif
+#ifdef Use_c64
+volatile bool c64Stream = false;
+#endif
 
 void reset_output_state() {
   // not really part of the ISR, just part of the output
   pinState=LOW;
   WRITE_LOW;
-  wasPauseBlock=false;
-  isPauseBlock=false;
-#ifdef Use_c64
-  longPulseRemaining = 0;
+  repeatRemaining=0;
+  repeatAlt=0;
+  repeatPairs=0;
+#ifdef Use_CAS
+  directSampleFrac=0;
+  directNextFrac=0;
 #endif
 }
 
-void wave2() {
+ISR_CODE void wave2() {
   //ISR Output routine
 //  unsigned long zeroTime = micros();
-  byte pauseFlipBit = false;
   unsigned long newTime;
   static unsigned long directSampleLength;
-  word workingPeriod = word(readBuffer[readpos], readBuffer[readpos+1]);
+#ifdef Use_CAS
+  static byte directFracAcc;
+#endif
+  word workingPeriod;
+  PROFILE_SCOPE(WAVE2);
+#ifdef RAM_WATCH
+  ramwatch_isr();
+#endif
+#ifdef OUTPUT_STATS
+  stats_isr_begin();
+#endif
  
+#ifdef MOTOR_IRQ
+  if(isStopped || motorHold)
+#else
   if(isStopped)
+#endif
   {
-    newTime = 50000;
+    newTime = STOPPED_TICK;
     goto _set_period;
   }
 
-#ifdef Use_c64
-  if (currentID == BLOCKID::C64TAP)
+  if (repeatRemaining)
   {
-    if (longPulseRemaining != 0)
+    // next edge of a repeated pulse
+    repeatRemaining--;
+    newTime = repeatPeriod;
+    if (repeatAlt)
     {
-      newTime = (longPulseRemaining > LONG_PULSE_CHUNK_US) ? LONG_PULSE_CHUNK_US : longPulseRemaining;
-      longPulseRemaining -= newTime;
-      goto _set_period;
+      if (repeatPairs == 1)
+      {
+        // first edge of a pair: the second is the same
+        repeatPairs = 2;
+        goto _toggle_pulse;
+      }
+      if (repeatPairs) repeatPairs = 1;
+      const word _other = repeatAlt;
+      repeatAlt = repeatPeriod;
+      repeatPeriod = _other;
     }
+    goto _toggle_pulse;
+  }
 
-    if (workingPeriod == LONG_PULSE_OPCODE)
+  if (readpos >= buffsize)
+  {
+    // the main loop hadn't finished the next page when this one ran out
+    if (!next_read_page())
     {
-      advance_read_word();
-      const unsigned long lowWord = word(readBuffer[readpos], readBuffer[readpos+1]);
-      advance_read_word();
-      const unsigned long highWord = word(readBuffer[readpos], readBuffer[readpos+1]);
-      advance_read_word();
+      newTime = WAITING_TICK;
+      goto _set_period;
+    }
+    readpos = 0;
+  }
+  workingPeriod = word(readBuffer[readpos], readBuffer[readpos+1]);
+  {
+    const byte _extra = extra_words(workingPeriod);
+    if (_extra && readpos + 2*_extra >= buffsize && !read_page_ready())
+    {
+      // the words that go with it are on the next page: leave them all until that's ready
+      newTime = WAITING_TICK;
+      goto _set_period;
+    }
+  }
 
-      longPulseRemaining = (highWord << 16) | lowWord;
+  if ((workingPeriod & LONG_PERIOD_MASK) == LONG_PERIOD_FLAG)
+  {
+    // a long period (a pause, or a C64 long pulse): however long, the
+    // timer runs it in one go and only calls back at the end
+    if (workingPeriod & LONG_PERIOD_SET)
+      pinState = (workingPeriod & LONG_PERIOD_HIGH) ? HIGH : LOW;
+    else
+      pinState = !pinState;
+    advance_read_word();
+    newTime = (unsigned long)word(readBuffer[readpos], readBuffer[readpos+1]) << 16;
+    advance_read_word();
+    newTime |= word(readBuffer[readpos], readBuffer[readpos+1]);
+    if (pinState == LOW)
+      WRITE_LOW;
+    else
+      WRITE_HIGH;
+    goto _next;
+  }
 
+#if defined(Use_c64) && !defined(ISR_VARIANTS)
+  if (c64Stream)
+  {
+    if (workingPeriod & HALF_PAIR_FLAG)
+    {
+      // play the first half-wave now, and leave the second in its place as
+      // a plain period (without moving readpos), as for pulse pairs below
+      newTime = (unsigned long)((workingPeriod >> 8) & 0x7F) << HALF_PAIR_SHIFT;
+      workingPeriod = (workingPeriod & 0xFF) << HALF_PAIR_SHIFT;
+      readBuffer[readpos] = workingPeriod /256;
+      readBuffer[readpos+1] = workingPeriod %256;
       pinState = !pinState;
       if (pinState == LOW)
         WRITE_LOW;
       else
         WRITE_HIGH;
-
-      newTime = (longPulseRemaining > LONG_PULSE_CHUNK_US) ? LONG_PULSE_CHUNK_US : longPulseRemaining;
-      longPulseRemaining -= newTime;
       goto _set_period;
     }
   }
 #endif
 
-  if bitRead(workingPeriod, 15)          
+  if ((workingPeriod & PULSE_FLAG_MASK) == PULSE_PAIR_FLAG)
   {
-    bitClear(workingPeriod,15);         //Clear pause block flag
+    // pulse pair: play the first edge now, and turn the word into a plain
+    // pulse for the second edge (without moving readpos)
+    workingPeriod &= PULSE_PAIR_MAX;
+    readBuffer[readpos] = workingPeriod /256;
+    readBuffer[readpos+1] = workingPeriod %256;
+    newTime = workingPeriod;
+    pinState = !pinState;
+    if (pinState == LOW)
+      WRITE_LOW;
+    else
+      WRITE_HIGH;
+    goto _set_period;
+  }
 
-    //Handle special 'ending' pause
-    if (bitRead(workingPeriod, 13)) {
-      bitClear(workingPeriod,13);
-      newTime = workingPeriod;
-      //pinState = LOW;
-      //WRITE_LOW;
+  if ((workingPeriod & PULSE_FLAG_MASK) == PULSE_REPEAT_FLAG)
+  {
+    // (n can't be 0 here, that's a long period)
+    repeatRemaining = (workingPeriod & PULSE_TONE_MAX) - 1;
+    const bool _alt = workingPeriod & PULSE_REPEAT_ALT;
+    const bool _pairs = workingPeriod & PULSE_REPEAT_PAIRS;
+    advance_read_word();
+    workingPeriod = word(readBuffer[readpos], readBuffer[readpos+1]);
+    advance_read_word();
+    if (_alt && _pairs)
+    {
+      // first edge a now, then a again, then b b, a a ...
+      newTime = (workingPeriod >> 8) << PULSE_REPEAT_ALT_SHIFT;
+      repeatPeriod = newTime;
+      repeatAlt = (workingPeriod & 0xFF) << PULSE_REPEAT_ALT_SHIFT;
+      repeatPairs = 2;
+    }
+    else if (_alt)
+    {
+      // first edge a now, then b and a in turn
+      newTime = (workingPeriod >> 8) << PULSE_REPEAT_ALT_SHIFT;
+      repeatPeriod = (workingPeriod & 0xFF) << PULSE_REPEAT_ALT_SHIFT;
+      repeatAlt = newTime;
+      repeatPairs = 0;
+    }
+    else
+    {
+      repeatPeriod = workingPeriod;
+      repeatAlt = 0;
+      newTime = repeatPeriod;
+    }
+    goto _toggle_pulse;
+  }
+
+  if ((workingPeriod & SEGMENT_MASK) == SEGMENT_FLAG)
+  {
+    // a short pause, or the edge at the start of one: set the output
+    // and hold it there
+    if (workingPeriod & SEGMENT_TOGGLE)
       pinState = !pinState;
-      if (pinState == LOW)
-        WRITE_LOW; 
-      else   
-        WRITE_HIGH;
-     
-      goto _next;
-    }   
- 
-    //If bit 15 of the current period is set we're about to run a pause
-    //Pauses start with a 1.5ms where the output is untouched after which the output is set LOW
-    //Pause block periods are stored in milliseconds not microseconds
-    isPauseBlock = true;
-    if (!wasPauseBlock)
-      pauseFlipBit = true;
+    else
+      pinState = (workingPeriod & SEGMENT_HIGH) ? HIGH : LOW;
+    newTime = workingPeriod & SEGMENT_MAX;
   }
   else if (bitRead(workingPeriod, 14))
   {
@@ -127,10 +242,21 @@ void wave2() {
     {
       // this signifies the start of a direct recording block, where we encode the sample period
       directSampleLength = workingPeriod & 0x1fff;
+#ifdef Use_CAS
+      directSampleFrac = directNextFrac;      // the rate can change mid file, and the main loop is ahead of this
+#endif
       advance_read_word();
       workingPeriod = word(readBuffer[readpos], readBuffer[readpos+1]);
     }
     newTime = directSampleLength;
+#ifdef Use_CAS
+    {
+      // the odd fraction of a us builds up, and each time it carries this sample is 1us longer
+      const byte _acc = directFracAcc;
+      directFracAcc += directSampleFrac;
+      if (directFracAcc < _acc) newTime++;
+    }
+#endif
 
     // 010xxiiibbbbbbbb
     //         ^
@@ -167,42 +293,226 @@ void wave2() {
     newTime = 1000; // Just in case we have a 0 in the buffer
     goto _next;
   }
-
-  if (pauseFlipBit || !isPauseBlock)
+  else
+  {
+    // a plain pulse
     pinState = !pinState;
+    newTime = workingPeriod;
+  }
 
   if (pinState == LOW)
     WRITE_LOW;    
   else
     WRITE_HIGH;
+  
+_next:
+  advance_read_word();
+  goto _set_period;
+
+_toggle_pulse:
+  pinState = !pinState;
+  if (pinState == LOW)
+    WRITE_LOW;
+  else
+    WRITE_HIGH;
+
+_set_period:
+  Timer.setPeriod(newTime);                 //Finally set the next pulse length
+#ifdef OUTPUT_STATS
+  stats_isr_end(newTime);
+#endif
+#ifdef EDGE_VERIFY
+  verify_period(pinState, isStopped ? 0 : newTime);
+#endif
+}
 
-  if (isPauseBlock)
+#ifdef ISR_VARIANTS
+// The same as wave2, for a stream that only has some of its words: a C64
+// .tap (periods, half-wave pairs and long periods) or a .cas (direct
+// recording words, or segments with DIRECT_RUNS).  UniPlay picks one for
+// the file, as it sets c64Stream, so wave2 itself has no C64 check.  Only
+// for speed: wave2 plays these streams right without them.
+
+#ifdef Use_c64
+ISR_CODE void wave_c64() {
+  unsigned long newTime;
+  word workingPeriod;
+  PROFILE_SCOPE(WAVE2);
+#ifdef RAM_WATCH
+  ramwatch_isr();
+#endif
+#ifdef OUTPUT_STATS
+  stats_isr_begin();
+#endif
+
+#ifdef MOTOR_IRQ
+  if(isStopped || motorHold)
+#else
+  if(isStopped)
+#endif
+  {
+    newTime = STOPPED_TICK;
+    goto _set_period;
+  }
+
+  if (readpos >= buffsize)
   {
-    if(pauseFlipBit)
+    if (!next_read_page())
     {
-      newTime = 1500;                     //Set 1.5ms initial pause block
-      pinState = TSXCONTROLzxpolarityUEFSWITCHPARITY;   
-      // reduce pause by 1ms as we've already pause for 1.5ms
-      workingPeriod = workingPeriod - 1;
-      readBuffer[readpos] = workingPeriod /256;
-      readBuffer[readpos+1] = workingPeriod  %256;                
-      pauseFlipBit=false;
-      goto _set_period;  // skips the part where we move readpos += 2 because we're using the same readpos now
-    } else {
-      newTime = ((unsigned long)workingPeriod)*1000ul; //Set pause length in microseconds
-      isPauseBlock=false;
-      wasPauseBlock=true;
+      newTime = WAITING_TICK;
+      goto _set_period;
     }
+    readpos = 0;
+  }
+  workingPeriod = word(readBuffer[readpos], readBuffer[readpos+1]);
+
+  if ((workingPeriod & LONG_PERIOD_MASK) == LONG_PERIOD_FLAG)
+  {
+    if (readpos + 4 >= buffsize && !read_page_ready())
+    {
+      newTime = WAITING_TICK;
+      goto _set_period;
+    }
+    pinState = !pinState;      // c64tap's are all toggles
+    advance_read_word();
+    newTime = (unsigned long)word(readBuffer[readpos], readBuffer[readpos+1]) << 16;
+    advance_read_word();
+    newTime |= word(readBuffer[readpos], readBuffer[readpos+1]);
+    advance_read_word();
+  }
+  else if (workingPeriod & HALF_PAIR_FLAG)
+  {
+    // the first half-wave now, the second left in its place as a plain period
+    newTime = (unsigned long)((workingPeriod >> 8) & 0x7F) << HALF_PAIR_SHIFT;
+    workingPeriod = (workingPeriod & 0xFF) << HALF_PAIR_SHIFT;
+    readBuffer[readpos] = workingPeriod /256;
+    readBuffer[readpos+1] = workingPeriod %256;
+    pinState = !pinState;
+  }
+  else if (workingPeriod == 0)
+  {
+    newTime = 1000;
+    advance_read_word();
+    goto _set_period;
   }
   else
   {
-    wasPauseBlock=false;
-    newTime = workingPeriod;          //After all that, if it's not a pause block set the pulse period 
+    pinState = !pinState;
+    newTime = workingPeriod;
+    advance_read_word();
   }
-  
-_next:
+
+  if (pinState == LOW)
+    WRITE_LOW;
+  else
+    WRITE_HIGH;
+
+_set_period:
+  Timer.setPeriod(newTime);
+#ifdef OUTPUT_STATS
+  stats_isr_end(newTime);
+#endif
+#ifdef EDGE_VERIFY
+  verify_period(pinState, isStopped ? 0 : newTime);
+#endif
+}
+#endif // Use_c64
+
+#ifdef Use_CAS
+ISR_CODE void wave_direct() {
+  unsigned long newTime;
+#ifndef DIRECT_RUNS
+  static unsigned long directSampleLength;
+  static byte directFracAcc;
+#endif
+  word workingPeriod;
+  PROFILE_SCOPE(WAVE2);
+#ifdef RAM_WATCH
+  ramwatch_isr();
+#endif
+#ifdef OUTPUT_STATS
+  stats_isr_begin();
+#endif
+
+#ifdef MOTOR_IRQ
+  if(isStopped || motorHold)
+#else
+  if(isStopped)
+#endif
+  {
+    newTime = STOPPED_TICK;
+    goto _set_period;
+  }
+
+  if (readpos >= buffsize)
+  {
+    if (!next_read_page())
+    {
+      newTime = WAITING_TICK;
+      goto _set_period;
+    }
+    readpos = 0;
+  }
+  workingPeriod = word(readBuffer[readpos], readBuffer[readpos+1]);
+
+  if (workingPeriod == 0)
+  {
+    newTime = 1000;
+    advance_read_word();
+    goto _set_period;
+  }
+
+#ifdef DIRECT_RUNS
+  // a run of samples at one level (bits_to_pulses)
+  pinState = (workingPeriod & SEGMENT_HIGH) ? HIGH : LOW;
+  newTime = workingPeriod & SEGMENT_MAX;
   advance_read_word();
+#else
+  if (bitRead(workingPeriod, 13))
+  {
+    // the sample period
+    if (readpos + 2 >= buffsize && !read_page_ready())
+    {
+      newTime = WAITING_TICK;
+      goto _set_period;
+    }
+    directSampleLength = workingPeriod & 0x1fff;
+    directSampleFrac = directNextFrac;
+    advance_read_word();
+    workingPeriod = word(readBuffer[readpos], readBuffer[readpos+1]);
+  }
+  newTime = directSampleLength;
+  {
+    const byte _acc = directFracAcc;
+    directFracAcc += directSampleFrac;
+    if (directFracAcc < _acc) newTime++;
+  }
+  pinState = bitRead(workingPeriod, 7) ? HIGH : LOW;
+  if (workingPeriod & 0x0700)
+  {
+    // more samples in this word: count one off and shift the next to bit 7
+    readBuffer[readpos] = (workingPeriod>>8)-1;
+    readBuffer[readpos+1] = (workingPeriod&0x7f)<<1;
+  }
+  else
+  {
+    advance_read_word();
+  }
+#endif
+
+  if (pinState == LOW)
+    WRITE_LOW;
+  else
+    WRITE_HIGH;
 
 _set_period:
-  Timer.setPeriod(newTime);                 //Finally set the next pulse length
+  Timer.setPeriod(newTime);
+#ifdef OUTPUT_STATS
+  stats_isr_end(newTime);
+#endif
+#ifdef EDGE_VERIFY
+  verify_period(pinState, isStopped ? 0 : newTime);
+#endif
 }
+#endif // Use_CAS
+#endif // ISR_VARIANTS
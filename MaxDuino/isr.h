@@ -2,14 +2,36 @@
 #define ISR_H_INCLUDED
 
 #include "Arduino.h"
+#include "configs.h"
 
 void wave2();
+#ifdef ISR_VARIANTS
+// wave2 for just the words of one stream (UniPlay picks the one to attach)
+#ifdef Use_c64
+void wave_c64();      // C64 .tap
+#endif
+#ifdef Use_CAS
+void wave_direct();   // .cas
+#endif
+#endif
 
 //ISR Variables
 extern volatile byte isStopped;
+#ifdef AVR_FAST_ISR
+  #define pinState GPIOR2    // for the assembly fast path (see TimerCounter.cpp)
+#else
 extern volatile byte pinState;
-extern volatile bool isPauseBlock;
-extern volatile bool wasPauseBlock;
+#endif
+#ifdef Use_CAS
+extern volatile byte directSampleFrac;   // fraction (1/256 us) to add to each direct recording sample, for CAS at any baud rate
+extern volatile byte directNextFrac;     // directSampleFrac from the next sample period word on
+#endif
+#ifdef Use_c64
+// set by UniPlay, with the timer stopped, for the whole of a C64 .tap: its
+// words are half-wave pairs, right up to the last one buffered (currentID is
+// the main loop's, and already IDEOF by then)
+extern volatile bool c64Stream;
+#endif
 
 void reset_output_state();
 
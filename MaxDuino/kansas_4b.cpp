@@ -6,61 +6,30 @@
 #include "file_utils.h"
 #include "MaxDuino.h" // for block_mem_oled and such
 #include "current_settings.h"
+#include "pwmbyte.h"
 
-byte oneBitPulses = 4;
-byte zeroBitPulses = 2;
-byte startBitPulses = 2;
-byte startBitValue = 0;
-byte stopBitPulses = 8;
-byte stopBitValue = 1;
-byte endianness = 0;      //0:LSb 1:MSb (default:0)
+// The block's bit layout, filled in once at READPARAM (defaults: 1 start
+// bit 0, 8 data bits LSb first, 2 stop bits 1; 0 = 2 pulses, 1 = 4 pulses)
+PWM_FORMAT kansasFormat = {
+  { 0, 0 },
+  { 0, 0 },
+  2, 4, false,
+  1, false,
+  2, true,
+  PWM_PARITY_NONE
+};
 
 void writeData4B() {
-  //Convert byte (4B Block) from file into string of pulses.  One pulse per pass
-  byte dataBit;
+  //Convert byte (4B Block) from file into string of pulses.  The whole byte
+  //goes straight into the buffer (pwm_write), so currentPeriod stays 0
+  currentPeriod = 0;
 
-  if (currentBit>0) {
-
-    //Start bits
-    if (currentBit==10 && startBitPulses) {
-      currentPeriod = startBitValue ? onePulse : zeroPulse;
-      pass+=1;
-      if ( pass==startBitPulses) {
-        currentBit += -1;
-        pass = 0;
-      }
-    }
-    //Stop bits
-    else if (currentBit==1 && stopBitPulses) {
-      currentPeriod = stopBitValue ? onePulse : zeroPulse;
-      pass+=1;
-      if ( pass==stopBitPulses )  {
-        currentBit += -1;
-        pass = 0;
-      }
-    }
-    //Data bits
-    else
-    {
-      if (currentBit==10 && !startBitPulses) currentBit = 9;
-      dataBit = (currentByte >> (endianness ? (currentBit - 2) : (9 - currentBit))) & 1;
-      currentPeriod = dataBit ? onePulse : zeroPulse;
-      pass+=1;
-      if (pass==(dataBit ? oneBitPulses : zeroBitPulses)) {
-        currentBit += -1;
-        pass = 0;
-      }
-      if (currentBit==1 && !stopBitPulses) currentBit = 0;
-    }
-  }
-  else if (currentBit==0 && bytesToRead!=0)
-  {
+  if (currentBit==0 && bytesToRead!=0) {
     //Read new byte
     if (ReadByte()) {
       bytesToRead += -1;
-      currentByte = outByte;
-      currentBit = 10;
-      pass = 0;
+      pwm_begin_byte(kansasFormat, outByte);
+      currentBit = 1;
     } else {
       //End of file
       currentID=BLOCKID::IDEOF;
@@ -68,6 +37,10 @@ void writeData4B() {
     }
   }
 
+  if (pwm_write()) {
+    currentBit = 0;
+  }
+
   //End of block?
   if (bytesToRead==0 && currentBit==0) {
     temppause = pauseLength;
@@ -135,23 +108,24 @@ void tzx_process_blockid_kansas_4b() {
       } //End of TSX_SPEEDUP
 
       if(ReadByte()) {  // BitCfg
-        oneBitPulses =  outByte & 0x0f;       //(default:4)
-        zeroBitPulses = outByte >> 4;         //(default:2)
-        if (!oneBitPulses) oneBitPulses = 16;
-        if (!zeroBitPulses) zeroBitPulses = 16;
+        kansasFormat.oneHalves =  outByte & 0x0f;       //(default:4)
+        kansasFormat.zeroHalves = outByte >> 4;         //(default:2)
+        if (!kansasFormat.oneHalves) kansasFormat.oneHalves = 16;
+        if (!kansasFormat.zeroHalves) kansasFormat.zeroHalves = 16;
       }
       if(ReadByte()) {  // ByteCfg
         //Start Bits Cfg
-        startBitValue = (outByte >> 5) & 1;   //(default:0)
-        /*startBits = */startBitPulses = (outByte >> 6) & 3;  //(default:1)
-        startBitPulses *= startBitValue ? oneBitPulses : zeroBitPulses;
+        kansasFormat.startValue = (outByte >> 5) & 1;   //(default:0)
+        kansasFormat.startBits = (outByte >> 6) & 3;    //(default:1)
         //Stop Bits Cfg
-        stopBitValue = (outByte >> 2) & 1;    //(default:1)
-        /*stopBits = */stopBitPulses = (outByte >> 3) & 3;   //(default:2)
-        stopBitPulses *= stopBitValue ? oneBitPulses : zeroBitPulses;
+        kansasFormat.stopValue = (outByte >> 2) & 1;    //(default:1)
+        kansasFormat.stopBits = (outByte >> 3) & 3;     //(default:2)
         //Endianness
-        endianness = outByte & 1;             //0:LSb 1:MSb (default:0)
+        kansasFormat.msbFirst = outByte & 1;            //0:LSb 1:MSb (default:0)
       }
+      kansasFormat.zero[0] = kansasFormat.zero[1] = zeroPulse;
+      kansasFormat.one[0] = kansasFormat.one[1] = onePulse;
+      currentBit = 0;
       currentBlockTask = BLOCKTASK::PILOT;
       break;
 
@@ -0,0 +1,106 @@
+#include "configs.h"
+#include "lastfile.h"
+
+#ifdef FAST_BOOT
+
+#include "file_utils.h"
+
+namespace {
+// file layout (little endian):
+//   1 byte   depth
+//   2 bytes  index of each directory on the way down, depth of them
+//   2 bytes  file index
+//   4 bytes  file size
+// and with RESUME_CHECKPOINT
+//   2 bytes  block
+//   4 bytes  where it starts
+//   1 byte   its ID
+constexpr byte MAX_DEPTH = 20;
+#ifdef RESUME_CHECKPOINT
+constexpr byte CHECKPOINT_LEN = 7;
+#else
+constexpr byte CHECKPOINT_LEN = 0;
+#endif
+const char LAST_PATH[] PROGMEM = "/MAXLAST.DAT";
+
+// what the file holds, so that playing the same file again doesn't write it again
+byte rec[1 + 2*MAX_DEPTH + 6 + CHECKPOINT_LEN];
+byte recLen = 0;
+
+bool open_last(SdBaseFile &f, oflag_t flags) {
+  char name[sizeof(LAST_PATH)];
+  strcpy_P(name, LAST_PATH);
+  return f.open(name, flags);
+}
+} // anonymous namespace
+
+void lastfile_save(byte depth, const uint16_t *path, uint16_t file, unsigned long size) {
+  if (depth > MAX_DEPTH) return;
+  byte r[sizeof(rec)];
+  byte n = 0;
+  r[n++] = depth;
+  for (byte i = 0; i < depth; i++) {
+    r[n++] = path[i];
+    r[n++] = path[i] >> 8;
+  }
+  r[n++] = file;
+  r[n++] = file >> 8;
+  for (byte i = 0; i < 4; i++) r[n++] = size >> (8*i);
+  // (a new play starts from the top, so the checkpoint goes back to nothing)
+  for (byte i = 0; i < CHECKPOINT_LEN; i++) r[n++] = 0;
+  if (n == recLen && !memcmp(r, rec, n)) return;
+
+  SdBaseFile f;
+  if (!open_last(f, O_WRONLY | O_CREAT | O_TRUNC)) return;
+  if (f.write(r, n) == n) {
+    memcpy(rec, r, n);
+    recLen = n;
+  }
+  f.close();
+}
+
+byte lastfile_load(uint16_t *path, byte maxDepth, uint16_t &file, unsigned long &size) {
+  SdBaseFile f;
+  if (!open_last(f, O_RDONLY)) return LASTFILE_NONE;
+  const int n = f.read(rec, sizeof(rec));
+  f.close();
+  recLen = 0;
+  if (n < 7) return LASTFILE_NONE;
+  const byte depth = rec[0];
+  if (depth > maxDepth || depth > MAX_DEPTH || n != 7 + 2*depth + CHECKPOINT_LEN) return LASTFILE_NONE;
+  recLen = n;
+
+  byte p = 1;
+  for (byte i = 0; i < depth; i++, p += 2) path[i] = word(rec[p+1], rec[p]);
+  file = word(rec[p+1], rec[p]);
+  size = ((unsigned long)word(rec[p+5], rec[p+4]) << 16) | word(rec[p+3], rec[p+2]);
+  return depth;
+}
+
+#ifdef RESUME_CHECKPOINT
+void lastfile_checkpoint(word blk, unsigned long pos, byte id) {
+  if (recLen == 0) return;
+  byte *c = rec + recLen - CHECKPOINT_LEN;
+  c[0] = blk;
+  c[1] = blk >> 8;
+  for (byte i = 0; i < 4; i++) c[2+i] = pos >> (8*i);
+  c[6] = id;
+
+  // just the checkpoint's bytes, over the old ones
+  SdBaseFile f;
+  if (!open_last(f, O_RDWR)) return;
+  if (f.seekSet(recLen - CHECKPOINT_LEN)) f.write(c, CHECKPOINT_LEN);
+  f.close();
+}
+
+bool lastfile_resume_block(word &blk, unsigned long &pos, byte &id) {
+  if (recLen == 0) return false;
+  const byte *c = rec + recLen - CHECKPOINT_LEN;
+  blk = word(c[1], c[0]);
+  pos = ((unsigned long)word(c[5], c[4]) << 16) | word(c[3], c[2]);
+  id = c[6];
+  return pos != 0;
+}
+#endif
+
+#endif // FAST_BOOT
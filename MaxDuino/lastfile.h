@@ -0,0 +1,42 @@
+#ifndef LASTFILE_H_INCLUDED
+#define LASTFILE_H_INCLUDED
+
+#include "Arduino.h"
+#include "configs.h"
+
+// Where the last played file was, kept in /MAXLAST.DAT on the SD card, so
+// that at power on (FAST_BOOT) the player can open that directory with the
+// file already selected, and count the rest of the directory afterwards.
+// The record is the directory path as entry indexes from the root (as in
+// DirFilePos), then the file's index and size, which is checked on the way
+// back in case the card has been changed since.
+//
+// With RESUME_CHECKPOINT the record also has the block playback had got to,
+// written over in place as it goes, so after a crash mid-load the first PLAY
+// at power on can carry on from that block.
+
+#ifdef FAST_BOOT
+
+#define LASTFILE_NONE 0xFF
+
+// From playFile: remember file (depth directories down path).  Only writes when it changed
+void lastfile_save(byte depth, const uint16_t *path, uint16_t file, unsigned long size);
+
+// Get the saved path (up to maxDepth levels) and file; returns the depth, or LASTFILE_NONE
+byte lastfile_load(uint16_t *path, byte maxDepth, uint16_t &file, unsigned long &size);
+
+#ifdef RESUME_CHECKPOINT
+// The saved file has got to block blk, which starts at pos with ID id (0,0,0 for from the top)
+void lastfile_checkpoint(word blk, unsigned long pos, byte id);
+
+// After lastfile_load: the block it had got to, false if it was at the top
+bool lastfile_resume_block(word &blk, unsigned long &pos, byte &id);
+#endif
+
+#endif // FAST_BOOT
+
+#if defined(RESUME_CHECKPOINT) && !defined(FAST_BOOT)
+  #error RESUME_CHECKPOINT needs FAST_BOOT
+#endif
+
+#endif // LASTFILE_H_INCLUDED
@@ -1,32 +1,28 @@
-0x00, 0x00, 0x00, 0x00, 0x60, 0xB8, 0x44, 0x5A, 0x2D, 0x2E, 0x95, 0x93, 0x16, 0x96, 0x94, 0x10,
-0x10, 0x20, 0x20, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x40, 0x40, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01,
-0x96, 0x22, 0x02, 0xA2, 0x92, 0x06, 0x03, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x40, 0xE6, 0xF9, 0xF0, 0xF8, 0x78, 0xFC, 0xF0, 0xF1, 0xE0, 0xE7, 0xE6, 0x31, 0xF8,
-0xF4, 0xE2, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x02, 0xF2, 0xC6, 0x38, 0xC3, 0xE0, 0x18,
-0xC6, 0xF2, 0x02, 0xFE, 0x00, 0x01, 0xC0, 0x38, 0x86, 0x62, 0x3A, 0xC6, 0x38, 0xC1, 0x00, 0x18,
-0xC0, 0x1E, 0x62, 0x8C, 0x10, 0x31, 0x8C, 0x62, 0x12, 0x0E, 0x00, 0xFE, 0x02, 0xFA, 0x0A, 0x0A,
-0x0A, 0x0A, 0x12, 0xE4, 0x08, 0xF1, 0x02, 0xF0, 0x10, 0xF4, 0x04, 0x04, 0x04, 0xF0, 0x10, 0xF4,
-0x00, 0xF7, 0x15, 0xF7, 0x00, 0xF1, 0x10, 0xB0, 0xD4, 0x54, 0x54, 0x94, 0x24, 0xC8, 0x10, 0x80,
-0x60, 0xA0, 0xD4, 0x54, 0xD2, 0x92, 0x62, 0x82, 0x0C, 0xF0, 0x00, 0x00, 0x00, 0x80, 0xEB, 0xF4,
-0x73, 0x25, 0x65, 0x27, 0x73, 0xF0, 0xE8, 0xB2, 0x75, 0xF4, 0xE8, 0x90, 0x60, 0x80, 0x00, 0x00,
-0x00, 0x01, 0x0F, 0x1E, 0x3D, 0x31, 0x4C, 0x7B, 0x7B, 0xF7, 0xF7, 0x07, 0x7B, 0x7B, 0x1B, 0x00,
-0x01, 0x02, 0x07, 0x07, 0x0E, 0x0C, 0x00, 0x00, 0x3F, 0x20, 0x3F, 0x01, 0x0E, 0x30, 0x30, 0x0E,
-0x01, 0x3F, 0x20, 0x3F, 0x10, 0x2E, 0x31, 0x0C, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x31, 0x2E, 0x10,
-0x30, 0x2C, 0x23, 0x18, 0x04, 0x06, 0x18, 0x23, 0x24, 0x38, 0x00, 0x3F, 0x20, 0x2F, 0x28, 0x28,
-0x28, 0x28, 0x24, 0x13, 0x08, 0x07, 0x00, 0x1F, 0x30, 0x27, 0x28, 0x28, 0x2C, 0x37, 0x20, 0x3F,
-0x00, 0x3F, 0x20, 0x3F, 0x00, 0x3F, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x20, 0x3F, 0x00, 0x07,
-0x18, 0x17, 0x2C, 0x28, 0x2C, 0x27, 0x18, 0x07, 0x00, 0x01, 0x00, 0x08, 0xDC, 0x0D, 0x03, 0x00,
-0xE7, 0xCF, 0x4E, 0x0F, 0x0F, 0xCF, 0xE7, 0x43, 0x18, 0x3B, 0x17, 0x07, 0x00, 0x03, 0xFE, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1B, 0x3B, 0x28, 0x66, 0x66, 0x36, 0x0D, 0x18, 0x1C, 0x1C,
-0x00, 0x02, 0x02, 0x02, 0x02, 0x22, 0x00, 0x08, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-0x02, 0x22, 0x00, 0x08, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x22, 0x00, 0x08,
-0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x22, 0x00, 0x08, 0x00, 0x02, 0x02, 0x02,
-0x02, 0x02, 0x02, 0x02, 0x02, 0x22, 0x00, 0x08, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-0x02, 0x22, 0x00, 0x08, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x22, 0x00, 0x08,
-0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x22, 0x00, 0x04, 0x0A, 0x09, 0x34, 0x3A, 0x1C,
-0x1B, 0x0F, 0x0C, 0x62, 0x70, 0x37, 0x3F, 0x18, 0x04, 0x08, 0x2C, 0x58, 0x40, 0x20, 0x1F, 0x00
\ No newline at end of file
+// 512 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x82, 0x00, 0x0F, 0x60, 0xB8, 0x44, 0x5A, 0x2D, 0x2E, 0x95, 0x93, 0x16, 0x96, 0x94, 0x10, 0x10,
+0x20, 0x20, 0xC0, 0x84, 0x00, 0x82, 0x80, 0x83, 0x00, 0x81, 0x80, 0x83, 0x00, 0x81, 0x80, 0x83,
+0x00, 0x80, 0x80, 0x82, 0x00, 0x81, 0x80, 0x80, 0x00, 0x85, 0x80, 0x8C, 0x00, 0x80, 0x40, 0x00,
+0xC0, 0x96, 0x00, 0x0A, 0xFF, 0x01, 0x96, 0x22, 0x02, 0xA2, 0x92, 0x06, 0x03, 0x01, 0xFE, 0x87,
+0x00, 0x10, 0x40, 0xE6, 0xF9, 0xF0, 0xF8, 0x78, 0xFC, 0xF0, 0xF1, 0xE0, 0xE7, 0xE6, 0x31, 0xF8,
+0xF4, 0xE2, 0x41, 0x83, 0x00, 0x25, 0xFE, 0x02, 0xF2, 0xC6, 0x38, 0xC3, 0xE0, 0x18, 0xC6, 0xF2,
+0x02, 0xFE, 0x00, 0x01, 0xC0, 0x38, 0x86, 0x62, 0x3A, 0xC6, 0x38, 0xC1, 0x00, 0x18, 0xC0, 0x1E,
+0x62, 0x8C, 0x10, 0x31, 0x8C, 0x62, 0x12, 0x0E, 0x00, 0xFE, 0x02, 0xFA, 0x82, 0x0A, 0x07, 0x12,
+0xE4, 0x08, 0xF1, 0x02, 0xF0, 0x10, 0xF4, 0x81, 0x04, 0x1C, 0xF0, 0x10, 0xF4, 0x00, 0xF7, 0x15,
+0xF7, 0x00, 0xF1, 0x10, 0xB0, 0xD4, 0x54, 0x54, 0x94, 0x24, 0xC8, 0x10, 0x80, 0x60, 0xA0, 0xD4,
+0x54, 0xD2, 0x92, 0x62, 0x82, 0x0C, 0xF0, 0x81, 0x00, 0x10, 0x80, 0xEB, 0xF4, 0x73, 0x25, 0x65,
+0x27, 0x73, 0xF0, 0xE8, 0xB2, 0x75, 0xF4, 0xE8, 0x90, 0x60, 0x80, 0x81, 0x00, 0x26, 0x01, 0x0F,
+0x1E, 0x3D, 0x31, 0x4C, 0x7B, 0x7B, 0xF7, 0xF7, 0x07, 0x7B, 0x7B, 0x1B, 0x00, 0x01, 0x02, 0x07,
+0x07, 0x0E, 0x0C, 0x00, 0x00, 0x3F, 0x20, 0x3F, 0x01, 0x0E, 0x30, 0x30, 0x0E, 0x01, 0x3F, 0x20,
+0x3F, 0x10, 0x2E, 0x31, 0x0C, 0x82, 0x05, 0x11, 0x0C, 0x31, 0x2E, 0x10, 0x30, 0x2C, 0x23, 0x18,
+0x04, 0x06, 0x18, 0x23, 0x24, 0x38, 0x00, 0x3F, 0x20, 0x2F, 0x82, 0x28, 0x15, 0x24, 0x13, 0x08,
+0x07, 0x00, 0x1F, 0x30, 0x27, 0x28, 0x28, 0x2C, 0x37, 0x20, 0x3F, 0x00, 0x3F, 0x20, 0x3F, 0x00,
+0x3F, 0x20, 0x3F, 0x81, 0x00, 0x23, 0x3F, 0x20, 0x3F, 0x00, 0x07, 0x18, 0x17, 0x2C, 0x28, 0x2C,
+0x27, 0x18, 0x07, 0x00, 0x01, 0x00, 0x08, 0xDC, 0x0D, 0x03, 0x00, 0xE7, 0xCF, 0x4E, 0x0F, 0x0F,
+0xCF, 0xE7, 0x43, 0x18, 0x3B, 0x17, 0x07, 0x00, 0x03, 0xFE, 0x84, 0x00, 0x0B, 0x1C, 0x1B, 0x3B,
+0x28, 0x66, 0x66, 0x36, 0x0D, 0x18, 0x1C, 0x1C, 0x00, 0x82, 0x02, 0x03, 0x22, 0x00, 0x08, 0x00,
+0x86, 0x02, 0x03, 0x22, 0x00, 0x08, 0x00, 0x86, 0x02, 0x03, 0x22, 0x00, 0x08, 0x00, 0x86, 0x02,
+0x03, 0x22, 0x00, 0x08, 0x00, 0x86, 0x02, 0x03, 0x22, 0x00, 0x08, 0x00, 0x86, 0x02, 0x03, 0x22,
+0x00, 0x08, 0x00, 0x86, 0x02, 0x03, 0x22, 0x00, 0x08, 0x00, 0x85, 0x02, 0x17, 0x22, 0x00, 0x04,
+0x0A, 0x09, 0x34, 0x3A, 0x1C, 0x1B, 0x0F, 0x0C, 0x62, 0x70, 0x37, 0x3F, 0x18, 0x04, 0x08, 0x2C,
+0x58, 0x40, 0x20, 0x1F, 0x00,
@@ -1,32 +1,19 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
-0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF8, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xC0, 0xF0, 0xF0, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
-0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xE0, 0xF0, 0xF8, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
-0xFE, 0xF8, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1E,
-0x1E, 0x3E, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF8, 0xF0, 0xE0, 0xC0, 0xC0, 0xE0,
-0xF0, 0xF8, 0xF8, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x3E, 0x3E, 0x1E, 0x0E, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xE0, 0xE0, 0x80, 0x80, 0xC0,
-0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-0xC0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x87, 0x81, 0x9F, 0xBF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x81, 0xC7, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xE7, 0xE3, 0xC3, 0x81, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x00, 0x03, 0x07, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x78, 0x7F, 0x7F,
-0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7C, 0x78, 0x70, 0x00, 0x00, 0x70, 0x70,
-0x78, 0x7C, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x0F, 0x07, 0x07, 0x0F, 0x0F, 0x3F,
-0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7C, 0x78, 0x78, 0x70, 0x40, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x3F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x26, 0x3E, 0x18, 0x00, 0x01, 0x3F, 0x3F,
-0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE1, 0x3F, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0xFF,
-0xFF, 0x07, 0x0E, 0x08, 0x18, 0x10, 0x30, 0xE1, 0xFF, 0xC1, 0x00, 0x18, 0x3E, 0x26, 0x26, 0xC1,
-0xC1, 0xC1, 0xC1, 0xC1, 0xE7, 0x26, 0x3E, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 512 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x83, 0x00, 0x01, 0xC0, 0xF8, 0x8D, 0xFE, 0x02, 0xF8, 0xE0, 0xC0, 0x88, 0x00, 0x02, 0xC0, 0xF0,
+0xF0, 0x8D, 0xFE, 0x01, 0xF8, 0xC0, 0x8B, 0x00, 0x02, 0xE0, 0xF0, 0xF8, 0x88, 0xFE, 0x02, 0xF8,
+0xF0, 0xE0, 0x88, 0x00, 0x03, 0x08, 0x1E, 0x1E, 0x3E, 0x86, 0xFE, 0x08, 0xF8, 0xF0, 0xE0, 0xC0,
+0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x83, 0xFE, 0x80, 0x3E, 0x01, 0x1E, 0x0E, 0x86, 0x00, 0x00, 0xFC,
+0x89, 0xFF, 0x00, 0x7F, 0x86, 0xFF, 0x09, 0xFE, 0xFC, 0xE0, 0xE0, 0x80, 0x80, 0xC0, 0xF8, 0xFC,
+0xFE, 0x92, 0xFF, 0x00, 0xC0, 0x85, 0x00, 0x03, 0x80, 0xC0, 0xF8, 0xFE, 0x84, 0xFF, 0x04, 0xBF,
+0x87, 0x81, 0x9F, 0xBF, 0x85, 0xFF, 0x03, 0xFC, 0xF8, 0xE0, 0x80, 0x88, 0x00, 0x03, 0x01, 0x81,
+0xC7, 0xE7, 0x8A, 0xFF, 0x04, 0xE7, 0xE3, 0xC3, 0x81, 0x80, 0x89, 0x00, 0x00, 0xFC, 0x8A, 0xFF,
+0x04, 0x00, 0x03, 0x07, 0x3F, 0x7F, 0x8F, 0xFF, 0x03, 0x3F, 0x0F, 0x03, 0x00, 0x8C, 0xFF, 0x00,
+0xC0, 0x81, 0x00, 0x01, 0x40, 0x78, 0x86, 0x7F, 0x00, 0x3F, 0x87, 0x0F, 0x00, 0x3F, 0x86, 0x7F,
+0x08, 0x7C, 0x78, 0x70, 0x00, 0x00, 0x70, 0x70, 0x78, 0x7C, 0x85, 0x7F, 0x06, 0x3F, 0x0F, 0x07,
+0x07, 0x0F, 0x0F, 0x3F, 0x86, 0x7F, 0x04, 0x7C, 0x78, 0x78, 0x70, 0x40, 0x83, 0x00, 0x00, 0xFE,
+0x8A, 0xFF, 0x00, 0x3F, 0x84, 0x00, 0x02, 0x07, 0x0F, 0x1F, 0x86, 0xFF, 0x03, 0x3F, 0x1F, 0x07,
+0x01, 0x83, 0x00, 0x00, 0x0F, 0x8C, 0xFF, 0x00, 0xFE, 0x85, 0x00, 0x80, 0xFF, 0x84, 0xC1, 0x06,
+0x26, 0x3E, 0x18, 0x00, 0x01, 0x3F, 0x3F, 0x83, 0xC0, 0x19, 0xE1, 0x3F, 0x3F, 0x00, 0x00, 0xFF,
+0xFF, 0xC1, 0x00, 0x00, 0xFF, 0xFF, 0x07, 0x0E, 0x08, 0x18, 0x10, 0x30, 0xE1, 0xFF, 0xC1, 0x00,
+0x18, 0x3E, 0x26, 0x26, 0x83, 0xC1, 0x03, 0xE7, 0x26, 0x3E, 0x18, 0x86, 0x00,
@@ -1,32 +1,19 @@
-0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFC,
-0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0xC0, 0x80,
-0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFC,
-0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80,
-0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8,
-0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0x80,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x07, 0x0F,
-0x0F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xF3, 0xE3, 0xC3, 0x83, 0x03, 0x03, 0x03, 0x07, 0x07, 0x07, 0x0F,
-0x1F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFE, 0xFE, 0xFF, 0xF3, 0xF3, 0xE3, 0xC3, 0x83, 0x03, 0x03, 0x03, 0x07, 0x07, 0x07, 0x0F,
-0x0F, 0x1F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xF0,
-0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC3, 0xC7, 0xCF, 0xCF, 0xDF, 0xFF, 0x7F, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xF8, 0xF0,
-0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC3, 0xC7, 0xCF, 0xDF, 0xFF, 0x7F, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0,
-0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x01, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0x1F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
-0x3F, 0x1F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01,
-0x03, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0x1F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
-0x3F, 0x1F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x01, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
-0x3F, 0x1F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 512 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x82, 0x00, 0x80, 0x80, 0x80, 0xC0, 0x80, 0xE0, 0x80, 0xF0, 0x81, 0xF8, 0x86, 0xFC, 0x81, 0xF8,
+0x80, 0xF0, 0x03, 0xE0, 0xC0, 0xC0, 0x80, 0x82, 0x00, 0x02, 0x80, 0xC0, 0xC0, 0x81, 0xE0, 0x80,
+0xF0, 0x81, 0xF8, 0x86, 0xFC, 0x80, 0xF8, 0x80, 0xF0, 0x80, 0xE0, 0x80, 0xC0, 0x00, 0x80, 0x82,
+0x00, 0x80, 0x80, 0x80, 0xC0, 0x81, 0xE0, 0x80, 0xF0, 0x81, 0xF8, 0x85, 0xFC, 0x81, 0xF8, 0x80,
+0xF0, 0x80, 0xE0, 0x01, 0xC0, 0x80, 0xA1, 0x00, 0x87, 0x03, 0x81, 0x07, 0x80, 0x0F, 0x02, 0x1F,
+0x3F, 0x7F, 0x8B, 0xFF, 0x07, 0xFE, 0xFF, 0xFF, 0xFB, 0xF3, 0xE3, 0xC3, 0x83, 0x81, 0x03, 0x81,
+0x07, 0x04, 0x0F, 0x1F, 0x1F, 0x3F, 0x7F, 0x8B, 0xFF, 0x80, 0xFE, 0x05, 0xFF, 0xF3, 0xF3, 0xE3,
+0xC3, 0x83, 0x81, 0x03, 0x81, 0x07, 0x80, 0x0F, 0x80, 0x1F, 0x01, 0x3F, 0x7F, 0x8B, 0xFF, 0x07,
+0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x80, 0xAA, 0x00, 0x07, 0x01, 0x03, 0x07, 0x0F, 0x0F,
+0x1F, 0x3F, 0x7F, 0x8B, 0xFF, 0x04, 0xFE, 0xFC, 0xF8, 0xF0, 0xF0, 0x81, 0xE0, 0x81, 0xC0, 0x07,
+0xC1, 0xC3, 0xC7, 0xCF, 0xCF, 0xDF, 0xFF, 0x7F, 0x8B, 0xFF, 0x04, 0xFE, 0xFC, 0xF8, 0xF8, 0xF0,
+0x81, 0xE0, 0x82, 0xC0, 0x06, 0xC1, 0xC3, 0xC7, 0xCF, 0xDF, 0xFF, 0x7F, 0x8B, 0xFF, 0x07, 0xFE,
+0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0x88, 0xC0, 0xA1, 0x00, 0x04, 0x01, 0x03, 0x07, 0x07,
+0x0F, 0x81, 0x1F, 0x87, 0x3F, 0x81, 0x1F, 0x80, 0x0F, 0x81, 0x07, 0x02, 0x03, 0x01, 0x01, 0x81,
+0x00, 0x05, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x81, 0x1F, 0x87, 0x3F, 0x81, 0x1F, 0x80, 0x0F,
+0x80, 0x07, 0x80, 0x03, 0x80, 0x01, 0x82, 0x00, 0x07, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F,
+0x1F, 0x87, 0x3F, 0x81, 0x1F, 0x80, 0x0F, 0x81, 0x07, 0x80, 0x03, 0x00, 0x01, 0x82, 0x00,
@@ -1,32 +1,20 @@
-0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x98,
-0x88, 0x0C, 0x4C, 0x84, 0xA6, 0xA6, 0xC2, 0xD2, 0xD2, 0xC3, 0xE3, 0xE3, 0xE1, 0xE1, 0xE1, 0xE9,
-0xE9, 0xE1, 0xE1, 0xE1, 0xE3, 0xE3, 0xC3, 0xD2, 0xD2, 0xC2, 0xA6, 0xA6, 0x84, 0x4C, 0x4C, 0x88,
-0x98, 0x18, 0x30, 0x30, 0x60, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
-0x03, 0x03, 0x07, 0x0D, 0x0D, 0x19, 0x31, 0x39, 0x69, 0xD9, 0xD9, 0x99, 0x99, 0x19, 0x19, 0x19,
-0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x09, 0x01, 0x01, 0xE0, 0x18, 0x84, 0xE2, 0xF9, 0x1C,
-0x1E, 0x1E, 0x1F, 0x7F, 0xFF, 0xFF, 0x7F, 0x1F, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F,
-0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0x1F, 0x1F, 0xFF, 0xFF, 0x1F, 0x1E,
-0x1C, 0xF9, 0xF2, 0xC4, 0x08, 0xE0, 0x01, 0x01, 0x01, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
-0x19, 0x19, 0x19, 0x99, 0x99, 0xD9, 0xD9, 0x69, 0x39, 0x31, 0x19, 0x0D, 0x0D, 0x07, 0x03, 0x03,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x06, 0x06,
-0x05, 0x0D, 0x0B, 0x1B, 0x13, 0x33, 0x23, 0x63, 0x43, 0xE3, 0xE3, 0xA3, 0xE3, 0x63, 0x63, 0x63,
-0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x60, 0x60, 0x40, 0x00, 0x07, 0x18, 0x21, 0x47, 0x9F, 0x38,
-0x78, 0x7F, 0xFE, 0xF8, 0xF8, 0xF8, 0xFC, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8,
-0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xFF, 0xFE, 0xFE, 0xFC, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0x78, 0x78,
-0x38, 0x9F, 0x4F, 0x23, 0x10, 0x07, 0x00, 0x40, 0x60, 0x60, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
-0x63, 0x63, 0x63, 0xE3, 0xA3, 0xE3, 0xE3, 0x43, 0x63, 0x63, 0x33, 0x33, 0x1B, 0x0B, 0x0F, 0x0D,
-0x06, 0x06, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x02,
-0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x18,
-0x11, 0x30, 0x32, 0x21, 0x65, 0x65, 0x63, 0x4B, 0x4B, 0x43, 0xC7, 0xC7, 0xC7, 0x87, 0x87, 0x87,
-0x87, 0x87, 0x87, 0xC7, 0xC7, 0xC7, 0x43, 0x4B, 0x4B, 0x43, 0x65, 0x65, 0x21, 0x32, 0x32, 0x11,
-0x19, 0x18, 0x0C, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x06,
-0x02, 0x03, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 
\ No newline at end of file
+// 512 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x80, 0x00, 0xA5, 0x80, 0x80, 0xC0, 0x10, 0x60, 0x30, 0x30, 0x18, 0x98, 0x88, 0x0C, 0x4C, 0x84,
+0xA6, 0xA6, 0xC2, 0xD2, 0xD2, 0xC3, 0xE3, 0xE3, 0x81, 0xE1, 0x80, 0xE9, 0x81, 0xE1, 0x80, 0xE3,
+0x10, 0xC3, 0xD2, 0xD2, 0xC2, 0xA6, 0xA6, 0x84, 0x4C, 0x4C, 0x88, 0x98, 0x18, 0x30, 0x30, 0x60,
+0xC0, 0xC0, 0xA6, 0x80, 0x0D, 0x00, 0x03, 0x03, 0x07, 0x0D, 0x0D, 0x19, 0x31, 0x39, 0x69, 0xD9,
+0xD9, 0x99, 0x99, 0x98, 0x19, 0x0F, 0x09, 0x01, 0x01, 0xE0, 0x18, 0x84, 0xE2, 0xF9, 0x1C, 0x1E,
+0x1E, 0x1F, 0x7F, 0xFF, 0xFF, 0x7F, 0x82, 0x1F, 0x80, 0xFF, 0x81, 0x1F, 0x80, 0xFF, 0x82, 0x1F,
+0x0F, 0x3F, 0x7F, 0xFF, 0xFF, 0x1F, 0x1F, 0xFF, 0xFF, 0x1F, 0x1E, 0x1C, 0xF9, 0xF2, 0xC4, 0x08,
+0xE0, 0x81, 0x01, 0x98, 0x19, 0x80, 0x99, 0x80, 0xD9, 0x08, 0x69, 0x39, 0x31, 0x19, 0x0D, 0x0D,
+0x07, 0x03, 0x03, 0x89, 0x00, 0x80, 0x01, 0x0F, 0x03, 0x06, 0x06, 0x05, 0x0D, 0x0B, 0x1B, 0x13,
+0x33, 0x23, 0x63, 0x43, 0xE3, 0xE3, 0xA3, 0xE3, 0x87, 0x63, 0x80, 0x60, 0x0A, 0x40, 0x00, 0x07,
+0x18, 0x21, 0x47, 0x9F, 0x38, 0x78, 0x7F, 0xFE, 0x81, 0xF8, 0x01, 0xFC, 0xFF, 0x81, 0xF8, 0x80,
+0xFF, 0x81, 0xF8, 0x80, 0xFF, 0x81, 0xF8, 0x03, 0xFF, 0xFE, 0xFE, 0xFC, 0x81, 0xF8, 0x80, 0xFF,
+0x80, 0x78, 0x09, 0x38, 0x9F, 0x4F, 0x23, 0x10, 0x07, 0x00, 0x40, 0x60, 0x60, 0x87, 0x63, 0x11,
+0xE3, 0xA3, 0xE3, 0xE3, 0x43, 0x63, 0x63, 0x33, 0x33, 0x1B, 0x0B, 0x0F, 0x0D, 0x06, 0x06, 0x03,
+0x01, 0x01, 0xA4, 0x00, 0x81, 0x01, 0x03, 0x03, 0x02, 0x06, 0x06, 0x88, 0x04, 0x80, 0x0C, 0x0B,
+0x08, 0x18, 0x11, 0x30, 0x32, 0x21, 0x65, 0x65, 0x63, 0x4B, 0x4B, 0x43, 0x81, 0xC7, 0x84, 0x87,
+0x81, 0xC7, 0x0D, 0x43, 0x4B, 0x4B, 0x43, 0x65, 0x65, 0x21, 0x32, 0x32, 0x11, 0x19, 0x18, 0x0C,
+0x0C, 0x88, 0x04, 0x80, 0x06, 0x01, 0x02, 0x03, 0x81, 0x01, 0x99, 0x00,
@@ -1,32 +1,14 @@
-0x00, 0x00, 0x00, 0x00, 0xE0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
-0xA0, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00,
-0x00, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xE0, 0xE0, 0x00, 0x00,
-0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xE0, 0xE0, 0x00, 0xE0, 0xE0,
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0xF8, 0xF8, 0x00,
-0xE0, 0xE0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xE0, 0x00, 0x00, 0xE0,
-0xE0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x00, 0x00, 0xE0, 0xA0,
-0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x42, 0x42, 0x42, 0x42, 0x42, 0xC2, 0xC2, 0x02, 0x42, 0x43,
-0x83, 0x80, 0x03, 0x03, 0x82, 0x42, 0x42, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xC3, 0xC0,
-0x00, 0x0B, 0x0B, 0x0A, 0xCA, 0x8A, 0x8A, 0x0A, 0x0A, 0x0A, 0x0A, 0xCA, 0x4F, 0x4F, 0x40, 0x40,
-0x43, 0x42, 0x42, 0x82, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x03, 0x03,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00,
-0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02,
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x02, 0x02,
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x06, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04,
-0x02, 0x02, 0x01, 0x01, 0x02, 0x04, 0x04, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x03, 0x03,
-0x04, 0x04, 0x04, 0x04, 0x03, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x07, 0x00, 0x00, 0x03, 0x03,
-0x04, 0x04, 0x04, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 512 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x82, 0x00, 0x00, 0xE0, 0x8A, 0xA0, 0x02, 0x00, 0xE0, 0xE0, 0x88, 0x00, 0x04, 0xE0, 0x00, 0x00,
+0xE0, 0xE0, 0x87, 0x20, 0x80, 0xE0, 0x80, 0x00, 0x89, 0xA0, 0x80, 0xE0, 0x02, 0x00, 0xE0, 0xE0,
+0x89, 0x20, 0x80, 0x00, 0x80, 0xF8, 0x02, 0x00, 0xE0, 0xE0, 0x88, 0xA0, 0x04, 0xE0, 0x00, 0x00,
+0xE0, 0xE0, 0x89, 0xA0, 0x80, 0x00, 0x00, 0xE0, 0x8A, 0xA0, 0x87, 0x00, 0x80, 0x02, 0x83, 0x42,
+0x80, 0xC2, 0x09, 0x02, 0x42, 0x43, 0x83, 0x80, 0x03, 0x03, 0x82, 0x42, 0x42, 0x85, 0x02, 0x08,
+0xC3, 0xC0, 0x00, 0x0B, 0x0B, 0x0A, 0xCA, 0x8A, 0x8A, 0x82, 0x0A, 0x09, 0xCA, 0x4F, 0x4F, 0x40,
+0x40, 0x43, 0x42, 0x42, 0x82, 0x82, 0x84, 0x02, 0x80, 0x03, 0x02, 0x00, 0x03, 0x03, 0x8B, 0x00,
+0x80, 0x03, 0x02, 0x00, 0x03, 0x03, 0x89, 0x02, 0x80, 0x00, 0x8A, 0x02, 0x02, 0x03, 0x00, 0x00,
+0x89, 0x02, 0x80, 0x03, 0x89, 0x00, 0x04, 0x04, 0x06, 0x06, 0x05, 0x05, 0x83, 0x04, 0x80, 0x02,
+0x80, 0x01, 0x04, 0x02, 0x04, 0x04, 0x00, 0x00, 0x81, 0x01, 0x80, 0x00, 0x80, 0x03, 0x82, 0x04,
+0x0B, 0x03, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x07, 0x00, 0x00, 0x03, 0x03, 0x81, 0x04, 0x80,
+0x03, 0xFF, 0x00, 0xC8, 0x00,
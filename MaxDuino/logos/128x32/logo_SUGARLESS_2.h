@@ -1,32 +1,26 @@
-0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x3C, 0x1E, 0x1E, 0x0E, 0x0E, 0x8F, 0x4F,
-0x8F, 0x0F, 0x0E, 0x0E, 0x1E, 0x1E, 0x3C, 0x7C, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04,
-0xFC, 0x04, 0x04, 0x00, 0x04, 0x84, 0x64, 0x34, 0x0C, 0x04, 0x00, 0x04, 0x8C, 0x70, 0x70, 0x8C,
-0x04, 0x00, 0x00, 0xFC, 0x04, 0x04, 0x04, 0x8C, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x08, 0x30, 0x40, 0x80, 0xFC, 0x00,
-0x00, 0x00, 0xF8, 0x8C, 0x04, 0x04, 0x8C, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xC0, 0xFC, 0xFF, 0xFF, 0x0F, 0x07, 0x07, 0x0F, 0x1F, 0xBF, 0xFE, 0x7E, 0xFC, 0xFA, 0xF1, 0xE0,
-0xE0, 0xD9, 0x86, 0x04, 0x88, 0x50, 0x60, 0x10, 0x20, 0x41, 0x83, 0x0F, 0xFF, 0xFF, 0xFC, 0x80,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x20, 0x20, 0x20, 0x40, 0x00, 0x00,
-0x01, 0xE0, 0x00, 0x00, 0x01, 0x01, 0xE1, 0x01, 0x01, 0x01, 0xC0, 0x61, 0x21, 0x20, 0x20, 0x41,
-0x01, 0x00, 0x00, 0x01, 0xC1, 0x21, 0xC1, 0x01, 0x00, 0x00, 0x00, 0xE0, 0x20, 0x21, 0x21, 0xC1,
-0x01, 0x00, 0x00, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x20, 0x20, 0x20, 0x21, 0x00,
-0x00, 0x00, 0xC0, 0x21, 0x21, 0x21, 0x41, 0x00, 0x00, 0x00, 0xC0, 0x20, 0x20, 0x20, 0x40, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x03, 0x3F, 0xFF, 0xFF, 0xF0, 0xC0, 0x80, 0x76, 0x89, 0x10, 0x10, 0xE0, 0x10, 0x89, 0x47, 0x3F,
-0x07, 0xDF, 0x9F, 0x3F, 0x3E, 0xFE, 0xFC, 0xFC, 0xF2, 0xE1, 0xEE, 0xF0, 0xFF, 0xFF, 0x3F, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00,
-0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x07, 0x0C, 0x08, 0x09, 0x09, 0x07,
-0x00, 0x00, 0x08, 0x07, 0x02, 0x02, 0x02, 0x07, 0x08, 0x00, 0x00, 0x0F, 0x01, 0x01, 0x03, 0x04,
-0x08, 0x00, 0x00, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x0F, 0x09, 0x09, 0x09, 0x09, 0x00,
-0x00, 0x00, 0x04, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, 0x04, 0x09, 0x09, 0x09, 0x06, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3E, 0x3D, 0x79, 0x7A, 0x71, 0x70, 0x70, 0xF0,
-0xF0, 0x70, 0x70, 0x71, 0x79, 0x78, 0x3C, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x61, 0x59, 0x4D, 0x43, 0x41, 0x00, 0x41,
-0x63, 0x1C, 0x1C, 0x63, 0x41, 0x00, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x40, 0x3F, 0x00, 0x00, 0x00,
-0x7F, 0x02, 0x0C, 0x10, 0x20, 0x7F, 0x00, 0x00, 0x00, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x3E, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 512 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x81, 0x00, 0x19, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x3C, 0x1E, 0x1E, 0x0E, 0x0E, 0x8F, 0x4F,
+0x8F, 0x0F, 0x0E, 0x0E, 0x1E, 0x1E, 0x3C, 0x7C, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x8F, 0x00, 0x80,
+0x04, 0x13, 0xFC, 0x04, 0x04, 0x00, 0x04, 0x84, 0x64, 0x34, 0x0C, 0x04, 0x00, 0x04, 0x8C, 0x70,
+0x70, 0x8C, 0x04, 0x00, 0x00, 0xFC, 0x81, 0x04, 0x01, 0x8C, 0xF8, 0x81, 0x00, 0x00, 0xFC, 0x82,
+0x00, 0x00, 0xFC, 0x81, 0x00, 0x00, 0xFC, 0x81, 0x00, 0x05, 0xFC, 0x08, 0x30, 0x40, 0x80, 0xFC,
+0x81, 0x00, 0x05, 0xF8, 0x8C, 0x04, 0x04, 0x8C, 0xF8, 0x96, 0x00, 0x1F, 0xC0, 0xFC, 0xFF, 0xFF,
+0x0F, 0x07, 0x07, 0x0F, 0x1F, 0xBF, 0xFE, 0x7E, 0xFC, 0xFA, 0xF1, 0xE0, 0xE0, 0xD9, 0x86, 0x04,
+0x88, 0x50, 0x60, 0x10, 0x20, 0x41, 0x83, 0x0F, 0xFF, 0xFF, 0xFC, 0x80, 0x87, 0x00, 0x00, 0xC0,
+0x81, 0x20, 0x09, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0x01, 0xE1, 0x81, 0x01, 0x0D,
+0xC0, 0x61, 0x21, 0x20, 0x20, 0x41, 0x01, 0x00, 0x00, 0x01, 0xC1, 0x21, 0xC1, 0x01, 0x81, 0x00,
+0x0A, 0xE0, 0x20, 0x21, 0x21, 0xC1, 0x01, 0x00, 0x00, 0xE0, 0x00, 0x01, 0x81, 0x00, 0x01, 0x01,
+0xE0, 0x81, 0x20, 0x00, 0x21, 0x81, 0x00, 0x00, 0xC0, 0x81, 0x21, 0x00, 0x41, 0x81, 0x00, 0x00,
+0xC0, 0x81, 0x20, 0x00, 0x40, 0x8F, 0x00, 0x1F, 0x03, 0x3F, 0xFF, 0xFF, 0xF0, 0xC0, 0x80, 0x76,
+0x89, 0x10, 0x10, 0xE0, 0x10, 0x89, 0x47, 0x3F, 0x07, 0xDF, 0x9F, 0x3F, 0x3E, 0xFE, 0xFC, 0xFC,
+0xF2, 0xE1, 0xEE, 0xF0, 0xFF, 0xFF, 0x3F, 0x01, 0x87, 0x00, 0x00, 0x04, 0x81, 0x09, 0x00, 0x06,
+0x81, 0x00, 0x00, 0x07, 0x82, 0x08, 0x00, 0x07, 0x81, 0x00, 0x09, 0x07, 0x0C, 0x08, 0x09, 0x09,
+0x07, 0x00, 0x00, 0x08, 0x07, 0x81, 0x02, 0x0C, 0x07, 0x08, 0x00, 0x00, 0x0F, 0x01, 0x01, 0x03,
+0x04, 0x08, 0x00, 0x00, 0x0F, 0x82, 0x08, 0x80, 0x00, 0x00, 0x0F, 0x82, 0x09, 0x81, 0x00, 0x00,
+0x04, 0x81, 0x09, 0x00, 0x06, 0x81, 0x00, 0x00, 0x04, 0x81, 0x09, 0x00, 0x06, 0x92, 0x00, 0x19,
+0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3E, 0x3D, 0x79, 0x7A, 0x71, 0x70, 0x70, 0xF0, 0xF0, 0x70, 0x70,
+0x71, 0x79, 0x78, 0x3C, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x99, 0x00, 0x0F, 0x41, 0x61, 0x59,
+0x4D, 0x43, 0x41, 0x00, 0x41, 0x63, 0x1C, 0x1C, 0x63, 0x41, 0x00, 0x00, 0x3F, 0x82, 0x40, 0x00,
+0x3F, 0x81, 0x00, 0x05, 0x7F, 0x02, 0x0C, 0x10, 0x20, 0x7F, 0x81, 0x00, 0x05, 0x3E, 0x63, 0x41,
+0x41, 0x63, 0x3E, 0x9F, 0x00,
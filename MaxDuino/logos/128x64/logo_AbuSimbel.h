@@ -1,64 +1,52 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x10, 0x28, 0x10, 0x28, 0x54, 0xaa, 0x50, 0x82, 0x15, 0xa2, 0x05, 0xaa, 0x54, 0xa0, 0x45, 0x08, 
-0x41, 0x0a, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x2a, 0x55, 0x2a, 0x55, 0x2a, 0x15, 0xaa, 0x14, 0xa8, 
-0x95, 0xa8, 0x94, 0xa8, 0x94, 0x28, 0x14, 0x28, 0x10, 0x23, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 
-0x33, 0x33, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x33, 0x3b, 0x39, 0x3c, 0x3d, 0x3d, 0x3c, 0x3e, 
-0x3e, 0x3f, 0xbf, 0xbf, 0xbf, 0xbf, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xff, 0x7e, 
-0x3d, 0xba, 0xb5, 0x3a, 0x75, 0xea, 0xd5, 0xaa, 0x55, 0xaa, 0x55, 0xaf, 0xfc, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x2a, 0xd5, 0x2a, 0x10, 0x82, 0x40, 0x20, 0x15, 0x02, 0x11, 0x08, 
-0x04, 0x00, 0x85, 0x00, 0x04, 0x82, 0x80, 0xc2, 0x41, 0x60, 0x21, 0xa0, 0xa1, 0xb0, 0x90, 0x90, 
-0x58, 0x58, 0x58, 0x58, 0x58, 0x78, 0x78, 0x38, 0xb8, 0x30, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xc0, 0xe0, 0xf0, 0xf8, 0xf8, 0x3c, 0x9c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 
-0x1c, 0x3c, 0x38, 0x38, 0x78, 0x79, 0x71, 0xf1, 0xf1, 0xf3, 0xe2, 0xe2, 0xc4, 0xc5, 0x89, 0x93, 
-0x17, 0x07, 0x2f, 0x0f, 0x5f, 0x1f, 0xbf, 0x3f, 0x7f, 0x7f, 0x7f, 0x3f, 0xbf, 0x1f, 0xc3, 0xa4, 
-0xaa, 0x90, 0xa4, 0x94, 0xa2, 0x94, 0xa3, 0x97, 0xfd, 0xfa, 0x55, 0xea, 0x55, 0xaf, 0xf8, 0x80, 
-0x40, 0xa0, 0x50, 0xa8, 0x54, 0xaa, 0x55, 0x2a, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x11, 0x08, 0x50, 0xa8, 0x55, 0xa8, 0x54, 0xa8, 
-0x01, 0xae, 0x55, 0x9b, 0x09, 0x05, 0x04, 0x32, 0x7a, 0xf9, 0xfd, 0xf5, 0xf8, 0xf4, 0xfa, 0xf4, 
-0xea, 0x54, 0xa9, 0x55, 0xa9, 0x55, 0xab, 0x51, 0x2b, 0x56, 0x28, 0x03, 0x7f, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x03, 0x28, 0x66, 0x61, 0x71, 0x7d, 0xfd, 0xfd, 0xfd, 0xfd, 
-0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xf9, 0x3b, 0x33, 0x07, 0x8f, 0xcf, 0xff, 0xff, 
-0xff, 0xfe, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0x31, 0xa1, 0x8b, 0x81, 0xbc, 0x7f, 0x7f, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xd5, 0xaa, 0x55, 0xff, 
-0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x50, 0xaa, 0x05, 0x02, 0x05, 0x8a, 0x44, 0x0a, 0x54, 0x28, 0x50, 0xa2, 0x15, 0x8a, 0x55, 0x02, 
-0x50, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x54, 0xa8, 0x54, 0xa8, 0x54, 0xa8, 0x54, 0xa8, 
-0x54, 0xa8, 0x54, 0xa8, 0x54, 0x28, 0x00, 0x00, 0x00, 0x80, 0x50, 0x08, 0x09, 0x00, 0x00, 0x00, 
-0x04, 0x04, 0x06, 0x07, 0x0f, 0x1f, 0xfc, 0xf8, 0xc2, 0x08, 0x55, 0xa8, 0x54, 0xa8, 0x54, 0xa8, 
-0xd4, 0xea, 0xd6, 0xea, 0xf6, 0xea, 0xf6, 0xfa, 0xf6, 0xfe, 0xf7, 0xef, 0xf7, 0xeb, 0xf7, 0xfb, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf9, 0xfc, 0x9e, 0xce, 0xef, 0xff, 0xff, 0xff, 
-0xfe, 0x79, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xab, 
-0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x54, 0xa0, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0x15, 0x28, 0x40, 0x80, 0x05, 0x0a, 0x10, 0xa0, 0x40, 0xaa, 0x55, 0xaa, 0x00, 0x2a, 
-0x51, 0x80, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 
-0x55, 0xaa, 0x55, 0x0a, 0x01, 0x00, 0x70, 0xb8, 0x1c, 0x0d, 0x08, 0x08, 0xc8, 0xc8, 0xd8, 0xf8, 
-0xfe, 0xfe, 0x7e, 0xde, 0xfe, 0xcf, 0x6f, 0x6f, 0x0f, 0x3c, 0xf9, 0x42, 0x17, 0xfe, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xe3, 0xe3, 0x75, 0xff, 0xff, 0xfe, 0xff, 0x7f, 0xdf, 
-0xc7, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xa8, 0x50, 0xa0, 
-0x50, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x04, 0x0a, 0x05, 0x22, 0x1d, 0x0e, 0x40, 0xaa, 
-0x15, 0x00, 0x00, 0x2a, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 
-0x55, 0xaa, 0x55, 0xaa, 0x54, 0xaa, 0x54, 0xa8, 0x50, 0xa8, 0x51, 0x3b, 0x53, 0x2b, 0x07, 0x07, 
-0x07, 0x67, 0xef, 0xe7, 0xfb, 0xfb, 0xfa, 0xf8, 0xfc, 0xfd, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xb0, 0xbf, 0xff, 0x9f, 0xcf, 0xe1, 0xf9, 0xe8, 0xfe, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xbf, 0x7f, 0xff, 
-0x45, 0x8a, 0x15, 0x2a, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 
-0x55, 0xaa, 0x55, 0xaa, 0x54, 0xa0, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0a, 
-0x40, 0x00, 0x00, 0x00, 0x05, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 
-0x55, 0xaa, 0x15, 0x2a, 0x15, 0x8a, 0xa5, 0xa2, 0x15, 0xba, 0x3a, 0xb8, 0x3c, 0xbc, 0xb8, 0xbc, 
-0xb8, 0xbc, 0xbc, 0xbc, 0xb9, 0xbb, 0xbb, 0xb7, 0xb7, 0xa7, 0xaf, 0x6f, 0x0f, 0x9f, 0xdf, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0x3f, 0x87, 0xf5, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xd5, 0xea, 0xf5, 0xfa, 0xf5, 0xfa, 0xff, 0xff, 
-0x55, 0x28, 0x10, 0x22, 0x15, 0x22, 0x15, 0x22, 0x15, 0x22, 0x15, 0x22, 0x15, 0x22, 0x15, 0x22, 
-0x15, 0x22, 0x15, 0x22, 0x15, 0x22, 0x15, 0x22, 0x15, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x0a, 0x50, 0x80, 0x10, 0x00, 0x01, 0x0a, 0x15, 0x2a, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 
-0x55, 0xaa, 0x55, 0xaa, 0x54, 0xaa, 0xd4, 0x88, 0x15, 0x08, 0x05, 0x08, 0x09, 0x0a, 0x0b, 0x0b, 
-0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x9d, 0x9d, 0xdc, 0xde, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x8f, 
-0xe3, 0xf9, 0xfc, 0xff, 0xf7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 
-0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb3, 0xb7, 0xb7, 0x37, 0x37, 0x37, 0x37
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x8E, 0x00, 0x2A, 0x10, 0x28, 0x10, 0x28, 0x54, 0xAA, 0x50, 0x82, 0x15, 0xA2, 0x05, 0xAA, 0x54,
+0xA0, 0x45, 0x08, 0x41, 0x0A, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0x2A, 0x55, 0x2A, 0x55, 0x2A, 0x15,
+0xAA, 0x14, 0xA8, 0x95, 0xA8, 0x94, 0xA8, 0x94, 0x28, 0x14, 0x28, 0x10, 0x23, 0x17, 0x83, 0x37,
+0x80, 0x33, 0x84, 0x37, 0x09, 0x33, 0x3B, 0x39, 0x3C, 0x3D, 0x3D, 0x3C, 0x3E, 0x3E, 0x3F, 0x82,
+0xBF, 0x00, 0x3F, 0x82, 0x7F, 0x8D, 0xFF, 0x81, 0xFE, 0x10, 0xFC, 0xFF, 0x7E, 0x3D, 0xBA, 0xB5,
+0x3A, 0x75, 0xEA, 0xD5, 0xAA, 0x55, 0xAA, 0x55, 0xAF, 0xFC, 0x80, 0x87, 0x00, 0x02, 0x80, 0x40,
+0xA0, 0x88, 0x00, 0x1B, 0x01, 0x2A, 0xD5, 0x2A, 0x10, 0x82, 0x40, 0x20, 0x15, 0x02, 0x11, 0x08,
+0x04, 0x00, 0x85, 0x00, 0x04, 0x82, 0x80, 0xC2, 0x41, 0x60, 0x21, 0xA0, 0xA1, 0xB0, 0x90, 0x90,
+0x83, 0x58, 0x80, 0x78, 0x05, 0x38, 0xB8, 0x30, 0xE0, 0xC0, 0x80, 0x84, 0x00, 0x06, 0xC0, 0xE0,
+0xF0, 0xF8, 0xF8, 0x3C, 0x9C, 0x85, 0x1C, 0x16, 0x3C, 0x38, 0x38, 0x78, 0x79, 0x71, 0xF1, 0xF1,
+0xF3, 0xE2, 0xE2, 0xC4, 0xC5, 0x89, 0x93, 0x17, 0x07, 0x2F, 0x0F, 0x5F, 0x1F, 0xBF, 0x3F, 0x81,
+0x7F, 0x1F, 0x3F, 0xBF, 0x1F, 0xC3, 0xA4, 0xAA, 0x90, 0xA4, 0x94, 0xA2, 0x94, 0xA3, 0x97, 0xFD,
+0xFA, 0x55, 0xEA, 0x55, 0xAF, 0xF8, 0x80, 0x40, 0xA0, 0x50, 0xA8, 0x54, 0xAA, 0x55, 0x2A, 0x05,
+0x02, 0x01, 0x88, 0x00, 0x27, 0x80, 0x01, 0x00, 0x11, 0x08, 0x50, 0xA8, 0x55, 0xA8, 0x54, 0xA8,
+0x01, 0xAE, 0x55, 0x9B, 0x09, 0x05, 0x04, 0x32, 0x7A, 0xF9, 0xFD, 0xF5, 0xF8, 0xF4, 0xFA, 0xF4,
+0xEA, 0x54, 0xA9, 0x55, 0xA9, 0x55, 0xAB, 0x51, 0x2B, 0x56, 0x28, 0x03, 0x7F, 0x84, 0x00, 0x08,
+0x03, 0xFF, 0xFF, 0x03, 0x28, 0x66, 0x61, 0x71, 0x7D, 0x82, 0xFD, 0x00, 0xFC, 0x82, 0xFE, 0x81,
+0xFC, 0x05, 0xF9, 0x3B, 0x33, 0x07, 0x8F, 0xCF, 0x81, 0xFF, 0x00, 0xFE, 0x83, 0xFC, 0x80, 0xF8,
+0x06, 0x31, 0xA1, 0x8B, 0x81, 0xBC, 0x7F, 0x7F, 0x89, 0xFF, 0x0C, 0xFA, 0xD5, 0xAA, 0x55, 0xFF,
+0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0x80, 0x86, 0x00, 0x25, 0x50, 0xAA, 0x05, 0x02, 0x05,
+0x8A, 0x44, 0x0A, 0x54, 0x28, 0x50, 0xA2, 0x15, 0x8A, 0x55, 0x02, 0x50, 0xAA, 0x55, 0xAA, 0x55,
+0xAA, 0x55, 0xAA, 0x54, 0xA8, 0x54, 0xA8, 0x54, 0xA8, 0x54, 0xA8, 0x54, 0xA8, 0x54, 0xA8, 0x54,
+0x28, 0x81, 0x00, 0x03, 0x80, 0x50, 0x08, 0x09, 0x81, 0x00, 0x80, 0x04, 0x1D, 0x06, 0x07, 0x0F,
+0x1F, 0xFC, 0xF8, 0xC2, 0x08, 0x55, 0xA8, 0x54, 0xA8, 0x54, 0xA8, 0xD4, 0xEA, 0xD6, 0xEA, 0xF6,
+0xEA, 0xF6, 0xFA, 0xF6, 0xFE, 0xF7, 0xEF, 0xF7, 0xEB, 0xF7, 0xFB, 0x85, 0xFF, 0x05, 0x03, 0xF9,
+0xFC, 0x9E, 0xCE, 0xEF, 0x81, 0xFF, 0x02, 0xFE, 0x79, 0x03, 0x88, 0xFF, 0x0E, 0xFE, 0xF5, 0xAB,
+0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x54, 0xA0, 0x40, 0x80, 0x83, 0x00, 0x3C, 0x02,
+0x15, 0x28, 0x40, 0x80, 0x05, 0x0A, 0x10, 0xA0, 0x40, 0xAA, 0x55, 0xAA, 0x00, 0x2A, 0x51, 0x80,
+0x00, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
+0x55, 0x0A, 0x01, 0x00, 0x70, 0xB8, 0x1C, 0x0D, 0x08, 0x08, 0xC8, 0xC8, 0xD8, 0xF8, 0xFE, 0xFE,
+0x7E, 0xDE, 0xFE, 0xCF, 0x6F, 0x6F, 0x0F, 0x3C, 0xF9, 0x42, 0x17, 0xFE, 0x96, 0xFF, 0x0B, 0x00,
+0xE3, 0xE3, 0x75, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0xDF, 0xC7, 0xF0, 0x8C, 0xFF, 0x12, 0x55, 0xAA,
+0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xA8, 0x50, 0xA0, 0x50, 0xA0,
+0x40, 0x81, 0x00, 0x27, 0x01, 0x0A, 0x04, 0x0A, 0x05, 0x22, 0x1D, 0x0E, 0x40, 0xAA, 0x15, 0x00,
+0x00, 0x2A, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
+0x55, 0xAA, 0x54, 0xAA, 0x54, 0xA8, 0x50, 0xA8, 0x51, 0x3B, 0x53, 0x2B, 0x81, 0x07, 0x0A, 0x67,
+0xEF, 0xE7, 0xFB, 0xFB, 0xFA, 0xF8, 0xFC, 0xFD, 0xFC, 0xFE, 0x97, 0xFF, 0x09, 0x07, 0xB0, 0xBF,
+0xFF, 0x9F, 0xCF, 0xE1, 0xF9, 0xE8, 0xFE, 0x87, 0xFF, 0x1F, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0xBF,
+0x7F, 0xFF, 0x45, 0x8A, 0x15, 0x2A, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
+0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x54, 0xA0, 0x00, 0x80, 0x84, 0x00, 0x02, 0x01, 0x0A, 0x40,
+0x81, 0x00, 0x1C, 0x05, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
+0xAA, 0x15, 0x2A, 0x15, 0x8A, 0xA5, 0xA2, 0x15, 0xBA, 0x3A, 0xB8, 0x3C, 0xBC, 0xB8, 0xBC, 0xB8,
+0x81, 0xBC, 0x0A, 0xB9, 0xBB, 0xBB, 0xB7, 0xB7, 0xA7, 0xAF, 0x6F, 0x0F, 0x9F, 0xDF, 0x91, 0xFF,
+0x03, 0x3F, 0x87, 0xF5, 0xFC, 0x8F, 0xFF, 0x22, 0xAF, 0xD5, 0xEA, 0xF5, 0xFA, 0xF5, 0xFA, 0xFF,
+0xFF, 0x55, 0x28, 0x10, 0x22, 0x15, 0x22, 0x15, 0x22, 0x15, 0x22, 0x15, 0x22, 0x15, 0x22, 0x15,
+0x22, 0x15, 0x22, 0x15, 0x22, 0x15, 0x22, 0x15, 0x22, 0x15, 0x20, 0x84, 0x00, 0x1D, 0x01, 0x0A,
+0x50, 0x80, 0x10, 0x00, 0x01, 0x0A, 0x15, 0x2A, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
+0x55, 0xAA, 0x54, 0xAA, 0xD4, 0x88, 0x15, 0x08, 0x05, 0x08, 0x09, 0x0A, 0x84, 0x0B, 0x07, 0x09,
+0x9D, 0x9D, 0xDC, 0xDE, 0xFF, 0xFE, 0xFE, 0x90, 0xFF, 0x06, 0x3F, 0x8F, 0xE3, 0xF9, 0xFC, 0xFF,
+0xF7, 0x92, 0xB7, 0x02, 0xB3, 0xB7, 0xB7, 0x82, 0x37,
@@ -1,103 +1,34 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8,
-0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xC0,
-0x00, 0x00, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
-0xF8, 0xF0, 0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC,
-0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xC0, 0x00, 0x00,
-0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
-0xF8, 0xF8, 0xF8, 0x70, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
-0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xE0,
-0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0xF8, 0xF8,
-0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00,
-0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
-0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x3F,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x0F, 0x0F,
-0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x0F,
-0x0F, 0x06, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFE, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x7F,
-0x7F, 0x7F, 0x7F, 0x7F, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x3F, 0x7F,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xF0,
-0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x83, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xE0, 0xF0, 0xF0, 0xE0, 0xE1,
-0xF3, 0xFF, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x70, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFE, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x00, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x0F,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x01, 0x01,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x0F, 0x1F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x0F, 0x1F, 0x1F, 0x1F,
-0x1F, 0x1F, 0x00, 0x00, 0x01, 0x0F, 0x1F, 0x1F, 0x0F, 0x00,
-0x00, 0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x00, 0x01,
-0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x0F, 0x1F,
-0x1F, 0x0F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x00, 0x00,
-0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x00, 0x04, 0x1F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x1F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x00, 0x06, 0x1F, 0x1F, 0x1F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x0F,
-0x07, 0x01, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x84, 0x00, 0x86, 0xF8, 0x00, 0xF0, 0x83, 0x00, 0x87, 0xF8, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x86,
+0xF8, 0x05, 0xF0, 0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0x85, 0xFC, 0x80, 0xF8, 0x03, 0xF0, 0xC0, 0x00,
+0x00, 0x8B, 0xF8, 0x01, 0x70, 0x00, 0x8B, 0xF8, 0x02, 0xF0, 0xE0, 0x80, 0x83, 0x00, 0x00, 0xF0,
+0x86, 0xF8, 0x00, 0xC0, 0x82, 0x00, 0x00, 0xF0, 0x8B, 0xF8, 0x01, 0xF0, 0xC0, 0x85, 0x00, 0x88,
+0xFF, 0x83, 0x00, 0x88, 0xFF, 0x80, 0x00, 0x88, 0xFF, 0x00, 0xE0, 0x85, 0xFF, 0x01, 0x1F, 0x3F,
+0x84, 0xFF, 0x04, 0x30, 0x00, 0x0F, 0x0F, 0x1F, 0x85, 0xFF, 0x04, 0x1F, 0x0F, 0x0F, 0x06, 0x00,
+0x85, 0xFF, 0x80, 0x1F, 0x85, 0xFF, 0x83, 0x00, 0x88, 0xFF, 0x82, 0x00, 0x85, 0xFF, 0x01, 0x3F,
+0x1F, 0x85, 0xFF, 0x84, 0x00, 0x00, 0xC0, 0x89, 0xFF, 0x82, 0x00, 0x88, 0xFF, 0x01, 0xF8, 0xFE,
+0x90, 0xFF, 0x01, 0x80, 0x00, 0x84, 0x7F, 0x00, 0x03, 0x82, 0x00, 0x85, 0xFF, 0x83, 0x00, 0x85,
+0xFF, 0x80, 0x00, 0x85, 0xFF, 0x82, 0x00, 0x00, 0xFC, 0x88, 0xFF, 0x00, 0xC0, 0x81, 0x00, 0x85,
+0xFF, 0x01, 0xF0, 0x00, 0x85, 0xFF, 0x84, 0x00, 0x84, 0xFF, 0x00, 0x7F, 0x83, 0xFF, 0x82, 0x00,
+0x94, 0xFF, 0x03, 0x00, 0x0F, 0x3F, 0x7F, 0x84, 0xFF, 0x05, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0x80,
+0x83, 0x00, 0x85, 0xFF, 0x83, 0x00, 0x85, 0xFF, 0x80, 0xFC, 0x83, 0xFF, 0x01, 0x7F, 0x1F, 0x81,
+0x00, 0x00, 0xC0, 0x83, 0xFF, 0x00, 0x3F, 0x84, 0xFF, 0x81, 0x00, 0x86, 0xFF, 0x00, 0x00, 0x85,
+0xFF, 0x83, 0x00, 0x00, 0xE0, 0x83, 0xFF, 0x01, 0x83, 0x80, 0x84, 0xFF, 0x81, 0x00, 0x94, 0xFF,
+0x09, 0xC0, 0xE0, 0xF0, 0xF0, 0xE0, 0xE1, 0xF3, 0xFF, 0x0F, 0x7F, 0x84, 0xFF, 0x00, 0x70, 0x82,
+0x00, 0x85, 0xFF, 0x83, 0x00, 0x85, 0xFF, 0x80, 0x3F, 0x83, 0xFF, 0x01, 0xFE, 0xF0, 0x81, 0x00,
+0x84, 0xFF, 0x01, 0x00, 0x87, 0x83, 0xFF, 0x02, 0xF8, 0x00, 0x00, 0x85, 0xFF, 0x01, 0x03, 0x00,
+0x85, 0xFF, 0x83, 0x00, 0x8C, 0xFF, 0x02, 0xE0, 0x00, 0x00, 0x84, 0xFF, 0x80, 0x07, 0x84, 0xFF,
+0x00, 0x0F, 0x8D, 0xFF, 0x80, 0x00, 0x84, 0xFF, 0x83, 0x00, 0x85, 0xFF, 0x83, 0x00, 0x85, 0xFF,
+0x80, 0x00, 0x85, 0xFF, 0x80, 0x00, 0x00, 0xC0, 0x8C, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x84, 0xFF,
+0x01, 0x03, 0x00, 0x85, 0xFF, 0x82, 0x00, 0x00, 0xFE, 0x84, 0xFF, 0x80, 0x01, 0x00, 0x0F, 0x84,
+0xFF, 0x80, 0x00, 0x84, 0xFF, 0x80, 0x00, 0x83, 0xFF, 0x01, 0x3F, 0x00, 0x85, 0xFF, 0x00, 0x07,
+0x85, 0xFF, 0x01, 0xFC, 0xFE, 0x84, 0xFF, 0x00, 0x1F, 0x82, 0x00, 0x85, 0xFF, 0x83, 0x00, 0x85,
+0xFF, 0x80, 0x00, 0x85, 0xFF, 0x80, 0x00, 0x84, 0xFF, 0x02, 0x07, 0x01, 0x01, 0x84, 0xFF, 0x02,
+0xFC, 0x00, 0x0F, 0x84, 0xFF, 0x01, 0xFE, 0xFC, 0x85, 0xFF, 0x82, 0x00, 0x00, 0x0F, 0x83, 0x1F,
+0x00, 0x03, 0x81, 0x00, 0x00, 0x0F, 0x83, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x83, 0x1F, 0x80, 0x00,
+0x07, 0x01, 0x0F, 0x1F, 0x1F, 0x0F, 0x00, 0x00, 0x0F, 0x83, 0x1F, 0x05, 0x0F, 0x00, 0x01, 0x07,
+0x0F, 0x0F, 0x82, 0x1F, 0x80, 0x0F, 0x80, 0x1F, 0x80, 0x0F, 0x00, 0x03, 0x83, 0x00, 0x00, 0x0F,
+0x83, 0x1F, 0x00, 0x0F, 0x83, 0x00, 0x00, 0x0F, 0x83, 0x1F, 0x03, 0x0F, 0x00, 0x00, 0x0F, 0x83,
+0x1F, 0x02, 0x0F, 0x00, 0x04, 0x83, 0x1F, 0x00, 0x0F, 0x81, 0x00, 0x00, 0x07, 0x83, 0x1F, 0x02,
+0x0F, 0x00, 0x06, 0x89, 0x1F, 0x80, 0x0F, 0x03, 0x07, 0x01, 0x00, 0x00,
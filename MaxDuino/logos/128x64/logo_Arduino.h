@@ -1,64 +1,34 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xe0, 0xe0, 0xf0, 
-0xf0, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 
-0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xe0, 0xe0, 0xf0, 0xf0, 0xf8, 0xf8, 
-0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 
-0xe0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x1f, 
-0x0f, 0x07, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x07, 
-0x0f, 0x1f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x00, 0x00, 
-0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x1f, 0x0f, 0x07, 0x07, 
-0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x07, 0x0f, 0x1f, 0x1f, 
-0x3f, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xe0, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0f, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x7f, 0x1f, 0x0f, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 
-0xe0, 0xe0, 0xf0, 0xfe, 0xfe, 0xfe, 0xfe, 0xe0, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xf0, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 
-0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x01, 0x01, 0x01, 0x1f, 0x1f, 0x1f, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xc0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfc, 
-0xf8, 0xf0, 0xf0, 0xf0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xf0, 0xf0, 
-0xf8, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf8, 0xf0, 0xf0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xf0, 0xf0, 0xf0, 0xf8, 0xfc, 0xfc, 
-0xfe, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x07, 
-0x07, 0x0f, 0x0f, 0x0f, 0x0f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x0f, 0x0f, 0x0f, 0x0f, 
-0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x0f, 0x0f, 
-0x0f, 0x0f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x07, 0x03, 
-0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfc, 0x7e, 0x0e, 0x1e, 0xfe, 0xf8, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0xfe, 0xfe, 0x86, 0x86, 0x86, 0xc6, 0xfe, 0xfc, 0x7c, 0x00, 0x00, 0x00, 0xfe, 0xfe, 
-0x06, 0x06, 0x06, 0x06, 0x0e, 0x1e, 0xfc, 0xf8, 0xe0, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0xfe, 0xfe, 0xfe, 0x06, 0x06, 
-0x06, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x1e, 0x7e, 0xf8, 0xe0, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 
-0xf0, 0xfc, 0xfe, 0x0e, 0x07, 0x07, 0x07, 0x06, 0x3e, 0xfc, 0xf8, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x70, 0x7e, 0x3f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0f, 0x1f, 0x7f, 0x7c, 0x60, 
-0x00, 0x00, 0x7f, 0x7f, 0x01, 0x01, 0x03, 0x07, 0x3f, 0x7c, 0x70, 0x40, 0x00, 0x00, 0x7f, 0x7f, 
-0x70, 0x60, 0x60, 0x70, 0x30, 0x3c, 0x1f, 0x1f, 0x03, 0x00, 0x07, 0x3f, 0x3f, 0x70, 0x60, 0x60, 
-0x60, 0x70, 0x7f, 0x3f, 0x1f, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x7f, 0x7f, 0x7f, 0x60, 0x60, 
-0x60, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x01, 0x07, 0x3f, 0x7c, 0x7f, 0x7f, 0x00, 0x00, 
-0x0f, 0x3f, 0x3f, 0x70, 0x60, 0x60, 0x60, 0x70, 0x3c, 0x3f, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x98, 0x00, 0x06, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x82, 0xF8, 0x85, 0xFC, 0x82, 0xF8,
+0x80, 0xF0, 0x80, 0xE0, 0x80, 0xC0, 0x00, 0x80, 0x8E, 0x00, 0x06, 0x80, 0xC0, 0xC0, 0xE0, 0xE0,
+0xF0, 0xF0, 0x82, 0xF8, 0x85, 0xFC, 0x82, 0xF8, 0x80, 0xF0, 0x80, 0xE0, 0x80, 0xC0, 0x00, 0x80,
+0xAE, 0x00, 0x04, 0xC0, 0xE0, 0xF8, 0xFC, 0xFE, 0x81, 0xFF, 0x04, 0x7F, 0x3F, 0x1F, 0x1F, 0x0F,
+0x81, 0x07, 0x87, 0x03, 0x81, 0x07, 0x04, 0x0F, 0x1F, 0x1F, 0x3F, 0x7F, 0x81, 0xFF, 0x0D, 0xFE,
+0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0x81, 0xFF, 0x04,
+0x7F, 0x3F, 0x1F, 0x1F, 0x0F, 0x81, 0x07, 0x87, 0x03, 0x81, 0x07, 0x04, 0x0F, 0x1F, 0x1F, 0x3F,
+0x7F, 0x81, 0xFF, 0x04, 0xFE, 0xFC, 0xF8, 0xE0, 0xC0, 0xA6, 0x00, 0x01, 0xE0, 0xFE, 0x84, 0xFF,
+0x01, 0x07, 0x01, 0x84, 0x00, 0x8B, 0xE0, 0x85, 0x00, 0x04, 0x01, 0x03, 0x0F, 0x1F, 0x7F, 0x86,
+0xFF, 0x04, 0x7F, 0x1F, 0x0F, 0x03, 0x01, 0x85, 0x00, 0x81, 0xE0, 0x00, 0xF0, 0x82, 0xFE, 0x82,
+0xE0, 0x85, 0x00, 0x01, 0x01, 0x07, 0x84, 0xFF, 0x01, 0xFE, 0xE0, 0xA4, 0x00, 0x01, 0x03, 0x3F,
+0x84, 0xFF, 0x01, 0xF0, 0xC0, 0x84, 0x00, 0x8B, 0x01, 0x84, 0x00, 0x04, 0x80, 0xC0, 0xF0, 0xFC,
+0xFE, 0x82, 0xFF, 0x80, 0x7F, 0x82, 0xFF, 0x04, 0xFE, 0xFC, 0xF0, 0xC0, 0x80, 0x84, 0x00, 0x82,
+0x01, 0x82, 0x1F, 0x82, 0x01, 0x85, 0x00, 0x01, 0xC0, 0xF0, 0x84, 0xFF, 0x01, 0x3F, 0x03, 0xA7,
+0x00, 0x04, 0x03, 0x0F, 0x1F, 0x3F, 0x7F, 0x81, 0xFF, 0x03, 0xFE, 0xFC, 0xFC, 0xF8, 0x81, 0xF0,
+0x88, 0xE0, 0x80, 0xF0, 0x80, 0xF8, 0x01, 0xFC, 0xFE, 0x81, 0xFF, 0x05, 0x7F, 0x3F, 0x1F, 0x0F,
+0x07, 0x03, 0x82, 0x00, 0x05, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x81, 0xFF, 0x05, 0xFE, 0xFC,
+0xF8, 0xF8, 0xF0, 0xF0, 0x88, 0xE0, 0x81, 0xF0, 0x03, 0xF8, 0xFC, 0xFC, 0xFE, 0x81, 0xFF, 0x04,
+0x7F, 0x3F, 0x1F, 0x0F, 0x03, 0xB0, 0x00, 0x00, 0x01, 0x81, 0x03, 0x80, 0x07, 0x82, 0x0F, 0x85,
+0x1F, 0x82, 0x0F, 0x81, 0x07, 0x80, 0x03, 0x00, 0x01, 0x90, 0x00, 0x02, 0x01, 0x03, 0x03, 0x81,
+0x07, 0x82, 0x0F, 0x85, 0x1F, 0x82, 0x0F, 0x80, 0x07, 0x81, 0x03, 0x00, 0x01, 0xB1, 0x00, 0x07,
+0xE0, 0xFC, 0x7E, 0x0E, 0x1E, 0xFE, 0xF8, 0x80, 0x82, 0x00, 0x80, 0xFE, 0x81, 0x86, 0x03, 0xC6,
+0xFE, 0xFC, 0x7C, 0x81, 0x00, 0x80, 0xFE, 0x82, 0x06, 0x05, 0x0E, 0x1E, 0xFC, 0xF8, 0xE0, 0x00,
+0x81, 0xFE, 0x83, 0x00, 0x81, 0xFE, 0x81, 0x00, 0x81, 0x06, 0x81, 0xFE, 0x81, 0x06, 0x81, 0x00,
+0x80, 0xFE, 0x0D, 0x1E, 0x7E, 0xF8, 0xE0, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0xF0, 0xFC, 0xFE,
+0x0E, 0x81, 0x07, 0x04, 0x06, 0x3E, 0xFC, 0xF8, 0xC0, 0xA6, 0x00, 0x03, 0x70, 0x7E, 0x3F, 0x0F,
+0x81, 0x0C, 0x22, 0x0F, 0x1F, 0x7F, 0x7C, 0x60, 0x00, 0x00, 0x7F, 0x7F, 0x01, 0x01, 0x03, 0x07,
+0x3F, 0x7C, 0x70, 0x40, 0x00, 0x00, 0x7F, 0x7F, 0x70, 0x60, 0x60, 0x70, 0x30, 0x3C, 0x1F, 0x1F,
+0x03, 0x00, 0x07, 0x3F, 0x3F, 0x70, 0x81, 0x60, 0x03, 0x70, 0x7F, 0x3F, 0x1F, 0x81, 0x00, 0x81,
+0x60, 0x81, 0x7F, 0x81, 0x60, 0x81, 0x00, 0x80, 0x7F, 0x80, 0x00, 0x0B, 0x01, 0x07, 0x3F, 0x7C,
+0x7F, 0x7F, 0x00, 0x00, 0x0F, 0x3F, 0x3F, 0x70, 0x81, 0x60, 0x04, 0x70, 0x3C, 0x3F, 0x1F, 0x03,
+0x92, 0x00,
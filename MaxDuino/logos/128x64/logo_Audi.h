@@ -1,64 +1,31 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x80, 0xc0, 0xe0, 0xe0, 0xf0, 0xf0, 0x78, 0x78, 0x78, 0x78, 0x3c, 0x3c, 0x3c, 0x3c, 
-0x3c, 0x78, 0x78, 0x78, 0xf0, 0xf0, 0xf0, 0xe0, 0xc0, 0xc0, 0xe0, 0xf0, 0xf0, 0xf0, 0x78, 0x78, 
-0x78, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x78, 0x78, 0x78, 0x78, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xe0, 
-0xe0, 0xf0, 0xf0, 0x78, 0x78, 0x78, 0x78, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x78, 0x78, 0x78, 0xf0, 
-0xf0, 0xf0, 0xe0, 0xc0, 0xc0, 0xe0, 0xf0, 0xf0, 0xf0, 0x78, 0x78, 0x78, 0x3c, 0x3c, 0x3c, 0x3c, 
-0x3c, 0x78, 0x78, 0x78, 0x78, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf8, 
-0xfe, 0xff, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xff, 0x3f, 0x0f, 0x0f, 0x3f, 0xff, 0xfc, 0xf8, 0xc0, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf8, 0xff, 0x7f, 0x1f, 0x0f, 0x1f, 
-0x7f, 0xff, 0xf8, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf8, 
-0xfc, 0xff, 0x3f, 0x0f, 0x0f, 0x3f, 0xff, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0xff, 0xfe, 0xf8, 0xe0, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 
-0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 
-0x3f, 0x7f, 0xfc, 0xf8, 0xe0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x07, 0x9f, 0xff, 0xfe, 0xf8, 0xf8, 0xfe, 0xff, 0x9f, 0x8f, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9f, 0xff, 0xff, 0xfc, 0xf8, 0xfc, 
-0xff, 0xff, 0x9f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8f, 
-0x9f, 0xff, 0xfe, 0xf8, 0xf8, 0xfe, 0xff, 0x9f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xe0, 0xf8, 0xfc, 0x7f, 0x3f, 0x1f, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0f, 0x0f, 0x0f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 
-0x1e, 0x1f, 0x0f, 0x0f, 0x0f, 0x07, 0x07, 0x03, 0x03, 0x01, 0x03, 0x07, 0x07, 0x0f, 0x0f, 0x0f, 
-0x0f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x03, 0x03, 0x01, 0x03, 
-0x03, 0x07, 0x0f, 0x0f, 0x0f, 0x0f, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x0f, 0x0f, 0x0f, 0x0f, 
-0x07, 0x07, 0x03, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0f, 0x0f, 0x0f, 0x1f, 0x1e, 0x1e, 0x1e, 0x1e, 
-0x1e, 0x1e, 0x0f, 0x0f, 0x0f, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x20, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x60, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 
-0xf8, 0xfc, 0xff, 0x7f, 0x1f, 0x0f, 0x07, 0x1f, 0x7f, 0xff, 0xfe, 0xfc, 0xf0, 0xe0, 0x80, 0x00, 
-0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 
-0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0xc0, 0xf0, 0xf0, 0xf8, 0xf8, 0x7c, 0x3c, 0x1c, 0x1c, 0x1c, 0x1d, 
-0x1f, 0x1f, 0x1f, 0x3f, 0xff, 0xfe, 0xfc, 0xf8, 0xe0, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x70, 0x78, 0x7e, 0x7f, 0x7f, 0x1f, 
-0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x1f, 0x3f, 0x7f, 0x7e, 
-0x7c, 0x78, 0x60, 0x4f, 0x1f, 0x3f, 0x3f, 0x7f, 0x78, 0x70, 0x70, 0x70, 0x70, 0x70, 0x7f, 0x7f, 
-0x3f, 0x3f, 0x1f, 0x07, 0x00, 0x07, 0x1f, 0x1f, 0x3f, 0x3f, 0x7c, 0x78, 0x78, 0x70, 0x70, 0x70, 
-0x70, 0x70, 0x78, 0x78, 0x3f, 0x3f, 0x3f, 0x1f, 0x07, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x90, 0x00, 0x05, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x82, 0x78, 0x83, 0x3C, 0x81, 0x78, 0x81,
+0xF0, 0x03, 0xE0, 0xC0, 0xC0, 0xE0, 0x81, 0xF0, 0x81, 0x78, 0x83, 0x3C, 0x82, 0x78, 0x80, 0xF0,
+0x80, 0xE0, 0x04, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x82, 0x78, 0x83, 0x3C, 0x81, 0x78, 0x81, 0xF0,
+0x03, 0xE0, 0xC0, 0xC0, 0xE0, 0x81, 0xF0, 0x81, 0x78, 0x83, 0x3C, 0x82, 0x78, 0x80, 0xF0, 0x80,
+0xE0, 0x01, 0xC0, 0x80, 0xA1, 0x00, 0x08, 0xE0, 0xF8, 0xFE, 0xFF, 0x1F, 0x0F, 0x07, 0x03, 0x01,
+0x8A, 0x00, 0x0B, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x0F, 0x3F, 0xFF, 0xFC, 0xF8, 0xC0, 0x87,
+0x00, 0x0C, 0x80, 0xE0, 0xF8, 0xFF, 0x7F, 0x1F, 0x0F, 0x1F, 0x7F, 0xFF, 0xF8, 0xE0, 0x80, 0x87,
+0x00, 0x0B, 0xC0, 0xF8, 0xFC, 0xFF, 0x3F, 0x0F, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x8A, 0x00,
+0x08, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0xFF, 0xFE, 0xF8, 0xE0, 0x9C, 0x00, 0x00, 0x7F, 0x81, 0xFF,
+0x90, 0x00, 0x82, 0xFF, 0x82, 0x00, 0x00, 0x81, 0x81, 0xFF, 0x87, 0x00, 0x82, 0xFF, 0x83, 0x00,
+0x82, 0xFF, 0x87, 0x00, 0x81, 0xFF, 0x00, 0x81, 0x82, 0x00, 0x82, 0xFF, 0x90, 0x00, 0x81, 0xFF,
+0x00, 0x7F, 0x9C, 0x00, 0x09, 0x03, 0x1F, 0x3F, 0x7F, 0xFC, 0xF8, 0xE0, 0xC0, 0xC0, 0x80, 0x89,
+0x00, 0x0B, 0x01, 0x07, 0x9F, 0xFF, 0xFE, 0xF8, 0xF8, 0xFE, 0xFF, 0x9F, 0x8F, 0x03, 0x88, 0x00,
+0x0A, 0x07, 0x9F, 0xFF, 0xFF, 0xFC, 0xF8, 0xFC, 0xFF, 0xFF, 0x9F, 0x07, 0x88, 0x00, 0x0B, 0x03,
+0x8F, 0x9F, 0xFF, 0xFE, 0xF8, 0xF8, 0xFE, 0xFF, 0x9F, 0x07, 0x01, 0x89, 0x00, 0x09, 0x80, 0xC0,
+0xC0, 0xE0, 0xF8, 0xFC, 0x7F, 0x3F, 0x1F, 0x03, 0xA2, 0x00, 0x04, 0x01, 0x03, 0x03, 0x07, 0x07,
+0x81, 0x0F, 0x84, 0x1E, 0x00, 0x1F, 0x81, 0x0F, 0x80, 0x07, 0x80, 0x03, 0x03, 0x01, 0x03, 0x07,
+0x07, 0x82, 0x0F, 0x84, 0x1E, 0x82, 0x0F, 0x06, 0x07, 0x03, 0x03, 0x01, 0x03, 0x03, 0x07, 0x82,
+0x0F, 0x84, 0x1E, 0x82, 0x0F, 0x80, 0x07, 0x05, 0x03, 0x01, 0x03, 0x03, 0x07, 0x07, 0x81, 0x0F,
+0x00, 0x1F, 0x84, 0x1E, 0x81, 0x0F, 0x80, 0x07, 0x80, 0x03, 0x00, 0x01, 0xB6, 0x00, 0x00, 0x20,
+0x83, 0xE0, 0x01, 0xC0, 0x80, 0xA1, 0x00, 0x01, 0x20, 0x60, 0x82, 0xE0, 0x01, 0xC0, 0x80, 0xC7,
+0x00, 0x10, 0xC0, 0xF0, 0xF8, 0xFC, 0xFF, 0x7F, 0x1F, 0x0F, 0x07, 0x1F, 0x7F, 0xFF, 0xFE, 0xFC,
+0xF0, 0xE0, 0x80, 0x82, 0x00, 0x83, 0xFC, 0x85, 0x00, 0x83, 0xFC, 0x07, 0x00, 0xC0, 0xF0, 0xF0,
+0xF8, 0xF8, 0x7C, 0x3C, 0x81, 0x1C, 0x00, 0x1D, 0x81, 0x1F, 0x07, 0x3F, 0xFF, 0xFE, 0xFC, 0xF8,
+0xE0, 0x00, 0x00, 0x83, 0xFC, 0xB7, 0x00, 0x06, 0x40, 0x70, 0x78, 0x7E, 0x7F, 0x7F, 0x1F, 0x81,
+0x0F, 0x85, 0x0E, 0x80, 0x0F, 0x0C, 0x1F, 0x3F, 0x7F, 0x7E, 0x7C, 0x78, 0x60, 0x4F, 0x1F, 0x3F,
+0x3F, 0x7F, 0x78, 0x83, 0x70, 0x80, 0x7F, 0x80, 0x3F, 0x0A, 0x1F, 0x07, 0x00, 0x07, 0x1F, 0x1F,
+0x3F, 0x3F, 0x7C, 0x78, 0x78, 0x83, 0x70, 0x80, 0x78, 0x81, 0x3F, 0x03, 0x1F, 0x07, 0x00, 0x00,
+0x83, 0x7F, 0x9E, 0x00,
@@ -1,64 +1,35 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x5f, 0xfe, 0x60, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x01, 0x01, 0x01, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-0x81, 0x01, 0x01, 0x01, 0x01, 0x02, 0xfd, 0xfe, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0xff, 0xff, 
-0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xb7, 0xff, 0xc0, 0xc0, 0xe0, 0xf0, 0xf8, 0xf8, 
-0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf6, 0xf6, 0xfc, 0xec, 
-0x4c, 0x28, 0x08, 0x18, 0x10, 0x30, 0x20, 0x9e, 0x03, 0x00, 0x0b, 0x25, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc1, 0xc1, 0xc1, 0xe3, 
-0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xc0, 0xfe, 0xff, 0x3f, 0x01, 0x00, 0x00, 0xc0, 0xfc, 0xc0, 0x00, 0x00, 0x01, 0x3f, 
-0xff, 0xfe, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xff, 0xff, 
-0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xea, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x7f, 0x7f, 
-0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xf7, 0xff, 0xf7, 
-0xf3, 0x70, 0x70, 0xb9, 0xb8, 0xb1, 0xbe, 0x38, 0x41, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x60, 0x60, 0x60, 0xe0, 
-0xe0, 0xc0, 0x00, 0x04, 0x0a, 0x1d, 0xfa, 0xf1, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xc0, 0xfc, 0xff, 0x7f, 0x03, 0x00, 0x00, 0xe0, 0xfe, 0x1f, 0x03, 0x1f, 0xfe, 0xe0, 0x00, 0x00, 
-0x03, 0x7f, 0xff, 0xfc, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x07, 0xe3, 0x81, 0x40, 0x80, 0x00, 0x00, 
-0x10, 0x20, 0x21, 0x21, 0x01, 0x03, 0xc1, 0xe3, 0xe7, 0xc3, 0x81, 0x0b, 0x03, 0x01, 0x05, 0x06, 
-0x02, 0x03, 0x21, 0x05, 0x00, 0x04, 0x00, 0x01, 0x08, 0x00, 0x01, 0x02, 0x00, 0x98, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfc, 
-0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x0e, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0e, 0x00, 
-0x00, 0x00, 0x0f, 0xff, 0xff, 0xfc, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x1f, 0x1f, 0xde, 0xdf, 0xde, 
-0xdc, 0xdc, 0xdc, 0xde, 0xde, 0xdf, 0xcf, 0xcf, 0xcf, 0x87, 0x82, 0xc1, 0xc2, 0x90, 0x90, 0x10, 
-0x40, 0x90, 0xc0, 0xc0, 0x90, 0x10, 0x10, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x06, 0x06, 0x06, 0x07, 
-0x07, 0x03, 0x00, 0x00, 0x00, 0x80, 0x7f, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 
-0x0f, 0x00, 0x00, 0x00, 0xf8, 0xfe, 0x7e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x7e, 0xfe, 
-0xf8, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x7f, 0xee, 0xd3, 0x97, 0x2f, 0x7c, 0x80, 0x03, 0x7f, 0xff, 
-0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfe, 0xf6, 0xe6, 0xe6, 0xf6, 0x62, 0xc0, 0x10, 0x00, 0x0d, 0x05, 
-0x0f, 0x18, 0x1f, 0x3b, 0xff, 0x1f, 0x00, 0x80, 0x30, 0x0c, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
-0x07, 0x07, 0x07, 0x07, 0x07, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 
-0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 
-0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xfb, 0xa5, 0xff, 0xff, 0xfc, 0xf0, 0xe1, 0xc0, 0x80, 
-0x04, 0x05, 0x09, 0x0b, 0x03, 0x13, 0x07, 0x03, 0x05, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x08, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x87, 0x00, 0x00, 0x80, 0x9D, 0x00, 0x00, 0xC0, 0x87, 0x00, 0x90, 0xC0, 0x00, 0x80, 0x8D, 0x00,
+0x89, 0xC0, 0x86, 0x00, 0x94, 0xC0, 0x87, 0x00, 0x02, 0xC0, 0xFC, 0xFF, 0x9C, 0x00, 0x03, 0xF0,
+0x5F, 0xFE, 0x60, 0x85, 0x00, 0x81, 0xFF, 0x82, 0x01, 0x85, 0x81, 0x82, 0x01, 0x03, 0x02, 0xFD,
+0xFE, 0xFC, 0x89, 0x00, 0x03, 0xE0, 0xFF, 0xFF, 0x1F, 0x83, 0x01, 0x03, 0x1F, 0xFF, 0xFF, 0xE0,
+0x85, 0x00, 0x81, 0xFF, 0x8E, 0x01, 0x81, 0xFF, 0x87, 0x00, 0x08, 0x4A, 0xB7, 0xFF, 0xC0, 0xC0,
+0xE0, 0xF0, 0xF8, 0xF8, 0x81, 0xFC, 0x87, 0xFE, 0x80, 0xF6, 0x0D, 0xFC, 0xEC, 0x4C, 0x28, 0x08,
+0x18, 0x10, 0x30, 0x20, 0x9E, 0x03, 0x00, 0x0B, 0x25, 0x85, 0x00, 0x81, 0xFF, 0x82, 0x00, 0x80,
+0xFF, 0x81, 0xC1, 0x02, 0xE3, 0xFF, 0x7F, 0x82, 0x00, 0x81, 0xFF, 0x87, 0x00, 0x10, 0xC0, 0xFE,
+0xFF, 0x3F, 0x01, 0x00, 0x00, 0xC0, 0xFC, 0xC0, 0x00, 0x00, 0x01, 0x3F, 0xFF, 0xFE, 0xC0, 0x83,
+0x00, 0x84, 0x07, 0x81, 0xFF, 0x82, 0x00, 0x81, 0xFF, 0x84, 0x07, 0x85, 0x00, 0x02, 0x80, 0xEA,
+0xFD, 0x82, 0xFF, 0x82, 0x7F, 0x01, 0xFF, 0xDF, 0x86, 0xFF, 0x10, 0x5F, 0xFF, 0xFF, 0xF7, 0xFF,
+0xF7, 0xF3, 0x70, 0x70, 0xB9, 0xB8, 0xB1, 0xBE, 0x38, 0x41, 0x00, 0x04, 0x86, 0x00, 0x81, 0xFF,
+0x82, 0x00, 0x80, 0xE0, 0x81, 0x60, 0x80, 0xE0, 0x07, 0xC0, 0x00, 0x04, 0x0A, 0x1D, 0xFA, 0xF1,
+0xE0, 0x85, 0x00, 0x14, 0xC0, 0xFC, 0xFF, 0x7F, 0x03, 0x00, 0x00, 0xE0, 0xFE, 0x1F, 0x03, 0x1F,
+0xFE, 0xE0, 0x00, 0x00, 0x03, 0x7F, 0xFF, 0xFC, 0xC0, 0x87, 0x00, 0x81, 0xFF, 0x82, 0x00, 0x81,
+0xFF, 0x8B, 0x00, 0x82, 0xFF, 0x24, 0x07, 0xE3, 0x81, 0x40, 0x80, 0x00, 0x00, 0x10, 0x20, 0x21,
+0x21, 0x01, 0x03, 0xC1, 0xE3, 0xE7, 0xC3, 0x81, 0x0B, 0x03, 0x01, 0x05, 0x06, 0x02, 0x03, 0x21,
+0x05, 0x00, 0x04, 0x00, 0x01, 0x08, 0x00, 0x01, 0x02, 0x00, 0x98, 0x83, 0x00, 0x81, 0xFF, 0x82,
+0x00, 0x80, 0xFF, 0x82, 0x00, 0x80, 0xFF, 0x82, 0x00, 0x81, 0xFF, 0x83, 0x00, 0x04, 0xC0, 0xFC,
+0xFF, 0xFF, 0x0F, 0x81, 0x00, 0x01, 0x0E, 0x0F, 0x83, 0x0C, 0x01, 0x0F, 0x0E, 0x81, 0x00, 0x04,
+0x0F, 0xFF, 0xFF, 0xFC, 0xC0, 0x85, 0x00, 0x81, 0xFF, 0x82, 0x00, 0x81, 0xFF, 0x8B, 0x00, 0x83,
+0xFF, 0x05, 0x8D, 0x1F, 0x1F, 0xDE, 0xDF, 0xDE, 0x81, 0xDC, 0x80, 0xDE, 0x00, 0xDF, 0x81, 0xCF,
+0x0E, 0x87, 0x82, 0xC1, 0xC2, 0x90, 0x90, 0x10, 0x40, 0x90, 0xC0, 0xC0, 0x90, 0x10, 0x10, 0xB8,
+0x89, 0x00, 0x81, 0xFF, 0x82, 0x00, 0x80, 0x07, 0x81, 0x06, 0x80, 0x07, 0x00, 0x03, 0x81, 0x00,
+0x03, 0x80, 0x7F, 0xFF, 0x7F, 0x82, 0x00, 0x03, 0xF8, 0xFF, 0xFF, 0x0F, 0x81, 0x00, 0x02, 0xF8,
+0xFE, 0x7E, 0x85, 0x0E, 0x02, 0x7E, 0xFE, 0xF8, 0x81, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xF8, 0x84,
+0x00, 0x81, 0xFF, 0x82, 0x00, 0x81, 0xFF, 0x8B, 0x00, 0x09, 0x0F, 0x7F, 0xEE, 0xD3, 0x97, 0x2F,
+0x7C, 0x80, 0x03, 0x7F, 0x81, 0xFF, 0x81, 0xFD, 0x16, 0xFE, 0xF6, 0xE6, 0xE6, 0xF6, 0x62, 0xC0,
+0x10, 0x00, 0x0D, 0x05, 0x0F, 0x18, 0x1F, 0x3B, 0xFF, 0x1F, 0x00, 0x80, 0x30, 0x0C, 0x01, 0x04,
+0x85, 0x00, 0x90, 0x07, 0x01, 0x02, 0x01, 0x84, 0x00, 0x87, 0x07, 0x87, 0x00, 0x87, 0x07, 0x84,
+0x00, 0x88, 0x07, 0x8C, 0x00, 0x14, 0xE1, 0xFB, 0xA5, 0xFF, 0xFF, 0xFC, 0xF0, 0xE1, 0xC0, 0x80,
+0x04, 0x05, 0x09, 0x0B, 0x03, 0x13, 0x07, 0x03, 0x05, 0x03, 0x05, 0x8A, 0x00, 0x04, 0x01, 0x00,
+0x00, 0x06, 0x08, 0xD2, 0x00,
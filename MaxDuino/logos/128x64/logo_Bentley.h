@@ -1,64 +1,28 @@
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x80,0x80,
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-0x80,0x80,0x80,0x80,0x80,0xC0,0xC0,0xC0,0xE0,0x60,0x60,0x60,0x60,0x70,0x30,0x30,
-0x30,0x70,0x60,0x60,0x60,0x60,0xE0,0xC0,0xC0,0x40,0x80,0x80,0x80,0x80,0x80,0x80,
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-0x80,0x80,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,
-0x00,0x00,0x00,0x03,0x06,0x0C,0x3C,0x78,0xC8,0x98,0x98,0x98,0x98,0x98,0x98,0x98,
-0x98,0x98,0x98,0x98,0x98,0x98,0x88,0xC8,0x49,0x49,0x49,0x49,0x49,0x48,0x4A,0x0A,
-0x2A,0x3C,0xF4,0xC0,0x00,0x00,0x3C,0x74,0xC0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
-0x08,0x30,0x80,0x40,0x20,0x91,0xCC,0xC0,0xE0,0xE0,0xE0,0xF0,0xF0,0xF0,0xF0,0xF0,
-0xF0,0xF0,0xF0,0xF0,0xE0,0xE0,0xE0,0xC0,0xC0,0x8D,0x01,0x00,0x40,0x00,0x10,0x08,
-0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE0,0x3C,0x2C,0x00,0x00,0xC0,0xF4,0x2C,0x2A,
-0x4A,0x4A,0x49,0x49,0x49,0x49,0x49,0x49,0xC8,0x88,0x98,0x98,0x98,0x98,0x98,0x98,
-0x98,0x98,0x98,0x98,0x98,0x98,0xC8,0x48,0x78,0x3C,0x04,0x07,0x03,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x07,0x04,0x1C,0x38,0x38,
-0x68,0x4C,0xCC,0xCC,0xC4,0x44,0x44,0x64,0x24,0x22,0x22,0x32,0x12,0x12,0x91,0x89,
-0xC9,0x49,0x4C,0x25,0x27,0x14,0x98,0xB8,0x61,0x65,0xC3,0xC6,0x84,0x8C,0x0C,0x9E,
-0xF9,0xFC,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFB,0x01,0x00,0x00,0x00,0x78,0xFC,0xFC,
-0xFC,0x78,0x00,0x00,0x01,0x03,0xC7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xFD,0xF8,0xFA,
-0x1C,0x08,0x8C,0x86,0xCE,0xC3,0x65,0x61,0x98,0x98,0x14,0x27,0x25,0x48,0x49,0x89,
-0x99,0x91,0x12,0x12,0x32,0x22,0x22,0x24,0x64,0x44,0x44,0xC4,0xCC,0x4C,0x6C,0x68,
-0x38,0x38,0x0C,0x04,0x07,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x01,0x01,0x03,0x02,0x02,0x06,0x0E,0x0A,0x0B,0x09,0x09,0x18,0x38,
-0x24,0x24,0x22,0x32,0x31,0x79,0x48,0x64,0x22,0x73,0xD9,0xCD,0x67,0x73,0x8B,0x8F,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x00,0x00,0x00,0x00,0x70,0xF8,0xFC,
-0xFC,0xF8,0x30,0x00,0x00,0x03,0x07,0x8F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0xCF,
-0x87,0xDB,0x73,0x67,0xC9,0xD1,0x73,0x26,0x64,0x48,0x79,0x30,0x32,0x20,0x24,0x24,
-0x38,0x18,0x09,0x09,0x0B,0x0A,0x0E,0x06,0x02,0x02,0x03,0x01,0x01,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0F,0x1C,0x78,0xE0,0xC0,
-0x80,0x00,0x03,0x07,0x0F,0x0F,0x1F,0x9F,0x7E,0x3C,0xFC,0x78,0xF8,0x78,0xF8,0x78,
-0xF8,0x78,0xF8,0x7C,0x7C,0x3E,0x7E,0x9F,0x1F,0x0F,0x0F,0x07,0x03,0x01,0x80,0xC0,
-0xE0,0x78,0x3C,0x0F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0x03,0x03,0x06,0x0E,0x0C,0x1C,0x22,0x21,0x38,0x47,0x40,0x7C,0x01,0x40,0x7F,0x80,
-0x4F,0x40,0x00,0x7C,0x60,0x43,0x38,0x21,0x22,0x1C,0x0C,0x0E,0x06,0x03,0x03,0x01,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xFF, 0x00, 0x80, 0x00, 0x96, 0x80, 0x81, 0x00, 0x95, 0x80, 0x81, 0xC0, 0x00, 0xE0, 0x82, 0x60,
+0x00, 0x70, 0x81, 0x30, 0x00, 0x70, 0x82, 0x60, 0x03, 0xE0, 0xC0, 0xC0, 0x40, 0x96, 0x80, 0x80,
+0x00, 0x97, 0x80, 0x84, 0x00, 0x05, 0x03, 0x06, 0x0C, 0x3C, 0x78, 0xC8, 0x8B, 0x98, 0x01, 0x88,
+0xC8, 0x83, 0x49, 0x0C, 0x48, 0x4A, 0x0A, 0x2A, 0x3C, 0xF4, 0xC0, 0x00, 0x00, 0x3C, 0x74, 0xC0,
+0x80, 0x84, 0x00, 0x07, 0x08, 0x30, 0x80, 0x40, 0x20, 0x91, 0xCC, 0xC0, 0x81, 0xE0, 0x87, 0xF0,
+0x81, 0xE0, 0x80, 0xC0, 0x06, 0x8D, 0x01, 0x00, 0x40, 0x00, 0x10, 0x08, 0x84, 0x00, 0x0B, 0x80,
+0xE0, 0x3C, 0x2C, 0x00, 0x00, 0xC0, 0xF4, 0x2C, 0x2A, 0x4A, 0x4A, 0x84, 0x49, 0x01, 0xC8, 0x88,
+0x8A, 0x98, 0x06, 0xC8, 0x48, 0x78, 0x3C, 0x04, 0x07, 0x03, 0x8A, 0x00, 0x2A, 0x01, 0x03, 0x07,
+0x04, 0x1C, 0x38, 0x38, 0x68, 0x4C, 0xCC, 0xCC, 0xC4, 0x44, 0x44, 0x64, 0x24, 0x22, 0x22, 0x32,
+0x12, 0x12, 0x91, 0x89, 0xC9, 0x49, 0x4C, 0x25, 0x27, 0x14, 0x98, 0xB8, 0x61, 0x65, 0xC3, 0xC6,
+0x84, 0x8C, 0x0C, 0x9E, 0xF9, 0xFC, 0xFF, 0xFE, 0x82, 0xFF, 0x01, 0xFB, 0x01, 0x81, 0x00, 0x00,
+0x78, 0x81, 0xFC, 0x05, 0x78, 0x00, 0x00, 0x01, 0x03, 0xC7, 0x83, 0xFF, 0x2A, 0xFC, 0xFD, 0xF8,
+0xFA, 0x1C, 0x08, 0x8C, 0x86, 0xCE, 0xC3, 0x65, 0x61, 0x98, 0x98, 0x14, 0x27, 0x25, 0x48, 0x49,
+0x89, 0x99, 0x91, 0x12, 0x12, 0x32, 0x22, 0x22, 0x24, 0x64, 0x44, 0x44, 0xC4, 0xCC, 0x4C, 0x6C,
+0x68, 0x38, 0x38, 0x0C, 0x04, 0x07, 0x03, 0x01, 0x9A, 0x00, 0x80, 0x01, 0x1A, 0x03, 0x02, 0x02,
+0x06, 0x0E, 0x0A, 0x0B, 0x09, 0x09, 0x18, 0x38, 0x24, 0x24, 0x22, 0x32, 0x31, 0x79, 0x48, 0x64,
+0x22, 0x73, 0xD9, 0xCD, 0x67, 0x73, 0x8B, 0x8F, 0x86, 0xFF, 0x00, 0x7F, 0x82, 0x00, 0x0A, 0x70,
+0xF8, 0xFC, 0xFC, 0xF8, 0x30, 0x00, 0x00, 0x03, 0x07, 0x8F, 0x84, 0xFF, 0x1E, 0x7F, 0xCF, 0x87,
+0xDB, 0x73, 0x67, 0xC9, 0xD1, 0x73, 0x26, 0x64, 0x48, 0x79, 0x30, 0x32, 0x20, 0x24, 0x24, 0x38,
+0x18, 0x09, 0x09, 0x0B, 0x0A, 0x0E, 0x06, 0x02, 0x02, 0x03, 0x01, 0x01, 0xBB, 0x00, 0x2A, 0x03,
+0x0F, 0x1C, 0x78, 0xE0, 0xC0, 0x80, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x9F, 0x7E, 0x3C, 0xFC,
+0x78, 0xF8, 0x78, 0xF8, 0x78, 0xF8, 0x78, 0xF8, 0x7C, 0x7C, 0x3E, 0x7E, 0x9F, 0x1F, 0x0F, 0x0F,
+0x07, 0x03, 0x01, 0x80, 0xC0, 0xE0, 0x78, 0x3C, 0x0F, 0x03, 0xD8, 0x00, 0x20, 0x01, 0x03, 0x03,
+0x06, 0x0E, 0x0C, 0x1C, 0x22, 0x21, 0x38, 0x47, 0x40, 0x7C, 0x01, 0x40, 0x7F, 0x80, 0x4F, 0x40,
+0x00, 0x7C, 0x60, 0x43, 0x38, 0x21, 0x22, 0x1C, 0x0C, 0x0E, 0x06, 0x03, 0x03, 0x01, 0xFF, 0x00,
+0xAD, 0x00,
@@ -1,64 +1,28 @@
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x0f, 0x07, 0x07, 0x83, 0xc1, 0xc1, 0xc0, 0xc0, 
-0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xc0, 0xc0, 0xc1, 0xc1, 0x83, 0x03, 0x07, 0x0f, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x1f, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 
-0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x0f, 0x03, 0xc0, 0xf0, 0xf8, 0xfc, 0xfe, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x03, 
-0x00, 0xc0, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 
-0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0x7f, 0xff, 0xff, 
-0xff, 0x07, 0x00, 0x00, 0x00, 0x7c, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 
-0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x1c, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 
-0x1f, 0x07, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x07, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 
-0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x07, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 
-0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf8, 
-0xfe, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x0f, 0x03, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x80, 0x00, 0x00, 0x00, 
-0x80, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
-0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 
-0x1f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0x00, 0xf8, 0xfe, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xf8, 0xf0, 0xf0, 0xf0, 0xf0, 0x70, 0x00, 0x00, 0x00, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
-0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x00, 0x00, 0x00, 
-0xff, 0xe0, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 
-0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3c, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 
-0xf8, 0xe0, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xc0, 0xc0, 0xc0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 
-0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x3f, 0x3f, 0x3f, 0x1f, 0x03, 0x00, 0x30, 0x3e, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 
-0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0xe0, 0xff, 
-0xff, 0xff, 0xff, 0xf8, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 
-0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf0, 0xc0, 0x03, 0x0f, 0x1f, 0x3f, 0x7f, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xc0, 
-0x00, 0x03, 0x0f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 
-0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf8, 0xfe, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf0, 0xe0, 0xe0, 0xc1, 0x81, 0x81, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x81, 0x81, 0xc1, 0xe0, 0xe0, 0xf0, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x84, 0xFF, 0x07, 0x7F, 0x3F, 0x0F, 0x07, 0x07, 0x83, 0xC1, 0xC1, 0x8C, 0xC0, 0x83, 0x00, 0x81,
+0x80, 0x8A, 0xC0, 0x83, 0x00, 0x80, 0x80, 0x8A, 0xC0, 0x80, 0x80, 0x93, 0x00, 0x84, 0xC0, 0x81,
+0x00, 0x8D, 0xC0, 0x80, 0xC1, 0x05, 0x83, 0x03, 0x07, 0x0F, 0x1F, 0x7F, 0x87, 0xFF, 0x02, 0x1F,
+0x03, 0x01, 0x82, 0x00, 0x00, 0x02, 0x8C, 0x1F, 0x06, 0x0F, 0x03, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE,
+0x8C, 0xFF, 0x05, 0x1F, 0x03, 0x00, 0xC0, 0xF8, 0xFE, 0x90, 0xFF, 0x02, 0xFE, 0xF8, 0xE0, 0x8B,
+0x00, 0x02, 0xC0, 0xF0, 0xFC, 0x85, 0xFF, 0x81, 0x00, 0x90, 0x1F, 0x00, 0x06, 0x83, 0x00, 0x02,
+0x03, 0x1F, 0x7F, 0x81, 0xFF, 0x00, 0x07, 0x81, 0x00, 0x00, 0x7C, 0x8E, 0xFC, 0x03, 0x1C, 0x00,
+0x00, 0xF8, 0x83, 0xFF, 0x02, 0x3F, 0x1F, 0x07, 0x81, 0x03, 0x86, 0x01, 0x82, 0x00, 0x83, 0xFF,
+0x01, 0x07, 0x03, 0x89, 0x01, 0x00, 0x07, 0x83, 0x1F, 0x00, 0x1C, 0x86, 0x00, 0x02, 0xC0, 0xF0,
+0xFC, 0x89, 0xFF, 0x81, 0x00, 0x96, 0xFC, 0x81, 0x00, 0x02, 0x07, 0xFF, 0x01, 0x81, 0x00, 0x90,
+0xE0, 0x80, 0x00, 0x84, 0xFF, 0x00, 0x01, 0x90, 0x00, 0x83, 0xFF, 0x80, 0xF8, 0x8A, 0xFC, 0x03,
+0xF8, 0xF0, 0xE0, 0xC0, 0x83, 0x00, 0x03, 0x80, 0xE0, 0xF8, 0xFE, 0x82, 0xFF, 0x04, 0x7F, 0x3F,
+0x0F, 0x03, 0x00, 0x84, 0xFF, 0x88, 0x00, 0x00, 0x80, 0x8F, 0xE0, 0x00, 0x80, 0x81, 0x00, 0x00,
+0x80, 0x81, 0x00, 0x90, 0x07, 0x80, 0x00, 0x84, 0xFF, 0x00, 0x80, 0x90, 0x00, 0x83, 0xFF, 0x00,
+0x7F, 0x8A, 0x1F, 0x00, 0x3F, 0x82, 0xFF, 0x04, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0x85, 0xFF, 0x00,
+0xF1, 0x83, 0xF0, 0x84, 0xFF, 0x00, 0xF8, 0x82, 0xF0, 0x00, 0x70, 0x81, 0x00, 0x00, 0x04, 0x90,
+0x07, 0x00, 0x01, 0x81, 0x00, 0x01, 0xFF, 0xE0, 0x81, 0x00, 0x8F, 0x3F, 0x03, 0x3C, 0x00, 0x00,
+0x0F, 0x83, 0xFF, 0x03, 0xFE, 0xF8, 0xE0, 0xE0, 0x88, 0xC0, 0x82, 0x00, 0x83, 0xFF, 0x00, 0xE0,
+0x8A, 0xC0, 0x00, 0xE0, 0x83, 0xFF, 0x01, 0x3F, 0x00, 0x8D, 0x3F, 0x84, 0xFF, 0x81, 0x3F, 0x04,
+0x1F, 0x03, 0x00, 0x30, 0x3E, 0x91, 0x3F, 0x81, 0x00, 0x00, 0xE0, 0x82, 0xFF, 0x02, 0xF8, 0xE0,
+0x80, 0x83, 0x00, 0x8C, 0xF8, 0x06, 0xF0, 0xC0, 0x03, 0x0F, 0x1F, 0x3F, 0x7F, 0x8C, 0xFF, 0x06,
+0xF8, 0xC0, 0x00, 0x03, 0x0F, 0x3F, 0x7F, 0x8F, 0xFF, 0x02, 0x3F, 0x1F, 0x03, 0x8F, 0x00, 0x84,
+0xFF, 0x81, 0x00, 0x90, 0xF8, 0x00, 0x60, 0x83, 0x00, 0x02, 0xC0, 0xF8, 0xFE, 0x86, 0xFF, 0x07,
+0xFE, 0xFC, 0xF0, 0xE0, 0xE0, 0xC1, 0x81, 0x81, 0x8C, 0x01, 0x84, 0x00, 0x8C, 0x01, 0x84, 0x00,
+0x8C, 0x01, 0x94, 0x00, 0x84, 0x01, 0x81, 0x00, 0x8D, 0x01, 0x80, 0x81, 0x05, 0xC1, 0xE0, 0xE0,
+0xF0, 0xFC, 0xFE, 0x84, 0xFF,
@@ -1,64 +1,58 @@
-0x15, 0x2a, 0x45, 0x2a, 0x15, 0x2a, 0x45, 0x2f, 0x57, 0x2f, 0x17, 0x2f, 0x5f, 0x2f, 0x55, 0x2a, 
-0x55, 0x2a, 0x15, 0x00, 0x07, 0x2f, 0x17, 0x2f, 0x57, 0x2f, 0x57, 0x2f, 0x57, 0x2f, 0x5f, 0xaf, 
-0x57, 0x2f, 0x5f, 0x2f, 0x7f, 0x2f, 0x5f, 0x37, 0x5b, 0x3f, 0x15, 0xca, 0xc5, 0xe0, 0xef, 0xe7, 
-0xf7, 0xf7, 0xf3, 0xfb, 0xfb, 0xfb, 0xf9, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfd, 0xfc, 
-0xfd, 0xfc, 0xfd, 0xf8, 0xf9, 0xf8, 0xf9, 0xf2, 0xf5, 0xf2, 0xe5, 0xe0, 0xe1, 0xcb, 0x11, 0x2b, 
-0x45, 0x2b, 0x17, 0x2b, 0x57, 0x3f, 0x57, 0x3b, 0x5f, 0x3f, 0x57, 0x2f, 0x57, 0x23, 0x55, 0x2e, 
-0x5d, 0x2a, 0x15, 0x2a, 0x15, 0x02, 0x00, 0x0a, 0x1d, 0x3f, 0x1f, 0x2f, 0x5f, 0x3f, 0x57, 0x2f, 
-0x5f, 0x2f, 0x7f, 0x37, 0x5f, 0x2f, 0x55, 0x2b, 0x55, 0x2a, 0x55, 0x2a, 0x01, 0xa8, 0x55, 0xbf, 
-0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x7e, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xfd, 
-0xfd, 0xf9, 0xfb, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xaa, 0xfd, 0xaa, 0x55, 0xaa, 
-0x00, 0x7f, 0x3f, 0x9f, 0xcf, 0xe7, 0xf7, 0xf3, 0xfb, 0xf9, 0xfc, 0xf8, 0xe3, 0x8f, 0x3f, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 
-0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1f, 0xc7, 0xf1, 0xfc, 0xfc, 0xfd, 
-0xf9, 0xfb, 0xf3, 0xf7, 0xe7, 0xca, 0x96, 0x2a, 0x54, 0x00, 0x7c, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-0xfe, 0xfe, 0xfe, 0xfc, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xbe, 0xd5, 0xbe, 
-0x56, 0xaa, 0x50, 0x00, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xfa, 0x55, 0xaa, 0x00, 0x2a, 0x54, 0xa8, 
-0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x5f, 0xaf, 0x57, 0x2a, 0x85, 0xe2, 0xf1, 0xf8, 
-0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0xbf, 0x5f, 0x0f, 0x4e, 0x84, 
-0x51, 0x23, 0x4b, 0x13, 0xa9, 0x55, 0xa9, 0x54, 0xaa, 0x54, 0xaa, 0x54, 0xaa, 0x54, 0xaa, 0x54, 
-0xaa, 0x50, 0xa1, 0x54, 0xa1, 0x02, 0x89, 0x42, 0xa1, 0x54, 0xaf, 0x5f, 0x9f, 0x3f, 0x7f, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf9, 0xf2, 0x65, 0x0b, 0x95, 0x8b, 
-0x17, 0x2f, 0x5f, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xef, 0xfd, 0xaa, 
-0x55, 0xaa, 0x55, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xab, 0x55, 0x0a, 0x83, 0xf0, 0xe9, 0xf2, 
-0x55, 0x22, 0x55, 0x08, 0x55, 0x22, 0x17, 0x2b, 0x57, 0x2b, 0x55, 0x2b, 0x5d, 0x3b, 0x55, 0xaf, 
-0x57, 0xab, 0x55, 0x2b, 0x55, 0x0a, 0xc1, 0xf8, 0xfd, 0xfc, 0xf8, 0xfa, 0xf3, 0xf7, 0xe7, 0xef, 
-0xcf, 0xdf, 0x1f, 0x3f, 0x1f, 0x27, 0x53, 0x89, 0x54, 0x22, 0x55, 0x08, 0x15, 0x02, 0x05, 0x00, 
-0x05, 0x02, 0x01, 0x00, 0x00, 0x41, 0xa8, 0xf4, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x54, 
-0xfa, 0x54, 0xa0, 0x00, 0xa0, 0x01, 0x00, 0x01, 0x02, 0x05, 0x0a, 0x15, 0x0a, 0x15, 0x2a, 0x54, 
-0xa9, 0x53, 0x27, 0x4f, 0x9f, 0x4f, 0xe7, 0xf7, 0xf3, 0xfb, 0xf9, 0xfc, 0xfe, 0xff, 0xff, 0xff, 
-0xff, 0xfe, 0xf8, 0xc0, 0x05, 0x2a, 0x55, 0x2f, 0x57, 0x3f, 0x57, 0x2b, 0x55, 0x2b, 0x15, 0x2e, 
-0x15, 0x4a, 0x01, 0x2a, 0x00, 0x1f, 0x3f, 0x2b, 0x51, 0x0a, 0x55, 0x00, 0xaf, 0x7f, 0xff, 0xff, 
-0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 
-0xfe, 0xfe, 0xfe, 0x0f, 0xe0, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 
-0x57, 0x02, 0x51, 0x88, 0x55, 0x22, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0xa8, 0x00, 
-0xaa, 0x00, 0x00, 0x00, 0x00, 0x55, 0xfe, 0xff, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x55, 
-0xff, 0xfd, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x54, 0xea, 0x54, 0x20, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x02, 0x15, 0xaa, 0x54, 0xa1, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0x05, 0xaa, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xba, 0x55, 0xaa, 0x50, 0x00, 0xaa, 0xd5, 0x6e, 0xd7, 
-0x55, 0xaa, 0x55, 0xaa, 0x55, 0xae, 0x5d, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xcf, 
-0xb7, 0xf3, 0x79, 0x00, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xbf, 0x57, 0xaa, 
-0x00, 0x22, 0x55, 0x88, 0x55, 0x00, 0x14, 0x2e, 0x06, 0x2e, 0x00, 0x50, 0xaa, 0xfd, 0xaa, 0x00, 
-0xaa, 0x06, 0x2e, 0x06, 0x00, 0x55, 0xff, 0xff, 0xaa, 0x00, 0xaa, 0x06, 0x2e, 0x06, 0x00, 0x55, 
-0xff, 0xff, 0xaa, 0x00, 0xaa, 0x06, 0x2e, 0x06, 0x00, 0x55, 0xff, 0xf5, 0xaa, 0x00, 0xaa, 0x00, 
-0x0a, 0x26, 0x0a, 0x24, 0x00, 0x55, 0xaa, 0x55, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xaa, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x7f, 0xad, 0x7f, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x11, 0xb2, 0xf9, 0xfb, 
-0x15, 0xaa, 0x15, 0xaa, 0x15, 0x2a, 0x15, 0x2a, 0x17, 0x2b, 0x17, 0x2f, 0x17, 0x8f, 0x97, 0xab, 
-0x17, 0x3b, 0x95, 0xaa, 0x00, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xd4, 0xaa, 
-0x00, 0x20, 0x55, 0x88, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xff, 0xff, 0xaa, 0x00, 
-0xaa, 0x00, 0x00, 0x00, 0x00, 0x55, 0xff, 0xff, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x55, 
-0xff, 0xff, 0xaa, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x55, 0xff, 0xff, 0xaa, 0x00, 0xaa, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xa8, 0x55, 0x23, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 
-0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x2a, 0x94, 0xae, 0x95, 0xab, 0x95, 0xaf, 0x9f, 0xaf, 0x9d, 0x2a, 
-0x17, 0xaa, 0x1d, 0x2f, 0x17, 0x2a, 0x95, 0xaa, 0x95, 0xaa, 0x05, 0x00, 0x55, 0xfa, 0xf7, 0xff, 
-0x11, 0xaa, 0x44, 0xaa, 0x11, 0x00, 0x55, 0x2a, 0x00, 0x7e, 0xff, 0xff, 0xdf, 0xbf, 0xbf, 0x3f, 
-0x7f, 0x7f, 0xaf, 0x55, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 
-0x00, 0x22, 0x55, 0x88, 0x55, 0x00, 0x0a, 0x17, 0x03, 0x17, 0x00, 0x55, 0xff, 0xff, 0xaa, 0x00, 
-0xaa, 0x15, 0x03, 0x15, 0x00, 0x55, 0xff, 0xff, 0xaa, 0x00, 0xaa, 0x15, 0x03, 0x15, 0x00, 0x55, 
-0xff, 0xff, 0xaa, 0x00, 0xaa, 0x15, 0x03, 0x15, 0x00, 0x55, 0xff, 0xff, 0xaa, 0x00, 0xaa, 0x00, 
-0x01, 0x17, 0x03, 0x15, 0x00, 0x55, 0xaa, 0x55, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x55, 0x82, 0x57, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0x57, 0xae, 
-0x5d, 0xba, 0x57, 0xaa, 0x00, 0x7f, 0xff, 0xff, 0x5f, 0xaa, 0x55, 0x00, 0x56, 0xab, 0x5d, 0xbd
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x32, 0x15, 0x2A, 0x45, 0x2A, 0x15, 0x2A, 0x45, 0x2F, 0x57, 0x2F, 0x17, 0x2F, 0x5F, 0x2F, 0x55,
+0x2A, 0x55, 0x2A, 0x15, 0x00, 0x07, 0x2F, 0x17, 0x2F, 0x57, 0x2F, 0x57, 0x2F, 0x57, 0x2F, 0x5F,
+0xAF, 0x57, 0x2F, 0x5F, 0x2F, 0x7F, 0x2F, 0x5F, 0x37, 0x5B, 0x3F, 0x15, 0xCA, 0xC5, 0xE0, 0xEF,
+0xE7, 0xF7, 0xF7, 0xF3, 0x81, 0xFB, 0x00, 0xF9, 0x84, 0xFD, 0x4A, 0xFC, 0xFD, 0xFC, 0xFD, 0xFC,
+0xFD, 0xF8, 0xF9, 0xF8, 0xF9, 0xF2, 0xF5, 0xF2, 0xE5, 0xE0, 0xE1, 0xCB, 0x11, 0x2B, 0x45, 0x2B,
+0x17, 0x2B, 0x57, 0x3F, 0x57, 0x3B, 0x5F, 0x3F, 0x57, 0x2F, 0x57, 0x23, 0x55, 0x2E, 0x5D, 0x2A,
+0x15, 0x2A, 0x15, 0x02, 0x00, 0x0A, 0x1D, 0x3F, 0x1F, 0x2F, 0x5F, 0x3F, 0x57, 0x2F, 0x5F, 0x2F,
+0x7F, 0x37, 0x5F, 0x2F, 0x55, 0x2B, 0x55, 0x2A, 0x55, 0x2A, 0x01, 0xA8, 0x55, 0xBF, 0x55, 0xAA,
+0x55, 0xAA, 0x55, 0xAA, 0x7E, 0xFF, 0x82, 0xFE, 0x81, 0xFC, 0x80, 0xFD, 0x02, 0xF9, 0xFB, 0xF7,
+0x84, 0xFF, 0x14, 0xDF, 0xAA, 0xFD, 0xAA, 0x55, 0xAA, 0x00, 0x7F, 0x3F, 0x9F, 0xCF, 0xE7, 0xF7,
+0xF3, 0xFB, 0xF9, 0xFC, 0xF8, 0xE3, 0x8F, 0x3F, 0x87, 0xFF, 0x0C, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F,
+0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x82, 0xFF, 0x13, 0x7F, 0x1F, 0xC7, 0xF1, 0xFC,
+0xFC, 0xFD, 0xF9, 0xFB, 0xF3, 0xF7, 0xE7, 0xCA, 0x96, 0x2A, 0x54, 0x00, 0x7C, 0xFE, 0xFE, 0x81,
+0xFF, 0x81, 0xFE, 0x02, 0xFC, 0xFD, 0xFB, 0x84, 0xFF, 0x1A, 0xD5, 0xBE, 0xD5, 0xBE, 0x56, 0xAA,
+0x50, 0x00, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0xFA, 0x55, 0xAA, 0x00, 0x2A, 0x54, 0xA8, 0x55, 0xAA,
+0x55, 0xAA, 0x55, 0xAA, 0x55, 0x89, 0xFF, 0x00, 0x7F, 0x82, 0xFF, 0x0A, 0xBF, 0x5F, 0xAF, 0x57,
+0x2A, 0x85, 0xE2, 0xF1, 0xF8, 0xFC, 0xFE, 0x85, 0xFF, 0x25, 0x7F, 0x3F, 0xBF, 0x5F, 0x0F, 0x4E,
+0x84, 0x51, 0x23, 0x4B, 0x13, 0xA9, 0x55, 0xA9, 0x54, 0xAA, 0x54, 0xAA, 0x54, 0xAA, 0x54, 0xAA,
+0x54, 0xAA, 0x50, 0xA1, 0x54, 0xA1, 0x02, 0x89, 0x42, 0xA1, 0x54, 0xAF, 0x5F, 0x9F, 0x3F, 0x7F,
+0x87, 0xFF, 0x0B, 0xFE, 0xFC, 0xF9, 0xF2, 0x65, 0x0B, 0x95, 0x8B, 0x17, 0x2F, 0x5F, 0xBF, 0x86,
+0xFF, 0x08, 0x75, 0xEF, 0xFD, 0xAA, 0x55, 0xAA, 0x55, 0x00, 0x3F, 0x82, 0xFF, 0x41, 0xAB, 0x55,
+0x0A, 0x83, 0xF0, 0xE9, 0xF2, 0x55, 0x22, 0x55, 0x08, 0x55, 0x22, 0x17, 0x2B, 0x57, 0x2B, 0x55,
+0x2B, 0x5D, 0x3B, 0x55, 0xAF, 0x57, 0xAB, 0x55, 0x2B, 0x55, 0x0A, 0xC1, 0xF8, 0xFD, 0xFC, 0xF8,
+0xFA, 0xF3, 0xF7, 0xE7, 0xEF, 0xCF, 0xDF, 0x1F, 0x3F, 0x1F, 0x27, 0x53, 0x89, 0x54, 0x22, 0x55,
+0x08, 0x15, 0x02, 0x05, 0x00, 0x05, 0x02, 0x01, 0x00, 0x00, 0x41, 0xA8, 0xF4, 0xAA, 0x00, 0xAA,
+0x82, 0x00, 0x1D, 0x54, 0xFA, 0x54, 0xA0, 0x00, 0xA0, 0x01, 0x00, 0x01, 0x02, 0x05, 0x0A, 0x15,
+0x0A, 0x15, 0x2A, 0x54, 0xA9, 0x53, 0x27, 0x4F, 0x9F, 0x4F, 0xE7, 0xF7, 0xF3, 0xFB, 0xF9, 0xFC,
+0xFE, 0x82, 0xFF, 0x26, 0xFE, 0xF8, 0xC0, 0x05, 0x2A, 0x55, 0x2F, 0x57, 0x3F, 0x57, 0x2B, 0x55,
+0x2B, 0x15, 0x2E, 0x15, 0x4A, 0x01, 0x2A, 0x00, 0x1F, 0x3F, 0x2B, 0x51, 0x0A, 0x55, 0x00, 0xAF,
+0x7F, 0xFF, 0xFF, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xFA, 0x83, 0xFF, 0x84, 0xFE, 0x02,
+0x0F, 0xE0, 0xFE, 0x87, 0xFF, 0x09, 0xBF, 0x57, 0x02, 0x51, 0x88, 0x55, 0x22, 0x05, 0x00, 0x01,
+0x82, 0x00, 0x03, 0x40, 0xA8, 0x00, 0xAA, 0x82, 0x00, 0x05, 0x55, 0xFE, 0xFF, 0xAA, 0x00, 0xAA,
+0x82, 0x00, 0x05, 0x55, 0xFF, 0xFD, 0xAA, 0x00, 0xAA, 0x82, 0x00, 0x03, 0x54, 0xEA, 0x54, 0x20,
+0x83, 0x00, 0x05, 0x02, 0x15, 0xAA, 0x54, 0xA1, 0x0F, 0x8A, 0xFF, 0x04, 0xFE, 0xE0, 0x05, 0xAA,
+0x57, 0x8A, 0xFF, 0x12, 0xFB, 0xF0, 0xBA, 0x55, 0xAA, 0x50, 0x00, 0xAA, 0xD5, 0x6E, 0xD7, 0x55,
+0xAA, 0x55, 0xAA, 0x55, 0xAE, 0x5D, 0xEA, 0x84, 0xFF, 0x05, 0xBF, 0xCF, 0xB7, 0xF3, 0x79, 0x00,
+0x82, 0xFF, 0x40, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0xBF, 0x57, 0xAA, 0x00, 0x22, 0x55, 0x88, 0x55,
+0x00, 0x14, 0x2E, 0x06, 0x2E, 0x00, 0x50, 0xAA, 0xFD, 0xAA, 0x00, 0xAA, 0x06, 0x2E, 0x06, 0x00,
+0x55, 0xFF, 0xFF, 0xAA, 0x00, 0xAA, 0x06, 0x2E, 0x06, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0xAA,
+0x06, 0x2E, 0x06, 0x00, 0x55, 0xFF, 0xF5, 0xAA, 0x00, 0xAA, 0x00, 0x0A, 0x26, 0x0A, 0x24, 0x00,
+0x55, 0xAA, 0x55, 0x8A, 0x8B, 0xFF, 0x02, 0x00, 0xAA, 0x55, 0x89, 0xFF, 0x20, 0x7F, 0xAD, 0x7F,
+0xAA, 0x55, 0xAA, 0x55, 0x00, 0x11, 0xB2, 0xF9, 0xFB, 0x15, 0xAA, 0x15, 0xAA, 0x15, 0x2A, 0x15,
+0x2A, 0x17, 0x2B, 0x17, 0x2F, 0x17, 0x8F, 0x97, 0xAB, 0x17, 0x3B, 0x95, 0xAA, 0x00, 0x87, 0xFE,
+0x06, 0xD4, 0xAA, 0x00, 0x20, 0x55, 0x88, 0x51, 0x84, 0x00, 0x05, 0x55, 0xFF, 0xFF, 0xAA, 0x00,
+0xAA, 0x82, 0x00, 0x05, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0xAA, 0x82, 0x00, 0x05, 0x55, 0xFF, 0xFF,
+0xAA, 0x00, 0xAA, 0x82, 0x00, 0x05, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0xAA, 0x84, 0x00, 0x03, 0x51,
+0xA8, 0x55, 0x23, 0x89, 0xFE, 0x30, 0x00, 0x2A, 0x94, 0xAE, 0x95, 0xAB, 0x95, 0xAF, 0x9F, 0xAF,
+0x9D, 0x2A, 0x17, 0xAA, 0x1D, 0x2F, 0x17, 0x2A, 0x95, 0xAA, 0x95, 0xAA, 0x05, 0x00, 0x55, 0xFA,
+0xF7, 0xFF, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0x00, 0x55, 0x2A, 0x00, 0x7E, 0xFF, 0xFF, 0xDF, 0xBF,
+0xBF, 0x3F, 0x7F, 0x7F, 0xAF, 0x55, 0x00, 0x88, 0xFF, 0x39, 0xAA, 0x00, 0x22, 0x55, 0x88, 0x55,
+0x00, 0x0A, 0x17, 0x03, 0x17, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0xAA, 0x15, 0x03, 0x15, 0x00,
+0x55, 0xFF, 0xFF, 0xAA, 0x00, 0xAA, 0x15, 0x03, 0x15, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0xAA,
+0x15, 0x03, 0x15, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0xAA, 0x00, 0x01, 0x17, 0x03, 0x15, 0x00,
+0x55, 0xAA, 0x55, 0x2A, 0x89, 0xFF, 0x03, 0x00, 0x55, 0x82, 0x57, 0x82, 0xFF, 0x13, 0x7F, 0xFF,
+0x57, 0xAE, 0x5D, 0xBA, 0x57, 0xAA, 0x00, 0x7F, 0xFF, 0xFF, 0x5F, 0xAA, 0x55, 0x00, 0x56, 0xAB,
+0x5D, 0xBD,
@@ -1,64 +1,26 @@
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 
-0xff, 0xff, 0x07, 0x03, 0x03, 0x03, 0x03, 0x01, 0x81, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0f, 
-0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf3, 0xe3, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 
-0x03, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0f, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xfc, 0xfe, 0xfe, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0xc0, 0xe0, 0xe0, 0xc0, 0x80, 
-0x80, 0x80, 0xc0, 0xe0, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0xfe, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x9c, 
-0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xec, 0xc8, 0xc8, 0xc8, 0xc8, 0xcc, 0xcf, 0xc4, 
-0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x3f, 0x3f, 0x3f, 0x1f, 0x1f, 0x1f, 0x0f, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x80, 0x00, 0x1c, 0x7f, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfe, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xf8, 0xf8, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7c, 0x3c, 0x3c, 0x7c, 
-0x7c, 0x71, 0xc7, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x07, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xe1, 0xc3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7f, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xf0, 
-0xf0, 0xf8, 0xf8, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf8, 0xfc, 0xf8, 0x08, 0xf8, 0xfc, 
-0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0xff, 0x1f, 
-0x0f, 0x83, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x80, 0x00, 0x01, 
-0x01, 0x03, 0x03, 0x07, 0x07, 0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x7f, 0x7f, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0x7f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x03, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0x3f, 0x1f, 0x0f, 0x07, 0x87, 0xc3, 0xfb, 0xff, 0x83, 0x41, 0x38, 0x3e, 0x3f, 0x1f, 0x1f, 
-0x1f, 0x8f, 0x87, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0xc3, 0xc3, 0xc1, 0xc1, 0xc3, 0xc3, 0xc3, 
-0xc3, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xe0, 0xe0, 0x20, 0x60, 0xf0, 0xf0, 0xf8, 0xf8, 0xfe, 0xf3, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x0f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xf0, 0xc0, 0x82, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 
-0xff, 0x3f, 0x3f, 0x3f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 
-0x0f, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0f, 0x0f, 0x0f, 0x0f, 0x04, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x8E, 0xFF, 0x00, 0x1E, 0x8A, 0x00, 0x00, 0x03, 0x82, 0xFF, 0x00, 0x07, 0x82, 0x03, 0x00, 0x01,
+0x81, 0x81, 0x8F, 0x01, 0x80, 0x03, 0x02, 0x07, 0x0F, 0x3F, 0x85, 0xFF, 0x03, 0xFB, 0xF3, 0xE3,
+0x01, 0xA0, 0x00, 0x04, 0x01, 0x03, 0x03, 0x07, 0x02, 0x8B, 0x00, 0x8A, 0xFF, 0x02, 0x3F, 0x0F,
+0x03, 0x8C, 0x00, 0x83, 0xFF, 0x0C, 0xFC, 0xFE, 0xFE, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0xC0,
+0xE0, 0xE0, 0xC0, 0x81, 0x80, 0x01, 0xC0, 0xE0, 0x81, 0xFC, 0x80, 0xF8, 0x80, 0xF0, 0x80, 0xF8,
+0x80, 0xFC, 0x00, 0xFE, 0x88, 0xFF, 0x00, 0x0F, 0x82, 0x00, 0x01, 0x9C, 0xFC, 0x83, 0xFE, 0x02,
+0xFF, 0xFE, 0xEC, 0x82, 0xC8, 0x02, 0xCC, 0xCF, 0xC4, 0x81, 0xE0, 0x80, 0x00, 0x01, 0x80, 0xC0,
+0x81, 0xE0, 0x80, 0xC0, 0x81, 0x80, 0x8F, 0x00, 0x81, 0x3F, 0x81, 0x1F, 0x04, 0x0F, 0x07, 0x07,
+0x03, 0x01, 0x8F, 0x00, 0x00, 0xFE, 0x86, 0xFF, 0x01, 0xFE, 0xFC, 0x84, 0xFE, 0x9B, 0xFF, 0x04,
+0xF0, 0x80, 0x00, 0x1C, 0x7F, 0x9F, 0xFF, 0x01, 0xFE, 0x0C, 0x8C, 0x00, 0x80, 0xF8, 0x00, 0xC0,
+0x97, 0x00, 0x00, 0x1F, 0xAC, 0xFF, 0x09, 0x7F, 0x7C, 0x3C, 0x3C, 0x7C, 0x7C, 0x71, 0xC7, 0x1F,
+0x7F, 0x95, 0xFF, 0x03, 0x7F, 0x3F, 0x1F, 0x07, 0x8E, 0x00, 0x02, 0xE1, 0xC3, 0x01, 0x98, 0x00,
+0x01, 0x03, 0x7F, 0x9C, 0xFF, 0x07, 0xFC, 0xF8, 0xF0, 0xF0, 0xF8, 0xF8, 0xFF, 0xFF, 0x82, 0xF1,
+0x06, 0xF0, 0xF8, 0xFC, 0xF8, 0x08, 0xF8, 0xFC, 0x81, 0xF8, 0x94, 0xFF, 0x01, 0x07, 0x01, 0x93,
+0x00, 0x80, 0xFF, 0x00, 0xF0, 0x9A, 0x00, 0x01, 0x07, 0x7F, 0x99, 0xFF, 0x80, 0x7F, 0x04, 0xFF,
+0x1F, 0x0F, 0x83, 0xC3, 0x87, 0xFF, 0x0C, 0xC3, 0x80, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07,
+0x0F, 0x0F, 0x1F, 0x1F, 0x83, 0x3F, 0x80, 0x7F, 0x86, 0xFF, 0x01, 0x7F, 0x1E, 0x94, 0x00, 0x02,
+0xFF, 0x7F, 0x0F, 0x84, 0x00, 0x01, 0x80, 0x60, 0x94, 0x00, 0x01, 0x03, 0x1F, 0x8C, 0xFF, 0x0C,
+0x3F, 0x1F, 0x0F, 0x07, 0x87, 0xC3, 0xFB, 0xFF, 0x83, 0x41, 0x38, 0x3E, 0x3F, 0x81, 0x1F, 0x01,
+0x8F, 0x87, 0x84, 0x83, 0x80, 0xC3, 0x80, 0xC1, 0x82, 0xC3, 0x81, 0x80, 0x83, 0x00, 0x81, 0x80,
+0x83, 0x00, 0x00, 0x01, 0x82, 0x03, 0x00, 0x01, 0x97, 0x00, 0x80, 0xE0, 0x09, 0x20, 0x60, 0xF0,
+0xF0, 0xF8, 0xF8, 0xFE, 0xF3, 0xE0, 0x80, 0x96, 0x00, 0x01, 0x0F, 0x3F, 0x89, 0xFF, 0x03, 0xF0,
+0xC0, 0x82, 0xF1, 0x82, 0xFF, 0x83, 0xFE, 0x81, 0xFF, 0x81, 0x3F, 0x85, 0x1F, 0x85, 0x0F, 0x84,
+0x07, 0x82, 0x0F, 0x00, 0x04, 0xA1, 0x00,
@@ -1,64 +1,49 @@
-0x00, 0xE0, 0xF0, 0xF8, 0xFC, 0x1C, 0x0E, 0x06, 0x06, 0x06, 0x0E, 0x0C, 0x1C, 0x18, 0x00, 0x00,
-0x00, 0x80, 0x80, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x40,
-0x60, 0x60, 0x30, 0x10, 0x18, 0x88, 0xCC, 0x40, 0x00, 0x00, 0x60, 0xC0, 0xC0, 0x60, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x8F, 0xDF, 0xBF, 0x3F, 0x70, 0xE8, 0xD8, 0xD8, 0xD8, 0x98, 0x30, 0x30, 0x28, 0x08, 0x00,
-0x0F, 0x1F, 0x30, 0x20, 0x20, 0x1F, 0x1F, 0x00, 0x4C, 0xCF, 0x9D, 0x99, 0xB9, 0xF3, 0x76, 0x00,
-0xF8, 0xF8, 0x08, 0x08, 0xF8, 0xF0, 0x08, 0x08, 0xF8, 0xE0, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x80,
-0x40, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x70, 0x18, 0x0C, 0x06, 0x07, 0x3F, 0x7F, 0xFF, 0xFF,
-0xFF, 0x7F, 0x7E, 0x19, 0x18, 0x3F, 0x80, 0xBF, 0x8E, 0x80, 0xD8, 0x9C, 0x9D, 0x18, 0xC0, 0x80,
-0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
-0x04, 0x08, 0x10, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x1F, 0x3F, 0x7F, 0xFF, 0xE0, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0xE0, 0xE0, 0x60, 0x20, 0x00,
-0x7E, 0x7E, 0x7E, 0x04, 0x02, 0x0E, 0x0E, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00,
-0x03, 0xF6, 0xF0, 0x00, 0x83, 0xC3, 0x40, 0x40, 0x43, 0xC3, 0x80, 0x0F, 0x0F, 0x00, 0x0F, 0x1F,
-0x20, 0x20, 0x20, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xE8, 0xF8,
-0x00, 0xF8, 0xDC, 0x4E, 0x6F, 0x27, 0x27, 0x27, 0x2F, 0x4F, 0x0F, 0xDF, 0x97, 0x8F, 0x0F, 0x09,
-0x05, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xC0, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x02, 0x01, 0x03, 0x03, 0x00,
-0x00, 0x0F, 0x0F, 0x00, 0x13, 0x33, 0x27, 0x26, 0x26, 0x3C, 0x1C, 0x08, 0x30, 0x7C, 0xFE, 0x82,
-0x80, 0x82, 0xCE, 0x4C, 0x00, 0xF8, 0xF8, 0x10, 0x08, 0x08, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00,
-0x3E, 0xFF, 0xFF, 0xF9, 0xFC, 0xF0, 0xF0, 0x70, 0x33, 0x90, 0xD8, 0xFC, 0xFF, 0xFF, 0x60, 0x00,
-0x00, 0x00, 0xE0, 0xE0, 0xE4, 0xE0, 0x70, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x1A, 0x32,
-0xF2, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x80, 0x80, 0xD0, 0x10, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x80, 0x00, 0x60, 0x20, 0x30, 0x10, 0x18, 0x08, 0x0C, 0x0C, 0x04, 0x06, 0x06,
-0xA0, 0x0F, 0x07, 0x03, 0x07, 0x07, 0x09, 0x58, 0xC7, 0x66, 0x4A, 0x62, 0x05, 0x08, 0x00, 0x20,
-0x48, 0x00, 0x40, 0x63, 0x0F, 0x1F, 0x16, 0x01, 0x00, 0x80, 0xF0, 0x02, 0x02, 0x06, 0x02, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0x20, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x02, 0x07, 0x0D, 0x19, 0x78, 0xF0, 0xF0, 0x60, 0xE0, 0x80, 0x80, 0xC4, 0xE6,
-0xF6, 0xF2, 0xFA, 0xFA, 0x7B, 0x3B, 0x96, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x30,
-0x38, 0x38, 0x10, 0x10, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xE0,
-0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0x80, 0x20, 0xE0, 0xE0, 0xC0, 0x90, 0x30, 0xEC,
-0x9C, 0x70, 0xE4, 0xC8, 0x94, 0x78, 0xD0, 0x00, 0xE0, 0xE0, 0x58, 0xC4, 0xC2, 0x82, 0x81, 0x81,
-0x00, 0x01, 0x43, 0x3C, 0x78, 0x74, 0xEC, 0x4C, 0x54, 0x58, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x1C, 0x1F, 0x1F, 0x00, 0x80, 0x80, 0x80, 0xC0,
-0xC0, 0xC0, 0x60, 0x60, 0x2F, 0x11, 0x04, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0xFC, 0x00, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xF0, 0xF9, 0xFC, 0xFE, 0xFE, 0xFA, 0xF4, 0xF8, 0xF4, 0xFC,
-0xBE, 0x7E, 0x3E, 0x1E, 0xC0, 0xE0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0x7F, 0xFF, 0xFC, 0x43, 0xFF, 0x0F, 0xFF, 0x9C,
-0x73, 0xCF, 0x3F, 0xFF, 0xFF, 0x7E, 0x71, 0xAF, 0x9E, 0x5E, 0xDF, 0xEE, 0xEE, 0xE5, 0x05, 0x15,
-0x0D, 0x0B, 0x0B, 0x1B, 0x1A, 0x3A, 0xFA, 0xFA, 0xFA, 0xF8, 0xF5, 0x73, 0x73, 0x33, 0xB3, 0x93,
-0xD3, 0xC0, 0xEA, 0xE2, 0x12, 0x02, 0x02, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0x0D, 0xB9, 0xF1, 0xF8,
-0xF0, 0xF0, 0xF0, 0xF0, 0x30, 0xC0, 0xF0, 0xF8, 0xF8, 0xF8, 0xE8, 0x18, 0x00, 0x00, 0xC4, 0xF0,
-0xE0, 0xFC, 0xFF, 0xAF, 0x51, 0x78, 0x3F, 0x94, 0xC1, 0xE7, 0xF7, 0x77, 0x77, 0xEF, 0x2F, 0x2F,
-0x2F, 0x0F, 0x0F, 0x0F, 0x1F, 0x1F, 0x1F, 0x07, 0x0F, 0x03, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00,
-0x00, 0x00, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFF,
-0xFF, 0xDE, 0xDF, 0xDE, 0x3D, 0xBB, 0xF7, 0xAF, 0x1E, 0x50, 0x8F, 0x2A, 0x20, 0x12, 0x10, 0x09,
-0x0A, 0x25, 0x64, 0xA2, 0xB2, 0xD1, 0x59, 0x68, 0xAC, 0xB4, 0x54, 0xD9, 0x0F, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0xE0, 0x20, 0xB0, 0x90, 0x4B, 0x69, 0x2D, 0x34, 0x1E, 0x1A, 0x1D, 0x8C, 0x4F, 0x47,
-0x23, 0xA3, 0x91, 0xD0, 0xC8, 0xE8, 0xE0, 0xF0, 0xF4, 0xF0, 0xFA, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF,
-0xFF, 0x3F, 0xC7, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x87, 0x01, 0x00, 0x00, 0xCA, 0xF7, 0xFF
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x06, 0x00, 0xE0, 0xF0, 0xF8, 0xFC, 0x1C, 0x0E, 0x81, 0x06, 0x03, 0x0E, 0x0C, 0x1C, 0x18, 0x81,
+0x00, 0x80, 0x80, 0x80, 0x40, 0x00, 0x80, 0x9F, 0x00, 0x80, 0xC0, 0x92, 0x00, 0x10, 0x80, 0xC0,
+0x40, 0x60, 0x60, 0x30, 0x10, 0x18, 0x88, 0xCC, 0x40, 0x00, 0x00, 0x60, 0xC0, 0xC0, 0x60, 0x8A,
+0x00, 0x03, 0x20, 0x00, 0x40, 0x80, 0x91, 0x00, 0x05, 0x8F, 0xDF, 0xBF, 0x3F, 0x70, 0xE8, 0x81,
+0xD8, 0x25, 0x98, 0x30, 0x30, 0x28, 0x08, 0x00, 0x0F, 0x1F, 0x30, 0x20, 0x20, 0x1F, 0x1F, 0x00,
+0x4C, 0xCF, 0x9D, 0x99, 0xB9, 0xF3, 0x76, 0x00, 0xF8, 0xF8, 0x08, 0x08, 0xF8, 0xF0, 0x08, 0x08,
+0xF8, 0xE0, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x80, 0x81, 0x40, 0x80, 0x80, 0x8F, 0x00, 0x07, 0xC0,
+0x70, 0x18, 0x0C, 0x06, 0x07, 0x3F, 0x7F, 0x81, 0xFF, 0x0F, 0x7F, 0x7E, 0x19, 0x18, 0x3F, 0x80,
+0xBF, 0x8E, 0x80, 0xD8, 0x9C, 0x9D, 0x18, 0xC0, 0x80, 0x80, 0x8B, 0x00, 0x06, 0x01, 0x02, 0x04,
+0x08, 0x10, 0x20, 0x80, 0x8A, 0x00, 0x05, 0x1F, 0x3F, 0x7F, 0xFF, 0xE0, 0xC0, 0x81, 0x80, 0x05,
+0xC0, 0xE0, 0xE0, 0x60, 0x20, 0x00, 0x81, 0x7E, 0x06, 0x04, 0x02, 0x0E, 0x0E, 0x00, 0xF8, 0xF8,
+0x81, 0x00, 0x80, 0xF8, 0x10, 0x00, 0x03, 0xF6, 0xF0, 0x00, 0x83, 0xC3, 0x40, 0x40, 0x43, 0xC3,
+0x80, 0x0F, 0x0F, 0x00, 0x0F, 0x1F, 0x81, 0x20, 0x01, 0x31, 0x11, 0x8D, 0x00, 0x01, 0x10, 0x02,
+0x85, 0x00, 0x07, 0xF0, 0xE8, 0xF8, 0x00, 0xF8, 0xDC, 0x4E, 0x6F, 0x81, 0x27, 0x09, 0x2F, 0x4F,
+0x0F, 0xDF, 0x97, 0x8F, 0x0F, 0x09, 0x05, 0x00, 0x82, 0x20, 0x83, 0x00, 0x01, 0xE0, 0xC0, 0x86,
+0x00, 0x00, 0x01, 0x8E, 0x00, 0x83, 0x01, 0x8B, 0x00, 0x23, 0x01, 0x03, 0x03, 0x02, 0x01, 0x03,
+0x03, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x13, 0x33, 0x27, 0x26, 0x26, 0x3C, 0x1C, 0x08, 0x30, 0x7C,
+0xFE, 0x82, 0x80, 0x82, 0xCE, 0x4C, 0x00, 0xF8, 0xF8, 0x10, 0x08, 0x08, 0x38, 0x10, 0x8F, 0x00,
+0x11, 0x07, 0x01, 0x00, 0x3E, 0xFF, 0xFF, 0xF9, 0xFC, 0xF0, 0xF0, 0x70, 0x33, 0x90, 0xD8, 0xFC,
+0xFF, 0xFF, 0x60, 0x81, 0x00, 0x80, 0xE0, 0x03, 0xE4, 0xE0, 0x70, 0x80, 0x82, 0x00, 0x00, 0x01,
+0x9D, 0x00, 0x80, 0x02, 0x06, 0x1A, 0x32, 0xF2, 0xE0, 0xE0, 0xC0, 0x80, 0x8C, 0x00, 0x80, 0x80,
+0x04, 0xD0, 0x10, 0x00, 0x20, 0x20, 0x89, 0x00, 0x80, 0x03, 0x8A, 0x00, 0x2B, 0x80, 0x00, 0x60,
+0x20, 0x30, 0x10, 0x18, 0x08, 0x0C, 0x0C, 0x04, 0x06, 0x06, 0xA0, 0x0F, 0x07, 0x03, 0x07, 0x07,
+0x09, 0x58, 0xC7, 0x66, 0x4A, 0x62, 0x05, 0x08, 0x00, 0x20, 0x48, 0x00, 0x40, 0x63, 0x0F, 0x1F,
+0x16, 0x01, 0x00, 0x80, 0xF0, 0x02, 0x02, 0x06, 0x02, 0x83, 0x00, 0x03, 0x90, 0x20, 0x40, 0x40,
+0x89, 0x00, 0x15, 0x02, 0x07, 0x0D, 0x19, 0x78, 0xF0, 0xF0, 0x60, 0xE0, 0x80, 0x80, 0xC4, 0xE6,
+0xF6, 0xF2, 0xFA, 0xFA, 0x7B, 0x3B, 0x96, 0x00, 0x04, 0x83, 0x00, 0x07, 0x10, 0x30, 0x38, 0x38,
+0x10, 0x10, 0x01, 0x01, 0x83, 0x00, 0x00, 0x80, 0x81, 0xC0, 0x81, 0xE0, 0x82, 0xF0, 0x80, 0xE0,
+0x25, 0x80, 0x20, 0xE0, 0xE0, 0xC0, 0x90, 0x30, 0xEC, 0x9C, 0x70, 0xE4, 0xC8, 0x94, 0x78, 0xD0,
+0x00, 0xE0, 0xE0, 0x58, 0xC4, 0xC2, 0x82, 0x81, 0x81, 0x00, 0x01, 0x43, 0x3C, 0x78, 0x74, 0xEC,
+0x4C, 0x54, 0x58, 0x10, 0x10, 0x00, 0x00, 0x81, 0x10, 0x81, 0x00, 0x07, 0x02, 0x00, 0x80, 0x00,
+0x1C, 0x1F, 0x1F, 0x00, 0x81, 0x80, 0x81, 0xC0, 0x80, 0x60, 0x03, 0x2F, 0x11, 0x04, 0x0C, 0x89,
+0x00, 0x06, 0x80, 0xE0, 0xF8, 0xFC, 0x00, 0xFE, 0xFE, 0x88, 0xFF, 0x15, 0xF8, 0xF0, 0xF0, 0xF9,
+0xFC, 0xFE, 0xFE, 0xFA, 0xF4, 0xF8, 0xF4, 0xFC, 0xBE, 0x7E, 0x3E, 0x1E, 0xC0, 0xE0, 0xF8, 0xFC,
+0xFC, 0xFE, 0x84, 0xFF, 0x80, 0x7F, 0x82, 0xFF, 0x1F, 0xEF, 0xFF, 0x7F, 0xFF, 0xFC, 0x43, 0xFF,
+0x0F, 0xFF, 0x9C, 0x73, 0xCF, 0x3F, 0xFF, 0xFF, 0x7E, 0x71, 0xAF, 0x9E, 0x5E, 0xDF, 0xEE, 0xEE,
+0xE5, 0x05, 0x15, 0x0D, 0x0B, 0x0B, 0x1B, 0x1A, 0x3A, 0x81, 0xFA, 0x0D, 0xF8, 0xF5, 0x73, 0x73,
+0x33, 0xB3, 0x93, 0xD3, 0xC0, 0xEA, 0xE2, 0x12, 0x02, 0x02, 0x81, 0x00, 0x05, 0x0B, 0xE3, 0x0D,
+0xB9, 0xF1, 0xF8, 0x82, 0xF0, 0x02, 0x30, 0xC0, 0xF0, 0x81, 0xF8, 0x13, 0xE8, 0x18, 0x00, 0x00,
+0xC4, 0xF0, 0xE0, 0xFC, 0xFF, 0xAF, 0x51, 0x78, 0x3F, 0x94, 0xC1, 0xE7, 0xF7, 0x77, 0x77, 0xEF,
+0x81, 0x2F, 0x81, 0x0F, 0x81, 0x1F, 0x07, 0x07, 0x0F, 0x03, 0x07, 0x07, 0x03, 0x03, 0x01, 0x81,
+0x00, 0x80, 0x01, 0x87, 0xFF, 0x80, 0xEF, 0x80, 0xFF, 0x1C, 0xDE, 0xDF, 0xDE, 0x3D, 0xBB, 0xF7,
+0xAF, 0x1E, 0x50, 0x8F, 0x2A, 0x20, 0x12, 0x10, 0x09, 0x0A, 0x25, 0x64, 0xA2, 0xB2, 0xD1, 0x59,
+0x68, 0xAC, 0xB4, 0x54, 0xD9, 0x0F, 0xFF, 0x82, 0x00, 0x1A, 0xE0, 0x20, 0xB0, 0x90, 0x4B, 0x69,
+0x2D, 0x34, 0x1E, 0x1A, 0x1D, 0x8C, 0x4F, 0x47, 0x23, 0xA3, 0x91, 0xD0, 0xC8, 0xE8, 0xE0, 0xF0,
+0xF4, 0xF0, 0xFA, 0xFD, 0xFE, 0x82, 0xFF, 0x02, 0x3F, 0xC7, 0xF8, 0x82, 0xFF, 0x07, 0x1F, 0x87,
+0x01, 0x00, 0x00, 0xCA, 0xF7, 0xFF,
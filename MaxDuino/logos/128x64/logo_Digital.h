@@ -1,64 +1,27 @@
-0x30, 0x78, 0xfc, 0xcc, 0xff, 0xff, 0x00, 0xfd, 0xff, 0x00, 0x78, 0xfc, 0xcc, 0xfc, 0xfc, 0x00, 
-0x40, 0xff, 0x00, 0x7c, 0xff, 0xcc, 0x40, 0xec, 0xf4, 0xfc, 0xfc, 0xd0, 0x7e, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf8, 0xe0, 0xc0, 0x40, 0xf0, 
-0xf8, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0x60, 0xf8, 0xe0, 0xc0, 0x00, 0x00, 0x08, 0x18, 0xb8, 0xf8, 
-0xf0, 0xe0, 0x90, 0x08, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0x08, 0x18, 0xe0, 0x00, 0x00, 0xf8, 0xf8, 
-0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0xf8, 0x70, 0xf0, 0xe0, 0xc0, 
-0xf8, 0x00, 0x00, 0xe0, 0xf8, 0xf8, 0x08, 0x18, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07, 0x03, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01, 0x00, 0x01, 
-0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x02, 0x01, 0x00, 0x00, 
-0x01, 0x03, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x03, 0x02, 0x03, 0x00, 0x00, 0x00, 0x01, 0x03, 
-0x03, 0x02, 0x02, 0x01, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 
-0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xf0, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
-0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xf8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
-0x08, 0x08, 0x08, 0x08, 0x08, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
-0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x04, 0x04, 0x04, 0x04, 0x04, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x3f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-0x20, 0x20, 0x20, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0x60, 0x60, 0x60, 0xe0, 0xc0, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xe0, 0xe0, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x30, 0x30, 0x70, 
-0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 
-0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 
-0xf0, 0x30, 0x30, 0xf0, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x7f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0xe0, 0xc0, 0xe0, 0x7f, 0x3f, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x3f, 0x7f, 0x60, 0x60, 0x70, 
-0x3f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x7f, 
-0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1f, 
-0x3f, 0x70, 0x60, 0x3f, 0x3f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x1D, 0x30, 0x78, 0xFC, 0xCC, 0xFF, 0xFF, 0x00, 0xFD, 0xFF, 0x00, 0x78, 0xFC, 0xCC, 0xFC, 0xFC,
+0x00, 0x40, 0xFF, 0x00, 0x7C, 0xFF, 0xCC, 0x40, 0xEC, 0xF4, 0xFC, 0xFC, 0xD0, 0x7E, 0xFF, 0x9A,
+0x00, 0x07, 0xC0, 0xF8, 0xE0, 0xC0, 0x40, 0xF0, 0xF8, 0xC0, 0x81, 0x00, 0x10, 0xC0, 0x60, 0xF8,
+0xE0, 0xC0, 0x00, 0x00, 0x08, 0x18, 0xB8, 0xF8, 0xF0, 0xE0, 0x90, 0x08, 0x00, 0x00, 0x81, 0xF8,
+0x04, 0x08, 0x18, 0xE0, 0x00, 0x00, 0x81, 0xF8, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x81, 0xF8,
+0x80, 0x00, 0x0D, 0xF8, 0x70, 0xF0, 0xE0, 0xC0, 0xF8, 0x00, 0x00, 0xE0, 0xF8, 0xF8, 0x08, 0x18,
+0xE0, 0x8F, 0x00, 0x04, 0x01, 0x07, 0x07, 0x03, 0x01, 0xA8, 0x00, 0x0A, 0x03, 0x00, 0x00, 0x03,
+0x01, 0x00, 0x01, 0x03, 0x03, 0x02, 0x02, 0x82, 0x01, 0x81, 0x03, 0x80, 0x02, 0x03, 0x01, 0x00,
+0x00, 0x01, 0x81, 0x03, 0x80, 0x00, 0x81, 0x03, 0x01, 0x02, 0x03, 0x81, 0x00, 0x07, 0x01, 0x03,
+0x03, 0x02, 0x02, 0x01, 0x00, 0x00, 0x81, 0x03, 0x80, 0x00, 0x05, 0x03, 0x00, 0x00, 0x01, 0x01,
+0x03, 0x81, 0x00, 0x80, 0x03, 0x01, 0x02, 0x03, 0x96, 0x00, 0x00, 0xF0, 0x8D, 0x08, 0x00, 0xF8,
+0x90, 0x00, 0x00, 0xF8, 0x8F, 0x08, 0x00, 0xF8, 0x8F, 0x00, 0x00, 0xF8, 0x8E, 0x08, 0x00, 0xF8,
+0x8F, 0x00, 0x00, 0xFC, 0x83, 0x04, 0x8E, 0x00, 0x00, 0xFF, 0x8D, 0x00, 0x00, 0xFF, 0x90, 0x00,
+0x00, 0xFF, 0x8F, 0x00, 0x00, 0xFF, 0x8F, 0x00, 0x00, 0xFF, 0x8E, 0x00, 0x00, 0xFF, 0x8F, 0x00,
+0x00, 0xFF, 0x93, 0x00, 0x00, 0xFF, 0x8D, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0x8F, 0x00,
+0x00, 0xFF, 0x8F, 0x00, 0x00, 0xFF, 0x8E, 0x00, 0x00, 0xFF, 0x8F, 0x00, 0x00, 0xFF, 0x93, 0x00,
+0x00, 0x3F, 0x8D, 0x00, 0x00, 0x3F, 0x90, 0x20, 0x00, 0x3F, 0x8F, 0x00, 0x00, 0x3F, 0x8F, 0x20,
+0x00, 0x3F, 0x8E, 0x00, 0x00, 0x3F, 0x8F, 0x20, 0x00, 0x3F, 0x98, 0x00, 0x80, 0x80, 0x81, 0xE0,
+0x8B, 0x00, 0x01, 0x80, 0xE0, 0x81, 0x60, 0x01, 0xE0, 0xC0, 0x89, 0x00, 0x80, 0x80, 0x02, 0xC0,
+0xE0, 0xE0, 0x8B, 0x00, 0x80, 0xE0, 0x80, 0x30, 0x02, 0x70, 0xE0, 0x80, 0x88, 0x00, 0x04, 0x80,
+0xC0, 0xE0, 0xF0, 0xF0, 0x8C, 0x00, 0x06, 0xE0, 0xF0, 0x30, 0x30, 0xF0, 0xE0, 0x80, 0x87, 0x00,
+0x00, 0x80, 0x93, 0x00, 0x80, 0x01, 0x02, 0x7F, 0xFF, 0xFF, 0x8B, 0x00, 0x06, 0x1F, 0x7F, 0xE0,
+0xC0, 0xE0, 0x7F, 0x3F, 0x89, 0x00, 0x81, 0x01, 0x80, 0xFF, 0x8A, 0x00, 0x07, 0x0F, 0x3F, 0x7F,
+0x60, 0x60, 0x70, 0x3F, 0x0F, 0x88, 0x00, 0x80, 0x01, 0x02, 0x00, 0x7F, 0x7F, 0x8B, 0x00, 0x07,
+0x07, 0x1F, 0x3F, 0x70, 0x60, 0x3F, 0x3F, 0x0F, 0x88, 0x00,
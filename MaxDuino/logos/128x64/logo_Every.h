@@ -1,64 +1,24 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 
-0xfe, 0xfe, 0xf8, 0xe0, 0x80, 0x00, 0x00, 0x80, 0xf0, 0xfc, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 
-0x00, 0x80, 0xf0, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x02, 0x0e, 0x3e, 0x7c, 0xf0, 0xe0, 0xe0, 
-0xf8, 0x7e, 0x1e, 0x06, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x1c, 0x7c, 
-0xf8, 0xf0, 0xc0, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 
-0x3c, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xf8, 0xf0, 0xc0, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 
-0x80, 0xe0, 0xf8, 0xf8, 0xfc, 0x3e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x3e, 0xfc, 0xfc, 0xf8, 0xf0, 
-0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 
-0x1f, 0x1f, 0x07, 0x1f, 0x3f, 0xfe, 0x7e, 0x3f, 0x0f, 0x07, 0xff, 0xff, 0xff, 0x00, 0x80, 0xf0, 
-0xfe, 0x7f, 0x1f, 0x03, 0x01, 0x3f, 0x3f, 0x3f, 0x00, 0x80, 0xe0, 0xf0, 0x7c, 0x1f, 0x0f, 0x1f, 
-0x3c, 0xf8, 0xf0, 0xc0, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0xc0, 0xc0, 0xe0, 0xe0, 0xf0, 0x78, 
-0x7f, 0x3f, 0x0f, 0x00, 0x0f, 0x1f, 0x1f, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x3e, 0x1f, 0x0f, 0x07, 
-0x00, 0x3f, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xef, 0x01, 0x07, 0x0f, 0x3f, 0xff, 0xff, 0xff, 0xff, 
-0x07, 0x1f, 0x3f, 0x7f, 0x7e, 0xb8, 0xd0, 0xe0, 0xe0, 0xe0, 0xf0, 0xf8, 0xfc, 0x7f, 0x3f, 0x1f, 
-0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0x70, 
-0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x10, 0x00, 0x10, 0xf0, 0xf0, 0xe0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0xf0, 0x30, 0x00, 0x40, 0xf0, 0xf0, 0x70, 0x70, 0x70, 0x70, 
-0x70, 0x70, 0x70, 0x70, 0x70, 0x10, 0x00, 0xf0, 0xf0, 0xf0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 
-0x70, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x10, 0x30, 0x70, 0xf0, 0xe0, 0x80, 0x00, 0x00, 0xc0, 0xe0, 
-0xf0, 0x70, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8f, 
-0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x00, 0x00, 0x00, 0x07, 0x1f, 0xff, 0xfc, 0xf0, 
-0xc0, 0xf0, 0xfc, 0xff, 0x1f, 0x07, 0x01, 0x00, 0x00, 0x94, 0xff, 0xff, 0x9f, 0x87, 0x86, 0x86, 
-0x86, 0x86, 0x86, 0x86, 0x86, 0x00, 0x00, 0xff, 0xff, 0xff, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 
-0x0f, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x9f, 0xff, 0xff, 0x07, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 
-0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x03, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x02, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xFF, 0x00, 0x8C, 0x00, 0x81, 0xFE, 0x07, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x80, 0xF0, 0xFC, 0x81,
+0xFE, 0x82, 0x00, 0x02, 0x80, 0xF0, 0xFC, 0x82, 0xFE, 0x0D, 0x00, 0x02, 0x0E, 0x3E, 0x7C, 0xF0,
+0xE0, 0xE0, 0xF8, 0x7E, 0x1E, 0x06, 0x00, 0x00, 0x81, 0xFE, 0x83, 0x0E, 0x05, 0x1C, 0x7C, 0xF8,
+0xF0, 0xC0, 0x00, 0x81, 0xFE, 0x84, 0x00, 0x81, 0xFE, 0x00, 0x3C, 0x85, 0xFE, 0x04, 0xF8, 0xF0,
+0xC0, 0x00, 0x00, 0x81, 0xFE, 0x05, 0x80, 0xE0, 0xF8, 0xF8, 0xFC, 0x3E, 0x83, 0x1E, 0x05, 0x3E,
+0xFC, 0xFC, 0xF8, 0xF0, 0x80, 0x9C, 0x00, 0x81, 0x1F, 0x07, 0x07, 0x1F, 0x3F, 0xFE, 0x7E, 0x3F,
+0x0F, 0x07, 0x81, 0xFF, 0x07, 0x00, 0x80, 0xF0, 0xFE, 0x7F, 0x1F, 0x03, 0x01, 0x81, 0x3F, 0x0D,
+0x00, 0x80, 0xE0, 0xF0, 0x7C, 0x1F, 0x0F, 0x1F, 0x3C, 0xF8, 0xF0, 0xC0, 0x00, 0x00, 0x81, 0x3F,
+0x0E, 0x00, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0x78, 0x7F, 0x3F, 0x0F, 0x00, 0x0F, 0x1F, 0x1F, 0x3C,
+0x82, 0x38, 0x04, 0x3E, 0x1F, 0x0F, 0x07, 0x00, 0x81, 0x3F, 0x81, 0xFF, 0x04, 0xEF, 0x01, 0x07,
+0x0F, 0x3F, 0x82, 0xFF, 0x06, 0x07, 0x1F, 0x3F, 0x7F, 0x7E, 0xB8, 0xD0, 0x81, 0xE0, 0x06, 0xF0,
+0xF8, 0xFC, 0x7F, 0x3F, 0x1F, 0x07, 0xAC, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0x86, 0x00,
+0x00, 0x01, 0x9F, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x01, 0x07, 0x07, 0xBA, 0x00, 0x81, 0xF0,
+0x86, 0x70, 0x05, 0x10, 0x00, 0x10, 0xF0, 0xF0, 0xE0, 0x85, 0x00, 0x07, 0xE0, 0xF0, 0xF0, 0x30,
+0x00, 0x40, 0xF0, 0xF0, 0x87, 0x70, 0x01, 0x10, 0x00, 0x81, 0xF0, 0x85, 0x70, 0x81, 0xF0, 0x80,
+0x00, 0x0D, 0x10, 0x30, 0x70, 0xF0, 0xE0, 0x80, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0x70, 0x10, 0x10,
+0xB6, 0x00, 0x81, 0xFF, 0x00, 0x8F, 0x86, 0x86, 0x81, 0x00, 0x12, 0x07, 0x1F, 0xFF, 0xFC, 0xF0,
+0xC0, 0xF0, 0xFC, 0xFF, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0x9F, 0x87, 0x85, 0x86,
+0x80, 0x00, 0x81, 0xFF, 0x00, 0x07, 0x82, 0x06, 0x04, 0x07, 0x0F, 0xFF, 0xFF, 0xF1, 0x83, 0x00,
+0x06, 0x01, 0x03, 0x9F, 0xFF, 0xFF, 0x07, 0x03, 0xBA, 0x00, 0x89, 0x03, 0x00, 0x02, 0x84, 0x00,
+0x83, 0x03, 0x85, 0x00, 0x89, 0x03, 0x01, 0x02, 0x00, 0x81, 0x03, 0x85, 0x00, 0x80, 0x03, 0x00,
+0x02, 0x85, 0x00, 0x03, 0x02, 0x03, 0x03, 0x02, 0xFF, 0x00, 0x9E, 0x00,
@@ -1,64 +1,59 @@
-0x08, 0x35, 0x5a, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x1f, 0x0f, 0x07, 0x01, 
-0x80, 0x40, 0xa0, 0x40, 0x3e, 0xfd, 0xfa, 0xf5, 0xf6, 0xf9, 0xfc, 0x7d, 0xbe, 0xbe, 0x3e, 0x7d, 
-0xfb, 0xfb, 0xf7, 0xef, 0xdf, 0x3f, 0xff, 0xea, 0xd0, 0x80, 0x07, 0x3f, 0xff, 0xbf, 0xff, 0xbc, 
-0xd0, 0x82, 0x01, 0x2a, 0x51, 0x8a, 0x35, 0x0a, 0x91, 0x0a, 0x05, 0x00, 0x45, 0x8a, 0xc1, 0x0a, 
-0x95, 0x0a, 0x15, 0x0a, 0x54, 0xa8, 0x55, 0xea, 0xd0, 0xa0, 0x40, 0xa1, 0x41, 0x83, 0x47, 0x07, 
-0x0f, 0xd0, 0xff, 0xff, 0xff, 0xcf, 0xb1, 0xba, 0xdd, 0x5e, 0x5f, 0x5f, 0x1f, 0x4f, 0x23, 0x51, 
-0x69, 0x39, 0xa3, 0x1f, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x70, 0xce, 0x3e, 0xfe, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc0, 0x00, 0x00, 
-0x02, 0x05, 0x0a, 0x15, 0xba, 0x5e, 0x29, 0xb7, 0x4f, 0x37, 0x1b, 0x0c, 0xc2, 0xe2, 0xf9, 0xf8, 
-0xfc, 0xff, 0x3f, 0x1f, 0x07, 0x00, 0x10, 0x8b, 0x4d, 0x82, 0x4d, 0x8a, 0x48, 0xa3, 0x4f, 0xee, 
-0x47, 0xaa, 0xef, 0xea, 0xe0, 0xe8, 0xe4, 0xe0, 0xc0, 0xc2, 0x80, 0x85, 0x05, 0x05, 0x06, 0x03, 
-0x05, 0x03, 0x12, 0x00, 0x10, 0x6a, 0x75, 0xfa, 0xf7, 0x6f, 0x3d, 0x8e, 0x45, 0xa2, 0xd0, 0xaa, 
-0xf5, 0xfe, 0xff, 0x5f, 0x0b, 0x01, 0x08, 0x54, 0x88, 0xc4, 0x0a, 0x14, 0xaa, 0x14, 0xa2, 0x50, 
-0xa8, 0x05, 0x02, 0x78, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-0xfd, 0x1f, 0x80, 0x0f, 0x1f, 0x1f, 0x9f, 0xc0, 0xe0, 0x60, 0x60, 0x60, 0xbf, 0xbf, 0x5e, 0x2c, 
-0x28, 0x10, 0x90, 0x08, 0x04, 0x42, 0xc1, 0x00, 0x0c, 0x9a, 0x15, 0x1a, 0x14, 0x89, 0x47, 0xaf, 
-0x4f, 0x8f, 0x44, 0xa0, 0x50, 0xa8, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xab, 
-0x55, 0xaf, 0x55, 0xaf, 0x5f, 0xaf, 0x5f, 0xbf, 0x5f, 0xaf, 0xdf, 0xaf, 0xdf, 0xef, 0xdf, 0xee, 
-0xdc, 0xbc, 0xd8, 0xa8, 0xc3, 0xa6, 0xc4, 0x62, 0xa4, 0x68, 0xad, 0x4a, 0xad, 0xca, 0xd5, 0xca, 
-0xd5, 0xcb, 0x17, 0x8b, 0x40, 0x80, 0x41, 0x85, 0x01, 0x84, 0x82, 0x01, 0x08, 0x15, 0x4a, 0xc5, 
-0x60, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x31, 0xfe, 0xff, 0xf9, 0x02, 0x02, 0xa2, 0xd2, 0xe2, 0xd1, 0xe9, 0xf1, 0xe8, 0xf4, 0xfa, 0xfc, 
-0xba, 0xfd, 0xfe, 0xff, 0x00, 0xab, 0x00, 0x00, 0xfd, 0x02, 0x55, 0x82, 0x29, 0x02, 0x55, 0xaa, 
-0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 
-0x55, 0xfe, 0x75, 0xde, 0xfd, 0xdf, 0x7d, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xaf, 0x5f, 0xc3, 0x31, 0x6a, 0x55, 0xaa, 0x35, 0xaa, 0xd5, 0xbe, 0x7f, 0xbf, 0xff, 
-0xff, 0x7f, 0x80, 0xfa, 0xfd, 0xfe, 0xff, 0xfc, 0xff, 0x7a, 0x15, 0x02, 0x18, 0x05, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xfe, 0xff, 0xff, 0x00, 0x00, 0x55, 0xea, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xbf, 0xff, 0xff, 0xff, 
-0xaa, 0xf7, 0xff, 0xff, 0x00, 0xaa, 0x00, 0x00, 0x5f, 0xe0, 0x15, 0xaa, 0x50, 0x02, 0x95, 0x2a, 
-0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaf, 
-0x55, 0xbf, 0x57, 0xff, 0xdd, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0x7f, 0x7e, 0xff, 0xeb, 0xd7, 0xfe, 0xfd, 0xfc, 0xfe, 
-0xfc, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0x1f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x84, 0x54, 0xa8, 0x48, 
-0x28, 0x98, 0xd0, 0xf0, 0xf0, 0xe0, 0xa0, 0x40, 0xa0, 0x40, 0xc0, 0xc0, 0xd0, 0xb8, 0xb8, 0xb8, 
-0xb0, 0x78, 0x70, 0x60, 0x70, 0x60, 0xf0, 0xe0, 0xc0, 0xa0, 0xc0, 0xa0, 0xc0, 0x80, 0x40, 0x80, 
-0xc0, 0xea, 0x3a, 0x00, 0x80, 0xd5, 0xfe, 0xff, 0xff, 0xff, 0xef, 0x7f, 0xfa, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0xaa, 0x00, 0x00, 0x55, 0xff, 0x00, 0xaa, 0x55, 0xaa, 0x50, 0xa5, 
-0x40, 0x8a, 0x01, 0x56, 0x05, 0x4a, 0x75, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xbe, 
-0x75, 0xdf, 0x7d, 0xdf, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x43, 0x83, 0x27, 0x87, 
-0x6b, 0x43, 0xcb, 0x45, 0x89, 0xc6, 0x8e, 0x05, 0x82, 0x14, 0x0a, 0x05, 0x89, 0x1c, 0x0a, 0x31, 
-0x87, 0x3f, 0x1f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x20, 0xa0, 0xd1, 0xf0, 0xe6, 
-0x07, 0x07, 0xef, 0x57, 0xaa, 0x5d, 0xae, 0x75, 0xab, 0x55, 0xaa, 0x57, 0xbb, 0x5d, 0xeb, 0xf7, 
-0xff, 0xff, 0xff, 0xff, 0x3f, 0x0f, 0xc6, 0xf2, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x59, 0x99, 0x00, 0x00, 0xaa, 0xdd, 0xff, 0xff, 0xff, 0xf5, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xdf, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0xaa, 0x00, 0x00, 0x55, 0xff, 0xf8, 0x02, 0x55, 0xaa, 0x55, 0xaa, 
-0x55, 0xaa, 0x54, 0xaa, 0x50, 0xa0, 0x41, 0x80, 0x05, 0x0a, 0x15, 0x0a, 0x15, 0x2a, 0x55, 0xaa, 
-0x55, 0xae, 0x55, 0xff, 0x5e, 0xb7, 0x7f, 0xdf, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 
-0xdf, 0xce, 0xcc, 0xed, 0xca, 0xe9, 0xc3, 0xc5, 0xd3, 0xa5, 0xd3, 0xb7, 0x13, 0x09, 0x0b, 0x05, 
-0x80, 0x00, 0xa0, 0x00, 0xaa, 0x54, 0xaa, 0xdd, 0xea, 0xdc, 0xef, 0xd7, 0xab, 0x75, 0xfb, 0xfd, 
-0x00, 0x00, 0xea, 0xd5, 0xaa, 0x55, 0xae, 0x7f, 0xaf, 0xd7, 0xaa, 0x7d, 0xfa, 0x77, 0xaf, 0xdf, 
-0x1f, 0x07, 0xe3, 0xf0, 0xe8, 0xf4, 0xe9, 0xf1, 0xe9, 0xd3, 0xe3, 0xd3, 0xa7, 0xc7, 0xa7, 0xc7, 
-0x5f, 0xaa, 0x00, 0x00, 0xaa, 0xff, 0xdf, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x15, 0x1f, 0x1f, 
-0x1f, 0x9f, 0xff, 0xef, 0x00, 0xff, 0x00, 0x00, 0x55, 0xfa, 0xff, 0x00, 0x55, 0xaa, 0x55, 0xaa, 
-0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x54, 0xa8, 0x54, 0xa8, 0x50, 0xa0, 
-0x51, 0xa2, 0xc1, 0x82, 0x45, 0x82, 0x85, 0x8b, 0x05, 0x8b, 0x15, 0x0f, 0x15, 0x0b, 0x97, 0x0f, 
-0x1f, 0x0f, 0x1f, 0x0f, 0x07, 0x07, 0x1f, 0x0f, 0x8f, 0x47, 0x83, 0x41, 0xa8, 0x90, 0xe0, 0xc1, 
-0x02, 0x15, 0xaa, 0x55, 0xee, 0xfd, 0xfb, 0x57, 0xaf, 0xff, 0xff, 0xdf, 0xab, 0x75, 0xfe, 0xff, 
-0xf8, 0xe0, 0xc7, 0x9f, 0x3e, 0x7d, 0x7b, 0x7d, 0xbb, 0x75, 0xae, 0xdf, 0x2a, 0x05, 0x07, 0x80, 
-0x10, 0x2a, 0x57, 0xbb, 0xf7, 0xef, 0xdf, 0xef, 0xf7, 0xfb, 0xf7, 0xea, 0xd5, 0xbb, 0x7f, 0xff
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x03, 0x08, 0x35, 0x5A, 0xBF, 0x82, 0xFF, 0x00, 0x0F, 0x81, 0x00, 0x45, 0x1F, 0x0F, 0x07, 0x01,
+0x80, 0x40, 0xA0, 0x40, 0x3E, 0xFD, 0xFA, 0xF5, 0xF6, 0xF9, 0xFC, 0x7D, 0xBE, 0xBE, 0x3E, 0x7D,
+0xFB, 0xFB, 0xF7, 0xEF, 0xDF, 0x3F, 0xFF, 0xEA, 0xD0, 0x80, 0x07, 0x3F, 0xFF, 0xBF, 0xFF, 0xBC,
+0xD0, 0x82, 0x01, 0x2A, 0x51, 0x8A, 0x35, 0x0A, 0x91, 0x0A, 0x05, 0x00, 0x45, 0x8A, 0xC1, 0x0A,
+0x95, 0x0A, 0x15, 0x0A, 0x54, 0xA8, 0x55, 0xEA, 0xD0, 0xA0, 0x40, 0xA1, 0x41, 0x83, 0x47, 0x07,
+0x0F, 0xD0, 0x81, 0xFF, 0x0F, 0xCF, 0xB1, 0xBA, 0xDD, 0x5E, 0x5F, 0x5F, 0x1F, 0x4F, 0x23, 0x51,
+0x69, 0x39, 0xA3, 0x1F, 0xBF, 0x8B, 0x00, 0x00, 0x10, 0x83, 0x00, 0x00, 0x08, 0x85, 0x00, 0x03,
+0x70, 0xCE, 0x3E, 0xFE, 0x81, 0xFF, 0x00, 0x03, 0x82, 0x00, 0x58, 0xE0, 0xC0, 0x00, 0x00, 0x02,
+0x05, 0x0A, 0x15, 0xBA, 0x5E, 0x29, 0xB7, 0x4F, 0x37, 0x1B, 0x0C, 0xC2, 0xE2, 0xF9, 0xF8, 0xFC,
+0xFF, 0x3F, 0x1F, 0x07, 0x00, 0x10, 0x8B, 0x4D, 0x82, 0x4D, 0x8A, 0x48, 0xA3, 0x4F, 0xEE, 0x47,
+0xAA, 0xEF, 0xEA, 0xE0, 0xE8, 0xE4, 0xE0, 0xC0, 0xC2, 0x80, 0x85, 0x05, 0x05, 0x06, 0x03, 0x05,
+0x03, 0x12, 0x00, 0x10, 0x6A, 0x75, 0xFA, 0xF7, 0x6F, 0x3D, 0x8E, 0x45, 0xA2, 0xD0, 0xAA, 0xF5,
+0xFE, 0xFF, 0x5F, 0x0B, 0x01, 0x08, 0x54, 0x88, 0xC4, 0x0A, 0x14, 0xAA, 0x14, 0xA2, 0x50, 0xA8,
+0x05, 0x02, 0x78, 0x03, 0x96, 0x00, 0x0B, 0x01, 0x00, 0x00, 0xFD, 0x1F, 0x80, 0x0F, 0x1F, 0x1F,
+0x9F, 0xC0, 0xE0, 0x81, 0x60, 0x80, 0xBF, 0x54, 0x5E, 0x2C, 0x28, 0x10, 0x90, 0x08, 0x04, 0x42,
+0xC1, 0x00, 0x0C, 0x9A, 0x15, 0x1A, 0x14, 0x89, 0x47, 0xAF, 0x4F, 0x8F, 0x44, 0xA0, 0x50, 0xA8,
+0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAB, 0x55, 0xAF, 0x55, 0xAF, 0x5F, 0xAF,
+0x5F, 0xBF, 0x5F, 0xAF, 0xDF, 0xAF, 0xDF, 0xEF, 0xDF, 0xEE, 0xDC, 0xBC, 0xD8, 0xA8, 0xC3, 0xA6,
+0xC4, 0x62, 0xA4, 0x68, 0xAD, 0x4A, 0xAD, 0xCA, 0xD5, 0xCA, 0xD5, 0xCB, 0x17, 0x8B, 0x40, 0x80,
+0x41, 0x85, 0x01, 0x84, 0x82, 0x01, 0x08, 0x15, 0x4A, 0xC5, 0x60, 0x18, 0x07, 0x94, 0x00, 0x00,
+0x08, 0x84, 0x00, 0x37, 0x31, 0xFE, 0xFF, 0xF9, 0x02, 0x02, 0xA2, 0xD2, 0xE2, 0xD1, 0xE9, 0xF1,
+0xE8, 0xF4, 0xFA, 0xFC, 0xBA, 0xFD, 0xFE, 0xFF, 0x00, 0xAB, 0x00, 0x00, 0xFD, 0x02, 0x55, 0x82,
+0x29, 0x02, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
+0x55, 0xAA, 0x55, 0xAA, 0x55, 0xFE, 0x75, 0xDE, 0xFD, 0xDF, 0x7D, 0xFE, 0x88, 0xFF, 0x1C, 0xAF,
+0x5F, 0xC3, 0x31, 0x6A, 0x55, 0xAA, 0x35, 0xAA, 0xD5, 0xBE, 0x7F, 0xBF, 0xFF, 0xFF, 0x7F, 0x80,
+0xFA, 0xFD, 0xFE, 0xFF, 0xFC, 0xFF, 0x7A, 0x15, 0x02, 0x18, 0x05, 0x03, 0x9F, 0x00, 0x06, 0xFE,
+0xFF, 0xFF, 0x00, 0x00, 0x55, 0xEA, 0x82, 0xFF, 0x01, 0x7F, 0xBF, 0x81, 0xFF, 0x26, 0xAA, 0xF7,
+0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0x5F, 0xE0, 0x15, 0xAA, 0x50, 0x02, 0x95, 0x2A, 0x55, 0xAA,
+0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAF, 0x55, 0xBF,
+0x57, 0xFF, 0xDD, 0xFF, 0xB7, 0x8B, 0xFF, 0x0D, 0xFE, 0xFF, 0xFE, 0x7F, 0x7E, 0xFF, 0xEB, 0xD7,
+0xFE, 0xFD, 0xFC, 0xFE, 0xFC, 0xFE, 0x81, 0xFF, 0x03, 0x7F, 0x1F, 0x07, 0x01, 0x81, 0x00, 0x10,
+0x84, 0x54, 0xA8, 0x48, 0x28, 0x98, 0xD0, 0xF0, 0xF0, 0xE0, 0xA0, 0x40, 0xA0, 0x40, 0xC0, 0xC0,
+0xD0, 0x81, 0xB8, 0x16, 0xB0, 0x78, 0x70, 0x60, 0x70, 0x60, 0xF0, 0xE0, 0xC0, 0xA0, 0xC0, 0xA0,
+0xC0, 0x80, 0x40, 0x80, 0xC0, 0xEA, 0x3A, 0x00, 0x80, 0xD5, 0xFE, 0x81, 0xFF, 0x02, 0xEF, 0x7F,
+0xFA, 0x85, 0xFF, 0x21, 0x00, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0x00, 0xAA, 0x55, 0xAA, 0x50, 0xA5,
+0x40, 0x8A, 0x01, 0x56, 0x05, 0x4A, 0x75, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xBE,
+0x75, 0xDF, 0x7D, 0xDF, 0xFF, 0xFB, 0x83, 0xFF, 0x19, 0xA7, 0x43, 0x83, 0x27, 0x87, 0x6B, 0x43,
+0xCB, 0x45, 0x89, 0xC6, 0x8E, 0x05, 0x82, 0x14, 0x0A, 0x05, 0x89, 0x1C, 0x0A, 0x31, 0x87, 0x3F,
+0x1F, 0x07, 0x01, 0x81, 0x00, 0x17, 0x80, 0x40, 0x00, 0x20, 0xA0, 0xD1, 0xF0, 0xE6, 0x07, 0x07,
+0xEF, 0x57, 0xAA, 0x5D, 0xAE, 0x75, 0xAB, 0x55, 0xAA, 0x57, 0xBB, 0x5D, 0xEB, 0xF7, 0x82, 0xFF,
+0x05, 0x3F, 0x0F, 0xC6, 0xF2, 0xF8, 0xFC, 0x84, 0xFF, 0x05, 0x59, 0x99, 0x00, 0x00, 0xAA, 0xDD,
+0x81, 0xFF, 0x06, 0xF5, 0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xDF, 0x82, 0xFF, 0x73, 0x00, 0xAA, 0x00,
+0x00, 0x55, 0xFF, 0xF8, 0x02, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x54, 0xAA, 0x50, 0xA0, 0x41,
+0x80, 0x05, 0x0A, 0x15, 0x0A, 0x15, 0x2A, 0x55, 0xAA, 0x55, 0xAE, 0x55, 0xFF, 0x5E, 0xB7, 0x7F,
+0xDF, 0x7F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xDF, 0xCE, 0xCC, 0xED, 0xCA, 0xE9, 0xC3,
+0xC5, 0xD3, 0xA5, 0xD3, 0xB7, 0x13, 0x09, 0x0B, 0x05, 0x80, 0x00, 0xA0, 0x00, 0xAA, 0x54, 0xAA,
+0xDD, 0xEA, 0xDC, 0xEF, 0xD7, 0xAB, 0x75, 0xFB, 0xFD, 0x00, 0x00, 0xEA, 0xD5, 0xAA, 0x55, 0xAE,
+0x7F, 0xAF, 0xD7, 0xAA, 0x7D, 0xFA, 0x77, 0xAF, 0xDF, 0x1F, 0x07, 0xE3, 0xF0, 0xE8, 0xF4, 0xE9,
+0xF1, 0xE9, 0xD3, 0xE3, 0xD3, 0xA7, 0xC7, 0xA7, 0xC7, 0x5F, 0xAA, 0x00, 0x00, 0xAA, 0xFF, 0xDF,
+0xAF, 0x82, 0xFF, 0x01, 0x0B, 0x15, 0x81, 0x1F, 0x6E, 0x9F, 0xFF, 0xEF, 0x00, 0xFF, 0x00, 0x00,
+0x55, 0xFA, 0xFF, 0x00, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA,
+0x55, 0xAA, 0x54, 0xA8, 0x54, 0xA8, 0x50, 0xA0, 0x51, 0xA2, 0xC1, 0x82, 0x45, 0x82, 0x85, 0x8B,
+0x05, 0x8B, 0x15, 0x0F, 0x15, 0x0B, 0x97, 0x0F, 0x1F, 0x0F, 0x1F, 0x0F, 0x07, 0x07, 0x1F, 0x0F,
+0x8F, 0x47, 0x83, 0x41, 0xA8, 0x90, 0xE0, 0xC1, 0x02, 0x15, 0xAA, 0x55, 0xEE, 0xFD, 0xFB, 0x57,
+0xAF, 0xFF, 0xFF, 0xDF, 0xAB, 0x75, 0xFE, 0xFF, 0xF8, 0xE0, 0xC7, 0x9F, 0x3E, 0x7D, 0x7B, 0x7D,
+0xBB, 0x75, 0xAE, 0xDF, 0x2A, 0x05, 0x07, 0x80, 0x10, 0x2A, 0x57, 0xBB, 0xF7, 0xEF, 0xDF, 0xEF,
+0xF7, 0xFB, 0xF7, 0xEA, 0xD5, 0xBB, 0x7F, 0xFF,
@@ -1,64 +1,49 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0c, 0x0c, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x04, 0x08, 0x08, 0x1c, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x30, 0x40, 
-0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xc0, 0xc0, 0x20, 0x20, 0x10, 0x0c, 0x0c, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x06, 0x06, 0x18, 0x08, 
-0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x02, 0x06, 0x06, 0x38, 0x38, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xaa, 0xa4, 0x48, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x06, 0x08, 0x10, 0x10, 0x10, 
-0x10, 0xe0, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 
-0xf0, 0xf8, 0xfc, 0xfe, 0xfe, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x03, 0x03, 0x0c, 0x0c, 0x30, 0x40, 0x80, 0x00, 0x00, 0x00, 0x80, 0x40, 0x20, 0x18, 
-0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 
-0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xc0, 0x20, 0x20, 0x20, 0x30, 0x30, 0x0e, 0x0e, 0x01, 0x80, 0x80, 0x40, 0x40, 
-0x80, 0xa0, 0x40, 0x50, 0xa0, 0xa0, 0x50, 0x50, 0xa8, 0xa8, 0x50, 0x50, 0xa0, 0xa0, 0x50, 0x50, 
-0xaa, 0xaa, 0x55, 0x55, 0x2a, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 
-0xf8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf8, 0xfc, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x80, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0xc0, 0x30, 
-0x30, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf0, 0x01, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xa0, 0x50, 0x55, 0xaa, 0xaa, 0x55, 0x55, 
-0xaa, 0xaa, 0x55, 0x55, 0xaa, 0xaa, 0x55, 0x55, 0xaa, 0xaa, 0x55, 0x55, 0xaa, 0xaa, 0x55, 0x55, 
-0x1a, 0x0a, 0x09, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 
-0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x7f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x7f, 0xff, 0xfe, 0xe0, 0xc0, 0x80, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xfe, 0xff, 0xff, 0xff, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 
-0x3f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0x7f, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x55, 0xaa, 0xaa, 0x55, 0x55, 0xaa, 0xaa, 0x55, 0x55, 
-0xaa, 0xaa, 0x55, 0x55, 0x0a, 0x0a, 0x05, 0x01, 0x02, 0x02, 0x01, 0x05, 0x0a, 0x0a, 0x55, 0x55, 
-0xaa, 0xaa, 0x54, 0x54, 0xac, 0xac, 0x54, 0x58, 0xb0, 0xa0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0f, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x1f, 0x3f, 0xff, 0xff, 
-0xff, 0xe1, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x03, 0x03, 0x80, 0x50, 0x7a, 0x0f, 0x07, 0x07, 0x03, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x30, 0x10, 0x10, 0x10, 0x30, 0x20, 0x60, 0x80, 0x07, 
-0x07, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x07, 0x10, 0x40, 0x80, 0x03, 0x03, 0x80, 0x00, 
-0x80, 0x00, 0x80, 0x40, 0x27, 0x0f, 0xc7, 0x30, 0x30, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xe0, 
-0x1f, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x55, 0x55, 0xaa, 0xaa, 0x55, 0x55, 0xaa, 0xaa, 0x55, 0x55, 
-0xaa, 0xaa, 0x55, 0x55, 0xaa, 0xaa, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xa0, 0xa0, 0x55, 0x55, 
-0xaa, 0xaa, 0x55, 0x55, 0xaa, 0xaa, 0x55, 0x55, 0x2a, 0x1a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0x83, 0x86, 0x0c, 0x18, 0x30, 0x60, 0x40, 0xc0, 0x80, 0x00, 0x00, 0x01, 
-0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 
-0x60, 0x18, 0x06, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0x03, 0x06, 0x18, 0x18, 0x60, 0x60, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 
-0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x00, 0x80, 0x80, 0x60, 0x60, 0x18, 0x04, 0x04, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x05, 0x05, 0x0a, 0x0a, 0x15, 0x15, 
-0x2a, 0x2a, 0x55, 0x55, 0x2a, 0x2a, 0x55, 0x55, 0x2a, 0x2a, 0x55, 0x55, 0x2a, 0x2a, 0x55, 0x55, 
-0xaa, 0xea, 0x35, 0x0d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x81, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x04, 0x3c, 0xc0, 0x01, 0x03, 0x02, 0x02, 
-0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0c, 0x42, 0x42, 0x41, 0x21, 0x20, 0x10, 
-0x10, 0x10, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x05, 0x09, 0x12, 0x12, 0x22, 0x42, 0x82, 0x04, 0x04, 
-0x04, 0x04, 0x04, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0x80, 0xc0, 0xc0, 0x60, 0xb0, 0xf0, 0xb8, 0x7c, 0x7c, 0xf2, 0xf6, 0xe6, 0xea, 0xe6, 0xca, 0xca, 
-0xd6, 0xcc, 0x94, 0x94, 0xac, 0x54, 0x28, 0xa8, 0x58, 0xa8, 0x58, 0x50, 0x80, 0x70, 0x50, 0xd0, 
-0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xc0, 0x40, 0x71, 0x6e, 
-0x20, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x82, 0x05, 0x09, 0x09, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 
-0x02, 0x02, 0x02, 0xa2, 0x32, 0xfa, 0x7e, 0x7e, 0xbc, 0xda, 0xfa, 0xfb, 0xfb, 0xfb, 0xf6, 0xee, 
-0xde, 0x3c, 0xfc, 0xb8, 0x78, 0xf8, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x49, 
-0x68, 0x04, 0x40, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x60, 0x18, 0x1e, 
-0xe1, 0xef, 0xf3, 0x7c, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0x3f, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc2, 0x15, 0xaa, 0x55, 0x55, 0x2a, 0x95, 0xaa, 0xd5
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x87, 0x00, 0x02, 0xF0, 0x0C, 0x0C, 0x83, 0x02, 0x05, 0x04, 0x08, 0x08, 0x1C, 0x04, 0x04, 0x84,
+0x02, 0x00, 0x03, 0x83, 0x01, 0x00, 0x00, 0x84, 0x02, 0x80, 0x04, 0x80, 0x08, 0x03, 0x30, 0x40,
+0x40, 0x80, 0x8E, 0x00, 0x80, 0xC0, 0x80, 0x20, 0x02, 0x10, 0x0C, 0x0C, 0x83, 0x02, 0x00, 0x00,
+0x85, 0x01, 0x00, 0x00, 0x83, 0x02, 0x80, 0x06, 0x00, 0x18, 0x82, 0x08, 0x81, 0x04, 0x05, 0x02,
+0x06, 0x06, 0x38, 0x38, 0xC0, 0x92, 0x00, 0x04, 0xAA, 0xA4, 0x48, 0x70, 0x40, 0x82, 0x00, 0x03,
+0x01, 0x06, 0x06, 0x08, 0x82, 0x10, 0x02, 0xE0, 0x20, 0x20, 0x87, 0x00, 0x05, 0x80, 0xC0, 0xE0,
+0xF0, 0xF8, 0xFC, 0x81, 0xFE, 0x03, 0xFC, 0xF8, 0xF0, 0xE0, 0x86, 0x00, 0x80, 0x03, 0x80, 0x0C,
+0x02, 0x30, 0x40, 0x80, 0x81, 0x00, 0x05, 0x80, 0x40, 0x20, 0x18, 0x18, 0x07, 0x86, 0x00, 0x0E,
+0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x80, 0x88,
+0x00, 0x00, 0xC0, 0x81, 0x20, 0x80, 0x30, 0x80, 0x0E, 0x1A, 0x01, 0x80, 0x80, 0x40, 0x40, 0x80,
+0xA0, 0x40, 0x50, 0xA0, 0xA0, 0x50, 0x50, 0xA8, 0xA8, 0x50, 0x50, 0xA0, 0xA0, 0x50, 0x50, 0xAA,
+0xAA, 0x55, 0x55, 0x2A, 0x38, 0x87, 0x00, 0x80, 0xF8, 0x00, 0x07, 0x86, 0x00, 0x02, 0xC0, 0xF8,
+0xFC, 0x8B, 0xFF, 0x01, 0xF0, 0x80, 0x8B, 0x00, 0x81, 0x01, 0x80, 0x00, 0x03, 0xC0, 0x30, 0x30,
+0x08, 0x85, 0x00, 0x00, 0xF8, 0x8B, 0xFF, 0x03, 0xFE, 0xF0, 0x01, 0x7C, 0x83, 0x00, 0x01, 0x03,
+0xFE, 0x84, 0x00, 0x1C, 0x80, 0xA0, 0x50, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55,
+0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0x1A, 0x0A, 0x09, 0x07,
+0x01, 0x88, 0x00, 0x80, 0x3F, 0x00, 0xC0, 0x86, 0x00, 0x87, 0xFF, 0x00, 0x7F, 0x84, 0x3F, 0x05,
+0x7F, 0xFF, 0xFE, 0xE0, 0xC0, 0x80, 0x8C, 0x00, 0x00, 0xE3, 0x85, 0x00, 0x01, 0x40, 0xFE, 0x81,
+0xFF, 0x85, 0x3F, 0x00, 0x7F, 0x83, 0xFF, 0x00, 0x1F, 0x85, 0x00, 0x01, 0x80, 0x7F, 0x81, 0x00,
+0x25, 0xC0, 0x40, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55,
+0x0A, 0x0A, 0x05, 0x01, 0x02, 0x02, 0x01, 0x05, 0x0A, 0x0A, 0x55, 0x55, 0xAA, 0xAA, 0x54, 0x54,
+0xAC, 0xAC, 0x54, 0x58, 0xB0, 0xA0, 0xC0, 0x84, 0x00, 0x02, 0x0F, 0xF0, 0xF0, 0x84, 0x00, 0x03,
+0x03, 0x07, 0x1F, 0x3F, 0x81, 0xFF, 0x02, 0xE1, 0xC0, 0x80, 0x81, 0x00, 0x80, 0x03, 0x07, 0x80,
+0x50, 0x7A, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x82, 0x00, 0x02, 0x80, 0x60, 0x30, 0x81, 0x10, 0x05,
+0x30, 0x20, 0x60, 0x80, 0x07, 0x07, 0x81, 0x00, 0x16, 0x01, 0x02, 0x03, 0x03, 0x07, 0x10, 0x40,
+0x80, 0x03, 0x03, 0x80, 0x00, 0x80, 0x00, 0x80, 0x40, 0x27, 0x0F, 0xC7, 0x30, 0x30, 0x0F, 0x0F,
+0x82, 0x00, 0x01, 0xE0, 0x1F, 0x82, 0x00, 0x25, 0x2A, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAA,
+0xAA, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0x40, 0x40, 0x80, 0x80, 0x40, 0x40, 0xA0,
+0xA0, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0x2A, 0x1A, 0x1F, 0x86, 0x00,
+0x0D, 0x80, 0x83, 0x86, 0x0C, 0x18, 0x30, 0x60, 0x40, 0xC0, 0x80, 0x00, 0x00, 0x01, 0x01, 0x84,
+0x07, 0x80, 0x03, 0x83, 0x00, 0x06, 0x80, 0x60, 0x60, 0x18, 0x06, 0x06, 0x01, 0x88, 0x00, 0x80,
+0x03, 0x05, 0x06, 0x18, 0x18, 0x60, 0x60, 0x80, 0x85, 0x00, 0x84, 0x04, 0x80, 0x03, 0x08, 0x00,
+0x80, 0x80, 0x60, 0x60, 0x18, 0x04, 0x04, 0x03, 0x87, 0x00, 0x80, 0x02, 0x80, 0x05, 0x80, 0x0A,
+0x80, 0x15, 0x80, 0x2A, 0x80, 0x55, 0x80, 0x2A, 0x80, 0x55, 0x80, 0x2A, 0x80, 0x55, 0x80, 0x2A,
+0x80, 0x55, 0x04, 0xAA, 0xEA, 0x35, 0x0D, 0x03, 0x84, 0x00, 0x02, 0x3C, 0x42, 0x81, 0x83, 0x01,
+0x81, 0x00, 0x0A, 0x01, 0x03, 0x06, 0x04, 0x3C, 0xC0, 0x01, 0x03, 0x02, 0x02, 0x06, 0x86, 0x04,
+0x05, 0x0C, 0x42, 0x42, 0x41, 0x21, 0x20, 0x81, 0x10, 0x81, 0x08, 0x82, 0x04, 0x8B, 0x02, 0x07,
+0x04, 0x05, 0x09, 0x12, 0x12, 0x22, 0x42, 0x82, 0x83, 0x04, 0x00, 0x02, 0x81, 0x01, 0x86, 0x00,
+0x80, 0x80, 0x80, 0xC0, 0x1D, 0x60, 0xB0, 0xF0, 0xB8, 0x7C, 0x7C, 0xF2, 0xF6, 0xE6, 0xEA, 0xE6,
+0xCA, 0xCA, 0xD6, 0xCC, 0x94, 0x94, 0xAC, 0x54, 0x28, 0xA8, 0x58, 0xA8, 0x58, 0x50, 0x80, 0x70,
+0x50, 0xD0, 0x1E, 0x86, 0x00, 0x81, 0x80, 0x07, 0xC0, 0x40, 0x71, 0x6E, 0x20, 0x40, 0x80, 0x80,
+0x85, 0x00, 0x04, 0x01, 0x02, 0x04, 0x08, 0x10, 0x84, 0x20, 0x05, 0x82, 0x05, 0x09, 0x09, 0x08,
+0x08, 0x82, 0x04, 0x81, 0x02, 0x07, 0xA2, 0x32, 0xFA, 0x7E, 0x7E, 0xBC, 0xDA, 0xFA, 0x81, 0xFB,
+0x09, 0xF6, 0xEE, 0xDE, 0x3C, 0xFC, 0xB8, 0x78, 0xF8, 0xE0, 0x80, 0x83, 0x00, 0x80, 0x01, 0x03,
+0x49, 0x68, 0x04, 0x40, 0x81, 0x00, 0x00, 0x80, 0x83, 0xC0, 0x08, 0x80, 0x60, 0x18, 0x1E, 0xE1,
+0xEF, 0xF3, 0x7C, 0x7F, 0x82, 0xFF, 0x04, 0xFC, 0x03, 0xFF, 0xFF, 0x3F, 0x86, 0xFF, 0x09, 0xFE,
+0xC2, 0x15, 0xAA, 0x55, 0x55, 0x2A, 0x95, 0xAA, 0xD5,
@@ -1,64 +1,52 @@
-0x3f, 0x7f, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfb, 0xfb, 0xf1, 0xf6, 0x77, 0x0f, 0x0f, 0x0f, 0x07, 
-0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x20, 0x20, 0x10, 0x10, 0x10, 0x20, 0x20, 0x20, 
-0x20, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x83, 0x0f, 0x7f, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0x7f, 0xff, 0x5f, 0xbf, 0x5f, 0x2b, 0x15, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x05, 0x0f, 0x0b, 0x07, 0x0b, 0x06, 0x0f, 0x03, 0x05, 
-0x03, 0x05, 0x03, 0x07, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1f, 0x3f, 0x7f, 0x7f, 0x7e, 0xfd, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x10, 0x70, 0x90, 0x88, 
-0x88, 0x88, 0x88, 0x88, 0x08, 0x08, 0x11, 0x12, 0x14, 0x18, 0x10, 0x10, 0x10, 0x90, 0x50, 0x50, 
-0x50, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 
-0x07, 0x0f, 0x1f, 0x5f, 0xbf, 0x5f, 0xbf, 0x5f, 0xbf, 0x5f, 0x2f, 0x5f, 0x2f, 0x57, 0x2b, 0x17, 
-0x0b, 0x15, 0x0a, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 
-0xc0, 0xc0, 0xc0, 0xa0, 0xa0, 0xa0, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x20, 0x20, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x09, 0x81, 0x61, 0x11, 0xe9, 0x91, 0xae, 0x5a, 0x72, 
-0x02, 0x03, 0x06, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x12, 0x0a, 0x0c, 0x08, 0xd8, 0x70, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x20, 0x60, 0x80, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xd0, 0xd8, 0x94, 0x2e, 0xc6, 0xea, 0x37, 0xb7, 
-0x3b, 0xf3, 0xef, 0xdf, 0x5f, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf8, 0xe0, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xf8, 0xfe, 0xfe, 0xfe, 0xfc, 0xfe, 
-0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfe, 0x6f, 0x0c, 0xdc, 0xfd, 0xfc, 0xfd, 0x80, 0x00, 0x00, 
-0xf0, 0xfc, 0xfe, 0xff, 0xe7, 0xc3, 0xcb, 0x66, 0x1e, 0x00, 0x00, 0x00, 0x0e, 0x7f, 0xff, 0x8e, 
-0x02, 0x08, 0x10, 0x20, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 
-0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x80, 0x7c, 0xbe, 0xd8, 0xff, 0xf3, 0xf3, 0xf7, 0xef, 0xff, 0xff, 0xfe, 0xf9, 0xf6, 0xf6, 
-0xf7, 0xf7, 0xfb, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3b, 0xdd, 0xfd, 0xf3, 
-0xff, 0xff, 0xfc, 0xf0, 0x00, 0x80, 0xf8, 0x66, 0x73, 0x73, 0x81, 0x8f, 0xfe, 0xe2, 0x02, 0xf1, 
-0x00, 0x00, 0xc0, 0xc0, 0x60, 0xf0, 0xf0, 0xf0, 0x60, 0x80, 0xc0, 0xc1, 0x87, 0x0f, 0x1f, 0x1f, 
-0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 
-0xf8, 0xf1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf8, 0xfc, 0xfc, 0x9e, 0x65, 0xcd, 0x3e, 0xfc, 0xfc, 0xfc, 
-0xf5, 0xea, 0x68, 0xb0, 0xb4, 0x38, 0xf9, 0xf9, 0xe2, 0x00, 0x00, 0x04, 0x04, 0x00, 0x02, 0x01, 
-0x80, 0x70, 0xe8, 0xec, 0xdc, 0xbc, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 
-0x3e, 0x3f, 0x7c, 0x7f, 0x7f, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 
-0x7f, 0x7f, 0xff, 0xbf, 0x3f, 0xbf, 0x5f, 0xaf, 0x53, 0x29, 0x94, 0xc0, 0xff, 0xfe, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xfe, 0x7f, 0x03, 0x03, 0x03, 0x03, 0x03, 0x81, 0xc1, 0xf0, 0xf8, 0xff, 
-0xb8, 0x7f, 0x7c, 0x77, 0xcf, 0x97, 0x78, 0x7d, 0x3f, 0xdf, 0xed, 0xf3, 0xcf, 0xc7, 0xef, 0xc4, 
-0x1c, 0x1c, 0x0c, 0x0a, 0x0b, 0x07, 0x05, 0x0d, 0x0d, 0x3b, 0x3b, 0x73, 0x6b, 0xdb, 0xb7, 0xb7, 
-0xa7, 0x37, 0x77, 0xeb, 0xdb, 0x73, 0x6d, 0x5d, 0x3e, 0xbb, 0xb7, 0xae, 0xcd, 0x3f, 0x1f, 0x0f, 
-0x07, 0x7b, 0x76, 0x76, 0x79, 0x36, 0x38, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x7d, 
-0xfb, 0xef, 0xde, 0xbd, 0x7b, 0xf7, 0xde, 0x3d, 0xbb, 0xe7, 0x3a, 0xcc, 0xf0, 0xf8, 0x30, 0xe0, 
-0x80, 0x00, 0x03, 0x04, 0x06, 0x44, 0x63, 0xe4, 0xaa, 0xa8, 0xac, 0xa8, 0xac, 0xa8, 0xa6, 0xa0, 
-0xd0, 0xc8, 0xc7, 0xeb, 0xe4, 0xea, 0xf5, 0xfa, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 
-0x1f, 0x1f, 0x07, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 
-0x03, 0x03, 0x03, 0x03, 0x07, 0x0f, 0x1f, 0x1f, 0x1e, 0x1d, 0x1d, 0x01, 0x0d, 0x47, 0xf2, 0xf8, 
-0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xe0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc1, 
-0x21, 0xa1, 0xd3, 0x42, 0x9e, 0xbe, 0x3f, 0xab, 0x95, 0x41, 0xf1, 0xe1, 0x80, 0x00, 0x80, 0x80, 
-0xc0, 0xc0, 0xe0, 0xe0, 0xe0, 0xf0, 0xf0, 0xf4, 0xd8, 0xf8, 0xb4, 0xe8, 0xc0, 0x80, 0x00, 0x00, 
-0x00, 0x03, 0x03, 0x0f, 0x1f, 0x36, 0xfd, 0xff, 0xff, 0xff, 0xfa, 0xc7, 0x57, 0x97, 0xd8, 0x5e, 
-0x8f, 0xc0, 0x40, 0x20, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x31, 0x09, 0x89, 0x89, 
-0x3b, 0xbb, 0xbb, 0x93, 0x93, 0x03, 0x13, 0x17, 0x37, 0xbb, 0xbd, 0x81, 0x9e, 0x9e, 0x7f, 0x08, 
-0x08, 0xf8, 0x10, 0x10, 0x10, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xcf, 0xef, 0x0f, 0xef, 
-0x70, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x08, 0x04, 0x04, 0x04, 0x04, 0x01, 0x07, 
-0x2f, 0x17, 0x2f, 0x1f, 0x2f, 0x5f, 0x3f, 0x5f, 0xdf, 0xef, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfe, 0xfb, 0xf8, 0xf7, 0xf7, 0xf4, 0xf3, 0xf7, 0xf7, 0xfb, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xbf, 
-0x5f, 0x2f, 0x17, 0x2f, 0x17, 0x4f, 0xbf, 0xdf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 
-0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x11, 0x06, 0x47, 
-0x83, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x10, 0x20, 0x1c, 0x07, 0xc0, 0x30, 0xc8, 0x03, 0x00, 
-0xc0, 0xff, 0x4c, 0xea, 0x7f, 0x83, 0x7f, 0x7f, 0xff, 0xbf, 0xbf, 0xff, 0xff, 0x3f, 0x00, 0x00, 
-0x00, 0xff, 0x40, 0x80, 0x00, 0x07, 0x00, 0x00, 0x04, 0x18, 0x7c, 0x02, 0x02, 0x02, 0x02, 0x02
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x01, 0x3F, 0x7F, 0x81, 0xFE, 0x80, 0xFD, 0x80, 0xFB, 0x02, 0xF1, 0xF6, 0x77, 0x81, 0x0F, 0x80,
+0x07, 0x83, 0x00, 0x03, 0xC0, 0x00, 0x20, 0x20, 0x81, 0x10, 0x82, 0x20, 0x82, 0x00, 0x82, 0x40,
+0x80, 0x80, 0x02, 0x83, 0x0F, 0x7F, 0x91, 0xFF, 0x08, 0x7F, 0xFF, 0x5F, 0xBF, 0x5F, 0x2B, 0x15,
+0x06, 0x01, 0x89, 0x00, 0x11, 0x01, 0x06, 0x05, 0x0F, 0x0B, 0x07, 0x0B, 0x06, 0x0F, 0x03, 0x05,
+0x03, 0x05, 0x03, 0x07, 0x01, 0x02, 0x01, 0x8F, 0x00, 0x07, 0x01, 0x07, 0x1F, 0x3F, 0x7F, 0x7F,
+0x7E, 0xFD, 0x82, 0x00, 0x84, 0x01, 0x80, 0x00, 0x02, 0x10, 0x70, 0x90, 0x83, 0x88, 0x80, 0x08,
+0x03, 0x11, 0x12, 0x14, 0x18, 0x81, 0x10, 0x00, 0x90, 0x81, 0x50, 0x83, 0x20, 0x80, 0x40, 0x00,
+0x80, 0x81, 0x00, 0x80, 0x01, 0x80, 0x03, 0x14, 0x07, 0x0F, 0x1F, 0x5F, 0xBF, 0x5F, 0xBF, 0x5F,
+0xBF, 0x5F, 0x2F, 0x5F, 0x2F, 0x57, 0x2B, 0x17, 0x0B, 0x15, 0x0A, 0x05, 0x02, 0x97, 0x00, 0x80,
+0x80, 0x81, 0xC0, 0x81, 0xA0, 0x81, 0x20, 0x85, 0x10, 0x80, 0x20, 0x80, 0x40, 0x00, 0x80, 0x88,
+0x00, 0x00, 0x01, 0x92, 0x00, 0x81, 0x01, 0x0B, 0x09, 0x81, 0x61, 0x11, 0xE9, 0x91, 0xAE, 0x5A,
+0x72, 0x02, 0x03, 0x06, 0x83, 0x08, 0x06, 0x10, 0x12, 0x0A, 0x0C, 0x08, 0xD8, 0x70, 0x83, 0x00,
+0x00, 0x01, 0x81, 0x08, 0x82, 0x10, 0x02, 0x20, 0x60, 0x80, 0x94, 0x00, 0x10, 0x80, 0xC0, 0xE0,
+0xD0, 0xD8, 0x94, 0x2E, 0xC6, 0xEA, 0x37, 0xB7, 0x3B, 0xF3, 0xEF, 0xDF, 0x5F, 0xBF, 0x83, 0xFF,
+0x81, 0xFE, 0x01, 0xF8, 0xE0, 0x83, 0x00, 0x04, 0x01, 0x02, 0x04, 0x08, 0x08, 0x82, 0x10, 0x80,
+0x20, 0x87, 0x00, 0x01, 0x20, 0xF8, 0x81, 0xFE, 0x01, 0xFC, 0xFE, 0x84, 0xFC, 0x12, 0xFE, 0x6F,
+0x0C, 0xDC, 0xFD, 0xFC, 0xFD, 0x80, 0x00, 0x00, 0xF0, 0xFC, 0xFE, 0xFF, 0xE7, 0xC3, 0xCB, 0x66,
+0x1E, 0x81, 0x00, 0x09, 0x0E, 0x7F, 0xFF, 0x8E, 0x02, 0x08, 0x10, 0x20, 0x20, 0x80, 0x86, 0x00,
+0x02, 0x01, 0x86, 0x58, 0x8E, 0x00, 0x13, 0x80, 0x7C, 0xBE, 0xD8, 0xFF, 0xF3, 0xF3, 0xF7, 0xEF,
+0xFF, 0xFF, 0xFE, 0xF9, 0xF6, 0xF6, 0xF7, 0xF7, 0xFB, 0xFD, 0xFE, 0x84, 0xFF, 0x19, 0x7F, 0x3B,
+0xDD, 0xFD, 0xF3, 0xFF, 0xFF, 0xFC, 0xF0, 0x00, 0x80, 0xF8, 0x66, 0x73, 0x73, 0x81, 0x8F, 0xFE,
+0xE2, 0x02, 0xF1, 0x00, 0x00, 0xC0, 0xC0, 0x60, 0x81, 0xF0, 0x09, 0x60, 0x80, 0xC0, 0xC1, 0x87,
+0x0F, 0x1F, 0x1F, 0x3F, 0x7F, 0x8A, 0xFF, 0x80, 0xFC, 0x00, 0xF8, 0x82, 0xF1, 0x07, 0xF0, 0xF8,
+0xFC, 0xFC, 0x9E, 0x65, 0xCD, 0x3E, 0x81, 0xFC, 0x19, 0xF5, 0xEA, 0x68, 0xB0, 0xB4, 0x38, 0xF9,
+0xF9, 0xE2, 0x00, 0x00, 0x04, 0x04, 0x00, 0x02, 0x01, 0x80, 0x70, 0xE8, 0xEC, 0xDC, 0xBC, 0xF0,
+0xE0, 0xC0, 0x80, 0x83, 0x00, 0x03, 0x38, 0x3E, 0x3F, 0x7C, 0x81, 0x7F, 0x01, 0xFF, 0x7F, 0x85,
+0xFF, 0x81, 0x7F, 0x0B, 0xFF, 0xBF, 0x3F, 0xBF, 0x5F, 0xAF, 0x53, 0x29, 0x94, 0xC0, 0xFF, 0xFE,
+0x83, 0xFF, 0x80, 0xFE, 0x00, 0x7F, 0x83, 0x03, 0x3D, 0x81, 0xC1, 0xF0, 0xF8, 0xFF, 0xB8, 0x7F,
+0x7C, 0x77, 0xCF, 0x97, 0x78, 0x7D, 0x3F, 0xDF, 0xED, 0xF3, 0xCF, 0xC7, 0xEF, 0xC4, 0x1C, 0x1C,
+0x0C, 0x0A, 0x0B, 0x07, 0x05, 0x0D, 0x0D, 0x3B, 0x3B, 0x73, 0x6B, 0xDB, 0xB7, 0xB7, 0xA7, 0x37,
+0x77, 0xEB, 0xDB, 0x73, 0x6D, 0x5D, 0x3E, 0xBB, 0xB7, 0xAE, 0xCD, 0x3F, 0x1F, 0x0F, 0x07, 0x7B,
+0x76, 0x76, 0x79, 0x36, 0x38, 0x1F, 0x1F, 0x82, 0x00, 0x2C, 0x18, 0x3C, 0x7D, 0xFB, 0xEF, 0xDE,
+0xBD, 0x7B, 0xF7, 0xDE, 0x3D, 0xBB, 0xE7, 0x3A, 0xCC, 0xF0, 0xF8, 0x30, 0xE0, 0x80, 0x00, 0x03,
+0x04, 0x06, 0x44, 0x63, 0xE4, 0xAA, 0xA8, 0xAC, 0xA8, 0xAC, 0xA8, 0xA6, 0xA0, 0xD0, 0xC8, 0xC7,
+0xEB, 0xE4, 0xEA, 0xF5, 0xFA, 0xFC, 0xFE, 0x82, 0xFF, 0x06, 0x7F, 0x3F, 0x1F, 0x1F, 0x07, 0x07,
+0x03, 0x83, 0x00, 0x00, 0xF0, 0x82, 0xFF, 0x00, 0xFE, 0x82, 0x03, 0x0B, 0x07, 0x0F, 0x1F, 0x1F,
+0x1E, 0x1D, 0x1D, 0x01, 0x0D, 0x47, 0xF2, 0xF8, 0x82, 0xFC, 0x01, 0xF8, 0xE0, 0x83, 0x80, 0x82,
+0xC0, 0x12, 0xC1, 0x21, 0xA1, 0xD3, 0x42, 0x9E, 0xBE, 0x3F, 0xAB, 0x95, 0x41, 0xF1, 0xE1, 0x80,
+0x00, 0x80, 0x80, 0xC0, 0xC0, 0x81, 0xE0, 0x80, 0xF0, 0x06, 0xF4, 0xD8, 0xF8, 0xB4, 0xE8, 0xC0,
+0x80, 0x81, 0x00, 0x80, 0x03, 0x03, 0x0F, 0x1F, 0x36, 0xFD, 0x81, 0xFF, 0x0A, 0xFA, 0xC7, 0x57,
+0x97, 0xD8, 0x5E, 0x8F, 0xC0, 0x40, 0x20, 0xC0, 0x84, 0x00, 0x16, 0xC0, 0x31, 0x09, 0x89, 0x89,
+0x3B, 0xBB, 0xBB, 0x93, 0x93, 0x03, 0x13, 0x17, 0x37, 0xBB, 0xBD, 0x81, 0x9E, 0x9E, 0x7F, 0x08,
+0x08, 0xF8, 0x81, 0x10, 0x00, 0xF0, 0x83, 0x00, 0x07, 0x61, 0xCF, 0xEF, 0x0F, 0xEF, 0x70, 0x20,
+0x80, 0x82, 0x00, 0x02, 0xC0, 0x18, 0x08, 0x82, 0x04, 0x0C, 0x01, 0x07, 0x2F, 0x17, 0x2F, 0x1F,
+0x2F, 0x5F, 0x3F, 0x5F, 0xDF, 0xEF, 0xF3, 0x83, 0xFF, 0x0B, 0xFE, 0xFB, 0xF8, 0xF7, 0xF7, 0xF4,
+0xF3, 0xF7, 0xF7, 0xFB, 0xFC, 0xFE, 0x81, 0xFF, 0x09, 0xBF, 0x5F, 0x2F, 0x17, 0x2F, 0x17, 0x4F,
+0xBF, 0xDF, 0x7F, 0x83, 0xFF, 0x02, 0xFE, 0xFC, 0x70, 0x85, 0x00, 0x81, 0x01, 0x80, 0x00, 0x04,
+0x11, 0x06, 0x47, 0x83, 0x01, 0x81, 0x00, 0x18, 0x01, 0x0C, 0x10, 0x20, 0x1C, 0x07, 0xC0, 0x30,
+0xC8, 0x03, 0x00, 0xC0, 0xFF, 0x4C, 0xEA, 0x7F, 0x83, 0x7F, 0x7F, 0xFF, 0xBF, 0xBF, 0xFF, 0xFF,
+0x3F, 0x81, 0x00, 0x09, 0xFF, 0x40, 0x80, 0x00, 0x07, 0x00, 0x00, 0x04, 0x18, 0x7C, 0x83, 0x02,
@@ -1,64 +1,29 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x60, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe2, 0x72, 0x76, 0xa6, 0xa6, 0xee, 0xce, 0xce, 0xce, 0xce, 0xde, 0xde, 0x5e, 0x0e, 0xce, 
-0xcc, 0xec, 0xe0, 0xf0, 0xf0, 0xf0, 0x78, 0x78, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0c, 0x18, 0x30, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xf0, 0xf0, 0xf0, 0xf0, 0xf8, 
-0xf8, 0xf8, 0xf8, 0xf8, 0xf0, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x02, 0x06, 0x0c, 0x0c, 0x0c, 0x0e, 0x0e, 0x8e, 0x8e, 0xce, 0xce, 0x06, 0xc6, 0xf0, 0xf8, 
-0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x03, 0x00, 0xf2, 0xfb, 0xfd, 
-0xfd, 0xf9, 0x82, 0x6e, 0xde, 0xde, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 
-0x07, 0x0f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 
-0xf0, 0xf0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x60, 0x60, 0x20, 0x00, 0x80, 0xc0, 0xe8, 0xe4, 0xf6, 
-0xf6, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x77, 0x67, 0x27, 0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0x7f, 0xff, 
-0xfe, 0xfc, 0xf0, 0xc6, 0x1c, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0x78, 0x18, 0xcc, 0xe4, 0xf8, 
-0xfc, 0x3c, 0x0e, 0xc6, 0xf1, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x7f, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0f, 
-0x1f, 0xff, 0xff, 0xfe, 0xfc, 0xf9, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
-0x07, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x81, 0x00, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf0, 
-0x83, 0x0f, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x83, 0xf8, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf1, 0xc7, 
-0x0f, 0x3f, 0xff, 0xff, 0x7f, 0x1f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x04, 0x1f, 0x3f, 0x3f, 0x1f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf1, 0xe3, 0x07, 0x1f, 0x3f, 0xff, 0xff, 0xff, 0x3f, 
-0x07, 0x00, 0x13, 0x1c, 0x2f, 0x27, 0x33, 0x79, 0x7c, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 
-0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 
-0x1e, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0xc7, 0xe3, 0xf0, 0xfc, 
-0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 
-0x37, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xf7, 0xf3, 0xf3, 0x3b, 0x0b, 0x61, 0x71, 0x78, 0x7c, 
-0x7e, 0xff, 0xff, 0xfc, 0xf8, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xf0, 0xfe, 0x7f, 0x3f, 0xcf, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x0f, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x07, 0x0f, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0xe1, 0xe7, 0xff, 0x3f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x03, 0x04, 0x01, 0x07, 0x07, 0x0e, 0x0e, 0x0c, 0x1c, 0x1c, 0x38, 0x38, 0x7b, 0xf3, 0xe6, 
-0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0xc0, 0xc0, 0x60, 0x70, 0x38, 0x0e, 0x10, 0x1f, 0x0f, 0x83, 0xe0, 0xf0, 0x30, 0xc0, 0x70, 0x38, 
-0x1c, 0x0e, 0x0f, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xD4, 0x00, 0x02, 0x20, 0x60, 0x40, 0x82, 0xC0, 0x82, 0xE0, 0x05, 0xE2, 0x72, 0x76, 0xA6, 0xA6,
+0xEE, 0x82, 0xCE, 0x80, 0xDE, 0x05, 0x5E, 0x0E, 0xCE, 0xCC, 0xEC, 0xE0, 0x81, 0xF0, 0x80, 0x78,
+0x00, 0x1C, 0x86, 0x00, 0x03, 0x0C, 0x18, 0x30, 0x30, 0x84, 0x70, 0x82, 0xF0, 0x83, 0xF8, 0x81,
+0xF0, 0x80, 0xE0, 0x80, 0xC0, 0x00, 0x80, 0x94, 0x00, 0x81, 0x80, 0x85, 0xC0, 0x80, 0x80, 0x91,
+0x00, 0x01, 0x02, 0x06, 0x81, 0x0C, 0x80, 0x0E, 0x80, 0x8E, 0x80, 0xCE, 0x05, 0x06, 0xC6, 0xF0,
+0xF8, 0xFC, 0xFE, 0x86, 0xFF, 0x0C, 0x0F, 0x03, 0x00, 0xF2, 0xFB, 0xFD, 0xFD, 0xF9, 0x82, 0x6E,
+0xDE, 0xDE, 0x3C, 0x95, 0x00, 0x05, 0x01, 0x03, 0x07, 0x0F, 0x3F, 0x7F, 0x87, 0xFF, 0x04, 0xFE,
+0xFC, 0xF8, 0xF0, 0xF0, 0x83, 0xE0, 0x80, 0x60, 0x07, 0x20, 0x00, 0x80, 0xC0, 0xE8, 0xE4, 0xF6,
+0xF6, 0x83, 0xF3, 0x10, 0x77, 0x67, 0x27, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFE, 0xFC,
+0xF0, 0xC6, 0x1C, 0xFC, 0xFC, 0x82, 0xF8, 0x0B, 0x78, 0x18, 0xCC, 0xE4, 0xF8, 0xFC, 0x3C, 0x0E,
+0xC6, 0xF1, 0xFD, 0xFE, 0x82, 0xFF, 0x02, 0xC0, 0x00, 0x7F, 0x88, 0xFF, 0x01, 0x7F, 0x0F, 0x81,
+0x00, 0x09, 0x01, 0x07, 0x0F, 0x1F, 0xFF, 0xFF, 0xFE, 0xFC, 0xF9, 0x03, 0x9C, 0x00, 0x80, 0x01,
+0x80, 0x03, 0x86, 0x07, 0x81, 0x03, 0x80, 0x01, 0x81, 0x00, 0x00, 0xFE, 0x88, 0xFF, 0x03, 0x81,
+0x00, 0xFC, 0xFE, 0x83, 0xFF, 0x07, 0xFE, 0xFC, 0xF0, 0x83, 0x0F, 0xFF, 0x7F, 0x80, 0x82, 0xFF,
+0x02, 0x3F, 0x83, 0xF8, 0x83, 0xFF, 0x01, 0x00, 0xFE, 0x88, 0xFF, 0x0A, 0xFC, 0xF1, 0xC7, 0x0F,
+0x3F, 0xFF, 0xFF, 0x7F, 0x1F, 0x0F, 0x03, 0x86, 0x00, 0x06, 0x04, 0x1F, 0x3F, 0x3F, 0x1F, 0x0F,
+0x07, 0xB1, 0x00, 0x04, 0x03, 0x0F, 0x1F, 0x3F, 0x7F, 0x84, 0xFF, 0x06, 0xFE, 0xFC, 0xF1, 0xE3,
+0x07, 0x1F, 0x3F, 0x81, 0xFF, 0x0A, 0x3F, 0x07, 0x00, 0x13, 0x1C, 0x2F, 0x27, 0x33, 0x79, 0x7C,
+0x7E, 0x82, 0xFF, 0x03, 0x7F, 0x3F, 0x00, 0x80, 0x8B, 0xFF, 0x03, 0x7F, 0x1E, 0x80, 0x81, 0xCB,
+0x00, 0x01, 0x01, 0x0F, 0x85, 0xFF, 0x08, 0x3F, 0x00, 0x80, 0xC7, 0xE3, 0xF0, 0xFC, 0xFF, 0x07,
+0x8A, 0x00, 0x02, 0x02, 0x06, 0x37, 0x84, 0xE7, 0x10, 0xF7, 0xF3, 0xF3, 0x3B, 0x0B, 0x61, 0x71,
+0x78, 0x7C, 0x7E, 0xFF, 0xFF, 0xFC, 0xF8, 0xE0, 0xC0, 0x80, 0xC6, 0x00, 0x07, 0xF0, 0xFE, 0x7F,
+0x3F, 0xCF, 0x07, 0x03, 0x01, 0x81, 0x00, 0x00, 0x7F, 0x81, 0xFF, 0x00, 0x0F, 0x90, 0x00, 0x04,
+0x01, 0x07, 0x0F, 0x1F, 0x7F, 0x81, 0xFF, 0x87, 0x00, 0x05, 0x80, 0xE1, 0xE7, 0xFF, 0x3F, 0x0F,
+0xC5, 0x00, 0x11, 0x01, 0x03, 0x04, 0x01, 0x07, 0x07, 0x0E, 0x0E, 0x0C, 0x1C, 0x1C, 0x38, 0x38,
+0x7B, 0xF3, 0xE6, 0xC0, 0x80, 0x8B, 0x00, 0x15, 0x80, 0xC0, 0xC0, 0x60, 0x70, 0x38, 0x0E, 0x10,
+0x1F, 0x0F, 0x83, 0xE0, 0xF0, 0x30, 0xC0, 0x70, 0x38, 0x1C, 0x0E, 0x0F, 0x07, 0x03, 0x99, 0x00,
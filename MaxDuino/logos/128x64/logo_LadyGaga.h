@@ -1,64 +1,39 @@
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x03, 0x03, 0x07, 0x0e, 0x1c, 0x78, 0xf0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 
-0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf0, 
-0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 
-0x1f, 0x0f, 0x07, 0x07, 0x07, 0x03, 0x07, 0x06, 0x06, 0x04, 0x0c, 0x0c, 0x08, 0x18, 0x30, 0x30, 
-0xe0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf8, 0xc8, 0x00, 0x07, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x07, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0x7f, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80, 
-0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 
-0x00, 0x01, 0xff, 0x7f, 0x70, 0x28, 0x24, 0x23, 0x31, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-0x10, 0x10, 0x30, 0x30, 0x20, 0x60, 0x60, 0xc0, 0x80, 0x00, 0x00, 0x80, 0xc0, 0x30, 0x06, 0x03, 
-0x03, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xc1, 0xc0, 0xc0, 0x40, 0x41, 0x40, 
-0x40, 0x40, 0x40, 0x41, 0x41, 0x43, 0x43, 0x43, 0x43, 0xc7, 0x87, 0x0f, 0x1f, 0x3e, 0xfc, 0xf0, 
-0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 
-0x07, 0x0f, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x03, 0x01, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
-0x01, 0x01, 0x03, 0x02, 0x06, 0x06, 0x0c, 0x0c, 0x18, 0x10, 0x20, 0x60, 0x80, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x19, 0xf0, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x08, 0x18, 0x18, 0x18, 0x08, 0x08, 0x20, 0x20, 0x81, 0x02, 0x1c, 0xf8, 0xff, 
-0xff, 0xfc, 0xf1, 0x83, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x08, 0x18, 
-0x18, 0x18, 0x18, 0x38, 0x30, 0x30, 0x70, 0x70, 0x60, 0xe0, 0xe0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x1e, 
-0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xf8, 0x70, 0x00, 0x00, 0xf0, 0xff, 0x60, 0x38, 
-0x3c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x7f, 0xfc, 0xf0, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 
-0x80, 0x00, 0x00, 0x20, 0x20, 0x20, 0x60, 0x60, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf8, 0xfd, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0c, 0x18, 0x60, 0xc0, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x87, 0x81, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x07, 0x07, 
-0x0f, 0x1f, 0x3e, 0x7e, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf9, 0xfc, 0xfe, 0xff, 0x7b, 0x70, 0x70, 0x78, 
-0x7c, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7c, 0xe0, 0xe0, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x60, 0x3b, 
-0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x79, 0x1f, 0x7f, 0xff, 0xff, 
-0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x0c, 0x0c, 
-0x18, 0x18, 0x30, 0x30, 0x60, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1f, 0xff, 0x9f, 0x80, 0x80, 0x80, 0xc0, 0xe0, 0xf0, 
-0xfe, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc0, 
-0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe7, 0xe7, 0xcf, 0xcf, 0x8f, 0x8f, 0x8f, 
-0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x04, 0x04, 0x04, 0x02, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 
-0x80, 0x80, 0x40, 0x40, 0x20, 0x30, 0x10, 0x08, 0x04, 0x03, 0x01, 0x00, 0x00, 0xc0, 0x1f, 0x1f, 
-0x08, 0x08, 0x08, 0x18, 0x18, 0x18, 0x18, 0x10, 0x30, 0x30, 0x30, 0x60, 0x60, 0xe0, 0xc0, 0xc0, 
-0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0xfc, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc1, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 
-0x1f, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x02, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 
-0x00, 0x00, 0x80, 0x80, 0xc0, 0x40, 0x20, 0x20, 0x10, 0x08, 0x0c, 0x04, 0x03, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x95, 0xFF, 0x02, 0x1F, 0x0F, 0x07, 0x81, 0x03, 0x83, 0x01, 0x80, 0x03, 0x05, 0x07, 0x0E, 0x1C,
+0x78, 0xF0, 0x80, 0x88, 0x00, 0x00, 0x30, 0x87, 0x00, 0x03, 0x03, 0xFF, 0xF8, 0xF8, 0x87, 0xFC,
+0x82, 0xF8, 0x80, 0xF0, 0x80, 0xE0, 0x80, 0xC0, 0x00, 0x80, 0x84, 0x00, 0x00, 0x07, 0xB0, 0xFF,
+0x02, 0x7F, 0x1F, 0x0F, 0x81, 0x07, 0x0D, 0x03, 0x07, 0x06, 0x06, 0x04, 0x0C, 0x0C, 0x08, 0x18,
+0x30, 0x30, 0xE0, 0xC0, 0xC0, 0x83, 0x00, 0x01, 0xFF, 0x3F, 0x93, 0x00, 0x96, 0xFF, 0x07, 0xFE,
+0xFC, 0xF8, 0xF8, 0xC8, 0x00, 0x07, 0x03, 0x82, 0x00, 0x81, 0x01, 0x07, 0x03, 0x07, 0x07, 0x0F,
+0x1F, 0x3F, 0x7F, 0x7F, 0x9E, 0xFF, 0x00, 0x83, 0x83, 0x80, 0x83, 0xC0, 0x84, 0x80, 0x80, 0x00,
+0x07, 0x01, 0xFF, 0x7F, 0x70, 0x28, 0x24, 0x23, 0x31, 0x87, 0x10, 0x80, 0x30, 0x0D, 0x20, 0x60,
+0x60, 0xC0, 0x80, 0x00, 0x00, 0x80, 0xC0, 0x30, 0x06, 0x03, 0x03, 0x0F, 0x85, 0xFF, 0x05, 0xC7,
+0xC1, 0xC0, 0xC0, 0x40, 0x41, 0x82, 0x40, 0x80, 0x41, 0x82, 0x43, 0x09, 0xC7, 0x87, 0x0F, 0x1F,
+0x3E, 0xFC, 0xF0, 0xE0, 0xC0, 0x80, 0x89, 0x00, 0x05, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x7F, 0x95,
+0xFF, 0x03, 0x0F, 0x03, 0x01, 0x01, 0x8D, 0x00, 0x82, 0x01, 0x0A, 0x03, 0x02, 0x06, 0x06, 0x0C,
+0x0C, 0x18, 0x10, 0x20, 0x60, 0x80, 0x89, 0x00, 0x05, 0x01, 0x03, 0x07, 0x19, 0xF0, 0x80, 0x82,
+0x00, 0x00, 0xF0, 0x83, 0xFF, 0x01, 0xC3, 0x01, 0x87, 0x00, 0x00, 0x08, 0x81, 0x18, 0x80, 0x08,
+0x80, 0x20, 0x0E, 0x81, 0x02, 0x1C, 0xF8, 0xFF, 0xFF, 0xFC, 0xF1, 0x83, 0x06, 0x0C, 0x18, 0x30,
+0x60, 0x80, 0x89, 0x00, 0x03, 0x03, 0x07, 0x1F, 0x7F, 0x8A, 0xFF, 0x02, 0x7F, 0x3F, 0x1F, 0x81,
+0x0F, 0x81, 0x0C, 0x00, 0x08, 0x82, 0x18, 0x07, 0x38, 0x30, 0x30, 0x70, 0x70, 0x60, 0xE0, 0xE0,
+0x81, 0xC0, 0x80, 0x80, 0x8B, 0x00, 0x02, 0x03, 0x06, 0x1E, 0x83, 0xFE, 0x81, 0xFC, 0x09, 0xF8,
+0x70, 0x00, 0x00, 0xF0, 0xFF, 0x60, 0x38, 0x3C, 0x3F, 0x82, 0xFF, 0x81, 0x7F, 0x04, 0xFC, 0xF0,
+0xE0, 0xC0, 0xC0, 0x81, 0x80, 0x80, 0x00, 0x81, 0x20, 0x80, 0x60, 0x83, 0xF0, 0x01, 0xF8, 0xFD,
+0x83, 0xFF, 0x00, 0xF8, 0x83, 0x00, 0x05, 0x01, 0x02, 0x0C, 0x18, 0x60, 0xC0, 0x87, 0x00, 0x01,
+0x01, 0x0F, 0x86, 0xFF, 0x03, 0x87, 0x81, 0x80, 0x80, 0x92, 0x00, 0x80, 0x01, 0x0B, 0x03, 0x07,
+0x07, 0x0F, 0x1F, 0x3E, 0x7E, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x85, 0x00, 0x00, 0x03, 0x84, 0xFF,
+0x0A, 0xF3, 0xF9, 0xFC, 0xFE, 0xFF, 0x7B, 0x70, 0x70, 0x78, 0x7C, 0x7E, 0x82, 0x7F, 0x03, 0x7C,
+0xE0, 0xE0, 0xE1, 0x99, 0xFF, 0x00, 0xFE, 0x84, 0x00, 0x04, 0x80, 0xC0, 0x60, 0x3B, 0x0F, 0x87,
+0x00, 0x09, 0x80, 0x79, 0x1F, 0x7F, 0xFF, 0xFF, 0x01, 0x01, 0x00, 0x00, 0x82, 0x01, 0x81, 0x03,
+0x81, 0x06, 0x80, 0x0C, 0x80, 0x18, 0x80, 0x30, 0x03, 0x60, 0xE0, 0xC0, 0x80, 0x8B, 0x00, 0x04,
+0x01, 0x07, 0x1F, 0xFF, 0x9F, 0x81, 0x80, 0x03, 0xC0, 0xE0, 0xF0, 0xFE, 0x81, 0xFF, 0x06, 0x7F,
+0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x82, 0x00, 0x83, 0xC0, 0x00, 0x80, 0x81, 0x00, 0x04, 0x03,
+0x07, 0x0F, 0x3F, 0x7F, 0x89, 0xFF, 0x04, 0xF7, 0xE7, 0xE7, 0xCF, 0xCF, 0x81, 0x8F, 0x83, 0x0F,
+0x81, 0x04, 0x80, 0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x81, 0x80, 0x80, 0x40, 0x0B, 0x20, 0x30,
+0x10, 0x08, 0x04, 0x03, 0x01, 0x00, 0x00, 0xC0, 0x1F, 0x1F, 0x81, 0x08, 0x82, 0x18, 0x00, 0x10,
+0x81, 0x30, 0x80, 0x60, 0x04, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x82, 0x00, 0x04, 0x01, 0x03, 0x07,
+0xFC, 0xF8, 0x8B, 0x00, 0x89, 0xFF, 0x80, 0xF8, 0x80, 0xF0, 0x81, 0xE0, 0x83, 0xC0, 0x87, 0x80,
+0x84, 0xC0, 0x00, 0xC1, 0x8E, 0xFF, 0x01, 0x3F, 0x1F, 0x82, 0x07, 0x82, 0x06, 0x00, 0x02, 0x81,
+0x03, 0x81, 0x01, 0x80, 0x00, 0x80, 0x80, 0x08, 0xC0, 0x40, 0x20, 0x20, 0x10, 0x08, 0x0C, 0x04,
+0x03, 0x81, 0x00,
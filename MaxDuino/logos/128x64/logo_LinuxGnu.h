@@ -1,64 +1,34 @@
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x3f, 0x1f, 0x07, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-0x07, 0x07, 0x0f, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xf3, 0x00, 0x98, 0x0c, 0x1c, 0x78, 0x00, 0x00, 0x30, 0x78, 0x1c, 0x0c, 0x9c, 
-0xf8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x07, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x3f, 0x3f, 0x1f, 0x0f, 0x0f, 0x0f, 0x07, 
-0x07, 0x07, 0x07, 0x07, 0x0f, 0x1f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x07, 0x07, 
-0x07, 0x07, 0x07, 0x07, 0x0f, 0x0f, 0x0f, 0x1f, 0x3f, 0x3f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x1f, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x7f, 0x00, 0xe1, 0xcd, 0x9e, 0xbe, 0xbf, 0xbf, 0x9f, 0xde, 0xce, 0xe6, 0xf5, 
-0xf0, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x0f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 
-0x0f, 0x07, 0x03, 0x03, 0x01, 0x01, 0x80, 0xc0, 0xc0, 0xe0, 0xe0, 0xf0, 0xf8, 0xf8, 0xf8, 0xfc, 
-0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xf9, 0xff, 0xff, 0xfb, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 
-0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x01, 0x01, 0x03, 
-0x03, 0x07, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x03, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0f, 
-0x07, 0xc3, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0xf8, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0f, 0x1f, 0x7f, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xe0, 0xe0, 0xf0, 0xf0, 0xf0, 0xf0, 
-0xf8, 0xfc, 0xfe, 0xfe, 0xff, 0x0f, 0x01, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x01, 
-0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 
-0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xfe, 
-0xfe, 0xf8, 0xf8, 0xf0, 0xf0, 0xf0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xf0, 0xf8, 0xfe, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x07, 0x00, 0xe0, 0xf8, 
-0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 
-0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x7c, 0x7c, 0x7c, 0x7c, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x3f, 0x3f, 0x8f, 0xe0, 0xe0, 0xe0, 0xc0, 0x07, 0x1f, 
-0x3f, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0x18, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0x7d, 0x00, 0xc4, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 
-0xf8, 0xf0, 0xc0, 0x80, 0x21, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 
-0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x00, 0xe0, 0xff, 0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 
-0x7c, 0x78, 0x33, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xfc, 0xfc, 0xf9, 0xf9, 0xf9, 0xfb, 0xfb, 0xfb, 0xf3, 0xf3, 0xe7, 0xe7, 0xef, 0xcf, 
-0xcf, 0xcf, 0xcf, 0xc7, 0xc2, 0xf0, 0xf0, 0xf0, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 
-0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 0xc0, 0xcf, 0xdf, 0xdf, 0xcf, 0xc7, 0xe7, 0xf3, 0xf9, 0xf9, 0xfc, 
-0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 
-0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 
-0xff, 0xfe, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x92, 0xFF, 0x01, 0x3F, 0x1F, 0x81, 0x07, 0x85, 0x03, 0x80, 0x07, 0x02, 0x0F, 0x1F, 0x7F, 0x91,
+0xFF, 0x00, 0x1F, 0xBE, 0xFF, 0x01, 0xFE, 0x1F, 0x96, 0xFF, 0x0D, 0xF3, 0x00, 0x98, 0x0C, 0x1C,
+0x78, 0x00, 0x00, 0x30, 0x78, 0x1C, 0x0C, 0x9C, 0xF8, 0x82, 0x00, 0x00, 0x03, 0x8D, 0xFF, 0x03,
+0x7F, 0x07, 0x00, 0x00, 0x8C, 0xFF, 0x00, 0x7F, 0x81, 0x3F, 0x00, 0x1F, 0x81, 0x0F, 0x83, 0x07,
+0x02, 0x0F, 0x1F, 0x3F, 0x82, 0xFF, 0x02, 0x7F, 0x3F, 0x1F, 0x84, 0x07, 0x81, 0x0F, 0x00, 0x1F,
+0x81, 0x3F, 0x00, 0x7F, 0x8C, 0xFF, 0x02, 0x00, 0x01, 0x1F, 0x94, 0xFF, 0x0F, 0x7F, 0x00, 0xE1,
+0xCD, 0x9E, 0xBE, 0xBF, 0xBF, 0x9F, 0xDE, 0xCE, 0xE6, 0xF5, 0xF0, 0xE0, 0x80, 0x81, 0x00, 0x02,
+0x0F, 0x3F, 0x7F, 0x8A, 0xFF, 0x82, 0x00, 0x00, 0x07, 0x85, 0x0F, 0x0A, 0x07, 0x03, 0x03, 0x01,
+0x01, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0x81, 0xF8, 0x81, 0xFC, 0x82, 0xFE, 0x06, 0xFC, 0xF9,
+0xFF, 0xFF, 0xFB, 0xFC, 0xFC, 0x81, 0xFE, 0x82, 0xFC, 0x80, 0xF8, 0x80, 0xF0, 0x09, 0xE0, 0xC0,
+0xC0, 0x80, 0x80, 0x01, 0x01, 0x03, 0x03, 0x07, 0x84, 0x0F, 0x01, 0x07, 0x03, 0x81, 0x00, 0x00,
+0x03, 0x8E, 0xFF, 0x06, 0x3F, 0x0F, 0x07, 0xC3, 0xF8, 0xFC, 0xFE, 0x8C, 0xFF, 0x02, 0xFE, 0xF8,
+0xC0, 0x81, 0x00, 0x04, 0x01, 0x03, 0x0F, 0x1F, 0x7F, 0x85, 0xFF, 0x02, 0xF8, 0xF0, 0xF0, 0x82,
+0xE0, 0x82, 0xF0, 0x08, 0xF8, 0xFC, 0xFE, 0xFE, 0xFF, 0x0F, 0x01, 0x00, 0x00, 0x81, 0xF8, 0x81,
+0x00, 0x00, 0x01, 0x82, 0xFF, 0x02, 0x03, 0x00, 0x00, 0x81, 0xF8, 0x81, 0x00, 0x00, 0x01, 0x81,
+0xFF, 0x82, 0x00, 0x82, 0xFF, 0x81, 0x00, 0x80, 0xFF, 0x81, 0xFE, 0x80, 0xF8, 0x81, 0xF0, 0x83,
+0xE0, 0x02, 0xF0, 0xF8, 0xFE, 0x8B, 0xFF, 0x05, 0x1F, 0x07, 0x00, 0xE0, 0xF8, 0xFE, 0x93, 0xFF,
+0x01, 0xFE, 0xF8, 0x84, 0x00, 0x02, 0x01, 0x07, 0x1F, 0x92, 0xFF, 0x82, 0x00, 0x80, 0xFF, 0x00,
+0x7F, 0x82, 0x7C, 0x82, 0xFF, 0x81, 0x00, 0x81, 0xFF, 0x82, 0x00, 0x81, 0xFF, 0x82, 0x00, 0x82,
+0xFF, 0x81, 0x00, 0x97, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0x00, 0x8F, 0x81, 0xE0, 0x05, 0xC0, 0x07,
+0x1F, 0x3F, 0x7F, 0x7F, 0x90, 0xFF, 0x80, 0x0F, 0x00, 0xCF, 0x85, 0x00, 0x02, 0x80, 0x18, 0x7F,
+0x91, 0xFF, 0x82, 0x00, 0x80, 0xFF, 0x00, 0xFE, 0x82, 0x00, 0x82, 0xFF, 0x81, 0x00, 0x81, 0xFF,
+0x82, 0x00, 0x81, 0xFF, 0x82, 0x00, 0x82, 0xFF, 0x81, 0x00, 0x94, 0xFF, 0x02, 0x7D, 0x00, 0xC4,
+0x81, 0xFE, 0x85, 0xFF, 0x06, 0xFE, 0xF8, 0xF0, 0xC0, 0x80, 0x21, 0x73, 0x86, 0xFF, 0x81, 0x7F,
+0x09, 0x3F, 0x1F, 0x0F, 0x07, 0x00, 0xE0, 0xFF, 0xFE, 0xFE, 0xFC, 0x81, 0xFE, 0x80, 0xFF, 0x03,
+0x7C, 0x78, 0x33, 0x27, 0x8F, 0xFF, 0x00, 0x80, 0x81, 0x00, 0x81, 0xFF, 0x82, 0x00, 0x82, 0xFF,
+0x81, 0x00, 0x81, 0xFF, 0x82, 0x00, 0x81, 0xFF, 0x82, 0x00, 0x82, 0xFF, 0x81, 0x00, 0x94, 0xFF,
+0x80, 0xFC, 0x81, 0xF9, 0x81, 0xFB, 0x80, 0xF3, 0x80, 0xE7, 0x00, 0xEF, 0x82, 0xCF, 0x01, 0xC7,
+0xC2, 0x81, 0xF0, 0x88, 0xF8, 0x80, 0xF0, 0x0D, 0xE0, 0xC0, 0xCF, 0xDF, 0xDF, 0xCF, 0xC7, 0xE7,
+0xF3, 0xF9, 0xF9, 0xFC, 0xFE, 0xFE, 0x92, 0xFF, 0x00, 0xFC, 0x86, 0xF8, 0x00, 0xFC, 0x82, 0xFF,
+0x81, 0xF8, 0x81, 0xFF, 0x82, 0xF8, 0x81, 0xFF, 0x01, 0xFE, 0xFC, 0x86, 0xF8, 0x00, 0xFC, 0x92,
+0xFF,
@@ -1,64 +1,39 @@
-0x00, 0xf8, 0xfc, 0xfc, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
-0x3c, 0x3c, 0x3c, 0x7c, 0xfc, 0xfc, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0xf8, 0xfc, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
-0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0xfc, 0xfc, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
-0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
-0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0xfc, 0xfc, 0xfc, 0xbc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
-0xfc, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xfc, 
-0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xbc, 0xfc, 0xfc, 0xfc, 0x7c, 0x1c, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x07, 0x3f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x80, 0xf8, 0xff, 0xff, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0x7f, 0xfe, 0xf8, 0xe0, 0x80, 0x00, 
-0x00, 0x03, 0x0f, 0x3f, 0xff, 0xfc, 0xf0, 0xc0, 0x80, 0xe0, 0xf8, 0xff, 0x7f, 0x1f, 0x07, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0xe0, 0xf8, 0xfe, 0x7f, 0x1f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xf0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xf0, 0xff, 0xff, 0x3f, 0x03, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x03, 0x03, 
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x07, 0x1f, 0x7f, 0xfe, 
-0xf8, 0xe0, 0x80, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0x7f, 0x1f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0xc0, 0xf0, 0xfc, 0xff, 0x3f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x07, 0x1f, 
-0xff, 0xff, 0xf8, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xf0, 0x80, 0xf0, 0xff, 
-0xff, 0x7f, 0x03, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x07, 0x1f, 0x7f, 0xfe, 0xf8, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xff, 
-0x3f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x01, 0x0f, 0xff, 0xff, 0xfe, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0xff, 0xff, 0xff, 0x7f, 
-0x07, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xfe, 0xff, 0x7f, 0x07, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 
-0xf0, 0xfc, 0xff, 0x3f, 0x0f, 0x03, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3f, 
-0xff, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x07, 0x7f, 0xff, 0xff, 0xf0, 0x80, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x0f, 0x00, 
-0x00, 0x00, 0x80, 0xf0, 0xff, 0xff, 0x7f, 0x07, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xff, 0x3f, 
-0x0f, 0x03, 0x00, 0x00, 0x80, 0xe0, 0xf8, 0xfe, 0x7f, 0x3f, 0xff, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 
-0x00, 0x03, 0x0f, 0x3f, 0xff, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xf8, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0xf8, 0xff, 0xff, 0x3f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf8, 0xfe, 0x7f, 0x1f, 0x03, 0x00, 0x00, 
-0x00, 0xc0, 0xf0, 0xfe, 0xff, 0x3f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0xff, 0xfc, 
-0xf0, 0xc0, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0xff, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x1f, 0x3f, 0x3f, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x3f, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
-0x3f, 0x3f, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3c, 
-0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0x3f, 0x3f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x1f, 0x3f, 0x3f, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0x3f, 0x3f, 0x1f, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x3e, 0x3f, 0x3f, 0x3f, 0x3d, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
-0x3f, 0x1f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0x0f, 0x1f, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0x3f, 0x3f, 0x3f, 0x3c, 0x30, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x01, 0x00, 0xF8, 0x81, 0xFC, 0x8C, 0x3C, 0x03, 0x7C, 0xFC, 0xFC, 0xF0, 0x8A, 0x00, 0x03, 0x80,
+0xF8, 0xFC, 0xFC, 0x8B, 0x3C, 0x82, 0xFC, 0x9C, 0x3C, 0x82, 0xFC, 0x00, 0xBC, 0x83, 0x3C, 0x80,
+0xFC, 0x01, 0xF0, 0xC0, 0x86, 0x00, 0x03, 0xC0, 0xF0, 0xFC, 0xFC, 0x85, 0x3C, 0x00, 0xBC, 0x81,
+0xFC, 0x01, 0x7C, 0x1C, 0x82, 0x00, 0x82, 0xFF, 0x84, 0x00, 0x82, 0xC0, 0x83, 0x00, 0x04, 0x07,
+0x3F, 0xFF, 0xFF, 0xF0, 0x86, 0x00, 0x05, 0x80, 0xF8, 0xFF, 0xFF, 0x1F, 0x01, 0x82, 0x00, 0x82,
+0xC0, 0x83, 0x00, 0x82, 0xFF, 0x8A, 0xC0, 0x83, 0x00, 0x8A, 0xC0, 0x00, 0xE0, 0x81, 0xFF, 0x15,
+0x1F, 0x7F, 0xFE, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x80,
+0xE0, 0xF8, 0xFF, 0x7F, 0x1F, 0x07, 0x82, 0x00, 0x07, 0x80, 0xE0, 0xF8, 0xFE, 0x7F, 0x1F, 0x07,
+0x01, 0x84, 0x00, 0x82, 0xFF, 0x84, 0x00, 0x83, 0xFF, 0x01, 0xF0, 0x80, 0x82, 0x00, 0x04, 0x03,
+0x3F, 0xFF, 0xFF, 0xF0, 0x83, 0x00, 0x04, 0xF0, 0xFF, 0xFF, 0x3F, 0x03, 0x82, 0x00, 0x01, 0xC0,
+0xFC, 0x82, 0xFF, 0x83, 0x00, 0x82, 0xFF, 0x86, 0x03, 0x82, 0xFF, 0x83, 0x00, 0x82, 0xFF, 0x8A,
+0x03, 0x80, 0x00, 0x10, 0x01, 0x07, 0x1F, 0x7F, 0xFE, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x03, 0x0F,
+0x3F, 0x7F, 0x1F, 0x07, 0x01, 0x82, 0x00, 0x06, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F, 0x07, 0x01, 0x88,
+0x00, 0x82, 0xFF, 0x84, 0x00, 0x81, 0xFF, 0x05, 0x07, 0x1F, 0xFF, 0xFF, 0xF8, 0xC0, 0x82, 0x00,
+0x0A, 0x03, 0x3F, 0xFF, 0xFF, 0xF0, 0x80, 0xF0, 0xFF, 0xFF, 0x7F, 0x03, 0x82, 0x00, 0x04, 0xE0,
+0xFE, 0xFF, 0xFF, 0x0F, 0x81, 0xFF, 0x83, 0x00, 0x82, 0xFF, 0x86, 0x00, 0x82, 0xFF, 0x83, 0x00,
+0x82, 0xFF, 0x91, 0x00, 0x06, 0x07, 0x1F, 0x7F, 0xFE, 0xF8, 0xE0, 0x80, 0x83, 0x00, 0x06, 0xC0,
+0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x8C, 0x00, 0x82, 0xFF, 0x84, 0x00, 0x81, 0xFF, 0x80, 0x00,
+0x05, 0x01, 0x0F, 0xFF, 0xFF, 0xFE, 0xE0, 0x82, 0x00, 0x01, 0x03, 0x1F, 0x81, 0xFF, 0x01, 0x7F,
+0x07, 0x82, 0x00, 0x06, 0xF0, 0xFE, 0xFF, 0x7F, 0x07, 0x00, 0x00, 0x81, 0xFF, 0x83, 0x00, 0x82,
+0xFF, 0x86, 0x00, 0x82, 0xFF, 0x83, 0x00, 0x82, 0xFF, 0x90, 0x00, 0x0A, 0xC0, 0xF0, 0xFC, 0xFF,
+0x3F, 0x0F, 0x03, 0x00, 0x00, 0x80, 0x80, 0x81, 0x00, 0x06, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0,
+0xC0, 0x8B, 0x00, 0x82, 0xFF, 0x84, 0x00, 0x81, 0xFF, 0x83, 0x00, 0x05, 0x07, 0x7F, 0xFF, 0xFF,
+0xF0, 0x80, 0x81, 0x00, 0x02, 0x01, 0x1F, 0x0F, 0x81, 0x00, 0x05, 0x80, 0xF0, 0xFF, 0xFF, 0x7F,
+0x07, 0x82, 0x00, 0x81, 0xFF, 0x83, 0x00, 0x82, 0xFF, 0x86, 0x00, 0x82, 0xFF, 0x83, 0x00, 0x82,
+0xFF, 0x8C, 0x00, 0x12, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x80, 0xE0, 0xF8,
+0xFE, 0x7F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x81, 0x00, 0x06, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0,
+0xC0, 0x87, 0x00, 0x82, 0xFF, 0x84, 0x00, 0x81, 0xFF, 0x85, 0x00, 0x05, 0x03, 0x3F, 0xFF, 0xFF,
+0xF8, 0xC0, 0x83, 0x00, 0x05, 0x80, 0xF8, 0xFF, 0xFF, 0x3F, 0x03, 0x84, 0x00, 0x81, 0xFF, 0x83,
+0x00, 0x82, 0xFF, 0x86, 0x00, 0x82, 0xFF, 0x83, 0x00, 0x82, 0xFF, 0x88, 0x00, 0x06, 0x80, 0xE0,
+0xF8, 0xFE, 0x7F, 0x1F, 0x03, 0x81, 0x00, 0x06, 0xC0, 0xF0, 0xFE, 0xFF, 0x3F, 0x07, 0x01, 0x81,
+0x00, 0x06, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x81, 0x00, 0x06, 0x03, 0x0F, 0x3F, 0xFF,
+0xFC, 0xF0, 0xC0, 0x83, 0x00, 0x00, 0x1F, 0x81, 0x3F, 0x84, 0x3C, 0x81, 0x3F, 0x87, 0x00, 0x03,
+0x01, 0x1F, 0x3F, 0x3F, 0x83, 0x3C, 0x80, 0x3F, 0x01, 0x1F, 0x03, 0x86, 0x00, 0x81, 0x3F, 0x83,
+0x3C, 0x81, 0x3F, 0x00, 0x1F, 0x86, 0x00, 0x00, 0x1F, 0x81, 0x3F, 0x83, 0x3C, 0x81, 0x3F, 0x00,
+0x1F, 0x86, 0x00, 0x01, 0x38, 0x3E, 0x81, 0x3F, 0x00, 0x3D, 0x83, 0x3C, 0x03, 0x3F, 0x1F, 0x0F,
+0x03, 0x89, 0x00, 0x03, 0x03, 0x0F, 0x1F, 0x3F, 0x84, 0x3C, 0x82, 0x3F, 0x02, 0x3C, 0x30, 0x00,
@@ -1,64 +1,36 @@
-0xe0, 0xf0, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe, 0x7e, 0x7e, 0x7e, 0xde, 0xde, 0xd6, 0x74, 0x2d, 0x2f, 
-0x1f, 0x3f, 0x1f, 0x3f, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 
-0x7f, 0x7f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x7f, 0x3f, 0x7f, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfb, 0x77, 0x77, 0xef, 0xff, 0x7f, 0x7f, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfe, 0xfd, 0xff, 0x7f, 0x7f, 0xff, 0xdf, 0xbf, 0xbf, 0x3f, 0x3f, 0x7f, 0x7f, 0x7f, 0xfe, 0xfd, 
-0xfb, 0x3f, 0x7c, 0xf8, 0xe1, 0xb8, 0x80, 0xe0, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xe0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x03, 0x3f, 0x03, 0x01, 0x00, 0xe0, 0xf0, 0xf0, 0xf8, 
-0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xf8, 0xf8, 0xf0, 0xf0, 0xf0, 0xe0, 0xe3, 0xc3, 0xc3, 0x87, 
-0x07, 0x07, 0x0f, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xcf, 0xcf, 0xc7, 0xc3, 0xc1, 0xf1, 0xe1, 0xe0, 0xc0, 0xe0, 0xf0, 0xe0, 0xf8, 
-0xf8, 0xf0, 0xf0, 0xf0, 0xf8, 0xf8, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfe, 0xec, 0x81, 0x03, 0x87, 0xcd, 0xfa, 0xf0, 0xe0, 0xc0, 0x80, 0x01, 
-0x01, 0x02, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfa, 0xf8, 
-0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x03, 
-0x01, 0x03, 0x07, 0x17, 0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x87, 0xf7, 0xf7, 0xf7, 0xf3, 0xe7, 0xf3, 
-0xf2, 0xf8, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf3, 0xe4, 0x1b, 0x3f, 0x3f, 0x7b, 0xc1, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x1f, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xf3, 0xc3, 0x43, 0x01, 0x83, 0xc3, 0xe3, 0x83, 0xc3, 0x03, 0x81, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0xc0, 0xe0, 0xe0, 0xf0, 0xf2, 0xf8, 0xfc, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0x3f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x3f, 0x7f, 0x7f, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x7f, 0x3f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xfe, 0xf8, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x3f, 0x7f, 0xe7, 0xe7, 0xe7, 0xf1, 0xd0, 0xc8, 0xc8, 
-0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 
-0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xe1, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xe0, 0xf3, 
-0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xfc, 0xf2, 0x9d, 0xf9, 0xf3, 0xef, 0xdf, 0x3f, 
-0xff, 0xff, 0xff, 0xff, 0xfd, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x7f, 0x3f, 0x1f, 0x1f, 0x0f, 0x0f, 0x07, 0x37, 
-0x7f, 0x7f, 0xbf, 0xbf, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xdf, 0xdf, 0xdf, 0x1f, 0x9f, 0x9f, 
-0x9f, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfe, 0xf3, 0xff, 0xff, 0xfd, 0xf3, 0x0e, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x1f, 0x7f, 
-0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xc0, 0xc0, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x14, 
-0x1a, 0x3f, 0x7f, 0x7f, 0xff, 0x7d, 0x7d, 0x3f, 0x7f, 0xff, 0xbf, 0xdf, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0xc0, 0xe0, 0xe0, 0xe0, 0xe0, 0xc0, 0xc0, 0xe0, 0xe0, 0xe0, 0xf0, 0xf0, 0xf8, 0xf8, 0xf8, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x5f, 0xbf, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0x5f, 0x4f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x07, 0x1f, 0x3f, 0x3f, 0x3f, 0x1f, 0x07, 0x07, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0xe0, 0xf0, 
-0xf0, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 
-0xf7, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xe0, 0x80, 0x78, 0xfe, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x06, 0xE0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0x81, 0x7E, 0x80, 0xDE, 0x07, 0xD6, 0x74, 0x2D,
+0x2F, 0x1F, 0x3F, 0x1F, 0x3F, 0x81, 0xFF, 0x03, 0xFE, 0xFC, 0xFB, 0xFF, 0x85, 0x7F, 0x83, 0x3F,
+0x01, 0x7F, 0x3F, 0x81, 0x7F, 0x91, 0xFF, 0x80, 0xFC, 0x00, 0xFE, 0x8C, 0xFF, 0x08, 0xFB, 0x77,
+0x77, 0xEF, 0xFF, 0x7F, 0x7F, 0x3F, 0x3F, 0x85, 0xFF, 0x0A, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xFF,
+0xDF, 0xBF, 0xBF, 0x3F, 0x3F, 0x81, 0x7F, 0x0C, 0xFE, 0xFD, 0xFB, 0x3F, 0x7C, 0xF8, 0xE1, 0xB8,
+0x80, 0xE0, 0xFC, 0xFF, 0xFF, 0x83, 0x00, 0x83, 0xFF, 0x01, 0xF3, 0xE0, 0x81, 0xC0, 0x81, 0x80,
+0x86, 0x00, 0x09, 0x01, 0x07, 0x03, 0x3F, 0x03, 0x01, 0x00, 0xE0, 0xF0, 0xF0, 0x84, 0xF8, 0x02,
+0xFC, 0xF8, 0xF8, 0x81, 0xF0, 0x0B, 0xE0, 0xE3, 0xC3, 0xC3, 0x87, 0x07, 0x07, 0x0F, 0x0F, 0x1F,
+0x3F, 0x7F, 0x8A, 0xFF, 0x80, 0xCF, 0x0B, 0xC7, 0xC3, 0xC1, 0xF1, 0xE1, 0xE0, 0xC0, 0xE0, 0xF0,
+0xE0, 0xF8, 0xF8, 0x81, 0xF0, 0x80, 0xF8, 0x80, 0xFE, 0x8A, 0xFF, 0x0F, 0xFE, 0xEC, 0x81, 0x03,
+0x87, 0xCD, 0xFA, 0xF0, 0xE0, 0xC0, 0x80, 0x01, 0x01, 0x02, 0x00, 0xFD, 0x82, 0xFF, 0x80, 0x1F,
+0x84, 0x00, 0x8A, 0xFF, 0x04, 0xFE, 0xFC, 0xFA, 0xF8, 0x78, 0x89, 0x00, 0x07, 0x01, 0x03, 0x07,
+0x03, 0x01, 0x03, 0x07, 0x17, 0x82, 0x0F, 0x01, 0x07, 0x87, 0x81, 0xF7, 0x05, 0xF3, 0xE7, 0xF3,
+0xF2, 0xF8, 0xE0, 0x82, 0x00, 0x01, 0x01, 0x07, 0xAB, 0xFF, 0x07, 0xF9, 0xF3, 0xE4, 0x1B, 0x3F,
+0x3F, 0x7B, 0xC1, 0x83, 0x00, 0x03, 0x1F, 0x07, 0x03, 0x01, 0x87, 0x00, 0x81, 0xFF, 0x0B, 0xF3,
+0xC3, 0x43, 0x01, 0x83, 0xC3, 0xE3, 0x83, 0xC3, 0x03, 0x81, 0x01, 0x8E, 0x00, 0x09, 0x80, 0xC0,
+0xE0, 0xE0, 0xF0, 0xF2, 0xF8, 0xFC, 0xFC, 0xFE, 0x86, 0xFF, 0x01, 0x3F, 0x1F, 0x85, 0x00, 0x03,
+0x1F, 0x3F, 0x7F, 0x7F, 0x83, 0xFF, 0x03, 0x7F, 0x3F, 0x3F, 0x7F, 0x9D, 0xFF, 0x04, 0x7F, 0xFF,
+0xFE, 0xF8, 0xF0, 0x93, 0x00, 0x84, 0xFF, 0x80, 0x3F, 0x00, 0x7F, 0x81, 0xE7, 0x03, 0xF1, 0xD0,
+0xC8, 0xC8, 0x81, 0xC0, 0x80, 0x80, 0x87, 0x00, 0x06, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F,
+0x89, 0xFF, 0x02, 0xE1, 0x80, 0x80, 0x84, 0x00, 0x82, 0x80, 0x03, 0xC0, 0xE0, 0xF3, 0xF7, 0x83,
+0xFF, 0x80, 0xFE, 0x8B, 0xFF, 0x00, 0xFB, 0x8F, 0xFF, 0x00, 0x87, 0x81, 0x07, 0x93, 0x00, 0x84,
+0xFF, 0x09, 0x1C, 0xFF, 0xFC, 0xF2, 0x9D, 0xF9, 0xF3, 0xEF, 0xDF, 0x3F, 0x82, 0xFF, 0x01, 0xFD,
+0xB1, 0x8E, 0x00, 0x04, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x87, 0xFF, 0x81, 0xFE, 0x0A, 0xFF, 0x7F,
+0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x37, 0x7F, 0x7F, 0x81, 0xBF, 0x03, 0xFF, 0xDF, 0xFF, 0xFF,
+0x82, 0xDF, 0x00, 0x1F, 0x81, 0x9F, 0x80, 0xDF, 0x92, 0xFF, 0x00, 0x7F, 0x96, 0x00, 0x8E, 0xFF,
+0x08, 0xFE, 0xF3, 0xFF, 0xFF, 0xFD, 0xF3, 0x0E, 0x18, 0x30, 0x91, 0x00, 0x04, 0x03, 0x07, 0x1F,
+0x7F, 0x7F, 0x83, 0xFF, 0x15, 0xE3, 0xC0, 0xC0, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x14, 0x1A,
+0x3F, 0x7F, 0x7F, 0xFF, 0x7D, 0x7D, 0x3F, 0x7F, 0xFF, 0xBF, 0xDF, 0x95, 0xFF, 0x00, 0x7F, 0x81,
+0xFF, 0x02, 0xFE, 0xFC, 0xE0, 0x84, 0x00, 0x01, 0x80, 0xC0, 0x82, 0xE0, 0x80, 0xC0, 0x81, 0xE0,
+0x80, 0xF0, 0x81, 0xF8, 0x84, 0xFF, 0x04, 0xDF, 0x5F, 0xBF, 0x7F, 0x7F, 0x85, 0xFF, 0x03, 0x5F,
+0x4F, 0x07, 0x01, 0x99, 0x00, 0x01, 0x07, 0x1F, 0x81, 0x3F, 0x02, 0x1F, 0x07, 0x07, 0x81, 0x00,
+0x09, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0x95, 0xFF, 0x05, 0x7F, 0xFF,
+0xFF, 0xF7, 0xFB, 0xFD, 0x86, 0xFF, 0x04, 0xF8, 0xE0, 0x80, 0x78, 0xFE, 0x8E, 0xFF,
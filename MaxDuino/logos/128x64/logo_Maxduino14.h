@@ -1,64 +1,28 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 
-0xf8, 0xf8, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xc0, 0x70, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x70, 0xf0, 
-0xe0, 0xc0, 0x80, 0xe0, 0xf0, 0x70, 0x30, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x70, 0x70, 
-0xf0, 0xe0, 0xc0, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 
-0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xc0, 0x80, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0x10, 
-0x00, 0x80, 0xe0, 0xe0, 0xf0, 0x70, 0x30, 0x38, 0x70, 0x70, 0xf0, 0xe0, 0xc0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-0xff, 0xff, 0x87, 0x1f, 0x7f, 0xfc, 0xf0, 0xfe, 0x3f, 0x07, 0xff, 0xff, 0xff, 0x00, 0x00, 0xc0, 
-0xf0, 0x9c, 0xa7, 0xb9, 0xae, 0xae, 0xab, 0xae, 0xb8, 0xe0, 0x80, 0x00, 0x00, 0xc0, 0xe0, 0xf8, 
-0x7f, 0x1f, 0x1f, 0x3f, 0xf9, 0xf0, 0xc0, 0x80, 0x00, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0xe0, 
-0x79, 0x7f, 0x1f, 0x0f, 0x00, 0x3f, 0x7f, 0xff, 0xe0, 0xc0, 0xe0, 0xf7, 0xff, 0x7f, 0x1f, 0x00, 
-0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x07, 0x1f, 0x3e, 0x7f, 0xff, 0xff, 0x80, 
-0x00, 0x1f, 0x3f, 0x7f, 0xf0, 0xe0, 0xe0, 0xe0, 0xe0, 0xf0, 0x7f, 0x7f, 0x1f, 0x02, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0xc0, 0xe0, 0x30, 0x10, 0xe0, 0x30, 0x18, 0x18, 0x10, 0xf0, 
-0xc0, 0x70, 0xf0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xd0, 0xf8, 0x58, 0xd8, 0xf0, 0x70, 0x00, 0x00, 
-0x00, 0x18, 0xf8, 0x18, 0x10, 0xf0, 0xe0, 0x00, 0xf8, 0x00, 0xe0, 0x30, 0x10, 0x18, 0xd0, 0xd0, 
-0x00, 0xf8, 0x00, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x00, 0x80, 0xe0, 0x38, 0xe0, 0x80, 0x00, 0xf0, 
-0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x00, 0x80, 0xe0, 0x30, 0xe0, 
-0x80, 0x00, 0xf0, 0xf8, 0xd8, 0xd8, 0x70, 0x00, 0xf0, 0xf8, 0xd8, 0xd8, 0x10, 0x00, 0x00, 0x00, 
-0x18, 0xf8, 0x18, 0x10, 0xb0, 0xe0, 0x00, 0xf8, 0xd8, 0xd8, 0x58, 0x00, 0xe0, 0xf0, 0x10, 0x18, 
-0x10, 0x10, 0x00, 0xf0, 0x80, 0xc0, 0xf0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x01, 0x03, 0x02, 0x02, 0x03, 0x01, 
-0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 
-0x00, 0x00, 0x03, 0x02, 0x03, 0x01, 0x00, 0x00, 0x03, 0x00, 0x01, 0x03, 0x02, 0x02, 0x03, 0x01, 
-0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x03, 0x01, 0x01, 0x01, 0x03, 0x00, 0x03, 
-0x03, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x03, 0x01, 0x01, 0x01, 
-0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x03, 0x02, 0x03, 0x03, 0x00, 0x00, 0x03, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x03, 0x02, 
-0x02, 0x03, 0x00, 0x03, 0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xFF, 0x00, 0xFF, 0x00, 0x8B, 0x00, 0x04, 0xF0, 0xF8, 0xF8, 0xF0, 0xC0, 0x82, 0x00, 0x01, 0x80,
+0xE0, 0x81, 0xF8, 0x84, 0x00, 0x03, 0xC0, 0x70, 0xE0, 0x80, 0x84, 0x00, 0x0B, 0x10, 0x70, 0xF0,
+0xE0, 0xC0, 0x80, 0xE0, 0xF0, 0x70, 0x30, 0x00, 0x00, 0x81, 0xF0, 0x80, 0x30, 0x80, 0x70, 0x04,
+0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x81, 0xF0, 0x81, 0x00, 0x82, 0xF0, 0x00, 0x00, 0x81, 0xF0, 0x80,
+0x00, 0x81, 0xF0, 0x03, 0xC0, 0x80, 0x00, 0x00, 0x81, 0xF0, 0x0D, 0x10, 0x00, 0x80, 0xE0, 0xE0,
+0xF0, 0x70, 0x30, 0x38, 0x70, 0x70, 0xF0, 0xE0, 0xC0, 0xA0, 0x00, 0x81, 0xFF, 0x07, 0x87, 0x1F,
+0x7F, 0xFC, 0xF0, 0xFE, 0x3F, 0x07, 0x81, 0xFF, 0x80, 0x00, 0x19, 0xC0, 0xF0, 0x9C, 0xA7, 0xB9,
+0xAE, 0xAE, 0xAB, 0xAE, 0xB8, 0xE0, 0x80, 0x00, 0x00, 0xC0, 0xE0, 0xF8, 0x7F, 0x1F, 0x1F, 0x3F,
+0xF9, 0xF0, 0xC0, 0x80, 0x00, 0x81, 0xFF, 0x82, 0xE0, 0x0F, 0x79, 0x7F, 0x1F, 0x0F, 0x00, 0x3F,
+0x7F, 0xFF, 0xE0, 0xC0, 0xE0, 0xF7, 0xFF, 0x7F, 0x1F, 0x00, 0x81, 0xFF, 0x80, 0x00, 0x81, 0xFF,
+0x0C, 0x03, 0x07, 0x1F, 0x3E, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0x3F, 0x7F, 0xF0, 0x82, 0xE0,
+0x04, 0xF0, 0x7F, 0x7F, 0x1F, 0x02, 0x94, 0x00, 0x0E, 0x10, 0x30, 0xC0, 0xE0, 0x30, 0x10, 0xE0,
+0x30, 0x18, 0x18, 0x10, 0xF0, 0xC0, 0x70, 0xF0, 0x81, 0x00, 0x07, 0xF8, 0x00, 0xD0, 0xF8, 0x58,
+0xD8, 0xF0, 0x70, 0x81, 0x00, 0x1F, 0x18, 0xF8, 0x18, 0x10, 0xF0, 0xE0, 0x00, 0xF8, 0x00, 0xE0,
+0x30, 0x10, 0x18, 0xD0, 0xD0, 0x00, 0xF8, 0x00, 0x18, 0x18, 0xF8, 0x18, 0x18, 0x00, 0x80, 0xE0,
+0x38, 0xE0, 0x80, 0x00, 0xF0, 0xF0, 0x83, 0x00, 0x80, 0x18, 0x14, 0xF8, 0x18, 0x18, 0x00, 0x80,
+0xE0, 0x30, 0xE0, 0x80, 0x00, 0xF0, 0xF8, 0xD8, 0xD8, 0x70, 0x00, 0xF0, 0xF8, 0xD8, 0xD8, 0x10,
+0x81, 0x00, 0x17, 0x18, 0xF8, 0x18, 0x10, 0xB0, 0xE0, 0x00, 0xF8, 0xD8, 0xD8, 0x58, 0x00, 0xE0,
+0xF0, 0x10, 0x18, 0x10, 0x10, 0x00, 0xF0, 0x80, 0xC0, 0xF0, 0x18, 0x8C, 0x00, 0x80, 0x03, 0x80,
+0x00, 0x13, 0x01, 0x03, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x01, 0x00,
+0x01, 0x03, 0x00, 0x00, 0x03, 0x02, 0x82, 0x00, 0x0F, 0x03, 0x02, 0x03, 0x01, 0x00, 0x00, 0x03,
+0x00, 0x01, 0x03, 0x02, 0x02, 0x03, 0x01, 0x00, 0x03, 0x81, 0x00, 0x04, 0x03, 0x00, 0x00, 0x02,
+0x03, 0x81, 0x01, 0x03, 0x03, 0x00, 0x03, 0x03, 0x81, 0x02, 0x82, 0x00, 0x04, 0x03, 0x00, 0x00,
+0x02, 0x03, 0x81, 0x01, 0x03, 0x03, 0x00, 0x03, 0x03, 0x82, 0x00, 0x80, 0x03, 0x81, 0x02, 0x82,
+0x00, 0x06, 0x03, 0x02, 0x03, 0x03, 0x00, 0x00, 0x03, 0x82, 0x02, 0x0B, 0x00, 0x01, 0x03, 0x02,
+0x02, 0x03, 0x00, 0x03, 0x01, 0x00, 0x01, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x84, 0x00,
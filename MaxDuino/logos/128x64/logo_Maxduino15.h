@@ -1,64 +1,25 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0x40, 0x40, 
-0xc0, 0xc0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xf0, 0x5c, 0x46, 0x41, 0x5c, 0x52, 0xd2, 0x5d, 0x41, 0x49, 
-0x5f, 0xd2, 0x52, 0x4d, 0x41, 0x46, 0xf8, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xfc, 0xfe, 0xff, 0x03, 0x04, 0xff, 0x15, 0x15, 0x94, 0x58, 0x20, 0x33, 0x13, 0x13, 0x13, 
-0x33, 0x23, 0x20, 0x41, 0x83, 0x0f, 0xff, 0x0c, 0x07, 0x03, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0xff, 0x7f, 0xff, 0x80, 0x00, 0x01, 0x07, 0x1f, 0x10, 0x20, 0x20, 0xf0, 0x78, 0x68, 0x68, 
-0x78, 0xf0, 0x20, 0x30, 0x19, 0x0e, 0x07, 0x00, 0x00, 0x80, 0x7f, 0x7f, 0xc0, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0x03, 0x03, 0x01, 0x02, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 
-0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x03, 0x01, 0x02, 0x03, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xfe, 0xfe, 0x3e, 0xfe, 0xf0, 0xe0, 0xfe, 0x3e, 0xfe, 0xfc, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 
-0xf0, 0xf0, 0xe0, 0x00, 0x30, 0xf0, 0xe0, 0xe0, 0x70, 0x30, 0x80, 0xe0, 0xf0, 0x30, 0x30, 0xfe, 
-0xfe, 0x00, 0x10, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x30, 0xf6, 0xf6, 0xe0, 0x00, 0xf0, 
-0xf0, 0x70, 0x30, 0xf0, 0xf0, 0x00, 0x40, 0xe0, 0xf0, 0x30, 0x70, 0xf0, 0xe0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x04, 0x0f, 0x0f, 0x00, 0x01, 0x03, 0x03, 0x01, 0x00, 0x0f, 0x0f, 0x00, 0x03, 0x0f, 0x0f, 0x0c, 
-0x07, 0x07, 0x0f, 0x00, 0x0e, 0x0f, 0x03, 0x07, 0x0f, 0x0e, 0x01, 0x07, 0x0f, 0x0e, 0x06, 0x07, 
-0x0f, 0x04, 0x00, 0x07, 0x0f, 0x0e, 0x06, 0x07, 0x0f, 0x04, 0x00, 0x0f, 0x0f, 0x07, 0x00, 0x0f, 
-0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x04, 0x00, 0x07, 0x0f, 0x0c, 0x0e, 0x07, 0x07, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x12, 0x0a, 0x04, 0x00, 0x00, 
-0x00, 0x1e, 0x08, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x0e, 0x12, 0x0a, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x12, 0x0e, 0x00, 0x00, 
-0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x08, 0x00, 0x00, 
-0x00, 0x1e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x02, 0x00, 0x00, 0x08, 
-0x0e, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x06, 0x00, 0x00, 0x00, 0x0e, 0x16, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1a, 0x0e, 0x00, 0x00, 0x00, 0x1e, 0x16, 0x00, 0x00, 0x00, 
-0x00, 0x0e, 0x12, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xB8, 0x00, 0x80, 0x80, 0x80, 0xC0, 0x80, 0x40, 0x80, 0xC0, 0x80, 0x80, 0xEE, 0x00, 0x80, 0x80,
+0x12, 0xF0, 0x5C, 0x46, 0x41, 0x5C, 0x52, 0xD2, 0x5D, 0x41, 0x49, 0x5F, 0xD2, 0x52, 0x4D, 0x41,
+0x46, 0xF8, 0xC0, 0x80, 0xE6, 0x00, 0x0B, 0xFC, 0xFE, 0xFF, 0x03, 0x04, 0xFF, 0x15, 0x15, 0x94,
+0x58, 0x20, 0x33, 0x81, 0x13, 0x0B, 0x33, 0x23, 0x20, 0x41, 0x83, 0x0F, 0xFF, 0x0C, 0x07, 0x03,
+0xFF, 0xFE, 0xE2, 0x00, 0x1D, 0x80, 0xFF, 0x7F, 0xFF, 0x80, 0x00, 0x01, 0x07, 0x1F, 0x10, 0x20,
+0x20, 0xF0, 0x78, 0x68, 0x68, 0x78, 0xF0, 0x20, 0x30, 0x19, 0x0E, 0x07, 0x00, 0x00, 0x80, 0x7F,
+0x7F, 0xC0, 0x80, 0xDF, 0x00, 0x81, 0x03, 0x03, 0x01, 0x02, 0x03, 0x02, 0x84, 0x00, 0x00, 0x01,
+0x82, 0x03, 0x00, 0x01, 0x84, 0x00, 0x05, 0x03, 0x02, 0x03, 0x01, 0x02, 0x03, 0xD1, 0x00, 0x80,
+0xFE, 0x09, 0x3E, 0xFE, 0xF0, 0xE0, 0xFE, 0x3E, 0xFE, 0xFC, 0x00, 0x00, 0x81, 0xB0, 0x80, 0xF0,
+0x2A, 0xE0, 0x00, 0x30, 0xF0, 0xE0, 0xE0, 0x70, 0x30, 0x80, 0xE0, 0xF0, 0x30, 0x30, 0xFE, 0xFE,
+0x00, 0x10, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x30, 0xF6, 0xF6, 0xE0, 0x00, 0xF0, 0xF0,
+0x70, 0x30, 0xF0, 0xF0, 0x00, 0x40, 0xE0, 0xF0, 0x30, 0x70, 0xF0, 0xE0, 0xC1, 0x00, 0x3C, 0x04,
+0x0F, 0x0F, 0x00, 0x01, 0x03, 0x03, 0x01, 0x00, 0x0F, 0x0F, 0x00, 0x03, 0x0F, 0x0F, 0x0C, 0x07,
+0x07, 0x0F, 0x00, 0x0E, 0x0F, 0x03, 0x07, 0x0F, 0x0E, 0x01, 0x07, 0x0F, 0x0E, 0x06, 0x07, 0x0F,
+0x04, 0x00, 0x07, 0x0F, 0x0E, 0x06, 0x07, 0x0F, 0x04, 0x00, 0x0F, 0x0F, 0x07, 0x00, 0x0F, 0x0F,
+0x00, 0x00, 0x0F, 0x0F, 0x04, 0x00, 0x07, 0x0F, 0x0C, 0x0E, 0x07, 0x07, 0xA5, 0x00, 0x02, 0x02,
+0x0C, 0x02, 0x81, 0x00, 0x03, 0x0E, 0x12, 0x0A, 0x04, 0x81, 0x00, 0x02, 0x1E, 0x08, 0x0E, 0x81,
+0x00, 0x80, 0x0E, 0x85, 0x00, 0x03, 0x0E, 0x12, 0x0A, 0x0C, 0x81, 0x00, 0x00, 0x0E, 0x81, 0x00,
+0x02, 0x0E, 0x12, 0x0E, 0x81, 0x00, 0x00, 0x0E, 0x82, 0x00, 0x01, 0x0E, 0x02, 0x81, 0x00, 0x80,
+0x0E, 0x00, 0x08, 0x81, 0x00, 0x01, 0x1E, 0x10, 0x85, 0x00, 0x07, 0x02, 0x0E, 0x02, 0x00, 0x00,
+0x08, 0x0E, 0x0C, 0x81, 0x00, 0x02, 0x0E, 0x06, 0x06, 0x81, 0x00, 0x01, 0x0E, 0x16, 0x86, 0x00,
+0x02, 0x1E, 0x1A, 0x0E, 0x81, 0x00, 0x01, 0x1E, 0x16, 0x82, 0x00, 0x02, 0x0E, 0x12, 0x02, 0x81,
+0x00, 0x01, 0x0E, 0x0A, 0x85, 0x00,
@@ -1,64 +1,24 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xe0, 0xf0, 0xf8, 
-0xf8, 0xfc, 0xfc, 0xfc, 0x7c, 0x3c, 0x9c, 0x9c, 0xcc, 0xec, 0xe0, 0xe0, 0xf0, 0xc0, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0x1f, 0x83, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x0f, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x3c, 0x78, 0xf0, 
-0xf0, 0x38, 0xfe, 0xfe, 0xfc, 0x00, 0x00, 0xc0, 0xf0, 0xfe, 0x9e, 0xfe, 0xf0, 0xc0, 0x00, 0x00, 
-0x02, 0x0e, 0x9e, 0xf8, 0xf0, 0xf8, 0xbc, 0x0e, 0x06, 0x00, 0x00, 0x06, 0x06, 0x1a, 0xf2, 0x04, 
-0x0c, 0xf0, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0xfe, 0xfc, 0x00, 0x00, 0xfe, 0xfc, 0x00, 
-0x00, 0xfe, 0xfe, 0x3c, 0xf0, 0xe0, 0x80, 0xfe, 0xfe, 0x00, 0xf0, 0xf8, 0x3c, 0x0c, 0x0e, 0x06, 
-0x0e, 0x0c, 0xfc, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x3f, 0x9f, 0xcf, 0xe7, 
-0xf1, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x8f, 0x8f, 0x80, 0x80, 0x00, 
-0x00, 0x00, 0x8f, 0x0f, 0x87, 0x80, 0x0e, 0x0f, 0x07, 0x81, 0x81, 0x01, 0x83, 0x0f, 0xce, 0x00, 
-0x0c, 0x0e, 0x47, 0x83, 0x01, 0xc1, 0x87, 0x8f, 0x8c, 0x80, 0x80, 0x0c, 0x8c, 0x8b, 0x09, 0x04, 
-0xc6, 0x01, 0x00, 0x03, 0x07, 0x0e, 0x8c, 0x8c, 0x87, 0x87, 0x81, 0x80, 0x80, 0x0f, 0x0f, 0x80, 
-0x00, 0x8f, 0x0f, 0x80, 0x00, 0x81, 0x87, 0x0f, 0x0f, 0x00, 0x81, 0x03, 0x87, 0x06, 0x8c, 0x8c, 
-0x0e, 0x86, 0x87, 0x83, 0x40, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 
-0x07, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x08, 0x03, 0x07, 0x08, 0x04, 0x07, 0x00, 0x0f, 0x00, 
-0x08, 0x00, 0x0f, 0x08, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x08, 0x07, 0x03, 0x0f, 0x08, 
-0x07, 0x08, 0x00, 0x04, 0x00, 0x0f, 0x0e, 0x00, 0x0f, 0x0f, 0x00, 0x0c, 0x03, 0x0f, 0x0c, 0x00, 
-0x0f, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x08, 0x01, 0x0f, 0x0c, 0x00, 0x0f, 
-0x00, 0x03, 0x00, 0x0f, 0x0a, 0x08, 0x04, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x0c, 0x07, 0x08, 0x0f, 
-0x0a, 0x0c, 0x07, 0x08, 0x00, 0x0c, 0x08, 0x0f, 0x03, 0x0c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xFF, 0x00, 0xFF, 0x00, 0x86, 0x00, 0x06, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0x81, 0xFC,
+0x09, 0x7C, 0x3C, 0x9C, 0x9C, 0xCC, 0xEC, 0xE0, 0xE0, 0xF0, 0xC0, 0xE6, 0x00, 0x02, 0xE0, 0xF8,
+0xFC, 0x86, 0xFF, 0x03, 0x1F, 0x83, 0xF8, 0xFE, 0x86, 0xFF, 0x01, 0x7F, 0x0F, 0x8A, 0x00, 0x80,
+0xFE, 0x27, 0x3C, 0x78, 0xF0, 0xF0, 0x38, 0xFE, 0xFE, 0xFC, 0x00, 0x00, 0xC0, 0xF0, 0xFE, 0x9E,
+0xFE, 0xF0, 0xC0, 0x00, 0x00, 0x02, 0x0E, 0x9E, 0xF8, 0xF0, 0xF8, 0xBC, 0x0E, 0x06, 0x00, 0x00,
+0x06, 0x06, 0x1A, 0xF2, 0x04, 0x0C, 0xF0, 0x00, 0xFC, 0xFC, 0x81, 0x00, 0x1B, 0xFC, 0xFE, 0xFC,
+0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0xFE, 0xFE, 0x3C, 0xF0, 0xE0, 0x80, 0xFE, 0xFE, 0x00, 0xF0,
+0xF8, 0x3C, 0x0C, 0x0E, 0x06, 0x0E, 0x0C, 0xFC, 0xF8, 0x8F, 0x00, 0x01, 0x1F, 0x7F, 0x81, 0xFF,
+0x80, 0x7F, 0x05, 0x3F, 0x9F, 0xCF, 0xE7, 0xF1, 0xFC, 0x83, 0xFF, 0x05, 0x7F, 0x3F, 0x1F, 0x0F,
+0x07, 0x01, 0x86, 0x00, 0x00, 0x80, 0x81, 0x00, 0x05, 0x80, 0x00, 0x8F, 0x8F, 0x80, 0x80, 0x81,
+0x00, 0x47, 0x8F, 0x0F, 0x87, 0x80, 0x0E, 0x0F, 0x07, 0x81, 0x81, 0x01, 0x83, 0x0F, 0xCE, 0x00,
+0x0C, 0x0E, 0x47, 0x83, 0x01, 0xC1, 0x87, 0x8F, 0x8C, 0x80, 0x80, 0x0C, 0x8C, 0x8B, 0x09, 0x04,
+0xC6, 0x01, 0x00, 0x03, 0x07, 0x0E, 0x8C, 0x8C, 0x87, 0x87, 0x81, 0x80, 0x80, 0x0F, 0x0F, 0x80,
+0x00, 0x8F, 0x0F, 0x80, 0x00, 0x81, 0x87, 0x0F, 0x0F, 0x00, 0x81, 0x03, 0x87, 0x06, 0x8C, 0x8C,
+0x0E, 0x86, 0x87, 0x83, 0x40, 0x80, 0x00, 0x80, 0x00, 0x80, 0x8D, 0x00, 0x01, 0x02, 0x06, 0x84,
+0x07, 0x81, 0x03, 0x80, 0x01, 0x8D, 0x00, 0x10, 0x01, 0x0F, 0x08, 0x03, 0x07, 0x08, 0x04, 0x07,
+0x00, 0x0F, 0x00, 0x08, 0x00, 0x0F, 0x08, 0x07, 0x0D, 0x81, 0x00, 0x19, 0x08, 0x0F, 0x08, 0x07,
+0x03, 0x0F, 0x08, 0x07, 0x08, 0x00, 0x04, 0x00, 0x0F, 0x0E, 0x00, 0x0F, 0x0F, 0x00, 0x0C, 0x03,
+0x0F, 0x0C, 0x00, 0x0F, 0x08, 0x08, 0x82, 0x00, 0x80, 0x0F, 0x0D, 0x00, 0x08, 0x01, 0x0F, 0x0C,
+0x00, 0x0F, 0x00, 0x03, 0x00, 0x0F, 0x0A, 0x08, 0x04, 0x81, 0x00, 0x10, 0x0F, 0x08, 0x0C, 0x07,
+0x08, 0x0F, 0x0A, 0x0C, 0x07, 0x08, 0x00, 0x0C, 0x08, 0x0F, 0x03, 0x0C, 0x08, 0xFF, 0x00, 0xFF,
+0x00, 0x81, 0x00,
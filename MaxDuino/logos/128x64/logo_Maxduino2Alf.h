@@ -1,64 +1,23 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xF0, 0x30, 0x60, 0xC0, 0x80, 0xC0, 0x70, 0x70, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x80, 0xF0, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x70, 0xE0, 0x80, 0x00, 0x00,
-0x80, 0xE0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0xF0, 0x10, 0x10, 0x70, 0xE0, 0x80, 0x00,
-0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00,
-0x10, 0x10, 0x10, 0x10, 0xF0, 0x30, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x70, 0xE0,
-0x80, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x70, 0x10, 0x30, 0x70,
-0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xFF, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFC,
-0x6F, 0x40, 0x41, 0x7F, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC1, 0x73, 0x1E, 0x3F,
-0xE3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x80, 0xE1, 0x7F, 0x1E,
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
-0x07, 0x1E, 0xF0, 0xC0, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x0C, 0x3F, 0xE1, 0x80, 0x00, 0x00, 0x80,
-0xE1, 0x3F, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00,
-0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00,
-0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x80, 0xC0, 0x60, 0x20, 0x60, 0xC0, 0x60, 0xB0, 0x60, 0xC0, 0x60, 0x30, 0xF8, 0xB8, 0x60,
-0xC0, 0x60, 0x30, 0xF8, 0x88, 0xF8, 0xFE, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
-0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
-0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC6, 0xFC, 0xE0, 0x40, 0x40,
-0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xC0, 0xC0, 0x40, 0x40, 0x40, 0x40, 0x40,
-0x40, 0xC0, 0xC0, 0x40, 0xC0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xC0,
-0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x07, 0x0D, 0x18, 0x3F, 0x3F, 0x3A, 0x18, 0x3E, 0x7F, 0x3E, 0x18, 0x3E, 0xFF, 0xF8, 0xFD, 0x7E,
-0x18, 0x3A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x3C, 0x10,
-0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F, 0x1C, 0x10, 0x10, 0x10, 0x10, 0x10,
-0x10, 0x1C, 0x1F, 0x10, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F,
-0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xFF, 0x00, 0x8E, 0x00, 0x08, 0xF0, 0x30, 0x60, 0xC0, 0x80, 0xC0, 0x70, 0x70, 0xF0, 0x84, 0x00,
+0x03, 0x80, 0xF0, 0xF0, 0x80, 0x84, 0x00, 0x08, 0x10, 0x70, 0xE0, 0x80, 0x00, 0x00, 0x80, 0xE0,
+0x30, 0x82, 0x00, 0x07, 0x10, 0x30, 0xF0, 0x10, 0x10, 0x70, 0xE0, 0x80, 0x82, 0x00, 0x80, 0xF0,
+0x84, 0x00, 0x80, 0xF0, 0x81, 0x00, 0x82, 0x10, 0x01, 0xF0, 0x30, 0x81, 0x10, 0x82, 0x00, 0x03,
+0xF0, 0x70, 0xE0, 0x80, 0x81, 0x00, 0x01, 0x10, 0xF0, 0x83, 0x00, 0x05, 0xC0, 0x70, 0x10, 0x30,
+0x70, 0xC0, 0x9E, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0x82, 0x00,
+0x07, 0xC0, 0xFC, 0x6F, 0x40, 0x41, 0x7F, 0xF8, 0x80, 0x83, 0x00, 0x06, 0x80, 0xC1, 0x73, 0x1E,
+0x3F, 0xE3, 0xC0, 0x85, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x80, 0xE1, 0x7F, 0x1E, 0x81, 0x00, 0x80,
+0xFF, 0x84, 0x00, 0x80, 0xFF, 0x85, 0x00, 0x00, 0xFF, 0x86, 0x00, 0x08, 0xFF, 0x00, 0x01, 0x07,
+0x1E, 0xF0, 0xC0, 0x80, 0xFF, 0x81, 0x00, 0x09, 0x0C, 0x3F, 0xE1, 0x80, 0x00, 0x00, 0x80, 0xE1,
+0x3F, 0x0C, 0x9C, 0x00, 0x00, 0x07, 0x84, 0x00, 0x80, 0x03, 0x81, 0x00, 0x01, 0x02, 0x03, 0x83,
+0x00, 0x01, 0x01, 0x03, 0x82, 0x00, 0x02, 0x02, 0x03, 0x01, 0x82, 0x00, 0x01, 0x01, 0x03, 0x82,
+0x00, 0x06, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x01, 0x84, 0x00, 0x00, 0x03, 0x84, 0x02, 0x01,
+0x03, 0x01, 0x81, 0x00, 0x82, 0x02, 0x80, 0x03, 0x81, 0x02, 0x82, 0x00, 0x00, 0x07, 0x83, 0x00,
+0x02, 0x03, 0x07, 0x07, 0x84, 0x00, 0x03, 0x03, 0x02, 0x02, 0x03, 0x9F, 0x00, 0x15, 0x80, 0xC0,
+0x60, 0x20, 0x60, 0xC0, 0x60, 0xB0, 0x60, 0xC0, 0x60, 0x30, 0xF8, 0xB8, 0x60, 0xC0, 0x60, 0x30,
+0xF8, 0x88, 0xF8, 0xFE, 0xA2, 0xC2, 0x02, 0xC6, 0xFC, 0xE0, 0x89, 0x40, 0x80, 0xC0, 0x84, 0x40,
+0x80, 0xC0, 0x01, 0x40, 0xC0, 0x88, 0x40, 0x01, 0xC0, 0x80, 0x9D, 0x00, 0x11, 0x07, 0x0D, 0x18,
+0x3F, 0x3F, 0x3A, 0x18, 0x3E, 0x7F, 0x3E, 0x18, 0x3E, 0xFF, 0xF8, 0xFD, 0x7E, 0x18, 0x3A, 0xA9,
+0xFF, 0x01, 0x3F, 0x3C, 0x88, 0x10, 0x01, 0x1F, 0x1C, 0x84, 0x10, 0x03, 0x1C, 0x1F, 0x10, 0x1F,
+0x88, 0x10, 0x02, 0x1F, 0x08, 0x07, 0xAF, 0x00, 0x81, 0x01, 0xA5, 0x03, 0xFF, 0x00, 0xB0, 0x00,
@@ -1,64 +1,25 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xc0, 0xe0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf0, 
-0xe0, 0x88, 0x1c, 0x7c, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf0, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x0e, 0x1f, 0x9f, 0xcf, 0xef, 0xe7, 0xe7, 0xf7, 0xf7, 0xe7, 0x67, 0x27, 0x0f, 0x0f, 
-0x1f, 0x1f, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x06, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x10, 0xfe, 0xfc, 0xfc, 
-0xf8, 0xf8, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf9, 0xf8, 0xfc, 0xfe, 0x38, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x0f, 0x0f, 0x0f, 0x1f, 0x0f, 0x0c, 0x08, 0x01, 0x03, 
-0x07, 0x0f, 0x0f, 0x0f, 0x1f, 0x0f, 0x0f, 0x0f, 0x07, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0xc0, 0xe0, 0x70, 0x30, 0x98, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x80, 0xe0, 0xf0, 0xf0, 0x60, 0xf0, 0xf0, 0xf0, 0x80, 0x40, 0xe0, 0xf0, 0xf0, 0x70, 
-0x00, 0x80, 0xc0, 0xc0, 0xe0, 0x70, 0x30, 0xb0, 0xf0, 0xf0, 0x20, 0x00, 0x80, 0xc0, 0x20, 0xf0, 
-0xf0, 0xf0, 0xc0, 0x60, 0x20, 0x30, 0x00, 0x80, 0xc0, 0xe0, 0x70, 0x30, 0x98, 0xf8, 0xf8, 0xfe, 
-0x3f, 0x13, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x80, 0xe0, 0xf0, 0x70, 0x00, 0xc0, 0xe0, 0xe0, 0x20, 
-0x00, 0x00, 0x80, 0xe0, 0xf8, 0x2e, 0x0e, 0x04, 0x80, 0xc0, 0xe0, 0xf0, 0xe0, 0xc0, 0xc0, 0xe0, 
-0xf0, 0xf0, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0x18, 0xf8, 0x80, 0x80, 0x40, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0e, 0x1f, 0x0f, 0x03, 0x1c, 0x0f, 0x0f, 0x03, 0x01, 0x00, 0x1e, 0x1f, 0x13, 0x19, 0x0c, 
-0x06, 0x07, 0x0f, 0x0f, 0x04, 0x02, 0x3f, 0x3f, 0x37, 0x18, 0x0c, 0x02, 0x31, 0x18, 0x0c, 0x07, 
-0x0f, 0x1f, 0x18, 0x10, 0x08, 0x04, 0x0e, 0x0f, 0x0b, 0x04, 0x02, 0x03, 0x07, 0x1f, 0x1f, 0x18, 
-0x18, 0x08, 0x04, 0x02, 0x01, 0x1c, 0x3e, 0x1f, 0x1b, 0x0c, 0x3e, 0x3f, 0x3f, 0x33, 0x10, 0x08, 
-0x06, 0x03, 0x0f, 0x0f, 0x04, 0x06, 0x02, 0x0d, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x04, 0x1f, 0x1f, 
-0x0b, 0x0c, 0x06, 0x03, 0x0f, 0x0f, 0x0b, 0x04, 0x07, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x04, 0x1c, 0x04, 0x08, 0x14, 0x14, 0x1c, 0x1c, 0x10, 0x1c, 0x0c, 0x1c, 0x1c, 0x00, 0x00, 
-0x1c, 0x14, 0x1c, 0x1c, 0x1c, 0x1c, 0x14, 0x1c, 0x10, 0x1c, 0x04, 0x1c, 0x04, 0x18, 0x1c, 0x18, 
-0x1c, 0x10, 0x00, 0x00, 0x1c, 0x1c, 0x10, 0x1c, 0x1c, 0x00, 0x1c, 0x0c, 0x04, 0x1c, 0x1c, 0x00, 
-0x00, 0x1c, 0x14, 0x1c, 0x1c, 0x1c, 0x00, 0x1c, 0x14, 0x14, 0x00, 0x1c, 0x1c, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xB1, 0x00, 0x04, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x83, 0xFC, 0x80, 0xF8, 0x04, 0xF0, 0xE0, 0x88,
+0x1C, 0x7C, 0x81, 0xFC, 0x80, 0xF8, 0x02, 0xF0, 0xE0, 0xC0, 0xE4, 0x00, 0x11, 0x0E, 0x1F, 0x9F,
+0xCF, 0xEF, 0xE7, 0xE7, 0xF7, 0xF7, 0xE7, 0x67, 0x27, 0x0F, 0x0F, 0x1F, 0x1F, 0x00, 0xE0, 0x84,
+0xFF, 0x02, 0x7F, 0x3F, 0x06, 0xE3, 0x00, 0x00, 0x38, 0x86, 0xFF, 0x06, 0x01, 0x10, 0xFE, 0xFC,
+0xFC, 0xF8, 0xF8, 0x84, 0xF3, 0x04, 0xF9, 0xF8, 0xFC, 0xFE, 0x38, 0xE5, 0x00, 0x02, 0x03, 0x07,
+0x07, 0x81, 0x0F, 0x06, 0x1F, 0x0F, 0x0C, 0x08, 0x01, 0x03, 0x07, 0x81, 0x0F, 0x00, 0x1F, 0x81,
+0x0F, 0x80, 0x07, 0x00, 0x03, 0xF3, 0x00, 0x06, 0x80, 0xC0, 0xE0, 0x70, 0x30, 0x98, 0xF0, 0xC9,
+0x00, 0x04, 0x80, 0xE0, 0xF0, 0xF0, 0x60, 0x81, 0xF0, 0x14, 0x80, 0x40, 0xE0, 0xF0, 0xF0, 0x70,
+0x00, 0x80, 0xC0, 0xC0, 0xE0, 0x70, 0x30, 0xB0, 0xF0, 0xF0, 0x20, 0x00, 0x80, 0xC0, 0x20, 0x81,
+0xF0, 0x3B, 0xC0, 0x60, 0x20, 0x30, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x30, 0x98, 0xF8, 0xF8, 0xFE,
+0x3F, 0x13, 0x0C, 0x06, 0x83, 0xC1, 0x60, 0x80, 0xE0, 0xF0, 0x70, 0x00, 0xC0, 0xE0, 0xE0, 0x20,
+0x00, 0x00, 0x80, 0xE0, 0xF8, 0x2E, 0x0E, 0x04, 0x80, 0xC0, 0xE0, 0xF0, 0xE0, 0xC0, 0xC0, 0xE0,
+0xF0, 0xF0, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0x18, 0xF8, 0x80, 0x80, 0x40, 0xA1, 0x00,
+0x57, 0x0E, 0x1F, 0x0F, 0x03, 0x1C, 0x0F, 0x0F, 0x03, 0x01, 0x00, 0x1E, 0x1F, 0x13, 0x19, 0x0C,
+0x06, 0x07, 0x0F, 0x0F, 0x04, 0x02, 0x3F, 0x3F, 0x37, 0x18, 0x0C, 0x02, 0x31, 0x18, 0x0C, 0x07,
+0x0F, 0x1F, 0x18, 0x10, 0x08, 0x04, 0x0E, 0x0F, 0x0B, 0x04, 0x02, 0x03, 0x07, 0x1F, 0x1F, 0x18,
+0x18, 0x08, 0x04, 0x02, 0x01, 0x1C, 0x3E, 0x1F, 0x1B, 0x0C, 0x3E, 0x3F, 0x3F, 0x33, 0x10, 0x08,
+0x06, 0x03, 0x0F, 0x0F, 0x04, 0x06, 0x02, 0x0D, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x04, 0x1F, 0x1F,
+0x0B, 0x0C, 0x06, 0x03, 0x0F, 0x0F, 0x0B, 0x04, 0x07, 0x81, 0x01, 0xB3, 0x00, 0x10, 0x04, 0x1C,
+0x04, 0x08, 0x14, 0x14, 0x1C, 0x1C, 0x10, 0x1C, 0x0C, 0x1C, 0x1C, 0x00, 0x00, 0x1C, 0x14, 0x82,
+0x1C, 0x1C, 0x14, 0x1C, 0x10, 0x1C, 0x04, 0x1C, 0x04, 0x18, 0x1C, 0x18, 0x1C, 0x10, 0x00, 0x00,
+0x1C, 0x1C, 0x10, 0x1C, 0x1C, 0x00, 0x1C, 0x0C, 0x04, 0x1C, 0x1C, 0x00, 0x00, 0x1C, 0x14, 0x81,
+0x1C, 0x06, 0x00, 0x1C, 0x14, 0x14, 0x00, 0x1C, 0x1C, 0xA1, 0x00,
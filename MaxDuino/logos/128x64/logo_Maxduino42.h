@@ -1,64 +1,25 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf0, 0x10, 0x10, 
-0x70, 0x90, 0x30, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x80, 0x70, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xe8, 0x3c, 0xc7, 0x78, 0x8f, 0xf7, 
-0x38, 0x2b, 0x2c, 0x29, 0x2e, 0x28, 0xa8, 0xa8, 0x68, 0x28, 0x88, 0xc8, 0x78, 0xe0, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x01, 0x02, 0x06, 0x05, 0xc9, 0x73, 0x35, 0xed, 0x4b, 0xd3, 0x74, 0x2f, 0xb9, 
-0xd1, 0x49, 0x2f, 0xf1, 0x87, 0x39, 0xc3, 0x1e, 0xfb, 0x0d, 0x04, 0x02, 0x03, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x13, 0x38, 0x27, 0x60, 0x27, 0x17, 0x1a, 0x0d, 0x04, 
-0x06, 0x07, 0x09, 0x1a, 0x16, 0x2d, 0x6b, 0x32, 0x10, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xc0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x0f, 0x3c, 0xf0, 0x80, 0x00, 0xe0, 0x78, 
-0x0e, 0x03, 0x00, 0xff, 0x00, 0x70, 0xfc, 0x86, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x06, 0xff, 
-0xff, 0x00, 0x01, 0x87, 0xce, 0x78, 0x70, 0xdc, 0x86, 0x03, 0x01, 0x20, 0xfc, 0x86, 0x03, 0x01, 
-0x01, 0x01, 0x01, 0x03, 0x06, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 
-0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x01, 0x01, 0x01, 0x03, 0x06, 0xfc, 0x00, 0xf8, 
-0xfe, 0x02, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x8e, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc7, 0x81, 0x00, 
-0xc0, 0x80, 0x40, 0x47, 0x80, 0xc0, 0x01, 0x03, 0x82, 0xc6, 0x46, 0xc6, 0x06, 0x02, 0x03, 0xc7, 
-0x47, 0x80, 0x86, 0x03, 0x81, 0x40, 0x40, 0x00, 0x81, 0x47, 0xc6, 0x40, 0x00, 0xc3, 0x83, 0x06, 
-0x86, 0x06, 0x06, 0x02, 0x03, 0x43, 0xc7, 0x40, 0x01, 0x83, 0x82, 0x06, 0x86, 0x46, 0x42, 0x83, 
-0x87, 0x40, 0x47, 0x07, 0x00, 0x87, 0x43, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x47, 0x40, 0x00, 
-0x81, 0x03, 0xc2, 0x06, 0x06, 0x06, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 
-0x01, 0x07, 0x04, 0x04, 0x07, 0x07, 0x04, 0x04, 0x03, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 
-0x04, 0x07, 0x07, 0x00, 0x07, 0x04, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x02, 0x03, 0x04, 
-0x07, 0x04, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x03, 0x03, 0x06, 0x07, 0x01, 0x01, 0x01, 
-0x07, 0x05, 0x04, 0x00, 0x00, 0x07, 0x04, 0x04, 0x07, 0x07, 0x05, 0x04, 0x07, 0x04, 0x04, 0x00, 
-0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xBA, 0x00, 0x07, 0x80, 0xF0, 0x10, 0x10, 0x70, 0x90, 0x30, 0xC0, 0xEC, 0x00, 0x01, 0x80, 0x70,
+0x84, 0x28, 0x13, 0xE8, 0x3C, 0xC7, 0x78, 0x8F, 0xF7, 0x38, 0x2B, 0x2C, 0x29, 0x2E, 0x28, 0xA8,
+0xA8, 0x68, 0x28, 0x88, 0xC8, 0x78, 0xE0, 0xE2, 0x00, 0x80, 0x01, 0x19, 0x02, 0x06, 0x05, 0xC9,
+0x73, 0x35, 0xED, 0x4B, 0xD3, 0x74, 0x2F, 0xB9, 0xD1, 0x49, 0x2F, 0xF1, 0x87, 0x39, 0xC3, 0x1E,
+0xFB, 0x0D, 0x04, 0x02, 0x03, 0x01, 0xE6, 0x00, 0x14, 0x0C, 0x13, 0x38, 0x27, 0x60, 0x27, 0x17,
+0x1A, 0x0D, 0x04, 0x06, 0x07, 0x09, 0x1A, 0x16, 0x2D, 0x6B, 0x32, 0x10, 0x1F, 0x08, 0xC9, 0x00,
+0x80, 0xF0, 0x00, 0xE0, 0x86, 0x00, 0x02, 0xC0, 0xF0, 0xF0, 0x9F, 0x00, 0x80, 0xF0, 0x89, 0x00,
+0x80, 0x10, 0x8E, 0x00, 0x00, 0x80, 0xAF, 0x00, 0x80, 0xFF, 0x10, 0x01, 0x0F, 0x3C, 0xF0, 0x80,
+0x00, 0xE0, 0x78, 0x0E, 0x03, 0x00, 0xFF, 0x00, 0x70, 0xFC, 0x86, 0x03, 0x82, 0x01, 0x11, 0x03,
+0x06, 0xFF, 0xFF, 0x00, 0x01, 0x87, 0xCE, 0x78, 0x70, 0xDC, 0x86, 0x03, 0x01, 0x20, 0xFC, 0x86,
+0x03, 0x82, 0x01, 0x06, 0x03, 0x06, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x83, 0x00, 0x08, 0x81, 0xFF,
+0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x03, 0x81, 0x01, 0x07, 0x03, 0x06, 0xFC, 0x00, 0xF8, 0xFE,
+0x02, 0x03, 0x81, 0x01, 0x80, 0x03, 0x01, 0x8E, 0xFC, 0xAA, 0x00, 0x80, 0x07, 0x82, 0x00, 0x46,
+0x03, 0xC7, 0x81, 0x00, 0xC0, 0x80, 0x40, 0x47, 0x80, 0xC0, 0x01, 0x03, 0x82, 0xC6, 0x46, 0xC6,
+0x06, 0x02, 0x03, 0xC7, 0x47, 0x80, 0x86, 0x03, 0x81, 0x40, 0x40, 0x00, 0x81, 0x47, 0xC6, 0x40,
+0x00, 0xC3, 0x83, 0x06, 0x86, 0x06, 0x06, 0x02, 0x03, 0x43, 0xC7, 0x40, 0x01, 0x83, 0x82, 0x06,
+0x86, 0x46, 0x42, 0x83, 0x87, 0x40, 0x47, 0x07, 0x00, 0x87, 0x43, 0x40, 0x80, 0x80, 0x40, 0x40,
+0x80, 0x47, 0x40, 0x00, 0x81, 0x03, 0xC2, 0x82, 0x06, 0x01, 0x03, 0x01, 0xB3, 0x00, 0x0D, 0x01,
+0x07, 0x01, 0x07, 0x04, 0x04, 0x07, 0x07, 0x04, 0x04, 0x03, 0x07, 0x00, 0x07, 0x81, 0x00, 0x13,
+0x07, 0x04, 0x07, 0x07, 0x00, 0x07, 0x04, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x02, 0x03,
+0x04, 0x07, 0x04, 0x04, 0x81, 0x00, 0x06, 0x07, 0x00, 0x06, 0x03, 0x03, 0x06, 0x07, 0x81, 0x01,
+0x12, 0x07, 0x05, 0x04, 0x00, 0x00, 0x07, 0x04, 0x04, 0x07, 0x07, 0x05, 0x04, 0x07, 0x04, 0x04,
+0x00, 0x07, 0x00, 0x07, 0x9B, 0x00,
@@ -1,64 +1,33 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 
-0x00, 0x80, 0xfe, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xb0, 0xbf, 0x3f, 0x0f, 0x03, 0x00, 0x00, 0x80, 0x80, 
-0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 
-0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 
-0x7c, 0x0e, 0xe3, 0xff, 0xff, 0xff, 0x7f, 0x1e, 0xe7, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xc0, 
-0xf8, 0xfe, 0xff, 0x7f, 0x0f, 0x03, 0xfb, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x80, 0x80, 0x07, 
-0xff, 0xff, 0xff, 0xfe, 0xf8, 0x1c, 0x07, 0x03, 0x00, 0x80, 0xf8, 0xfe, 0xff, 0xff, 0x0f, 0x03, 
-0xf3, 0xff, 0xff, 0xff, 0x7f, 0x01, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0xf0, 0xff, 
-0xff, 0xff, 0x1f, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 
-0xff, 0x3c, 0x0f, 0xfb, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x80, 0xf0, 0xfe, 0xff, 0xff, 0x3f, 0x03, 
-0x11, 0x7f, 0xff, 0xff, 0xde, 0xc0, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x1f, 0x1f, 0x03, 
-0x00, 0x00, 0x0f, 0x1f, 0x1f, 0x07, 0x00, 0x00, 0x03, 0x0f, 0x1f, 0x1f, 0x1c, 0x1c, 0x0e, 0x07, 
-0x0f, 0x1f, 0x1f, 0x1c, 0x18, 0x0f, 0x07, 0x0f, 0x1f, 0x1f, 0x18, 0x1c, 0x0e, 0x0b, 0x1c, 0x0e, 
-0x07, 0x07, 0x0f, 0x1f, 0x1f, 0x1c, 0x18, 0x1c, 0x0e, 0x07, 0x0f, 0x1f, 0x1f, 0x1f, 0x18, 0x0f, 
-0x07, 0x0f, 0x1f, 0x1f, 0x1c, 0x18, 0x0e, 0x07, 0x0f, 0x1f, 0x1f, 0x1f, 0x1c, 0x0f, 0x07, 0x0f, 
-0x1f, 0x1f, 0x18, 0x0c, 0x0f, 0x07, 0x0f, 0x1f, 0x1f, 0x18, 0x1c, 0x0f, 0x0f, 0x1f, 0x1f, 0x0f, 
-0x01, 0x00, 0x00, 0x07, 0x0f, 0x1f, 0x1f, 0x18, 0x0c, 0x0f, 0x03, 0x0f, 0x1f, 0x1f, 0x3c, 0x18, 
-0x18, 0x0e, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x08, 0x78, 0xe0, 0x3c, 0x08, 0xf8, 0x0c, 0x08, 0xf8, 0x08, 
-0xfc, 0x00, 0xfc, 0xf8, 0x08, 0xfc, 0x4c, 0xf8, 0x30, 0x00, 0x00, 0xfc, 0x0c, 0x0c, 0xf8, 0x00, 
-0xfc, 0x00, 0xf8, 0x0c, 0x6c, 0xd8, 0x78, 0xfc, 0x00, 0x0c, 0xfc, 0x0c, 0x08, 0x80, 0xf8, 0xbc, 
-0xf8, 0x00, 0xfc, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfc, 0x0c, 0x08, 0x80, 0xf8, 0xbc, 0xf8, 
-0x00, 0xfc, 0xfc, 0x4c, 0x78, 0x00, 0xfc, 0x6c, 0x6c, 0x00, 0x00, 0x08, 0xfc, 0x0c, 0xfc, 0xf8, 
-0x08, 0xfc, 0x6c, 0x08, 0xf8, 0xf8, 0x0c, 0x98, 0x18, 0xfc, 0xe8, 0x78, 0xfc, 0x00, 0x00, 0x00, 
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x00, 
-0x03, 0x03, 0x03, 0x01, 0x01, 0x03, 0x00, 0x03, 0x01, 0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x00, 
-0x03, 0x00, 0x03, 0x03, 0x03, 0x01, 0x01, 0x03, 0x00, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 
-0x03, 0x01, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 
-0x01, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x01, 
-0x01, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xFF, 0x00, 0xC0, 0x00, 0x81, 0xC0, 0x00, 0x80, 0x8E, 0x00, 0x82, 0xC0, 0x00, 0x80, 0xAF, 0x00,
+0x80, 0x80, 0x82, 0x00, 0x81, 0x80, 0x81, 0x00, 0x81, 0x80, 0x85, 0x00, 0x81, 0x80, 0x80, 0x00,
+0x80, 0x80, 0x83, 0x00, 0x81, 0x80, 0x83, 0x00, 0x00, 0x80, 0x83, 0x00, 0x81, 0x80, 0x02, 0x00,
+0x80, 0xFE, 0x81, 0xFF, 0x04, 0x0F, 0x00, 0x00, 0x80, 0x80, 0x82, 0x00, 0x81, 0x80, 0x82, 0x00,
+0x09, 0x80, 0xB0, 0xBF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x80, 0x80, 0x82, 0x00, 0x80, 0x80, 0x85,
+0x00, 0x81, 0x80, 0x80, 0x00, 0x80, 0x80, 0x95, 0x00, 0x00, 0x80, 0x82, 0xFF, 0x02, 0x7C, 0x0E,
+0xE3, 0x81, 0xFF, 0x02, 0x7F, 0x1E, 0xE7, 0x81, 0xFF, 0x0A, 0x7F, 0x00, 0x00, 0xC0, 0xF8, 0xFE,
+0xFF, 0x7F, 0x0F, 0x03, 0xFB, 0x81, 0xFF, 0x05, 0x3F, 0x00, 0x00, 0x80, 0x80, 0x07, 0x81, 0xFF,
+0x0D, 0xFE, 0xF8, 0x1C, 0x07, 0x03, 0x00, 0x80, 0xF8, 0xFE, 0xFF, 0xFF, 0x0F, 0x03, 0xF3, 0x81,
+0xFF, 0x03, 0x7F, 0x01, 0x00, 0x80, 0x82, 0xFF, 0x02, 0x03, 0x00, 0xF0, 0x81, 0xFF, 0x03, 0x1F,
+0x00, 0x00, 0xF0, 0x81, 0xFF, 0x03, 0x1F, 0x00, 0x00, 0xC0, 0x82, 0xFF, 0x02, 0x3C, 0x0F, 0xFB,
+0x81, 0xFF, 0x10, 0x0E, 0x00, 0x80, 0xF0, 0xFE, 0xFF, 0xFF, 0x3F, 0x03, 0x11, 0x7F, 0xFF, 0xFF,
+0xDE, 0xC0, 0x60, 0x30, 0x91, 0x00, 0x00, 0x0F, 0x81, 0x1F, 0x2B, 0x03, 0x00, 0x00, 0x0F, 0x1F,
+0x1F, 0x07, 0x00, 0x00, 0x03, 0x0F, 0x1F, 0x1F, 0x1C, 0x1C, 0x0E, 0x07, 0x0F, 0x1F, 0x1F, 0x1C,
+0x18, 0x0F, 0x07, 0x0F, 0x1F, 0x1F, 0x18, 0x1C, 0x0E, 0x0B, 0x1C, 0x0E, 0x07, 0x07, 0x0F, 0x1F,
+0x1F, 0x1C, 0x18, 0x1C, 0x0E, 0x07, 0x0F, 0x81, 0x1F, 0x0A, 0x18, 0x0F, 0x07, 0x0F, 0x1F, 0x1F,
+0x1C, 0x18, 0x0E, 0x07, 0x0F, 0x81, 0x1F, 0x27, 0x1C, 0x0F, 0x07, 0x0F, 0x1F, 0x1F, 0x18, 0x0C,
+0x0F, 0x07, 0x0F, 0x1F, 0x1F, 0x18, 0x1C, 0x0F, 0x0F, 0x1F, 0x1F, 0x0F, 0x01, 0x00, 0x00, 0x07,
+0x0F, 0x1F, 0x1F, 0x18, 0x0C, 0x0F, 0x03, 0x0F, 0x1F, 0x1F, 0x3C, 0x18, 0x18, 0x0E, 0x07, 0x01,
+0x92, 0x00, 0x8A, 0x20, 0x80, 0x00, 0x2D, 0x08, 0x78, 0xE0, 0x3C, 0x08, 0xF8, 0x0C, 0x08, 0xF8,
+0x08, 0xFC, 0x00, 0xFC, 0xF8, 0x08, 0xFC, 0x4C, 0xF8, 0x30, 0x00, 0x00, 0xFC, 0x0C, 0x0C, 0xF8,
+0x00, 0xFC, 0x00, 0xF8, 0x0C, 0x6C, 0xD8, 0x78, 0xFC, 0x00, 0x0C, 0xFC, 0x0C, 0x08, 0x80, 0xF8,
+0xBC, 0xF8, 0x00, 0xFC, 0xF8, 0x82, 0x00, 0x24, 0x0C, 0xFC, 0x0C, 0x08, 0x80, 0xF8, 0xBC, 0xF8,
+0x00, 0xFC, 0xFC, 0x4C, 0x78, 0x00, 0xFC, 0x6C, 0x6C, 0x00, 0x00, 0x08, 0xFC, 0x0C, 0xFC, 0xF8,
+0x08, 0xFC, 0x6C, 0x08, 0xF8, 0xF8, 0x0C, 0x98, 0x18, 0xFC, 0xE8, 0x78, 0xFC, 0x81, 0x00, 0x89,
+0x20, 0x9B, 0x00, 0x02, 0x03, 0x00, 0x00, 0x81, 0x03, 0x01, 0x01, 0x00, 0x81, 0x03, 0x80, 0x01,
+0x05, 0x03, 0x00, 0x03, 0x01, 0x00, 0x00, 0x81, 0x03, 0x03, 0x01, 0x00, 0x03, 0x00, 0x81, 0x03,
+0x80, 0x01, 0x0A, 0x03, 0x00, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x81, 0x03,
+0x00, 0x01, 0x81, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x03, 0x01, 0x00,
+0x00, 0x01, 0x81, 0x03, 0x80, 0x00, 0x00, 0x01, 0x81, 0x03, 0x80, 0x01, 0x81, 0x03, 0x00, 0x01,
+0x81, 0x03, 0x04, 0x01, 0x03, 0x03, 0x00, 0x03, 0xFF, 0x00, 0x90, 0x00,
@@ -1,64 +1,32 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xe0, 0x70, 0x38, 0x70, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0xe3, 0x0f, 0xfc, 0x00, 0x03, 0xff, 
-0x00, 0x00, 0x7c, 0x00, 0x00, 0x07, 0xc7, 0xc7, 0xe7, 0xc7, 0xc7, 0xc7, 0x07, 0x00, 0x80, 0x87, 
-0x07, 0x0f, 0x0f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x2f, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0x01, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xfc, 0xf0, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf8, 0xfe, 0x04, 0xc0, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x2f, 0x2f, 
-0x2f, 0x2f, 0x7e, 0x5e, 0xbc, 0xfc, 0xfc, 0xf8, 0xf0, 0xd8, 0xf1, 0x83, 0xbb, 0x7f, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x9f, 0xcf, 0xcf, 0xc7, 0xc3, 0xc3, 0xc1, 
-0xe1, 0xe1, 0xe1, 0xe1, 0xf1, 0xf9, 0xf8, 0xf8, 0x71, 0x83, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x1f, 0xce, 0x7f, 0xff, 0x0f, 0x03, 0xf8, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x80, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3f, 0xc3, 0xf8, 0xff, 0x1f, 0xe3, 0xfc, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0x8f, 0xe0, 0x00, 0xc0, 0xf8, 0xf8, 0xf0, 0xe2, 0xe6, 0xcc, 0xc8, 0xd0, 0x00, 0x01, 
-0xf1, 0xe8, 0xa6, 0xb6, 0xb2, 0xb5, 0x92, 0xdd, 0xec, 0xf7, 0xfb, 0xfd, 0xf6, 0xf9, 0xfc, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xeb, 0xd7, 0x95, 0x36, 0x72, 0x82, 0x02, 
-0x12, 0x12, 0x83, 0xc3, 0x23, 0x03, 0xc7, 0xa1, 0xfe, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x07, 0x1e, 0x73, 0xcf, 0xbe, 0xf8, 0xf1, 0xf1, 0xf1, 0xf3, 0xff, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0xf0, 0x3f, 0xc3, 0xfc, 0x9f, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xe1, 
-0x00, 0x00, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x8f, 0xe7, 0xf0, 0xfc, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 
-0xfc, 0xfd, 0xfc, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0f, 0x0f, 0x1f, 0xff, 0xff, 0x9f, 0xcf, 0xe1, 
-0xf0, 0xf8, 0xfe, 0xff, 0xe0, 0xdf, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x87, 
-0x00, 0xf8, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0xbf, 0x9f, 0xdf, 0xcf, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x3f, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x70, 0xff, 
-0x7f, 0x1f, 0xc0, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0x07, 0x3f, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x7f, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0xf1, 
-0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0f, 0xe7, 0xf8, 0xe4, 
-0x9e, 0x7f, 0xff, 0xff, 0x3e, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x17, 0xc0, 0xf0, 
-0xf7, 0xf7, 0xf7, 0xf7, 0xe7, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe1, 0xc1, 0xc1, 0xc3, 0xc3, 0xc7, 
-0xc7, 0xc7, 0xc3, 0xc3, 0xc7, 0x87, 0x8f, 0x9f, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0x7f, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x06, 0x0e, 0x0c, 0x19, 0x33, 
-0x77, 0x67, 0xce, 0x99, 0xb3, 0xaf, 0xdf, 0xbf, 0xff, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0x1e, 0xcf, 0xe3, 0xf8, 0xff, 0xff, 0xff, 0x1f, 0xc7, 0xf3, 0xf9, 0xfe, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xf3, 0xe7, 0xe7, 0xc7, 0xcf, 0xcf, 
-0xef, 0xe7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x0f, 
-0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x90, 0x00, 0x06, 0xE0, 0x70, 0x38, 0x70, 0xE0, 0xC0, 0x80, 0x8D, 0x00, 0x10, 0x0C, 0x79, 0xE3,
+0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC7, 0xC7, 0xE7, 0x81, 0xC7,
+0x06, 0x07, 0x00, 0x80, 0x87, 0x07, 0x0F, 0x0F, 0x83, 0x1F, 0x02, 0x2F, 0xF7, 0xFC, 0x9E, 0xFF,
+0xA4, 0x00, 0x05, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0xFE, 0x81, 0xFF, 0x03, 0x7F, 0xFE, 0xFC, 0xF0,
+0x85, 0x00, 0x10, 0xE0, 0xF8, 0xFE, 0x04, 0xC0, 0xFF, 0xFF, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00,
+0xFF, 0xFF, 0x00, 0x00, 0x84, 0x0F, 0x80, 0x00, 0x82, 0x2F, 0x0B, 0x7E, 0x5E, 0xBC, 0xFC, 0xFC,
+0xF8, 0xF0, 0xD8, 0xF1, 0x83, 0xBB, 0x7F, 0x88, 0xFF, 0x07, 0xBF, 0x9F, 0xCF, 0xCF, 0xC7, 0xC3,
+0xC3, 0xC1, 0x82, 0xE1, 0x06, 0xF1, 0xF9, 0xF8, 0xF8, 0x71, 0x83, 0xFF, 0xA4, 0x00, 0x09, 0x1F,
+0xCE, 0x7F, 0xFF, 0x0F, 0x03, 0xF8, 0xFC, 0xFE, 0xFE, 0x81, 0xFF, 0x00, 0x80, 0x83, 0x00, 0x80,
+0xFF, 0x06, 0x3F, 0xC3, 0xF8, 0xFF, 0x1F, 0xE3, 0xFC, 0x81, 0xFF, 0x80, 0x00, 0x1C, 0x8F, 0xE0,
+0x00, 0xC0, 0xF8, 0xF8, 0xF0, 0xE2, 0xE6, 0xCC, 0xC8, 0xD0, 0x00, 0x01, 0xF1, 0xE8, 0xA6, 0xB6,
+0xB2, 0xB5, 0x92, 0xDD, 0xEC, 0xF7, 0xFB, 0xFD, 0xF6, 0xF9, 0xFC, 0x87, 0xFF, 0x12, 0xEF, 0xEB,
+0xD7, 0x95, 0x36, 0x72, 0x82, 0x02, 0x12, 0x12, 0x83, 0xC3, 0x23, 0x03, 0xC7, 0xA1, 0xFE, 0x1F,
+0x01, 0xA5, 0x00, 0x05, 0x07, 0x1E, 0x73, 0xCF, 0xBE, 0xF8, 0x81, 0xF1, 0x00, 0xF3, 0x82, 0xFF,
+0x81, 0x00, 0x06, 0xF0, 0x3F, 0xC3, 0xFC, 0x9F, 0xE7, 0xFC, 0x82, 0xFF, 0x06, 0x0F, 0xE1, 0x00,
+0x00, 0xFF, 0x0F, 0xE0, 0x84, 0xFF, 0x04, 0x1F, 0x8F, 0xE7, 0xF0, 0xFC, 0x94, 0xFF, 0x00, 0xE0,
+0x84, 0xFF, 0x80, 0xFE, 0x05, 0xFD, 0xFC, 0xFD, 0xFC, 0xFC, 0xFE, 0x81, 0xFF, 0x00, 0x03, 0xAB,
+0x00, 0x10, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0xFF, 0xFF, 0x9F, 0xCF, 0xE1, 0xF0, 0xF8, 0xFE, 0xFF,
+0xE0, 0xDF, 0xBC, 0x85, 0xFF, 0x05, 0x00, 0x87, 0x00, 0xF8, 0x01, 0x00, 0x84, 0xFF, 0x02, 0xE0,
+0x00, 0x3F, 0x8A, 0xFF, 0x80, 0x7F, 0x03, 0xBF, 0x9F, 0xDF, 0xCF, 0x83, 0xFF, 0x01, 0x7F, 0x3F,
+0x8F, 0xFF, 0x00, 0x3F, 0xB1, 0x00, 0x81, 0xFF, 0x00, 0x3F, 0x8C, 0xFF, 0x07, 0x03, 0x70, 0xFF,
+0x7F, 0x1F, 0xC0, 0xE0, 0x03, 0x85, 0xFF, 0x03, 0xFC, 0xE0, 0x07, 0x3F, 0xA2, 0xFF, 0x02, 0x7F,
+0x0F, 0x01, 0xAF, 0x00, 0x80, 0xC0, 0x07, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0xF1, 0xCF, 0x3F, 0x87,
+0xFF, 0x0A, 0x3F, 0x0F, 0xE7, 0xF8, 0xE4, 0x9E, 0x7F, 0xFF, 0xFF, 0x3E, 0x00, 0x84, 0xFF, 0x03,
+0x7F, 0x17, 0xC0, 0xF0, 0x82, 0xF7, 0x00, 0xE7, 0x83, 0xE3, 0x04, 0xE1, 0xC1, 0xC1, 0xC3, 0xC3,
+0x81, 0xC7, 0x80, 0xC3, 0x04, 0xC7, 0x87, 0x8F, 0x9F, 0xBF, 0x86, 0xFF, 0x02, 0x7F, 0x0F, 0x01,
+0xB2, 0x00, 0x13, 0x01, 0x03, 0x07, 0x06, 0x0E, 0x0C, 0x19, 0x33, 0x77, 0x67, 0xCE, 0x99, 0xB3,
+0xAF, 0xDF, 0xBF, 0xFF, 0xFF, 0x7F, 0x80, 0x83, 0xFF, 0x03, 0x1E, 0xCF, 0xE3, 0xF8, 0x81, 0xFF,
+0x04, 0x1F, 0xC7, 0xF3, 0xF9, 0xFE, 0x89, 0xFF, 0x0A, 0xFD, 0xFB, 0xF3, 0xE7, 0xE7, 0xC7, 0xCF,
+0xCF, 0xEF, 0xE7, 0xF7, 0x89, 0xFF, 0x02, 0xBF, 0x0F, 0x03, 0x9D, 0x00,
@@ -1,64 +1,24 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0xc0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x40, 0xa0, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xa0, 0xa0, 
-0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xc0, 
-0x20, 0x20, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x64, 0x54, 0x54, 0x58, 0x00, 0x38, 0x44, 0x44, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x0f, 0x00, 0x07, 0x08, 0x08, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf2, 
-0x01, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 0xc1, 
-0x32, 0x02, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x11, 0x15, 
-0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xa8, 0xa8, 0x48, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0xe0, 0x86, 0x8c, 0xb8, 0xe0, 0x40, 0x42, 0x4c, 0x30, 
-0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x13, 0x0c, 0x08, 0xc8, 0x08, 0x08, 0x08, 0x07, 0x04, 0x04, 
-0x04, 0x04, 0x84, 0x84, 0x82, 0x32, 0x83, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x82, 0x82, 0x83, 
-0x32, 0x82, 0x82, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x04, 0x04, 0x04, 0x60, 0x0e, 0x0f, 
-0x0e, 0x1e, 0x1f, 0x1c, 0x1c, 0x1c, 0x1e, 0x39, 0x38, 0x38, 0x38, 0x70, 0x7c, 0x73, 0x70, 0xe0, 
-0xf0, 0xec, 0xc0, 0xc0, 0xc0, 0x80, 0xc0, 0xa0, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x08, 0x08, 0x08, 0x7f, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x20, 0x10, 0x10, 0x08, 
-0x08, 0x84, 0x04, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x04, 0x08, 0xc0, 0x20, 0x20, 0xc0, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x1a, 0x0c, 0x0c, 0x12, 0x12, 0x0c, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x05, 0x05, 0x06, 0x03, 0x04, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 
-0x03, 0x04, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x00, 0x06, 0x09, 0x09, 0x06, 0x06, 
-0x09, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x07, 0x07, 0x0e, 0x0e, 0x0e, 0x1c, 0x1c, 0x38, 
-0x38, 0x70, 0x70, 0xe0, 0x60, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x02, 0x11, 0x08, 0x04, 0x22, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x00, 
-0x00, 0x00, 0x1e, 0x3e, 0x60, 0x40, 0x40, 0x60, 0x3e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x9D, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x82, 0x00, 0x81, 0x40, 0x00, 0xC0, 0x85, 0x00,
+0x03, 0x40, 0xA0, 0xA0, 0x40, 0x83, 0x00, 0x03, 0x40, 0xA0, 0xA0, 0xC0, 0x86, 0x00, 0x01, 0x20,
+0xE0, 0x82, 0x00, 0x03, 0xC0, 0x20, 0x20, 0xC0, 0xBC, 0x00, 0x08, 0x64, 0x54, 0x54, 0x58, 0x00,
+0x38, 0x44, 0x44, 0x38, 0x84, 0x00, 0x05, 0x0F, 0x00, 0x07, 0x08, 0x08, 0xC7, 0x83, 0x00, 0x01,
+0x07, 0xE0, 0x85, 0x00, 0x03, 0x01, 0x02, 0xF2, 0x01, 0x84, 0x00, 0x02, 0x02, 0xF2, 0x01, 0x81,
+0x00, 0x00, 0xE0, 0x81, 0x00, 0x02, 0xC0, 0x30, 0x03, 0x82, 0x00, 0x04, 0xC1, 0x32, 0x02, 0x01,
+0xC0, 0x81, 0x00, 0x00, 0x80, 0x83, 0x00, 0x03, 0x91, 0x11, 0x15, 0x0A, 0x87, 0x00, 0x03, 0xB8,
+0xA8, 0xA8, 0x48, 0x98, 0x00, 0x85, 0x08, 0x84, 0x00, 0x0A, 0xC0, 0xE0, 0xE0, 0x86, 0x8C, 0xB8,
+0xE0, 0x40, 0x42, 0x4C, 0x30, 0x81, 0x20, 0x81, 0x10, 0x03, 0x13, 0x0C, 0x08, 0xC8, 0x81, 0x08,
+0x00, 0x07, 0x82, 0x04, 0x80, 0x84, 0x03, 0x82, 0x32, 0x83, 0x82, 0x83, 0x02, 0x80, 0x82, 0x05,
+0x83, 0x32, 0x82, 0x82, 0x02, 0x03, 0x81, 0x02, 0x01, 0x03, 0x02, 0x81, 0x04, 0x05, 0x60, 0x0E,
+0x0F, 0x0E, 0x1E, 0x1F, 0x81, 0x1C, 0x01, 0x1E, 0x39, 0x81, 0x38, 0x06, 0x70, 0x7C, 0x73, 0x70,
+0xE0, 0xF0, 0xEC, 0x81, 0xC0, 0x04, 0x80, 0xC0, 0xA0, 0x18, 0x04, 0x85, 0x00, 0x81, 0x08, 0x00,
+0x7F, 0x81, 0x08, 0x90, 0x00, 0x80, 0x40, 0x09, 0x20, 0x10, 0x10, 0x08, 0x08, 0x84, 0x04, 0x04,
+0x02, 0x02, 0x81, 0x01, 0x05, 0x04, 0x08, 0xC0, 0x20, 0x20, 0xC0, 0x85, 0x00, 0x06, 0x12, 0x1A,
+0x0C, 0x0C, 0x12, 0x12, 0x0C, 0x83, 0x00, 0x80, 0x05, 0x04, 0x06, 0x03, 0x04, 0x04, 0x03, 0x83,
+0x00, 0x05, 0x06, 0x01, 0x03, 0x04, 0x04, 0x03, 0x82, 0x00, 0x0A, 0x01, 0x0F, 0x00, 0x06, 0x09,
+0x09, 0x06, 0x06, 0x09, 0x09, 0x06, 0x8D, 0x00, 0x81, 0x01, 0x81, 0x03, 0x80, 0x07, 0x81, 0x0E,
+0x80, 0x1C, 0x80, 0x38, 0x80, 0x70, 0x02, 0xE0, 0x60, 0x20, 0x98, 0x00, 0x07, 0x01, 0x02, 0x11,
+0x08, 0x04, 0x22, 0x50, 0x20, 0x82, 0x00, 0x80, 0x01, 0x96, 0x00, 0x08, 0x06, 0x0C, 0x18, 0x30,
+0x60, 0x30, 0x18, 0x0C, 0x06, 0x81, 0x00, 0x07, 0x1E, 0x3E, 0x60, 0x40, 0x40, 0x60, 0x3E, 0x1E,
+0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xB1, 0x00,
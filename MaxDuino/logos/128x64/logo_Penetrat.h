@@ -1,64 +1,45 @@
-0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 
-0xfc, 0xfc, 0xfc, 0xfc, 0x7c, 0xbe, 0xde, 0xce, 0xe6, 0xea, 0xed, 0xf7, 0xf7, 0xf7, 0xf3, 0xfb, 
-0xfb, 0x03, 0x7b, 0x79, 0x7d, 0x7e, 0x3e, 0x3e, 0x3e, 0x3f, 0x7f, 0x1f, 0x1e, 0x11, 0x0f, 0x1f, 
-0x1f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x87, 0x87, 0x87, 0x87, 0x04, 0x09, 0x06, 0xdc, 0xd8, 
-0xd8, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xc3, 0x03, 0x3a, 0xfa, 0xfa, 0xfa, 
-0xfa, 0x7b, 0x7b, 0x8b, 0x31, 0xbd, 0xbd, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xde, 
-0xde, 0xde, 0xe8, 0x00, 0x06, 0xfc, 0xf9, 0xf3, 0xf2, 0xe4, 0xcc, 0x98, 0x18, 0x30, 0xb0, 0x70, 
-0x60, 0xe0, 0xe0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xa3, 0xa3, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0x69, 0x69, 0x69, 0x69, 0xb5, 0xb5, 0xb5, 0xba, 0x0a, 
-0xf2, 0x1a, 0x0c, 0x06, 0x07, 0xc3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe1, 0xf1, 0xf1, 0xf1, 0xf0, 0xf0, 
-0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xe0, 0x00, 0x00, 0x3c, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x1f, 
-0xff, 0xe0, 0x00, 0x1f, 0x3f, 0x9f, 0x4f, 0x2f, 0xa7, 0x97, 0x97, 0x94, 0x90, 0x83, 0x0f, 0x7f, 
-0x80, 0x7f, 0xff, 0xff, 0xe0, 0x17, 0x0f, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf7, 
-0xf7, 0x77, 0x3b, 0x39, 0x80, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0x09, 
-0x02, 0xe4, 0xec, 0xda, 0xd9, 0x35, 0xb5, 0x6b, 0x6b, 0x63, 0xd7, 0xd7, 0xae, 0xae, 0xae, 0x5e, 
-0x7b, 0x7d, 0xbd, 0xbd, 0xde, 0xde, 0x2e, 0x4f, 0xa7, 0xc7, 0xcb, 0xcb, 0xcb, 0xcd, 0x0d, 0xfc, 
-0x01, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0, 0x00, 0x07, 0x7f, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 
-0x03, 0x7f, 0xff, 0xfc, 0xc0, 0x01, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 
-0xfc, 0xf8, 0xf3, 0x26, 0xc6, 0x20, 0x26, 0xe7, 0xe7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf9, 0xf9, 0xf9, 
-0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x60, 
-0x07, 0x9f, 0xe3, 0xf8, 0xf3, 0xf7, 0xef, 0x6f, 0x07, 0x02, 0x00, 0x01, 0x81, 0xe3, 0xf7, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xbe, 0xa0, 0xcf, 0xcf, 0xd7, 0xd7, 0xe7, 0xe7, 0x60, 0x5f, 
-0x00, 0x80, 0x7f, 0xfe, 0xc0, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x7f, 0x7f, 
-0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x1f, 0x1f, 0x1f, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x8f, 0x8f, 
-0x87, 0x87, 0x87, 0xc7, 0xc7, 0xc3, 0xc3, 0xe3, 0xe3, 0xe3, 0xe1, 0xe1, 0xe1, 0xf1, 0xf0, 0x00, 
-0x00, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0x3f, 0xc3, 0x3c, 0xe3, 0x0e, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x00, 
-0x87, 0xff, 0x7f, 0x3f, 0x0f, 0x03, 0x01, 0x80, 0xc0, 0xf0, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0x07, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfd, 0x1d, 0x65, 0xb6, 0xda, 0xdb, 0xed, 
-0x75, 0xb6, 0xb8, 0x07, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x78, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 
-0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xf0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x80, 0x00, 0x2f, 0xaf, 0x97, 0x97, 0x8b, 0xab, 0xd5, 
-0xea, 0xf5, 0xfa, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x80, 0x40, 
-0x3f, 0x01, 0x80, 0xc0, 0xf0, 0xf0, 0xf6, 0xef, 0xdf, 0xbf, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xfe, 0xfc, 0xf0, 0xe1, 0xc3, 0x07, 0x1f, 0x3f, 0x01, 0xee, 0xf3, 0xfb, 0x3d, 0xde, 0xee, 
-0xef, 0xf7, 0xfb, 0xf8, 0xc3, 0x3f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x01, 
-0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 
-0x7f, 0x7c, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x0f, 0xef, 0xec, 0xe8, 0xe3, 0xc7, 0x9f, 0x3f, 0x7f, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x0f, 0x83, 0xf0, 0xfc, 0xff, 0xff, 0xff, 
-0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfb, 0xfb, 
-0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x3c, 0x18, 0x00, 0x03, 0xa0, 0x4f, 0xbf, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x87, 0xbf, 0x3e, 0xc0, 0x00, 0x00, 0x07, 0x3f, 0x1f, 0x1f, 
-0x1f, 0x1f, 0x1f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x87, 0x87, 0x87, 0xc7, 0xc7, 0xc3, 0xc2, 0xc0, 
-0xc0, 0xe3, 0xe3, 0xe3, 0x63, 0x61, 0x71, 0x71, 0x71, 0x70, 0xb8, 0x38, 0x38, 0x38, 0x38, 0x58, 
-0x9c, 0x9c, 0x9c, 0x9c, 0xcc, 0xce, 0xcf, 0xb0, 0x6f, 0xdf, 0xbf, 0x7f, 0xff, 0xff, 0xff, 0xfe, 
-0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xf6, 0xf0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe0, 0x20, 0xc0, 0xec, 0xf6, 0xfb, 0xfc, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xc7, 0xae, 0x6c, 0xec, 0x8c, 0x56, 
-0xd6, 0xd6, 0xd6, 0xd7, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xf5, 0xf5, 0xf5, 0xf5, 0xf9, 0xfa, 
-0xfa, 0xf6, 0x8e, 0x7a, 0xe5, 0x9d, 0x7d, 0xfe, 0xfe, 0x7e, 0x7e, 0x7f, 0xbf, 0xbf, 0xdf, 0xdf, 
-0xef, 0xef, 0xf7, 0xf7, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0x0f, 
-0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0x83, 0x0f, 0x7f, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x84, 0xF0, 0x85, 0xF8, 0x85, 0xFC, 0x06, 0x7C, 0xBE, 0xDE, 0xCE, 0xE6, 0xEA, 0xED, 0x81, 0xF7,
+0x07, 0xF3, 0xFB, 0xFB, 0x03, 0x7B, 0x79, 0x7D, 0x7E, 0x81, 0x3E, 0x07, 0x3F, 0x7F, 0x1F, 0x1E,
+0x11, 0x0F, 0x1F, 0x1F, 0x83, 0x0F, 0x00, 0x8F, 0x82, 0x87, 0x07, 0x04, 0x09, 0x06, 0xDC, 0xD8,
+0xD8, 0x00, 0x00, 0x84, 0xFF, 0x03, 0xF8, 0xC3, 0x03, 0x3A, 0x82, 0xFA, 0x80, 0x7B, 0x03, 0x8B,
+0x31, 0xBD, 0xBD, 0x86, 0xBE, 0x81, 0xDE, 0x10, 0xE8, 0x00, 0x06, 0xFC, 0xF9, 0xF3, 0xF2, 0xE4,
+0xCC, 0x98, 0x18, 0x30, 0xB0, 0x70, 0x60, 0xE0, 0xE0, 0x81, 0xC0, 0x82, 0x80, 0x84, 0x00, 0x80,
+0xA3, 0x83, 0xD1, 0x82, 0x69, 0x81, 0xB5, 0x07, 0xBA, 0x0A, 0xF2, 0x1A, 0x0C, 0x06, 0x07, 0xC3,
+0x82, 0xE3, 0x00, 0xE1, 0x81, 0xF1, 0x80, 0xF0, 0x84, 0xF8, 0x06, 0xFC, 0xE0, 0x00, 0x00, 0x3C,
+0xFC, 0xFC, 0x81, 0xFE, 0x8A, 0xFF, 0x1A, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0x3F,
+0x9F, 0x4F, 0x2F, 0xA7, 0x97, 0x97, 0x94, 0x90, 0x83, 0x0F, 0x7F, 0x80, 0x7F, 0xFF, 0xFF, 0xE0,
+0x17, 0x0F, 0x86, 0xEF, 0x80, 0xF7, 0x04, 0x77, 0x3B, 0x39, 0x80, 0xC0, 0x85, 0xFF, 0x0E, 0xFE,
+0xFC, 0x09, 0x02, 0xE4, 0xEC, 0xDA, 0xD9, 0x35, 0xB5, 0x6B, 0x6B, 0x63, 0xD7, 0xD7, 0x81, 0xAE,
+0x0A, 0x5E, 0x7B, 0x7D, 0xBD, 0xBD, 0xDE, 0xDE, 0x2E, 0x4F, 0xA7, 0xC7, 0x81, 0xCB, 0x05, 0xCD,
+0x0D, 0xFC, 0x01, 0x7F, 0xE0, 0x81, 0x00, 0x00, 0x1F, 0x8F, 0xFF, 0x04, 0xFE, 0xC0, 0x00, 0x07,
+0x7F, 0x8E, 0xFF, 0x09, 0xFC, 0x00, 0x00, 0x03, 0x7F, 0xFF, 0xFC, 0xC0, 0x01, 0x3E, 0x86, 0xFF,
+0x09, 0xFE, 0xFC, 0xF8, 0xF3, 0x26, 0xC6, 0x20, 0x26, 0xE7, 0xE7, 0x82, 0xF3, 0x81, 0xF9, 0x01,
+0xFC, 0xFE, 0x8A, 0xFF, 0x10, 0xF8, 0x60, 0x07, 0x9F, 0xE3, 0xF8, 0xF3, 0xF7, 0xEF, 0x6F, 0x07,
+0x02, 0x00, 0x01, 0x81, 0xE3, 0xF7, 0x84, 0xFF, 0x12, 0x01, 0xBE, 0xA0, 0xCF, 0xCF, 0xD7, 0xD7,
+0xE7, 0xE7, 0x60, 0x5F, 0x00, 0x80, 0x7F, 0xFE, 0xC0, 0x00, 0x00, 0x01, 0x82, 0xFF, 0x82, 0x7F,
+0x83, 0x3F, 0x82, 0x1F, 0x00, 0x0F, 0x81, 0x00, 0x02, 0x0F, 0x8F, 0x8F, 0x81, 0x87, 0x80, 0xC7,
+0x80, 0xC3, 0x81, 0xE3, 0x81, 0xE1, 0x01, 0xF1, 0xF0, 0x81, 0x00, 0x05, 0x07, 0xFF, 0xFF, 0xFE,
+0x00, 0x01, 0x87, 0xFF, 0x05, 0x3F, 0xC3, 0x3C, 0xE3, 0x0E, 0xF0, 0x95, 0xFF, 0x0D, 0x78, 0x00,
+0x87, 0xFF, 0x7F, 0x3F, 0x0F, 0x03, 0x01, 0x80, 0xC0, 0xF0, 0xFC, 0xFE, 0x82, 0xFF, 0x06, 0x07,
+0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFE, 0x81, 0xFD, 0x0B, 0x1D, 0x65, 0xB6, 0xDA, 0xDB, 0xED, 0x75,
+0xB6, 0xB8, 0x07, 0xFF, 0xF0, 0x82, 0x00, 0x02, 0x78, 0xF8, 0xF8, 0x83, 0xFC, 0x83, 0xFE, 0x82,
+0xFF, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x8F, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x03, 0x81, 0xFF, 0x0D,
+0x80, 0x00, 0x2F, 0xAF, 0x97, 0x97, 0x8B, 0xAB, 0xD5, 0xEA, 0xF5, 0xFA, 0xFD, 0xFE, 0x95, 0xFF,
+0x0F, 0x7F, 0x3F, 0x80, 0x40, 0x3F, 0x01, 0x80, 0xC0, 0xF0, 0xF0, 0xF6, 0xEF, 0xDF, 0xBF, 0x7F,
+0x7F, 0x83, 0xFF, 0x16, 0xFE, 0xFC, 0xF0, 0xE1, 0xC3, 0x07, 0x1F, 0x3F, 0x01, 0xEE, 0xF3, 0xFB,
+0x3D, 0xDE, 0xEE, 0xEF, 0xF7, 0xFB, 0xF8, 0xC3, 0x3F, 0xFF, 0xF0, 0x81, 0x00, 0x00, 0x0F, 0x8F,
+0xFF, 0x03, 0xE0, 0x00, 0x01, 0x3F, 0x8B, 0xFF, 0x81, 0x7F, 0x00, 0x7C, 0x81, 0x00, 0x0A, 0x0F,
+0xFF, 0x0F, 0xEF, 0xEC, 0xE8, 0xE3, 0xC7, 0x9F, 0x3F, 0x7F, 0x96, 0xFF, 0x04, 0x7F, 0x0F, 0x83,
+0xF0, 0xFC, 0x81, 0xFF, 0x00, 0xFE, 0x89, 0xFF, 0x06, 0xFE, 0xFD, 0xFB, 0xFB, 0x1F, 0x3F, 0x7F,
+0x82, 0xFF, 0x07, 0x7E, 0x3C, 0x18, 0x00, 0x03, 0xA0, 0x4F, 0xBF, 0x84, 0xFF, 0x08, 0xF8, 0x87,
+0xBF, 0x3E, 0xC0, 0x00, 0x00, 0x07, 0x3F, 0x83, 0x1F, 0x82, 0x0F, 0x00, 0x8F, 0x81, 0x87, 0x80,
+0xC7, 0x03, 0xC3, 0xC2, 0xC0, 0xC0, 0x81, 0xE3, 0x01, 0x63, 0x61, 0x81, 0x71, 0x01, 0x70, 0xB8,
+0x82, 0x38, 0x00, 0x58, 0x82, 0x9C, 0x07, 0xCC, 0xCE, 0xCF, 0xB0, 0x6F, 0xDF, 0xBF, 0x7F, 0x81,
+0xFF, 0x02, 0xFE, 0x00, 0x01, 0x94, 0xFF, 0x02, 0xC0, 0x00, 0x3F, 0x93, 0xFF, 0x02, 0xF6, 0xF0,
+0xE0, 0x81, 0xE1, 0x06, 0xE0, 0x20, 0xC0, 0xEC, 0xF6, 0xFB, 0xFC, 0x8A, 0xFF, 0x06, 0xF8, 0xC7,
+0xAE, 0x6C, 0xEC, 0x8C, 0x56, 0x81, 0xD6, 0x00, 0xD7, 0x84, 0xEB, 0x82, 0xF5, 0x15, 0xF9, 0xFA,
+0xFA, 0xF6, 0x8E, 0x7A, 0xE5, 0x9D, 0x7D, 0xFE, 0xFE, 0x7E, 0x7E, 0x7F, 0xBF, 0xBF, 0xDF, 0xDF,
+0xEF, 0xEF, 0xF7, 0xF7, 0x81, 0xFB, 0x80, 0xFD, 0x08, 0xFC, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0x0F,
+0x00, 0xE0, 0x96, 0xFF, 0x04, 0xFC, 0xF0, 0x83, 0x0F, 0x7F, 0x8F, 0xFF,
@@ -1,64 +1,48 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xdf, 0xdf, 0xef, 0xe0, 
-0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x80, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0f, 
-0x0f, 0x0f, 0x0f, 0x8f, 0x40, 0x20, 0x10, 0x08, 0x0c, 0x0f, 0x0f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 
-0x8f, 0x8f, 0x4f, 0x4f, 0x4f, 0x4f, 0xce, 0xfd, 0xfd, 0xfb, 0xfb, 0xf7, 0xf7, 0xff, 0xf0, 0xc0, 
-0xc0, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 
-0x00, 0x02, 0xe5, 0xf8, 0x9e, 0x7c, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xaf, 
-0xa7, 0xcb, 0xef, 0xff, 0xff, 0x7f, 0xba, 0xd2, 0x62, 0x61, 0xf5, 0xf3, 0xf7, 0xef, 0xcf, 0xcf, 
-0x8f, 0x0f, 0x0e, 0x0d, 0x0f, 0x0f, 0x0e, 0xfe, 0x38, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0f, 0x8f, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 
-0xf0, 0x50, 0xa8, 0x59, 0x26, 0x85, 0x28, 0x41, 0x8b, 0x4b, 0x8f, 0x4f, 0xcf, 0xef, 0xef, 0x37, 
-0xdb, 0x2b, 0x0d, 0x02, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc3, 0x87, 0x87, 0x03, 0x17, 0x2b, 0x57, 
-0xaf, 0x5e, 0xbc, 0xf8, 0xf8, 0xf8, 0xe4, 0x18, 0xb0, 0x70, 0xe0, 0xd8, 0xdf, 0xbf, 0x7e, 0xde, 
-0xee, 0xff, 0xff, 0x3f, 0x5f, 0xaf, 0xef, 0xdf, 0xde, 0xde, 0x3e, 0xfe, 0x7e, 0x38, 0xc0, 0xc0, 
-0xe0, 0xe0, 0xf7, 0xf7, 0xf3, 0xf3, 0xf3, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 
-0x00, 0x03, 0x3c, 0xff, 0xff, 0xfb, 0xf3, 0x7e, 0x7d, 0x03, 0xbc, 0x63, 0x9f, 0x63, 0xbc, 0x0f, 
-0xf3, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf9, 0xff, 0xff, 0x3e, 0x00, 0x80, 0x41, 
-0xaa, 0x55, 0xef, 0xff, 0xff, 0xff, 0xd9, 0x41, 0xaa, 0x40, 0x1f, 0xff, 0xff, 0xff, 0x7c, 0x03, 
-0xaa, 0xd5, 0xe0, 0xca, 0xd5, 0xeb, 0xe5, 0xf3, 0x19, 0x02, 0x60, 0xf0, 0xfa, 0x7d, 0xbe, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1f, 0x2f, 0x17, 0x0f, 0x07, 0x0b, 0x05, 0x02, 0x05, 
-0x8a, 0x55, 0xbe, 0xdf, 0xdf, 0xdf, 0xdf, 0xbf, 0xbe, 0xa0, 0x80, 0x80, 0x8f, 0x0f, 0x0f, 0x0f, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x80, 0x80, 0xcf, 0xcf, 0xc0, 0xe8, 0xe8, 0xec, 0xec, 0xfe, 0xfe, 0xff, 0xff, 0xf0, 
-0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe6, 0xda, 0x55, 0x2a, 0x55, 0x28, 0x55, 0x2a, 0x55, 0x28, 0x55, 
-0x2a, 0x55, 0x29, 0x55, 0x2b, 0xb3, 0xab, 0xd3, 0xd9, 0xe5, 0x6a, 0x6c, 0x72, 0x75, 0x76, 0x7b, 
-0xfa, 0xfd, 0xaf, 0x47, 0xab, 0x40, 0x28, 0x90, 0xe2, 0xf8, 0xff, 0x7f, 0xbf, 0x47, 0xa8, 0xd5, 
-0xea, 0xff, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x80, 0x00, 0x01, 0x0a, 0x15, 0x3f, 0x1f, 
-0x0f, 0x37, 0xf3, 0xe1, 0xc1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x68, 0x35, 
-0x1a, 0x5f, 0x9f, 0x07, 0x87, 0x47, 0xa7, 0x47, 0xa7, 0x4f, 0xaf, 0x5f, 0x9f, 0x1f, 0x1e, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0xc0, 0xff, 0xff, 0x00, 0x00, 0x10, 0x78, 0x38, 0xb8, 0x3c, 0xbc, 0x7c, 
-0x7c, 0xfa, 0xf7, 0xef, 0xef, 0xdf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x07, 
-0x07, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x23, 0x03, 0x00, 
-0x03, 0x03, 0x03, 0x20, 0x51, 0xc8, 0xe0, 0xf0, 0x02, 0xd4, 0xa9, 0x98, 0x62, 0xc4, 0xc8, 0xb0, 
-0x68, 0xd0, 0xa1, 0xd1, 0x60, 0xb1, 0xda, 0xef, 0xf7, 0xe3, 0x01, 0x00, 0x3f, 0xff, 0xaf, 0x5f, 
-0xbf, 0x7c, 0xbb, 0x03, 0xbc, 0x7f, 0xbf, 0xdf, 0xef, 0xf7, 0xff, 0xfe, 0x5e, 0xaa, 0xf4, 0x0a, 
-0xc1, 0xf0, 0xf3, 0xff, 0x3f, 0x1f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x0b, 0x74, 
-0xfa, 0xfd, 0xfa, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfa, 0xf5, 0x6a, 0xd5, 0x28, 0x50, 
-0x0c, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0xe0, 0xf8, 0xfc, 0xfa, 0xfd, 0xfe, 0xfd, 0xfe, 0x7d, 
-0xaa, 0x54, 0x28, 0x85, 0xf3, 0xff, 0x7f, 0x7c, 0x03, 0xcf, 0x3f, 0x07, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x09, 0x1c, 0x7f, 0x1c, 0x08, 0x08, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x20, 0x50, 0xa9, 0x53, 0xc7, 0x3f, 0xe0, 0x7f, 0xea, 0xf5, 0xfe, 0xe5, 0xd9, 
-0xdd, 0x0a, 0xf4, 0xf8, 0xff, 0xff, 0xdf, 0xbf, 0xdf, 0xbf, 0x5f, 0xb8, 0x40, 0x87, 0x3e, 0x7d, 
-0xfe, 0xff, 0xfe, 0xe0, 0xdf, 0xef, 0xf7, 0xfb, 0xf7, 0xfb, 0xfd, 0xfe, 0xff, 0xff, 0x7f, 0x1f, 
-0x0f, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x03, 0x0f, 0x3f, 0x7f, 0xff, 0xff, 0x3f, 0xbf, 0x9f, 0xaf, 0x97, 0x4f, 0x57, 0x4a, 0x44, 0xa8
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x83, 0x00, 0x85, 0xFF, 0x86, 0x00, 0x80, 0xFF, 0x86, 0x00, 0x84, 0xFF, 0x84, 0x00, 0x80, 0xC0,
+0x80, 0xDF, 0x08, 0xEF, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x83, 0xFF, 0x01, 0xFE,
+0x80, 0x8C, 0x00, 0x80, 0xFF, 0x87, 0x00, 0x80, 0xFF, 0x87, 0x00, 0x83, 0xFF, 0x88, 0x00, 0x80,
+0xFF, 0x87, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x84, 0x00, 0x85, 0xFF, 0x86, 0x00, 0x80, 0xFF, 0x86,
+0x00, 0x00, 0xFF, 0x82, 0x0F, 0x07, 0x8F, 0x40, 0x20, 0x10, 0x08, 0x0C, 0x0F, 0x0F, 0x85, 0x8F,
+0x82, 0x4F, 0x0B, 0xCE, 0xFD, 0xFD, 0xFB, 0xFB, 0xF7, 0xF7, 0xFF, 0xF0, 0xC0, 0xC0, 0x00, 0x81,
+0x80, 0x85, 0x00, 0x80, 0xFF, 0x87, 0x00, 0x80, 0xFF, 0x87, 0x00, 0x83, 0xFF, 0x88, 0x00, 0x80,
+0xFF, 0x87, 0x00, 0x81, 0xFF, 0x84, 0x00, 0x85, 0xFF, 0x86, 0x00, 0x80, 0xFF, 0x86, 0x00, 0x07,
+0xFF, 0x00, 0x00, 0x02, 0xE5, 0xF8, 0x9E, 0x7C, 0x81, 0xFE, 0x83, 0xFF, 0x1A, 0x7F, 0xAF, 0xA7,
+0xCB, 0xEF, 0xFF, 0xFF, 0x7F, 0xBA, 0xD2, 0x62, 0x61, 0xF5, 0xF3, 0xF7, 0xEF, 0xCF, 0xCF, 0x8F,
+0x0F, 0x0E, 0x0D, 0x0F, 0x0F, 0x0E, 0xFE, 0x38, 0x81, 0x00, 0x80, 0xFF, 0x87, 0x00, 0x80, 0x0F,
+0x87, 0x00, 0x83, 0xFF, 0x88, 0x00, 0x01, 0x0F, 0x8F, 0x82, 0x80, 0x83, 0x00, 0x82, 0xFF, 0x83,
+0x00, 0x85, 0xFF, 0x86, 0x00, 0x80, 0xFF, 0x86, 0x00, 0x17, 0xFF, 0x00, 0xF0, 0x50, 0xA8, 0x59,
+0x26, 0x85, 0x28, 0x41, 0x8B, 0x4B, 0x8F, 0x4F, 0xCF, 0xEF, 0xEF, 0x37, 0xDB, 0x2B, 0x0D, 0x02,
+0x80, 0x80, 0x81, 0xC0, 0x09, 0xC3, 0x87, 0x87, 0x03, 0x17, 0x2B, 0x57, 0xAF, 0x5E, 0xBC, 0x81,
+0xF8, 0x1D, 0xE4, 0x18, 0xB0, 0x70, 0xE0, 0xD8, 0xDF, 0xBF, 0x7E, 0xDE, 0xEE, 0xFF, 0xFF, 0x3F,
+0x5F, 0xAF, 0xEF, 0xDF, 0xDE, 0xDE, 0x3E, 0xFE, 0x7E, 0x38, 0xC0, 0xC0, 0xE0, 0xE0, 0xF7, 0xF7,
+0x81, 0xF3, 0x02, 0xF8, 0xFC, 0xFC, 0x81, 0xFE, 0x82, 0xFF, 0x00, 0x7F, 0x83, 0xFF, 0x00, 0xFC,
+0x82, 0x00, 0x82, 0xFF, 0x83, 0x00, 0x85, 0xFF, 0x86, 0x00, 0x80, 0xFF, 0x86, 0x00, 0x15, 0x8F,
+0x00, 0x00, 0x03, 0x3C, 0xFF, 0xFF, 0xFB, 0xF3, 0x7E, 0x7D, 0x03, 0xBC, 0x63, 0x9F, 0x63, 0xBC,
+0x0F, 0xF3, 0xFC, 0xFE, 0xFE, 0x82, 0xFF, 0x0A, 0xFD, 0xF9, 0xFF, 0xFF, 0x3E, 0x00, 0x80, 0x41,
+0xAA, 0x55, 0xEF, 0x81, 0xFF, 0x04, 0xD9, 0x41, 0xAA, 0x40, 0x1F, 0x81, 0xFF, 0x10, 0x7C, 0x03,
+0xAA, 0xD5, 0xE0, 0xCA, 0xD5, 0xEB, 0xE5, 0xF3, 0x19, 0x02, 0x60, 0xF0, 0xFA, 0x7D, 0xBE, 0x85,
+0xFF, 0x0C, 0x7F, 0x1F, 0x2F, 0x17, 0x0F, 0x07, 0x0B, 0x05, 0x02, 0x05, 0x8A, 0x55, 0xBE, 0x82,
+0xDF, 0x05, 0xBF, 0xBE, 0xA0, 0x80, 0x80, 0x8F, 0x81, 0x0F, 0x83, 0x00, 0x80, 0xFF, 0x83, 0x0F,
+0x84, 0x00, 0x80, 0x80, 0x80, 0xCF, 0x08, 0xC0, 0xE8, 0xE8, 0xEC, 0xEC, 0xFE, 0xFE, 0xFF, 0xFF,
+0x84, 0xF0, 0x2E, 0xE6, 0xDA, 0x55, 0x2A, 0x55, 0x28, 0x55, 0x2A, 0x55, 0x28, 0x55, 0x2A, 0x55,
+0x29, 0x55, 0x2B, 0xB3, 0xAB, 0xD3, 0xD9, 0xE5, 0x6A, 0x6C, 0x72, 0x75, 0x76, 0x7B, 0xFA, 0xFD,
+0xAF, 0x47, 0xAB, 0x40, 0x28, 0x90, 0xE2, 0xF8, 0xFF, 0x7F, 0xBF, 0x47, 0xA8, 0xD5, 0xEA, 0xFF,
+0x7F, 0x7F, 0x82, 0xFF, 0x0D, 0xF8, 0x80, 0x00, 0x01, 0x0A, 0x15, 0x3F, 0x1F, 0x0F, 0x37, 0xF3,
+0xE1, 0xC1, 0x80, 0x84, 0x00, 0x12, 0x80, 0x40, 0x68, 0x35, 0x1A, 0x5F, 0x9F, 0x07, 0x87, 0x47,
+0xA7, 0x47, 0xA7, 0x4F, 0xAF, 0x5F, 0x9F, 0x1F, 0x1E, 0x82, 0x00, 0x13, 0x80, 0xC0, 0xFF, 0xFF,
+0x00, 0x00, 0x10, 0x78, 0x38, 0xB8, 0x3C, 0xBC, 0x7C, 0x7C, 0xFA, 0xF7, 0xEF, 0xEF, 0xDF, 0x3F,
+0x85, 0xFF, 0x05, 0x1F, 0x07, 0x07, 0x03, 0x01, 0x01, 0x86, 0x00, 0x03, 0x03, 0x23, 0x03, 0x00,
+0x81, 0x03, 0x33, 0x20, 0x51, 0xC8, 0xE0, 0xF0, 0x02, 0xD4, 0xA9, 0x98, 0x62, 0xC4, 0xC8, 0xB0,
+0x68, 0xD0, 0xA1, 0xD1, 0x60, 0xB1, 0xDA, 0xEF, 0xF7, 0xE3, 0x01, 0x00, 0x3F, 0xFF, 0xAF, 0x5F,
+0xBF, 0x7C, 0xBB, 0x03, 0xBC, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFF, 0xFE, 0x5E, 0xAA, 0xF4, 0x0A,
+0xC1, 0xF0, 0xF3, 0xFF, 0x3F, 0x1F, 0x07, 0x82, 0x00, 0x16, 0x01, 0x02, 0x00, 0x0B, 0x74, 0xFA,
+0xFD, 0xFA, 0xFD, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFA, 0xF5, 0x6A, 0xD5, 0x28, 0x50, 0x0C,
+0x0E, 0x82, 0x0F, 0x16, 0x8F, 0xE0, 0xF8, 0xFC, 0xFA, 0xFD, 0xFE, 0xFD, 0xFE, 0x7D, 0xAA, 0x54,
+0x28, 0x85, 0xF3, 0xFF, 0x7F, 0x7C, 0x03, 0xCF, 0x3F, 0x07, 0x03, 0x87, 0x00, 0x07, 0x40, 0x08,
+0x09, 0x1C, 0x7F, 0x1C, 0x08, 0x08, 0x83, 0x00, 0x2F, 0x20, 0x50, 0xA9, 0x53, 0xC7, 0x3F, 0xE0,
+0x7F, 0xEA, 0xF5, 0xFE, 0xE5, 0xD9, 0xDD, 0x0A, 0xF4, 0xF8, 0xFF, 0xFF, 0xDF, 0xBF, 0xDF, 0xBF,
+0x5F, 0xB8, 0x40, 0x87, 0x3E, 0x7D, 0xFE, 0xFF, 0xFE, 0xE0, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB,
+0xFD, 0xFE, 0xFF, 0xFF, 0x7F, 0x1F, 0x0F, 0x07, 0x03, 0x8B, 0x00, 0x0F, 0x03, 0x0F, 0x3F, 0x7F,
+0xFF, 0xFF, 0x3F, 0xBF, 0x9F, 0xAF, 0x97, 0x4F, 0x57, 0x4A, 0x44, 0xA8,
@@ -1,64 +1,26 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0xe0, 0xe0, 0xf0, 0x70, 0x70, 0xf0, 0xe0, 0xe0, 0x80, 0x00, 0xf0, 0xf0, 0xf0, 0x70, 0x70, 0x70, 
-0x70, 0x00, 0xf0, 0xf0, 0xf0, 0x70, 0x70, 0x70, 0x70, 0x00, 0xf0, 0xf0, 0xf0, 0x00, 0x80, 0xe0, 
-0xe0, 0xf0, 0x70, 0x70, 0xf0, 0xe0, 0xe0, 0x00, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0xe0, 0xf0, 
-0xf0, 0xf0, 0xe0, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-0x1f, 0x1f, 0x3c, 0x38, 0x38, 0x3c, 0x1f, 0x1f, 0x07, 0x00, 0x3f, 0x3f, 0x3f, 0x07, 0x07, 0x07, 
-0x07, 0x00, 0x3f, 0x3f, 0x3f, 0x07, 0x07, 0x07, 0x07, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0x07, 0x1f, 
-0x1f, 0x3c, 0x38, 0x38, 0x3c, 0x1c, 0x1c, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0x38, 0x3f, 0x3f, 0x1f, 
-0x1c, 0x1f, 0x3f, 0x3f, 0x38, 0x00, 0x3f, 0x3f, 0x3f, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 
-0xfe, 0x07, 0x73, 0xfb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x9b, 0x1b, 0x00, 0xfc, 
-0xfe, 0x07, 0xf3, 0xfb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x1b, 0x00, 0xfc, 0xfe, 
-0x07, 0xf3, 0xfb, 0x1b, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x00, 0x00, 0x00, 0x00, 
-0xe0, 0xfc, 0x1e, 0xe3, 0xfb, 0xfb, 0xe3, 0x1e, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 
-0xb3, 0xb7, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xbe, 0x9c, 0xc1, 0xff, 0x7f, 0x00, 0x7f, 
-0xff, 0xc0, 0x9e, 0xbe, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb0, 0x00, 0x7f, 0xff, 
-0xc0, 0x9f, 0xbf, 0xb0, 0xb6, 0xb6, 0xb6, 0xbe, 0xbe, 0x80, 0xff, 0xff, 0x00, 0xc0, 0xf8, 0x3f, 
-0xc7, 0xf8, 0x3f, 0x07, 0xb0, 0xb0, 0xb7, 0xbf, 0xb8, 0x87, 0xbf, 0xf8, 0xc0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x01, 0xe1, 0xf9, 0xf9, 0x79, 0xf9, 0xf9, 0xe1, 0x01, 0x01, 0x01, 0xf9, 0xf8, 0xf8, 0x38, 0x38, 
-0x38, 0xf9, 0xf1, 0xe1, 0x01, 0xc1, 0xf1, 0xf1, 0x79, 0x39, 0x39, 0x79, 0x79, 0x70, 0x00, 0x00, 
-0x01, 0xe1, 0xf9, 0xf9, 0x79, 0xf9, 0xf9, 0xe1, 0x01, 0x01, 0x01, 0xf9, 0xf8, 0xf9, 0x39, 0x38, 
-0x79, 0xf1, 0xf0, 0xc0, 0x01, 0xf9, 0xf9, 0xf9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 
-0x3f, 0x3f, 0x1f, 0x1c, 0x1c, 0x1c, 0x1f, 0x3f, 0x3f, 0x38, 0x00, 0x3f, 0x3f, 0x3f, 0x07, 0x0f, 
-0x1f, 0x3f, 0x3b, 0x31, 0x20, 0x07, 0x1f, 0x1f, 0x3c, 0x38, 0x38, 0x3c, 0x3c, 0x1c, 0x00, 0x38, 
-0x3f, 0x3f, 0x1f, 0x1c, 0x1c, 0x1c, 0x1f, 0x3f, 0x3f, 0x38, 0x00, 0x3f, 0x3f, 0x3f, 0x38, 0x38, 
-0x3c, 0x1f, 0x1f, 0x07, 0x00, 0x3f, 0x3f, 0x3f, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x22, 0x2a, 0x2a, 0x18, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x1c, 0x12, 0x1c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x38, 0x06, 0x18, 0x20, 0x18, 0x06, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x3e, 0x2a, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x9D, 0x00, 0x0A, 0x80, 0xE0, 0xE0, 0xF0, 0x70, 0x70, 0xF0, 0xE0, 0xE0, 0x80, 0x00, 0x81, 0xF0,
+0x82, 0x70, 0x00, 0x00, 0x81, 0xF0, 0x82, 0x70, 0x00, 0x00, 0x81, 0xF0, 0x0A, 0x00, 0x80, 0xE0,
+0xE0, 0xF0, 0x70, 0x70, 0xF0, 0xE0, 0xE0, 0x00, 0x81, 0xF0, 0x81, 0x00, 0x00, 0xE0, 0x81, 0xF0,
+0x00, 0xE0, 0x81, 0x00, 0x81, 0xF0, 0xC4, 0x00, 0x0A, 0x07, 0x1F, 0x1F, 0x3C, 0x38, 0x38, 0x3C,
+0x1F, 0x1F, 0x07, 0x00, 0x81, 0x3F, 0x82, 0x07, 0x00, 0x00, 0x81, 0x3F, 0x82, 0x07, 0x00, 0x00,
+0x81, 0x3F, 0x0A, 0x00, 0x07, 0x1F, 0x1F, 0x3C, 0x38, 0x38, 0x3C, 0x1C, 0x1C, 0x00, 0x81, 0x3F,
+0x0A, 0x00, 0x38, 0x3F, 0x3F, 0x1F, 0x1C, 0x1F, 0x3F, 0x3F, 0x38, 0x00, 0x81, 0x3F, 0x82, 0x38,
+0xC0, 0x00, 0x04, 0xFC, 0xFE, 0x07, 0x73, 0xFB, 0x86, 0xDB, 0x07, 0x9B, 0x1B, 0x00, 0xFC, 0xFE,
+0x07, 0xF3, 0xFB, 0x86, 0xDB, 0x07, 0x1B, 0x00, 0xFC, 0xFE, 0x07, 0xF3, 0xFB, 0x1B, 0x86, 0xDB,
+0x82, 0x00, 0x09, 0xE0, 0xFC, 0x1E, 0xE3, 0xFB, 0xFB, 0xE3, 0x1E, 0xFC, 0xE0, 0xC3, 0x00, 0x02,
+0xB1, 0xB3, 0xB7, 0x85, 0xB6, 0x0A, 0xBE, 0x9C, 0xC1, 0xFF, 0x7F, 0x00, 0x7F, 0xFF, 0xC0, 0x9E,
+0xBE, 0x86, 0xB6, 0x07, 0xB0, 0x00, 0x7F, 0xFF, 0xC0, 0x9F, 0xBF, 0xB0, 0x81, 0xB6, 0x80, 0xBE,
+0x13, 0x80, 0xFF, 0xFF, 0x00, 0xC0, 0xF8, 0x3F, 0xC7, 0xF8, 0x3F, 0x07, 0xB0, 0xB0, 0xB7, 0xBF,
+0xB8, 0x87, 0xBF, 0xF8, 0xC0, 0xC0, 0x00, 0x80, 0x01, 0x06, 0xE1, 0xF9, 0xF9, 0x79, 0xF9, 0xF9,
+0xE1, 0x81, 0x01, 0x02, 0xF9, 0xF8, 0xF8, 0x81, 0x38, 0x16, 0xF9, 0xF1, 0xE1, 0x01, 0xC1, 0xF1,
+0xF1, 0x79, 0x39, 0x39, 0x79, 0x79, 0x70, 0x00, 0x00, 0x01, 0xE1, 0xF9, 0xF9, 0x79, 0xF9, 0xF9,
+0xE1, 0x81, 0x01, 0x09, 0xF9, 0xF8, 0xF9, 0x39, 0x38, 0x79, 0xF1, 0xF0, 0xC0, 0x01, 0x81, 0xF9,
+0x83, 0xB9, 0xC0, 0x00, 0x03, 0x38, 0x3F, 0x3F, 0x1F, 0x81, 0x1C, 0x04, 0x1F, 0x3F, 0x3F, 0x38,
+0x00, 0x81, 0x3F, 0x14, 0x07, 0x0F, 0x1F, 0x3F, 0x3B, 0x31, 0x20, 0x07, 0x1F, 0x1F, 0x3C, 0x38,
+0x38, 0x3C, 0x3C, 0x1C, 0x00, 0x38, 0x3F, 0x3F, 0x1F, 0x81, 0x1C, 0x04, 0x1F, 0x3F, 0x3F, 0x38,
+0x00, 0x81, 0x3F, 0x80, 0x38, 0x04, 0x3C, 0x1F, 0x1F, 0x07, 0x00, 0x81, 0x3F, 0x83, 0x3B, 0xC9,
+0x00, 0x04, 0x1C, 0x22, 0x2A, 0x2A, 0x18, 0x86, 0x00, 0x04, 0x30, 0x1C, 0x12, 0x1C, 0x30, 0x86,
+0x00, 0x06, 0x38, 0x06, 0x18, 0x20, 0x18, 0x06, 0x38, 0x86, 0x00, 0x02, 0x3E, 0x2A, 0x2A, 0xFF,
+0x00, 0xA9, 0x00,
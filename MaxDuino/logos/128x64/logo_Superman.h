@@ -1,64 +1,21 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x80, 0xc0, 0x60, 0x38, 0x08, 0x0c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x0c, 
-0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 
-0x8c, 0x8c, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x8c, 0x8c, 
-0x8c, 0x8c, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x80, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 
-0x86, 0xc3, 0xe1, 0xf0, 0xf8, 0xfc, 0xfe, 0x7f, 0x3f, 0x0f, 0x07, 0x03, 0x01, 0x01, 0x00, 0x00, 
-0x60, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xe0, 0x80, 0x00, 0x01, 0x03, 
-0x0f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc1, 0x83, 
-0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0c, 0x18, 0x30, 0x60, 0xc0, 
-0x03, 0x07, 0x0f, 0x1f, 0x7f, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 
-0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x3e, 0x3e, 
-0x3e, 0x7e, 0x7e, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 
-0x81, 0xc0, 0x60, 0x38, 0x0c, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x03, 0x06, 0x0c, 0x18, 0x30, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x20, 0x60, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x0f, 0x07, 0x83, 0xc0, 0x60, 0x30, 0x18, 0x06, 0x03, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x0c, 0x38, 0x60, 0xc0, 0x81, 0x03, 0x07, 
-0x1f, 0x3f, 0x0f, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0f, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x3f, 0x3e, 0x1e, 0x0c, 
-0x00, 0x00, 0x00, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 
-0x1c, 0x30, 0x60, 0xc0, 0x80, 0x00, 0x00, 0x18, 0x30, 0x70, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 
-0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x70, 0x38, 0x08, 0x00, 0x00, 0x80, 0xe0, 0x30, 0x18, 
-0x0c, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x83, 0x07, 0x0f, 0x1f, 0x3f, 
-0x7f, 0x3f, 0x1f, 0x07, 0x03, 0x81, 0xc0, 0x60, 0x38, 0x0c, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x0c, 0x18, 0x30, 
-0x60, 0x30, 0x18, 0x0e, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xA0, 0x00, 0x05, 0x80, 0xC0, 0x60, 0x38, 0x08, 0x0C, 0x85, 0x8C, 0x88, 0x0C, 0x88, 0x8C, 0x88,
+0x0C, 0x84, 0x8C, 0x85, 0x0C, 0x04, 0x18, 0x30, 0x60, 0xC0, 0x80, 0xB9, 0x00, 0x1B, 0x80, 0xC0,
+0x60, 0x30, 0x18, 0x0C, 0x86, 0xC3, 0xE1, 0xF0, 0xF8, 0xFC, 0xFE, 0x7F, 0x3F, 0x0F, 0x07, 0x03,
+0x01, 0x01, 0x00, 0x00, 0x60, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0x8E, 0xFF, 0x80, 0xFE, 0x80, 0xFC,
+0x08, 0xF8, 0xE0, 0x80, 0x00, 0x01, 0x03, 0x0F, 0x07, 0x01, 0x83, 0x00, 0x0D, 0xFF, 0xFE, 0xFC,
+0xF8, 0xF0, 0xE0, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xB1, 0x00, 0x0D, 0x01, 0x07,
+0x0C, 0x18, 0x30, 0x60, 0xC0, 0x03, 0x07, 0x0F, 0x1F, 0x7F, 0x7F, 0x01, 0x88, 0x00, 0x01, 0x01,
+0x03, 0x81, 0x07, 0x90, 0x0F, 0x83, 0x1F, 0x00, 0x1E, 0x81, 0x3E, 0x80, 0x7E, 0x84, 0xFE, 0x80,
+0xFF, 0x0B, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x81, 0xC0, 0x60, 0x38, 0x0C, 0x06, 0x03, 0xB7, 0x00,
+0x06, 0x03, 0x06, 0x0C, 0x18, 0x30, 0xE0, 0x80, 0x81, 0x00, 0x01, 0x20, 0x60, 0x85, 0xC0, 0x91,
+0x80, 0x8C, 0x00, 0x80, 0x01, 0x0A, 0x07, 0x0F, 0x07, 0x83, 0xC0, 0x60, 0x30, 0x18, 0x06, 0x03,
+0x01, 0xC3, 0x00, 0x0D, 0x01, 0x03, 0x06, 0x0C, 0x38, 0x60, 0xC0, 0x81, 0x03, 0x07, 0x1F, 0x3F,
+0x0F, 0x0F, 0x84, 0x07, 0x80, 0x0F, 0x02, 0x1F, 0x3F, 0x7F, 0x85, 0xFF, 0x83, 0x7F, 0x80, 0x3F,
+0x02, 0x3E, 0x1E, 0x0C, 0x81, 0x00, 0x06, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x07, 0x01, 0xD1, 0x00,
+0x0C, 0x01, 0x03, 0x06, 0x1C, 0x30, 0x60, 0xC0, 0x80, 0x00, 0x00, 0x18, 0x30, 0x70, 0x8B, 0xF0,
+0x0C, 0x70, 0x38, 0x08, 0x00, 0x00, 0x80, 0xE0, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0xDE, 0x00,
+0x18, 0x01, 0x07, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x83, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x3F, 0x1F,
+0x07, 0x03, 0x81, 0xC0, 0x60, 0x38, 0x0C, 0x06, 0x03, 0x01, 0xEB, 0x00, 0x0B, 0x01, 0x03, 0x06,
+0x0C, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0E, 0x03, 0x01, 0xB8, 0x00,
@@ -1,103 +1,26 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xF0,
-0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xC0, 0xFC, 0xFC, 0xC0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xE0, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x7C,
-0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x80, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x80, 0x7C, 0x07, 0x00, 0x00, 0x03,
-0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0x1C, 0x06, 0x06, 0x02,
-0x02, 0x06, 0xC6, 0xFC, 0xF8, 0xE0, 0x00, 0x00, 0x80, 0xE0,
-0xF8, 0xFC, 0x1C, 0x06, 0x06, 0x02, 0x02, 0x06, 0x0E, 0x3C,
-0xF8, 0xF0, 0xE0, 0x80, 0x04, 0x04, 0x04, 0xFC, 0xFC, 0xFC,
-0xFE, 0xE0, 0x30, 0x0C, 0x6C, 0xFE, 0xFE, 0xFC, 0x20, 0x04,
-0x04, 0x0C, 0xFC, 0xFC, 0xFE, 0xFE, 0xC0, 0x30, 0x08, 0x04,
-0x06, 0x06, 0x06, 0xFE, 0xFC, 0xF8, 0xF0, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x80, 0xF8, 0x37, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x37,
-0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC,
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x03, 0x07, 0x07, 0x03, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
-0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
-0xF8, 0xF8, 0xF8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x7F,
-0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xC0, 0x78, 0x04, 0x03, 0x3F, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x3F, 0x0F,
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x03, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x07,
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x06, 0x06, 0x06, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x07,
-0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x00, 0x01, 0x03,
-0x03, 0x06, 0x04, 0x04, 0x04, 0x06, 0x06, 0x03, 0x01, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x06, 0x04, 0x04,
-0x04, 0x06, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x06, 0x06,
-0x06, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x02, 0x00,
-0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07,
-0x06, 0x06, 0x02, 0x00, 0x02, 0x06, 0x06, 0x07, 0x07, 0x07,
-0x07, 0x06, 0x06, 0x06, 0x02, 0x00, 0x01, 0x01, 0x03, 0x02,
-0x06, 0x04, 0x04, 0x0C, 0x08, 0x19, 0x19, 0x1B, 0x3F, 0x23,
-0x61, 0x61, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x01, 0x01, 0x03, 0x07, 0x0E, 0x0E, 0x04, 0x00,
-0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xE7, 0x00, 0x09, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x99, 0x00, 0x03,
+0xC0, 0xFC, 0xFC, 0xC0, 0xD2, 0x00, 0x02, 0xE0, 0xFC, 0xFE, 0x88, 0xFF, 0x02, 0xFE, 0xF8, 0xE0,
+0x94, 0x00, 0x02, 0xC0, 0x7C, 0x1F, 0x81, 0xFF, 0x01, 0xFC, 0x80, 0xCE, 0x00, 0x00, 0xE0, 0x90,
+0xFF, 0x00, 0xF0, 0x90, 0x00, 0x06, 0x80, 0x7C, 0x07, 0x00, 0x00, 0x03, 0x3F, 0x81, 0xFF, 0x00,
+0xF8, 0x85, 0x00, 0x1F, 0x80, 0xE0, 0xF0, 0xF8, 0x1C, 0x06, 0x06, 0x02, 0x02, 0x06, 0xC6, 0xFC,
+0xF8, 0xE0, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0xFC, 0x1C, 0x06, 0x06, 0x02, 0x02, 0x06, 0x0E, 0x3C,
+0xF8, 0xF0, 0xE0, 0x80, 0x81, 0x04, 0x81, 0xFC, 0x13, 0xFE, 0xE0, 0x30, 0x0C, 0x6C, 0xFE, 0xFE,
+0xFC, 0x20, 0x04, 0x04, 0x0C, 0xFC, 0xFC, 0xFE, 0xFE, 0xC0, 0x30, 0x08, 0x04, 0x81, 0x06, 0x03,
+0xFE, 0xFC, 0xF8, 0xF0, 0x84, 0x00, 0x00, 0xF0, 0x92, 0xFF, 0x01, 0xFE, 0x80, 0x8C, 0x00, 0x02,
+0x80, 0xF8, 0x37, 0x84, 0x30, 0x01, 0x37, 0x7F, 0x81, 0xFF, 0x00, 0xF0, 0x82, 0x00, 0x00, 0xFC,
+0x82, 0xFF, 0x84, 0x00, 0x05, 0x03, 0x07, 0x07, 0x03, 0x00, 0xFE, 0x82, 0xFF, 0x86, 0x00, 0x82,
+0xFF, 0x02, 0xF8, 0x00, 0x00, 0x82, 0xFF, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x82,
+0xFF, 0x85, 0x00, 0x82, 0xFF, 0x84, 0x00, 0x94, 0xF8, 0x00, 0x38, 0x8B, 0x00, 0x01, 0xF8, 0x0F,
+0x88, 0x00, 0x00, 0x0F, 0x82, 0xFF, 0x08, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0x80,
+0x85, 0x00, 0x08, 0xC0, 0x78, 0x04, 0x03, 0x3F, 0x7F, 0xFF, 0xFF, 0x80, 0x84, 0x00, 0x04, 0xC0,
+0xFF, 0xFF, 0x3F, 0x0F, 0x81, 0x00, 0x82, 0xFF, 0x89, 0x00, 0x82, 0xFF, 0x85, 0x00, 0x82, 0xFF,
+0x85, 0x00, 0x04, 0x03, 0x0F, 0x1F, 0x3F, 0x7F, 0x89, 0xFF, 0x04, 0x7F, 0x3F, 0x1F, 0x07, 0x01,
+0x88, 0x00, 0x81, 0x06, 0x00, 0x07, 0x83, 0x06, 0x83, 0x00, 0x82, 0x06, 0x82, 0x07, 0x82, 0x06,
+0x04, 0x00, 0x01, 0x03, 0x03, 0x06, 0x81, 0x04, 0x80, 0x06, 0x01, 0x03, 0x01, 0x83, 0x00, 0x03,
+0x01, 0x03, 0x03, 0x06, 0x81, 0x04, 0x03, 0x06, 0x07, 0x03, 0x01, 0x81, 0x00, 0x81, 0x06, 0x82,
+0x07, 0x81, 0x06, 0x00, 0x02, 0x82, 0x00, 0x81, 0x06, 0x82, 0x07, 0x80, 0x06, 0x04, 0x02, 0x00,
+0x02, 0x06, 0x06, 0x82, 0x07, 0x81, 0x06, 0x15, 0x02, 0x00, 0x01, 0x01, 0x03, 0x02, 0x06, 0x04,
+0x04, 0x0C, 0x08, 0x19, 0x19, 0x1B, 0x3F, 0x23, 0x61, 0x61, 0xC0, 0xC0, 0x80, 0x80, 0xFC, 0x00,
+0x80, 0x01, 0x04, 0x03, 0x07, 0x0E, 0x0E, 0x04, 0x83, 0x00,
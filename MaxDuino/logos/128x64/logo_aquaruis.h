@@ -1,103 +1,36 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8,
-0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8,
-0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0x00, 0x00, 0xE0, 0xFC, 0xFE,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x1F,
-0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0x80, 0x00, 0x00,
-0xF8, 0xFC, 0xFC, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xF8, 0xFC, 0xFC, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00,
-0xE0, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF0, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
-0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-0xFC, 0xFC, 0xFC, 0x00, 0x80, 0xFC, 0xFC, 0xFC, 0xFC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFC, 0xFC, 0xFC, 0xFC,
-0x00, 0x00, 0xF0, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE,
-0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xC0, 0xFC, 0xFF, 0xFF, 0x7F, 0x1F,
-0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x07, 0x00,
-0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x80, 0x00, 0x00,
-0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xFF, 0xFF,
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0xFE, 0xFF, 0xFF,
-0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x80,
-0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
-0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x03, 0x07, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xC0, 0xFC, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0xC0, 0xC0, 0xDF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFC, 0xE0, 0x00, 0x00,
-0x00, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0xFC, 0xC0, 0x00, 0x00,
-0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
-0x3F, 0x00, 0xE0, 0xFE, 0xFF, 0xFF, 0xFF, 0xC3, 0xC0, 0xC0,
-0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
-0xFF, 0x01, 0x40, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFC, 0xFF,
-0xFF, 0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x3F, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xE0, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFC, 0xFF, 0xFF,
-0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFF,
-0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xF0, 0x80, 0x00,
-0x00, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFE, 0xF0, 0xC0, 0xFC,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFC,
-0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x07, 0x03,
-0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xFF, 0xFF,
-0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF,
-0xFF, 0xFF, 0x0F, 0x00, 0xF0, 0x80, 0x00, 0x00, 0x01, 0x03,
-0x07, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xC0, 0xFC, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0x00,
-0x00, 0x00, 0x81, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
-0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
-0x00, 0x07, 0x7F, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x00, 0xFF,
-0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xF8, 0xF0, 0xF0, 0xF8, 0xFC,
-0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F,
-0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF,
-0xFF, 0xFF, 0x7F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0xC0,
-0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x0F,
-0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x0F, 0x3F, 0x3F, 0x3F, 0x3E, 0x20,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x94, 0x00, 0x04, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0x83, 0xF8, 0x03, 0xF0, 0xE0, 0xC0, 0x80, 0xE4,
+0x00, 0x01, 0xC0, 0xF8, 0x82, 0xFC, 0x05, 0xF8, 0x00, 0x00, 0xE0, 0xFC, 0xFE, 0x85, 0xFF, 0x80,
+0x0F, 0x80, 0x1F, 0x00, 0x7F, 0x81, 0xFF, 0x05, 0xFC, 0xF0, 0x80, 0x00, 0x00, 0xF8, 0x81, 0xFC,
+0x00, 0x08, 0x84, 0x00, 0x00, 0xF8, 0x81, 0xFC, 0x00, 0x08, 0x82, 0x00, 0x00, 0xE0, 0x83, 0xFC,
+0x00, 0xF0, 0x83, 0x00, 0x00, 0xF8, 0x87, 0xFC, 0x80, 0xF8, 0x01, 0xF0, 0xC0, 0x81, 0x00, 0x82,
+0xFC, 0x01, 0x00, 0x80, 0x82, 0xFC, 0x84, 0x00, 0x00, 0xE0, 0x82, 0xFC, 0x80, 0x00, 0x03, 0xF0,
+0xFC, 0xFE, 0xFE, 0x81, 0xFF, 0x80, 0xFE, 0x8B, 0x00, 0x06, 0xC0, 0xFC, 0xFF, 0xFF, 0x7F, 0x1F,
+0x7F, 0x84, 0xFF, 0x05, 0x1F, 0x07, 0x00, 0x00, 0x03, 0x1F, 0x81, 0xFF, 0x01, 0xF8, 0x80, 0x81,
+0x00, 0x01, 0x03, 0x1F, 0x81, 0xFF, 0x01, 0xF0, 0xC0, 0x82, 0xFF, 0x85, 0x00, 0x82, 0xFF, 0x81,
+0x00, 0x05, 0xE0, 0xFE, 0xFF, 0xFF, 0x3F, 0x3F, 0x81, 0xFF, 0x00, 0xFC, 0x81, 0x00, 0x00, 0x80,
+0x82, 0xFF, 0x83, 0x07, 0x00, 0x0F, 0x82, 0xFF, 0x02, 0xFC, 0x00, 0xF8, 0x81, 0xFF, 0x01, 0x0F,
+0x00, 0x82, 0xFF, 0x00, 0x03, 0x84, 0x00, 0x82, 0xFF, 0x01, 0x03, 0x00, 0x83, 0xFF, 0x81, 0x01,
+0x01, 0x03, 0x07, 0x89, 0x00, 0x01, 0xC0, 0xFC, 0x81, 0xFF, 0x00, 0xC7, 0x81, 0xC0, 0x00, 0xDF,
+0x82, 0xFF, 0x03, 0xE7, 0xFF, 0xFC, 0xE0, 0x82, 0x00, 0x05, 0x0F, 0x7F, 0xFF, 0xFF, 0xFC, 0xC0,
+0x81, 0x00, 0x00, 0x07, 0x85, 0xFF, 0x00, 0x07, 0x84, 0x00, 0x00, 0xFC, 0x81, 0xFF, 0x03, 0x3F,
+0x00, 0xE0, 0xFE, 0x81, 0xFF, 0x03, 0xC3, 0xC0, 0xC0, 0xC7, 0x82, 0xFF, 0x01, 0xC0, 0x00, 0x82,
+0xFF, 0x01, 0x01, 0x40, 0x82, 0xC0, 0x01, 0xE0, 0xFC, 0x81, 0xFF, 0x01, 0x3F, 0x00, 0x82, 0xFF,
+0x80, 0x00, 0x82, 0xFF, 0x85, 0x00, 0x82, 0xFF, 0x80, 0x00, 0x01, 0x07, 0x3F, 0x82, 0xFF, 0x03,
+0xFE, 0xFC, 0xF8, 0xE0, 0x87, 0x00, 0x01, 0xC0, 0xFC, 0x81, 0xFF, 0x86, 0x7F, 0x82, 0xFF, 0x05,
+0xBF, 0xFF, 0xFF, 0xFE, 0xF0, 0x80, 0x81, 0x00, 0x07, 0x03, 0x3F, 0xFF, 0xFF, 0xFE, 0xF0, 0xC0,
+0xFC, 0x85, 0xFF, 0x00, 0x80, 0x84, 0x00, 0x82, 0xFF, 0x03, 0xF8, 0xFC, 0xFF, 0xFF, 0x87, 0x7F,
+0x81, 0xFF, 0x00, 0xFE, 0x82, 0xFF, 0x80, 0x00, 0x01, 0x0F, 0x7F, 0x82, 0xFF, 0x04, 0x0F, 0x07,
+0x03, 0x00, 0xF8, 0x81, 0xFF, 0x01, 0x1F, 0x00, 0x82, 0xFF, 0x00, 0xC1, 0x84, 0x00, 0x00, 0xFE,
+0x81, 0xFF, 0x09, 0x0F, 0x00, 0xF0, 0x80, 0x00, 0x00, 0x01, 0x03, 0x07, 0x1F, 0x82, 0xFF, 0x84,
+0x00, 0x01, 0xC0, 0xFC, 0x81, 0xFF, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x1F, 0x81, 0xFF, 0x00, 0xFD,
+0x82, 0xFF, 0x01, 0xF8, 0xC0, 0x81, 0x00, 0x01, 0x81, 0xDF, 0x83, 0xFF, 0x03, 0x9F, 0x07, 0x1F,
+0x7F, 0x8E, 0xFF, 0x00, 0x0F, 0x87, 0x00, 0x00, 0x1F, 0x84, 0xFF, 0x00, 0x01, 0x82, 0x00, 0x07,
+0x07, 0x7F, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x00, 0x82, 0xFF, 0x80, 0x00, 0x01, 0x0F, 0x7F, 0x8B,
+0xFF, 0x80, 0x00, 0x80, 0xFF, 0x05, 0xFE, 0xF8, 0xF0, 0xF0, 0xF8, 0xFC, 0x81, 0xFF, 0x00, 0x7F,
+0x84, 0x00, 0x83, 0x01, 0x8B, 0x00, 0x03, 0x07, 0x0F, 0x3F, 0x7F, 0x83, 0xFF, 0x80, 0xFE, 0x81,
+0xFF, 0x02, 0x7F, 0x3F, 0x3F, 0x81, 0xFF, 0x02, 0xFC, 0xC0, 0x00, 0x8D, 0x01, 0x8A, 0x00, 0x84,
+0x01, 0x85, 0x00, 0x83, 0x01, 0x00, 0x00, 0x82, 0x01, 0x83, 0x00, 0x8A, 0x01, 0x80, 0x00, 0x02,
+0x03, 0x0F, 0x1F, 0x83, 0x3F, 0x02, 0x1F, 0x0F, 0x03, 0x9C, 0x00, 0x00, 0x01, 0x84, 0x03, 0x00,
+0x01, 0x82, 0x00, 0x01, 0x01, 0x0F, 0x81, 0x3F, 0x01, 0x3E, 0x20, 0xD2, 0x00,
@@ -1,103 +1,42 @@
-0x00, 0x00, 0x00, 0x00, 0x70, 0xF8, 0xF0, 0xE0, 0xC0, 0xF0,
-0xF8, 0x70, 0x00, 0x00, 0x30, 0x78, 0x78, 0x30, 0x00, 0x00,
-0x70, 0x78, 0xF0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF0, 0xE0, 0xC0,
-0xF0, 0xF8, 0x78, 0x30, 0x00, 0x00, 0x70, 0x78, 0x70, 0x00,
-0x00, 0x70, 0x78, 0xF0, 0xE0, 0xC0, 0xF0, 0xF8, 0x78, 0x30,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xC0,
-0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0,
-0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xCE, 0xCF, 0xCF, 0x07, 0x03, 0x01, 0x00, 0x00,
-0x70, 0x78, 0xFC, 0xFE, 0xFE, 0xFC, 0x78, 0x78, 0x00, 0x00,
-0x01, 0x03, 0x03, 0x0F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x00,
-0x00, 0x70, 0x78, 0xFC, 0xFE, 0xFF, 0xFE, 0xF8, 0x78, 0x30,
-0x00, 0x01, 0x03, 0x03, 0x8F, 0xCF, 0xCE, 0x84, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x83, 0xFF,
-0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
-0x01, 0x03, 0xCF, 0xFF, 0xFF, 0xFE, 0x18, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x80, 0xF0, 0xFC, 0xFE, 0x7F, 0x0F, 0x07, 0x03,
-0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03,
-0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x33, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xF8, 0xF8, 0xF0, 0xC0,
-0xC1, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0E,
-0x1E, 0x3C, 0xF8, 0x3C, 0x1E, 0x0E, 0x0E, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x03, 0x03, 0x81, 0xC0, 0xE0, 0xF0, 0x78, 0x7C,
-0x1E, 0x1F, 0x3F, 0x7F, 0x73, 0x20, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x1F, 0x0E,
-0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x1F, 0x1F, 0x7F, 0xF8,
-0xF8, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-0xFF, 0xFF, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F,
-0x1F, 0x3F, 0xFF, 0xF8, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00,
-0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFE, 0xF8, 0xFC, 0xFE, 0xFF, 0xFE, 0xFC, 0xF8, 0xFE,
-0xFF, 0xCE, 0x00, 0x00, 0x0E, 0x0F, 0x0F, 0x0E, 0x00, 0x00,
-0x0E, 0x0F, 0x0F, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x86, 0xFF, 0xEE, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0xC0,
-0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0x7F, 0x3F, 0x1F,
-0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0,
-0x7F, 0x3F, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-0x1F, 0x3F, 0x7F, 0xFC, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0,
-0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x78, 0x38, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F,
-0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1,
-0xE0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x73,
-0x71, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
-0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
-0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF8, 0xE0, 0xC0, 0xC0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xCF, 0xCF, 0x84,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xFF, 0x0F, 0x0F, 0x7C, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x80,
-0xE0, 0x7C, 0x1F, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF1,
-0xF3, 0x60, 0x00, 0x00, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x30,
-0x30, 0x30, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x70, 0x30, 0x30,
-0x10, 0x00, 0x80, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30,
-0xF0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
-0xC0, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0xE0, 0xF1, 0x7F,
-0xFF, 0xFF, 0xCF, 0xC7, 0x03, 0x01, 0xC0, 0xE0, 0xF0, 0x7B,
-0xFF, 0xFF, 0xFF, 0xCF, 0x03, 0x03, 0x07, 0x0F, 0x1F, 0x3C,
-0x78, 0xF8, 0xE0, 0xE0, 0xF1, 0xFB, 0x3B, 0x30, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-0x00, 0x00, 0x01, 0x0F, 0x3E, 0x78, 0x3E, 0x0F, 0x03, 0x00,
-0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00,
-0x00, 0x00, 0x0F, 0x1F, 0x38, 0x70, 0x60, 0x60, 0x70, 0x30,
-0x00, 0x00, 0x00, 0x7F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x0F, 0x3F, 0x38, 0x70, 0x60, 0x60, 0x60, 0x70, 0x3F, 0x1F,
-0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x03, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03,
-0x01, 0x00, 0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00, 0x01,
-0x01, 0x01, 0x00, 0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x01,
-0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x03, 0x03, 0x07, 0x0F, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x82, 0x00, 0x2D, 0x70, 0xF8, 0xF0, 0xE0, 0xC0, 0xF0, 0xF8, 0x70, 0x00, 0x00, 0x30, 0x78, 0x78,
+0x30, 0x00, 0x00, 0x70, 0x78, 0xF0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF0, 0xE0, 0xC0, 0xF0, 0xF8, 0x78,
+0x30, 0x00, 0x00, 0x70, 0x78, 0x70, 0x00, 0x00, 0x70, 0x78, 0xF0, 0xE0, 0xC0, 0xF0, 0xF8, 0x78,
+0x30, 0x87, 0x00, 0x83, 0xC0, 0x00, 0xE0, 0x85, 0xC0, 0x00, 0x80, 0x87, 0x00, 0x00, 0x80, 0x83,
+0xC0, 0x00, 0xE0, 0x84, 0xC0, 0x80, 0x80, 0x8A, 0x00, 0x00, 0x80, 0x81, 0xC0, 0x84, 0xE0, 0x81,
+0xC0, 0x00, 0x80, 0x87, 0x00, 0x14, 0xCE, 0xCF, 0xCF, 0x07, 0x03, 0x01, 0x00, 0x00, 0x70, 0x78,
+0xFC, 0xFE, 0xFE, 0xFC, 0x78, 0x78, 0x00, 0x00, 0x01, 0x03, 0x03, 0x81, 0x0F, 0x15, 0x07, 0x03,
+0x01, 0x00, 0x00, 0x70, 0x78, 0xFC, 0xFE, 0xFF, 0xFE, 0xF8, 0x78, 0x30, 0x00, 0x01, 0x03, 0x03,
+0x8F, 0xCF, 0xCE, 0x84, 0x87, 0x00, 0x81, 0xFF, 0x00, 0x01, 0x82, 0x00, 0x81, 0x01, 0x00, 0x83,
+0x81, 0xFF, 0x00, 0x7E, 0x85, 0x00, 0x82, 0xFF, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x05, 0x03,
+0xCF, 0xFF, 0xFF, 0xFE, 0x18, 0x83, 0x00, 0x09, 0x80, 0xF0, 0xFC, 0xFE, 0x7F, 0x0F, 0x07, 0x03,
+0x01, 0x01, 0x82, 0x00, 0x80, 0x01, 0x80, 0x03, 0x80, 0x07, 0x86, 0x00, 0x00, 0x33, 0x81, 0xFF,
+0x80, 0xFE, 0x80, 0xF8, 0x05, 0xF0, 0xC0, 0xC1, 0x03, 0x03, 0x01, 0x82, 0x00, 0x08, 0x0C, 0x0E,
+0x1E, 0x3C, 0xF8, 0x3C, 0x1E, 0x0E, 0x0E, 0x83, 0x00, 0x80, 0x03, 0x0B, 0x81, 0xC0, 0xE0, 0xF0,
+0x78, 0x7C, 0x1E, 0x1F, 0x3F, 0x7F, 0x73, 0x20, 0x87, 0x00, 0x81, 0xFF, 0x00, 0x1F, 0x84, 0x0E,
+0x07, 0x0F, 0x1F, 0x1F, 0x7F, 0xF8, 0xF8, 0xF0, 0xC0, 0x83, 0x00, 0x82, 0xFF, 0x84, 0x0E, 0x80,
+0x0F, 0x05, 0x1F, 0x3F, 0xFF, 0xF8, 0xF0, 0xC0, 0x82, 0x00, 0x82, 0xFF, 0x00, 0x80, 0x95, 0x00,
+0x00, 0xCE, 0x8A, 0xFF, 0x17, 0xFE, 0xF8, 0xFC, 0xFE, 0xFF, 0xFE, 0xFC, 0xF8, 0xFE, 0xFF, 0xCE,
+0x00, 0x00, 0x0E, 0x0F, 0x0F, 0x0E, 0x00, 0x00, 0x0E, 0x0F, 0x0F, 0x03, 0x03, 0x83, 0x00, 0x03,
+0x86, 0xFF, 0xEE, 0x84, 0x87, 0x00, 0x81, 0xFF, 0x00, 0xF0, 0x84, 0xC0, 0x80, 0xE0, 0x05, 0xF0,
+0xF8, 0x7F, 0x3F, 0x1F, 0x07, 0x83, 0x00, 0x00, 0x7F, 0x81, 0xFF, 0x00, 0xE0, 0x83, 0xC0, 0x80,
+0xE0, 0x80, 0xF0, 0x03, 0x7F, 0x3F, 0x3F, 0x0F, 0x83, 0x00, 0x08, 0x07, 0x1F, 0x3F, 0x7F, 0xFC,
+0xF8, 0xF0, 0xE0, 0xE0, 0x82, 0xC0, 0x80, 0xE0, 0x80, 0xF0, 0x01, 0x78, 0x38, 0x86, 0x00, 0x06,
+0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x8E, 0xFF, 0x03, 0xF1, 0xE0, 0xC0, 0xC0, 0x8D, 0x00,
+0x03, 0x31, 0x73, 0x71, 0x30, 0x8D, 0x00, 0x80, 0x01, 0x02, 0x00, 0x01, 0x01, 0x88, 0x00, 0x00,
+0x80, 0x84, 0x00, 0x80, 0x01, 0x80, 0x00, 0x80, 0x01, 0x91, 0x00, 0x85, 0x01, 0x93, 0x00, 0x06,
+0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x88, 0xFF, 0x00, 0x7F, 0x81, 0xFF, 0x05, 0xFE, 0xF8,
+0xF8, 0xE0, 0xC0, 0xC0, 0x85, 0x00, 0x03, 0xCE, 0xCF, 0xCF, 0x84, 0x88, 0x00, 0x05, 0xFF, 0x0F,
+0x0F, 0x7C, 0xF0, 0xC0, 0x81, 0x00, 0x06, 0x80, 0xE0, 0x7C, 0x1F, 0x07, 0xFF, 0xFF, 0x81, 0x00,
+0x07, 0xF1, 0xF3, 0x60, 0x00, 0x00, 0xC0, 0xE0, 0x70, 0x83, 0x30, 0x81, 0x00, 0x80, 0xF0, 0x07,
+0x70, 0x30, 0x30, 0x10, 0x00, 0x80, 0xE0, 0x70, 0x83, 0x30, 0x01, 0xF0, 0xE0, 0x94, 0x00, 0x82,
+0xC0, 0x80, 0x00, 0x81, 0xC0, 0x80, 0x00, 0x80, 0xC0, 0x0C, 0xE0, 0xF1, 0x7F, 0xFF, 0xFF, 0xCF,
+0xC7, 0x03, 0x01, 0xC0, 0xE0, 0xF0, 0x7B, 0x81, 0xFF, 0x0E, 0xCF, 0x03, 0x03, 0x07, 0x0F, 0x1F,
+0x3C, 0x78, 0xF8, 0xE0, 0xE0, 0xF1, 0xFB, 0x3B, 0x30, 0x88, 0x00, 0x00, 0x7F, 0x81, 0x00, 0x06,
+0x01, 0x0F, 0x3E, 0x78, 0x3E, 0x0F, 0x03, 0x81, 0x00, 0x80, 0x3F, 0x81, 0x00, 0x01, 0x3F, 0x7F,
+0x81, 0x00, 0x07, 0x0F, 0x1F, 0x38, 0x70, 0x60, 0x60, 0x70, 0x30, 0x81, 0x00, 0x01, 0x7F, 0x3F,
+0x83, 0x00, 0x03, 0x0F, 0x3F, 0x38, 0x70, 0x81, 0x60, 0x03, 0x70, 0x3F, 0x1F, 0x03, 0x94, 0x00,
+0x80, 0x03, 0x0A, 0x01, 0x00, 0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0x01, 0x81, 0x00,
+0x81, 0x01, 0x80, 0x00, 0x07, 0x01, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0x01, 0x86, 0x00, 0x80,
+0x03, 0x03, 0x07, 0x0F, 0x0F, 0x04, 0xCC, 0x00,
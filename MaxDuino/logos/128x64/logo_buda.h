@@ -1,64 +1,23 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe, 0x3e, 0xff, 
-0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 
-0xfc, 0xf8, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x04, 0xda, 0x3f, 0xef, 0x1f, 0x87, 0xff, 0x07, 0x7f, 0x01, 0x1f, 0x3f, 0x40, 0x87, 
-0x1d, 0x33, 0x2f, 0x58, 0x61, 0x27, 0x0c, 0x13, 0x27, 0x08, 0x91, 0x83, 0x87, 0x8f, 0x94, 0x88, 
-0x91, 0x83, 0x8d, 0x8a, 0x94, 0x84, 0xa9, 0x13, 0x27, 0x07, 0x0f, 0x1f, 0x2f, 0x1f, 0xff, 0xff, 
-0x7f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xfe, 0xf8, 0xf0, 0x80, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xfe, 0x01, 0x00, 0x3f, 0x60, 0xc0, 0x83, 0xa6, 0xac, 0x88, 0x88, 0x88, 0x88, 0x08, 
-0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x9f, 0xff, 0x7f, 0x7f, 0x7f, 0x7f, 
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0x7c, 0xfc, 
-0xfc, 0xfc, 0xfc, 0xf9, 0xf8, 0xf8, 0xfa, 0xf9, 0xf8, 0xf3, 0xe7, 0x07, 0x3f, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x49, 0x45, 0xe4, 0x12, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0xe0, 0xf2, 0xf9, 0xf9, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 
-0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xf8, 0xe1, 0xc1, 0x03, 0x07, 0x1f, 0x7f, 0xff, 0xfc, 0xfd, 
-0xff, 0x7f, 0x3f, 0x9f, 0x8f, 0xcf, 0xcf, 0xc7, 0xc7, 0xcf, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfc, 0xf8, 0xf9, 0xf1, 0xf1, 
-0xe1, 0xe3, 0xeb, 0xe3, 0xe3, 0xe7, 0xe7, 0xe7, 0xef, 0xfc, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0x9e, 0x1f, 0x1f, 0x1f, 0xbf, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x07, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0f, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x3f, 0x7f, 0x7f, 0x7f, 0x38, 0x38, 0x30, 0x20, 0x60, 0x40, 0x40, 0x60, 0x60, 
-0xf0, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0f, 0x1f, 0x3f, 
-0x7f, 0xff, 0xff, 0xff, 0xfe, 0xf0, 0xe3, 0xe3, 0xe7, 0xe6, 0xc6, 0xc4, 0xc4, 0xc4, 0xec, 0xfc, 
-0xfc, 0xfe, 0x7f, 0x3f, 0x0f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xA2, 0x00, 0x0A, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0x3E, 0x82, 0xFF,
+0x00, 0x3F, 0x82, 0xFF, 0x80, 0x3F, 0x87, 0xFF, 0x01, 0x3F, 0x7F, 0x86, 0xFF, 0x80, 0xFE, 0x80,
+0xFC, 0x80, 0xF8, 0x04, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0xC8, 0x00, 0x30, 0x04, 0xDA, 0x3F, 0xEF,
+0x1F, 0x87, 0xFF, 0x07, 0x7F, 0x01, 0x1F, 0x3F, 0x40, 0x87, 0x1D, 0x33, 0x2F, 0x58, 0x61, 0x27,
+0x0C, 0x13, 0x27, 0x08, 0x91, 0x83, 0x87, 0x8F, 0x94, 0x88, 0x91, 0x83, 0x8D, 0x8A, 0x94, 0x84,
+0xA9, 0x13, 0x27, 0x07, 0x0F, 0x1F, 0x2F, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF, 0x7F, 0x81, 0xFF, 0x06,
+0x7F, 0xFF, 0xFF, 0xFE, 0xF8, 0xF0, 0x80, 0xC3, 0x00, 0x08, 0xFE, 0x01, 0x00, 0x3F, 0x60, 0xC0,
+0x83, 0xA6, 0xAC, 0x82, 0x88, 0x80, 0x08, 0x85, 0x00, 0x80, 0x0F, 0x01, 0x9F, 0xFF, 0x87, 0x7F,
+0x83, 0xFF, 0x81, 0xFE, 0x01, 0xFC, 0x7C, 0x82, 0xFC, 0x09, 0xF9, 0xF8, 0xF8, 0xFA, 0xF9, 0xF8,
+0xF3, 0xE7, 0x07, 0x3F, 0xC9, 0x00, 0x80, 0x88, 0x03, 0x49, 0x45, 0xE4, 0x12, 0x84, 0x00, 0x05,
+0xC0, 0xE0, 0xE0, 0xF2, 0xF9, 0xF9, 0x81, 0xFC, 0x84, 0xFE, 0x80, 0xFC, 0x80, 0xF8, 0x13, 0xE1,
+0xC1, 0x03, 0x07, 0x1F, 0x7F, 0xFF, 0xFC, 0xFD, 0xFF, 0x7F, 0x3F, 0x9F, 0x8F, 0xCF, 0xCF, 0xC7,
+0xC7, 0xCF, 0x0F, 0xC9, 0x00, 0x80, 0x08, 0x03, 0x04, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0xFE,
+0x85, 0xFF, 0x0B, 0xFE, 0xFC, 0xFC, 0xF8, 0xF9, 0xF1, 0xF1, 0xE1, 0xE3, 0xEB, 0xE3, 0xE3, 0x81,
+0xE7, 0x03, 0xEF, 0xFC, 0xFC, 0xFE, 0x83, 0xFF, 0x00, 0x9E, 0x81, 0x1F, 0x00, 0xBF, 0x82, 0x3F,
+0xD6, 0x00, 0x02, 0x07, 0x1F, 0x7F, 0x90, 0xFF, 0x00, 0x7F, 0x82, 0xFF, 0x81, 0x7F, 0x83, 0xFF,
+0x83, 0xFE, 0xDA, 0x00, 0x04, 0x01, 0x03, 0x0F, 0x1F, 0x7F, 0x87, 0xFF, 0x00, 0x3F, 0x81, 0x7F,
+0x80, 0x38, 0x08, 0x30, 0x20, 0x60, 0x40, 0x40, 0x60, 0x60, 0xF0, 0xFB, 0x83, 0xFF, 0x01, 0x7F,
+0x1F, 0xE0, 0x00, 0x05, 0x01, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x81, 0xFF, 0x06, 0xFE, 0xF0, 0xE3,
+0xE3, 0xE7, 0xE6, 0xC6, 0x81, 0xC4, 0x08, 0xEC, 0xFC, 0xFC, 0xFE, 0x7F, 0x3F, 0x0F, 0x07, 0x01,
+0xA7, 0x00,
@@ -1,64 +1,29 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xf0, 
-0xf8, 0x7c, 0x1f, 0x0f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0xf0, 0xf0, 
-0x78, 0x78, 0x78, 0x78, 0x70, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0x78, 0x78, 0x78, 
-0xf0, 0xf0, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0f, 0x1f, 0x3e, 0xf8, 
-0xf0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf8, 0xfe, 0x3f, 0x0f, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x7f, 0xff, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xfc, 0xff, 0x7f, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x03, 0x0f, 0x3f, 0xfe, 0xf8, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3f, 0xff, 0xff, 0xf0, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xe0, 0xfc, 0xff, 0x7f, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x7f, 0xff, 0xfc, 0xe0, 
-0xc0, 0xf8, 0xff, 0xff, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0xff, 
-0xff, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xc0, 0xe0, 0xc0, 0xe0, 0xc0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xf0, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfb, 0xfb, 0xfb, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 
-0xf8, 0xf8, 0xf8, 0xf8, 0xf0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xf0, 0xff, 0x7f, 0x3f, 0x0f, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x0f, 0x3f, 0x7f, 0xff, 0xf0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xf8, 0xf8, 0xf8, 0xf8, 
-0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfb, 0xfb, 0xfb, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xc0, 0xe0, 0xc0, 0xe0, 0xc0, 
-0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x37, 0xf7, 0xf7, 0xe7, 
-0x87, 0x07, 0x07, 0x07, 0x03, 0x01, 0x01, 0xc1, 0xc1, 0x81, 0x41, 0xc0, 0x80, 0x80, 0x40, 0xc0, 
-0x80, 0x00, 0x40, 0x40, 0xc0, 0x80, 0x00, 0x40, 0xc0, 0xc0, 0x80, 0x40, 0x00, 0x00, 0x80, 0xc0, 
-0x40, 0xe0, 0xe0, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0xd0, 0xd0, 0x00, 0xc0, 0xc0, 
-0x40, 0x40, 0xc0, 0x80, 0x00, 0x80, 0xc1, 0x41, 0x81, 0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x87, 
-0xe7, 0xf7, 0xf7, 0x37, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 
-0x0f, 0x1f, 0x7c, 0x78, 0x70, 0xc0, 0x80, 0x87, 0x87, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x07, 
-0x07, 0x02, 0x07, 0x05, 0x07, 0x07, 0x00, 0x04, 0x02, 0x01, 0x07, 0x06, 0x04, 0x00, 0x03, 0x07, 
-0x04, 0x07, 0x07, 0x00, 0x03, 0x07, 0x04, 0x04, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 
-0x00, 0x00, 0x07, 0x07, 0x00, 0x03, 0x07, 0x04, 0x03, 0x80, 0xc0, 0xf0, 0xf8, 0x7c, 0x3e, 0x0f, 
-0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x9B, 0x00, 0x08, 0x80, 0xC0, 0xF0, 0xF8, 0x7C, 0x1F, 0x0F, 0x07, 0x01, 0x84, 0x00, 0x03, 0xC0,
+0xE0, 0xF0, 0xF0, 0x82, 0x78, 0x04, 0x70, 0xF0, 0xE0, 0xC0, 0x80, 0x8D, 0x00, 0x04, 0x80, 0xC0,
+0xE0, 0xF0, 0xF0, 0x81, 0x78, 0x80, 0xF0, 0x01, 0xE0, 0xC0, 0x84, 0x00, 0x08, 0x01, 0x07, 0x0F,
+0x1F, 0x3E, 0xF8, 0xF0, 0xC0, 0x80, 0xB5, 0x00, 0x05, 0xE0, 0xF8, 0xFE, 0x3F, 0x0F, 0x03, 0x89,
+0x00, 0x82, 0xFF, 0x84, 0x00, 0x05, 0x01, 0x0F, 0x7F, 0xFF, 0xFC, 0xE0, 0x88, 0x00, 0x06, 0x80,
+0xE0, 0xFC, 0xFF, 0x7F, 0x0F, 0x01, 0x83, 0x00, 0x82, 0xFF, 0x89, 0x00, 0x05, 0x03, 0x0F, 0x3F,
+0xFE, 0xF8, 0xE0, 0xB0, 0x00, 0x03, 0xF8, 0xFF, 0xFF, 0x07, 0x8D, 0x00, 0x82, 0xFF, 0x87, 0x00,
+0x05, 0x07, 0x3F, 0xFF, 0xFF, 0xF0, 0x80, 0x83, 0x00, 0x05, 0xE0, 0xFC, 0xFF, 0x7F, 0x0F, 0x01,
+0x86, 0x00, 0x82, 0xFF, 0x8D, 0x00, 0x03, 0x07, 0xFF, 0xFF, 0xF8, 0xAD, 0x00, 0x81, 0xFF, 0x8F,
+0x00, 0x82, 0xFF, 0x89, 0x00, 0x0B, 0x01, 0x0F, 0x7F, 0xFF, 0xFC, 0xE0, 0xC0, 0xF8, 0xFF, 0xFF,
+0x1F, 0x03, 0x89, 0x00, 0x82, 0xFF, 0x8F, 0x00, 0x81, 0xFF, 0xAC, 0x00, 0x03, 0x7F, 0xFF, 0xFF,
+0x80, 0x8E, 0x00, 0x82, 0xFF, 0x8C, 0x00, 0x05, 0x03, 0x1F, 0xFF, 0xFF, 0x1F, 0x03, 0x8C, 0x00,
+0x82, 0xFF, 0x8E, 0x00, 0x00, 0x80, 0x81, 0xFF, 0x95, 0x00, 0x04, 0xC0, 0xE0, 0xC0, 0xE0, 0xC0,
+0x89, 0xE0, 0x00, 0xF0, 0x85, 0xF8, 0x81, 0xFB, 0x87, 0xF8, 0x00, 0xF0, 0x82, 0xC0, 0x05, 0xE0,
+0xF0, 0xFF, 0x7F, 0x3F, 0x0F, 0x8E, 0x00, 0x00, 0x01, 0x8F, 0x00, 0x04, 0x0F, 0x3F, 0x7F, 0xFF,
+0xF0, 0x84, 0xE0, 0x87, 0xF8, 0x81, 0xFB, 0x85, 0xF8, 0x00, 0xF0, 0x89, 0xE0, 0x09, 0xC0, 0xE0,
+0xC0, 0xE0, 0xC0, 0x00, 0x01, 0x00, 0x01, 0x00, 0x89, 0x01, 0x00, 0x03, 0x89, 0x07, 0x04, 0x37,
+0xF7, 0xF7, 0xE7, 0x87, 0x81, 0x07, 0x34, 0x03, 0x01, 0x01, 0xC1, 0xC1, 0x81, 0x41, 0xC0, 0x80,
+0x80, 0x40, 0xC0, 0x80, 0x00, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x40, 0xC0, 0xC0, 0x80, 0x40, 0x00,
+0x00, 0x80, 0xC0, 0x40, 0xE0, 0xE0, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0xD0, 0xD0,
+0x00, 0xC0, 0xC0, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x80, 0xC1, 0x41, 0x81, 0x81, 0x01, 0x81, 0x07,
+0x04, 0x87, 0xE7, 0xF7, 0xF7, 0x37, 0x89, 0x07, 0x00, 0x03, 0x89, 0x01, 0x03, 0x00, 0x01, 0x00,
+0x01, 0x9D, 0x00, 0x43, 0x01, 0x07, 0x0F, 0x1F, 0x7C, 0x78, 0x70, 0xC0, 0x80, 0x87, 0x87, 0x00,
+0x00, 0x07, 0x07, 0x00, 0x00, 0x07, 0x07, 0x02, 0x07, 0x05, 0x07, 0x07, 0x00, 0x04, 0x02, 0x01,
+0x07, 0x06, 0x04, 0x00, 0x03, 0x07, 0x04, 0x07, 0x07, 0x00, 0x03, 0x07, 0x04, 0x04, 0x07, 0x07,
+0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x03, 0x07, 0x04, 0x03, 0x80,
+0xC0, 0xF0, 0xF8, 0x7C, 0x3E, 0x0F, 0x07, 0x01, 0x9C, 0x00,
@@ -1,64 +1,24 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xfe, 0xce, 0xfe, 0xfe, 0xee, 0xfe, 0xfe, 0xfe, 0xfe, 0x3e, 0x3e, 0x3e, 
-0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 
-0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 
-0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 
-0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 
-0x3e, 0x3e, 0x3e, 0xfe, 0xfe, 0xfe, 0xfe, 0xee, 0xc6, 0xfe, 0xc6, 0xfe, 0xfc, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0xc0, 0x30, 0x3e, 0xf8, 0x70, 0x10, 0x7c, 0xfe, 0xf0, 0x80, 0x80, 0x40, 0x70, 0x58, 0x7e, 0xf8, 
-0xf0, 0xc0, 0x80, 0x82, 0x46, 0x2e, 0x3e, 0x7c, 0xf8, 0xe4, 0xc2, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 
-0x82, 0xc6, 0x38, 0x00, 0x00, 0x7e, 0xfe, 0xfe, 0x80, 0x80, 0x7e, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 
-0x00, 0x00, 0xfe, 0x1c, 0x3c, 0x78, 0x70, 0xfe, 0x00, 0x00, 0x38, 0xfe, 0xfe, 0x82, 0xc6, 0x38, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xf0, 0x18, 0x0c, 0x04, 0x04, 0xc4, 0x74, 0x3c, 0xcc, 0xec, 0x34, 0x34, 0x34, 0x34, 0x14, 0x34, 
-0x34, 0xec, 0x9c, 0x34, 0xc4, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xc4, 0xf4, 0xfc, 
-0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x9c, 0xcc, 0xec, 
-0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0xb4, 0xcc, 0xdc, 0x7c, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf0, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x7f, 0x80, 0x00, 0x00, 0x0f, 0x3f, 0xe0, 0x8f, 0x79, 0x78, 0xc0, 0x80, 0x80, 0xc0, 0x80, 0xc0, 
-0xc0, 0x78, 0x9f, 0xc6, 0x7f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x9f, 0xbf, 0x78, 
-0xc0, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x78, 0x79, 0x9f, 0xe0, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xc0, 0xc1, 0xc3, 0xc2, 0xc2, 0xc2, 0xc2, 0xc3, 0xc3, 0xc3, 0xc2, 0xc2, 0xc3, 0xc3, 0xc2, 0xc2, 
-0xc2, 0xc3, 0xc3, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc3, 
-0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc2, 
-0xc2, 0xc2, 0xc3, 0xc3, 0xc2, 0xc2, 0xc2, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc1, 
-0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0x7f, 0x87, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 
-0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0x77, 
-0x77, 0x77, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 
-0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0x07, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0x01, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x0f, 0x1f, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xc3, 0xc3, 0xc7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xc3, 0xc7, 0xc7, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x1f, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0x0f, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-0x00, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x00, 
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x92, 0x00, 0x04, 0xFE, 0xCE, 0xFE, 0xFE, 0xEE, 0x82, 0xFE, 0xC4, 0x3E, 0x82, 0xFE, 0x05, 0xEE,
+0xC6, 0xFE, 0xC6, 0xFE, 0xFC, 0xA5, 0x00, 0x84, 0xFF, 0x01, 0x03, 0x01, 0x82, 0x00, 0x1C, 0xC0,
+0x30, 0x3E, 0xF8, 0x70, 0x10, 0x7C, 0xFE, 0xF0, 0x80, 0x80, 0x40, 0x70, 0x58, 0x7E, 0xF8, 0xF0,
+0xC0, 0x80, 0x82, 0x46, 0x2E, 0x3E, 0x7C, 0xF8, 0xE4, 0xC2, 0x00, 0x00, 0x81, 0xFE, 0x0C, 0x82,
+0xC6, 0x38, 0x00, 0x00, 0x7E, 0xFE, 0xFE, 0x80, 0x80, 0x7E, 0x00, 0x00, 0x81, 0xFE, 0x80, 0x00,
+0x0D, 0xFE, 0x1C, 0x3C, 0x78, 0x70, 0xFE, 0x00, 0x00, 0x38, 0xFE, 0xFE, 0x82, 0xC6, 0x38, 0x82,
+0x00, 0x01, 0x01, 0x03, 0x85, 0xFF, 0xA5, 0x00, 0x84, 0xFF, 0x84, 0x00, 0x09, 0xF0, 0x18, 0x0C,
+0x04, 0x04, 0xC4, 0x74, 0x3C, 0xCC, 0xEC, 0x82, 0x34, 0x07, 0x14, 0x34, 0x34, 0xEC, 0x9C, 0x34,
+0xC4, 0x84, 0x85, 0x04, 0x01, 0xC4, 0xF4, 0x8C, 0xFC, 0x02, 0x9C, 0xCC, 0xEC, 0x84, 0x34, 0x03,
+0xB4, 0xCC, 0xDC, 0x7C, 0x82, 0xFC, 0x01, 0xF8, 0xF0, 0x84, 0x00, 0x85, 0xFF, 0xA5, 0x00, 0x84,
+0xFF, 0x84, 0x00, 0x15, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0x3F, 0xE0, 0x8F, 0x79, 0x78, 0xC0, 0x80,
+0x80, 0xC0, 0x80, 0xC0, 0xC0, 0x78, 0x9F, 0xC6, 0x7F, 0x1F, 0x85, 0x00, 0x00, 0x3F, 0x8C, 0xFF,
+0x0E, 0xE0, 0x9F, 0xBF, 0x78, 0xC0, 0x80, 0xC0, 0xC0, 0x80, 0x80, 0x78, 0x79, 0x9F, 0xE0, 0xF9,
+0x83, 0xFF, 0x84, 0x00, 0x85, 0xFF, 0xA5, 0x00, 0x84, 0xFF, 0x85, 0xC0, 0x01, 0xC1, 0xC3, 0x82,
+0xC2, 0x81, 0xC3, 0x80, 0xC2, 0x80, 0xC3, 0x81, 0xC2, 0x80, 0xC3, 0x8A, 0xC2, 0x8E, 0xC3, 0x81,
+0xC2, 0x80, 0xC3, 0x81, 0xC2, 0x85, 0xC3, 0x80, 0xC1, 0x84, 0xC0, 0x85, 0xFF, 0xA5, 0x00, 0x8C,
+0xFF, 0x01, 0x7F, 0x87, 0x99, 0xF7, 0x81, 0x77, 0x99, 0xF7, 0x00, 0x07, 0x8D, 0xFF, 0xA5, 0x00,
+0x01, 0xFF, 0x9F, 0x89, 0xFF, 0x01, 0x01, 0xE0, 0x84, 0xFF, 0x02, 0x9F, 0x0F, 0x1F, 0x84, 0xFF,
+0x80, 0xC3, 0x01, 0xC7, 0xEF, 0x87, 0xFF, 0x80, 0xFC, 0x00, 0xFE, 0x87, 0xFF, 0x03, 0xC7, 0xC3,
+0xC7, 0xC7, 0x83, 0xFF, 0x02, 0x1F, 0x0F, 0x0F, 0x84, 0xFF, 0x02, 0xFC, 0x01, 0x0F, 0x85, 0xFF,
+0x05, 0xDF, 0x0F, 0xFF, 0x0F, 0xFF, 0xFF, 0xA5, 0x00, 0x80, 0x01, 0x88, 0x03, 0x01, 0x00, 0x02,
+0xBA, 0x03, 0x01, 0x02, 0x00, 0x89, 0x03, 0x00, 0x01, 0x92, 0x00,
@@ -1,64 +1,66 @@
-0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x04, 0x82, 0x40, 0x00, 0x20, 0x14, 0x80, 0x24, 0x02, 0x50, 
-0x08, 0x22, 0x88, 0x52, 0x08, 0xa4, 0x10, 0x4c, 0x22, 0x10, 0x48, 0x2a, 0x00, 0x10, 0x14, 0x40, 
-0x2a, 0x00, 0x14, 0x02, 0x00, 0x20, 0x0a, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x24, 0x00, 
-0x00, 0x12, 0x80, 0x10, 0x04, 0x42, 0x00, 0x20, 0x12, 0x08, 0x00, 0x02, 0x48, 0x02, 0x20, 0x14, 
-0x00, 0x0a, 0x80, 0x48, 0x22, 0x00, 0x10, 0x04, 0x42, 0x00, 0x00, 0x52, 0x00, 0x4a, 0x00, 0x08, 
-0x42, 0x08, 0x04, 0x42, 0x10, 0x09, 0x44, 0x22, 0x10, 0x02, 0x08, 0x80, 0x04, 0x40, 0x00, 0x04, 
-0x40, 0x24, 0x00, 0x92, 0x40, 0x14, 0x42, 0x28, 0x92, 0x48, 0x02, 0xa0, 0x49, 0x04, 0xa0, 0x12, 
-0x48, 0x02, 0x54, 0x91, 0x54, 0x4a, 0xa4, 0x12, 0x48, 0x2a, 0x84, 0x51, 0x24, 0x92, 0x40, 0x12, 
-0x00, 0x00, 0x10, 0x82, 0x10, 0x00, 0x92, 0x00, 0x88, 0x44, 0x20, 0x0a, 0x40, 0x00, 0x94, 0x00, 
-0x4a, 0x35, 0xd4, 0xba, 0xcd, 0x6a, 0xb5, 0x4a, 0xe9, 0x04, 0x01, 0x01, 0x01, 0x80, 0x63, 0x99, 
-0xf6, 0x4a, 0xb9, 0xc4, 0x78, 0x85, 0x50, 0x40, 0x21, 0x00, 0x00, 0x09, 0x40, 0x20, 0x08, 0x84, 
-0x00, 0x42, 0x00, 0x00, 0x40, 0x20, 0x12, 0x00, 0x00, 0x29, 0x00, 0x04, 0x41, 0x20, 0x08, 0x01, 
-0xa8, 0x04, 0x00, 0x44, 0x00, 0x00, 0x40, 0x0a, 0x00, 0x40, 0x12, 0x00, 0x08, 0x82, 0x00, 0x01, 
-0x80, 0x40, 0x09, 0x00, 0x00, 0x41, 0x10, 0x80, 0x48, 0x01, 0x60, 0x10, 0x48, 0xa0, 0x88, 0x52, 
-0x49, 0xa0, 0x4a, 0x40, 0x24, 0x42, 0x35, 0xf4, 0xaa, 0x74, 0x92, 0xec, 0xb2, 0xfd, 0x50, 0xf6, 
-0x01, 0x24, 0x05, 0x10, 0x06, 0x51, 0x04, 0x52, 0x09, 0xa2, 0x0a, 0x10, 0x8a, 0x20, 0x08, 0x21, 
-0x00, 0x20, 0x00, 0x12, 0x80, 0x00, 0x44, 0x20, 0x0a, 0x00, 0xaa, 0x01, 0x94, 0x41, 0x28, 0x00, 
-0xb4, 0x02, 0x81, 0x13, 0x8e, 0x4b, 0x1d, 0xaf, 0x3a, 0x6d, 0x3e, 0xd4, 0x7f, 0x2a, 0x7d, 0x57, 
-0x3c, 0x17, 0x1d, 0x0a, 0x05, 0x8a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x51, 0x04, 
-0x50, 0x0a, 0xa1, 0x08, 0xa1, 0x08, 0xa0, 0x44, 0x20, 0x02, 0xa0, 0x01, 0x10, 0x80, 0x08, 0x41, 
-0x28, 0x00, 0x48, 0x24, 0x02, 0x00, 0x00, 0x42, 0x10, 0x80, 0x2a, 0x80, 0x40, 0x14, 0xc0, 0x08, 
-0xa2, 0x90, 0x40, 0x14, 0xc1, 0x28, 0x92, 0x04, 0x12, 0x0d, 0x75, 0xdd, 0xeb, 0x6e, 0xf2, 0xbd, 
-0xeb, 0xac, 0x60, 0x80, 0xc0, 0x60, 0xbc, 0xd7, 0xfa, 0x6f, 0xbb, 0xee, 0xfb, 0x5e, 0x2b, 0x0d, 
-0x85, 0x40, 0x00, 0x20, 0x95, 0x48, 0x55, 0x2a, 0x89, 0x24, 0x92, 0x41, 0x28, 0x04, 0xa2, 0x00, 
-0x00, 0x00, 0x94, 0x02, 0x00, 0x90, 0x08, 0x00, 0x80, 0x24, 0x00, 0x84, 0x40, 0x04, 0x02, 0xa1, 
-0x04, 0x22, 0x11, 0x04, 0x2a, 0x12, 0x88, 0x26, 0x48, 0x25, 0x50, 0x2a, 0x90, 0x4a, 0x21, 0x90, 
-0x42, 0x50, 0x29, 0x84, 0x61, 0x10, 0x40, 0x28, 0x80, 0x42, 0x10, 0x00, 0x40, 0x24, 0x02, 0x01, 
-0x10, 0x45, 0x14, 0x4a, 0x22, 0x99, 0x44, 0x28, 0x42, 0x29, 0x54, 0x80, 0x6a, 0x10, 0x44, 0x22, 
-0x90, 0x02, 0x49, 0x24, 0x29, 0x86, 0x51, 0x90, 0x48, 0xa0, 0xa5, 0x80, 0x46, 0x91, 0x04, 0x92, 
-0x49, 0x24, 0x10, 0x4b, 0x20, 0x14, 0x00, 0x40, 0x00, 0xa0, 0x11, 0xc0, 0x03, 0x47, 0x0b, 0x4f, 
-0x06, 0x9b, 0x4d, 0x1f, 0x4b, 0x2d, 0x0f, 0x47, 0x26, 0x07, 0x93, 0x41, 0x88, 0xa4, 0x42, 0x21, 
-0xa8, 0x24, 0x92, 0x69, 0x14, 0x45, 0x2a, 0x05, 0x52, 0x08, 0x45, 0x00, 0x24, 0x11, 0x00, 0x88, 
-0x00, 0x00, 0x04, 0x20, 0x02, 0x10, 0x00, 0x8a, 0x00, 0x80, 0x54, 0x02, 0x20, 0x04, 0x22, 0x00, 
-0xa4, 0x02, 0x51, 0x00, 0x52, 0x01, 0xa8, 0x00, 0xaa, 0x01, 0x48, 0x25, 0x10, 0x4a, 0x24, 0x12, 
-0x4a, 0x21, 0x94, 0x49, 0x04, 0x51, 0x04, 0x91, 0x44, 0x20, 0x10, 0x84, 0x52, 0x01, 0x90, 0x00, 
-0x48, 0x25, 0x80, 0x51, 0xa4, 0x12, 0x80, 0x45, 0x10, 0x45, 0x12, 0xc8, 0x22, 0x49, 0xa4, 0x51, 
-0xec, 0x12, 0xed, 0x52, 0xe9, 0x74, 0xaa, 0xea, 0x95, 0xd2, 0x54, 0x02, 0x5a, 0x00, 0x55, 0x08, 
-0x42, 0x11, 0x00, 0xa8, 0x00, 0x54, 0x01, 0x34, 0x81, 0x54, 0x0b, 0x74, 0x0a, 0xa5, 0x52, 0x09, 
-0xd2, 0x0d, 0xb0, 0x4d, 0x22, 0x95, 0x2a, 0x45, 0x92, 0x55, 0x0a, 0xa5, 0x00, 0x56, 0x02, 0x51, 
-0x04, 0x92, 0x40, 0x0a, 0x41, 0x28, 0x05, 0x40, 0x25, 0x90, 0x0a, 0xa1, 0x50, 0x89, 0x50, 0x4c, 
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x08, 0x04, 0x02, 0x01, 0x00, 0x81, 
-0x20, 0x10, 0x02, 0x91, 0x08, 0x85, 0x40, 0x24, 0x02, 0x90, 0x4a, 0x21, 0x08, 0x05, 0x20, 0x15, 
-0x88, 0x05, 0x40, 0x2a, 0x01, 0xa8, 0x01, 0x94, 0x40, 0x14, 0x01, 0xa4, 0x10, 0x8a, 0x00, 0x80, 
-0x44, 0x11, 0x04, 0x92, 0x08, 0x46, 0x12, 0x48, 0x45, 0x52, 0x15, 0xaa, 0x12, 0x6d, 0xaa, 0x77, 
-0x9a, 0xf5, 0xaa, 0x7f, 0x4a, 0xff, 0x57, 0x7a, 0xaf, 0xda, 0x6d, 0xaa, 0x55, 0x00, 0x49, 0x04, 
-0x41, 0x24, 0x10, 0xab, 0x90, 0x45, 0x91, 0x24, 0xa9, 0x14, 0x41, 0x94, 0x41, 0x2a, 0x05, 0x51, 
-0x0c, 0x22, 0x88, 0x25, 0x41, 0x28, 0x02, 0xa9, 0x10, 0x84, 0x22, 0x88, 0x22, 0x29, 0x80, 0x55, 
-0x08, 0x42, 0x28, 0x85, 0x50, 0x05, 0x52, 0x01, 0xa8, 0x52, 0x89, 0x64, 0x12, 0x48, 0x16, 0x41, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x24, 0x01, 0x00, 0x00, 0x08, 
-0x04, 0x80, 0x00, 0x12, 0x00, 0x00, 0x20, 0x08, 0x04, 0x00, 0x90, 0x08, 0x04, 0x82, 0x21, 0x08, 
-0x02, 0xa0, 0x09, 0xa4, 0x11, 0x84, 0x20, 0x8a, 0x20, 0x8a, 0x21, 0x88, 0x24, 0x92, 0x08, 0x44, 
-0x00, 0x24, 0x00, 0x54, 0x28, 0xa4, 0x19, 0x44, 0x2b, 0x94, 0x4b, 0x54, 0x02, 0xab, 0x55, 0x0b, 
-0xc5, 0x20, 0x96, 0x09, 0xa7, 0x12, 0x49, 0x37, 0x15, 0x9a, 0x6d, 0x5e, 0xb7, 0xc8, 0x25, 0xc0, 
-0x54, 0x01, 0xd4, 0x2a, 0xaa, 0x55, 0x54, 0xa5, 0x50, 0x2a, 0x41, 0x94, 0x68, 0x02, 0xa9, 0x40, 
-0x15, 0x42, 0x00, 0x2a, 0x81, 0x54, 0x01, 0x28, 0xa4, 0x14, 0xa1, 0x08, 0xa5, 0x00, 0xaa, 0x00, 
-0x55, 0x00, 0xad, 0x40, 0x2a, 0x81, 0x54, 0x09, 0x8a, 0x41, 0x24, 0x12, 0x01, 0x80, 0x29, 0x84, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x80, 0x40, 0x20, 0x10, 0x01, 0x10, 0x00, 0x80, 0x50, 0x04, 0x00, 0x80, 0x20, 0x08, 0x00, 
-0x05, 0x80, 0x40, 0x20, 0x14, 0x02, 0x00, 0x08, 0x82, 0x00, 0x08, 0x44, 0x00, 0x04, 0x02, 0x41, 
-0x10, 0x04, 0x52, 0x00, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x84, 0x22, 
-0x00, 0x02, 0x00, 0x50, 0x04, 0x02, 0x01, 0x80, 0x01, 0x80, 0x40, 0x21, 0x12, 0x89, 0x20, 0x88, 
-0x24, 0x81, 0x44, 0x12, 0x08, 0x85, 0x42, 0x2a, 0x10, 0x47, 0x30, 0x8a, 0x44, 0x11, 0x44, 0x12, 
-0x49, 0x04, 0x01, 0x14, 0x80, 0x14, 0x42, 0x00, 0xa2, 0x00, 0x94, 0x42, 0x28, 0x12, 0x08, 0x82, 
-0x49, 0x04, 0x02, 0x40, 0x12, 0x00, 0x88, 0x44, 0x00, 0xa0, 0x14, 0x42, 0x29, 0xa4, 0x12, 0xa4
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x80, 0x00, 0x28, 0x10, 0x04, 0x00, 0x00, 0x04, 0x82, 0x40, 0x00, 0x20, 0x14, 0x80, 0x24, 0x02,
+0x50, 0x08, 0x22, 0x88, 0x52, 0x08, 0xA4, 0x10, 0x4C, 0x22, 0x10, 0x48, 0x2A, 0x00, 0x10, 0x14,
+0x40, 0x2A, 0x00, 0x14, 0x02, 0x00, 0x20, 0x0A, 0x00, 0x00, 0x10, 0x08, 0x81, 0x00, 0x6B, 0x24,
+0x00, 0x00, 0x12, 0x80, 0x10, 0x04, 0x42, 0x00, 0x20, 0x12, 0x08, 0x00, 0x02, 0x48, 0x02, 0x20,
+0x14, 0x00, 0x0A, 0x80, 0x48, 0x22, 0x00, 0x10, 0x04, 0x42, 0x00, 0x00, 0x52, 0x00, 0x4A, 0x00,
+0x08, 0x42, 0x08, 0x04, 0x42, 0x10, 0x09, 0x44, 0x22, 0x10, 0x02, 0x08, 0x80, 0x04, 0x40, 0x00,
+0x04, 0x40, 0x24, 0x00, 0x92, 0x40, 0x14, 0x42, 0x28, 0x92, 0x48, 0x02, 0xA0, 0x49, 0x04, 0xA0,
+0x12, 0x48, 0x02, 0x54, 0x91, 0x54, 0x4A, 0xA4, 0x12, 0x48, 0x2A, 0x84, 0x51, 0x24, 0x92, 0x40,
+0x12, 0x00, 0x00, 0x10, 0x82, 0x10, 0x00, 0x92, 0x00, 0x88, 0x44, 0x20, 0x0A, 0x40, 0x00, 0x94,
+0x00, 0x4A, 0x35, 0xD4, 0xBA, 0xCD, 0x6A, 0xB5, 0x4A, 0xE9, 0x04, 0x81, 0x01, 0x7F, 0x80, 0x63,
+0x99, 0xF6, 0x4A, 0xB9, 0xC4, 0x78, 0x85, 0x50, 0x40, 0x21, 0x00, 0x00, 0x09, 0x40, 0x20, 0x08,
+0x84, 0x00, 0x42, 0x00, 0x00, 0x40, 0x20, 0x12, 0x00, 0x00, 0x29, 0x00, 0x04, 0x41, 0x20, 0x08,
+0x01, 0xA8, 0x04, 0x00, 0x44, 0x00, 0x00, 0x40, 0x0A, 0x00, 0x40, 0x12, 0x00, 0x08, 0x82, 0x00,
+0x01, 0x80, 0x40, 0x09, 0x00, 0x00, 0x41, 0x10, 0x80, 0x48, 0x01, 0x60, 0x10, 0x48, 0xA0, 0x88,
+0x52, 0x49, 0xA0, 0x4A, 0x40, 0x24, 0x42, 0x35, 0xF4, 0xAA, 0x74, 0x92, 0xEC, 0xB2, 0xFD, 0x50,
+0xF6, 0x01, 0x24, 0x05, 0x10, 0x06, 0x51, 0x04, 0x52, 0x09, 0xA2, 0x0A, 0x10, 0x8A, 0x20, 0x08,
+0x21, 0x00, 0x20, 0x00, 0x12, 0x80, 0x00, 0x44, 0x20, 0x0A, 0x00, 0xAA, 0x01, 0x94, 0x41, 0x28,
+0x00, 0xB4, 0x02, 0x81, 0x13, 0x8E, 0x4B, 0x1D, 0xAF, 0x3A, 0x6D, 0x3E, 0xD4, 0x7F, 0x09, 0x2A,
+0x7D, 0x57, 0x3C, 0x17, 0x1D, 0x0A, 0x05, 0x8A, 0x05, 0x84, 0x00, 0x51, 0x04, 0x51, 0x04, 0x50,
+0x0A, 0xA1, 0x08, 0xA1, 0x08, 0xA0, 0x44, 0x20, 0x02, 0xA0, 0x01, 0x10, 0x80, 0x08, 0x41, 0x28,
+0x00, 0x48, 0x24, 0x02, 0x00, 0x00, 0x42, 0x10, 0x80, 0x2A, 0x80, 0x40, 0x14, 0xC0, 0x08, 0xA2,
+0x90, 0x40, 0x14, 0xC1, 0x28, 0x92, 0x04, 0x12, 0x0D, 0x75, 0xDD, 0xEB, 0x6E, 0xF2, 0xBD, 0xEB,
+0xAC, 0x60, 0x80, 0xC0, 0x60, 0xBC, 0xD7, 0xFA, 0x6F, 0xBB, 0xEE, 0xFB, 0x5E, 0x2B, 0x0D, 0x85,
+0x40, 0x00, 0x20, 0x95, 0x48, 0x55, 0x2A, 0x89, 0x24, 0x92, 0x41, 0x28, 0x04, 0xA2, 0x81, 0x00,
+0x7F, 0x94, 0x02, 0x00, 0x90, 0x08, 0x00, 0x80, 0x24, 0x00, 0x84, 0x40, 0x04, 0x02, 0xA1, 0x04,
+0x22, 0x11, 0x04, 0x2A, 0x12, 0x88, 0x26, 0x48, 0x25, 0x50, 0x2A, 0x90, 0x4A, 0x21, 0x90, 0x42,
+0x50, 0x29, 0x84, 0x61, 0x10, 0x40, 0x28, 0x80, 0x42, 0x10, 0x00, 0x40, 0x24, 0x02, 0x01, 0x10,
+0x45, 0x14, 0x4A, 0x22, 0x99, 0x44, 0x28, 0x42, 0x29, 0x54, 0x80, 0x6A, 0x10, 0x44, 0x22, 0x90,
+0x02, 0x49, 0x24, 0x29, 0x86, 0x51, 0x90, 0x48, 0xA0, 0xA5, 0x80, 0x46, 0x91, 0x04, 0x92, 0x49,
+0x24, 0x10, 0x4B, 0x20, 0x14, 0x00, 0x40, 0x00, 0xA0, 0x11, 0xC0, 0x03, 0x47, 0x0B, 0x4F, 0x06,
+0x9B, 0x4D, 0x1F, 0x4B, 0x2D, 0x0F, 0x47, 0x26, 0x07, 0x93, 0x41, 0x88, 0xA4, 0x42, 0x21, 0xA8,
+0x24, 0x92, 0x69, 0x14, 0x45, 0x2A, 0x05, 0x52, 0x08, 0x45, 0x00, 0x24, 0x11, 0x00, 0x88, 0x00,
+0x00, 0x7D, 0x04, 0x20, 0x02, 0x10, 0x00, 0x8A, 0x00, 0x80, 0x54, 0x02, 0x20, 0x04, 0x22, 0x00,
+0xA4, 0x02, 0x51, 0x00, 0x52, 0x01, 0xA8, 0x00, 0xAA, 0x01, 0x48, 0x25, 0x10, 0x4A, 0x24, 0x12,
+0x4A, 0x21, 0x94, 0x49, 0x04, 0x51, 0x04, 0x91, 0x44, 0x20, 0x10, 0x84, 0x52, 0x01, 0x90, 0x00,
+0x48, 0x25, 0x80, 0x51, 0xA4, 0x12, 0x80, 0x45, 0x10, 0x45, 0x12, 0xC8, 0x22, 0x49, 0xA4, 0x51,
+0xEC, 0x12, 0xED, 0x52, 0xE9, 0x74, 0xAA, 0xEA, 0x95, 0xD2, 0x54, 0x02, 0x5A, 0x00, 0x55, 0x08,
+0x42, 0x11, 0x00, 0xA8, 0x00, 0x54, 0x01, 0x34, 0x81, 0x54, 0x0B, 0x74, 0x0A, 0xA5, 0x52, 0x09,
+0xD2, 0x0D, 0xB0, 0x4D, 0x22, 0x95, 0x2A, 0x45, 0x92, 0x55, 0x0A, 0xA5, 0x00, 0x56, 0x02, 0x51,
+0x04, 0x92, 0x40, 0x0A, 0x41, 0x28, 0x05, 0x40, 0x25, 0x90, 0x0A, 0xA1, 0x50, 0x89, 0x50, 0x4C,
+0x81, 0x00, 0x7C, 0x09, 0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x08, 0x04, 0x02, 0x01, 0x00, 0x81,
+0x20, 0x10, 0x02, 0x91, 0x08, 0x85, 0x40, 0x24, 0x02, 0x90, 0x4A, 0x21, 0x08, 0x05, 0x20, 0x15,
+0x88, 0x05, 0x40, 0x2A, 0x01, 0xA8, 0x01, 0x94, 0x40, 0x14, 0x01, 0xA4, 0x10, 0x8A, 0x00, 0x80,
+0x44, 0x11, 0x04, 0x92, 0x08, 0x46, 0x12, 0x48, 0x45, 0x52, 0x15, 0xAA, 0x12, 0x6D, 0xAA, 0x77,
+0x9A, 0xF5, 0xAA, 0x7F, 0x4A, 0xFF, 0x57, 0x7A, 0xAF, 0xDA, 0x6D, 0xAA, 0x55, 0x00, 0x49, 0x04,
+0x41, 0x24, 0x10, 0xAB, 0x90, 0x45, 0x91, 0x24, 0xA9, 0x14, 0x41, 0x94, 0x41, 0x2A, 0x05, 0x51,
+0x0C, 0x22, 0x88, 0x25, 0x41, 0x28, 0x02, 0xA9, 0x10, 0x84, 0x22, 0x88, 0x22, 0x29, 0x80, 0x55,
+0x08, 0x42, 0x28, 0x85, 0x50, 0x05, 0x52, 0x01, 0xA8, 0x52, 0x89, 0x64, 0x12, 0x48, 0x16, 0x41,
+0x84, 0x00, 0x00, 0x01, 0x81, 0x00, 0x75, 0x40, 0x24, 0x01, 0x00, 0x00, 0x08, 0x04, 0x80, 0x00,
+0x12, 0x00, 0x00, 0x20, 0x08, 0x04, 0x00, 0x90, 0x08, 0x04, 0x82, 0x21, 0x08, 0x02, 0xA0, 0x09,
+0xA4, 0x11, 0x84, 0x20, 0x8A, 0x20, 0x8A, 0x21, 0x88, 0x24, 0x92, 0x08, 0x44, 0x00, 0x24, 0x00,
+0x54, 0x28, 0xA4, 0x19, 0x44, 0x2B, 0x94, 0x4B, 0x54, 0x02, 0xAB, 0x55, 0x0B, 0xC5, 0x20, 0x96,
+0x09, 0xA7, 0x12, 0x49, 0x37, 0x15, 0x9A, 0x6D, 0x5E, 0xB7, 0xC8, 0x25, 0xC0, 0x54, 0x01, 0xD4,
+0x2A, 0xAA, 0x55, 0x54, 0xA5, 0x50, 0x2A, 0x41, 0x94, 0x68, 0x02, 0xA9, 0x40, 0x15, 0x42, 0x00,
+0x2A, 0x81, 0x54, 0x01, 0x28, 0xA4, 0x14, 0xA1, 0x08, 0xA5, 0x00, 0xAA, 0x00, 0x55, 0x00, 0xAD,
+0x40, 0x2A, 0x81, 0x54, 0x09, 0x8A, 0x41, 0x24, 0x12, 0x01, 0x80, 0x29, 0x84, 0x88, 0x00, 0x01,
+0x02, 0x20, 0x83, 0x00, 0x24, 0x80, 0x40, 0x20, 0x10, 0x01, 0x10, 0x00, 0x80, 0x50, 0x04, 0x00,
+0x80, 0x20, 0x08, 0x00, 0x05, 0x80, 0x40, 0x20, 0x14, 0x02, 0x00, 0x08, 0x82, 0x00, 0x08, 0x44,
+0x00, 0x04, 0x02, 0x41, 0x10, 0x04, 0x52, 0x00, 0x40, 0x20, 0x84, 0x00, 0x43, 0x04, 0x00, 0x84,
+0x22, 0x00, 0x02, 0x00, 0x50, 0x04, 0x02, 0x01, 0x80, 0x01, 0x80, 0x40, 0x21, 0x12, 0x89, 0x20,
+0x88, 0x24, 0x81, 0x44, 0x12, 0x08, 0x85, 0x42, 0x2A, 0x10, 0x47, 0x30, 0x8A, 0x44, 0x11, 0x44,
+0x12, 0x49, 0x04, 0x01, 0x14, 0x80, 0x14, 0x42, 0x00, 0xA2, 0x00, 0x94, 0x42, 0x28, 0x12, 0x08,
+0x82, 0x49, 0x04, 0x02, 0x40, 0x12, 0x00, 0x88, 0x44, 0x00, 0xA0, 0x14, 0x42, 0x29, 0xA4, 0x12,
+0xA4,
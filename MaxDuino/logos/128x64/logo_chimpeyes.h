@@ -1,64 +1,46 @@
-0x00, 0x00, 0x40, 0x06, 0x00, 0x00, 0x23, 0x42, 0x0e, 0x85, 0x3c, 0x52, 0x45, 0x0b, 0x8f, 0x4f, 
-0xff, 0xfb, 0xf3, 0xf7, 0xd7, 0x3f, 0x2f, 0x26, 0x06, 0x27, 0xee, 0xfc, 0xe1, 0xf8, 0xf2, 0xfe, 
-0xfe, 0xfe, 0xfc, 0xfd, 0xf9, 0xf4, 0xf8, 0xfa, 0xf0, 0xf0, 0xf0, 0xd0, 0xc0, 0x80, 0x28, 0x38, 
-0xc0, 0xd7, 0xce, 0xb0, 0xa8, 0xb8, 0x70, 0xd0, 0xc0, 0xf8, 0xfc, 0xf4, 0xe8, 0xf8, 0xfc, 0xf8, 
-0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x3f, 0x7f, 0x3f, 0x1f, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 
-0xff, 0x7f, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xb3, 0xfd, 0xfc, 0xfa, 0x00, 0xe9, 0x6c, 0xaa, 0x4e, 
-0x7f, 0x7e, 0xff, 0xff, 0xef, 0xef, 0xff, 0xf7, 0xfe, 0x70, 0x9c, 0x94, 0xd2, 0xc6, 0xf6, 0x7a, 
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x11, 0x11, 0x02, 0x20, 0x20, 0x24, 0x62, 0x60, 0x08, 0x01, 
-0x03, 0x01, 0x0e, 0x02, 0x03, 0x01, 0x01, 0x02, 0xe4, 0xde, 0xff, 0xf7, 0xff, 0x7f, 0x7f, 0x3f, 
-0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x0f, 0x1e, 0x1f, 
-0x1f, 0x1f, 0x1f, 0x3f, 0x3e, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x7f, 0x7f, 
-0x7f, 0x5f, 0x7f, 0x1f, 0x1f, 0x1f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x07, 0x03, 0x03, 0x03, 
-0x01, 0x00, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0xc0, 0xd4, 0xf1, 0xf9, 0xfd, 0xcb, 0xe1, 0xfb, 0xf3, 0x3f, 0x75, 0x08, 0x00, 0x38, 0x41, 
-0x61, 0xef, 0xef, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xbf, 0x95, 0xdc, 0x2a, 0xa2, 0xd5, 0xf3, 0xf9, 
-0x10, 0x00, 0x00, 0x40, 0x08, 0x08, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x43, 0x07, 0x27, 0x61, 0x21, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xc0, 
-0xf0, 0xe8, 0xf0, 0xf8, 0x7a, 0xe8, 0xe4, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 
-0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x00, 0x20, 0x90, 0x80, 0xd0, 0xea, 0xf8, 0xfc, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x8f, 0xef, 0x63, 0x30, 0x03, 0x00, 0x01, 0x4c, 
-0x65, 0x1e, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfc, 0xfd, 0xee, 0x7f, 0xaf, 0x2f, 0x99, 0x7f, 
-0x00, 0x00, 0x0c, 0x00, 0x20, 0x00, 0x80, 0x80, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x1c, 0xfc, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xf8, 
-0xf8, 0xf0, 0xd0, 0xa0, 0x60, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x90, 0x80, 0x80, 0xc8, 
-0xc0, 0xc0, 0xe0, 0xe0, 0xf0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x11, 0x70, 0x47, 
-0x7f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 
-0xfe, 0xfe, 0xfc, 0xfe, 0xfe, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x67, 0xa7, 0xa7, 0x88, 0x7f, 0xcf, 0x67, 0x74, 0x00, 0x00, 0x00, 0x00, 
-0x20, 0x00, 0x01, 0x59, 0xde, 0xa7, 0xfd, 0x2f, 0x2f, 0xad, 0xcd, 0xe7, 0xf7, 0xfd, 0xfc, 0xff, 
-0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0xc1, 0x00, 0x00, 0x80, 0x00, 0x0c, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x01, 0x1f, 0x7f, 0xff, 0x7f, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xfc, 0xfd, 0xff, 0xff, 0xee, 0xff, 0xff, 
-0xbf, 0xff, 0x7f, 0xff, 0x56, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x20, 0x7d, 
-0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xdf, 0x66, 0x26, 0x18, 0x40, 0x64, 0x67, 0x77, 0x4f, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x40, 0x00, 0x14, 0x24, 0x60, 0x7e, 0x5d, 0xdb, 0xf3, 0xf7, 0xc5, 0xbf, 0xff, 0xff, 0xff, 
-0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 
-0x3f, 0x1f, 0x3f, 0x3f, 0x19, 0xb7, 0x1f, 0x67, 0xbf, 0x4f, 0xbd, 0x17, 0x7f, 0x4b, 0x13, 0x49, 
-0x0f, 0x01, 0x2c, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 
-0x7e, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0xff, 
-0x7f, 0xff, 0x5d, 0xc7, 0x0b, 0x19, 0x01, 0x03, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 
-0x00, 0x00, 0x00, 0x00, 0x82, 0x38, 0x69, 0xb1, 0xf9, 0xbb, 0x9f, 0xfd, 0xff, 0xdf, 0xdf, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x1a, 0xf8, 0xfa, 0xf0, 
-0xf0, 0xfd, 0xed, 0xa9, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xc1, 0x77, 0x1b, 
-0x2d, 0x68, 0xea, 0xa7, 0x78, 0x90, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x10, 0x08, 0x09, 0x09, 0x04, 0x06, 0x3f, 0x17, 0x55, 0x5f, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xa0, 0xd0, 0xf8, 0xfc, 0xf0, 0xe0, 0xe0, 0xc1, 0xc1, 0x81, 
-0x87, 0x07, 0x7f, 0xfd, 0x7e, 0xff, 0xff, 0xf8, 0xf8, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xbf, 0xdf, 0xfc, 0x2f, 0x0f, 0x1f, 0x01, 
-0x01, 0x01, 0x01, 0x0e, 0x00, 0x45, 0x48, 0x12, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x01, 0x20, 0x10, 0x03, 0x63, 0x59
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x80, 0x00, 0x1C, 0x40, 0x06, 0x00, 0x00, 0x23, 0x42, 0x0E, 0x85, 0x3C, 0x52, 0x45, 0x0B, 0x8F,
+0x4F, 0xFF, 0xFB, 0xF3, 0xF7, 0xD7, 0x3F, 0x2F, 0x26, 0x06, 0x27, 0xEE, 0xFC, 0xE1, 0xF8, 0xF2,
+0x81, 0xFE, 0x05, 0xFC, 0xFD, 0xF9, 0xF4, 0xF8, 0xFA, 0x81, 0xF0, 0x17, 0xD0, 0xC0, 0x80, 0x28,
+0x38, 0xC0, 0xD7, 0xCE, 0xB0, 0xA8, 0xB8, 0x70, 0xD0, 0xC0, 0xF8, 0xFC, 0xF4, 0xE8, 0xF8, 0xFC,
+0xF8, 0xFE, 0xFC, 0xFE, 0x82, 0xFF, 0x02, 0xFE, 0xFD, 0xFD, 0x88, 0xFF, 0x80, 0x7F, 0x02, 0x3F,
+0x7F, 0x3F, 0x81, 0x1F, 0x80, 0x3F, 0x80, 0x7F, 0x1F, 0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC,
+0xB3, 0xFD, 0xFC, 0xFA, 0x00, 0xE9, 0x6C, 0xAA, 0x4E, 0x7F, 0x7E, 0xFF, 0xFF, 0xEF, 0xEF, 0xFF,
+0xF7, 0xFE, 0x70, 0x9C, 0x94, 0xD2, 0xC6, 0xF6, 0x7A, 0x81, 0x00, 0x1C, 0x10, 0x00, 0x00, 0x11,
+0x11, 0x02, 0x20, 0x20, 0x24, 0x62, 0x60, 0x08, 0x01, 0x03, 0x01, 0x0E, 0x02, 0x03, 0x01, 0x01,
+0x02, 0xE4, 0xDE, 0xFF, 0xF7, 0xFF, 0x7F, 0x7F, 0x3F, 0x8B, 0x1F, 0x01, 0x0F, 0x1E, 0x82, 0x1F,
+0x01, 0x3F, 0x3E, 0x82, 0x7F, 0x83, 0x3F, 0x81, 0x7F, 0x01, 0x5F, 0x7F, 0x81, 0x1F, 0x83, 0x0F,
+0x80, 0x07, 0x81, 0x03, 0x03, 0x01, 0x00, 0x60, 0x10, 0x8A, 0x00, 0x14, 0x80, 0xC0, 0xD4, 0xF1,
+0xF9, 0xFD, 0xCB, 0xE1, 0xFB, 0xF3, 0x3F, 0x75, 0x08, 0x00, 0x38, 0x41, 0x61, 0xEF, 0xEF, 0xFF,
+0xFD, 0x81, 0xFF, 0x0F, 0xBF, 0x95, 0xDC, 0x2A, 0xA2, 0xD5, 0xF3, 0xF9, 0x10, 0x00, 0x00, 0x40,
+0x08, 0x08, 0x00, 0x30, 0x8D, 0x00, 0x05, 0x45, 0x43, 0x07, 0x27, 0x61, 0x21, 0x98, 0x00, 0x80,
+0x10, 0x83, 0x00, 0x0B, 0xA0, 0xC0, 0xF0, 0xE8, 0xF0, 0xF8, 0x7A, 0xE8, 0xE4, 0x00, 0x00, 0x80,
+0x82, 0x00, 0x85, 0x80, 0x08, 0x40, 0x00, 0x20, 0x90, 0x80, 0xD0, 0xEA, 0xF8, 0xFC, 0x87, 0xFF,
+0x0B, 0x7F, 0x8F, 0xEF, 0x63, 0x30, 0x03, 0x00, 0x01, 0x4C, 0x65, 0x1E, 0x7F, 0x81, 0xFF, 0x14,
+0xFC, 0xFD, 0xFC, 0xFD, 0xEE, 0x7F, 0xAF, 0x2F, 0x99, 0x7F, 0x00, 0x00, 0x0C, 0x00, 0x20, 0x00,
+0x80, 0x80, 0x00, 0x20, 0x20, 0x83, 0x00, 0x00, 0x80, 0x83, 0x00, 0x05, 0x3E, 0x1C, 0xFC, 0xFC,
+0xFE, 0xFF, 0x81, 0xFE, 0x80, 0xF8, 0x06, 0xF0, 0xD0, 0xA0, 0x60, 0xE0, 0xC0, 0xC0, 0x82, 0x80,
+0x09, 0x90, 0x80, 0x80, 0xC8, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0x50, 0x84, 0x00, 0x04, 0x60, 0x11,
+0x70, 0x47, 0x7F, 0x81, 0xFF, 0x00, 0xFE, 0x86, 0xFF, 0x83, 0xFE, 0x04, 0xFC, 0xFE, 0xFE, 0xFA,
+0xFD, 0x8B, 0xFF, 0x07, 0x67, 0xA7, 0xA7, 0x88, 0x7F, 0xCF, 0x67, 0x74, 0x82, 0x00, 0x12, 0x20,
+0x00, 0x01, 0x59, 0xDE, 0xA7, 0xFD, 0x2F, 0x2F, 0xAD, 0xCD, 0xE7, 0xF7, 0xFD, 0xFC, 0xFF, 0x00,
+0x00, 0x40, 0x81, 0x00, 0x06, 0x02, 0xC1, 0x00, 0x00, 0x80, 0x00, 0x0C, 0x89, 0x00, 0x06, 0x02,
+0x0B, 0x01, 0x1F, 0x7F, 0xFF, 0x7F, 0x84, 0xFF, 0x81, 0xFE, 0x0D, 0xFD, 0xFC, 0xFD, 0xFF, 0xFF,
+0xEE, 0xFF, 0xFF, 0xBF, 0xFF, 0x7F, 0xFF, 0x56, 0x0E, 0x83, 0x00, 0x05, 0x02, 0x03, 0x00, 0x20,
+0x7D, 0x5F, 0x9F, 0xFF, 0x09, 0xDF, 0x66, 0x26, 0x18, 0x40, 0x64, 0x67, 0x77, 0x4F, 0x03, 0x83,
+0x00, 0x0B, 0x40, 0x00, 0x14, 0x24, 0x60, 0x7E, 0x5D, 0xDB, 0xF3, 0xF7, 0xC5, 0xBF, 0x81, 0xFF,
+0x06, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0xC0, 0x85, 0x00, 0x00, 0x40, 0x8E, 0x00, 0x15, 0x26,
+0x3F, 0x1F, 0x3F, 0x3F, 0x19, 0xB7, 0x1F, 0x67, 0xBF, 0x4F, 0xBD, 0x17, 0x7F, 0x4B, 0x13, 0x49,
+0x0F, 0x01, 0x2C, 0x05, 0x06, 0x88, 0x00, 0x03, 0x3A, 0x7E, 0x7F, 0x7F, 0x98, 0xFF, 0x80, 0x7F,
+0x0B, 0xFF, 0x7F, 0xFF, 0x5D, 0xC7, 0x0B, 0x19, 0x01, 0x03, 0x00, 0x00, 0x80, 0x82, 0x00, 0x00,
+0x10, 0x82, 0x00, 0x0B, 0x82, 0x38, 0x69, 0xB1, 0xF9, 0xBB, 0x9F, 0xFD, 0xFF, 0xDF, 0xDF, 0xFF,
+0x92, 0x00, 0x00, 0x20, 0x8C, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x09, 0x6D,
+0x1A, 0xF8, 0xFA, 0xF0, 0xF0, 0xFD, 0xED, 0xA9, 0xF5, 0x82, 0xFF, 0x03, 0x7F, 0x3F, 0x3F, 0x7F,
+0x88, 0xFF, 0x00, 0xFE, 0x81, 0xFF, 0x0B, 0xFD, 0xFB, 0xC1, 0x77, 0x1B, 0x2D, 0x68, 0xEA, 0xA7,
+0x78, 0x90, 0xC4, 0x86, 0x00, 0x00, 0x20, 0x82, 0x00, 0x0B, 0x01, 0x10, 0x10, 0x08, 0x09, 0x09,
+0x04, 0x06, 0x3F, 0x17, 0x55, 0x5F, 0x86, 0x00, 0x00, 0x20, 0xAA, 0x00, 0x15, 0x80, 0xA0, 0xD0,
+0xF8, 0xFC, 0xF0, 0xE0, 0xE0, 0xC1, 0xC1, 0x81, 0x87, 0x07, 0x7F, 0xFD, 0x7E, 0xFF, 0xFF, 0xF8,
+0xF8, 0xFE, 0xFE, 0x8B, 0xFF, 0x06, 0xDF, 0xBF, 0xDF, 0xFC, 0x2F, 0x0F, 0x1F, 0x82, 0x01, 0x04,
+0x0E, 0x00, 0x45, 0x48, 0x12, 0x82, 0x00, 0x03, 0x10, 0x00, 0x00, 0x10, 0x81, 0x00, 0x0C, 0x01,
+0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x01, 0x20, 0x10, 0x03, 0x63, 0x59,
@@ -1,64 +1,33 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0x80, 0x80, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 
-0x00, 0x00, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xe0, 0xe0, 0xe0, 0xf0, 0xf0, 0xf0, 0xfc, 0xfe, 0xfe, 
-0xff, 0xff, 0xff, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xa0, 0xb0, 0xb0, 0xb8, 0xbf, 
-0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xff, 0xff, 0xf8, 0xf0, 0xf0, 0xf0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xf0, 0xf0, 0x78, 0x78, 0x78, 0x3c, 0x3c, 0x1e, 0x1e, 0x1e, 0x0f, 0x0f, 0x07, 
-0x07, 0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 
-0x7f, 0x7f, 0x7f, 0x4f, 0x0f, 0x0f, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x01, 0x00, 0x01, 
-0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xe0, 0x00, 0x00, 0xe0, 0xf4, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 
-0xf6, 0xf6, 0xf6, 0x76, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xe8, 0xe8, 0xec, 0xec, 0xec, 0xec, 0xec, 0xed, 
-0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xef, 0xef, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xcf, 0x0f, 0x83, 0x0f, 0x4f, 0xef, 0xff, 0xff, 0xee, 0x4e, 0x0e, 0x86, 0x0e, 0xce, 0xfc, 
-0xfc, 0xfc, 0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xfb, 0xfb, 0xfb, 0xfb, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 
-0xf3, 0x03, 0x83, 0xc0, 0xc0, 0x83, 0x33, 0xf3, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 
-0x0f, 0x0f, 0x9f, 0xff, 0xff, 0x9f, 0x0f, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 
-0x0f, 0x9f, 0xff, 0xff, 0x9f, 0x0f, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0x1f, 0x0f, 0x0f, 0x0f, 
-0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0x77, 0x77, 0x77, 0x77, 0x77, 0xf7, 0xf7, 0xf7, 
-0x77, 0x77, 0x77, 0x77, 0xf7, 0xf7, 0xf7, 0x77, 0x77, 0x77, 0x77, 0xf7, 0xf7, 0xf7, 0x77, 0x77, 
-0x77, 0x77, 0xf7, 0xf7, 0xf7, 0x77, 0x77, 0x77, 0x77, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0x07, 
-0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x0f, 0x0f, 0x0f, 0x1e, 
-0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1e, 
-0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x0e, 0x0f, 
-0x0f, 0x0f, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0f, 0x19, 0x30, 0x20, 0x20, 0x20, 0x30, 0x38, 0x3f, 0x30, 
-0x20, 0x20, 0x20, 0x30, 0x38, 0x3f, 0x30, 0x20, 0x20, 0x20, 0x20, 0x30, 0x3f, 0x30, 0x20, 0x20, 
-0x20, 0x20, 0x30, 0x3f, 0x30, 0x20, 0x20, 0x20, 0x20, 0x30, 0x3f, 0x1f, 0x0f, 0x07, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 
-0xf0, 0xf0, 0xf0, 0x20, 0x10, 0xf0, 0xf0, 0xf0, 0xe0, 0x20, 0x10, 0xf0, 0xf0, 0xf0, 0xe0, 0x00, 
-0x00, 0x20, 0xa0, 0x90, 0x90, 0x90, 0xf0, 0xf0, 0xf0, 0xe0, 0x00, 0x10, 0x30, 0xf0, 0xf0, 0xf0, 
-0xe0, 0xc0, 0x80, 0x40, 0x10, 0x00, 0x00, 0xe0, 0xe0, 0xf0, 0xf0, 0x10, 0x30, 0xfc, 0xfc, 0xfc, 
-0xfc, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xf6, 
-0xf6, 0xf6, 0xf6, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x20, 0x10, 0xf0, 0xf0, 0xf0, 0xe0, 0x00, 
-0x00, 0xc0, 0xe0, 0x70, 0x30, 0x30, 0x30, 0x30, 0x70, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 
-0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 
-0x06, 0x0f, 0x1f, 0x1f, 0x10, 0x10, 0x1f, 0x1f, 0x1f, 0x1f, 0x10, 0x10, 0x08, 0x04, 0x03, 0x07, 
-0x0f, 0x1f, 0x1f, 0x1e, 0x18, 0x10, 0x01, 0x0f, 0x0f, 0x1f, 0x1f, 0x10, 0x18, 0x1f, 0x1f, 0x1f, 
-0x1f, 0x00, 0x00, 0x0f, 0x1f, 0x1f, 0x1f, 0x10, 0x10, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 
-0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 
-0x00, 0x07, 0x0f, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x0c, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xED, 0x00, 0x81, 0x80, 0x01, 0xC0, 0x80, 0x9B, 0x00, 0x80, 0x80, 0x89, 0xC0, 0x00, 0x80, 0x81,
+0x00, 0x81, 0x80, 0x80, 0xC0, 0x81, 0xE0, 0x81, 0xF0, 0x02, 0xFC, 0xFE, 0xFE, 0x81, 0xFF, 0x01,
+0xFE, 0x70, 0x93, 0x00, 0x04, 0x80, 0xA0, 0xB0, 0xB0, 0xB8, 0x88, 0xBF, 0x80, 0xFF, 0x00, 0xF8,
+0x81, 0xF0, 0x82, 0xE0, 0x80, 0xF0, 0x81, 0x78, 0x80, 0x3C, 0x81, 0x1E, 0x80, 0x0F, 0x81, 0x07,
+0x80, 0x03, 0x9A, 0x00, 0x00, 0x7E, 0x90, 0x7F, 0x02, 0x4F, 0x0F, 0x0F, 0x81, 0x07, 0x80, 0x03,
+0x81, 0x01, 0x00, 0x00, 0x81, 0x01, 0x8F, 0x00, 0x07, 0x80, 0xC0, 0xE0, 0xE0, 0x00, 0x00, 0xE0,
+0xF4, 0x86, 0xF6, 0x00, 0x76, 0x83, 0xF6, 0x87, 0xFF, 0x02, 0xFC, 0xF0, 0xC0, 0x9F, 0x00, 0x03,
+0x80, 0xE0, 0xE8, 0xE8, 0x83, 0xEC, 0x86, 0xED, 0x83, 0xEF, 0x83, 0xFF, 0x0D, 0xCF, 0x0F, 0x83,
+0x0F, 0x4F, 0xEF, 0xFF, 0xFF, 0xEE, 0x4E, 0x0E, 0x86, 0x0E, 0xCE, 0x81, 0xFC, 0x80, 0xF8, 0x80,
+0xF0, 0x01, 0xE0, 0x80, 0x89, 0x00, 0x82, 0xFB, 0x01, 0xF8, 0xFC, 0x84, 0xFF, 0x09, 0xFB, 0xF3,
+0x03, 0x83, 0xC0, 0xC0, 0x83, 0x33, 0xF3, 0xFB, 0x8B, 0xFF, 0x02, 0xFC, 0xF8, 0xE0, 0x83, 0xC0,
+0x80, 0x80, 0x94, 0x00, 0x01, 0x0F, 0x7F, 0x84, 0xFF, 0x82, 0x0F, 0x03, 0x9F, 0xFF, 0xFF, 0x9F,
+0x82, 0x0F, 0x81, 0xFF, 0x82, 0x0F, 0x03, 0x9F, 0xFF, 0xFF, 0x9F, 0x82, 0x0F, 0x81, 0xFF, 0x00,
+0x1F, 0x81, 0x0F, 0x00, 0x1F, 0x83, 0xFF, 0x01, 0x7F, 0x1F, 0x89, 0x00, 0x83, 0xF7, 0x83, 0x77,
+0x81, 0xF7, 0x82, 0x77, 0x81, 0xF7, 0x82, 0x77, 0x81, 0xF7, 0x82, 0x77, 0x81, 0xF7, 0x82, 0x77,
+0x84, 0xF7, 0x01, 0x07, 0x06, 0x95, 0x00, 0x03, 0x01, 0x03, 0x07, 0x07, 0x81, 0x0F, 0x80, 0x1E,
+0x84, 0x1F, 0x80, 0x1E, 0x83, 0x1F, 0x80, 0x1E, 0x84, 0x1F, 0x80, 0x1E, 0x83, 0x1F, 0x01, 0x1E,
+0x0E, 0x81, 0x0F, 0x03, 0x07, 0x03, 0x03, 0x01, 0x8C, 0x00, 0x04, 0x03, 0x07, 0x0F, 0x19, 0x30,
+0x81, 0x20, 0x03, 0x30, 0x38, 0x3F, 0x30, 0x81, 0x20, 0x03, 0x30, 0x38, 0x3F, 0x30, 0x82, 0x20,
+0x02, 0x30, 0x3F, 0x30, 0x82, 0x20, 0x02, 0x30, 0x3F, 0x30, 0x82, 0x20, 0x05, 0x30, 0x3F, 0x1F,
+0x0F, 0x07, 0x01, 0x9E, 0x00, 0x82, 0xF0, 0x01, 0x20, 0x10, 0x81, 0xF0, 0x02, 0xE0, 0x20, 0x10,
+0x81, 0xF0, 0x04, 0xE0, 0x00, 0x00, 0x20, 0xA0, 0x81, 0x90, 0x81, 0xF0, 0x03, 0xE0, 0x00, 0x10,
+0x30, 0x81, 0xF0, 0x0C, 0xE0, 0xC0, 0x80, 0x40, 0x10, 0x00, 0x00, 0xE0, 0xE0, 0xF0, 0xF0, 0x10,
+0x30, 0x82, 0xFC, 0x80, 0x00, 0x82, 0xF0, 0x80, 0x00, 0x82, 0xF0, 0x80, 0x00, 0x82, 0xF6, 0x80,
+0x00, 0x82, 0xF0, 0x01, 0x20, 0x10, 0x81, 0xF0, 0x05, 0xE0, 0x00, 0x00, 0xC0, 0xE0, 0x70, 0x82,
+0x30, 0x02, 0x70, 0xE0, 0xC0, 0xA2, 0x00, 0x82, 0x1F, 0x80, 0x00, 0x82, 0x1F, 0x80, 0x00, 0x82,
+0x1F, 0x06, 0x00, 0x06, 0x0F, 0x1F, 0x1F, 0x10, 0x10, 0x82, 0x1F, 0x80, 0x10, 0x10, 0x08, 0x04,
+0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x1E, 0x18, 0x10, 0x01, 0x0F, 0x0F, 0x1F, 0x1F, 0x10, 0x18, 0x82,
+0x1F, 0x80, 0x00, 0x00, 0x0F, 0x81, 0x1F, 0x80, 0x10, 0x82, 0x1F, 0x80, 0x00, 0x82, 0x1F, 0x80,
+0x00, 0x82, 0x1F, 0x80, 0x00, 0x82, 0x1F, 0x80, 0x00, 0x02, 0x07, 0x0F, 0x1C, 0x82, 0x18, 0x02,
+0x0C, 0x07, 0x03, 0x93, 0x00,
@@ -1,64 +1,30 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x18, 0x1c, 0x18, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0xf8, 0xf8, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 
-0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 
-0x7c, 0x7c, 0x7c, 0x7c, 0x3c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xc0, 0xc0, 0xe0, 0xe0, 0xc0, 0xc1, 0xc7, 0xdf, 0xdf, 0xdf, 0xdf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 
-0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xce, 0xcc, 0xc8, 0xcc, 0xce, 0xcf, 0xcf, 0x9f, 0x9f, 0x9f, 0x3e, 
-0x3e, 0x7e, 0xfc, 0xf8, 0xf8, 0xf0, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xf8, 0xfe, 0xff, 
-0x7f, 0x1f, 0x87, 0xc3, 0xf1, 0x38, 0x9c, 0xce, 0xe6, 0xf7, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 
-0x33, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x3c, 0x7c, 0x7c, 0x7c, 
-0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0xfc, 0xfc, 0xf9, 0xf1, 0xe3, 
-0x06, 0x1c, 0xf8, 0x01, 0x07, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf8, 0xfe, 0xff, 0xff, 0x3f, 0x0f, 0xc7, 0xf1, 
-0x38, 0x1e, 0xc7, 0xf1, 0xf8, 0xfe, 0xff, 0xff, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x1f, 0x07, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xff, 0xff, 0xff, 0x1f, 0x87, 0xe1, 
-0x70, 0x1e, 0x0f, 0xc0, 0xf0, 0xff, 0xff, 0xff, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xfe, 0xff, 0x7f, 0x1f, 0x8f, 0xe3, 0x78, 0x1e, 0x87, 0xe3, 0xf8, 
-0xfc, 0xff, 0xff, 0x3f, 0x0f, 0x83, 0x78, 0xf0, 0xc0, 0xc0, 0x60, 0xf0, 0xf8, 0x80, 0x00, 0xc0, 
-0xa0, 0xf8, 0xe0, 0xc0, 0x00, 0x08, 0x98, 0x78, 0xf0, 0xe0, 0x90, 0x08, 0x00, 0xf8, 0xf8, 0xf8, 
-0x08, 0xf0, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0x00, 0xf8, 
-0x70, 0xf0, 0xe0, 0xf8, 0x00, 0x00, 0xf0, 0xf8, 0xf8, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff, 
-0x80, 0x0c, 0x3f, 0x7f, 0xff, 0xff, 0xfb, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 
-0xf8, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xf9, 0xf8, 0xf9, 0xf9, 0xf8, 0xf8, 0xf8, 0xfb, 0xfb, 0xfb, 
-0xfb, 0xf9, 0xf8, 0xf8, 0xf8, 0xf9, 0xf8, 0xf8, 0xf9, 0xf8, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 
-0xf8, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf8, 0xf0, 0xf8, 0xf9, 0xf1, 0xf9, 0xf0, 0xf9, 0xf1, 0xf9, 
-0xf1, 0xf0, 0xf0, 0xf0, 0xf0, 0xe1, 0xc1, 0xc1, 0x80, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0f, 0x3f, 0x7f, 0xff, 0xfe, 0xfc, 0xf8, 
-0xf1, 0xf3, 0xe6, 0xe6, 0xec, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 
-0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 
-0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 
-0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 
-0xc9, 0x99, 0x19, 0x33, 0x63, 0xc7, 0x0f, 0x1f, 0x7f, 0xff, 0xfe, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
-0x03, 0x03, 0x03, 0x07, 0xc7, 0xe7, 0xe7, 0xe7, 0xe7, 0x67, 0x07, 0x87, 0xc7, 0x67, 0x07, 0x87, 
-0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0x27, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
-0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
-0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xc7, 0xff, 0xff, 
-0xff, 0xff, 0x7f, 0x1e, 0x80, 0xe1, 0x7f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x08, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x00, 0x08, 0x0e, 0x03, 0x00, 0x0c, 0x0e, 0x0f, 
-0x0f, 0x0f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 
-0x07, 0x01, 0x08, 0x0e, 0x07, 0x01, 0x00, 0x0c, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x92, 0x00, 0x06, 0x20, 0x30, 0x18, 0x1C, 0x18, 0x30, 0x20, 0xA3, 0x00, 0x07, 0x80, 0xC0, 0xE0,
+0xF0, 0xF0, 0xF8, 0xF8, 0x78, 0x9A, 0x7C, 0x01, 0x3C, 0x0C, 0x98, 0x00, 0x80, 0xC0, 0x80, 0xE0,
+0x02, 0xC0, 0xC1, 0xC7, 0x82, 0xDF, 0x88, 0xCF, 0x06, 0xCE, 0xCC, 0xC8, 0xCC, 0xCE, 0xCF, 0xCF,
+0x81, 0x9F, 0x80, 0x3E, 0x06, 0x7E, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x91, 0x00, 0x0E, 0xC0,
+0xF0, 0xF8, 0xFE, 0xFF, 0x7F, 0x1F, 0x87, 0xC3, 0xF1, 0x38, 0x9C, 0xCE, 0xE6, 0xF7, 0x94, 0xF3,
+0x02, 0x33, 0x03, 0x03, 0x9E, 0x00, 0x81, 0x01, 0x83, 0x00, 0x01, 0x0C, 0x3C, 0x8C, 0x7C, 0x80,
+0xFC, 0x07, 0xF9, 0xF1, 0xE3, 0x06, 0x1C, 0xF8, 0x01, 0x07, 0x82, 0xFF, 0x00, 0xF8, 0x8A, 0x00,
+0x11, 0x80, 0xE0, 0xF8, 0xFE, 0xFF, 0xFF, 0x3F, 0x0F, 0xC7, 0xF1, 0x38, 0x1E, 0xC7, 0xF1, 0xF8,
+0xFE, 0xFF, 0xFF, 0x91, 0x7F, 0x03, 0x3F, 0x1F, 0x07, 0x01, 0xB6, 0x00, 0x02, 0xC0, 0xF0, 0xFC,
+0x81, 0xFF, 0x07, 0x1F, 0x87, 0xE1, 0x70, 0x1E, 0x0F, 0xC0, 0xF0, 0x81, 0xFF, 0x01, 0x1F, 0x03,
+0x86, 0x00, 0x2A, 0xC0, 0xF0, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0x8F, 0xE3, 0x78, 0x1E, 0x87, 0xE3,
+0xF8, 0xFC, 0xFF, 0xFF, 0x3F, 0x0F, 0x83, 0x78, 0xF0, 0xC0, 0xC0, 0x60, 0xF0, 0xF8, 0x80, 0x00,
+0xC0, 0xA0, 0xF8, 0xE0, 0xC0, 0x00, 0x08, 0x98, 0x78, 0xF0, 0xE0, 0x90, 0x08, 0x00, 0x81, 0xF8,
+0x03, 0x08, 0xF0, 0x00, 0x00, 0x81, 0xF8, 0x03, 0x00, 0xF8, 0x00, 0x00, 0x81, 0xF8, 0x0C, 0x00,
+0xF8, 0x70, 0xF0, 0xE0, 0xF8, 0x00, 0x00, 0xF0, 0xF8, 0xF8, 0x08, 0xF0, 0x99, 0x00, 0x00, 0x04,
+0x83, 0xFF, 0x0A, 0x80, 0x00, 0x3F, 0xFF, 0x80, 0x0C, 0x3F, 0x7F, 0xFF, 0xFF, 0xFB, 0x88, 0xF8,
+0x83, 0xFB, 0x03, 0xF9, 0xF8, 0xF9, 0xF9, 0x81, 0xF8, 0x82, 0xFB, 0x00, 0xF9, 0x81, 0xF8, 0x05,
+0xF9, 0xF8, 0xF8, 0xF9, 0xF8, 0xF8, 0x82, 0xF9, 0x81, 0xF8, 0x82, 0xF9, 0x0A, 0xF8, 0xF0, 0xF8,
+0xF9, 0xF1, 0xF9, 0xF0, 0xF9, 0xF1, 0xF9, 0xF1, 0x82, 0xF0, 0x05, 0xE1, 0xC1, 0xC1, 0x80, 0x00,
+0x00, 0x81, 0x01, 0x01, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x01, 0x9B, 0x00,
+0x0D, 0x01, 0x07, 0x0F, 0x3F, 0x7F, 0xFF, 0xFE, 0xFC, 0xF8, 0xF1, 0xF3, 0xE6, 0xE6, 0xEC, 0xB9,
+0xCC, 0x0D, 0xC9, 0x99, 0x19, 0x33, 0x63, 0xC7, 0x0F, 0x1F, 0x7F, 0xFF, 0xFE, 0xFC, 0xF0, 0xC0,
+0xAE, 0x00, 0x80, 0x01, 0x81, 0x03, 0x01, 0x07, 0xC7, 0x82, 0xE7, 0x06, 0x67, 0x07, 0x87, 0xC7,
+0x67, 0x07, 0x87, 0x83, 0xE7, 0x00, 0x27, 0xA5, 0x07, 0x00, 0xC7, 0x82, 0xFF, 0x06, 0x7F, 0x1E,
+0x80, 0xE1, 0x7F, 0x00, 0x00, 0x83, 0xFF, 0xB1, 0x00, 0x01, 0x08, 0x0E, 0x82, 0x0F, 0x07, 0x03,
+0x00, 0x08, 0x0E, 0x03, 0x00, 0x0C, 0x0E, 0x81, 0x0F, 0x01, 0x07, 0x01, 0xA5, 0x00, 0x00, 0x0C,
+0x82, 0x0F, 0x07, 0x07, 0x01, 0x08, 0x0E, 0x07, 0x01, 0x00, 0x0C, 0x82, 0x0F, 0x00, 0x03, 0x91,
+0x00,
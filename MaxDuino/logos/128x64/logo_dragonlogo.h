@@ -1,103 +1,34 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0,
-  0xE0, 0xC0, 0xC0, 0xC8, 0x84, 0x86, 0x8C, 0xC8, 0xD0, 0xC0,
-  0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0,
-  0xF8, 0xFC, 0x3C, 0xBE, 0xDE, 0x5E, 0x4E, 0x4E, 0x6E, 0x6E,
-  0x6E, 0x2E, 0x2E, 0x6F, 0x2E, 0x2E, 0x2F, 0x2E, 0x2E, 0x6E,
-  0x2E, 0x2E, 0x6F, 0x2E, 0x6F, 0x2E, 0x6E, 0x2E, 0x0E, 0x0E,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C, 0x0E, 0x1C, 0x0C, 0x0C,
-  0x0D, 0x0D, 0x0D, 0x6D, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED,
-  0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xCB,
-  0x1B, 0x77, 0xE7, 0x9F, 0x3F, 0xFE, 0xFC, 0xF8, 0xE0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0xC0, 0xF0, 0xF8, 0xFE, 0x7F, 0x3F, 0xCF, 0x63, 0x39, 0x8C,
-  0xE7, 0xF9, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x7F, 0x1F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-  0x01, 0xC1, 0xF1, 0xFD, 0xFF, 0x7F, 0x1F, 0xCF, 0x63, 0x38,
-  0x8F, 0xE3, 0xF8, 0xFF, 0xFF, 0x3F, 0x0F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0xC0, 0xF0, 0xFC, 0xFE, 0x7F, 0x3F, 0xCF,
-  0x73, 0x39, 0xCE, 0xE7, 0xF9, 0xFC, 0xFF, 0x3F, 0x1F, 0x07,
-  0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0xFF, 0xFF, 0xFF, 0xF0, 0xC7, 0x9F, 0x30, 0x66, 0xCF, 0x9F,
-  0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-  0x9E, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-  0x9F, 0x9F, 0x9F, 0x9F, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-  0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-  0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-  0x9C, 0xBC, 0xBC, 0x3C, 0x78, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1E, 0x1E, 0x1E, 0xBE, 0xBE,
-  0xBE, 0xBE, 0xBE, 0x3E, 0x3E, 0xBE, 0xBE, 0x3E, 0xBE, 0xBE,
-  0xBE, 0xBE, 0xBE, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-  0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-  0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-  0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0xFE, 0xFE, 0xFC, 0xFD,
-  0xF9, 0x03, 0x8E, 0xF8, 0x01, 0x8F, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1C, 0x1E, 0x1F, 0x1F, 0x0F, 0x03,
-  0x19, 0x0E, 0x07, 0x19, 0x1C, 0x1F, 0x1F, 0x1F, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x18, 0x1E, 0x1F, 0x1F, 0x0F, 0x07, 0x01, 0x1C, 0x07,
-  0x03, 0x18, 0x1E, 0x1F, 0x1F, 0x0F, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E,
-  0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0x00, 0x00, 0xFE, 0xFE, 0xFE,
-  0xFE, 0x9E, 0x8E, 0x8E, 0x8E, 0x9E, 0xFE, 0xFE, 0xFC, 0x7C,
-  0x30, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0xFE, 0xFE, 0x7E,
-  0xFE, 0xFE, 0xFC, 0xF0, 0x80, 0x00, 0x00, 0xE0, 0xF8, 0xFC,
-  0xFC, 0xFE, 0x3E, 0x0E, 0x0F, 0x0E, 0x0E, 0x9E, 0xBE, 0xBC,
-  0xB8, 0xB0, 0x00, 0x00, 0xF0, 0xF8, 0xFC, 0xFC, 0x3E, 0x1E,
-  0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0xFE, 0xFC, 0xF8, 0xF0, 0x00,
-  0x00, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xF8, 0xF0, 0xC0, 0x80,
-  0x7C, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x30,
-  0x3C, 0x3C, 0x3E, 0x1E, 0xCE, 0xCE, 0xDE, 0xFE, 0xFE, 0xFC,
-  0x78, 0x00, 0x70, 0x7C, 0x7C, 0x7E, 0x1E, 0x0E, 0x8E, 0xDE,
-  0xFE, 0xFE, 0xFC, 0xF8, 0x30, 0x00, 0x00, 0x00, 0x3F, 0x7F,
-  0x7F, 0x7F, 0x7F, 0x78, 0x78, 0x78, 0x78, 0x78, 0x3E, 0x3F,
-  0x3F, 0x1F, 0x0F, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x3B,
-  0x03, 0x03, 0x03, 0x1F, 0x7F, 0x7F, 0x7F, 0x7E, 0x00, 0x00,
-  0x70, 0x7C, 0x7F, 0x7F, 0x3F, 0x1F, 0x1F, 0x1C, 0x1E, 0x1F,
-  0x3F, 0x7F, 0x7F, 0x7E, 0x78, 0x07, 0x1F, 0x3F, 0x3F, 0x7F,
-  0x7C, 0x78, 0x70, 0x70, 0x73, 0x3B, 0x3F, 0x3F, 0x7F, 0x7F,
-  0x28, 0x00, 0x07, 0x1F, 0x1F, 0x3F, 0x7C, 0x78, 0x70, 0x70,
-  0x70, 0x78, 0x38, 0x3F, 0x3F, 0x1F, 0x0F, 0x00, 0x00, 0x3F,
-  0x3F, 0x3F, 0x3F, 0x3E, 0x00, 0x03, 0x07, 0x1F, 0x3F, 0x3F,
-  0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x3E, 0x3E,
-  0x7E, 0x78, 0x79, 0x79, 0x7B, 0x3F, 0x3F, 0x3F, 0x1F, 0x06,
-  0x78, 0x7C, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7B, 0x7B, 0x79,
-  0x79, 0x78, 0x30, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x92, 0x00, 0x01, 0x40, 0xC0, 0x85, 0xE0, 0x09, 0xC0, 0xE0, 0xC0, 0xC0, 0xC8, 0x84, 0x86, 0x8C,
+0xC8, 0xD0, 0x83, 0xC0, 0x80, 0x80, 0x92, 0x00, 0x0B, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x3C,
+0xBE, 0xDE, 0x5E, 0x4E, 0x4E, 0x81, 0x6E, 0x80, 0x2E, 0x11, 0x6F, 0x2E, 0x2E, 0x2F, 0x2E, 0x2E,
+0x6E, 0x2E, 0x2E, 0x6F, 0x2E, 0x6F, 0x2E, 0x6E, 0x2E, 0x0E, 0x0E, 0x03, 0xA8, 0x00, 0x81, 0x0C,
+0x03, 0x0E, 0x1C, 0x0C, 0x0C, 0x81, 0x0D, 0x00, 0x6D, 0x8D, 0xED, 0x09, 0xCB, 0x1B, 0x77, 0xE7,
+0x9F, 0x3F, 0xFE, 0xFC, 0xF8, 0xE0, 0x88, 0x00, 0x0E, 0x80, 0xC0, 0xF0, 0xF8, 0xFE, 0x7F, 0x3F,
+0xCF, 0x63, 0x39, 0x8C, 0xE7, 0xF9, 0xFC, 0xFE, 0x8E, 0xFF, 0x03, 0x7F, 0x1F, 0x0F, 0x03, 0xB9,
+0x00, 0x86, 0x01, 0x0F, 0xC1, 0xF1, 0xFD, 0xFF, 0x7F, 0x1F, 0xCF, 0x63, 0x38, 0x8F, 0xE3, 0xF8,
+0xFF, 0xFF, 0x3F, 0x0F, 0x83, 0x00, 0x13, 0x80, 0xC0, 0xF0, 0xFC, 0xFE, 0x7F, 0x3F, 0xCF, 0x73,
+0x39, 0xCE, 0xE7, 0xF9, 0xFC, 0xFF, 0x3F, 0x1F, 0x07, 0x03, 0x01, 0xD5, 0x00, 0x00, 0x3F, 0x81,
+0xFF, 0x05, 0xF0, 0xC7, 0x9F, 0x30, 0x66, 0xCF, 0x81, 0x9F, 0x87, 0x9E, 0x81, 0x9F, 0x84, 0x9E,
+0x82, 0x9F, 0x98, 0x9E, 0x09, 0x9C, 0xBC, 0xBC, 0x3C, 0x78, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0xB9,
+0x00, 0x05, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x81, 0x1E, 0x83, 0xBE, 0x80, 0x3E, 0x80, 0xBE,
+0x00, 0x3E, 0x83, 0xBE, 0x9F, 0x3E, 0x80, 0xFE, 0x07, 0xFC, 0xFD, 0xF9, 0x03, 0x8E, 0xF8, 0x01,
+0x8F, 0x81, 0xFF, 0x00, 0xFC, 0xBE, 0x00, 0x0A, 0x1C, 0x1E, 0x1F, 0x1F, 0x0F, 0x03, 0x19, 0x0E,
+0x07, 0x19, 0x1C, 0x81, 0x1F, 0x01, 0x07, 0x01, 0x9D, 0x00, 0x0F, 0x18, 0x1E, 0x1F, 0x1F, 0x0F,
+0x07, 0x01, 0x1C, 0x07, 0x03, 0x18, 0x1E, 0x1F, 0x1F, 0x0F, 0x07, 0x95, 0x00, 0x00, 0xFC, 0x82,
+0xFE, 0x82, 0x0E, 0x07, 0x1E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0x00, 0x00, 0x82, 0xFE, 0x00, 0x9E,
+0x81, 0x8E, 0x05, 0x9E, 0xFE, 0xFE, 0xFC, 0x7C, 0x30, 0x81, 0x00, 0x23, 0x80, 0xE0, 0xF8, 0xFE,
+0xFE, 0x7E, 0xFE, 0xFE, 0xFC, 0xF0, 0x80, 0x00, 0x00, 0xE0, 0xF8, 0xFC, 0xFC, 0xFE, 0x3E, 0x0E,
+0x0F, 0x0E, 0x0E, 0x9E, 0xBE, 0xBC, 0xB8, 0xB0, 0x00, 0x00, 0xF0, 0xF8, 0xFC, 0xFC, 0x3E, 0x1E,
+0x82, 0x0E, 0x07, 0x1E, 0xFE, 0xFC, 0xF8, 0xF0, 0x00, 0x00, 0xFC, 0x82, 0xFE, 0x04, 0xF8, 0xF0,
+0xC0, 0x80, 0x7C, 0x82, 0xFE, 0x82, 0x00, 0x19, 0x30, 0x3C, 0x3C, 0x3E, 0x1E, 0xCE, 0xCE, 0xDE,
+0xFE, 0xFE, 0xFC, 0x78, 0x00, 0x70, 0x7C, 0x7C, 0x7E, 0x1E, 0x0E, 0x8E, 0xDE, 0xFE, 0xFE, 0xFC,
+0xF8, 0x30, 0x81, 0x00, 0x00, 0x3F, 0x82, 0x7F, 0x83, 0x78, 0x06, 0x3E, 0x3F, 0x3F, 0x1F, 0x0F,
+0x00, 0x00, 0x82, 0x7F, 0x00, 0x3B, 0x81, 0x03, 0x00, 0x1F, 0x81, 0x7F, 0x28, 0x7E, 0x00, 0x00,
+0x70, 0x7C, 0x7F, 0x7F, 0x3F, 0x1F, 0x1F, 0x1C, 0x1E, 0x1F, 0x3F, 0x7F, 0x7F, 0x7E, 0x78, 0x07,
+0x1F, 0x3F, 0x3F, 0x7F, 0x7C, 0x78, 0x70, 0x70, 0x73, 0x3B, 0x3F, 0x3F, 0x7F, 0x7F, 0x28, 0x00,
+0x07, 0x1F, 0x1F, 0x3F, 0x7C, 0x78, 0x81, 0x70, 0x07, 0x78, 0x38, 0x3F, 0x3F, 0x1F, 0x0F, 0x00,
+0x00, 0x82, 0x3F, 0x04, 0x3E, 0x00, 0x03, 0x07, 0x1F, 0x83, 0x3F, 0x82, 0x00, 0x07, 0x0E, 0x3E,
+0x3E, 0x7E, 0x78, 0x79, 0x79, 0x7B, 0x81, 0x3F, 0x05, 0x1F, 0x06, 0x78, 0x7C, 0x7E, 0x7E, 0x81,
+0x7F, 0x80, 0x7B, 0x80, 0x79, 0x02, 0x78, 0x30, 0x00,
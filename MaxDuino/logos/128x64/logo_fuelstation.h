@@ -1,64 +1,27 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x1c, 0x7c, 0xf8, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x1a, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x38, 0x9c, 0xd4, 
-0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x87, 0x9f, 0x3e, 0xf8, 0x60, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x02, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x07, 0x37, 0x63, 0x7f, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 
-0x0f, 0x1f, 0x3f, 0x3f, 0x7e, 0xfc, 0xf8, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x40, 0xe0, 0xf0, 0xf0, 0xf7, 0xf7, 0xf7, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf8, 0x78, 
-0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7c, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 
-0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 
-0x3c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0xf8, 0xfc, 0x7c, 0x7e, 0x3f, 0x1f, 0x1f, 0x0f, 0x07, 0x06, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x0f, 0x1f, 0x1f, 0x07, 0x02, 
-0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x70, 0x30, 0x38, 0x38, 0x38, 
-0x38, 0x38, 0x3c, 0x1c, 0x1c, 0x1e, 0x1e, 0x1f, 0x1f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x07, 
-0x07, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0f, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x1f, 
-0x0f, 0x0f, 0x07, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 
-0xef, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xe0, 0xe0, 0xe0, 0xf0, 0xf0, 0xf8, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x07, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc7, 0xc7, 0xc7, 0xc7, 0x07, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 
-0x75, 0x71, 0x71, 0x71, 0x71, 0x71, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3f, 0xff, 0xe3, 0x98, 0x7c, 0xfc, 0xfe, 
-0xfe, 0xfe, 0xff, 0xff, 0x3f, 0x3f, 0x3f, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00, 0xfe, 0x02, 0x02, 0x02, 0x02, 
-0x02, 0x02, 0x86, 0xfe, 0x00, 0x00, 0x0c, 0xf8, 0xf0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0f, 0x3f, 0xbe, 0x99, 
-0xe7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x87, 0x07, 0x03, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x04, 0x04, 0x04, 0xfc, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xe0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfe, 0x7f, 0x7f, 0x3f, 
-0x1f, 0x0f, 0x17, 0x3b, 0x3b, 0x3d, 0x3d, 0x39, 0x33, 0x27, 0x07, 0x0f, 0x1f, 0xbf, 0xff, 0xfe, 
-0xfe, 0xfc, 0xf8, 0x70, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 
-0x3f, 0x3f, 0x3f, 0x3f, 0x20, 0x00, 0x00, 0x1f, 0x30, 0x20, 0x1f, 0x1c, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xA2, 0x00, 0x04, 0x1C, 0x7C, 0xF8, 0xE0, 0x80, 0x92, 0x00, 0x80, 0xFF, 0x00, 0x1A, 0x8A, 0x00,
+0x03, 0x20, 0x38, 0x9C, 0xD4, 0x85, 0xFE, 0x80, 0xFC, 0x02, 0xF8, 0xE0, 0x80, 0xB1, 0x00, 0x02,
+0x80, 0xC0, 0x80, 0x92, 0x00, 0x05, 0x81, 0x87, 0x9F, 0x3E, 0xF8, 0x60, 0x8F, 0x00, 0x80, 0x07,
+0x00, 0x02, 0x84, 0x00, 0x83, 0x80, 0x04, 0x00, 0x07, 0x37, 0x63, 0x7F, 0x86, 0xFF, 0x03, 0x7F,
+0x3F, 0x1F, 0x03, 0x8C, 0x00, 0x80, 0x80, 0x00, 0xC0, 0x9F, 0x00, 0x80, 0x07, 0x0C, 0x0F, 0x1F,
+0x3F, 0x3F, 0x7E, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x83, 0x00, 0x03, 0x40, 0xE0,
+0xF0, 0xF0, 0x81, 0xF7, 0x83, 0xF0, 0x00, 0xF8, 0x86, 0x78, 0x00, 0x7C, 0x84, 0xFC, 0x82, 0xFE,
+0x8A, 0xFF, 0x03, 0xFE, 0xFC, 0x3C, 0x08, 0x8B, 0x00, 0x80, 0x80, 0x0D, 0xC0, 0xE0, 0xF0, 0xF0,
+0xF8, 0xFC, 0x7C, 0x7E, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x06, 0xA6, 0x00, 0x08, 0x01, 0x03, 0x07,
+0x07, 0x0F, 0x1F, 0x1F, 0x07, 0x02, 0x81, 0x00, 0x80, 0xF0, 0x00, 0x00, 0x82, 0xFE, 0x02, 0x00,
+0x70, 0x30, 0x83, 0x38, 0x06, 0x3C, 0x1C, 0x1C, 0x1E, 0x1E, 0x1F, 0x1F, 0x83, 0x0F, 0x81, 0x07,
+0x00, 0xF7, 0x89, 0xFF, 0x02, 0x3F, 0x0F, 0x01, 0x8B, 0x00, 0x08, 0x06, 0x0F, 0x1F, 0x0F, 0x0F,
+0x07, 0x03, 0x01, 0x01, 0xA5, 0x00, 0x81, 0xFF, 0x00, 0xEF, 0x83, 0xC7, 0x00, 0x04, 0x8D, 0x00,
+0x00, 0x07, 0x81, 0xFF, 0x01, 0xFE, 0xE0, 0x87, 0x00, 0x80, 0x80, 0x81, 0xC0, 0x81, 0xE0, 0x80,
+0xF0, 0x00, 0xF8, 0x88, 0xFF, 0x02, 0x3F, 0x07, 0x01, 0x98, 0x00, 0x81, 0xFF, 0x82, 0xC7, 0x00,
+0x07, 0x9C, 0x00, 0x81, 0x7F, 0x00, 0x75, 0x83, 0x71, 0x00, 0x70, 0x8F, 0x00, 0x06, 0x07, 0x3F,
+0xFF, 0xE3, 0x98, 0x7C, 0xFC, 0x81, 0xFE, 0x80, 0xFF, 0x81, 0x3F, 0x00, 0xBF, 0x88, 0xFF, 0x09,
+0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0xFE, 0x84, 0x02, 0x07, 0x86, 0xFE, 0x00,
+0x00, 0x0C, 0xF8, 0xF0, 0xE0, 0x8B, 0x00, 0x81, 0x7F, 0x82, 0x01, 0xBA, 0x00, 0x06, 0x01, 0x07,
+0x0F, 0x3F, 0xBE, 0x99, 0xE7, 0x82, 0xFF, 0x00, 0xFE, 0x84, 0xFF, 0x04, 0xCF, 0x87, 0x07, 0x03,
+0x01, 0x88, 0x00, 0x87, 0xFF, 0x81, 0x04, 0x03, 0xFC, 0x00, 0x7F, 0xF8, 0xC4, 0x00, 0x81, 0x80,
+0x81, 0xC0, 0x1D, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFE, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x17, 0x3B,
+0x3B, 0x3D, 0x3D, 0x39, 0x33, 0x27, 0x07, 0x0F, 0x1F, 0xBF, 0xFF, 0xFE, 0xFE, 0xFC, 0xF8, 0x70,
+0x30, 0x83, 0x00, 0x00, 0x20, 0x87, 0x3F, 0x07, 0x20, 0x00, 0x00, 0x1F, 0x30, 0x20, 0x1F, 0x1C,
+0xA2, 0x00,
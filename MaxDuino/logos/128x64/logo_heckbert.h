@@ -1,64 +1,26 @@
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0x7f, 0x9f, 0xcf, 0x6f, 0x37, 0x13, 0x9b, 0x8f, 0x45, 0x65, 0xa5, 0xb5, 0xd5, 
-0xd5, 0xd5, 0xd1, 0xd5, 0xd5, 0xd5, 0xdb, 0xd3, 0xd7, 0xd7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xdf, 0xf7, 0xbb, 0xf3, 0xd5, 
-0xd5, 0xd5, 0xd5, 0xc5, 0xe5, 0xa5, 0x4d, 0x4b, 0x8b, 0x1b, 0x17, 0x6f, 0xdf, 0xbf, 0x7f, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0x07, 0xf9, 0xfe, 0x5f, 0x01, 0x00, 0x60, 0x0c, 0xf3, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0x3f, 0x9f, 0x6f, 0x37, 0x1b, 0x0b, 0x0d, 0x05, 0x07, 0x06, 0x06, 0x07, 0x05, 0x05, 
-0x0b, 0x13, 0x77, 0xe7, 0xe3, 0x07, 0xe5, 0xc5, 0x86, 0x06, 0x07, 0x05, 0x0d, 0x1b, 0x37, 0x6f, 
-0xdf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0x63, 0xfc, 0x00, 0x00, 0x4f, 0xfe, 0xf1, 
-0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xf8, 0xc7, 0x3f, 0xfb, 0xa0, 0x00, 0x01, 0x0e, 0x09, 0x17, 0x37, 0x3f, 0x17, 0x17, 0x0b, 
-0xcd, 0xe6, 0xf3, 0xf8, 0xf8, 0xf8, 0xfc, 0x7c, 0x9c, 0xcc, 0xee, 0x86, 0xe4, 0xfc, 0xbc, 0xbe, 
-0xbe, 0x77, 0xe4, 0xdb, 0x7b, 0xff, 0xe3, 0xe5, 0xfe, 0x0e, 0x8e, 0xf0, 0xe4, 0x1c, 0xfc, 0xf8, 
-0xf8, 0xe1, 0xc6, 0x05, 0x0b, 0x17, 0x37, 0x17, 0x1b, 0x0c, 0x07, 0x80, 0xc0, 0xfd, 0x3f, 0xc7, 
-0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xf3, 0xf7, 0xee, 0xec, 0xcc, 0xdc, 0x18, 0xe0, 0xfc, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x9f, 0x03, 0xff, 0xff, 0xff, 0xf9, 0xf4, 0xf4, 0xf0, 
-0xf8, 0xfe, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0xe0, 0x94, 0x45, 0x1f, 0xbf, 
-0x7f, 0x7f, 0x7f, 0xfe, 0xfc, 0xf0, 0xc4, 0xac, 0x6c, 0xf6, 0xf7, 0xfb, 0xfd, 0xfe, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x97, 0xd1, 0x9e, 0xcf, 0x6f, 0x0f, 
-0xf7, 0xf7, 0xf7, 0xf3, 0x01, 0xfc, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 
-0x7f, 0xff, 0xe1, 0xf2, 0xfa, 0xc6, 0xe6, 0xec, 0xdd, 0xfb, 0xfb, 0xf7, 0xff, 0xfe, 0xfc, 0xfd, 
-0xfd, 0x7d, 0x83, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x80, 
-0x3f, 0xff, 0xff, 0xff, 0xfe, 0xf0, 0xf7, 0xe7, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfe, 0xf8, 0xf7, 0xef, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xcf, 0xcf, 0xcd, 0xcd, 0x0c, 
-0xea, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfe, 0xf9, 0xf3, 0xef, 0xdf, 0xbf, 0xff, 0xff, 0xfe, 0xfe, 0xec, 0xc1, 0x9b, 0x8f, 0x07, 0x8f, 
-0x0f, 0x7f, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0x79, 0x7d, 0x7d, 0x21, 0xdd, 0xfd, 0xfd, 0xfc, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf5, 0xfc, 0xff, 
-0xe2, 0xf0, 0xe0, 0xc7, 0x81, 0xc0, 0x80, 0x80, 0xc0, 0xc3, 0x87, 0xe7, 0xf7, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xA1, 0xFF, 0x0B, 0x7F, 0x9F, 0xCF, 0x6F, 0x37, 0x13, 0x9B, 0x8F, 0x45, 0x65, 0xA5, 0xB5, 0x81,
+0xD5, 0x00, 0xD1, 0x81, 0xD5, 0x04, 0xDB, 0xD3, 0xD7, 0xD7, 0xE7, 0x8D, 0xFF, 0x04, 0xCF, 0xDF,
+0xF7, 0xBB, 0xF3, 0x82, 0xD5, 0x0B, 0xC5, 0xE5, 0xA5, 0x4D, 0x4B, 0x8B, 0x1B, 0x17, 0x6F, 0xDF,
+0xBF, 0x7F, 0xC0, 0xFF, 0x0A, 0x07, 0xF9, 0xFE, 0x5F, 0x01, 0x00, 0x60, 0x0C, 0xF3, 0xFC, 0xFE,
+0x84, 0xFF, 0x1F, 0x3F, 0x9F, 0x6F, 0x37, 0x1B, 0x0B, 0x0D, 0x05, 0x07, 0x06, 0x06, 0x07, 0x05,
+0x05, 0x0B, 0x13, 0x77, 0xE7, 0xE3, 0x07, 0xE5, 0xC5, 0x86, 0x06, 0x07, 0x05, 0x0D, 0x1B, 0x37,
+0x6F, 0xDF, 0x3F, 0x83, 0xFF, 0x09, 0xFE, 0xFD, 0x63, 0xFC, 0x00, 0x00, 0x4F, 0xFE, 0xF1, 0x0F,
+0xBE, 0xFF, 0x11, 0xF8, 0xC7, 0x3F, 0xFB, 0xA0, 0x00, 0x01, 0x0E, 0x09, 0x17, 0x37, 0x3F, 0x17,
+0x17, 0x0B, 0xCD, 0xE6, 0xF3, 0x81, 0xF8, 0x2A, 0xFC, 0x7C, 0x9C, 0xCC, 0xEE, 0x86, 0xE4, 0xFC,
+0xBC, 0xBE, 0xBE, 0x77, 0xE4, 0xDB, 0x7B, 0xFF, 0xE3, 0xE5, 0xFE, 0x0E, 0x8E, 0xF0, 0xE4, 0x1C,
+0xFC, 0xF8, 0xF8, 0xE1, 0xC6, 0x05, 0x0B, 0x17, 0x37, 0x17, 0x1B, 0x0C, 0x07, 0x80, 0xC0, 0xFD,
+0x3F, 0xC7, 0xF8, 0xC1, 0xFF, 0x0A, 0xFE, 0xF9, 0xF3, 0xF7, 0xEE, 0xEC, 0xCC, 0xDC, 0x18, 0xE0,
+0xFC, 0x85, 0xFF, 0x02, 0x7F, 0x9F, 0x03, 0x81, 0xFF, 0x08, 0xF9, 0xF4, 0xF4, 0xF0, 0xF8, 0xFE,
+0xEF, 0xFF, 0xFE, 0x82, 0xFF, 0x06, 0xFC, 0xF0, 0xE0, 0x94, 0x45, 0x1F, 0xBF, 0x81, 0x7F, 0x0A,
+0xFE, 0xFC, 0xF0, 0xC4, 0xAC, 0x6C, 0xF6, 0xF7, 0xFB, 0xFD, 0xFE, 0xC9, 0xFF, 0x06, 0x8F, 0x97,
+0xD1, 0x9E, 0xCF, 0x6F, 0x0F, 0x81, 0xF7, 0x05, 0xF3, 0x01, 0xFC, 0xFE, 0xFF, 0xFE, 0x81, 0xFF,
+0x16, 0xDF, 0xFF, 0xFF, 0xBF, 0x7F, 0xFF, 0xE1, 0xF2, 0xFA, 0xC6, 0xE6, 0xEC, 0xDD, 0xFB, 0xFB,
+0xF7, 0xFF, 0xFE, 0xFC, 0xFD, 0xFD, 0x7D, 0x83, 0x84, 0xFE, 0xD3, 0xFF, 0x02, 0xFC, 0x80, 0x3F,
+0x81, 0xFF, 0x04, 0xFE, 0xF0, 0xF7, 0xE7, 0x0F, 0x85, 0xFF, 0x03, 0xFE, 0xF8, 0xF7, 0xEF, 0x85,
+0xDF, 0x80, 0xCF, 0x80, 0xCD, 0x02, 0x0C, 0xEA, 0xF7, 0xDC, 0xFF, 0x11, 0xFE, 0xF9, 0xF3, 0xEF,
+0xDF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFE, 0xEC, 0xC1, 0x9B, 0x8F, 0x07, 0x8F, 0x0F, 0x7F, 0x81, 0xFF,
+0x80, 0xF9, 0x07, 0x79, 0x7D, 0x7D, 0x21, 0xDD, 0xFD, 0xFD, 0xFC, 0xEB, 0xFF, 0x10, 0xFB, 0xF5,
+0xFC, 0xFF, 0xE2, 0xF0, 0xE0, 0xC7, 0x81, 0xC0, 0x80, 0x80, 0xC0, 0xC3, 0x87, 0xE7, 0xF7, 0xB1,
+0xFF,
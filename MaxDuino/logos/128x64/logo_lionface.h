@@ -1,64 +1,46 @@
-0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0x60, 
-0x60, 0xf0, 0xf0, 0xe8, 0xe0, 0xe2, 0xe6, 0xfe, 0xfe, 0xfe, 0xff, 0x7f, 0x3f, 0x3f, 0x1f, 0x1f, 
-0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x7f, 0x3f, 
-0x1f, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0xfe, 0xfe, 0xfe, 0xe6, 0xe2, 0xe0, 0xe8, 0xf0, 0xf0, 
-0x60, 0x60, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
-0x7f, 0x1f, 0x0f, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xe0, 0xf0, 
-0xf0, 0x78, 0x38, 0x3c, 0x1c, 0x1e, 0x0e, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x03, 0x0f, 0x1f, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfc, 0xfc, 0xf8, 0xf0, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0x40, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfc, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0x1f, 0x0f, 0x03, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0e, 0x0e, 0x1c, 0x3c, 0x38, 0x78, 
-0xf0, 0xf0, 0xe0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0f, 0x1f, 
-0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0x7c, 0x3e, 0x1f, 0x0f, 0x07, 0x03, 0x03, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 
-0xe0, 0xe0, 0x78, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xfe, 0x3f, 0x00, 0xc0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0x00, 0x3f, 0xfe, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78, 0xf0, 
-0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x1f, 0x3e, 0x7c, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 
-0xfe, 0xff, 0x7f, 0x1f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xe0, 0xf0, 0x78, 0x3c, 0x1e, 0x0e, 0x07, 0x07, 0x03, 
-0x01, 0x00, 0x00, 0x80, 0xc7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xdf, 0xc3, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xe1, 0xcf, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xc7, 0x80, 0x00, 0x00, 
-0x01, 0x03, 0x07, 0x07, 0x0e, 0x1e, 0x3c, 0x78, 0xf0, 0xe0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1f, 0x7f, 0xff, 
-0x7f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 
-0x78, 0x3c, 0x1e, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x60, 0x30, 0x18, 
-0x0c, 0x06, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x01, 0x07, 0xdf, 0xff, 0xef, 0x8f, 0x27, 0x47, 
-0x8f, 0x1f, 0x3f, 0x3f, 0x7f, 0x71, 0x63, 0xc3, 0xc3, 0x83, 0x83, 0x07, 0x07, 0x07, 0x0f, 0x0f, 
-0x0f, 0x0f, 0x0f, 0x07, 0x07, 0x07, 0x83, 0x83, 0xc3, 0xc3, 0xe3, 0xf1, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x07, 0x01, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x06, 
-0x0c, 0x18, 0x30, 0x60, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1e, 0x3c, 
-0x78, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0xf8, 0xfc, 0xff, 0x7f, 0x0f, 0x03, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0x38, 0x0c, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xc0, 0xe0, 0xf0, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x01, 0x3f, 0xff, 0xfe, 0xfc, 
-0xfc, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfb, 0xfe, 0xfe, 0x7c, 
-0x00, 0x7c, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xdf, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xdf, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x3f, 0x01, 0x03, 0x07, 0x0e, 0x1c, 0x38, 0xf0, 0xe0, 0xc0, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0c, 0x38, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x01, 0x03, 0x0f, 0x7f, 0xff, 0xfc, 0xf8, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xfc, 0x00, 0x00, 0x00, 0xe0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xe0, 0x3c, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf0, 
-0xfc, 0x3e, 0x0f, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xc1, 
-0xf3, 0xff, 0xff, 0xc3, 0x03, 0x03, 0x07, 0x87, 0xc7, 0xe7, 0xe3, 0xf3, 0xf1, 0xf0, 0xf8, 0xf8, 
-0xf8, 0xf8, 0xf8, 0xf0, 0xf1, 0xf3, 0xe3, 0xe7, 0xc7, 0x87, 0x07, 0x03, 0x03, 0xc3, 0xff, 0xff, 
-0xf3, 0xc1, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0f, 0x3e, 
-0xfc, 0xf0, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3c, 0xe0, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf8, 0xfe, 0xff, 0x1f, 0x07, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf0, 0x7c, 0x3e, 0x0f, 0x03, 
-0x01, 0x00, 0x01, 0xe7, 0xff, 0xff, 0x3f, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x7f, 0x7f, 
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x3f, 0xff, 0xff, 0xe7, 0x01, 0x00, 
-0x01, 0x03, 0x0f, 0x3e, 0x7c, 0xf0, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x07, 0x1f, 0xff, 0xfe, 0xf8, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xff
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x82, 0xFF, 0x80, 0xFE, 0x07, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x03, 0x01, 0x8A, 0x00, 0x80,
+0x80, 0x81, 0xC0, 0x80, 0x60, 0x80, 0xF0, 0x03, 0xE8, 0xE0, 0xE2, 0xE6, 0x81, 0xFE, 0x03, 0xFF,
+0x7F, 0x3F, 0x3F, 0x81, 0x1F, 0x80, 0x3F, 0x80, 0x7F, 0x95, 0xFF, 0x81, 0x7F, 0x00, 0x3F, 0x81,
+0x1F, 0x80, 0x3F, 0x80, 0x7F, 0x81, 0xFE, 0x07, 0xE6, 0xE2, 0xE0, 0xE8, 0xF0, 0xF0, 0x60, 0x60,
+0x81, 0xC0, 0x80, 0x80, 0x8A, 0x00, 0x09, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFE,
+0xFE, 0x81, 0xFF, 0x04, 0x7F, 0x1F, 0x0F, 0x03, 0x01, 0x84, 0x00, 0x11, 0x80, 0xC0, 0xC0, 0xE0,
+0xF0, 0xF0, 0x78, 0x38, 0x3C, 0x1C, 0x1E, 0x0E, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x83, 0x00,
+0x02, 0x03, 0x0F, 0x1F, 0x81, 0xFF, 0x00, 0xFD, 0x81, 0xFC, 0x01, 0xF8, 0xF0, 0x83, 0xE0, 0x00,
+0x40, 0x81, 0x00, 0x00, 0x03, 0x8F, 0xFF, 0x00, 0x03, 0x82, 0x00, 0x83, 0xE0, 0x01, 0xF0, 0xF8,
+0x81, 0xFC, 0x00, 0xFD, 0x81, 0xFF, 0x02, 0x1F, 0x0F, 0x03, 0x83, 0x00, 0x80, 0x01, 0x80, 0x03,
+0x80, 0x07, 0x80, 0x0E, 0x09, 0x1C, 0x3C, 0x38, 0x78, 0xF0, 0xF0, 0xE0, 0xC0, 0xC0, 0x80, 0x84,
+0x00, 0x12, 0x01, 0x03, 0x0F, 0x1F, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F,
+0x0F, 0x07, 0x03, 0x03, 0x01, 0x8D, 0x00, 0x05, 0x80, 0xC0, 0xE0, 0xE0, 0x78, 0xFC, 0x8D, 0xFF,
+0x04, 0xFE, 0x3F, 0x00, 0xC0, 0xFC, 0x8F, 0xFF, 0x04, 0xFC, 0xE0, 0x00, 0x3F, 0xFE, 0x8D, 0xFF,
+0x05, 0xFC, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8D, 0x00, 0x13, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x1F,
+0x3E, 0x7C, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0xFE, 0xFF, 0x7F, 0x1F, 0x07, 0x01, 0x8C, 0x00,
+0x11, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0E, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00,
+0x80, 0xC7, 0xDF, 0x8A, 0xFF, 0x03, 0xDF, 0xC3, 0xF8, 0xFE, 0x94, 0xFF, 0x02, 0xF8, 0xE1, 0xCF,
+0x8A, 0xFF, 0x11, 0xDF, 0xC7, 0x80, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x0E, 0x1E, 0x3C, 0x78,
+0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x8C, 0x00, 0x06, 0x01, 0x07, 0x1F, 0x7F, 0xFF, 0x7F, 0x03, 0x88,
+0x00, 0x0A, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0x01, 0x82, 0x00, 0x09,
+0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x81, 0x00, 0x12, 0x01, 0x07, 0xDF,
+0xFF, 0xEF, 0x8F, 0x27, 0x47, 0x8F, 0x1F, 0x3F, 0x3F, 0x7F, 0x71, 0x63, 0xC3, 0xC3, 0x83, 0x83,
+0x81, 0x07, 0x83, 0x0F, 0x81, 0x07, 0x80, 0x83, 0x80, 0xC3, 0x01, 0xE3, 0xF1, 0x88, 0xFF, 0x02,
+0xDF, 0x07, 0x01, 0x81, 0x00, 0x09, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x80,
+0x82, 0x00, 0x0A, 0x01, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x88, 0x00,
+0x00, 0x03, 0x85, 0x00, 0x08, 0xC0, 0xE0, 0xF8, 0xFC, 0xFF, 0x7F, 0x0F, 0x03, 0x01, 0x84, 0x00,
+0x05, 0xC0, 0xE0, 0x38, 0x0C, 0x07, 0x03, 0x85, 0x00, 0x0E, 0xC0, 0xE0, 0xF0, 0x38, 0x1C, 0x0E,
+0x07, 0x03, 0x01, 0x3F, 0xFF, 0xFE, 0xFC, 0xFC, 0xF8, 0x88, 0xF9, 0x07, 0xFB, 0xFE, 0xFE, 0x7C,
+0x00, 0x7C, 0xFE, 0xFE, 0x81, 0xFF, 0x00, 0xDF, 0x84, 0x9F, 0x00, 0xDF, 0x83, 0xFF, 0x09, 0x3F,
+0x01, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0xF0, 0xE0, 0xC0, 0x85, 0x00, 0x05, 0x03, 0x07, 0x0C, 0x38,
+0xE0, 0xC0, 0x84, 0x00, 0x08, 0x01, 0x03, 0x0F, 0x7F, 0xFF, 0xFC, 0xF8, 0xE0, 0xC0, 0x84, 0x00,
+0x00, 0xFC, 0x81, 0x00, 0x01, 0xE0, 0xFC, 0x83, 0xFF, 0x00, 0x03, 0x85, 0x00, 0x03, 0xE0, 0x3C,
+0x0F, 0x03, 0x84, 0x00, 0x07, 0x80, 0xE0, 0xF0, 0xFC, 0x3E, 0x0F, 0x03, 0x01, 0x87, 0x00, 0x0F,
+0x81, 0xC1, 0xF3, 0xFF, 0xFF, 0xC3, 0x03, 0x03, 0x07, 0x87, 0xC7, 0xE7, 0xE3, 0xF3, 0xF1, 0xF0,
+0x83, 0xF8, 0x0F, 0xF0, 0xF1, 0xF3, 0xE3, 0xE7, 0xC7, 0x87, 0x07, 0x03, 0x03, 0xC3, 0xFF, 0xFF,
+0xF3, 0xC1, 0x81, 0x87, 0x00, 0x07, 0x01, 0x03, 0x0F, 0x3E, 0xFC, 0xF0, 0xE0, 0x80, 0x84, 0x00,
+0x03, 0x03, 0x0F, 0x3C, 0xE0, 0x85, 0x00, 0x00, 0x03, 0x83, 0xFF, 0x01, 0xFC, 0xE0, 0x81, 0x00,
+0x80, 0xFF, 0x01, 0xF8, 0xFE, 0x85, 0xFF, 0x85, 0x00, 0x01, 0x1E, 0x01, 0x84, 0x00, 0x05, 0xE0,
+0xF8, 0xFE, 0xFF, 0x1F, 0x07, 0x87, 0x00, 0x0E, 0x80, 0xE0, 0xF0, 0x7C, 0x3E, 0x0F, 0x03, 0x01,
+0x00, 0x01, 0xE7, 0xFF, 0xFF, 0x3F, 0x1F, 0x82, 0xFF, 0x87, 0x7F, 0x82, 0xFF, 0x0E, 0x1F, 0x3F,
+0xFF, 0xFF, 0xE7, 0x01, 0x00, 0x01, 0x03, 0x0F, 0x3E, 0x7C, 0xF0, 0xE0, 0x80, 0x87, 0x00, 0x05,
+0x07, 0x1F, 0xFF, 0xFE, 0xF8, 0xE0, 0x84, 0x00, 0x01, 0x01, 0x1E, 0x85, 0x00, 0x85, 0xFF, 0x02,
+0xFE, 0xF8, 0xFF,
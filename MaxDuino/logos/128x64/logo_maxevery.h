@@ -1,103 +1,26 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFE, 0xFC, 0xE0, 0x80, 0x00,
-0x00, 0xC0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-0x00, 0xC0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0x07,
-0x0F, 0x3E, 0xFC, 0xF8, 0xE0, 0xF0, 0xF8, 0x7E, 0x1F, 0x0F,
-0x02, 0xFE, 0xFE, 0xFF, 0xFF, 0x0F, 0x0F, 0x0E, 0x0E, 0x1E,
-0x3E, 0xFC, 0xF8, 0xF8, 0xE0, 0xFE, 0xFF, 0xFF, 0xFE, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0xFE, 0xFF,
-0xFF, 0x00, 0xFE, 0xFF, 0xFF, 0xFE, 0xFC, 0xF0, 0xC0, 0x00,
-0xFE, 0xFF, 0xFF, 0xFE, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x3E,
-0x3E, 0x1F, 0x1F, 0x1E, 0x1E, 0x3E, 0xFE, 0xFC, 0xF8, 0xF0,
-0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x1F, 0x1F, 0x3F, 0x3F, 0x0F, 0x1F, 0x7F, 0xFE, 0xFF, 0x3F,
-0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xF8, 0xFF, 0x7F,
-0x1F, 0x03, 0x39, 0x7F, 0x3F, 0x3F, 0x00, 0x80, 0xE0, 0xF8,
-0xFE, 0x3F, 0x0F, 0x1F, 0x7F, 0xFC, 0xF0, 0xC0, 0x80, 0x3F,
-0x3F, 0x3F, 0x7F, 0xC0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xFC,
-0x7F, 0x3F, 0x0F, 0x03, 0x0F, 0x1F, 0x3F, 0x3C, 0x3C, 0x38,
-0x38, 0x3C, 0x3F, 0x1F, 0x1F, 0x00, 0x3F, 0x3F, 0x3F, 0x00,
-0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0x07, 0x1F, 0x3F, 0xFF, 0xFF,
-0xFF, 0xFF, 0x07, 0x1F, 0x3F, 0x7F, 0x7F, 0xF8, 0xF0, 0xE0,
-0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0x7F, 0x7F, 0x1F, 0x0F, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-0xF0, 0xF8, 0xF8, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-0x78, 0x78, 0x08, 0x78, 0xF8, 0xF8, 0xF0, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x80, 0xF0, 0xF8, 0xF8, 0x78, 0x18, 0xE0,
-0xF8, 0xF8, 0xF8, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-0x78, 0x78, 0x00, 0xF8, 0xF8, 0xF8, 0x78, 0x78, 0x78, 0x78,
-0x78, 0x78, 0xF8, 0xF8, 0xF8, 0xF0, 0x00, 0x08, 0x38, 0x78,
-0xF8, 0xF8, 0xE0, 0xC0, 0x80, 0x80, 0xE0, 0xF0, 0xF8, 0xF8,
-0x38, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-0xFF, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
-0x00, 0x00, 0x01, 0x0F, 0x3F, 0xFF, 0xFE, 0xF8, 0xE0, 0xF0,
-0xFE, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-0xFF, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x87,
-0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03,
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x03,
-0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
-0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xFF, 0x00, 0x8B, 0x00, 0x0E, 0xFE, 0xFF, 0xFF, 0xFE, 0xFC, 0xE0, 0x80, 0x00, 0x00, 0xC0, 0xF8,
+0xFE, 0xFF, 0xFF, 0xFE, 0x82, 0x00, 0x02, 0xC0, 0xF8, 0xFE, 0x81, 0xFF, 0x1F, 0xFE, 0x02, 0x07,
+0x0F, 0x3E, 0xFC, 0xF8, 0xE0, 0xF0, 0xF8, 0x7E, 0x1F, 0x0F, 0x02, 0xFE, 0xFE, 0xFF, 0xFF, 0x0F,
+0x0F, 0x0E, 0x0E, 0x1E, 0x3E, 0xFC, 0xF8, 0xF8, 0xE0, 0xFE, 0xFF, 0xFF, 0xFE, 0x83, 0x00, 0x24,
+0xFE, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0xFF, 0xFE, 0xFC, 0xF0, 0xC0, 0x00,
+0xFE, 0xFF, 0xFF, 0xFE, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x3E, 0x3E, 0x1F, 0x1F, 0x1E, 0x1E, 0x3E,
+0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x00, 0x80, 0x1F, 0x80, 0x3F, 0x06, 0x0F, 0x1F, 0x7F, 0xFE,
+0xFF, 0x3F, 0x0F, 0x82, 0xFF, 0x17, 0x00, 0xC0, 0xF8, 0xFF, 0x7F, 0x1F, 0x03, 0x39, 0x7F, 0x3F,
+0x3F, 0x00, 0x80, 0xE0, 0xF8, 0xFE, 0x3F, 0x0F, 0x1F, 0x7F, 0xFC, 0xF0, 0xC0, 0x80, 0x81, 0x3F,
+0x01, 0x7F, 0xC0, 0x81, 0xE0, 0x80, 0xF0, 0x10, 0xFC, 0x7F, 0x3F, 0x0F, 0x03, 0x0F, 0x1F, 0x3F,
+0x3C, 0x3C, 0x38, 0x38, 0x3C, 0x3F, 0x1F, 0x1F, 0x00, 0x81, 0x3F, 0x00, 0x00, 0x81, 0xFF, 0x04,
+0xFD, 0x03, 0x07, 0x1F, 0x3F, 0x82, 0xFF, 0x07, 0x07, 0x1F, 0x3F, 0x7F, 0x7F, 0xF8, 0xF0, 0xE0,
+0x81, 0xF0, 0x05, 0xF8, 0xFF, 0x7F, 0x7F, 0x1F, 0x0F, 0xA7, 0x00, 0x81, 0x01, 0x00, 0x00, 0x81,
+0x01, 0x86, 0x00, 0x81, 0x01, 0x84, 0x00, 0x81, 0x01, 0x83, 0x00, 0x81, 0x01, 0x95, 0x00, 0x81,
+0x01, 0x84, 0x00, 0x02, 0x03, 0x07, 0x0F, 0x84, 0x00, 0x83, 0x01, 0xAE, 0x00, 0x03, 0xE0, 0xF0,
+0xF8, 0xF8, 0x87, 0x78, 0x05, 0x08, 0x78, 0xF8, 0xF8, 0xF0, 0x80, 0x83, 0x00, 0x06, 0x80, 0xF0,
+0xF8, 0xF8, 0x78, 0x18, 0xE0, 0x81, 0xF8, 0x87, 0x78, 0x00, 0x00, 0x81, 0xF8, 0x84, 0x78, 0x81,
+0xF8, 0x10, 0xF0, 0x00, 0x08, 0x38, 0x78, 0xF8, 0xF8, 0xE0, 0xC0, 0x80, 0x80, 0xE0, 0xF0, 0xF8,
+0xF8, 0x38, 0x18, 0xB5, 0x00, 0x82, 0xFF, 0x87, 0x8F, 0x80, 0x00, 0x0E, 0x01, 0x0F, 0x3F, 0xFF,
+0xFE, 0xF8, 0xE0, 0xF0, 0xFE, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x82, 0xFF, 0x86, 0x8F, 0x01,
+0x87, 0x00, 0x81, 0xFF, 0x84, 0x0F, 0x81, 0xFF, 0x00, 0xF9, 0x83, 0x00, 0x01, 0x03, 0x07, 0x82,
+0xFF, 0x01, 0x03, 0x01, 0xB9, 0x00, 0x8A, 0x03, 0x84, 0x00, 0x83, 0x03, 0x00, 0x01, 0x83, 0x00,
+0x00, 0x01, 0x8A, 0x03, 0x00, 0x00, 0x81, 0x03, 0x84, 0x00, 0x82, 0x03, 0x85, 0x00, 0x82, 0x03,
+0xFF, 0x00, 0x9E, 0x00,
@@ -1,103 +1,21 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFE, 0xFE, 0xFE, 0xFE,
-0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xC0, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xC0, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
-0xFE, 0xFE, 0xFE, 0xFC, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x80, 0xC0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE,
-0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
-0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
-0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
-0xFE, 0xFC, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x80, 0xC0, 0xF0, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
-0xFE, 0xFE, 0xFE, 0x7E, 0x3E, 0x0E, 0x02, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x80, 0x00, 0x00, 0xC0,
-0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xF8, 0x80, 0x00, 0x00, 0xF0, 0xFE, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0x1F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xF8, 0xFE, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0x07,
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFC, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xF8, 0x80, 0x03, 0x3F, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFC, 0xFC, 0xFC,
-0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
-0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0F, 0x3F, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x1F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x0F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x0F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F,
-0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x80, 0xC0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-0xF8, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x3F, 0x01, 0x00, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x01,
-0x00, 0x00, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
-0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
-0xF8, 0xF8, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xC0, 0xE0, 0xF8, 0xFE, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0x07,
-0x03, 0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7F, 0x7F,
-0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x07, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x03, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F,
-0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x03, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x07, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x07, 0x63,
-0x78, 0x7C, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-0x7F, 0x1F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x03, 0x0F, 0x1F, 0x7F, 0x7F, 0x7F, 0x7F,
-0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7C, 0x70, 0x60, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xFF, 0x00, 0x8E, 0x00, 0x00, 0xF0, 0x87, 0xFE, 0x01, 0xFC, 0xC0, 0x84, 0x00, 0x00, 0xC0, 0x87,
+0xFE, 0x01, 0xFC, 0xC0, 0x84, 0x00, 0x06, 0x80, 0xC0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0x9F, 0xFE,
+0x03, 0xFC, 0xF8, 0xE0, 0x80, 0x84, 0x00, 0x03, 0x80, 0xC0, 0xF0, 0xFC, 0x86, 0xFE, 0x03, 0x7E,
+0x3E, 0x0E, 0x02, 0x96, 0x00, 0x00, 0xE0, 0x8B, 0xFF, 0x05, 0xF8, 0x80, 0x00, 0x00, 0xC0, 0xFC,
+0x8A, 0xFF, 0x05, 0xF8, 0x80, 0x00, 0x00, 0xF0, 0xFE, 0x86, 0xFF, 0x00, 0x3F, 0x99, 0x1F, 0x00,
+0x7F, 0x86, 0xFF, 0x04, 0xFC, 0xF0, 0xF0, 0xF8, 0xFE, 0x86, 0xFF, 0x03, 0x3F, 0x1F, 0x07, 0x01,
+0x98, 0x00, 0x01, 0x80, 0xFC, 0x8E, 0xFF, 0x01, 0xF8, 0xFC, 0x8E, 0xFF, 0x03, 0xF8, 0x80, 0x03,
+0x3F, 0x86, 0xFF, 0x00, 0xFE, 0x8C, 0xFC, 0x80, 0xF8, 0x03, 0xF0, 0xE0, 0xC0, 0x80, 0x86, 0x00,
+0x03, 0x01, 0x03, 0x0F, 0x3F, 0x8B, 0xFF, 0x02, 0x1F, 0x07, 0x03, 0x9C, 0x00, 0x00, 0xF8, 0x87,
+0xFF, 0x01, 0x0F, 0x1F, 0x8E, 0xFF, 0x01, 0x0F, 0x1F, 0x87, 0xFF, 0x06, 0xF0, 0x00, 0x00, 0x03,
+0x07, 0x0F, 0x0F, 0x84, 0x1F, 0x88, 0x3F, 0x86, 0xFF, 0x01, 0xFE, 0xF8, 0x83, 0x00, 0x03, 0x80,
+0xC0, 0xF0, 0xFC, 0x8C, 0xFF, 0x03, 0xFE, 0xF8, 0xF0, 0xC0, 0x99, 0x00, 0x00, 0xE0, 0x87, 0xFF,
+0x05, 0x3F, 0x01, 0x00, 0x00, 0x03, 0x3F, 0x8A, 0xFF, 0x05, 0x1F, 0x01, 0x00, 0x00, 0x01, 0x3F,
+0x87, 0xFF, 0x92, 0xF8, 0x00, 0xFC, 0x87, 0xFF, 0x05, 0x3F, 0x00, 0xC0, 0xE0, 0xF8, 0xFE, 0x86,
+0xFF, 0x06, 0x3F, 0x1F, 0x07, 0x03, 0x07, 0x1F, 0x7F, 0x86, 0xFF, 0x03, 0xFE, 0xF8, 0xE0, 0x80,
+0x93, 0x00, 0x00, 0x7C, 0x87, 0x7F, 0x00, 0x07, 0x84, 0x00, 0x01, 0x03, 0x3F, 0x86, 0x7F, 0x01,
+0x3F, 0x03, 0x84, 0x00, 0x00, 0x07, 0x9D, 0x7F, 0x80, 0x3F, 0x05, 0x1F, 0x0F, 0x07, 0x63, 0x78,
+0x7C, 0x87, 0x7F, 0x02, 0x1F, 0x0F, 0x03, 0x87, 0x00, 0x02, 0x03, 0x0F, 0x1F, 0x87, 0x7F, 0x02,
+0x7C, 0x70, 0x60, 0xFF, 0x00, 0x85, 0x00,
@@ -1,64 +1,19 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xe0, 0x80, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0f, 0xcf, 0xff, 0xff, 0xff, 
-0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0xd8, 0xb8, 0xb8, 0xf8, 0xe8, 0xe8, 0xfc, 0xbc, 
-0x9c, 0xfc, 0x7c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf8, 0x3e, 0xff, 0xff, 0x0f, 0x03, 
-0x7f, 0xff, 0x9e, 0x78, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2e, 
-0xfe, 0xff, 0x4d, 0x77, 0xfb, 0xfd, 0xde, 0x9f, 0xff, 0xff, 0xff, 0x7e, 0x7e, 0x7e, 0x20, 0x03, 
-0x03, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-0x80, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xe0, 0xfc, 0xff, 0xdf, 0xc1, 0xf8, 0xff, 0xff, 0x60, 0x60, 
-0x60, 0x7f, 0x3f, 0x38, 0xb1, 0xbf, 0xbf, 0xbc, 0xf0, 0xf0, 0xf8, 0xd8, 0xcc, 0xc6, 0xc7, 0xe3, 
-0xe1, 0xe0, 0xf0, 0xf0, 0xf8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xef, 0xd3, 0xbb, 0xbf, 0x7f, 0xff, 0xbb, 0xc7, 
-0xff, 0xff, 0xc7, 0xbb, 0xbf, 0xbf, 0xff, 0xfb, 0x87, 0xef, 0xff, 0xff, 0xc3, 0xbb, 0xbf, 0xbf, 
-0xff, 0xfb, 0xc7, 0xff, 0xff, 0xe7, 0xdb, 0xbf, 0xbf, 0xbf, 0xbb, 0xf3, 0xc7, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0xff, 0xff, 0xfd, 0x7f, 0xfe, 
-0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0xf7, 0xff, 0xff, 0xff, 
-0x7f, 0x7f, 0x7f, 0x7d, 0x7f, 0x6f, 0x3f, 0x7f, 0xff, 0xff, 0xdf, 0x9f, 0x9f, 0x1f, 0x0b, 0x07, 
-0x1f, 0x3f, 0x7b, 0xf3, 0xe1, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 
-0x7f, 0xff, 0xff, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0f, 0x3f, 
-0x7f, 0xfe, 0xf8, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x1f, 0x1e, 0x1c, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xBA, 0x00, 0x03, 0x80, 0xE0, 0xE0, 0x80, 0xF8, 0x00, 0x02, 0x02, 0x0F, 0xCF, 0x82, 0xFF, 0x00,
+0x8F, 0x8D, 0x00, 0x00, 0x80, 0x82, 0xC0, 0x80, 0x80, 0x0B, 0xD8, 0xB8, 0xB8, 0xF8, 0xE8, 0xE8,
+0xFC, 0xBC, 0x9C, 0xFC, 0x7C, 0x0C, 0xD3, 0x00, 0x0C, 0xC0, 0xF8, 0x3E, 0xFF, 0xFF, 0x0F, 0x03,
+0x7F, 0xFF, 0x9E, 0x78, 0xE0, 0xC0, 0x86, 0x00, 0x09, 0x04, 0x2E, 0xFE, 0xFF, 0x4D, 0x77, 0xFB,
+0xFD, 0xDE, 0x9F, 0x81, 0xFF, 0x81, 0x7E, 0x04, 0x20, 0x03, 0x03, 0x07, 0x03, 0xC1, 0x00, 0x00,
+0x80, 0x81, 0xC0, 0x89, 0x80, 0x08, 0xC0, 0xE0, 0xFC, 0xFF, 0xDF, 0xC1, 0xF8, 0xFF, 0xFF, 0x81,
+0x60, 0x14, 0x7F, 0x3F, 0x38, 0xB1, 0xBF, 0xBF, 0xBC, 0xF0, 0xF0, 0xF8, 0xD8, 0xCC, 0xC6, 0xC7,
+0xE3, 0xE1, 0xE0, 0xF0, 0xF0, 0xF8, 0xFD, 0x82, 0xFF, 0xC8, 0x00, 0x00, 0x0C, 0x81, 0xFF, 0x1E,
+0xEF, 0xD3, 0xBB, 0xBF, 0x7F, 0xFF, 0xBB, 0xC7, 0xFF, 0xFF, 0xC7, 0xBB, 0xBF, 0xBF, 0xFF, 0xFB,
+0x87, 0xEF, 0xFF, 0xFF, 0xC3, 0xBB, 0xBF, 0xBF, 0xFF, 0xFB, 0xC7, 0xFF, 0xFF, 0xE7, 0xDB, 0x81,
+0xBF, 0x02, 0xBB, 0xF3, 0xC7, 0x87, 0xFF, 0x03, 0x7F, 0x3F, 0x1F, 0x03, 0xC9, 0x00, 0x00, 0x1F,
+0x83, 0x7F, 0x80, 0xFF, 0x03, 0xFD, 0x7F, 0xFE, 0xFB, 0x87, 0xFF, 0x02, 0xCF, 0x7B, 0xF7, 0x81,
+0xFF, 0x81, 0x7F, 0x14, 0x7D, 0x7F, 0x6F, 0x3F, 0x7F, 0xFF, 0xFF, 0xDF, 0x9F, 0x9F, 0x1F, 0x0B,
+0x07, 0x1F, 0x3F, 0x7B, 0xF3, 0xE1, 0xC0, 0xC0, 0x80, 0xD4, 0x00, 0x06, 0x01, 0x0F, 0x7F, 0xFF,
+0xFF, 0xFC, 0xE0, 0x85, 0x00, 0x07, 0x03, 0x07, 0x0F, 0x3F, 0x7F, 0xFE, 0xF8, 0xF0, 0x82, 0x00,
+0x07, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x1E, 0x1C, 0x82, 0x00, 0x01, 0x01, 0x03, 0x81, 0x07,
+0xD6, 0x00, 0x81, 0x03, 0x00, 0x01, 0xC9, 0x00,
@@ -1,64 +1,25 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0xf0, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 
-0xf8, 0xf0, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 
-0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 
-0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 
-0xf8, 0xf8, 0xf0, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 
-0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0xf0, 0x73, 0x73, 0x33, 0x33, 0x73, 0x73, 0xf3, 0xf3, 0xf3, 0xf3, 
-0x73, 0x33, 0x33, 0x33, 0x73, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x73, 0x33, 0x33, 
-0x33, 0x73, 0xf3, 0xf3, 0xf3, 0xf3, 0x73, 0x73, 0x33, 0x33, 0x73, 0x73, 0xf3, 0xf3, 0xf3, 0xf3, 
-0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x73, 0x73, 0x33, 0x33, 0x73, 0x73, 0xf3, 0xf3, 0xf3, 0xf3, 0x73, 
-0x73, 0x33, 0x33, 0x73, 0x73, 0xf0, 0xf0, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x3f, 0x7f, 0xff, 0xff, 0xff, 0xf9, 0xe0, 0xe0, 0xc0, 0xc0, 0xc0, 0xe0, 0xf0, 0xff, 0xff, 0xf0, 
-0xe0, 0xc0, 0xc0, 0xc0, 0xe0, 0xe0, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xc0, 0xc0, 
-0xc0, 0xe0, 0xf0, 0xff, 0xff, 0xf9, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xf0, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf9, 0xe0, 0xe0, 0xc0, 0xc0, 0xc0, 0xe0, 0xf0, 0xff, 0xff, 0xf0, 0xe0, 
-0xc0, 0xc0, 0xc0, 0xe0, 0xe0, 0xf9, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x80, 0xc0, 0xf0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x80, 0xc0, 0xf0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x10, 0x70, 0xf0, 0xf0, 0xf0, 0xf0, 0xe0, 0x80, 
-0xc0, 0x20, 0x10, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x10, 0x10, 0x20, 0x40, 0x80, 0x00, 
-0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 
-0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x00, 0xf0, 0x00, 0x00, 
-0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0x10, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x1c, 0x07, 
-0x0f, 0x1f, 0x3f, 0x1f, 0x06, 0x06, 0x3f, 0x7f, 0x7f, 0x7f, 0x7c, 0x60, 0x40, 0x30, 0x28, 0x26, 
-0x23, 0x2f, 0x3f, 0x7f, 0x7f, 0x7e, 0x78, 0x70, 0x40, 0x20, 0x18, 0x07, 0x0f, 0x1f, 0x7f, 0x7f, 
-0x7e, 0x78, 0x70, 0x40, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x40, 0x40, 0x20, 0x10, 0x0f, 0x00, 
-0x00, 0x1f, 0x3f, 0x7f, 0x7f, 0x7f, 0x40, 0x40, 0x40, 0x20, 0x1f, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 
-0x7f, 0x7f, 0x00, 0x00, 0x7f, 0x03, 0x07, 0x07, 0x0f, 0x1f, 0x1f, 0x3f, 0x3e, 0x7f, 0x00, 0x00, 
-0x0f, 0x1f, 0x3f, 0x7f, 0x7f, 0x40, 0x40, 0x20, 0x10, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xAB, 0x00, 0x8F, 0x80, 0xE7, 0x00, 0x04, 0xC0, 0xE0, 0xF0, 0xFC, 0xFE, 0x91, 0xFF, 0x04, 0xFE,
+0xF8, 0xF0, 0xE0, 0x80, 0xD0, 0x00, 0x01, 0xFE, 0xFF, 0x8C, 0xFE, 0x9D, 0xFF, 0x89, 0xFE, 0x00,
+0xFC, 0x8F, 0xF8, 0x00, 0xF0, 0x8B, 0xFC, 0x00, 0x04, 0x9D, 0x00, 0x02, 0x80, 0xC0, 0xE0, 0x81,
+0xF0, 0x80, 0x73, 0x80, 0x33, 0x80, 0x73, 0x82, 0xF3, 0x00, 0x73, 0x81, 0x33, 0x00, 0x73, 0x86,
+0xF3, 0x00, 0x73, 0x81, 0x33, 0x00, 0x73, 0x82, 0xF3, 0x80, 0x73, 0x80, 0x33, 0x80, 0x73, 0x87,
+0xF3, 0x80, 0x73, 0x80, 0x33, 0x80, 0x73, 0x82, 0xF3, 0x80, 0x73, 0x80, 0x33, 0x80, 0x73, 0x81,
+0xF0, 0x02, 0xE0, 0xC0, 0x80, 0x86, 0x00, 0x8B, 0x03, 0x00, 0x02, 0x9D, 0x00, 0x01, 0x3F, 0x7F,
+0x81, 0xFF, 0x02, 0xF9, 0xE0, 0xE0, 0x81, 0xC0, 0x05, 0xE0, 0xF0, 0xFF, 0xFF, 0xF0, 0xE0, 0x81,
+0xC0, 0x80, 0xE0, 0x00, 0xF9, 0x83, 0xFF, 0x80, 0xE0, 0x81, 0xC0, 0x05, 0xE0, 0xF0, 0xFF, 0xFF,
+0xF9, 0xE0, 0x82, 0xC0, 0x01, 0xE0, 0xF0, 0x85, 0xFF, 0x02, 0xF9, 0xE0, 0xE0, 0x81, 0xC0, 0x05,
+0xE0, 0xF0, 0xFF, 0xFF, 0xF0, 0xE0, 0x81, 0xC0, 0x80, 0xE0, 0x00, 0xF9, 0x81, 0xFF, 0x01, 0x7F,
+0x3F, 0xB2, 0x00, 0x0A, 0x80, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0x80, 0x84,
+0x00, 0x04, 0x80, 0xC0, 0xF0, 0xC0, 0x80, 0x81, 0x00, 0x01, 0x10, 0x70, 0x82, 0xF0, 0x06, 0xE0,
+0x80, 0xC0, 0x20, 0x10, 0x00, 0x00, 0x83, 0xF0, 0x80, 0x10, 0x04, 0x20, 0x40, 0x80, 0x00, 0x00,
+0x83, 0xF0, 0x82, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x83, 0xF0, 0x80, 0x00, 0x15, 0xF0, 0xE0, 0xE0,
+0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0x10, 0x10,
+0x20, 0x40, 0x80, 0xA1, 0x00, 0x09, 0x60, 0x1C, 0x07, 0x0F, 0x1F, 0x3F, 0x1F, 0x06, 0x06, 0x3F,
+0x81, 0x7F, 0x1A, 0x7C, 0x60, 0x40, 0x30, 0x28, 0x26, 0x23, 0x2F, 0x3F, 0x7F, 0x7F, 0x7E, 0x78,
+0x70, 0x40, 0x20, 0x18, 0x07, 0x0F, 0x1F, 0x7F, 0x7F, 0x7E, 0x78, 0x70, 0x40, 0x00, 0x83, 0x7F,
+0x80, 0x40, 0x06, 0x20, 0x10, 0x0F, 0x00, 0x00, 0x1F, 0x3F, 0x81, 0x7F, 0x81, 0x40, 0x03, 0x20,
+0x1F, 0x00, 0x00, 0x83, 0x7F, 0x80, 0x00, 0x15, 0x7F, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0x1F, 0x3F,
+0x3E, 0x7F, 0x00, 0x00, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x40, 0x40, 0x20, 0x10, 0x0F, 0xFF, 0x00,
+0x93, 0x00,
@@ -1,64 +1,24 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x70, 0x78, 0x7e, 
-0xee, 0xe7, 0xe3, 0xe3, 0x61, 0x61, 0x61, 0xe1, 0xe3, 0xe3, 0xe7, 0xef, 0x7e, 0x7c, 0x70, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-0xc0, 0xc0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xe0, 0xe0, 
-0xff, 0xff, 0xff, 0xff, 0xc0, 0x80, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf3, 0xf3, 0xf3, 0xf3, 0x73, 0x73, 0x73, 
-0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x80, 0x80, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 
-0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 
-0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8e, 0x8c, 
-0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 
-0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0x78, 0x3c, 0x1e, 
-0x0f, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x8f, 
-0x9e, 0xbc, 0xb8, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfe, 0xff, 0x87, 0x81, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 
-0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 
-0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xc3, 0xc3, 0x83, 0x03, 0x03, 0x03, 
-0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x3f, 0x3f, 0x31, 0x31, 0x30, 0x00, 0x00, 0x00, 
-0xf8, 0xfe, 0xff, 0xff, 0xff, 0xdf, 0x07, 0x03, 0xf1, 0xf8, 0xf8, 0xf8, 0xf8, 0xf1, 0x01, 0x03, 
-0x0f, 0xff, 0xff, 0xdf, 0x07, 0x03, 0xf1, 0xf9, 0xf8, 0xf8, 0xf8, 0xf1, 0x01, 0x03, 0x0f, 0xff, 
-0xff, 0xff, 0x07, 0x03, 0x61, 0xf9, 0xf8, 0xf8, 0xf8, 0xf9, 0x61, 0x03, 0x07, 0xff, 0xff, 0xff, 
-0x07, 0x03, 0x61, 0xf9, 0xf8, 0xf8, 0xf8, 0xf9, 0x61, 0x03, 0x07, 0xff, 0xff, 0xff, 0xfe, 0xf8, 
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7f, 0x3f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x07, 0x0f, 0x1f, 0x3f, 0x3f, 0x7e, 0x7c, 0x78, 0x71, 0x71, 0x71, 0x71, 0x78, 0x78, 0x7c, 
-0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7c, 0x78, 0x79, 0x71, 0x71, 0x71, 0x78, 0x78, 0x7c, 0x7f, 0x7f, 
-0x7f, 0x7f, 0x7e, 0x7c, 0x78, 0x79, 0x71, 0x71, 0x71, 0x78, 0x78, 0x7c, 0x7e, 0x7f, 0x7f, 0x7f, 
-0x7e, 0x7c, 0x78, 0x79, 0x71, 0x71, 0x71, 0x78, 0x78, 0x7c, 0x3e, 0x3f, 0x1f, 0x0f, 0x07, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x04, 0x04, 0x3c, 0x3c, 0x04, 0x3c, 
-0x3c, 0x00, 0x3c, 0x24, 0x3c, 0x3c, 0x00, 0x20, 0x14, 0x18, 0x18, 0x34, 0x00, 0x18, 0x3c, 0x24, 
-0x24, 0x3e, 0x3e, 0x00, 0x3c, 0x20, 0x20, 0x3c, 0x00, 0x3c, 0x3d, 0x00, 0x3c, 0x3c, 0x04, 0x04, 
-0x3c, 0x3c, 0x00, 0x3c, 0x24, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xA6, 0x00, 0x83, 0xE0, 0x06, 0x70, 0x78, 0x7E, 0xEE, 0xE7, 0xE3, 0xE3, 0x81, 0x61, 0x07, 0xE1,
+0xE3, 0xE3, 0xE7, 0xEF, 0x7E, 0x7C, 0x70, 0x82, 0xE0, 0x00, 0xC0, 0x8B, 0x80, 0x85, 0xC0, 0x86,
+0x80, 0x80, 0xC0, 0x85, 0xE0, 0xBD, 0x00, 0x83, 0xFF, 0x02, 0xF0, 0xE0, 0xE0, 0x82, 0xFF, 0x02,
+0xC0, 0x80, 0x80, 0x83, 0xFF, 0x81, 0xF0, 0x87, 0xFF, 0x00, 0xFB, 0x82, 0xF3, 0x82, 0x73, 0x85,
+0xFF, 0x86, 0x73, 0x87, 0xFF, 0xB6, 0x00, 0x80, 0x80, 0x83, 0x8C, 0xA4, 0x8F, 0x00, 0x8E, 0x84,
+0x8C, 0x88, 0x80, 0x80, 0x00, 0x84, 0x01, 0x01, 0x03, 0x01, 0xAF, 0x00, 0x07, 0x80, 0xC0, 0xE0,
+0x78, 0x3C, 0x1E, 0x0F, 0x03, 0x95, 0x01, 0xA3, 0x81, 0x08, 0x83, 0x8F, 0x9E, 0xBC, 0xB8, 0xF0,
+0xE0, 0xC0, 0x80, 0xAE, 0x00, 0x04, 0xFC, 0xFE, 0xFF, 0x87, 0x81, 0x85, 0x00, 0x02, 0x80, 0xC0,
+0xC0, 0x91, 0xE0, 0x9F, 0xE3, 0x80, 0xC3, 0x00, 0x83, 0x87, 0x03, 0x80, 0xFF, 0x00, 0xFE, 0xAC,
+0x00, 0x05, 0x1F, 0x3F, 0x3F, 0x31, 0x31, 0x30, 0x81, 0x00, 0x01, 0xF8, 0xFE, 0x81, 0xFF, 0x03,
+0xDF, 0x07, 0x03, 0xF1, 0x82, 0xF8, 0x0A, 0xF1, 0x01, 0x03, 0x0F, 0xFF, 0xFF, 0xDF, 0x07, 0x03,
+0xF1, 0xF9, 0x81, 0xF8, 0x03, 0xF1, 0x01, 0x03, 0x0F, 0x81, 0xFF, 0x03, 0x07, 0x03, 0x61, 0xF9,
+0x81, 0xF8, 0x03, 0xF9, 0x61, 0x03, 0x07, 0x81, 0xFF, 0x03, 0x07, 0x03, 0x61, 0xF9, 0x81, 0xF8,
+0x03, 0xF9, 0x61, 0x03, 0x07, 0x81, 0xFF, 0x01, 0xFE, 0xF8, 0x84, 0x60, 0x02, 0x7F, 0x3F, 0x1F,
+0xB5, 0x00, 0x08, 0x01, 0x07, 0x0F, 0x1F, 0x3F, 0x3F, 0x7E, 0x7C, 0x78, 0x82, 0x71, 0x80, 0x78,
+0x00, 0x7C, 0x82, 0x7F, 0x03, 0x7E, 0x7C, 0x78, 0x79, 0x81, 0x71, 0x80, 0x78, 0x00, 0x7C, 0x82,
+0x7F, 0x03, 0x7E, 0x7C, 0x78, 0x79, 0x81, 0x71, 0x80, 0x78, 0x01, 0x7C, 0x7E, 0x81, 0x7F, 0x03,
+0x7E, 0x7C, 0x78, 0x79, 0x81, 0x71, 0x80, 0x78, 0x06, 0x7C, 0x3E, 0x3F, 0x1F, 0x0F, 0x07, 0x01,
+0xC6, 0x00, 0x80, 0x3C, 0x80, 0x04, 0x80, 0x3C, 0x28, 0x04, 0x3C, 0x3C, 0x00, 0x3C, 0x24, 0x3C,
+0x3C, 0x00, 0x20, 0x14, 0x18, 0x18, 0x34, 0x00, 0x18, 0x3C, 0x24, 0x24, 0x3E, 0x3E, 0x00, 0x3C,
+0x20, 0x20, 0x3C, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x3C, 0x04, 0x04, 0x3C, 0x3C, 0x00, 0x3C, 0x24,
+0x24, 0x18, 0xA7, 0x00,
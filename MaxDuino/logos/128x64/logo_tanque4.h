@@ -1,64 +1,21 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 
-0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 
-0xc0, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 
-0xc0, 0xc0, 0xc0, 0xe0, 0xe0, 0xe0, 0xe0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x7f, 
-0x7f, 0x7f, 0x70, 0x70, 0x7f, 0x70, 0x70, 0x75, 0x70, 0x70, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x77, 0x67, 0x67, 0x6f, 0x6f, 0x2f, 0x0f, 0x0f, 0x07, 0x07, 
-0x07, 0x07, 0x07, 0x0f, 0x0f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 
-0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 
-0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 
-0xbe, 0xbe, 0xbe, 0xbc, 0xb8, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x7f, 0x7f, 0x4f, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x1f, 0x7f, 0x1f, 0x6f, 0x77, 
-0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-0x77, 0x77, 0x77, 0x77, 0x77, 0x6f, 0x0f, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf0, 0xff, 0xfe, 0xfc, 0xf8, 
-0xf0, 0xe0, 0xc0, 0x60, 0xf0, 0xf8, 0xfe, 0xff, 0xf0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 
-0xf8, 0xfc, 0xff, 0xfc, 0xf8, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0f, 0x1f, 0xff, 0xff, 
-0xff, 0xfe, 0xfc, 0xf0, 0xd0, 0x8c, 0x02, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x01, 0x01, 0x02, 0x02, 0x0c, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfe, 
-0xfe, 0xfc, 0xfc, 0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xff, 0x00, 0x00, 0xf0, 0xfc, 0xfe, 0xfe, 
-0xff, 0xff, 0x01, 0x01, 0x02, 0x02, 0x0c, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x07, 0x00, 0x01, 0x03, 0x07, 0x0f, 
-0x07, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x1f, 0x1f, 0x1f, 0x18, 0x10, 0x0c, 0x0b, 0x08, 0x08, 
-0x08, 0x0b, 0x0f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1c, 0x10, 0x10, 0x08, 0x06, 0x01, 0x00, 0x01, 
-0x03, 0x0f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1e, 0x1c, 0x10, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 
-0x10, 0x10, 0x08, 0x08, 0x06, 0x01, 0x00, 0x00, 0x07, 0x0f, 0x1f, 0x1f, 0x1f, 0x1f, 0x10, 0x10, 
-0x10, 0x08, 0x0c, 0x03, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x1f, 0x00, 
-0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0f, 0x0f, 0x1f, 0x00, 0x00, 0x01, 0x07, 0x0f, 0x0f, 
-0x1f, 0x1f, 0x10, 0x10, 0x08, 0x08, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xAD, 0x00, 0x8F, 0xE0, 0x01, 0xC0, 0x80, 0x8F, 0xC0, 0x82, 0xE0, 0x80, 0xF0, 0xD1, 0x00, 0x81,
+0x60, 0x81, 0x7F, 0x80, 0x70, 0x05, 0x7F, 0x70, 0x70, 0x75, 0x70, 0x70, 0x8A, 0x7F, 0x07, 0x77,
+0x67, 0x67, 0x6F, 0x6F, 0x2F, 0x0F, 0x0F, 0x83, 0x07, 0x80, 0x0F, 0x82, 0x1F, 0xC8, 0x00, 0x05,
+0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x8E, 0xFE, 0x98, 0xBE, 0x05, 0xBC, 0xB8, 0xF0, 0xE0, 0xC0,
+0x80, 0xC8, 0x00, 0x80, 0x7F, 0x00, 0x4F, 0x82, 0x77, 0x04, 0x6F, 0x1F, 0x7F, 0x1F, 0x6F, 0xA4,
+0x77, 0x03, 0x6F, 0x0F, 0x7F, 0x7F, 0xFF, 0x00, 0xAE, 0x00, 0x0F, 0x80, 0xF0, 0xFF, 0xFE, 0xFC,
+0xF8, 0xF0, 0xE0, 0xC0, 0x60, 0xF0, 0xF8, 0xFE, 0xFF, 0xF0, 0x80, 0x82, 0x00, 0x08, 0x80, 0x60,
+0xF8, 0xFC, 0xFF, 0xFC, 0xF8, 0xE0, 0x80, 0x81, 0x00, 0x03, 0x01, 0x03, 0x0F, 0x1F, 0x81, 0xFF,
+0x08, 0xFE, 0xFC, 0xF0, 0xD0, 0x8C, 0x02, 0x01, 0x00, 0x00, 0x84, 0xFF, 0x80, 0x01, 0x80, 0x02,
+0x03, 0x0C, 0xF0, 0x00, 0x00, 0x84, 0xFF, 0x83, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x84, 0xFF, 0x80,
+0x00, 0x19, 0xFF, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xFF, 0x00, 0x00,
+0xF0, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0x01, 0x01, 0x02, 0x02, 0x0C, 0xF0, 0x8F, 0x00, 0x08, 0x18,
+0x07, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x07, 0x01, 0x81, 0x00, 0x00, 0x0F, 0x82, 0x1F, 0x03, 0x18,
+0x10, 0x0C, 0x0B, 0x81, 0x08, 0x01, 0x0B, 0x0F, 0x82, 0x1F, 0x0A, 0x1E, 0x1C, 0x10, 0x10, 0x08,
+0x06, 0x01, 0x00, 0x01, 0x03, 0x0F, 0x82, 0x1F, 0x03, 0x1E, 0x1C, 0x10, 0x00, 0x84, 0x1F, 0x80,
+0x10, 0x80, 0x08, 0x05, 0x06, 0x01, 0x00, 0x00, 0x07, 0x0F, 0x82, 0x1F, 0x81, 0x10, 0x04, 0x08,
+0x0C, 0x03, 0x00, 0x00, 0x84, 0x1F, 0x80, 0x00, 0x19, 0x1F, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03,
+0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x10, 0x10, 0x08,
+0x08, 0x06, 0x01, 0xFF, 0x00, 0x85, 0x00,
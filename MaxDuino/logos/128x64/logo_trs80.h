@@ -1,103 +1,30 @@
-0x00, 0xFE, 0xFE, 0xFE, 0x1E, 0x0E, 0x06, 0x06, 0x06, 0x06,
-0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-0x06, 0x06, 0x0E, 0x1E, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xEE, 0x4E,
-0xCE, 0xFE, 0xFE, 0x9E, 0x0C, 0xC0, 0xE8, 0xB8, 0xB8, 0xB8,
-0xF8, 0xF8, 0xF8, 0x20, 0x70, 0xF8, 0xF8, 0xB8, 0xB8, 0xBC,
-0xFE, 0xFE, 0xFE, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x20, 0x70,
-0xF8, 0xF8, 0xBC, 0xBC, 0xBC, 0xF8, 0xF8, 0xF0, 0x20, 0x00,
-0x00, 0x00, 0xC0, 0xC0, 0xF8, 0xFE, 0xFE, 0x7E, 0x06, 0x06,
-0x06, 0xFE, 0xFE, 0xFE, 0x1C, 0xF8, 0xF8, 0xF8, 0xF8, 0x40,
-0xE8, 0xF8, 0xB8, 0xB8, 0xB8, 0xF8, 0xF8, 0xF8, 0x00, 0x70,
-0xF8, 0xF8, 0xBC, 0xBC, 0xBC, 0xB8, 0xB8, 0x30, 0x20, 0xFE,
-0xFE, 0xFE, 0x70, 0xF8, 0xF8, 0xF8, 0x88, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-0xF0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81,
-0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81,
-0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81,
-0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81,
-0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xF0,
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xEF, 0xEF, 0xEF, 0x0F, 0x0F, 0xEF, 0xEF, 0xEF, 0xEF,
-0xFF, 0x0F, 0x0F, 0x0F, 0xAF, 0xAF, 0xAF, 0xAF, 0x2F, 0x0F,
-0x0F, 0xFF, 0xFF, 0x4F, 0x0F, 0x0F, 0xA7, 0xA7, 0xA7, 0xA7,
-0x0F, 0x0F, 0x3F, 0xFF, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xFF,
-0xFF, 0x0F, 0x0F, 0xA7, 0xA7, 0xA7, 0xA7, 0x0F, 0x0F, 0x6F,
-0xFF, 0x0F, 0x0F, 0x6F, 0x67, 0x67, 0x67, 0x67, 0x0F, 0x0F,
-0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F, 0x1F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-0x1F, 0x1F, 0x1E, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-0x1E, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1E, 0x1F,
-0x1F, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
-0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E,
-0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x1F,
-0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-0x1F, 0x1F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x3C, 0x7C, 0x6C, 0x44, 0x44, 0x44, 0x44,
-0x64, 0x6C, 0x20, 0x38, 0x7C, 0x7C, 0x44, 0x44, 0x44, 0x44,
-0x44, 0x6C, 0x7C, 0x38, 0x3C, 0x7C, 0x7C, 0x40, 0x40, 0x40,
-0x40, 0x40, 0x18, 0x7C, 0x7C, 0x44, 0x44, 0x44, 0x44, 0x44,
-0x6C, 0x7C, 0x38, 0x00, 0x3C, 0x7C, 0x60, 0x40, 0x40, 0x40,
-0x40, 0x7C, 0x7C, 0x1C, 0x7C, 0x7C, 0x34, 0x34, 0x34, 0x34,
-0x34, 0x7C, 0x7C, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xF8, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD8, 0xD8, 0x00,
-0x70, 0xF8, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x88, 0xF8, 0xF8,
-0x70, 0xF0, 0xF8, 0xF8, 0x18, 0x70, 0xE0, 0xC0, 0xC0, 0x60,
-0x38, 0x18, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0x78, 0x48, 0x48,
-0x48, 0x48, 0x78, 0x78, 0x00, 0x78, 0xF8, 0xC0, 0x80, 0x80,
-0x80, 0x80, 0xC0, 0xF8, 0xF8, 0x00, 0x08, 0x08, 0x08, 0xF8,
-0xF8, 0x18, 0x08, 0x08, 0x08, 0xF8, 0xF8, 0xF8, 0xA8, 0xA8,
-0xA8, 0xA8, 0xA8, 0x88, 0xF8, 0xF8, 0xF8, 0x48, 0x48, 0x48,
-0x48, 0xF8, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F,
-0x78, 0x70, 0x70, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x70, 0x78, 0x7C,
-0x7F, 0x7F, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x00, 0x00, 0x81, 0xFE, 0x01, 0x1E, 0x0E, 0xF2, 0x06, 0x03, 0x0E, 0x1E, 0xFE, 0xFE, 0x81, 0x00,
+0x81, 0xFF, 0x8C, 0x00, 0x80, 0xFE, 0x08, 0xEE, 0x4E, 0xCE, 0xFE, 0xFE, 0x9E, 0x0C, 0xC0, 0xE8,
+0x81, 0xB8, 0x81, 0xF8, 0x06, 0x20, 0x70, 0xF8, 0xF8, 0xB8, 0xB8, 0xBC, 0x81, 0xFE, 0x00, 0x00,
+0x82, 0xF8, 0x03, 0x20, 0x70, 0xF8, 0xF8, 0x81, 0xBC, 0x80, 0xF8, 0x01, 0xF0, 0x20, 0x81, 0x00,
+0x80, 0xC0, 0x03, 0xF8, 0xFE, 0xFE, 0x7E, 0x81, 0x06, 0x81, 0xFE, 0x00, 0x1C, 0x82, 0xF8, 0x02,
+0x40, 0xE8, 0xF8, 0x81, 0xB8, 0x81, 0xF8, 0x03, 0x00, 0x70, 0xF8, 0xF8, 0x81, 0xBC, 0x80, 0xB8,
+0x01, 0x30, 0x20, 0x81, 0xFE, 0x00, 0x70, 0x81, 0xF8, 0x00, 0x88, 0x8D, 0x00, 0x80, 0xFF, 0x81,
+0x00, 0x81, 0xFF, 0x02, 0xF0, 0xC0, 0xC0, 0x89, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81,
+0x80, 0x84, 0x81, 0x82, 0x80, 0x84, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x83, 0x81, 0x84,
+0x80, 0x81, 0x81, 0x84, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x85, 0x81, 0x81,
+0x80, 0x83, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x82, 0x81, 0x89, 0x80, 0x80, 0xC0, 0x02,
+0xF0, 0xFF, 0xFF, 0x81, 0x00, 0xA2, 0xFF, 0x81, 0xEF, 0x80, 0x0F, 0x82, 0xEF, 0x00, 0xFF, 0x81,
+0x0F, 0x82, 0xAF, 0x07, 0x2F, 0x0F, 0x0F, 0xFF, 0xFF, 0x4F, 0x0F, 0x0F, 0x82, 0xA7, 0x80, 0x0F,
+0x01, 0x3F, 0xFF, 0x83, 0x9F, 0x80, 0xFF, 0x80, 0x0F, 0x82, 0xA7, 0x80, 0x0F, 0x04, 0x6F, 0xFF,
+0x0F, 0x0F, 0x6F, 0x82, 0x67, 0x80, 0x0F, 0x00, 0x1F, 0x9B, 0xFF, 0x81, 0x00, 0x81, 0xFF, 0x02,
+0x7F, 0x3F, 0x3F, 0x9F, 0x1F, 0x80, 0x1E, 0x84, 0x1F, 0x80, 0x1E, 0x83, 0x1F, 0x80, 0x1E, 0x81,
+0x1F, 0x86, 0x1E, 0x87, 0x1F, 0x86, 0x1E, 0x81, 0x1F, 0x86, 0x1E, 0x97, 0x1F, 0x01, 0x3F, 0x7F,
+0x81, 0xFF, 0x81, 0x00, 0x81, 0xFF, 0x9B, 0x00, 0x02, 0x3C, 0x7C, 0x6C, 0x82, 0x44, 0x05, 0x64,
+0x6C, 0x20, 0x38, 0x7C, 0x7C, 0x83, 0x44, 0x05, 0x6C, 0x7C, 0x38, 0x3C, 0x7C, 0x7C, 0x83, 0x40,
+0x02, 0x18, 0x7C, 0x7C, 0x83, 0x44, 0x06, 0x6C, 0x7C, 0x38, 0x00, 0x3C, 0x7C, 0x60, 0x82, 0x40,
+0x80, 0x7C, 0x02, 0x1C, 0x7C, 0x7C, 0x83, 0x34, 0x80, 0x7C, 0x00, 0x6C, 0x9C, 0x00, 0x80, 0xFF,
+0x81, 0x00, 0x81, 0xFF, 0x90, 0x00, 0x80, 0xF8, 0x83, 0x88, 0x80, 0xD8, 0x03, 0x00, 0x70, 0xF8,
+0xF8, 0x83, 0x88, 0x80, 0xF8, 0x11, 0x70, 0xF0, 0xF8, 0xF8, 0x18, 0x70, 0xE0, 0xC0, 0xC0, 0x60,
+0x38, 0x18, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0x78, 0x82, 0x48, 0x80, 0x78, 0x03, 0x00, 0x78, 0xF8,
+0xC0, 0x82, 0x80, 0x03, 0xC0, 0xF8, 0xF8, 0x00, 0x81, 0x08, 0x80, 0xF8, 0x00, 0x18, 0x81, 0x08,
+0x81, 0xF8, 0x83, 0xA8, 0x00, 0x88, 0x81, 0xF8, 0x82, 0x48, 0x80, 0xF8, 0x00, 0xF0, 0x90, 0x00,
+0x80, 0xFF, 0x81, 0x00, 0x81, 0x7F, 0x02, 0x78, 0x70, 0x70, 0xF0, 0x60, 0x06, 0x70, 0x78, 0x7C,
+0x7F, 0x7F, 0x00, 0x00,
@@ -1,103 +1,25 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xF8,
-0xE0, 0x00, 0x00, 0x00, 0xE0, 0xFC, 0xFE, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x80, 0xF0, 0xFE, 0xFF, 0xFF, 0xFF, 0x9E,
-0x00, 0x03, 0x0F, 0x3E, 0x7C, 0xB0, 0xE0, 0xF8, 0x7C, 0x1F,
-0x07, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x0E,
-0x0E, 0x1C, 0xFC, 0xF8, 0xE0, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF,
-0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0x80, 0x00, 0xFF,
-0xFF, 0xFF, 0x00, 0xE0, 0xF0, 0xFC, 0xFC, 0x3E, 0x1E, 0x0F,
-0x0F, 0x0F, 0x1F, 0x1E, 0x7E, 0xFC, 0xF8, 0xF0, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x03, 0x07, 0x1F, 0x3F,
-0xFE, 0x3F, 0x0F, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xF0,
-0xFE, 0x7F, 0x0F, 0x01, 0x00, 0x3F, 0x3F, 0x1F, 0x00, 0xC0,
-0xE0, 0xF8, 0x3E, 0x0F, 0x07, 0x1C, 0x7C, 0xF0, 0xE0, 0x80,
-0x00, 0x1F, 0x3F, 0x13, 0x40, 0xE0, 0xE0, 0xE0, 0x70, 0x78,
-0x3F, 0x1F, 0x0F, 0x00, 0x03, 0x0F, 0x1F, 0x1C, 0x1C, 0x38,
-0x3C, 0x1C, 0x1F, 0x0F, 0x07, 0x03, 0x1F, 0x3F, 0x3F, 0xFF,
-0xFF, 0xFF, 0x00, 0x01, 0x07, 0x1F, 0x3F, 0xFF, 0xFF, 0xFF,
-0x00, 0x07, 0x1F, 0x3F, 0x3F, 0x18, 0xC0, 0xE0, 0xF0, 0xF0,
-0xF0, 0xF8, 0x7E, 0x3F, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
-0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
-0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x80,
-0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xC0,
-0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x80, 0xC0, 0xC0, 0xC0,
-0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1,
-0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01,
-0x01, 0x01, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFE,
-0xFF, 0xFF, 0x0F, 0x0F, 0x7F, 0xFE, 0xF8, 0xE0, 0xF0, 0xFC,
-0xFF, 0x3F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x33, 0x37, 0x3F, 0x3F, 0x3E, 0x7C, 0xF8, 0xF1, 0xE1, 0xC1,
-0x81, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01,
-0x01, 0x01, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xDD, 0x9D, 0x9D,
-0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0xDD, 0x9D, 0x9D, 0x9D, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
-0x01, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00,
-0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
-0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xFF, 0x00, 0x8F, 0x00, 0x80, 0xFF, 0x02, 0xFE, 0xF8, 0xE0, 0x81, 0x00, 0x04, 0xE0, 0xFC, 0xFE,
+0xFF, 0xFF, 0x82, 0x00, 0x02, 0x80, 0xF0, 0xFE, 0x81, 0xFF, 0x0D, 0x9E, 0x00, 0x03, 0x0F, 0x3E,
+0x7C, 0xB0, 0xE0, 0xF8, 0x7C, 0x1F, 0x07, 0x00, 0x00, 0x81, 0xFF, 0x81, 0x07, 0x80, 0x0E, 0x07,
+0x1C, 0xFC, 0xF8, 0xE0, 0x00, 0xFF, 0xFF, 0xFE, 0x84, 0x00, 0x80, 0xFF, 0x00, 0xBE, 0x81, 0xFF,
+0x07, 0xFE, 0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0x80, 0x00, 0x81, 0xFF, 0x06, 0x00, 0xE0, 0xF0, 0xFC,
+0xFC, 0x3E, 0x1E, 0x81, 0x0F, 0x05, 0x1F, 0x1E, 0x7E, 0xFC, 0xF8, 0xF0, 0xA2, 0x00, 0x09, 0x0F,
+0x1F, 0x03, 0x07, 0x1F, 0x3F, 0xFE, 0x3F, 0x0F, 0x07, 0x81, 0xFF, 0x1B, 0x00, 0x80, 0xF0, 0xFE,
+0x7F, 0x0F, 0x01, 0x00, 0x3F, 0x3F, 0x1F, 0x00, 0xC0, 0xE0, 0xF8, 0x3E, 0x0F, 0x07, 0x1C, 0x7C,
+0xF0, 0xE0, 0x80, 0x00, 0x1F, 0x3F, 0x13, 0x40, 0x81, 0xE0, 0x14, 0x70, 0x78, 0x3F, 0x1F, 0x0F,
+0x00, 0x03, 0x0F, 0x1F, 0x1C, 0x1C, 0x38, 0x3C, 0x1C, 0x1F, 0x0F, 0x07, 0x03, 0x1F, 0x3F, 0x3F,
+0x81, 0xFF, 0x04, 0x00, 0x01, 0x07, 0x1F, 0x3F, 0x81, 0xFF, 0x07, 0x00, 0x07, 0x1F, 0x3F, 0x3F,
+0x18, 0xC0, 0xE0, 0x81, 0xF0, 0x04, 0xF8, 0x7E, 0x3F, 0x1F, 0x0F, 0xEC, 0x00, 0x01, 0x03, 0x07,
+0xAA, 0x00, 0x82, 0xC0, 0x87, 0x00, 0x81, 0xC0, 0x80, 0x00, 0x81, 0xC0, 0x84, 0x00, 0x8E, 0xC0,
+0x80, 0x00, 0x81, 0xC0, 0x80, 0x00, 0x00, 0x80, 0x81, 0xC0, 0x00, 0x80, 0x84, 0x00, 0x00, 0x80,
+0x81, 0xC0, 0x02, 0x80, 0x00, 0x80, 0x82, 0xC0, 0x00, 0x80, 0x81, 0x00, 0x8F, 0xC0, 0x01, 0x00,
+0x80, 0x8C, 0xC0, 0x91, 0x00, 0x00, 0x7F, 0x81, 0xFF, 0x87, 0xC0, 0x81, 0xFF, 0x80, 0x00, 0x81,
+0xFF, 0x85, 0xC0, 0x80, 0xC1, 0x82, 0x01, 0x81, 0xFF, 0x84, 0x01, 0x80, 0x00, 0x81, 0xFF, 0x0E,
+0x00, 0xFE, 0xFF, 0xFF, 0x0F, 0x0F, 0x7F, 0xFE, 0xF8, 0xE0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x85,
+0xFF, 0x0C, 0x33, 0x37, 0x3F, 0x3F, 0x3E, 0x7C, 0xF8, 0xF1, 0xE1, 0xC1, 0x81, 0x01, 0x01, 0x81,
+0xFF, 0x84, 0x01, 0x01, 0x00, 0x7E, 0x81, 0xFF, 0x00, 0xDD, 0x85, 0x9D, 0x00, 0xDD, 0x81, 0x9D,
+0x93, 0x00, 0x8B, 0x01, 0x82, 0x00, 0x89, 0x01, 0x82, 0x00, 0x81, 0x01, 0x86, 0x00, 0x81, 0x01,
+0x00, 0x00, 0x82, 0x01, 0x80, 0x00, 0x00, 0x01, 0x81, 0x03, 0x00, 0x01, 0x81, 0x00, 0x85, 0x01,
+0x85, 0x00, 0x83, 0x01, 0x00, 0x00, 0x81, 0x01, 0x87, 0x00, 0x8C, 0x01, 0xFF, 0x00, 0x86, 0x00,
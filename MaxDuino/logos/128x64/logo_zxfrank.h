@@ -1,103 +1,21 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xE0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC,
-0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
-0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
-0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8,
-0xF0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF,
-0xFF, 0xFF, 0x3F, 0x07, 0x07, 0x0F, 0x1D, 0x19, 0xB9, 0xF0,
-0xE0, 0xE0, 0xF0, 0xB0, 0x10, 0x00, 0x00, 0x80, 0x80, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-0x01, 0x01, 0x01, 0x03, 0x03, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x7C, 0xFE, 0xC4,
-0x4C, 0xCC, 0xC4, 0xCC, 0x46, 0x06, 0xC4, 0xFC, 0xFC, 0x60,
-0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xFF, 0xFF, 0xFF,
-0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
-0x09, 0x1F, 0x0F, 0x0F, 0x0F, 0x1F, 0x19, 0x38, 0x10, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xE0, 0xC0,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFE, 0xC6, 0x0C, 0x1C,
-0x7C, 0xFC, 0x3C, 0x0C, 0xCC, 0xFC, 0xFC, 0x38, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xFC, 0x3F, 0x0F,
-0xC3, 0xF1, 0xF8, 0xDE, 0xDF, 0x03, 0x03, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x1F, 0x7F, 0xFF, 0xFF, 0xE0, 0xC0, 0x80, 0x80,
-0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07,
-0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07,
-0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x00, 0x00, 0x00,
-0x00, 0x80, 0x80, 0xC0, 0xF1, 0xFF, 0xFF, 0x3F, 0x0E, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x83, 0xF7, 0x7F, 0x0E, 0x80, 0x80,
-0x0C, 0x3E, 0xFF, 0xD3, 0xC1, 0x80, 0x80, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x09, 0x1F, 0x1B, 0x10, 0x10, 0x18, 0x19, 0x11,
-0x11, 0x11, 0x19, 0x3F, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08,
-0x08, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0E, 0x0E, 0x0E,
-0x0E, 0x06, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xFF, 0xFF,
-0xFF, 0x1F, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x08, 0x1E, 0x1F, 0x18, 0x18, 0x1A, 0x1F, 0x1F, 0x1E, 0x38,
-0x30, 0x3F, 0x1F, 0x0D, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07, 0x0F, 0x0F,
-0x1E, 0x1C, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x38, 0x30, 0x70,
-0x78, 0x78, 0x78, 0x78, 0x30, 0x38, 0x38, 0x38, 0x38, 0x3C,
-0x1C, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 1024 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xFF, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0xF0, 0x81, 0xF8, 0x9D, 0xFC, 0x81, 0xF8, 0x01, 0xF0, 0xE0,
+0xD4, 0x00, 0x00, 0xF1, 0x81, 0xFF, 0x10, 0x3F, 0x07, 0x07, 0x0F, 0x1D, 0x19, 0xB9, 0xF0, 0xE0,
+0xE0, 0xF0, 0xB0, 0x10, 0x00, 0x00, 0x80, 0x80, 0x88, 0x00, 0x82, 0x01, 0x80, 0x03, 0x01, 0x0F,
+0x7F, 0x81, 0xFF, 0xBF, 0x00, 0x80, 0x40, 0x0C, 0x7C, 0xFE, 0xC4, 0x4C, 0xCC, 0xC4, 0xCC, 0x46,
+0x06, 0xC4, 0xFC, 0xFC, 0x60, 0x82, 0x00, 0x02, 0x80, 0xC0, 0xE0, 0x81, 0xFF, 0x00, 0xF0, 0x83,
+0x00, 0x80, 0x01, 0x80, 0x00, 0x01, 0x09, 0x1F, 0x81, 0x0F, 0x03, 0x1F, 0x19, 0x38, 0x10, 0x8D,
+0x00, 0x00, 0xF0, 0x81, 0xFF, 0x01, 0xE0, 0xC0, 0x83, 0x00, 0x0C, 0x7E, 0xFE, 0xC6, 0x0C, 0x1C,
+0x7C, 0xFC, 0x3C, 0x0C, 0xCC, 0xFC, 0xFC, 0x38, 0xAD, 0x00, 0x80, 0xE0, 0x09, 0xFC, 0x3F, 0x0F,
+0xC3, 0xF1, 0xF8, 0xDE, 0xDF, 0x03, 0x03, 0x83, 0x00, 0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xE0, 0xC0,
+0x80, 0x80, 0x82, 0x00, 0x00, 0x03, 0x84, 0x07, 0x01, 0x03, 0x01, 0x83, 0x00, 0x00, 0x03, 0x85,
+0x07, 0x00, 0x01, 0x82, 0x00, 0x80, 0x80, 0x05, 0xC0, 0xF1, 0xFF, 0xFF, 0x3F, 0x0E, 0x83, 0x00,
+0x0C, 0x83, 0xF7, 0x7F, 0x0E, 0x80, 0x80, 0x0C, 0x3E, 0xFF, 0xD3, 0xC1, 0x80, 0x80, 0xAB, 0x00,
+0x06, 0x09, 0x1F, 0x1B, 0x10, 0x10, 0x18, 0x19, 0x81, 0x11, 0x02, 0x19, 0x3F, 0x0E, 0x86, 0x00,
+0x02, 0x01, 0x03, 0x3F, 0x81, 0xFF, 0x01, 0xC0, 0x80, 0x85, 0x00, 0x81, 0x08, 0x84, 0x0C, 0x82,
+0x0E, 0x00, 0x06, 0x82, 0x00, 0x01, 0x80, 0xE0, 0x81, 0xFF, 0x02, 0x1F, 0x01, 0x01, 0x84, 0x00,
+0x0F, 0x08, 0x1E, 0x1F, 0x18, 0x18, 0x1A, 0x1F, 0x1F, 0x1E, 0x38, 0x30, 0x3F, 0x1F, 0x0D, 0x18,
+0x10, 0xC3, 0x00, 0x07, 0x01, 0x07, 0x07, 0x0F, 0x0F, 0x1E, 0x1C, 0x3C, 0x83, 0x38, 0x01, 0x30,
+0x70, 0x82, 0x78, 0x00, 0x30, 0x82, 0x38, 0x08, 0x3C, 0x1C, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03,
+0x01, 0xFF, 0x00, 0xAD, 0x00,
@@ -1,32 +1,14 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x60, 0x20, 0x20, 0x60, 0xE0, 0xE0, 0x20, 0x20, 0x20, 
-0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-0x20, 0x20, 0xE0, 0x60, 0x20, 0x20, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0x7C, 0x3E, 
-0xFE, 0xFE, 0xFE, 0xE0, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xE0, 0xE0, 0x60, 0x60, 0x60, 0x20, 0x00, 
-0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0xFC, 0xFE, 0xFE, 0x0E, 0x80, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 
-0x00, 0xE0, 0xE0, 0x60, 0x00, 0xE4, 0xEE, 0xFE, 0x26, 0x00, 0xFF, 0x00, 0x00, 0xC0, 0xF0, 0x78, 
-0x19, 0x1B, 0x0F, 0x0B, 0x1B, 0x1B, 0x73, 0xE3, 0xC3, 0x03, 0x03, 0x03, 0x03, 0xC3, 0xE3, 0x73,
-0x3B, 0x1B, 0x1F, 0x0F, 0x1A, 0x1B, 0x79, 0xF0, 0xC0, 0x00, 0x00, 0xFF, 0x20, 0x38, 0x3E, 0x1F, 
-0x0F, 0x0F, 0x0C, 0x0C, 0x0F, 0x3F, 0x3F, 0x3F, 0x3C, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x03, 0x00,
-0x00, 0x00, 0x00, 0x1F, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x3F, 0x03, 0x00, 0x1F, 0x3F, 
-0x3F, 0x31, 0x30, 0x30, 0x3C, 0x3F, 0x1F, 0x00, 0x3C, 0x3F, 0x3F, 0x0F, 0x00, 0x00, 0xFF, 0x00, 
-0x00, 0x07, 0x0F, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1C, 0x0F, 0x03, 0x00, 0x00, 0x00, 
-0x00, 0x03, 0x0F, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1C, 0x0F, 0x07, 0x00, 0x00, 0xFF, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 
-0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 
-0x06, 0x06, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 504 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0xFF, 0x00, 0x83, 0x00, 0x06, 0xC0, 0x60, 0x20, 0x20, 0x60, 0xE0, 0xE0, 0x93, 0x20, 0x05, 0xE0,
+0x60, 0x20, 0x20, 0x60, 0xC0, 0x81, 0x00, 0x04, 0x80, 0xC0, 0xF0, 0x7C, 0x3E, 0x81, 0xFE, 0x00,
+0xE0, 0x81, 0x00, 0x00, 0x80, 0x81, 0xE0, 0x81, 0x60, 0x03, 0x20, 0x00, 0xC0, 0xE0, 0x82, 0x60,
+0x04, 0xFC, 0xFE, 0xFE, 0x0E, 0x80, 0x81, 0xE0, 0x81, 0x00, 0x80, 0xE0, 0x15, 0x60, 0x00, 0xE4,
+0xEE, 0xFE, 0x26, 0x00, 0xFF, 0x00, 0x00, 0xC0, 0xF0, 0x78, 0x19, 0x1B, 0x0F, 0x0B, 0x1B, 0x1B,
+0x73, 0xE3, 0xC3, 0x82, 0x03, 0x17, 0xC3, 0xE3, 0x73, 0x3B, 0x1B, 0x1F, 0x0F, 0x1A, 0x1B, 0x79,
+0xF0, 0xC0, 0x00, 0x00, 0xFF, 0x20, 0x38, 0x3E, 0x1F, 0x0F, 0x0F, 0x0C, 0x0C, 0x0F, 0x81, 0x3F,
+0x02, 0x3C, 0x00, 0x00, 0x81, 0x3F, 0x00, 0x03, 0x82, 0x00, 0x02, 0x1F, 0x3F, 0x3F, 0x81, 0x30,
+0x81, 0x3F, 0x18, 0x03, 0x00, 0x1F, 0x3F, 0x3F, 0x31, 0x30, 0x30, 0x3C, 0x3F, 0x1F, 0x00, 0x3C,
+0x3F, 0x3F, 0x0F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0x0F, 0x1C, 0x38, 0x82, 0x30, 0x03, 0x38,
+0x1C, 0x0F, 0x03, 0x82, 0x00, 0x03, 0x03, 0x0F, 0x1C, 0x38, 0x82, 0x30, 0x06, 0x38, 0x1C, 0x0F,
+0x07, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x01, 0x01, 0x03, 0x9C, 0x06, 0x01, 0x02, 0x01, 0xD2, 0x00,
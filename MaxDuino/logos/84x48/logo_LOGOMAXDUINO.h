@@ -1,32 +1,25 @@
-0x00, 0x00, 0x00, 0x60, 0xB8, 0x44, 0x5A, 0x2D, 0x2E, 0x95, 0x93, 0x16, 0x96, 0x94, 0x10, 0x10,
-0x20, 0x20, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xE6, 0xF9, 0xF0, 0xF8, 0x78, 0xFC, 0xF0, 0xF1, 0xE0, 0xE7,
-0xE6, 0x31, 0xF8, 0xF4, 0xE2, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x04, 0xE5,
-0x8D, 0x71, 0x87, 0xC0, 0x30, 0x8C, 0xE4, 0x04, 0xFD, 0x01, 0x03, 0x80, 0x70, 0x0C, 0xC4, 0x74,
-0x8D, 0x71, 0x83, 0x00, 0x30, 0x80, 0x3C, 0xC4, 0x19, 0x21, 0x62, 0x18, 0xC4, 0x24, 0x1D, 0x01,
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x1E, 0x3D, 0x31, 0x4C, 0x7B, 0x7B,
-0xF7, 0xF7, 0x07, 0x7B, 0x7B, 0x1B, 0x00, 0x01, 0x02, 0x07, 0x07, 0x0E, 0x0C, 0x00, 0x00, 0x00,
-0x00, 0x7F, 0x40, 0x7F, 0x03, 0x1C, 0x61, 0x61, 0x1C, 0x03, 0x7F, 0x40, 0x7F, 0x20, 0x5C, 0x63,
-0x18, 0x0B, 0x0A, 0x0A, 0x0B, 0x18, 0x63, 0x5C, 0x20, 0x61, 0x58, 0x46, 0x31, 0x08, 0x0C, 0x31,
-0x46, 0x48, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x02, 0x2C, 0x44, 0x04,
-0x44, 0x24, 0x0C, 0x06, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x1C, 0x1B, 0x3B, 0x28, 0x66, 0x66, 0x36, 0x0D, 0x18, 0x1C, 0x1C, 0xC0, 0x40, 0x40, 0x50, 0x50,
-0x50, 0x50, 0x50, 0x90, 0x10, 0x20, 0x40, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x80,
-0x00, 0xE0, 0xA0, 0xE8, 0x08, 0x38, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7,
-0xE8, 0xE7, 0x4A, 0xCA, 0x4F, 0xE7, 0xE0, 0xD0, 0x64, 0xEB, 0xE8, 0xD0, 0x20, 0xC0, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-0x00, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x82, 0x7C, 0x01, 0xFE, 0x00, 0xFE, 0x02, 0xFE, 0x00, 0x00,
+// 504 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x81, 0x00, 0x0F, 0x60, 0xB8, 0x44, 0x5A, 0x2D, 0x2E, 0x95, 0x93, 0x16, 0x96, 0x94, 0x10, 0x10,
+0x20, 0x20, 0xC0, 0xC0, 0x00, 0x10, 0x40, 0xE6, 0xF9, 0xF0, 0xF8, 0x78, 0xFC, 0xF0, 0xF1, 0xE0,
+0xE7, 0xE6, 0x31, 0xF8, 0xF4, 0xE2, 0x41, 0x85, 0x00, 0x23, 0xFC, 0x04, 0xE5, 0x8D, 0x71, 0x87,
+0xC0, 0x30, 0x8C, 0xE4, 0x04, 0xFD, 0x01, 0x03, 0x80, 0x70, 0x0C, 0xC4, 0x74, 0x8D, 0x71, 0x83,
+0x00, 0x30, 0x80, 0x3C, 0xC4, 0x19, 0x21, 0x62, 0x18, 0xC4, 0x24, 0x1D, 0x01, 0x01, 0x95, 0x00,
+0x14, 0x01, 0x0F, 0x1E, 0x3D, 0x31, 0x4C, 0x7B, 0x7B, 0xF7, 0xF7, 0x07, 0x7B, 0x7B, 0x1B, 0x00,
+0x01, 0x02, 0x07, 0x07, 0x0E, 0x0C, 0x82, 0x00, 0x21, 0x7F, 0x40, 0x7F, 0x03, 0x1C, 0x61, 0x61,
+0x1C, 0x03, 0x7F, 0x40, 0x7F, 0x20, 0x5C, 0x63, 0x18, 0x0B, 0x0A, 0x0A, 0x0B, 0x18, 0x63, 0x5C,
+0x20, 0x61, 0x58, 0x46, 0x31, 0x08, 0x0C, 0x31, 0x46, 0x48, 0x70, 0x86, 0x00, 0x0A, 0xFE, 0x02,
+0x2C, 0x44, 0x04, 0x44, 0x24, 0x0C, 0x06, 0x02, 0xFC, 0x88, 0x00, 0x0D, 0x1C, 0x1B, 0x3B, 0x28,
+0x66, 0x66, 0x36, 0x0D, 0x18, 0x1C, 0x1C, 0xC0, 0x40, 0x40, 0x83, 0x50, 0x05, 0x90, 0x10, 0x20,
+0x40, 0x00, 0x00, 0x82, 0x80, 0x80, 0x00, 0x08, 0x80, 0x00, 0xE0, 0xA0, 0xE8, 0x08, 0x38, 0x00,
+0x00, 0x83, 0x80, 0x83, 0x00, 0x80, 0x80, 0x82, 0x40, 0x00, 0x80, 0x84, 0x00, 0x0E, 0xD7, 0xE8,
+0xE7, 0x4A, 0xCA, 0x4F, 0xE7, 0xE0, 0xD0, 0x64, 0xEB, 0xE8, 0xD0, 0x20, 0xC0, 0x8F, 0x00, 0x02,
+0xFF, 0x00, 0xFF, 0x82, 0x01, 0x3D, 0x82, 0x7C, 0x01, 0xFE, 0x00, 0xFE, 0x02, 0xFE, 0x00, 0x00,
 0x80, 0xFE, 0x02, 0xFE, 0x00, 0xFE, 0x02, 0xFE, 0x00, 0xFE, 0x02, 0xF6, 0x1A, 0x0A, 0x0A, 0xF2,
 0x04, 0xF9, 0x02, 0xF0, 0x0C, 0xF4, 0x9A, 0x0A, 0x9A, 0xF2, 0x0C, 0xF0, 0x01, 0x3E, 0x00, 0x00,
 0x10, 0xB8, 0x1B, 0x07, 0x01, 0xCE, 0x9E, 0x9C, 0x1E, 0x1E, 0x9F, 0xCF, 0x87, 0x30, 0x77, 0x2F,
-0x0F, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x07, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x02, 0x01, 0x00, 0x00, 0x03,
-0x06, 0x04, 0x05, 0x05, 0x05, 0x06, 0x04, 0x07, 0x00, 0x07, 0x04, 0x07, 0x00, 0x07, 0x04, 0x07,
-0x00, 0x00, 0x00, 0x07, 0x04, 0x07, 0x00, 0x00, 0x03, 0x02, 0x05, 0x05, 0x05, 0x04, 0x03, 0x00,
-0x00, 0x00, 0x00, 0x08, 0x14, 0x13, 0x68, 0x74, 0x38, 0x37, 0x1F, 0x18, 0xC4, 0xE0, 0x6F, 0x7F,
-0x30, 0x08, 0x10, 0x58, 0xB0, 0x80, 0x40, 0x3F
\ No newline at end of file
+0x0F, 0x00, 0x07, 0xFC, 0x8D, 0x00, 0x01, 0x07, 0x04, 0x83, 0x05, 0x07, 0x04, 0x02, 0x01, 0x00,
+0x00, 0x03, 0x06, 0x04, 0x81, 0x05, 0x0A, 0x06, 0x04, 0x07, 0x00, 0x07, 0x04, 0x07, 0x00, 0x07,
+0x04, 0x07, 0x81, 0x00, 0x06, 0x07, 0x04, 0x07, 0x00, 0x00, 0x03, 0x02, 0x81, 0x05, 0x01, 0x04,
+0x03, 0x82, 0x00, 0x14, 0x08, 0x14, 0x13, 0x68, 0x74, 0x38, 0x37, 0x1F, 0x18, 0xC4, 0xE0, 0x6F,
+0x7F, 0x30, 0x08, 0x10, 0x58, 0xB0, 0x80, 0x40, 0x3F,
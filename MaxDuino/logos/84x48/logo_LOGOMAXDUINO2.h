@@ -1,32 +1,17 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x60, 0xF0, 0x60, 0xC0,
-0x80, 0x60, 0xF0, 0xF0, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-0x88, 0xF8, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x1E, 0x3F, 0x38, 0x18, 0x7F, 0x3E, 0x19,
-0x7E, 0xF9, 0xFB, 0x3E, 0x18, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-0x18, 0x18, 0x10, 0x10, 0x10, 0x1C, 0x18, 0x10, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-0x1F, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF0, 0x80, 0x80, 0x80,
-0xE0, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xF8, 0xF8, 0xC0, 0x01, 0x01, 0x01, 0x19,
-0x39, 0xF1, 0xE1, 0xC1, 0xE1, 0xF1, 0x39, 0x09, 0x01, 0x01, 0xF9, 0xF9, 0xF9, 0xF9, 0x39, 0x39,
-0x31, 0xE1, 0xC1, 0x01, 0x01, 0xF9, 0xF9, 0xF9, 0x01, 0x01, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00,
-0xF8, 0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF0, 0xC0, 0x80, 0x80, 0xF8, 0x00, 0x00, 0xC0,
-0xF0, 0xF0, 0x38, 0x38, 0x38, 0x70, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x03,
-0x03, 0x0F, 0x3F, 0x0F, 0x07, 0x03, 0x3F, 0x3F, 0x00, 0x30, 0x3F, 0x3F, 0x19, 0x1B, 0x3F, 0x3F,
-0x3C, 0x20, 0x00, 0x20, 0x38, 0x3E, 0x0F, 0x0F, 0x1F, 0x3E, 0x38, 0x00, 0x00, 0x00, 0x07, 0x3F,
-0x3F, 0x3F, 0x30, 0x30, 0x18, 0x0F, 0x07, 0x00, 0x00, 0x07, 0x1F, 0x1F, 0x38, 0x30, 0x30, 0x30,
-0x3F, 0x1F, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x1F, 0x3F, 0x01, 0x01, 0x07, 0x0F, 0x1F,
-0x3F, 0x00, 0x00, 0x03, 0x0F, 0x1F, 0x18, 0x30, 0x30, 0x18, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
+// 504 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x83, 0x00, 0x0F, 0x80, 0x40, 0x80, 0x80, 0x40, 0x40, 0x80, 0x60, 0xF0, 0x60, 0xC0, 0x80, 0x60,
+0xF0, 0xF0, 0xF8, 0x9A, 0x88, 0x01, 0xF8, 0xC0, 0x98, 0x80, 0x89, 0x00, 0x0D, 0x0D, 0x1E, 0x3F,
+0x38, 0x18, 0x7F, 0x3E, 0x19, 0x7E, 0xF9, 0xFB, 0x3E, 0x18, 0x7E, 0x9E, 0xFF, 0x00, 0x3F, 0x87,
+0x10, 0x80, 0x18, 0x81, 0x10, 0x03, 0x1C, 0x18, 0x10, 0x1F, 0x85, 0x10, 0x02, 0x1F, 0x0F, 0x06,
+0x84, 0x00, 0x81, 0xF8, 0x00, 0xF0, 0x81, 0x80, 0x00, 0xE0, 0x81, 0xF8, 0x81, 0x00, 0x00, 0xE0,
+0x81, 0xF8, 0x00, 0xC0, 0x81, 0x01, 0x0A, 0x19, 0x39, 0xF1, 0xE1, 0xC1, 0xE1, 0xF1, 0x39, 0x09,
+0x01, 0x01, 0x82, 0xF9, 0x80, 0x39, 0x04, 0x31, 0xE1, 0xC1, 0x01, 0x01, 0x81, 0xF9, 0x80, 0x01,
+0x80, 0x00, 0x80, 0xF8, 0x80, 0x00, 0x81, 0xF8, 0x80, 0x00, 0x81, 0xF8, 0x09, 0xF0, 0xC0, 0x80,
+0x80, 0xF8, 0x00, 0x00, 0xC0, 0xF0, 0xF0, 0x81, 0x38, 0x02, 0x70, 0xF0, 0xC0, 0x83, 0x00, 0x1D,
+0x0F, 0x3F, 0x03, 0x03, 0x0F, 0x3F, 0x0F, 0x07, 0x03, 0x3F, 0x3F, 0x00, 0x30, 0x3F, 0x3F, 0x19,
+0x1B, 0x3F, 0x3F, 0x3C, 0x20, 0x00, 0x20, 0x38, 0x3E, 0x0F, 0x0F, 0x1F, 0x3E, 0x38, 0x81, 0x00,
+0x00, 0x07, 0x81, 0x3F, 0x80, 0x30, 0x08, 0x18, 0x0F, 0x07, 0x00, 0x00, 0x07, 0x1F, 0x1F, 0x38,
+0x81, 0x30, 0x03, 0x3F, 0x1F, 0x00, 0x00, 0x81, 0x3F, 0x80, 0x00, 0x12, 0x1F, 0x3F, 0x01, 0x01,
+0x07, 0x0F, 0x1F, 0x3F, 0x00, 0x00, 0x03, 0x0F, 0x1F, 0x18, 0x30, 0x30, 0x18, 0x0F, 0x07, 0xFF,
+0x00, 0xA9, 0x00,
@@ -1,32 +1,20 @@
-0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-0xF0, 0xF0, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xF0,
-0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0,
-0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0, 0x00, 0x00, 0xC0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-0x3F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xF0, 0xFE, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-0x00, 0xC0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xC0, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-0x3F, 0x1F, 0x07, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xE0, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0x3F,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0x30, 0xF0, 0xC0,
-0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0x00,
-0x00, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xF0, 0xF0, 0x00, 0x00, 0xC0, 0xF0, 0xF0, 0xF0, 0x30, 0xF0,
-0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07,
-0x07, 0x06, 0x07, 0x01, 0x00, 0x00, 0x03, 0x07, 0x07, 0x07, 0x04, 0x07, 0x03, 0x00, 0x00, 0x07,
-0x07, 0x07, 0x07, 0x00, 0x00, 0x07, 0x07, 0x01, 0x03, 0x03, 0x07, 0x07, 0x00, 0x00, 0x01, 0x07,
-0x07, 0x07, 0x06, 0x07, 0x01, 0x00, 0x00, 0x00  
\ No newline at end of file
+// 504 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x82, 0x00, 0x89, 0xF0, 0x00, 0xC0, 0x86, 0x00, 0x00, 0xE0, 0x88, 0xF0, 0x00, 0xE0, 0x87, 0x00,
+0x00, 0xC0, 0x86, 0xF0, 0x86, 0x00, 0x86, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0xC0, 0x84, 0xF0, 0x00,
+0x30, 0x85, 0x00, 0x8A, 0xFF, 0x01, 0xF8, 0xC0, 0x82, 0x00, 0x01, 0xE0, 0xFC, 0x8A, 0xFF, 0x85,
+0x00, 0x01, 0x80, 0xFC, 0x82, 0xFF, 0x00, 0x7F, 0x83, 0xFF, 0x00, 0xF8, 0x85, 0x00, 0x02, 0x01,
+0x0F, 0x7F, 0x83, 0xFF, 0x00, 0xFE, 0x82, 0xFF, 0x03, 0x3F, 0x0F, 0x07, 0x01, 0x85, 0x00, 0x00,
+0xF8, 0x85, 0xFF, 0x00, 0x3F, 0x84, 0xFF, 0x03, 0xFC, 0xF0, 0xF0, 0xFE, 0x8C, 0xFF, 0x00, 0xE0,
+0x82, 0x00, 0x01, 0xC0, 0xFC, 0x83, 0xFF, 0x02, 0xC1, 0xC0, 0xCF, 0x84, 0xFF, 0x00, 0xF0, 0x84,
+0x00, 0x02, 0x80, 0xC0, 0xF0, 0x86, 0xFF, 0x02, 0xFC, 0xF0, 0xC0, 0x87, 0x00, 0x86, 0xFF, 0x01,
+0x00, 0x0F, 0x8A, 0xFF, 0x02, 0x7F, 0x0F, 0x00, 0x87, 0xFF, 0x81, 0x00, 0x00, 0xFC, 0x83, 0xFF,
+0x00, 0x3F, 0x83, 0x0F, 0x85, 0xFF, 0x04, 0xF8, 0x00, 0xC0, 0xF0, 0xFC, 0x82, 0xFF, 0x04, 0x3F,
+0x1F, 0x07, 0x0F, 0x7F, 0x83, 0xFF, 0x02, 0xFE, 0xFC, 0xE0, 0x83, 0x00, 0x87, 0xFF, 0x81, 0x00,
+0x01, 0x07, 0x3F, 0x85, 0xFF, 0x01, 0x7F, 0x03, 0x81, 0x00, 0x87, 0xFF, 0x00, 0xF8, 0x81, 0x00,
+0x82, 0xF0, 0x04, 0x30, 0xF0, 0xC0, 0x00, 0x00, 0x82, 0xF0, 0x04, 0x00, 0xF0, 0xF0, 0x00, 0x00,
+0x82, 0xF0, 0x80, 0x00, 0x80, 0xF0, 0x80, 0xE0, 0x05, 0xC0, 0xF0, 0xF0, 0x00, 0x00, 0xC0, 0x81,
+0xF0, 0x02, 0x30, 0xF0, 0xC0, 0x83, 0x00, 0x87, 0x0F, 0x83, 0x00, 0x00, 0x07, 0x83, 0x0F, 0x00,
+0x03, 0x83, 0x00, 0x88, 0x0F, 0x81, 0x00, 0x82, 0x07, 0x05, 0x06, 0x07, 0x01, 0x00, 0x00, 0x03,
+0x81, 0x07, 0x04, 0x04, 0x07, 0x03, 0x00, 0x00, 0x82, 0x07, 0x80, 0x00, 0x80, 0x07, 0x07, 0x01,
+0x03, 0x03, 0x07, 0x07, 0x00, 0x00, 0x01, 0x81, 0x07, 0x02, 0x06, 0x07, 0x01, 0x81, 0x00,
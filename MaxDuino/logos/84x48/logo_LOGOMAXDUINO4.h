@@ -1,32 +1,19 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0,
-0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF0,
-0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x38, 0x3E, 0x3F, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0xC0, 0x70, 0x78, 0x3C, 0x3E, 0x3F, 0x3F,
-0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xC0, 0x80,
-0x70, 0x38, 0x3C, 0x3E, 0x3F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFE, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x03, 0x07, 0x0F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x3F,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xC0, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01,
-0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF0, 0xC0,
-0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x03, 0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFE, 0xFC, 0xFC, 0xFC, 0x7C, 0x3C, 0x1C, 0x0D, 0x03, 0x0F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFC, 0xFC, 0x7C, 0x1C, 0x0C, 0x01, 0x07, 0x1F,
-0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFC, 0xFC,
-0x7C, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x1F,
-0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x01, 0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07,
-0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00  
\ No newline at end of file
+// 504 bytes, run length coded (see logo_rle.py)
+#define LOGO_IS_RLE
+0x83, 0x00, 0x03, 0x80, 0xC0, 0xE0, 0xE0, 0x83, 0xF0, 0x80, 0xE0, 0x01, 0xC0, 0x80, 0x87, 0x00,
+0x02, 0x80, 0xC0, 0xE0, 0x84, 0xF0, 0x02, 0xE0, 0xC0, 0x80, 0x87, 0x00, 0x03, 0x80, 0xC0, 0xE0,
+0xE0, 0x84, 0xF0, 0x02, 0xE0, 0xC0, 0x80, 0x96, 0x00, 0x06, 0x70, 0x38, 0x3E, 0x3F, 0x3F, 0x7F,
+0x7F, 0x88, 0xFF, 0x0A, 0xFE, 0xF8, 0xE0, 0xC0, 0x70, 0x78, 0x3C, 0x3E, 0x3F, 0x3F, 0x7F, 0x89,
+0xFF, 0x0A, 0xFC, 0xF0, 0xC0, 0x80, 0x70, 0x38, 0x3C, 0x3E, 0x3F, 0x3F, 0x7F, 0x88, 0xFF, 0x03,
+0xFE, 0xFC, 0xF0, 0xC0, 0x9A, 0x00, 0x03, 0x03, 0x07, 0x0F, 0x3F, 0x88, 0xFF, 0x02, 0xFC, 0xF0,
+0xC0, 0x82, 0x00, 0x04, 0x01, 0x03, 0x0F, 0x3F, 0x7F, 0x87, 0xFF, 0x03, 0xFE, 0xF8, 0xE0, 0x80,
+0x82, 0x00, 0x03, 0x01, 0x07, 0x0F, 0x3F, 0x88, 0xFF, 0x03, 0xFC, 0xF0, 0xC0, 0x80, 0x9A, 0x00,
+0x02, 0x03, 0x0F, 0x3F, 0x88, 0xFF, 0x03, 0xFC, 0xF8, 0xE0, 0xC0, 0x82, 0x00, 0x03, 0x01, 0x07,
+0x1F, 0x7F, 0x87, 0xFF, 0x04, 0xFE, 0xF8, 0xF0, 0xC0, 0x80, 0x82, 0x00, 0x03, 0x01, 0x07, 0x1F,
+0x7F, 0x87, 0xFF, 0x04, 0xFE, 0xF8, 0xE0, 0xC0, 0x80, 0x99, 0x00, 0x03, 0x03, 0x07, 0x1F, 0x7F,
+0x88, 0xFF, 0x00, 0xFE, 0x81, 0xFC, 0x06, 0x7C, 0x3C, 0x1C, 0x0D, 0x03, 0x0F, 0x3F, 0x89, 0xFF,
+0x00, 0xFE, 0x81, 0xFC, 0x06, 0x7C, 0x1C, 0x0C, 0x01, 0x07, 0x1F, 0x7F, 0x89, 0xFF, 0x00, 0xFE,
+0x81, 0xFC, 0x02, 0x7C, 0x1C, 0x0C, 0x96, 0x00, 0x03, 0x03, 0x07, 0x0F, 0x0F, 0x81, 0x1F, 0x80,
+0x0F, 0x03, 0x07, 0x03, 0x03, 0x01, 0x86, 0x00, 0x03, 0x01, 0x03, 0x07, 0x0F, 0x81, 0x1F, 0x80,
+0x0F, 0x80, 0x07, 0x01, 0x03, 0x01, 0x87, 0x00, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x81, 0x1F, 0x80,
+0x0F, 0x80, 0x07, 0x01, 0x03, 0x01, 0x83, 0x00,
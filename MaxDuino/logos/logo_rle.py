@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+"""Run length code logo files, in place.
+
+Takes the files LCD Assistant writes (a list of 0x.. bytes), as many as
+given, and rewrites each as the coded bytes, marked with LOGO_IS_RLE so
+the splash screen decodes it.  A file already coded is left alone.
+
+    python3 logo_rle.py 128x64/logo_mine.h
+
+The coding: a byte n below 0x80 is followed by n+1 bytes as they are, and
+n from 0x80 up by one byte that's repeated n-0x7E times (2 to 129).
+"""
+import re
+import sys
+
+MARK = '#define LOGO_IS_RLE'
+
+
+def rle(data):
+    out = []
+    lit = []
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 129:
+            run += 1
+        # a pair on its own costs the same either way, so only break a literal for 3 or more
+        if run >= 3 or (run == 2 and not lit):
+            if lit:
+                out += [len(lit) - 1] + lit
+                lit = []
+            out += [0x7E + run, data[i]]
+            i += run
+        else:
+            lit.append(data[i])
+            i += 1
+            if len(lit) == 128:
+                out += [127] + lit
+                lit = []
+    if lit:
+        out += [len(lit) - 1] + lit
+    return out
+
+
+def convert(path):
+    with open(path, newline='') as f:
+        text = f.read()
+    if MARK in text:
+        return
+    eol = '\r\n' if '\r\n' in text else '\n'
+    data = [int(x, 16) for x in re.findall(r'0x[0-9a-fA-F]{2}', text)]
+    coded = rle(data)
+    lines = ['// %d bytes, run length coded (see logo_rle.py)' % len(data), MARK]
+    for k in range(0, len(coded), 16):
+        lines.append(', '.join('0x%02X' % b for b in coded[k:k + 16]) + ',')
+    with open(path, 'w', newline='') as f:
+        f.write(eol.join(lines) + eol)
+
+
+if __name__ == '__main__':
+    for p in sys.argv[1:]:
+        convert(p)
@@ -0,0 +1,40 @@
+#include "configs.h"
+#include "loopcache.h"
+
+#ifdef LOOP_CACHE
+
+#include "hwconfig.h"
+#include "file_utils.h"
+
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega32U4__)
+  #error LOOP_CACHE needs more RAM than a 328 or 32U4 has
+#endif
+
+namespace {
+byte body[LOOP_CACHE_SIZE];
+unsigned long bodyStart = 0;
+word bodyLen = 0;
+} // anonymous namespace
+
+void loop_cache_clear() {
+  bodyLen = 0;
+}
+
+void loop_cache_store(unsigned long from, unsigned long to) {
+  if (bodyLen || to <= from || to - from > LOOP_CACHE_SIZE) return;
+  // through the usual window, so this is the last time the body comes off the card
+  const word n = readfile_bytes(body, to - from, from);
+  if (n != to - from) return;
+  bodyStart = from;
+  bodyLen = n;
+}
+
+word loop_cache_read(unsigned long pos, byte *dst, word n) {
+  if (pos < bodyStart || pos - bodyStart >= bodyLen) return 0;
+  const word offset = pos - bodyStart;
+  if (n > bodyLen - offset) n = bodyLen - offset;
+  memcpy(dst, body + offset, n);
+  return n;
+}
+
+#endif // LOOP_CACHE
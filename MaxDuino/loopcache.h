@@ -0,0 +1,25 @@
+#ifndef LOOPCACHE_H_INCLUDED
+#define LOOPCACHE_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef LOOP_CACHE
+#include "Arduino.h"
+
+// Keeps the body of a TZX ID24/ID25 loop in RAM (LOOP_CACHE), so the
+// repeats don't go back to the card.  The first time ID25 jumps back, a
+// body of up to LOOP_CACHE_SIZE bytes (hwconfig.h) is copied in, and from
+// then on readahead_fill() fills its window from the copy whenever the
+// player is inside it.  TZX loops can't be nested, so one body is enough.
+
+// From ID24 and at the start of each file
+void loop_cache_clear();
+
+// From ID25 on the first jump back: keep from..to if it fits
+void loop_cache_store(unsigned long from, unsigned long to);
+
+// Read up to n bytes starting at pos into dst; 0 if pos isn't in the copy
+word loop_cache_read(unsigned long pos, byte *dst, word n);
+#endif
+
+#endif // LOOPCACHE_H_INCLUDED
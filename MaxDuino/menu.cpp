@@ -10,11 +10,32 @@
  *    3600
  *    3850
  *  
+ *  CAS Baud (CAS_BAUD_RANGE):
+ *    auto (as Baud Rate), or CAS_BAUD_MIN to CAS_BAUD_MAX
+ *  
+ *  Direct Speed (DIRECT_SPEED):
+ *    100% to DIRECT_SPEED_MAX, for ID15 direct recordings (and .cas)
+ *  
+ *  ZX Speed (ZX_SPEED):
+ *    100% to ZX_SPEED_MAX, for standard speed Spectrum blocks (ID10, .tap)
+ *  
+ *  Soak Test (SOAK_TEST):
+ *    off, File (the same file over and over) or Folder, see soak.h
+ *  
+ *  Fast Gaps (FAST_GAPS):
+ *    off, or the longest pause between blocks, in ms
+ *  
  *  MotorControl:
  *    On
  *    Off
  *  
  *  Save settings to eeprom on exit. 
+ *
+ *  The menu opens while playing as well: its waits go through
+ *  button_wait(), which keeps UniLoop (or recording_loop) going.  While
+ *  playing, a new Baud Rate waits for the next block (LIVE_BAUD, and
+ *  without it can't be changed until the file stops), and CAS Baud for
+ *  the next play.
  */
 
 #include "configs.h"
@@ -24,6 +45,12 @@
 #include "Display.h"
 #include "product_strings.h"
 #include "current_settings.h"
+#include "casProcessing.h"
+#include "MaxDuino.h"
+#include "MaxProcessing.h"
+#include "ramwatch.h"
+#include "rateprobe.h"
+#include "soak.h"
 
 #if defined(lineaxy)
 #define M_LINE2 lineaxy
@@ -33,7 +60,28 @@
 
 enum MenuItems{
   VERSION,
+#ifdef RAM_WATCH
+  SYSTEM,
+#endif
+#ifdef RATE_PROBE
+  RATE_PRB,
+#endif
+#ifdef SOAK_TEST
+  SOAK_TST,
+#endif
   BAUD_RATE,
+#if defined(Use_CAS) && defined(CAS_BAUD_RANGE)
+  CAS_BAUD,
+#endif
+#ifdef DIRECT_SPEED
+  DIRECT_SPD,
+#endif
+#ifdef ZX_SPEED
+  ZX_SPD,
+#endif
+#ifdef FAST_GAPS
+  FAST_GAP,
+#endif
 #ifndef NO_MOTOR
   MOTOR_CTL,
 #endif
@@ -45,7 +93,28 @@ enum MenuItems{
 };
 
 const char MENU_ITEM_VERSION[] PROGMEM = "Version...";
+#ifdef RAM_WATCH
+const char MENU_ITEM_SYSTEM[] PROGMEM = "System...";
+#endif
+#ifdef RATE_PROBE
+const char MENU_ITEM_RATE_PROBE[] PROGMEM = "Rate Probe...";
+#endif
+#ifdef SOAK_TEST
+const char MENU_ITEM_SOAK_TEST[] PROGMEM = "Soak Test ?";
+#endif
 const char MENU_ITEM_BAUD_RATE[] PROGMEM = "Baud Rate ?";
+#if defined(Use_CAS) && defined(CAS_BAUD_RANGE)
+const char MENU_ITEM_CAS_BAUD[] PROGMEM = "CAS Baud ?";
+#endif
+#ifdef DIRECT_SPEED
+const char MENU_ITEM_DIRECT_SPEED[] PROGMEM = "Direct Speed ?";
+#endif
+#ifdef ZX_SPEED
+const char MENU_ITEM_ZX_SPEED[] PROGMEM = "ZX Speed ?";
+#endif
+#ifdef FAST_GAPS
+const char MENU_ITEM_FAST_GAPS[] PROGMEM = "Fast Gaps ?";
+#endif
 #ifndef NO_MOTOR
 const char MENU_ITEM_MOTOR_CTRL[] PROGMEM = "Motor Ctrl ?";
 #endif
@@ -55,7 +124,28 @@ const char MENU_ITEM_BLK2A[] PROGMEM = "Skip BLK:2A ?";
 #endif
 const char* const MENU_ITEMS[] PROGMEM = {
   MENU_ITEM_VERSION,
+#ifdef RAM_WATCH
+  MENU_ITEM_SYSTEM,
+#endif
+#ifdef RATE_PROBE
+  MENU_ITEM_RATE_PROBE,
+#endif
+#ifdef SOAK_TEST
+  MENU_ITEM_SOAK_TEST,
+#endif
   MENU_ITEM_BAUD_RATE,
+#if defined(Use_CAS) && defined(CAS_BAUD_RANGE)
+  MENU_ITEM_CAS_BAUD,
+#endif
+#ifdef DIRECT_SPEED
+  MENU_ITEM_DIRECT_SPEED,
+#endif
+#ifdef ZX_SPEED
+  MENU_ITEM_ZX_SPEED,
+#endif
+#ifdef FAST_GAPS
+  MENU_ITEM_FAST_GAPS,
+#endif
 #ifndef NO_MOTOR
   MENU_ITEM_MOTOR_CTRL,
 #endif
@@ -66,6 +156,122 @@ const char* const MENU_ITEMS[] PROGMEM = {
 };
 
 const word BAUDRATES[] PROGMEM = {1200, 2400, 3150, 3600, 3850};
+#ifdef FAST_GAPS
+// longest first: the ROM loaders (Spectrum, CPC, MSX) are listening again
+// well inside 250ms, while some turbo loaders unpack between blocks
+const word FASTGAPS[] PROGMEM = {0, 1000, 500, 250, 100};
+#endif
+
+#ifdef RAM_WATCH
+const char SYSTEM_FREE[] PROGMEM = "Free ";
+const char SYSTEM_MIN_FREE[] PROGMEM = "Min free ";
+const char SYSTEM_STACK[] PROGMEM = "Stk unused ";
+const char* const SYSTEM_ITEMS[] PROGMEM = {SYSTEM_FREE, SYSTEM_MIN_FREE, SYSTEM_STACK};
+
+void systemSubmenu()
+{
+  // up/down through free RAM now, the least seen, and the stack never used
+  byte subItem=0;
+  bool updateScreen=true;
+  lastbtn=true;
+  while(!button_stop() || lastbtn) {
+    if(button_down() && !lastbtn){
+      if(subItem<2) subItem+=1;
+      lastbtn=true;
+      updateScreen=true;
+    }
+    if(button_up() && !lastbtn) {
+      if(subItem>0) subItem+=-1;
+      lastbtn=true;
+      updateScreen=true;
+    }
+    if(updateScreen) {
+      const unsigned long value = subItem==0 ? ramwatch_free() : subItem==1 ? ramwatch_min_free() : ramwatch_stack_unused();
+      char text[22];                        // (input is only big enough for the baud rates)
+      strcpy_P(text, (char *)pgm_read_ptr(&(SYSTEM_ITEMS[subItem])));
+      ultoa(value, text + strlen(text), 10);
+      printtext(text, M_LINE2);
+      updateScreen=false;
+    }
+    checkLastButton();
+  }
+}
+#endif
+
+#ifdef RATE_PROBE
+void rateProbeSubmenu()
+{
+  // up/down through the last results, play (while stopped) to probe again
+  byte subItem=0;
+  bool updateScreen=true;
+  lastbtn=true;
+  while(!button_stop() || lastbtn) {
+    if(button_down() && !lastbtn){
+      if(subItem<RATE_ENCODINGS-1) subItem+=1;
+      lastbtn=true;
+      updateScreen=true;
+    }
+    if(button_up() && !lastbtn) {
+      if(subItem>0) subItem+=-1;
+      lastbtn=true;
+      updateScreen=true;
+    }
+    if(button_play() && !lastbtn && start==0) {
+      printtextF(PSTR("probing..."), M_LINE2);
+      rateprobe_run();
+      printtextF(MENU_ITEM_RATE_PROBE, 0);
+      updateScreen=true;
+    }
+    if(updateScreen) {
+      char text[22];
+      rateprobe_text(subItem, text);
+      printtext(text, M_LINE2);
+      updateScreen=false;
+    }
+    checkLastButton();
+  }
+}
+#endif
+
+#ifdef SOAK_TEST
+const char SOAK_OFF[] PROGMEM = "off";
+const char SOAK_FILE[] PROGMEM = "File";
+const char SOAK_FOLDER[] PROGMEM = "Folder";
+const char* const SOAK_ITEMS[] PROGMEM = {SOAK_OFF, SOAK_FILE, SOAK_FOLDER};
+
+void soakSubmenu()
+{
+  // up/down through off, File and Folder, play to choose
+  byte subItem=(byte)soakMode;
+  bool updateScreen=true;
+  lastbtn=true;
+  while(!button_stop() || lastbtn) {
+    if(button_down() && !lastbtn){
+      if(subItem<2) subItem+=1;
+      lastbtn=true;
+      updateScreen=true;
+    }
+    if(button_up() && !lastbtn) {
+      if(subItem>0) subItem+=-1;
+      lastbtn=true;
+      updateScreen=true;
+    }
+    if(button_play() && !lastbtn) {
+      soakMode = (SOAK)subItem;
+      lastbtn=true;
+      updateScreen=true;
+    }
+    if(updateScreen) {
+      char text[10];
+      strcpy_P(text, (char *)pgm_read_ptr(&(SOAK_ITEMS[subItem])));
+      if(subItem == (byte)soakMode) strcat_P(text, PSTR(" *"));
+      printtext(text, M_LINE2);
+      updateScreen=false;
+    }
+    checkLastButton();
+  }
+}
+#endif
 
 void doOnOffSubmenu(bool& refVar)
 {
@@ -124,6 +330,24 @@ void menuMode()
           }
         break;
 
+        #ifdef RAM_WATCH
+          case MenuItems::SYSTEM:
+            systemSubmenu();
+            break;
+        #endif
+
+        #ifdef RATE_PROBE
+          case MenuItems::RATE_PRB:
+            rateProbeSubmenu();
+            break;
+        #endif
+
+        #ifdef SOAK_TEST
+          case MenuItems::SOAK_TST:
+            soakSubmenu();
+            break;
+        #endif
+
         case MenuItems::BAUD_RATE:
           subItem=0;
           updateScreen=true;
@@ -143,7 +367,13 @@ void menuMode()
             const word baudrate = pgm_read_word(&(BAUDRATES[subItem]));
 
             if(button_play() && !lastbtn) {
-              BAUDRATE = baudrate;
+              if(start==0) {
+                BAUDRATE = baudrate;
+              #ifdef LIVE_BAUD
+              } else {
+                LiveBaudSet(baudrate);    // changing mid block would break it
+              #endif
+              }
               updateScreen=true;
               #if defined(OLED1306) && defined(OSTATUSLINE) 
                 OledStatusLine();
@@ -152,8 +382,13 @@ void menuMode()
             }
 
             if(updateScreen) {
+              #ifdef LIVE_BAUD
+                const word selected = (start==1) ? LiveBaudNext() : BAUDRATE;
+              #else
+                const word selected = BAUDRATE;
+              #endif
               utoa(baudrate, (char *)input, 10);
-              if(BAUDRATE == baudrate) {
+              if(selected == baudrate) {
                 strcat_P((char *)input, PSTR(" *"));
               }
               printtext((char *)input, M_LINE2);
@@ -164,6 +399,182 @@ void menuMode()
           }
         break;
 
+        #if defined(Use_CAS) && defined(CAS_BAUD_RANGE)
+          case MenuItems::CAS_BAUD:
+            {
+              // down for faster, up for slower; up from the slowest goes back to following Baud Rate
+              word rate = CASBAUDRATE;
+              updateScreen=true;
+              lastbtn=true;
+              while(!button_stop() || lastbtn) {
+                if(button_down() && !lastbtn){
+                  if(rate==0) rate=CAS_BAUD_MIN;
+                  else if(rate+CAS_BAUD_STEP<=CAS_BAUD_MAX) rate+=CAS_BAUD_STEP;
+                  lastbtn=true;
+                  updateScreen=true;
+                }
+                if(button_up() && !lastbtn) {
+                  if(rate>CAS_BAUD_MIN) rate-=CAS_BAUD_STEP;
+                  else rate=0;
+                  lastbtn=true;
+                  updateScreen=true;
+                }
+
+                if(button_play() && !lastbtn) {
+                  CASBAUDRATE = rate;
+                  updateScreen=true;
+                  lastbtn=true;
+                }
+
+                if(updateScreen) {
+                  if(rate==0) strcpy_P((char *)input, PSTR("auto"));   // follows Baud Rate
+                  else utoa(rate, (char *)input, 10);
+                  if(CASBAUDRATE == rate) {
+                    strcat_P((char *)input, PSTR(" *"));
+                  }
+                  printtext((char *)input, M_LINE2);
+                  updateScreen=false;
+                }
+
+                checkLastButton();
+              }
+              if(start==0) setCASBaud();    // (it stops the timer) while playing, CAS Baud is for the next play
+            }
+          break;
+        #endif
+
+        #ifdef DIRECT_SPEED
+          case MenuItems::DIRECT_SPD:
+            {
+              // down for faster, up for slower; while playing, from the next ID15 block (or .cas play)
+              word speed = DIRECTSPEED;
+              updateScreen=true;
+              lastbtn=true;
+              while(!button_stop() || lastbtn) {
+                if(button_down() && !lastbtn){
+                  if(speed+DIRECT_SPEED_STEP<=DIRECT_SPEED_MAX) speed+=DIRECT_SPEED_STEP;
+                  lastbtn=true;
+                  updateScreen=true;
+                }
+                if(button_up() && !lastbtn) {
+                  if(speed>100) speed-=DIRECT_SPEED_STEP;
+                  lastbtn=true;
+                  updateScreen=true;
+                }
+
+                if(button_play() && !lastbtn) {
+                  DIRECTSPEED = speed;
+                  updateScreen=true;
+                  lastbtn=true;
+                }
+
+                if(updateScreen) {
+                  utoa(speed, (char *)input, 10);
+                  strcat_P((char *)input, PSTR("%"));
+                  if(DIRECTSPEED == speed) {
+                    strcat_P((char *)input, PSTR(" *"));
+                  }
+                  printtext((char *)input, M_LINE2);
+                  updateScreen=false;
+                }
+
+                checkLastButton();
+              }
+              #ifdef Use_CAS
+              if(start==0) setCASBaud();
+              #endif
+            }
+          break;
+        #endif
+
+        #ifdef ZX_SPEED
+          case MenuItems::ZX_SPD:
+            {
+              // down for faster, up for slower; while playing, from the next block
+              word speed = ZXSPEED;
+              updateScreen=true;
+              lastbtn=true;
+              while(!button_stop() || lastbtn) {
+                if(button_down() && !lastbtn){
+                  if(speed+ZX_SPEED_STEP<=ZX_SPEED_MAX) speed+=ZX_SPEED_STEP;
+                  lastbtn=true;
+                  updateScreen=true;
+                }
+                if(button_up() && !lastbtn) {
+                  if(speed>100) speed-=ZX_SPEED_STEP;
+                  lastbtn=true;
+                  updateScreen=true;
+                }
+
+                if(button_play() && !lastbtn) {
+                  ZXSPEED = speed;
+                  updateScreen=true;
+                  lastbtn=true;
+                }
+
+                if(updateScreen) {
+                  utoa(speed, (char *)input, 10);
+                  strcat_P((char *)input, PSTR("%"));
+                  if(ZXSPEED == speed) {
+                    strcat_P((char *)input, PSTR(" *"));
+                  }
+                  printtext((char *)input, M_LINE2);
+                  updateScreen=false;
+                }
+
+                checkLastButton();
+              }
+            }
+          break;
+        #endif
+
+        #ifdef FAST_GAPS
+          case MenuItems::FAST_GAP:
+            {
+              // down for shorter gaps; while playing, from the next pause
+              byte g = 0;
+              while(g+1<sizeof(FASTGAPS)/sizeof(FASTGAPS[0]) && pgm_read_word(&FASTGAPS[g])!=FASTGAP) g++;
+              updateScreen=true;
+              lastbtn=true;
+              while(!button_stop() || lastbtn) {
+                if(button_down() && !lastbtn){
+                  if(g+1<sizeof(FASTGAPS)/sizeof(FASTGAPS[0])) g++;
+                  lastbtn=true;
+                  updateScreen=true;
+                }
+                if(button_up() && !lastbtn) {
+                  if(g>0) g--;
+                  lastbtn=true;
+                  updateScreen=true;
+                }
+
+                if(button_play() && !lastbtn) {
+                  FASTGAP = pgm_read_word(&FASTGAPS[g]);
+                  updateScreen=true;
+                  lastbtn=true;
+                }
+
+                if(updateScreen) {
+                  const word gap = pgm_read_word(&FASTGAPS[g]);
+                  if(gap) {
+                    utoa(gap, (char *)input, 10);
+                    strcat_P((char *)input, PSTR("ms"));
+                  } else {
+                    strcpy_P((char *)input, PSTR("off"));
+                  }
+                  if(FASTGAP == gap) {
+                    strcat_P((char *)input, PSTR(" *"));
+                  }
+                  printtext((char *)input, M_LINE2);
+                  updateScreen=false;
+                }
+
+                checkLastButton();
+              }
+            }
+          break;
+        #endif
+
         #ifndef NO_MOTOR
           case MenuItems::MOTOR_CTL:
             doOnOffSubmenu(mselectMask);
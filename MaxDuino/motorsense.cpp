@@ -0,0 +1,63 @@
+#include "configs.h"
+#include "motorsense.h"
+
+#ifdef MOTOR_IRQ
+
+#include "hwconfig.h"
+#include "pinSetup.h"
+#include "TimerCounter.h"
+
+volatile byte motorHold = 0;
+
+namespace {
+volatile byte armed = 0;
+bool irq = false;
+
+ISR_CODE void motor_edge() {
+  // high (NC) is motor off
+  motorHold = armed && digitalRead(btnMotor);
+}
+}
+
+#if defined(__AVR_ATmega328P__)
+  #if btnMotor <= 7
+    #define MOTOR_PCINT_vect PCINT2_vect
+  #elif btnMotor <= 13
+    #define MOTOR_PCINT_vect PCINT0_vect
+  #else
+    #define MOTOR_PCINT_vect PCINT1_vect
+  #endif
+ISR(MOTOR_PCINT_vect)
+{
+  motor_edge();
+}
+#endif
+
+void motor_sense_setup() {
+#if defined(__AVR_ATmega328P__)
+  *digitalPinToPCMSK(btnMotor) |= _BV(digitalPinToPCMSKbit(btnMotor));
+  PCIFR = _BV(digitalPinToPCICRbit(btnMotor));
+  PCICR |= _BV(digitalPinToPCICRbit(btnMotor));
+  irq = true;
+#else
+  #ifdef NOT_AN_INTERRUPT
+  if (digitalPinToInterrupt(btnMotor) == NOT_AN_INTERRUPT) return;
+  #endif
+  attachInterrupt(digitalPinToInterrupt(btnMotor), motor_edge, CHANGE);
+  irq = true;
+#endif
+}
+
+bool motor_sense_irq() {
+  return irq;
+}
+
+void motor_sense_arm(bool on) {
+  if (!irq || on == armed) return;
+  const uint32_t old = irq_mask();         // (only the pin's interrupt shares it, not the timer)
+  armed = on;
+  irq_unmask(old);
+  motor_edge();                             // the pin as it is now
+}
+
+#endif // MOTOR_IRQ
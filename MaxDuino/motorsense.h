@@ -0,0 +1,31 @@
+#ifndef MOTORSENSE_H_INCLUDED
+#define MOTORSENSE_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef MOTOR_IRQ
+#include "Arduino.h"
+
+// Motor control from an interrupt on btnMotor, rather than loop() polling
+// it and pausing in the 50ms button check.  While armed (playing, with
+// motor control on) each change of the pin sets motorHold straight away,
+// and wave2 holds the output from its next edge, as it does when stopped,
+// and picks up again within one STOPPED_TICK of the motor starting.  The
+// 50ms check only updates the screen.
+//
+// On a 328 it's the pin change interrupt for btnMotor's port.  Elsewhere
+// it's attachInterrupt, so btnMotor has to be a pin that can take one: on
+// a Mega, pin 6 can't, and there motor control stays polled as before.
+
+#ifdef NO_MOTOR
+  #error MOTOR_IRQ is for motor control, and this board has NO_MOTOR
+#endif
+
+extern volatile byte motorHold;           // the motor is off: wave2 holds the output
+
+void motor_sense_setup();                 // in setup, after pinsetup
+bool motor_sense_irq();                   // whether the interrupt is doing it (or it's polled)
+void motor_sense_arm(bool on);            // each loop: playing, with motor control on
+#endif
+
+#endif // MOTORSENSE_H_INCLUDED
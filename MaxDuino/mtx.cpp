@@ -6,6 +6,8 @@
 #include "MaxDuino.h"
 #include "MaxProcessing.h"
 #include "processing_state.h"
+#include "pwmbyte.h"
+#include "bytesrc.h"
 
 // Memotech MTX tape waveform, based on the supplied mtx.c converter.
 // At 44.1 kHz normal mode:
@@ -24,6 +26,21 @@ static const uint16_t MTX_HEADER_PAUSE_MS = 372; // 0x4000 / 44100 ~= 372 ms
 static const uint16_t MTX_EXTRA_PAUSE_MS  = 186; // 0x2000 / 44100 ~= 186 ms
 static const uint16_t MTX_SYSVARS_TOP = 0xFB4B;
 
+static const PWM_FORMAT MTX_PWM = {
+  { MTX_SHORT_US, MTX_SHORT_US },
+  { MTX_LONG_US, MTX_LONG_US },
+  2, 2, false,
+  0, false,
+  0, false,
+  PWM_PARITY_NONE
+};
+
+// What's playing: the timings above, or all of them cut down by MTXSPEEDUP
+static word mtx_short = MTX_SHORT_US;
+static word mtx_long = MTX_LONG_US;
+static word mtx_gap = MTX_GAP_US;
+static PWM_FORMAT mtx_pwm = MTX_PWM;
+
 enum class MTX_STAGE : uint8_t {
   HEADER_LEADER,
   HEADER_BYTES,
@@ -51,9 +68,7 @@ enum class MTX_LEADER_PHASE : uint8_t {
 static MTX_STAGE mtx_stage = MTX_STAGE::DONE;
 static MTX_LEADER_PHASE mtx_leader_phase = MTX_LEADER_PHASE::COMPLETE;
 
-static byte mtx_header[18];
-static uint8_t mtx_header_idx = 0;
-static uint8_t mtx_header_tail_zeros = 0;
+static const uint8_t MTX_HEADER_SIZE = 18;  // sent as it is from the file, then two 0x00 (queued in bytesrc)
 
 static uint32_t mtx_payload_start = 18;
 static uint32_t mtx_sysvars_len = 0;
@@ -69,11 +84,10 @@ static uint16_t mtx_pause_remaining = 0;
 
 static uint8_t mtx_cur_byte = 0;
 static bool mtx_have_byte = false;
-static uint8_t mtx_bit_mask = 0x01; // LSB first
-static uint8_t mtx_half = 0;        // 0 = first half of bit, 1 = second half
+static uint8_t mtx_half = 0;        // 0 = first half of bit, 1 = second half (leader)
 
 static bool mtx_emit_bit(bool isOne) {
-  currentPeriod = isOne ? MTX_LONG_US : MTX_SHORT_US;
+  currentPeriod = isOne ? mtx_long : mtx_short;
   mtx_half ^= 1;
   return (mtx_half == 0);
 }
@@ -96,13 +110,12 @@ static void mtx_start_leader(MTX_STAGE leaderStage) {
   mtx_leader_remaining = MTX_LEADER_BITS;
   mtx_half = 0;
   mtx_have_byte = false;
-  mtx_bit_mask = 0x01;
 }
 
 static bool mtx_process_leader() {
   switch (mtx_leader_phase) {
     case MTX_LEADER_PHASE::PRE_HALF:
-      currentPeriod = MTX_SHORT_US;
+      currentPeriod = mtx_short;
       mtx_leader_phase = MTX_LEADER_PHASE::BITS;
       return false;
 
@@ -116,12 +129,12 @@ static bool mtx_process_leader() {
       return false;
 
     case MTX_LEADER_PHASE::POST_HALF:
-      currentPeriod = MTX_SHORT_US;
+      currentPeriod = mtx_short;
       mtx_leader_phase = MTX_LEADER_PHASE::GAP_HALF;
       return false;
 
     case MTX_LEADER_PHASE::GAP_HALF:
-      currentPeriod = MTX_GAP_US;
+      currentPeriod = mtx_gap;
       mtx_leader_phase = MTX_LEADER_PHASE::COMPLETE;
       mtx_half = 0;
       return true;
@@ -143,19 +156,6 @@ static void mtx_begin_section(uint32_t start, uint32_t len, MTX_STAGE leaderStag
 
 static void mtx_advance_after_section();
 
-static bool mtx_load_next_header_byte() {
-  if (mtx_header_idx < sizeof(mtx_header)) {
-    mtx_cur_byte = mtx_header[mtx_header_idx++];
-    return true;
-  }
-  if (mtx_header_tail_zeros < 2) {
-    ++mtx_header_tail_zeros;
-    mtx_cur_byte = 0x00;
-    return true;
-  }
-  return false;
-}
-
 static bool mtx_load_next_section_byte() {
   if (mtx_section_remaining == 0) {
     return false;
@@ -177,7 +177,6 @@ static void mtx_finish_section_byte() {
   if (mtx_chunk_remaining > 0) --mtx_chunk_remaining;
   if (mtx_section_remaining > 0) --mtx_section_remaining;
   mtx_have_byte = false;
-  mtx_bit_mask = 0x01;
 
   if (mtx_chunk_remaining == 0 && mtx_section_remaining > 0) {
     switch (mtx_stage) {
@@ -192,47 +191,37 @@ static void mtx_finish_section_byte() {
   }
 }
 
+// The byte handlers write straight to the buffer, so currentPeriod stays 0
 static void mtx_process_header_bytes() {
+  currentPeriod = 0;
   if (!mtx_have_byte) {
-    if (!mtx_load_next_header_byte()) {
+    if (!bytesrc_next(mtx_cur_byte)) {
       mtx_pause_remaining = MTX_HEADER_PAUSE_MS;
       mtx_stage = MTX_STAGE::HEADER_PAUSE;
-      currentPeriod = 0;
       return;
     }
     mtx_have_byte = true;
-    mtx_bit_mask = 0x01;
-    mtx_half = 0;
+    pwm_begin_byte(mtx_pwm, mtx_cur_byte);
   }
 
-  const bool bitIsOne = (mtx_cur_byte & mtx_bit_mask) != 0;
-  if (mtx_emit_bit(bitIsOne)) {
-    mtx_bit_mask <<= 1;
-    if (mtx_bit_mask == 0) {
-      mtx_have_byte = false;
-      mtx_bit_mask = 0x01;
-    }
+  if (pwm_write()) {
+    mtx_have_byte = false;
   }
 }
 
 static void mtx_process_section_bytes() {
+  currentPeriod = 0;
   if (!mtx_have_byte) {
     if (!mtx_load_next_section_byte()) {
       mtx_advance_after_section();
-      currentPeriod = 0;
       return;
     }
     mtx_have_byte = true;
-    mtx_bit_mask = 0x01;
-    mtx_half = 0;
+    pwm_begin_byte(mtx_pwm, mtx_cur_byte);
   }
 
-  const bool bitIsOne = (mtx_cur_byte & mtx_bit_mask) != 0;
-  if (mtx_emit_bit(bitIsOne)) {
-    mtx_bit_mask <<= 1;
-    if (mtx_bit_mask == 0) {
-      mtx_finish_section_byte();
-    }
+  if (pwm_write()) {
+    mtx_finish_section_byte();
   }
 }
 
@@ -284,13 +273,21 @@ void mtx_init() {
   mtx_leader_phase = MTX_LEADER_PHASE::COMPLETE;
   mtx_half = 0;
   mtx_have_byte = false;
-  mtx_header_idx = 0;
-  mtx_header_tail_zeros = 0;
 
-  if (!entry.seekSet(0) || entry.read(mtx_header, sizeof(mtx_header)) != (int)sizeof(mtx_header)) {
+#ifdef MTXSPEEDUP
+  mtx_short = pwm_speedup(MTX_SHORT_US);
+  mtx_long = pwm_speedup(MTX_LONG_US);
+  mtx_gap = pwm_speedup(MTX_GAP_US);
+#endif
+  mtx_pwm.zero[0] = mtx_pwm.zero[1] = mtx_short;
+  mtx_pwm.one[0] = mtx_pwm.one[1] = mtx_long;
+
+  // through readfile, so it comes from the window checkForEXT has just read
+  if (readfile(MTX_HEADER_SIZE, 0) != MTX_HEADER_SIZE) {
     currentID = BLOCKID::IDEOF;
     return;
   }
+  const byte *mtx_header = filebuffer;
 
   if (mtx_header[0] != 0xFF) {
     currentID = BLOCKID::IDEOF;
@@ -352,6 +349,10 @@ void mtx_init() {
 
   currentTask = TASK::PROCESSID;
   currentID = BLOCKID::MTX;
+  bytesRead = 0;
+  bytesrc_clear();
+  bytesrc_file(MTX_HEADER_SIZE);
+  bytesrc_fill(0x00, 2);
   mtx_start_leader(MTX_STAGE::HEADER_LEADER);
 }
 
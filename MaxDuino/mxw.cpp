@@ -0,0 +1,312 @@
+#include "mxw.h"
+
+#ifdef Use_MXW
+
+#include "file_utils.h"
+#include "processing_state.h"
+#include "buffer.h"
+#include "MaxDuino.h"
+#include "MaxProcessing.h"
+
+namespace {
+const char MXWMagic[] PROGMEM = "MXW\x04";   // 4: repeats of up to 2047
+const char MXPMagic[] PROGMEM = "MXP\x04";
+constexpr byte MXW_MAGIC_SIZE = 4;
+constexpr byte MXW_HEADER_SIZE = 8;
+constexpr word MXP_HEADER_SIZE = 512;
+constexpr byte MXP_TABLE = 8;               // where the block offsets start
+
+word mxpBlocks = 0;                         // 0 for a .mxw
+word mxpNext = 0;                           // the next block to start
+unsigned long mxpNextPos;                   // and where it starts
+
+bool magic_ok(const char *magic) {
+  for (byte i = 0; i < MXW_MAGIC_SIZE; i++) {
+    if (filebuffer[i] != pgm_read_byte(magic + i)) return false;
+  }
+  return true;
+}
+
+void next_block_at(word blk) {
+  // look up where blk starts (the end of the file after the last one)
+  mxpNext = blk;
+  mxpNextPos = filesize;
+  if (blk < mxpBlocks && readfile(4, MXP_TABLE + 4*blk) == 4) {
+    mxpNextPos = ((unsigned long)filebuffer[3] << 24) | ((unsigned long)filebuffer[2] << 16) | (filebuffer[1] << 8) | filebuffer[0];
+    mxpNextPos &= ~1UL;                     // words are never split
+  }
+}
+} // anonymous namespace
+
+void mxw_init(bool mxp) {
+  // a bad header is reported once playback starts, as for .csw
+  bytesRead = 0;
+  mxpBlocks = 0;
+  if (readfile(MXW_HEADER_SIZE, 0) == MXW_HEADER_SIZE) {
+    if (!mxp && magic_ok(MXWMagic)) {
+      bytesRead = MXW_HEADER_SIZE;
+    } else if (mxp && magic_ok(MXPMagic) && filesize >= MXP_HEADER_SIZE) {
+      mxpBlocks = word(filebuffer[5], filebuffer[4]);
+      if (mxpBlocks > MXP_MAX_BLOCKS) mxpBlocks = MXP_MAX_BLOCKS;
+      bytesRead = MXP_HEADER_SIZE;
+      next_block_at(0);
+    }
+  }
+  currentTask = TASK::PROCESSID;
+  currentID = BLOCKID::MXW;
+}
+
+void mxw_process() {
+  if (bytesRead == 0) {
+    HeaderFail();
+    return;
+  }
+  word n = buffsize - writepos;
+  if (mxpBlocks && mxpNext < mxpBlocks) {
+    if (bytesRead >= mxpNextPos) {
+      // a new block: count and show it, as the tape formats do
+      block_mem_oled();
+      next_block_at(mxpNext + 1);
+    }
+    // stop short of the next block, so it's counted when it starts
+    if (mxpNextPos - bytesRead < n) n = (mxpNextPos - bytesRead) & ~1UL;
+    if (n == 0) return;
+  }
+  // the rest of the page (or of the block), straight from the file
+  const word got = readfile_words(writeBuffer + writepos, n, bytesRead);
+  bytesRead += got;
+  writepos += got;
+  if (got == 0) {
+    EndOfFile = true;
+    currentID = BLOCKID::IDEOF;
+  }
+}
+
+bool mxw_jump_block(word &blk) {
+  if (currentID != BLOCKID::MXW || mxpBlocks == 0) return false;
+  if (blk >= mxpBlocks) blk = mxpBlocks - 1;
+  next_block_at(blk);
+  bytesRead = mxpNextPos;
+  currentTask = TASK::PROCESSID;
+  return true;
+}
+
+#ifdef MXW_RENDER
+#include <SdFat.h>
+#include "TimerCounter.h"
+
+#define MXW_NAME_MAX 160
+
+bool mxwRendering = false;
+MxwTally mxwTally;
+
+namespace {
+// the words of the render are played through here as wave2 would play
+// them, counting timer periods and adding up how long they last
+word tallyOp;                   // a word still waiting for the words that go with it
+byte tallyNeed = 0;             // how many
+word tallyHi;                   // top half of a long period's count
+word tallySample = 0;           // direct recording sample period
+
+void tally_shortest(unsigned long us) {
+  if (us < mxwTally.shortest) mxwTally.shortest = us;
+}
+
+void tally_samples(word w) {
+  // 010xxiiibbbbbbbb: iii+1 samples
+  const byte n = ((w >> 8) & 0x07) + 1;
+  mxwTally.periods += n;
+  mxwTally.us += (unsigned long)n * tallySample;
+  tally_shortest(tallySample);
+}
+
+void tally_word(word w) {
+  mxwTally.words++;
+  if (tallyNeed) {
+    tallyNeed--;
+    if ((tallyOp & LONG_PERIOD_MASK) == LONG_PERIOD_FLAG) {
+      if (tallyNeed) {
+        tallyHi = w;
+        return;
+      }
+      mxwTally.periods++;
+      mxwTally.us += ((unsigned long)tallyHi << 16) | w;
+    } else if ((tallyOp & PULSE_FLAG_MASK) == PULSE_REPEAT_FLAG) {
+      const word n = tallyOp & PULSE_TONE_MAX;
+      mxwTally.periods += n;
+      if (tallyOp & PULSE_REPEAT_ALT) {
+        const word a = (w >> 8) << PULSE_REPEAT_ALT_SHIFT;
+        const word b = (w & 0xFF) << PULSE_REPEAT_ALT_SHIFT;
+        // a b a b ..., or with pairs a a b b a a ...
+        const word na = (tallyOp & PULSE_REPEAT_PAIRS) ? (n/4)*2 + ((n%4 < 2) ? n%4 : 2) : (n+1)/2;
+        mxwTally.us += (unsigned long)na*a + (unsigned long)(n-na)*b;
+        if (na) tally_shortest(a);
+        if (n > na) tally_shortest(b);
+      } else {
+        mxwTally.us += (unsigned long)n*w;
+        if (n) tally_shortest(w);
+      }
+    } else {
+      tally_samples(w);         // a direct recording header's first samples
+    }
+    return;
+  }
+  if ((w & LONG_PERIOD_MASK) == LONG_PERIOD_FLAG) {
+    tallyOp = w;
+    tallyNeed = 2;
+  } else if ((w & PULSE_FLAG_MASK) == PULSE_REPEAT_FLAG) {
+    tallyOp = w;
+    tallyNeed = 1;
+  } else if ((w & PULSE_FLAG_MASK) == 0x6000) {
+    tallySample = w & 0x1FFF;
+    tallyOp = w;
+    tallyNeed = 1;
+  } else if ((w & PULSE_FLAG_MASK) == PULSE_PAIR_FLAG) {
+    mxwTally.periods += 2;
+    mxwTally.us += 2ul * (w & PULSE_PAIR_MAX);
+    tally_shortest(w & PULSE_PAIR_MAX);
+  } else if ((w & SEGMENT_MASK) == SEGMENT_FLAG) {
+    mxwTally.periods++;
+    mxwTally.us += w & SEGMENT_MAX;
+    tally_shortest(w & SEGMENT_MAX);
+  } else if (w & 0x4000) {
+    tally_samples(w);
+  } else {
+    mxwTally.periods++;
+    mxwTally.us += w ? w : 1000;   // wave2 holds a 0 for 1ms
+    tally_shortest(w ? w : 1000);
+  }
+}
+
+void tally_page(word n) {
+  for (word i = 0; i < n; i += 2) {
+    tally_word(word(writeBuffer[i], writeBuffer[i+1]));
+  }
+}
+
+char *put_number(char *s, unsigned long long v) {
+  // (not every core's print has long long)
+  char digits[20];
+  byte n = 0;
+  do {
+    digits[n++] = '0' + v % 10;
+    v /= 10;
+  } while (v);
+  while (n) *s++ = digits[--n];
+  *s++ = ' ';
+  return s;
+}
+} // namespace
+
+void mxw_tally_text(char *s) {
+  s = put_number(s, mxwTally.words);
+  s = put_number(s, mxwTally.periods);
+  s = put_number(s, mxwTally.us);
+  s = put_number(s, mxwTally.ms);
+  s = put_number(s, mxwTally.shortest);
+  s = put_number(s, mxwTally.bytes);
+  s[-1] = '\0';
+}
+
+void mxw_report(bool first, bool ok) {
+  SdBaseFile report;
+  if (!report.open("/MXWRENDER.TXT", first ? (O_WRONLY | O_CREAT | O_TRUNC) : (O_WRONLY | O_CREAT | O_APPEND))) return;
+  report.write(fileName, strlen(fileName));
+  if (ok) {
+    char line[MXW_TALLY_TEXT+1];
+    line[0] = ' ';
+    mxw_tally_text(line+1);
+    report.write(line, strlen(line));
+    if (mxwTally.shortest < MXW_TARGET_PERIOD) report.write(" FAST", 5);
+  } else {
+    report.write(" failed", 7);
+  }
+  report.write("\r\n", 2);
+  report.close();
+}
+
+bool mxw_render() {
+  char outName[MXW_NAME_MAX];
+  const char *dot = strrchr(fileName, '.');
+  const byte stem = dot ? dot - fileName : strlen(fileName);
+  if (dot && (!strcasecmp_P(dot+1, PSTR("mxw")) || !strcasecmp_P(dot+1, PSTR("mxp")))) return false;
+  if (stem > MXW_NAME_MAX - 5) return false;
+  memcpy(outName, fileName, stem);
+  strcpy_P(outName + stem, PSTR(".mxp"));
+
+  SdBaseFile out;
+  if (!out.open(currentDir, outName, O_RDWR | O_CREAT | O_TRUNC)) return false;
+
+  // the header sector goes in last, once the block offsets are known;
+  // until then they're kept in its place on the card
+  byte header[MXP_TABLE] = {0};
+  bool ok = true;
+  for (word i = 0; ok && i < MXP_HEADER_SIZE; i += MXP_TABLE) {
+    ok = out.write(header, MXP_TABLE) == MXP_TABLE;
+  }
+  unsigned long written = MXP_HEADER_SIZE;
+  word blocks = 0;
+  mxwTally = MxwTally();
+  tallyNeed = 0;
+  const unsigned long renderStart = millis();
+
+  // with no ISR to take pages away, every page is written out as soon
+  // as it fills and then filled again
+  mxwRendering = true;
+  pauseOn = false;
+  UniPlay();
+  if (currentID == BLOCKID::C64TAP) {
+    ok = false;
+    UniStop();
+  }
+  start = 1;
+  writepos = 0;
+  word lastBlock = block;
+  while (ok && start==1) {
+    UniLoop();
+    if (block != lastBlock) {
+      // block_mem_oled has moved block on: the new one starts here
+      lastBlock = block;
+      if (blocks < MXP_MAX_BLOCKS) {
+        const unsigned long pos = written + writepos;
+        ok = out.seekSet(MXP_TABLE + 4*blocks) && out.write(&pos, 4) == 4 && out.seekSet(written);
+        blocks++;
+      }
+    }
+    if (ok && writepos >= buffsize) {
+      tally_page(buffsize);
+      ok = out.write((const byte *)writeBuffer, buffsize) == buffsize;
+      written += buffsize;
+      writepos = 0;
+    }
+    if (pauseOn) SetPause(false);             // a "stop the tape" block: carry on regardless
+  }
+  mxwRendering = false;
+  if (start==1) UniStop();                     // gave up on a write error
+  if (ok && writepos) {
+    tally_page(writepos);
+    ok = out.write((const byte *)writeBuffer, writepos) == writepos;
+    written += writepos;
+  }
+  mxwTally.ms = millis() - renderStart;
+  mxwTally.bytes = written;
+#ifdef SERIALSCREEN
+  char line[MXW_TALLY_TEXT];
+  mxw_tally_text(line);
+  Serial.print(F("render: "));
+  Serial.println(line);
+#endif
+
+  memcpy_P(header, MXPMagic, MXW_MAGIC_SIZE);
+  header[4] = blocks & 0xFF;
+  header[5] = blocks >> 8;
+  if (ok) ok = out.seekSet(0) && out.write(header, MXP_TABLE) == MXP_TABLE;
+  if (!ok) {
+    out.remove();                               // don't leave half a file
+    return false;
+  }
+  return out.close();
+}
+#endif // MXW_RENDER
+
+#endif // Use_MXW
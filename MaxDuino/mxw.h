@@ -0,0 +1,75 @@
+#ifndef MXW_H_INCLUDED
+#define MXW_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef Use_MXW
+#include "Arduino.h"
+
+// .mxw and .mxp: files that have already been through the player, so they
+// hold the buffer words themselves (see buffer.h and wave2) rather than a
+// tape format.  Playback copies them straight into the output buffer with
+// no decoding at all, so formats that are too much for a small board's main
+// loop (ID19, fast CAS, UEF 0x104 and the like) can be played on it anyway.
+//
+//   .mxw  "MXW" 0x04, 4 reserved bytes, then the words, high byte first
+//   .mxp  one 512 byte header sector: "MXP" 0x04, word block count, word
+//         reserved, then a dword file offset for each block (up to
+//         MXP_MAX_BLOCKS); the words start on the next sector.  So every
+//         read-ahead fill is one whole, aligned sector (a single readSectors
+//         with SD_RAW_READ), and block jumps go straight to the block.
+//
+// The words are rendered with the settings of the board that made them
+// (baud rate, speedups, ...); "stop the tape" blocks don't survive, and C64
+// TAPs aren't rendered since their words mean something else to wave2.
+
+#define MXP_MAX_BLOCKS 126
+
+// .mxw / .mxp file: check the header and start playback (called from checkForEXT)
+void mxw_init(bool mxp);
+
+// Process one step of a .mxw or .mxp file (BLOCKID::MXW)
+void mxw_process();
+
+// Block jump in a .mxp: false if this isn't one, so the usual search goes ahead
+bool mxw_jump_block(word &blk);
+
+#ifdef MXW_RENDER
+// set while mxw_render runs: UniPlay gets everything ready but doesn't start the timer
+extern bool mxwRendering;
+
+// What the last render came to, for comparing builds (see BUILDING.md):
+// the words written, the timer periods they make, how long they play for,
+// how long the render took, the shortest single period (in us) and the
+// size of the .mxp.  Reported on /status, and over serial
+#define MXW_TALLY_TEXT 128
+struct MxwTally {
+  unsigned long words = 0;
+  unsigned long periods = 0;
+  unsigned long long us = 0;
+  unsigned long ms = 0;
+  word shortest = 0xFFFF;
+  unsigned long bytes = 0;
+};
+extern MxwTally mxwTally;
+void mxw_tally_text(char *s);   // "words periods us ms shortest bytes", s of MXW_TALLY_TEXT
+
+// mxw_render_all flags a file whose shortest period is under this (in us):
+// set it to the shortest the board it's for keeps up with (EDGE_VERIFY
+// shows where that is)
+#ifndef MXW_TARGET_PERIOD
+  #define MXW_TARGET_PERIOD 40
+#endif
+
+// Run the selected file through the player as fast as it will go, writing
+// the words to the same name with a .mxp extension in the current directory
+bool mxw_render();
+
+// A line for the last render in /MXWRENDER.TXT (truncated when first is
+// set): "NAME words periods us ms shortest bytes", then " FAST" if the
+// shortest period is under MXW_TARGET_PERIOD, or just "NAME failed"
+void mxw_report(bool first, bool ok);
+#endif
+#endif
+
+#endif // MXW_H_INCLUDED
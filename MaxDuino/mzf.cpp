@@ -2,6 +2,9 @@
 #include "mzf.h"
 #include "file_utils.h"
 #include "MaxProcessing.h"
+#include "pwmbyte.h"
+#include "buffer.h"
+#include "bytesrc.h"
 
 // Sharp MZ tape PWM timings (MZ-700/K/A defaults).
 // A "pulse" consists of an up (mark/high) time then a down (space/low) time.
@@ -11,6 +14,16 @@ static const word MZF_LONG_DOWN_US = 494;
 static const word MZF_SHORT_UP_US  = 240;
 static const word MZF_SHORT_DOWN_US= 264;
 
+// Each byte: a long pulse, then 8 bits MSB first (1 = long, 0 = short)
+static const PWM_FORMAT MZF_PWM = {
+  { MZF_SHORT_UP_US, MZF_SHORT_DOWN_US },
+  { MZF_LONG_UP_US, MZF_LONG_DOWN_US },
+  2, 2, true,
+  1, true,
+  0, false,
+  PWM_PARITY_NONE
+};
+
 // Conventional mode structure: LGAP(22000 short pulses) + LTM(40L 40S 1L) + HDR + CHK + HDRC + CHK + SGAP(11000 short pulses) + STM(20L 20S 1L) + FILE + CHK + FILEC + CHK
 static const uint16_t MZF_LGAP_PULSES = 22000;
 static const uint16_t MZF_SGAP_PULSES = 11000;
@@ -20,6 +33,26 @@ static const uint8_t MZF_LTM_SHORTS = 40;
 static const uint8_t MZF_STM_LONGS = 20;
 static const uint8_t MZF_STM_SHORTS = 20;
 
+// Gaps and tape marks go out as alternating repeats: up to MZF_RUN_MAX
+// pulses (two edges each) per buffer entry, both halves in 2us units
+static const uint8_t MZF_RUN_MAX = PULSE_REPEAT_MAX / 2;
+
+// What's playing: the timings above, or with MZFSPEEDUP, the low halves
+// cut down (the ROM tells the bits apart by the level a fixed time after
+// each rising edge, so the high halves have to stay as they are)
+static word mzf_long_down = MZF_LONG_DOWN_US;
+static word mzf_short_down = MZF_SHORT_DOWN_US;
+static PWM_FORMAT mzf_pwm = MZF_PWM;
+
+static word mzf_run(word up, word down) {
+  return ((up >> PULSE_REPEAT_ALT_SHIFT) << 8) | (down >> PULSE_REPEAT_ALT_SHIFT);
+}
+
+// The body checksum is worked out while the gaps and header play, a few
+// readfile() slices per call, so the FILE stage only has to stream bytes
+static const uint8_t MZF_CKSUM_SLICE = 16;    // bytes per readfile (fits filebuffer)
+static const uint8_t MZF_CKSUM_SLICES = 4;    // per mzf_process call
+
 enum class MZF_STAGE : uint8_t {
   LGAP1,
   LTM_LONG,
@@ -40,30 +73,23 @@ enum class MZF_STAGE : uint8_t {
 
 static MZF_STAGE mzf_stage = MZF_STAGE::DONE;
 
-// header cached in RAM (128 bytes)
-static byte mzf_hdr[128];
+// the 128-byte header is sent (twice) straight from the file, not kept in RAM
+static const uint8_t MZF_HDR_SIZE = 128;
 static uint16_t mzf_file_len = 0;
 
 // Per-block checksums are "number of logical 1 bits" modulo 2^16 (big-endian on tape)
 static uint16_t mzf_hdr_cksum = 0;
 static uint16_t mzf_file_cksum = 0;
+static uint32_t mzf_cksum_pos = 0;         // next body byte (file offset) still to be added
+static uint32_t mzf_cksum_end = 0;
 
 // counters for current stage
-static uint32_t mzf_pulses_left = 0;       // for gaps
-static uint16_t mzf_file_left = 0;         // for file body bytes remaining
-static uint8_t mzf_tm_left = 0;            // for tapemark pulse counts
-
-// byte writer state
-enum class BYTE_SRC : uint8_t { HDR, FILE, CHK };
-static BYTE_SRC mzf_src = BYTE_SRC::HDR;
-static uint16_t mzf_hdr_idx = 0;
+static uint32_t mzf_pulses_left = 0;       // for gaps and tapemarks
+
+// byte writer state: the stage's bytes are queued in bytesrc
+static byte mzf_chk[2];                    // checksum being sent, big-endian
 static byte mzf_cur_byte = 0;
 static bool mzf_have_byte = false;
-static bool mzf_leader_done = false;
-static uint8_t mzf_bit_mask = 0x80;
-
-// checksum byte emission state
-static uint8_t mzf_chk_byte_idx = 0; // 0..1, big-endian
 
 // half-wave state for emitting asymmetric pulses
 static uint8_t mzf_half = 0; // 0=UP, 1=DOWN
@@ -86,48 +112,80 @@ static bool mzf_emit_pulse(bool isLong) {
     mzf_half = 1;
     return false;
   } else {
-    currentPeriod = isLong ? MZF_LONG_DOWN_US : MZF_SHORT_DOWN_US;
+    currentPeriod = isLong ? mzf_long_down : mzf_short_down;
     mzf_half = 0;
     return true;
   }
 }
 
+// Emit up to MZF_RUN_MAX of mzf_pulses_left as one alternating repeat (the
+// count now, both halves as the pendingWord on the next TZXLoop pass).
+// Returns true once the last of them has gone.
+static bool mzf_emit_run(bool isLong) {
+  const uint8_t n = (mzf_pulses_left > MZF_RUN_MAX) ? MZF_RUN_MAX : (uint8_t)mzf_pulses_left;
+  mzf_pulses_left -= n;
+  currentPeriod = PULSE_REPEAT_FLAG | PULSE_REPEAT_ALT | (n * 2);
+  pendingWord = isLong ? mzf_run(MZF_LONG_UP_US, mzf_long_down) : mzf_run(MZF_SHORT_UP_US, mzf_short_down);
+  return (mzf_pulses_left == 0);
+}
+
+static void mzf_cksum_background() {
+  for (uint8_t s = MZF_CKSUM_SLICES; s > 0 && mzf_cksum_pos < mzf_cksum_end; --s) {
+    const uint32_t left = mzf_cksum_end - mzf_cksum_pos;
+    byte n = readfile((left > MZF_CKSUM_SLICE) ? MZF_CKSUM_SLICE : (byte)left, mzf_cksum_pos);
+    if (n == 0) {
+      // file is shorter than its header says; the FILE stage stops here too
+      mzf_cksum_end = mzf_cksum_pos;
+      return;
+    }
+    mzf_cksum_pos += n;
+    for (byte i = 0; i < n; ++i) {
+      mzf_file_cksum = mzf_cksum_add(mzf_file_cksum, filebuffer[i]);
+    }
+  }
+}
+
 static void mzf_next_stage(MZF_STAGE s) {
   mzf_stage = s;
   mzf_half = 0;
   mzf_have_byte = false;
-  mzf_leader_done = false;
-  mzf_bit_mask = 0x80;
-  mzf_chk_byte_idx = 0;
 }
 
 void mzf_init() {
-  // Read and cache 128-byte tape header from file
+  // Check the 128-byte tape header and work out its checksum
   mzf_stage = MZF_STAGE::DONE;
   mzf_half = 0;
 
-  if (!entry.seekSet(0)) {
-    // fall back to EOF handling
-    currentID = BLOCKID::IDEOF;
-    return;
-  }
-  int r = entry.read(mzf_hdr, 128);
-  if (r != 128) {
-    currentID = BLOCKID::IDEOF;
-    return;
-  }
+#ifdef MZFSPEEDUP
+  mzf_long_down = pwm_speedup(MZF_LONG_DOWN_US);
+  mzf_short_down = pwm_speedup(MZF_SHORT_DOWN_US);
+#endif
+  mzf_pwm.zero[1] = mzf_short_down;
+  mzf_pwm.one[1] = mzf_long_down;
 
-  // File length is 2 bytes at offset 18 (little-endian) in the standard tape header.
-  mzf_file_len = (uint16_t)mzf_hdr[18] | ((uint16_t)mzf_hdr[19] << 8);
-
-  // Pre-compute header checksum.
+  // Pre-compute header checksum, through readfile, so it comes from the
+  // window checkForEXT has just read.
   mzf_hdr_cksum = 0;
-  for (uint16_t i = 0; i < 128; ++i) {
-    mzf_hdr_cksum = mzf_cksum_add(mzf_hdr_cksum, mzf_hdr[i]);
+  for (uint8_t p = 0; p < MZF_HDR_SIZE; p += MZF_CKSUM_SLICE) {
+    if (readfile(MZF_CKSUM_SLICE, p) != MZF_CKSUM_SLICE) {
+      // fall back to EOF handling
+      currentID = BLOCKID::IDEOF;
+      return;
+    }
+    if (p == 16) {
+      // File length is 2 bytes at offset 18 (little-endian) in the standard tape header.
+      mzf_file_len = (uint16_t)filebuffer[2] | ((uint16_t)filebuffer[3] << 8);
+    }
+    for (uint8_t i = 0; i < MZF_CKSUM_SLICE; ++i) {
+      mzf_hdr_cksum = mzf_cksum_add(mzf_hdr_cksum, filebuffer[i]);
+    }
   }
 
   // Start streaming file body at offset 128.
   bytesRead = 128;
+  mzf_file_cksum = 0;
+  mzf_cksum_pos = 128;
+  mzf_cksum_end = 128 + (uint32_t)mzf_file_len;
 
   // Initialise the common TZX state machine to use our BLOCKID.
   currentTask = TASK::PROCESSID;
@@ -139,139 +197,111 @@ void mzf_init() {
 }
 
 static bool mzf_load_next_byte() {
-  if (mzf_src == BYTE_SRC::HDR) {
-    if (mzf_hdr_idx >= 128) return false;
-    mzf_cur_byte = mzf_hdr[mzf_hdr_idx++];
-    mzf_have_byte = true;
-    return true;
-  } else if (mzf_src == BYTE_SRC::FILE) {
-    if (mzf_file_left == 0) return false;
-    if (!ReadByte()) return false;
-    mzf_cur_byte = outByte;
-    mzf_have_byte = true;
-    mzf_file_left--;
-    // accumulate checksum as we stream
+  if (!bytesrc_next(mzf_cur_byte)) return false;
+  mzf_have_byte = true;
+  if (mzf_stage == MZF_STAGE::FILE1 && bytesRead > mzf_cksum_pos) {
+    // only if the background checksum didn't get this far
     mzf_file_cksum = mzf_cksum_add(mzf_file_cksum, mzf_cur_byte);
-    return true;
-  } else { // CHK
-    if (mzf_chk_byte_idx >= 2) return false;
-    uint16_t v = (mzf_stage == MZF_STAGE::CHKH1 || mzf_stage == MZF_STAGE::CHKH2) ? mzf_hdr_cksum : mzf_file_cksum;
-    byte b = (mzf_chk_byte_idx == 0) ? (byte)(v >> 8) : (byte)(v & 0xFF);
-    mzf_cur_byte = b;
-    mzf_have_byte = true;
-    mzf_chk_byte_idx++;
-    return true;
+    mzf_cksum_pos = bytesRead;
   }
+  return true;
 }
 
-static void mzf_reset_byte_writer_for_src(BYTE_SRC src) {
-  mzf_src = src;
-  mzf_have_byte = false;
-  mzf_leader_done = false;
-  mzf_bit_mask = 0x80;
-  mzf_chk_byte_idx = 0;
+static void mzf_queue_hdr() {
+  bytesRead = 0;
+  bytesrc_clear();
+  bytesrc_file(MZF_HDR_SIZE);
+}
+
+static void mzf_queue_chk(uint16_t v) {
+  mzf_chk[0] = (byte)(v >> 8);
+  mzf_chk[1] = (byte)(v & 0xFF);
+  bytesrc_clear();
+  bytesrc_ram(mzf_chk, 2);
 }
 
-static void mzf_process_bytes(uint16_t totalBytesForHDR /*ignored for FILE/CHK*/) {
-  (void)totalBytesForHDR;
+// Writes the stage's bytes straight to the buffer (currentPeriod is left at 0).
+// Returns true once there are no more bytes for this stage.
+static bool mzf_process_bytes() {
+  currentPeriod = 0;
 
   // Ensure a current byte is loaded, unless we're finished for this stage.
   if (!mzf_have_byte) {
     if (!mzf_load_next_byte()) {
-      // done with this stage
-      currentPeriod = 0;
-      return;
-    }
-    mzf_leader_done = false;
-    mzf_bit_mask = 0x80;
-  }
-
-  // Each byte is preceded by 1 long pulse
-  if (!mzf_leader_done) {
-    if (mzf_emit_pulse(true)) {
-      mzf_leader_done = true;
+      return true;
     }
-    return;
+    pwm_begin_byte(mzf_pwm, mzf_cur_byte);
   }
 
-  // Then 8 PWM pulses, MSB first
-  bool bitIsOne = (mzf_cur_byte & mzf_bit_mask) != 0;
-  if (mzf_emit_pulse(bitIsOne)) {
-    mzf_bit_mask >>= 1;
-    if (mzf_bit_mask == 0) {
-      mzf_have_byte = false; // move to next byte
-    }
+  if (pwm_write()) {
+    mzf_have_byte = false; // move to next byte
   }
+  return false;
 }
 
 void mzf_process() {
+  // (not while the header goes out from the file, or the two would take
+  // turns at the read-ahead window)
+  if (mzf_stage < MZF_STAGE::FILE1 && mzf_stage != MZF_STAGE::HDR1 && mzf_stage != MZF_STAGE::HDR2 &&
+      mzf_cksum_pos < mzf_cksum_end) {
+    mzf_cksum_background();
+  }
+
   switch (mzf_stage) {
     case MZF_STAGE::LGAP1:
       // LGAP: short pulses
-      if (mzf_emit_pulse(false)) {
-        if (--mzf_pulses_left == 0) {
-          mzf_tm_left = MZF_LTM_LONGS;
-          mzf_next_stage(MZF_STAGE::LTM_LONG);
-        }
+      if (mzf_emit_run(false)) {
+        mzf_pulses_left = MZF_LTM_LONGS;
+        mzf_next_stage(MZF_STAGE::LTM_LONG);
       }
       return;
 
     case MZF_STAGE::LTM_LONG:
-      if (mzf_emit_pulse(true)) {
-        if (--mzf_tm_left == 0) {
-          mzf_tm_left = MZF_LTM_SHORTS;
-          mzf_next_stage(MZF_STAGE::LTM_SHORT);
-        }
+      if (mzf_emit_run(true)) {
+        mzf_pulses_left = MZF_LTM_SHORTS;
+        mzf_next_stage(MZF_STAGE::LTM_SHORT);
       }
       return;
 
     case MZF_STAGE::LTM_SHORT:
-      if (mzf_emit_pulse(false)) {
-        if (--mzf_tm_left == 0) {
-          mzf_next_stage(MZF_STAGE::LTM_ENDLONG);
-        }
+      if (mzf_emit_run(false)) {
+        mzf_next_stage(MZF_STAGE::LTM_ENDLONG);
       }
       return;
 
     case MZF_STAGE::LTM_ENDLONG:
       if (mzf_emit_pulse(true)) {
         // header 1
-        mzf_hdr_idx = 0;
-        mzf_reset_byte_writer_for_src(BYTE_SRC::HDR);
+        mzf_queue_hdr();
         mzf_next_stage(MZF_STAGE::HDR1);
       }
       return;
 
     case MZF_STAGE::HDR1:
-      mzf_process_bytes(128);
-      if (currentPeriod == 0) {
+      if (mzf_process_bytes()) {
         // checksum of header
-        mzf_reset_byte_writer_for_src(BYTE_SRC::CHK);
+        mzf_queue_chk(mzf_hdr_cksum);
         mzf_next_stage(MZF_STAGE::CHKH1);
       }
       return;
 
     case MZF_STAGE::CHKH1:
-      mzf_process_bytes(2);
-      if (currentPeriod == 0) {
+      if (mzf_process_bytes()) {
         // header copy
-        mzf_hdr_idx = 0;
-        mzf_reset_byte_writer_for_src(BYTE_SRC::HDR);
+        mzf_queue_hdr();
         mzf_next_stage(MZF_STAGE::HDR2);
       }
       return;
 
     case MZF_STAGE::HDR2:
-      mzf_process_bytes(128);
-      if (currentPeriod == 0) {
-        mzf_reset_byte_writer_for_src(BYTE_SRC::CHK);
+      if (mzf_process_bytes()) {
+        mzf_queue_chk(mzf_hdr_cksum);
         mzf_next_stage(MZF_STAGE::CHKH2);
       }
       return;
 
     case MZF_STAGE::CHKH2:
-      mzf_process_bytes(2);
-      if (currentPeriod == 0) {
+      if (mzf_process_bytes()) {
         // SGAP
         mzf_pulses_left = MZF_SGAP_PULSES;
         mzf_next_stage(MZF_STAGE::SGAP);
@@ -279,28 +309,22 @@ void mzf_process() {
       return;
 
     case MZF_STAGE::SGAP:
-      if (mzf_emit_pulse(false)) {
-        if (--mzf_pulses_left == 0) {
-          mzf_tm_left = MZF_STM_LONGS;
-          mzf_next_stage(MZF_STAGE::STM_LONG);
-        }
+      if (mzf_emit_run(false)) {
+        mzf_pulses_left = MZF_STM_LONGS;
+        mzf_next_stage(MZF_STAGE::STM_LONG);
       }
       return;
 
     case MZF_STAGE::STM_LONG:
-      if (mzf_emit_pulse(true)) {
-        if (--mzf_tm_left == 0) {
-          mzf_tm_left = MZF_STM_SHORTS;
-          mzf_next_stage(MZF_STAGE::STM_SHORT);
-        }
+      if (mzf_emit_run(true)) {
+        mzf_pulses_left = MZF_STM_SHORTS;
+        mzf_next_stage(MZF_STAGE::STM_SHORT);
       }
       return;
 
     case MZF_STAGE::STM_SHORT:
-      if (mzf_emit_pulse(false)) {
-        if (--mzf_tm_left == 0) {
-          mzf_next_stage(MZF_STAGE::STM_ENDLONG);
-        }
+      if (mzf_emit_run(false)) {
+        mzf_next_stage(MZF_STAGE::STM_ENDLONG);
       }
       return;
 
@@ -308,24 +332,21 @@ void mzf_process() {
       if (mzf_emit_pulse(true)) {
         // file body (copy 1)
         bytesRead = 128;
-        mzf_file_left = mzf_file_len;
-        mzf_file_cksum = 0;
-        mzf_reset_byte_writer_for_src(BYTE_SRC::FILE);
+        bytesrc_clear();
+        bytesrc_file(mzf_file_len);
         mzf_next_stage(MZF_STAGE::FILE1);
       }
       return;
 
     case MZF_STAGE::FILE1:
-      mzf_process_bytes(0);
-      if (currentPeriod == 0) {
-        mzf_reset_byte_writer_for_src(BYTE_SRC::CHK);
+      if (mzf_process_bytes()) {
+        mzf_queue_chk(mzf_file_cksum);
         mzf_next_stage(MZF_STAGE::CHKF1);
       }
       return;
 
     case MZF_STAGE::CHKF1:
-      mzf_process_bytes(2);
-      if (currentPeriod == 0) {
+      if (mzf_process_bytes()) {
         // Many Sharp MZ loaders will successfully load from the first payload copy.
         // MaxDuino's progress indicator is based on file length, so emitting the
         // conventional second copy makes playback appear to "start again".
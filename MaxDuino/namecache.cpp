@@ -0,0 +1,133 @@
+#include "configs.h"
+#include "namecache.h"
+
+#ifdef NAME_CACHE
+
+#include "hwconfig.h"
+#include "file_utils.h"
+
+#if NAMECACHE_LEN > filenameLength
+  #error NAMECACHE_LEN is longer than fileName holds (NAME_WINDOW)
+#endif
+
+namespace {
+struct CachedName {
+  uint16_t pos;
+  unsigned long size;
+  bool dir;
+  bool fits;                    // false: too long, name isn't kept
+  char name[NAMECACHE_LEN+1];
+};
+CachedName cache[NAMECACHE_ENTRIES];
+byte cacheCount = 0;
+uint16_t cacheFrom = 0;         // the window covers directory positions cacheFrom..cacheTo
+uint16_t cacheTo = 0;
+bool cacheValid = false;
+} // anonymous namespace
+
+void namecache_clear() {
+  cacheCount = 0;
+  cacheFrom = cacheTo = 0;
+  cacheValid = false;
+}
+
+void namecache_add(uint16_t pos) {
+  // entry is the open entry at pos
+  if (cacheCount == NAMECACHE_ENTRIES) return;
+  if (cacheCount == 0) cacheFrom = 0;
+  CachedName &c = cache[cacheCount++];
+  c.pos = pos;
+  c.size = entry.fileSize();
+  char name[NAMECACHE_LEN+2] = "";
+  c.fits = entry.getName(name, sizeof(name)) && strlen(name) <= NAMECACHE_LEN;
+  if (c.fits) strcpy(c.name, name);
+  c.dir = entry.isDir() || !strcmp(name, "ROOT");
+  cacheTo = pos;
+  cacheValid = true;
+}
+
+#ifdef EXFAT_SCAN
+namespace {
+void put(const DirScanEntry &e) {
+  CachedName &c = cache[cacheCount++];
+  c.pos = e.pos;
+  c.size = e.size;
+  c.fits = strlen(e.name) <= NAMECACHE_LEN;
+  c.name[0] = '\0';
+  if (c.fits) strcpy(c.name, e.name);
+  c.dir = e.dir || !strcmp(e.name, "ROOT");
+  cacheTo = e.pos;
+}
+} // anonymous namespace
+
+void namecache_add(const DirScanEntry &e) {
+  if (cacheCount == NAMECACHE_ENTRIES) return;
+  if (cacheCount == 0) cacheFrom = 0;
+  put(e);
+  cacheValid = true;
+}
+#endif
+
+void namecache_fill(uint16_t pos) {
+  namecache_clear();
+  const uint16_t from = (pos > NAMECACHE_ENTRIES/4) ? pos - NAMECACHE_ENTRIES/4 : 0;
+#ifdef EXFAT_SCAN
+  if (dirscan_begin(from)) {
+    const DirScanEntry *e;
+    while (cacheCount < NAMECACHE_ENTRIES && (e = dirscan_next()) != nullptr) put(*e);
+  } else
+#endif
+  {
+    SdBaseFile f;
+    currentDir->seekSet(32UL * from);
+    while (cacheCount < NAMECACHE_ENTRIES && f.openNext(currentDir, O_RDONLY)) {
+      const uint16_t p = currentDir->curPosition()/32-1;
+      CachedName &c = cache[cacheCount++];
+      c.pos = p;
+      c.size = f.fileSize();
+      char name[NAMECACHE_LEN+2] = "";
+      c.fits = f.getName(name, sizeof(name)) && strlen(name) <= NAMECACHE_LEN;
+      if (c.fits) strcpy(c.name, name);
+      c.dir = f.isDir() || !strcmp(name, "ROOT");
+      f.close();
+      cacheTo = p;
+    }
+  }
+  // a window that stops short ran into the end: it covers the rest too
+  if (cacheCount < NAMECACHE_ENTRIES) cacheTo = 0xFFFF;
+  cacheFrom = from;
+  cacheValid = true;
+  currentDir->rewind();
+}
+
+bool namecache_covers(uint16_t pos) {
+  return cacheValid && pos >= cacheFrom && pos <= cacheTo;
+}
+
+bool namecache_get(uint16_t &pos, char *name, unsigned long &size, bool &dir) {
+  if (!namecache_covers(pos)) return false;
+  for (byte i = 0; i < cacheCount; i++) {
+    const CachedName &c = cache[i];
+    if (c.pos < pos) continue;
+    if (!c.fits) return false;
+    pos = c.pos;
+    strcpy(name, c.name);
+    size = c.size;
+    dir = c.dir;
+    return true;
+  }
+  return false;
+}
+
+bool namecache_prev(uint16_t &pos) {
+  if (!cacheValid || pos <= cacheFrom || pos > cacheTo + 1) return false;
+  for (byte i = cacheCount; i-- > 0; ) {
+    if (cache[i].pos < pos) {
+      pos = cache[i].pos;
+      return true;
+    }
+  }
+  return false;
+}
+
+#endif // NAME_CACHE
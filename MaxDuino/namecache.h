@@ -0,0 +1,39 @@
+#ifndef NAMECACHE_H_INCLUDED
+#define NAMECACHE_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef NAME_CACHE
+#include "Arduino.h"
+#include "dirscan.h"
+
+// Names, sizes and dir flags for a window of NAMECACHE_ENTRIES directory
+// entries (hwconfig.h), read in one pass over the directory, so moving the
+// cursor inside the window is a RAM copy rather than an entry.open() and
+// getName() (which on FAT re-reads all of a long name's entries).  Names
+// longer than NAMECACHE_LEN aren't kept, and those are opened as before.
+//
+// getMaxFile() fills the window from the start of the directory as it
+// counts.  Going outside it reads a new window around the new position
+// (except with SORTED_DIR, whose order jumps about the directory, so
+// there a miss is just opened).
+
+void namecache_clear();
+// Called for each entry as getMaxFile() walks the directory (entry is open)
+void namecache_add(uint16_t pos);
+#ifdef EXFAT_SCAN
+// The same, for an entry dirscan_next() has read
+void namecache_add(const DirScanEntry &e);
+#endif
+// Read a new window, starting a quarter of a window before pos
+void namecache_fill(uint16_t pos);
+// The first entry at or after pos, if the window covers pos: sets pos to
+// it, and fills name (which must hold NAMECACHE_LEN+1), size and dir.
+bool namecache_get(uint16_t &pos, char *name, unsigned long &size, bool &dir);
+// Whether pos is inside the window (whether or not its name was kept)
+bool namecache_covers(uint16_t pos);
+// The valid entry before pos, if the window covers it
+bool namecache_prev(uint16_t &pos);
+#endif
+
+#endif // NAMECACHE_H_INCLUDED
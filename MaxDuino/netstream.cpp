@@ -0,0 +1,148 @@
+#include "netstream.h"
+
+#ifdef NET_STREAM
+
+#if !defined(ESP32) || !defined(WIFI_SERVICE)
+  #error NET_STREAM needs an ESP32 with WIFI_SERVICE
+#endif
+
+#include <HTTPClient.h>
+#include "file_utils.h"
+
+#define NET_RING_MASK (NET_RING_SIZE-1)
+#define NET_SKIP      8192      // a jump forward up to this far just reads on, rather than asking again
+#define NET_TIMEOUT   2000      // ms without a byte before a read gives up
+#define NET_NAME_MAX  (filenameLength-1)   // fileName holds filenameLength (file_utils.h)
+
+bool net_active = false;
+
+namespace {
+HTTPClient http;
+String netUrl;
+WiFiClient *stream = nullptr;
+unsigned long netSize = 0;
+
+// ring[ringHead] holds file position ringPos, and ringCount bytes follow it
+byte ring[NET_RING_SIZE];
+word ringHead = 0;
+word ringCount = 0;
+unsigned long ringPos = 0;
+unsigned long netReadPos = 0;   // where the player is reading; only bytes before this are let go
+
+void ring_drop(word d) {
+  ringHead = (ringHead + d) & NET_RING_MASK;
+  ringCount -= d;
+  ringPos += d;
+}
+
+bool request(unsigned long from) {
+  // (re)start the body at from, or at 0 if the server won't do ranges
+  http.end();
+  stream = nullptr;
+  http.begin(netUrl);
+  if (from) http.addHeader(F("Range"), String(F("bytes=")) + from + '-');
+  const int code = http.GET();
+  if (code == HTTP_CODE_PARTIAL_CONTENT) {
+    ringPos = from;
+  } else if (code == HTTP_CODE_OK) {
+    ringPos = 0;
+  } else {
+    return false;
+  }
+  ringHead = 0;
+  ringCount = 0;
+  stream = http.getStreamPtr();
+  return true;
+}
+} // namespace
+
+bool net_open(const char *url) {
+  net_close();
+  netUrl = url;
+  if (!request(0)) return false;
+  const int size = http.getSize();
+  if (size <= 0) {
+    // chunked, or no length: the players all need filesize
+    net_close();
+    return false;
+  }
+  netSize = size;
+  filesize = size;
+  netReadPos = 0;
+
+  // the name is the last part of the path, without any query
+  const char *name = strrchr(url, '/');
+  name = name ? name+1 : url;
+  byte i = 0;
+  while (name[i] && name[i] != '?' && i < NET_NAME_MAX) {
+    fileName[i] = name[i];
+    i++;
+  }
+  fileName[i] = '\0';
+
+  net_active = true;
+  return true;
+}
+
+void net_close() {
+  http.end();
+  stream = nullptr;
+  net_active = false;
+}
+
+void net_service() {
+  if (!net_active || stream == nullptr) return;
+  for (;;) {
+    const unsigned long end = ringPos + ringCount;
+    if (end >= netSize || end >= netReadPos + NET_PREFETCH) return;
+    const int avail = stream->available();
+    if (avail <= 0) return;
+    if (ringCount == NET_RING_SIZE) {
+      // full: let go of the oldest bytes, the ones already read
+      if (netReadPos <= ringPos) return;
+      const unsigned long old = netReadPos - ringPos;
+      ring_drop((old < 1024) ? old : 1024);
+    }
+    const word tail = (ringHead + ringCount) & NET_RING_MASK;
+    word space = NET_RING_SIZE - ringCount;
+    if (space > NET_RING_SIZE - tail) space = NET_RING_SIZE - tail;
+    if (space > (word)avail) space = avail;
+    const int r = stream->read(ring + tail, space);
+    if (r <= 0) return;
+    ringCount += r;
+  }
+}
+
+word net_read(unsigned long pos, byte *dst, word n) {
+  if (!net_active || pos >= netSize) return 0;
+  if (n > netSize - pos) n = netSize - pos;
+
+  if (pos < ringPos || pos > ringPos + ringCount + NET_SKIP) {
+    if (!request(pos)) return 0;
+  }
+  netReadPos = pos;
+
+  // normally already there (net_service runs from loop()), otherwise wait
+  unsigned long t = millis();
+  while (ringPos + ringCount < pos + n) {
+    const unsigned long before = ringPos + ringCount;
+    net_service();
+    if (ringPos + ringCount != before) {
+      t = millis();
+    } else if (millis() - t > NET_TIMEOUT) {
+      break;
+    }
+  }
+  if (pos < ringPos || pos >= ringPos + ringCount) return 0;
+
+  word offset = (pos - ringPos);
+  word m = ringCount - offset;
+  if (m > n) m = n;
+  for (word i = 0; i < m; i++) {
+    dst[i] = ring[(ringHead + offset + i) & NET_RING_MASK];
+  }
+  netReadPos = pos + m;
+  return m;
+}
+
+#endif // NET_STREAM
@@ -0,0 +1,40 @@
+#ifndef NETSTREAM_H_INCLUDED
+#define NETSTREAM_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef NET_STREAM
+#include "Arduino.h"
+
+// Plays a tape image straight from an HTTP URL (ESP32, with WIFI_SERVICE).
+// While active, readfile() and friends read from the network instead of
+// entry: the body is pulled into a RAM ring by net_service() from the main
+// loop, kept NET_PREFETCH bytes ahead of the player where it can.  Reading
+// forwards is streamed; reading anywhere else asks the server again with a
+// Range header (or, if it ignores that, from the top).
+//
+// Only the formats that read through readfile() can be streamed (TZX, TAP,
+// CDT, P, O, UEF, CSW and so on); MZF and MTX go to entry directly.
+
+#ifndef NET_RING_SIZE
+  #define NET_RING_SIZE 16384   // must be a power of 2
+#endif
+#ifndef NET_PREFETCH
+  #define NET_PREFETCH (NET_RING_SIZE*3/4)
+#endif
+
+extern bool net_active;
+
+// Start streaming url: sets filesize, and fileName to the last part of the path
+bool net_open(const char *url);
+
+void net_close();
+
+// Top up the ring from the network, as far as NET_PREFETCH ahead
+void net_service();
+
+// Read up to n bytes starting at pos into dst; returns how many
+word net_read(unsigned long pos, byte *dst, word n);
+#endif
+
+#endif // NETSTREAM_H_INCLUDED
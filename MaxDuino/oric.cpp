@@ -5,6 +5,8 @@
 #include "current_settings.h"
 #include "MaxProcessing.h"
 #include "file_utils.h"
+#include "buffer.h"
+#include "pwmbyte.h"
 
 #ifdef tapORIC
 namespace {
@@ -17,75 +19,60 @@ static inline bool oric_turbo_enabled() {
   #endif
 }
 
+// Oric byte: start bit 0, 8 data bits LSb first, odd parity, 3 stop bits 1.
+// A zero is a short low then a long high half, a one two short halves
+const PWM_FORMAT ORIC_PWM = {
+  { ORICZEROLOWPULSE, ORICZEROHIGHPULSE },
+  { ORICONEPULSE, ORICONEPULSE },
+  2, 2, false,
+  1, false,
+  3, true,
+  PWM_PARITY_ODD
+};
+
+#ifdef ORICSPEEDUP
+const PWM_FORMAT ORIC_TURBO_PWM = {
+  { ORICTURBOZEROLOWPULSE, ORICTURBOZEROHIGHPULSE },
+  { ORICTURBOONEPULSE, ORICTURBOONEPULSE },
+  2, 2, false,
+  1, false,
+  3, true,
+  PWM_PARITY_ODD
+};
+#endif
+
 static inline word oric_one_pulse() {
   return oric_turbo_enabled() ? ORICTURBOONEPULSE : ORICONEPULSE;
 }
 
-static inline word oric_zero_pulse(const bool highHalf) {
-  if (oric_turbo_enabled()) {
-    return highHalf ? ORICTURBOZEROHIGHPULSE : ORICTURBOZEROLOWPULSE;
-  }
-  return highHalf ? ORICZEROHIGHPULSE : ORICZEROLOWPULSE;
-}
-
 static inline void oric_prepare_byte(const byte value) {
-  currentByte = value;
-  currentBit = 11;
-  bitChecksum = 0;
+  #ifdef ORICSPEEDUP
+    pwm_begin_byte(oric_turbo_enabled() ? ORIC_TURBO_PWM : ORIC_PWM, value);
+  #else
+    pwm_begin_byte(ORIC_PWM, value);
+  #endif
+  currentBit = 1;                   // a byte is under way
   lastByte = 0;
 }
 
-static inline void oric_write_gap_pulse() {
-  currentPeriod = oric_one_pulse();
+static inline void oric_write_gap_pulses() {
+  // the count_r gap edges as one repeat (the period follows as pendingWord)
+  const byte n = (count_r > PULSE_REPEAT_MAX) ? PULSE_REPEAT_MAX : count_r;
+  currentPeriod = PULSE_REPEAT_FLAG | n;
+  pendingWord = oric_one_pulse();
+  count_r -= n;
 }
 
 } // namespace
 
 void OricBitWrite() {
-  if (currentBit == 11) { // Start bit
-    currentPeriod = oric_zero_pulse(pass != 0);
-  } else if (currentBit == 2) { // Odd parity
-    currentPeriod = bitChecksum ? oric_zero_pulse(pass != 0) : oric_one_pulse();
-  } else if (currentBit == 1) {
-    currentPeriod = oric_one_pulse();
-  } else {
-    if(currentByte&0x01) {
-      currentPeriod = oric_one_pulse();
-    } else {
-      currentPeriod = oric_zero_pulse(pass != 0);
-    }
-  }   
-
-  pass+=1;      //Data is played as 2 x pulses for a zero, and 2 pulses for a one
-  if (currentPeriod == oric_one_pulse()) {
+  // The whole byte, start to stop bits, goes straight into the buffer
+  // (pwm_write), so currentPeriod stays 0
+  currentPeriod = 0;
+  if (!pwm_write()) return;
+  currentBit = 0;
 
-    if ((currentBit>2) && (currentBit<11) && (pass==2)) {
-      bitChecksum ^= 1;
-      currentByte >>= 1;                        //Shift along to the next bit
-      currentBit += -1;
-      pass=0;
-    }
-    if ((currentBit==1) && (pass==6)) {
-      currentBit += -1;
-      pass=0;
-    }
-    if (((currentBit==2) || (currentBit==11))  && (pass==2)) {
-      currentBit += -1;
-      pass=0;
-    }
-  }
-  else {
-    // must be a zero pulse
-    if(pass==2) {
-      if ((currentBit>2) && (currentBit<11)) {
-        currentByte >>= 1;                        //Shift along to the next bit
-      }
-      currentBit += -1;
-      pass=0; 
-    }
-  }
-
-  if ((currentBit==0) && (lastByte)) {
+  if (lastByte) {
   #ifdef MenuBLK2A 
     count_r = 255; 
     if(ReadByte()) { 
@@ -103,13 +90,12 @@ void OricBitWrite() {
 }
 
 void OricDataBlock() {
-  //Convert byte from file into string of pulses.  One pulse per pass
+  //Convert byte from file into string of pulses
   if(currentBit==0) {                         //Check for byte end/first byte
     
     if(ReadByte()) {            //Read in a byte
-      currentByte = outByte;
+      oric_prepare_byte(outByte);
       bytesToRead += -1;
-      bitChecksum = 0;
       if(bytesToRead == 0) {                  //Check for end of data block
         lastByte = 1;
       }
@@ -118,17 +104,13 @@ void OricDataBlock() {
       currentTask = TASK::GETID;
       return;
     }
-
-    currentBit = 11;
-    pass=0;
   }
   OricBitWrite();
 }
 
 void FlushBuffer(long newcount) {
   if(count_r>0) {
-    oric_write_gap_pulse();
-    count_r--;
+    oric_write_gap_pulses();
   } else {   
     count_r= newcount;
     currentBlockTask = BLOCKTASK::SYNC1;
@@ -148,7 +130,7 @@ void tzx_process_blockid_oric() {
       } else {
         ReadByte();
         oric_prepare_byte(outByte);
-        if (currentByte==0x16) {
+        if (outByte==0x16) {
             count_r--;
         } else {
             currentBit = 0;
@@ -211,7 +193,7 @@ void tzx_process_blockid_oric() {
       } else {
         ReadByte();
         oric_prepare_byte(outByte);
-        if (currentByte==0x00) {
+        if (outByte==0x00) {
           count_r=1;
           currentBit = 0;
           currentBlockTask=BLOCKTASK::NAME00;
@@ -236,8 +218,7 @@ void tzx_process_blockid_oric() {
 
     case BLOCKTASK::GAP:
       if(count_r>0) {
-        oric_write_gap_pulse();
-        count_r--;
+        oric_write_gap_pulses();
       } else {   
         currentBlockTask=BLOCKTASK::TDATA;
       }             
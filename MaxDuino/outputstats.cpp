@@ -0,0 +1,106 @@
+#include "configs.h"
+#include "outputstats.h"
+
+#ifdef OUTPUT_STATS
+
+#include "buffer.h"
+
+namespace {
+// only written by the ISR (or with the timer stopped)
+unsigned long isrStart;
+unsigned long isrMin;
+unsigned long isrMax;
+unsigned long isrSum;
+unsigned long isrCount;
+unsigned long lastEntry;
+unsigned long lastPeriod;
+long jitterMin;
+long jitterMax;
+byte pagesAheadMin;
+word catchUps;        // ISR finished a page and took the one the main loop had only just filled
+word stalls;          // ISR finished a page and had to wait for the main loop to fill the next one
+}
+
+void stats_reset() {
+  noInterrupts();
+  isrMin = 0xFFFFFFFFUL;
+  isrMax = 0;
+  isrSum = 0;
+  isrCount = 0;
+  lastEntry = 0;
+  lastPeriod = 0;
+  jitterMin = 0x7FFFFFFFL;
+  jitterMax = -0x7FFFFFFFL;
+  pagesAheadMin = BUFFER_PAGES;
+  catchUps = 0;
+  stalls = 0;
+  interrupts();
+}
+
+ISR_CODE void stats_isr_begin() {
+  const unsigned long t = micros();
+  if (lastEntry && lastPeriod) {
+    // how late (or early) this edge is against the period we asked for
+    const long jitter = (long)(t - lastEntry) - (long)lastPeriod;
+    if (jitter < jitterMin) jitterMin = jitter;
+    if (jitter > jitterMax) jitterMax = jitter;
+  }
+  lastEntry = t;
+  isrStart = t;
+}
+
+ISR_CODE void stats_isr_end(unsigned long period) {
+  const unsigned long dt = micros() - isrStart;
+  if (dt < isrMin) isrMin = dt;
+  if (dt > isrMax) isrMax = dt;
+  isrSum += dt;
+  isrCount++;
+  lastPeriod = period;
+}
+
+ISR_CODE void stats_page_swap(byte pagesAhead, bool caughtUp) {
+  if (pagesAhead < pagesAheadMin) pagesAheadMin = pagesAhead;
+  if (caughtUp) catchUps++;
+}
+
+ISR_CODE void stats_underrun() {
+  stalls++;
+}
+
+#ifdef SERIALSCREEN
+void stats_print() {
+  if (isrCount == 0) return;
+  Serial.println(F("-- output stats --"));
+  Serial.print(F("ISR us min/avg/max: "));
+  Serial.print(isrMin);
+  Serial.print('/');
+  Serial.print(isrSum / isrCount);
+  Serial.print('/');
+  Serial.println(isrMax);
+  Serial.print(F("Edge late us min/max: "));
+  Serial.print(jitterMin);
+  Serial.print('/');
+  Serial.println(jitterMax);
+  Serial.print(F("Pages ahead min: "));
+  Serial.print(pagesAheadMin);
+  Serial.print(F(" of "));
+  Serial.println(BUFFER_PAGES);
+  Serial.print(F("Catch-ups: "));
+  Serial.print(catchUps);
+  Serial.print(F(" underruns: "));
+  Serial.println(stalls);
+}
+#endif
+
+void stats_get(OutputStats &s) {
+  noInterrupts();
+  s.isrMax = isrMax;
+  s.isrAvg = isrCount ? isrSum / isrCount : 0;
+  s.lateMax = jitterMax > 0 ? jitterMax : 0;
+  s.pagesAheadMin = pagesAheadMin;
+  s.catchUps = catchUps;
+  s.underruns = stalls;
+  interrupts();
+}
+
+#endif // OUTPUT_STATS
@@ -0,0 +1,41 @@
+#ifndef OUTPUTSTATS_H_INCLUDED
+#define OUTPUTSTATS_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef OUTPUT_STATS
+#include "Arduino.h"
+
+// Output timing statistics, for tuning turbo settings per board.
+// Measures how long wave2 takes, how late each edge is compared to the
+// period that was asked for, and how far ahead of the ISR the main loop
+// keeps the buffer.  Printed over the serial port when playback stops.
+// (micros() resolution is 4us on 16MHz AVRs, so treat small numbers there
+// as approximate.)  SOAK_TEST keeps them for each pass instead, so it
+// doesn't need the serial port.
+
+#if !defined(SERIALSCREEN) && !defined(SOAK_TEST)
+  #error OUTPUT_STATS prints over the serial port, so needs SERIALSCREEN
+#endif
+
+struct OutputStats {
+  unsigned long isrMax;         // us
+  unsigned long isrAvg;
+  unsigned long lateMax;        // us, the latest edge
+  byte pagesAheadMin;           // of BUFFER_PAGES
+  word catchUps;
+  word underruns;
+};
+
+void stats_reset();                         // start of each file
+void stats_isr_begin();                     // first thing in wave2
+void stats_isr_end(unsigned long period);   // last thing in wave2, with the period just set
+void stats_page_swap(byte pagesAhead, bool caughtUp);  // from next_read_page
+void stats_underrun();                      // from read_page_ready
+#ifdef SERIALSCREEN
+void stats_print();                         // end of each file
+#endif
+void stats_get(OutputStats &s);             // since stats_reset, with the timer stopped
+#endif
+
+#endif // OUTPUTSTATS_H_INCLUDED
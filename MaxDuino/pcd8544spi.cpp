@@ -0,0 +1,178 @@
+#include "configs.h"
+#include "pcd8544spi.h"
+
+#ifdef P8544_SPI
+
+#include <SPI.h>
+
+namespace {
+const SPISettings p8544SPISettings(P8544_SPI_CLOCK, MSBFIRST, SPI_MODE0);
+
+// 5x7 glyphs from 0x20, a column a byte (lsb at the top), and a blank column after each
+const byte FONT5x7[96][5] PROGMEM = {
+  {0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x5f,0x00,0x00}, {0x00,0x07,0x00,0x07,0x00}, {0x14,0x7f,0x14,0x7f,0x14},
+  {0x24,0x2a,0x7f,0x2a,0x12}, {0x23,0x13,0x08,0x64,0x62}, {0x36,0x49,0x55,0x22,0x50}, {0x00,0x05,0x03,0x00,0x00},
+  {0x00,0x1c,0x22,0x41,0x00}, {0x00,0x41,0x22,0x1c,0x00}, {0x14,0x08,0x3e,0x08,0x14}, {0x08,0x08,0x3e,0x08,0x08},
+  {0x00,0x50,0x30,0x00,0x00}, {0x08,0x08,0x08,0x08,0x08}, {0x00,0x60,0x60,0x00,0x00}, {0x20,0x10,0x08,0x04,0x02},
+  {0x3e,0x51,0x49,0x45,0x3e}, {0x00,0x42,0x7f,0x40,0x00}, {0x42,0x61,0x51,0x49,0x46}, {0x21,0x41,0x45,0x4b,0x31},
+  {0x18,0x14,0x12,0x7f,0x10}, {0x27,0x45,0x45,0x45,0x39}, {0x3c,0x4a,0x49,0x49,0x30}, {0x01,0x71,0x09,0x05,0x03},
+  {0x36,0x49,0x49,0x49,0x36}, {0x06,0x49,0x49,0x29,0x1e}, {0x00,0x36,0x36,0x00,0x00}, {0x00,0x56,0x36,0x00,0x00},
+  {0x08,0x14,0x22,0x41,0x00}, {0x14,0x14,0x14,0x14,0x14}, {0x00,0x41,0x22,0x14,0x08}, {0x02,0x01,0x51,0x09,0x06},
+  {0x32,0x49,0x79,0x41,0x3e}, {0x7e,0x11,0x11,0x11,0x7e}, {0x7f,0x49,0x49,0x49,0x36}, {0x3e,0x41,0x41,0x41,0x22},
+  {0x7f,0x41,0x41,0x22,0x1c}, {0x7f,0x49,0x49,0x49,0x41}, {0x7f,0x09,0x09,0x09,0x01}, {0x3e,0x41,0x49,0x49,0x7a},
+  {0x7f,0x08,0x08,0x08,0x7f}, {0x00,0x41,0x7f,0x41,0x00}, {0x20,0x40,0x41,0x3f,0x01}, {0x7f,0x08,0x14,0x22,0x41},
+  {0x7f,0x40,0x40,0x40,0x40}, {0x7f,0x02,0x0c,0x02,0x7f}, {0x7f,0x04,0x08,0x10,0x7f}, {0x3e,0x41,0x41,0x41,0x3e},
+  {0x7f,0x09,0x09,0x09,0x06}, {0x3e,0x41,0x51,0x21,0x5e}, {0x7f,0x09,0x19,0x29,0x46}, {0x46,0x49,0x49,0x49,0x31},
+  {0x01,0x01,0x7f,0x01,0x01}, {0x3f,0x40,0x40,0x40,0x3f}, {0x1f,0x20,0x40,0x20,0x1f}, {0x3f,0x40,0x38,0x40,0x3f},
+  {0x63,0x14,0x08,0x14,0x63}, {0x07,0x08,0x70,0x08,0x07}, {0x61,0x51,0x49,0x45,0x43}, {0x00,0x7f,0x41,0x41,0x00},
+  {0x02,0x04,0x08,0x10,0x20}, {0x00,0x41,0x41,0x7f,0x00}, {0x04,0x02,0x01,0x02,0x04}, {0x40,0x40,0x40,0x40,0x40},
+  {0x00,0x01,0x02,0x04,0x00}, {0x20,0x54,0x54,0x54,0x78}, {0x7f,0x48,0x44,0x44,0x38}, {0x38,0x44,0x44,0x44,0x20},
+  {0x38,0x44,0x44,0x48,0x7f}, {0x38,0x54,0x54,0x54,0x18}, {0x08,0x7e,0x09,0x01,0x02}, {0x0c,0x52,0x52,0x52,0x3e},
+  {0x7f,0x08,0x04,0x04,0x78}, {0x00,0x44,0x7d,0x40,0x00}, {0x20,0x40,0x44,0x3d,0x00}, {0x7f,0x10,0x28,0x44,0x00},
+  {0x00,0x41,0x7f,0x40,0x00}, {0x7c,0x04,0x18,0x04,0x78}, {0x7c,0x08,0x04,0x04,0x78}, {0x38,0x44,0x44,0x44,0x38},
+  {0x7c,0x14,0x14,0x14,0x08}, {0x08,0x14,0x14,0x18,0x7c}, {0x7c,0x08,0x04,0x04,0x08}, {0x48,0x54,0x54,0x54,0x20},
+  {0x04,0x3f,0x44,0x40,0x20}, {0x3c,0x40,0x40,0x20,0x7c}, {0x1c,0x20,0x40,0x20,0x1c}, {0x3c,0x40,0x30,0x40,0x3c},
+  {0x44,0x28,0x10,0x28,0x44}, {0x0c,0x50,0x50,0x50,0x3c}, {0x44,0x64,0x54,0x4c,0x44}, {0x00,0x08,0x36,0x41,0x00},
+  {0x00,0x00,0x7f,0x00,0x00}, {0x00,0x41,0x36,0x08,0x00}, {0x10,0x08,0x08,0x10,0x08}, {0x00,0x00,0x00,0x00,0x00},
+};
+} // anonymous namespace
+
+P8544Spi::P8544Spi(byte dc, byte reset, byte cs) : dcPin(dc), resetPin(reset), csPin(cs) {}
+
+void P8544Spi::command(byte c) {
+  SPI.beginTransaction(p8544SPISettings);
+  digitalWrite(dcPin, LOW);
+  digitalWrite(csPin, LOW);
+  SPI.transfer(c);
+  digitalWrite(csPin, HIGH);
+  SPI.endTransaction();
+}
+
+void P8544Spi::begin() {
+  pinMode(csPin, OUTPUT);
+  digitalWrite(csPin, HIGH);
+  pinMode(dcPin, OUTPUT);
+  pinMode(resetPin, OUTPUT);
+  digitalWrite(resetPin, LOW);
+  delay(10);
+  digitalWrite(resetPin, HIGH);
+  SPI.begin();
+  command(0x21);                      // extended instructions
+  command(0x80 | P8544_CONTRAST);
+  command(0x04);                      // temperature coefficient 0
+  command(0x14);                      // bias 1:48
+  command(0x20);                      // basic instructions, across then down
+  command(0x0C);                      // normal (not inverted)
+  // what's on the display after reset isn't known, so all of it goes out
+  memset(shadow, 0, sizeof(shadow));
+  for (byte r = 0; r < ROWS; r++) {
+    dirtyLo[r] = 0;
+    dirtyHi[r] = WIDTH-1;
+  }
+  row = col = 0;
+  flush();
+}
+
+void P8544Spi::put(byte b) {
+  if (col >= WIDTH) return;           // off the end of the row: cut off, not wrapped
+  if (shadow[row][col] != b) {
+    shadow[row][col] = b;
+    if (dirtyLo[row] > dirtyHi[row]) {
+      dirtyLo[row] = dirtyHi[row] = col;
+    } else if (col < dirtyLo[row]) {
+      dirtyLo[row] = col;
+    } else if (col > dirtyHi[row]) {
+      dirtyHi[row] = col;
+    }
+  }
+  col++;
+}
+
+void P8544Spi::changed() {
+  if (!deferring) flush();
+}
+
+void P8544Spi::clear() {
+  for (row = 0; row < ROWS; row++) {
+    for (col = 0; col < WIDTH; ) put(0);
+  }
+  row = col = 0;
+  changed();
+}
+
+void P8544Spi::setCursor(byte c, byte r) {
+  row = r % ROWS;
+  col = c * 6;
+}
+
+void P8544Spi::gotoRc(byte r, byte c) {
+  row = r % ROWS;
+  col = c;
+}
+
+void P8544Spi::data(byte b) {
+  put(b);
+  changed();
+}
+
+void P8544Spi::bitmap(const byte *bdata, byte rows, byte columns) {
+  const byte top = row;
+  const byte left = col;
+  for (byte r = 0; r < rows && top + r < ROWS; r++) {
+    row = top + r;
+    col = left;
+    for (byte c = 0; c < columns; c++) put(pgm_read_byte(bdata++));
+  }
+  changed();
+}
+
+size_t P8544Spi::write(uint8_t c) {
+  if (c < 0x20 || c > 0x7F) c = ' ';
+  const byte *g = FONT5x7[c - 0x20];
+  for (byte i = 0; i < 5; i++) put(pgm_read_byte(g + i));
+  put(0);
+  changed();
+  return 1;
+}
+
+void P8544Spi::defer(bool on) {
+  deferring = on;
+  if (!on) flush();
+}
+
+void P8544Spi::send_row(byte r) {
+  const byte lo = dirtyLo[r];
+  const byte n = dirtyHi[r] - lo + 1;
+  dirtyLo[r] = WIDTH;
+  dirtyHi[r] = 0;
+  SPI.beginTransaction(p8544SPISettings);
+  digitalWrite(csPin, LOW);
+  digitalWrite(dcPin, LOW);
+  SPI.transfer(0x80 | lo);            // X address
+  SPI.transfer(0x40 | r);             // Y address (the row)
+  digitalWrite(dcPin, HIGH);
+#if defined(__arm__) && defined(__STM32F1__)
+  SPI.dmaSend(shadow[r] + lo, n);
+#else
+  const byte *p = shadow[r] + lo;
+  for (byte i = 0; i < n; i++) SPI.transfer(p[i]);   // (SPI.transfer(buf, n) would write what comes back over the copy)
+#endif
+  digitalWrite(csPin, HIGH);
+  SPI.endTransaction();
+}
+
+bool P8544Spi::update() {
+  for (byte r = 0; r < ROWS; r++) {
+    if (dirtyLo[r] <= dirtyHi[r]) {
+      send_row(r);
+      return true;
+    }
+  }
+  return false;
+}
+
+void P8544Spi::flush() {
+  while (update()) {}
+}
+
+#endif // P8544_SPI
@@ -0,0 +1,69 @@
+#ifndef PCD8544SPI_H_INCLUDED
+#define PCD8544SPI_H_INCLUDED
+
+#include "Arduino.h"
+#include "configs.h"
+
+#ifdef P8544_SPI
+// The Nokia 5110 (PCD8544) on the hardware SPI bus the SD card is on, in
+// place of the bit-banged pcd8544 library (the same calls, so Display.cpp
+// and the rest don't change).  Everything drawn goes into a copy of the
+// screen in RAM (84 x 6 rows, 504 bytes), and only the bytes that changed
+// go to the display: for each row the span from the first to the last of
+// them, one address command and one run of data (by DMA on the STM32F1).
+//
+// While playing (defer), nothing goes out as it's drawn: UniLoop sends a
+// row at a time with update() once the buffer is full, so a block number
+// or the counter is a few bytes between refills instead of a whole line
+// held up on the main loop.  Stopped, each call sends its changes itself.
+//
+// The display's DIN and CLK go to the SPI MOSI and SCK pins, with CE, DC
+// and RST on cs_pin, dc_pin and reset_pin (i2c.h).
+
+#ifndef P8544
+  #error P8544_SPI is a driver for the P8544 display
+#endif
+
+#ifndef P8544_SPI_CLOCK
+  #define P8544_SPI_CLOCK 4000000L    // the PCD8544's most
+#endif
+#ifndef P8544_CONTRAST
+  #define P8544_CONTRAST 0x30         // Vop, 0 to 0x7F
+#endif
+
+class P8544Spi : public Print
+{
+  public:
+    P8544Spi(byte dc, byte reset, byte cs);
+    void begin();
+    void clear();
+    void setCursor(byte col, byte row);   // in characters, 14 by 6
+    void gotoRc(byte row, byte col);      // col in pixels
+    void data(byte b);                    // 8 pixels down, at the cursor
+    void bitmap(const byte *bdata, byte rows, byte columns);   // from PROGMEM, at the cursor
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    void defer(bool on);                  // true while playing; false sends what's waiting
+    bool update();                        // one row's changes out, false if there were none
+    void flush();                         // all of them
+
+  private:
+    static constexpr byte WIDTH = 84;
+    static constexpr byte ROWS = 6;
+    byte dcPin, resetPin, csPin;
+    byte shadow[ROWS][WIDTH];
+    byte dirtyLo[ROWS];                   // the changed span of each row, lo > hi if none
+    byte dirtyHi[ROWS];
+    byte row = 0;
+    byte col = 0;
+    bool deferring = false;
+
+    void put(byte b);
+    void changed();
+    void command(byte c);
+    void send_row(byte r);
+};
+#endif
+
+#endif // PCD8544SPI_H_INCLUDED
@@ -152,6 +152,20 @@ void pinsetup()
   pinMode(btnRoot, INPUT_PULLUP);
   digitalWrite(btnRoot, HIGH); 
 
+  #if defined(Use_Rec) && defined(btnRec)
+    pinMode(btnRec, INPUT_PULLUP);
+  #endif
+
+#elif defined(ARDUINO_ARCH_RP2040)
+
+  //Setup buttons with internal pullup 
+  pinMode(btnPlay,INPUT_PULLUP);
+  pinMode(btnStop,INPUT_PULLUP);
+  pinMode(btnUp,INPUT_PULLUP);
+  pinMode(btnDown,INPUT_PULLUP);
+  pinMode(btnMotor, INPUT_PULLUP);
+  pinMode(btnRoot, INPUT_PULLUP);
+
 #elif defined(__AVR_ATmega32U4__) 
   
 //  pinMode(btnPlay,INPUT_PULLUP);  // Not needed, default is INPUT (0)
@@ -183,6 +197,9 @@ void pinsetup()
 
   // BUTTON PIN CONFIGURATION
   // n.a.
+  #if defined(Use_Rec) && defined(btnRec)
+    pinMode(btnRec, INPUT_PULLUP);
+  #endif
   
 #else  //__AVR_ATmega328P__
   //pinMode(btnPlay,INPUT_PULLUP);  // Not needed, default is INPUT (0)
@@ -208,5 +225,9 @@ void pinsetup()
   //pinMode(btnRoot, INPUT_PULLUP);  // Not needed, default is INPUT (0)
 //  digitalWrite(btnRoot, HIGH); 
   PORTD |= _BV(btnRoot);
+
+  #if defined(Use_Rec) && defined(btnRec)
+    pinMode(btnRec, INPUT_PULLUP);
+  #endif
 #endif
 }
\ No newline at end of file
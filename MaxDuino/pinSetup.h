@@ -20,6 +20,8 @@
   //#define WRITE_HIGH          PORTB |=  _BV(1)         // El pin9 es el bit1 del PORTB
   //#define WRITE_HIGH            digitalWrite(outputPin,HIGH)
   #define WRITE_HIGH          VPORTB.OUT |=  _BV(0)         // El pin9 es PB0
+  #define OUTPUT_REG          VPORTB_OUT                    // the same, for AVR_FAST_ISR's sbi/cbi
+  #define OUTPUT_BIT          0
 
 #elif defined(__AVR_ATmega4808__)
   #define outputPin           9
@@ -29,17 +31,35 @@
   #define WRITE_LOW            VPORTA.OUT &= ~PIN7_bm         // El pin9 es PA7
   //#define WRITE_HIGH            digitalWrite(outputPin,HIGH)
   #define WRITE_HIGH           VPORTA.OUT |=  PIN7_bm         // El pin9 es PA7
+  #define OUTPUT_REG           VPORTA_OUT
+  #define OUTPUT_BIT           7
 
 #elif defined(__arm__) && defined(__STM32F1__)
   #define outputPin           PA9    // this pin is 5V tolerant and PWM output capable
   #define INIT_OUTPORT            pinMode(outputPin,OUTPUT)
   //#define INIT_OUTPORT            pinMode(outputPin,OUTPUT); GPIOA->regs->CRH |=  0x00000030  
-  #define WRITE_LOW               digitalWrite(outputPin,LOW)
+  //#define WRITE_LOW               digitalWrite(outputPin,LOW)
   //#define WRITE_LOW               GPIOA->regs->ODR &= ~0b0000001000000000
   //#define WRITE_LOW               gpio_write_bit(GPIOA, 9, LOW)
-  #define WRITE_HIGH              digitalWrite(outputPin,HIGH)
+  //#define WRITE_HIGH              digitalWrite(outputPin,HIGH)
   //#define WRITE_HIGH              GPIOA->regs->ODR |=  0b0000001000000000
   //#define WRITE_HIGH              gpio_write_bit(GPIOA, 9, HIGH)
+  #if defined(TIM1_OUTPUT)
+  // PA9 is TIM1_CH2, which TIM1 sets at the next update: these give it the
+  // level (and the ODR the same, for when the timer lets go of the pin)
+  extern volatile byte tim1Level;
+  #define WRITE_LOW               (tim1Level = LOW,  GPIOA->regs->BRR  = 0b0000001000000000)   // PA9
+  #define WRITE_HIGH              (tim1Level = HIGH, GPIOA->regs->BSRR = 0b0000001000000000)   // PA9
+  #elif defined(FANOUT_PINS)
+  // one store to BSRR sets or clears PA9 and all of FANOUT_PINS (see fanout.h)
+  extern volatile uint32_t fanHigh, fanLow;
+  #define WRITE_LOW               GPIOA->regs->BSRR = fanLow
+  #define WRITE_HIGH              GPIOA->regs->BSRR = fanHigh
+  #else
+  // atomic single-store set/reset via BSRR/BRR, much less latency than digitalWrite
+  #define WRITE_LOW               GPIOA->regs->BRR  = 0b0000001000000000   // PA9
+  #define WRITE_HIGH              GPIOA->regs->BSRR = 0b0000001000000000   // PA9
+  #endif
 
 #elif defined(__AVR_ATmega32U4__) 
 #define outputPin           7    // this pin is 5V tolerant and PWM output capable
@@ -53,25 +73,76 @@
 #elif defined(SEEED_XIAO_M0)
   #define outputPin           A0
   #define INIT_OUTPORT            pinMode(outputPin,OUTPUT)
-  //#define INIT_OUTPORT            pinMode(outputPin,OUTPUT); GPIOA->regs->CRH |=  0x00000030  
-  #define WRITE_LOW               digitalWrite(outputPin,LOW)
-  //#define WRITE_LOW               GPIOA->regs->ODR &= ~0b0000001000000000
-  //#define WRITE_LOW               gpio_write_bit(GPIOA, 9, LOW)
-  #define WRITE_HIGH              digitalWrite(outputPin,HIGH)
-  //#define WRITE_HIGH              GPIOA->regs->ODR |=  0b0000001000000000
-  //#define WRITE_HIGH              gpio_write_bit(GPIOA, 9, HIGH)
+  //#define WRITE_LOW               digitalWrite(outputPin,LOW)
+  //#define WRITE_HIGH              digitalWrite(outputPin,HIGH)
+  //#define WRITE_LOW               PORT->Group[g_APinDescription[outputPin].ulPort].OUTCLR.reg = (1ul << g_APinDescription[outputPin].ulPin)
+  //#define WRITE_HIGH              PORT->Group[g_APinDescription[outputPin].ulPort].OUTSET.reg = (1ul << g_APinDescription[outputPin].ulPin)
+  #ifdef DAC_OUTPUT
+    // A0 is the DAC pin: edges go to the DAC, ramped by TC3 (see TimerCounter.cpp)
+    #ifndef DAC_OUTPUT_LOW
+      #define DAC_OUTPUT_LOW      0
+    #endif
+    #ifndef DAC_OUTPUT_HIGH
+      #define DAC_OUTPUT_HIGH     1023
+    #endif
+    #ifndef DAC_SLEW_STEPS
+      #define DAC_SLEW_STEPS      4
+    #endif
+    #ifndef DAC_SLEW_US
+      #define DAC_SLEW_US         10
+    #endif
+    void dac_init();
+    void dac_edge(word level);
+    #undef INIT_OUTPORT
+    #define INIT_OUTPORT            dac_init()
+    #define WRITE_LOW               dac_edge(DAC_OUTPUT_LOW)
+    #define WRITE_HIGH              dac_edge(DAC_OUTPUT_HIGH)
+  #else
+  // single store to OUTCLR/OUTSET through the single-cycle IOBUS port, pin known at compile time
+  #define WRITE_LOW               PORT_IOBUS->Group[0].OUTCLR.reg = (1ul << 2)   // A0 = PA02
+  #define WRITE_HIGH              PORT_IOBUS->Group[0].OUTSET.reg = (1ul << 2)   // A0 = PA02
+  #endif
 
 #elif defined(ARDUINO_XIAO_ESP32C3)
+  #include "soc/gpio_struct.h"
   #define outputPin         D0
   #define INIT_OUTPORT            pinMode(outputPin,OUTPUT)
-  #define WRITE_LOW               digitalWrite(outputPin,LOW)
-  #define WRITE_HIGH              digitalWrite(outputPin,HIGH)
+  //#define WRITE_LOW               digitalWrite(outputPin,LOW)
+  //#define WRITE_HIGH              digitalWrite(outputPin,HIGH)
+  #ifdef RMT_OUTPUT
+    // the RMT drives the pin: these set the level of the edge being queued (see TimerCounter.cpp)
+    extern volatile byte rmtLevel;
+    #define WRITE_LOW               rmtLevel = LOW
+    #define WRITE_HIGH              rmtLevel = HIGH
+  #elif defined(FANOUT_PINS)
+  // the same, for D0 and all of FANOUT_PINS at once (see fanout.h)
+  extern volatile uint32_t fanMask;
+  #define WRITE_LOW               GPIO.out_w1tc.val = fanMask
+  #define WRITE_HIGH              GPIO.out_w1ts.val = fanMask
+  #else
+  // single store to the GPIO write-1-to-clear/set registers
+  #define WRITE_LOW               GPIO.out_w1tc.val = (1ul << outputPin)   // D0 = GPIO2
+  #define WRITE_HIGH              GPIO.out_w1ts.val = (1ul << outputPin)   // D0 = GPIO2
+  #endif
 
 #elif defined(ARDUINO_ESP8266_WEMOS_D1MINI)
   #define outputPin           16 // D0
   #define INIT_OUTPORT            pinMode(outputPin,OUTPUT)
-  #define WRITE_LOW               digitalWrite(outputPin,LOW)
-  #define WRITE_HIGH              digitalWrite(outputPin,HIGH)
+  //#define WRITE_LOW               digitalWrite(outputPin,LOW)
+  //#define WRITE_HIGH              digitalWrite(outputPin,HIGH)
+  // GPIO16 sits in the RTC block with its own output register (bit 0), not GPOS/GPOC
+  #define WRITE_LOW               GP16O = 0
+  #define WRITE_HIGH              GP16O = 1
+
+#elif defined(ARDUINO_ARCH_RP2040)
+  #ifndef outputPin
+  #define outputPin           15 // GP15 (the config can move it, for FANOUT_PINS to follow on from)
+  #endif
+  // a PIO state machine drives the pin: these set the level of the edge being queued (see TimerCounter.cpp)
+  #define INIT_OUTPORT            pinMode(outputPin,OUTPUT)
+  extern volatile byte pioLevel;
+  #define WRITE_LOW               pioLevel = LOW
+  #define WRITE_HIGH              pioLevel = HIGH
 
 #else  //__AVR_ATmega328P__
   //#define MINIDUINO_AMPLI     // For A.Villena's Miniduino new design
@@ -84,8 +155,19 @@
   //  #define WRITE_HIGH          PORTB = (PORTB | B00000010) & B11111110         // pin8+ pin9 , bit0- bit1 del PORTB 
   #else
     #define INIT_OUTPORT         DDRB |=  _BV(1)         // El pin9 es el bit1 del PORTB
+    #ifdef OC1A_OUTPUT
+    // pin 9 is OC1A, which Timer1 sets at the next compare match: these give
+    // it the level (and PORTB the same, for when the timer lets go of the pin)
+    extern volatile byte ocLevel;
+    #define OC1A_PIN_OK
+    #define WRITE_LOW           (ocLevel = LOW, PORTB &= ~_BV(1))
+    #define WRITE_HIGH          (ocLevel = HIGH, PORTB |=  _BV(1))
+    #else
     #define WRITE_LOW           PORTB &= ~_BV(1)         // El pin9 es el bit1 del PORTB
     #define WRITE_HIGH          PORTB |=  _BV(1)         // El pin9 es el bit1 del PORTB
+    #endif
+    #define OUTPUT_REG          PORTB                    // the same, for AVR_FAST_ISR's sbi/cbi
+    #define OUTPUT_BIT          1
   #endif
 
 // pin 0-7 PortD0-7, pin 8-13 PortB0-5, pin 14-19 PortC0-5
@@ -135,6 +217,11 @@
 #define btnMotor      PA8     //Motor Sense (connect pin to gnd to play, NC for pause)
 #define btnRoot       PA4           //Return to SD card root
 
+#ifdef Use_Rec
+  #define recPin      PB0           //Recording input (ADC12_IN8; PA5-PA7 are the SD card's SPI1)
+  #define btnRec      PB1           //Record button
+#endif
+
 #elif defined(__AVR_ATmega32U4__) 
   #define NO_MOTOR  
   const byte chipSelect = SS;          //Sd card chip select pin
@@ -155,6 +242,12 @@
 #define btnADC        A2 // analog input pin for ADC buttons
 #define NO_MOTOR    // because no spare gpio
 
+#ifdef Use_Rec
+  #define recPin      A1  // recording input
+  #define btnRec      3   // D3
+  #define REC_USES_BUTTON_ADC // the recorder has the ADC while recording, so REC also stops it
+#endif
+
 #elif defined(ARDUINO_XIAO_ESP32C3)
 //
 // Pin definition for Seeeduino Xiao ESP32C3 boards
@@ -165,6 +258,12 @@
 #define btnADC        A2 // analog input pin for ADC buttons // CHANGED!!!
 #define NO_MOTOR    // because no spare gpio
 
+#ifdef Use_Rec
+  #define recPin      A1  // recording input (ADC1)
+  #define btnRec      D3
+  #define REC_USES_BUTTON_ADC // the recorder has the ADC while recording, so REC also stops it
+#endif
+
 #elif defined(ARDUINO_ESP8266_WEMOS_D1MINI)
 //
 // Pin definition for Wemos D1 Mini (ESP8266) boards
@@ -174,6 +273,20 @@
 #define btnADC        A0 
 #define btnMotor      2
 
+#elif defined(ARDUINO_ARCH_RP2040)
+//
+// Pin definition for Raspberry Pi Pico (RP2040) boards
+// SD card on SPI0 (GP16 MISO, GP18 SCK, GP19 MOSI), OLED on I2C0 (GP4 SDA, GP5 SCL)
+//
+#define chipSelect    17            //Sd card chip select pin
+
+#define btnPlay       10            //Play Button
+#define btnStop       11            //Stop Button
+#define btnUp         12            //Up button
+#define btnDown       13            //Down button
+#define btnRoot       14            //Return to SD card root
+#define btnMotor      9             //Motor Sense (connect pin to gnd to play, NC for pause)
+
 #else
   const byte chipSelect = 10;          //Sd card chip select pin
   
@@ -188,6 +301,9 @@
   // Only enabled when Use_Rec is set in userconfig.
   #if defined(Use_Rec) && (defined(__AVR_ATmega4808__) || defined(__AVR_ATmega4809__))
     #define btnRec      8
+  #elif defined(Use_Rec) && defined(__AVR_ATmega328P__)
+    #define recPin      8             //Recording input: ICP1, Timer1's input capture (a digital input, through a comparator or schmitt trigger)
+    #define btnRec      4             //Record button
   #endif
 #endif
 
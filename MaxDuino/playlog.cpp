@@ -0,0 +1,124 @@
+#include "configs.h"
+#include "playlog.h"
+
+#ifdef PLAY_LOG
+
+#include "file_utils.h"
+#include "current_settings.h"
+
+namespace {
+constexpr byte LINE_SIZE = 64;
+constexpr byte NAME_WIDTH = 20;
+const char LOG_PATH[] PROGMEM = "/MAXPLAY.LOG";
+
+bool playing = false;     // between start and stop
+bool clean;
+char name[NAME_WIDTH + 1];
+word plays = 0;           // since power on
+unsigned long started;
+unsigned long paused;     // ms paused so far
+unsigned long pausedAt;   // 0 if not paused now
+word blocks;
+word underrunCount;
+word pauses;
+word jumps;
+word baud;
+
+char *put_number(char *p, unsigned long v, byte width) {
+  // right aligned in width, and a comma after; too big shows as all 9s
+  unsigned long most = 9;
+  for (byte i = 1; i < width; i++) most = most * 10 + 9;
+  if (v > most) v = most;
+  char digits[11];
+  ultoa(v, digits, 10);
+  const byte n = strlen(digits);
+  memset(p, ' ', width - n);
+  memcpy(p + width - n, digits, n);
+  p += width;
+  *p++ = ',';
+  return p;
+}
+} // anonymous namespace
+
+void playlog_start() {
+  // the name now, since the next file's is in fileName by the time it stops
+  byte i = 0;
+  for (; i < NAME_WIDTH && fileName[i]; i++) {
+    name[i] = (fileName[i] == ',') ? '_' : fileName[i];
+  }
+  name[i] = '\0';
+  plays++;
+  started = millis();
+  paused = 0;
+  pausedAt = 0;
+  blocks = underrunCount = pauses = jumps = 0;
+  baud = BAUDRATE;
+  clean = false;
+  playing = true;
+}
+
+void playlog_block() {
+  blocks++;
+  baud = BAUDRATE;          // what this one plays at (LIVE_BAUD changes it between blocks)
+}
+
+void playlog_pause(bool pause) {
+  if (!playing) return;
+  if (pause && !pausedAt) {
+    pauses++;
+    pausedAt = millis();
+    if (!pausedAt) pausedAt = 1;
+  } else if (!pause && pausedAt) {
+    paused += millis() - pausedAt;
+    pausedAt = 0;
+  }
+}
+
+void playlog_underrun() {
+  underrunCount++;
+}
+
+void playlog_jump() {
+  jumps++;
+}
+
+void playlog_clean() {
+  clean = true;
+}
+
+void playlog_stop() {
+  if (!playing) return;
+  playing = false;
+  playlog_pause(false);
+
+  char line[LINE_SIZE];
+  memset(line, ' ', LINE_SIZE);
+  memcpy(line, name, strlen(name));
+  char *p = line + NAME_WIDTH;
+  *p++ = ',';
+  p = put_number(p, plays, 3);
+  p = put_number(p, millis() - started - paused, 8);
+  p = put_number(p, blocks, 4);
+  p = put_number(p, underrunCount, 3);
+  p = put_number(p, pauses, 3);
+  p = put_number(p, jumps, 3);
+  p = put_number(p, baud, 4);
+  *p = clean ? '1' : '0';
+  line[LINE_SIZE-2] = '\r';
+  line[LINE_SIZE-1] = '\n';
+
+  char path[sizeof(LOG_PATH)];
+  strcpy_P(path, LOG_PATH);
+  SdBaseFile log;
+  if (!log.open(path, O_RDWR | O_CREAT)) return;
+  // on a line boundary, even if something else has been at the file
+  const unsigned long at = (log.fileSize() + LINE_SIZE - 1) & ~(unsigned long)(LINE_SIZE - 1);
+  if (at > log.fileSize()) {
+    log.seekEnd();
+    while (log.fileSize() < at && log.write(" ", 1) == 1) {}
+  }
+  if (log.seekSet(at)) log.write(line, LINE_SIZE);
+  log.close();
+}
+
+#endif // PLAY_LOG
@@ -0,0 +1,30 @@
+#ifndef PLAYLOG_H_INCLUDED
+#define PLAYLOG_H_INCLUDED
+
+#include "Arduino.h"
+#include "configs.h"
+
+// A line in /MAXPLAY.LOG for each file played: its name, how long it
+// played for (not counting pauses), the blocks it started, the underruns,
+// pauses and block jumps along the way, the baud rate of its last block,
+// and whether it played through to the end.  Counted in RAM while it
+// plays; the line goes on the end of the log after UniStop has stopped
+// the timer, so the card is never written during output.
+//
+// Each line is 64 bytes (padded with spaces), so none crosses a sector and
+// writing one never touches more than the one sector.  The lines are comma
+// separated, for a spreadsheet:
+//   name, play number since power on (1 starts a session), ms, blocks,
+//   underruns, pauses, jumps, baud, 1 if it played right through
+
+#ifdef PLAY_LOG
+void playlog_start();         // playFile, before UniPlay: fileName is the file
+void playlog_block();         // each block it starts
+void playlog_pause(bool pause);   // SetPause
+void playlog_underrun();
+void playlog_jump();          // a block jump while paused
+void playlog_clean();         // fileEnded: it got to the end
+void playlog_stop();          // UniStop, with the timer stopped: the line out to the card
+#endif
+
+#endif // PLAYLOG_H_INCLUDED
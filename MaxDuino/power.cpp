@@ -1,13 +1,104 @@
 #include "configs.h"
 #include "pinSetup.h"  // for BUTTON_ADC but then really that should move to configs.h ?
+#include "power.h"
+
+#if defined(LOW_POWER_IDLE) || defined(SOFT_STANDBY)
+
+#include "Arduino.h"
+
+#if defined(ESP32)
+#include "esp_sleep.h"
+
+void idle_sleep(unsigned long ms)
+{
+  // the hw timer isn't running (stopped, or paused with LOW_POWER_IDLE),
+  // and millis carries on across a light sleep
+  if (ms == 0) return;
+#ifdef WIFI_SERVICE
+  delay(ms);    // a light sleep would drop the connection; this lets the wifi modem sleep
+#else
+  esp_sleep_enable_timer_wakeup(ms * 1000ul);
+  esp_light_sleep_start();
+#endif
+}
+
+#elif defined(ESP8266)
+
+void idle_sleep(unsigned long ms)
+{
+  // lets the sdk idle the cpu; it sleeps for real only with the wifi off
+  delay(ms ? 1 : 0);
+}
+
+#elif defined(ARDUINO_ARCH_RP2040)
+
+void idle_sleep(unsigned long ms)
+{
+  // no SysTick to wake a wfi: the sdk waits in wfe with a timer alarm set
+  sleep_ms(ms ? 1 : 0);
+}
+
+#elif defined(__arm__)
+
+void idle_sleep(unsigned long ms)
+{
+  __WFI();    // woken by the SysTick at the latest
+}
+
+#else
+#include <avr/sleep.h>
+
+void idle_sleep(unsigned long ms)
+{
+  // idle is as deep as it goes with timer0 (millis) still counting
+  set_sleep_mode(SLEEP_MODE_IDLE);
+  sleep_mode();
+}
+
+#endif
+#endif // LOW_POWER_IDLE || SOFT_STANDBY
+
+#ifdef IDLE_CLOCK
+
+#include "Arduino.h"
+
+namespace {
+bool clockFull = true;
+#if defined(ESP32)
+uint32_t fullMhz = 0;     // as it booted
+#endif
+}
+
+void cpu_clock(bool full)
+{
+  if (full == clockFull) return;
+  clockFull = full;
+#if defined(ESP32)
+  if (fullMhz == 0) fullMhz = getCpuFrequencyMhz();
+  setCpuFrequencyMhz(full ? fullMhz : IDLE_CPU_MHZ);
+#else
+  // the PLL stays at 72MHz (USB needs it): only the dividers after it change
+  if (full) {
+    rcc_set_prescaler(RCC_PRESCALER_APB1, RCC_APB1_HCLK_DIV_2);
+    rcc_set_prescaler(RCC_PRESCALER_AHB, RCC_AHB_SYSCLK_DIV_1);
+    systick_init(F_CPU / 1000 - 1);
+  } else {
+    rcc_set_prescaler(RCC_PRESCALER_AHB, RCC_AHB_SYSCLK_DIV_2);
+    rcc_set_prescaler(RCC_PRESCALER_APB1, RCC_APB1_HCLK_DIV_1);
+    systick_init(F_CPU / 2000 - 1);
+  }
+#endif
+}
+
+#endif // IDLE_CLOCK
 
 #ifdef SOFT_POWER_OFF
 
 #include "Arduino.h"
 #include "Display.h"
 #include "buttons.h"
-#include "power.h"
 #include "file_utils.h"
+#include "utils.h"
 
 unsigned long soft_poweroff_timer = 0;
 unsigned long poweroff_millis = 0;
@@ -27,7 +118,12 @@ bool b_poweroff_key_detected = false;
 
 #include "power_logos.h"
 
+#ifdef SOFT_STANDBY
+extern bool isDir;
+static void standby();
+#else
 static void device_power_off();
+#endif
 
 static void show_power_off_logo()
 {
@@ -40,10 +136,12 @@ static void show_power_off_logo()
   for(int j=0;j<4;j++) {
   #endif
     setXY(0,j);
+    oled_data_begin();
     for(int i=0;i<128;i++)
     {
-      SendByte(*(power_logo+j*128+i));
+      oled_data(*(power_logo+j*128+i));
     }
+    oled_data_end();
   }
 #endif
 }
@@ -103,6 +201,10 @@ void power_off()
 
   power_off_clear_display();
 
+#ifdef SOFT_STANDBY
+  standby();
+  clear_power_off();
+#else
   // ensure SD is finished before we stop everything (common)
   entry.close();
   currentDir->close();
@@ -111,11 +213,36 @@ void power_off()
   sd.end();
 
   device_power_off();
+#endif
 }
 
+#ifdef SOFT_STANDBY
+static void standby()
+{
+  // the lighter alternative: the display stays off and the board sleeps
+  // until a button is pressed, then carries on from the same file, with
+  // no reboot and no trip round the card again
+#ifdef LCDSCREEN16x2
+  lcd.noBacklight();
+#endif
+  while(!button_any()) idle_sleep(50);
+
+#ifdef OLED1306
+  init_OLED();
+  reset_display();
+#endif
+#ifdef LCDSCREEN16x2
+  lcd.backlight();
+#endif
+  printtext(PlayBytes,0);
+  scrollText(fileName, isDir, 0);
+  while(button_any()) delay(50);    // the press that woke it isn't a command
+}
+#endif
+
 // device-specific poweroff actions
 
-#if defined(ESP32)
+#if defined(ESP32) && !defined(SOFT_STANDBY)
 #include "esp_sleep.h"
 #include "driver/periph_ctrl.h"
 
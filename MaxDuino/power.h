@@ -6,7 +6,37 @@
 #ifdef SOFT_POWER_OFF
 void check_power_off_key();
 void clear_power_off();
-void power_off();
+void power_off();   // or with SOFT_STANDBY, standby until a button is pressed
+#endif
+
+#if defined(LOW_POWER_IDLE) || defined(SOFT_STANDBY)
+// Sleep until the next interrupt (the millis tick, at least), in the
+// deepest mode that keeps millis running.  On the ESP32s, where the
+// buttons are only polled, that's a light sleep of up to ms instead
+void idle_sleep(unsigned long ms);
+#endif
+
+#ifdef IDLE_CLOCK
+// The CPU clock down while stopped in the browser, and back to full before
+// anything is timed (playFile, start_recording).  The playback timer is
+// only ever set up at full speed, so its prescalers stay as they are.
+//   ESP32: setCpuFrequencyMhz(IDLE_CPU_MHZ), 80 by default, which keeps
+//     the APB (and so the timers and the buses) at 80MHz
+//   STM32F1: HCLK halved, with APB1 at /1 so it stays at 36MHz (I2C, USB)
+//     and SysTick reloaded to suit; APB2 (SPI1, the SD card) runs at half
+//     speed, as does USART1, so not with SERIALSCREEN
+#if defined(ESP32)
+  #ifndef IDLE_CPU_MHZ
+    #define IDLE_CPU_MHZ 80
+  #endif
+#elif defined(__arm__) && defined(__STM32F1__)
+  #if defined(SERIALSCREEN) || defined(USB_STORAGE_ENABLED)
+    #error IDLE_CLOCK halves the STM32 bus clocks that the serial port and USB storage need as they are
+  #endif
+#else
+  #error IDLE_CLOCK is for the ESP32 and STM32F1 boards
+#endif
+void cpu_clock(bool full);
 #endif
 
 #endif // POWER_H_INCLUDED
@@ -0,0 +1,107 @@
+#include "configs.h"
+#include "profile.h"
+
+#ifdef PROFILE
+
+namespace {
+#if defined(__AVR_ATmega4809__) || defined(__AVR_ATmega4808__)
+constexpr byte PROF_SHIFT = 16;             // TCB2 is 16 bit
+constexpr byte PROF_CYCLES = 2;             // per count
+#else
+constexpr byte PROF_SHIFT = 8;              // Timer2 is 8 bit
+constexpr byte PROF_CYCLES = 8;
+#endif
+
+volatile unsigned long overflows = 0;
+unsigned long total[(byte)PROF::COUNT];
+unsigned long calls[(byte)PROF::COUNT];
+
+const char name0[] PROGMEM = "wave2";
+const char name1[] PROGMEM = "TZXProcess";
+const char name2[] PROGMEM = "ReadByte";
+const char name3[] PROGMEM = "readahead_fill";
+const char name4[] PROGMEM = "lcdTime";
+const char * const names[] PROGMEM = { name0, name1, name2, name3, name4 };
+}
+
+#if defined(__AVR_ATmega4809__) || defined(__AVR_ATmega4808__)
+ISR(TCB2_INT_vect)
+{
+  overflows++;
+  TCB2.INTFLAGS = TCB_CAPT_bm;
+}
+#else
+ISR(TIMER2_OVF_vect)
+{
+  overflows++;
+}
+#endif
+
+void prof_reset() {
+  noInterrupts();
+#if defined(__AVR_ATmega4809__) || defined(__AVR_ATmega4808__)
+  TCB2.CTRLA = 0;
+  TCB2.CTRLB = TCB_CNTMODE_INT_gc;          // periodic interrupt, at the top of the count
+  TCB2.CCMP = 0xFFFF;
+  TCB2.CNT = 0;
+  TCB2.INTCTRL = TCB_CAPT_bm;
+  TCB2.CTRLA = TCB_CLKSEL_CLKDIV2_gc | TCB_ENABLE_bm;
+#else
+  TCCR2A = 0;                               // normal mode, counts 0..255 and wraps
+  TCCR2B = _BV(CS21);                       // clk/8
+  TCNT2 = 0;
+  TIMSK2 = _BV(TOIE2);
+#endif
+  overflows = 0;
+  for (byte i = 0; i < (byte)PROF::COUNT; i++) {
+    total[i] = 0;
+    calls[i] = 0;
+  }
+  interrupts();
+}
+
+unsigned long prof_now() {
+  // the overflow count and the counter, read together; if the counter has
+  // wrapped and its interrupt hasn't run yet (as in wave2), count it here
+  const byte sreg = SREG;
+  noInterrupts();
+  unsigned long o = overflows;
+#if defined(__AVR_ATmega4809__) || defined(__AVR_ATmega4808__)
+  word c = TCB2.CNT;
+  if ((TCB2.INTFLAGS & TCB_CAPT_bm) && c < 0x8000) o++;
+#else
+  byte c = TCNT2;
+  if ((TIFR2 & _BV(TOV2)) && c < 0x80) o++;
+#endif
+  SREG = sreg;
+  return (o << PROF_SHIFT) | c;
+}
+
+void prof_add(PROF slot, unsigned long start) {
+  const unsigned long dt = prof_now() - start;
+  const byte sreg = SREG;
+  noInterrupts();                           // wave2 adds to the table too
+  total[(byte)slot] += dt;
+  calls[(byte)slot]++;
+  SREG = sreg;
+}
+
+void prof_print() {
+  Serial.println(F("-- profile: total us, calls, cycles/call --"));
+  for (byte i = 0; i < (byte)PROF::COUNT; i++) {
+    noInterrupts();
+    const unsigned long t = total[i];
+    const unsigned long n = calls[i];
+    interrupts();
+    if (n == 0) continue;
+    Serial.print((const __FlashStringHelper *)pgm_read_ptr(&names[i]));
+    Serial.print(F(": "));
+    Serial.print(t / (F_CPU / 1000000UL / PROF_CYCLES));
+    Serial.print(' ');
+    Serial.print(n);
+    Serial.print(' ');
+    Serial.println(t / n * PROF_CYCLES);
+  }
+}
+
+#endif // PROFILE
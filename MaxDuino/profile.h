@@ -0,0 +1,50 @@
+#ifndef PROFILE_H_INCLUDED
+#define PROFILE_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef PROFILE
+#include "Arduino.h"
+
+// Per-function CPU time on the AVRs, for finding where the time goes.
+// A free-running counter that timer 1 (the output) doesn't touch: Timer2
+// at clk/8 on the 328/2560, TCB2 at clk/2 on the 4808/4809.  Each
+// PROFILE_SCOPE adds the cycles from there to the end of its block, and
+// one call, to its slot; the table goes out over the serial port when
+// playback stops.  Totals are inclusive: ReadByte inside TZXProcess counts
+// in both, and so does any wave2 that interrupts them.
+
+#ifndef SERIALSCREEN
+  #error PROFILE prints over the serial port, so needs SERIALSCREEN
+#endif
+#if !defined(__AVR_ATmega328P__) && !defined(__AVR_ATmega2560__) && !defined(__AVR_ATmega4809__) && !defined(__AVR_ATmega4808__)
+  #error PROFILE needs a 328, 2560, 4808 or 4809
+#endif
+
+enum class PROF : byte {
+  WAVE2,
+  TZXPROCESS,
+  READBYTE,
+  READAHEAD_FILL,
+  LCDTIME,
+  COUNT
+};
+
+void prof_reset();                          // start of each file
+unsigned long prof_now();                   // cycles, in the counter's units
+void prof_add(PROF slot, unsigned long start);
+void prof_print();                          // end of each file
+
+struct ProfScope {
+  const PROF slot;
+  const unsigned long start;
+  ProfScope(PROF s) : slot(s), start(prof_now()) {}
+  ~ProfScope() { prof_add(slot, start); }
+};
+#define PROFILE_SCOPE(s) ProfScope _profScope(PROF::s)
+
+#else
+#define PROFILE_SCOPE(s)
+#endif
+
+#endif // PROFILE_H_INCLUDED
@@ -0,0 +1,94 @@
+#include "configs.h"
+#include "pwmbyte.h"
+#include "buffer.h"
+#if defined(MZFSPEEDUP) || defined(MTXSPEEDUP)
+#include "current_settings.h"
+#endif
+
+namespace {
+const PWM_FORMAT *fmt;
+word frame;           // bits still to go, the next one in bit 15
+byte bitsLeft = 0;
+byte halvesLeft;      // of the current bit
+bool secondHalf;      // the next half-period is the bit's second ([1]) one
+
+void start_bit() {
+  halvesLeft = (frame & 0x8000) ? fmt->oneHalves : fmt->zeroHalves;
+  secondHalf = false;
+}
+
+byte reverse8(byte b) {
+  b = (b >> 4) | (b << 4);
+  b = ((b & 0xCC) >> 2) | ((b & 0x33) << 2);
+  return ((b & 0xAA) >> 1) | ((b & 0x55) << 1);
+}
+} // namespace
+
+void pwm_begin_byte(const PWM_FORMAT &f, byte b) {
+  fmt = &f;
+  word w = 0;
+  byte n = 0;
+  for (byte i = f.startBits; i > 0; --i) {
+    w = (w << 1) | f.startValue;
+    n++;
+  }
+  w = (w << 8) | (f.msbFirst ? b : reverse8(b));
+  n += 8;
+  if (f.parity != PWM_PARITY_NONE) {
+    byte odd = b ^ (b >> 4);
+    odd ^= odd >> 2;
+    odd ^= odd >> 1;
+    w = (w << 1) | ((odd & 1) ^ (f.parity == PWM_PARITY_ODD));
+    n++;
+  }
+  for (byte i = f.stopBits; i > 0; --i) {
+    w = (w << 1) | f.stopValue;
+    n++;
+  }
+  frame = w << (16 - n);
+  bitsLeft = n;
+  start_bit();
+}
+
+bool pwm_write() {
+  volatile byte * _wb = writeBuffer+writepos;
+  while (bitsLeft && writepos < buffsize) {
+    const word *p = (frame & 0x8000) ? fmt->one : fmt->zero;
+    word _p;
+    if (!secondHalf && halvesLeft >= 2 && p[0] == p[1] && p[0] < PULSE_PAIR_MAX) {
+      _p = p[0] | PULSE_PAIR_FLAG;          // two half-periods in one word
+      halvesLeft -= 2;
+    } else {
+      _p = p[secondHalf];
+      secondHalf = !secondHalf;
+      halvesLeft--;
+    }
+
+    const byte _b1 = _p /256;
+    const byte _b2 = _p %256;
+    *_wb = _b1;
+    *(_wb+1) = _b2;
+    _wb += 2;
+    writepos += 2;
+
+    if (halvesLeft == 0) {
+      frame <<= 1;
+      if (--bitsLeft) start_bit();
+    }
+  }
+  return bitsLeft == 0;
+}
+
+#if defined(MZFSPEEDUP) || defined(MTXSPEEDUP)
+word pwm_speedup(word us) {
+  byte percent;
+  switch(BAUDRATE) {
+    case 2400: percent = 75; break;
+    case 3150: percent = 65; break;
+    case 3600: percent = 60; break;
+    case 3850: percent = 50; break;
+    default:   return us;
+  }
+  return ((unsigned long)us * percent + 50) / 100;
+}
+#endif
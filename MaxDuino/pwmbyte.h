@@ -0,0 +1,47 @@
+#ifndef PWMBYTE_H_INCLUDED
+#define PWMBYTE_H_INCLUDED
+
+#include "Arduino.h"
+
+// Shared byte encoder for the formats that send each bit as a fixed
+// pattern of square waves (MZF, MTX, CAQ, TZX ID4B).  A format describes
+// its bits once, in a PWM_FORMAT table, and hands bytes to pwm_begin_byte();
+// pwm_write() then puts the periods for that byte straight into the
+// wbuffer, as many as fit, instead of one currentPeriod per TZXProcess.
+// Two equal half-periods in a row go into one pulse pair word.
+
+struct PWM_FORMAT {
+  word zero[2];       // half-periods (us) of a 0 bit, used in turn: first, second, first ...
+  word one[2];        // the same for a 1 bit
+  byte zeroHalves;    // half-periods (edges) per 0 bit
+  byte oneHalves;     // ... and per 1 bit
+  bool msbFirst;
+  byte startBits;     // framing bits before the data bits (at most 3) ...
+  bool startValue;
+  byte stopBits;      // ... and after them (at most 3)
+  bool stopValue;
+  byte parity;        // PWM_PARITY_*: parity bit between the data and stop bits
+};
+
+#define PWM_PARITY_NONE 0
+#define PWM_PARITY_ODD  1
+#define PWM_PARITY_EVEN 2
+
+// start on a new byte: start bits, 8 data bits, parity, stop bits
+void pwm_begin_byte(const PWM_FORMAT &fmt, byte b);
+
+// Write periods of the current byte to the wbuffer until it's full or the
+// byte is done.  Returns true once the whole byte has been written.
+// Call from a TZXProcess handler (so there's room for at least one word)
+// and leave currentPeriod at 0 afterwards.
+bool pwm_write();
+
+#if defined(MZFSPEEDUP) || defined(MTXSPEEDUP)
+// Turbo for the formats with no speed setting of their own: the Baud Rate
+// menu picks how far their periods are cut (1200 plays them as recorded,
+// then 75, 65, 60 and 50%).  Which steps a machine still loads depends on
+// its ROM, so it's left to the menu rather than fixed.
+word pwm_speedup(word us);
+#endif
+
+#endif // PWMBYTE_H_INCLUDED
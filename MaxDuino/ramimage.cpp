@@ -0,0 +1,43 @@
+#include "configs.h"
+#include "ramimage.h"
+
+#ifdef RAM_PLAY
+
+#include "hwconfig.h"
+#include "file_utils.h"
+
+#if defined(__AVR__)
+  #error RAM_PLAY needs more RAM than the AVR boards have
+#endif
+
+bool ram_active = false;
+
+namespace {
+byte image[RAM_PLAY_SIZE];
+unsigned long imageLen = 0;
+} // anonymous namespace
+
+bool ram_load() {
+  ram_active = false;
+  const unsigned long size = entry.fileSize();
+  if (size == 0 || size > RAM_PLAY_SIZE || !entry.seekSet(0)) return false;
+  // one read: SdFat goes straight to the card's sectors for the whole ones
+  if (entry.read(image, size) != (int)size) return false;
+  imageLen = size;
+  ram_active = true;
+  return true;
+}
+
+void ram_close() {
+  ram_active = false;
+  imageLen = 0;
+}
+
+word ram_read(unsigned long pos, byte *dst, word n) {
+  if (pos >= imageLen) return 0;
+  if (n > imageLen - pos) n = imageLen - pos;
+  memcpy(dst, image + pos, n);
+  return n;
+}
+
+#endif // RAM_PLAY
@@ -0,0 +1,28 @@
+#ifndef RAMIMAGE_H_INCLUDED
+#define RAMIMAGE_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef RAM_PLAY
+#include "Arduino.h"
+
+// Plays small files from RAM (RAM_PLAY).  A file of up to RAM_PLAY_SIZE
+// bytes (hwconfig.h) is read into RAM in one go as UniPlay opens it, and
+// from then on readfile() and friends fill their window from the copy, so
+// the card isn't touched during playback: no card latency in the output,
+// and the card can come out (or go over to USB storage) once it's loaded.
+// Bigger files, and the gzip'd UEF, MZF and MTX readers which go to entry
+// themselves, are read from the card as before.
+
+extern bool ram_active;
+
+// From UniPlay with entry open: load it if it fits; returns ram_active
+bool ram_load();
+
+void ram_close();
+
+// Read up to n bytes starting at pos into dst; returns how many
+word ram_read(unsigned long pos, byte *dst, word n);
+#endif
+
+#endif // RAMIMAGE_H_INCLUDED
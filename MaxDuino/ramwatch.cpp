@@ -0,0 +1,113 @@
+#include "configs.h"
+#include "ramwatch.h"
+
+#ifdef RAM_WATCH
+
+#include "hwconfig.h"
+
+#if defined(__AVR__)
+extern char __heap_start;
+extern char *__brkval;
+#elif defined(__arm__)
+extern "C" char *sbrk(int incr);
+#endif
+
+namespace {
+#if defined(__AVR__) || defined(__arm__)
+constexpr byte PAINT = 0xA5;
+constexpr byte PAINT_MARGIN = 64;           // left below the stack pointer while painting, for the call itself
+
+char *paintFrom;                            // the top of the heap when it was painted
+char *heapTop;                              // as of the last ramwatch_sample
+volatile size_t minFree = (size_t)-1;
+
+inline char *heap_top() {
+#if defined(__AVR__)
+  return __brkval ? __brkval : &__heap_start;
+#else
+  return sbrk(0);
+#endif
+}
+
+inline char *stack_ptr() {
+#if defined(__AVR__)
+  return (char *)SP;
+#else
+  return (char *)__builtin_frame_address(0);
+#endif
+}
+
+inline void sample(char *top) {
+  const size_t f = stack_ptr() - top;
+  if (f < minFree) minFree = f;
+}
+#elif defined(ESP8266)
+unsigned long minFree = 0xFFFFFFFFUL;
+#endif
+}
+
+void ramwatch_paint() {
+#if defined(__AVR__) || defined(__arm__)
+  paintFrom = heap_top();
+  heapTop = paintFrom;
+  char *p = paintFrom;
+  char *end = stack_ptr() - PAINT_MARGIN;
+  while (p < end) *p++ = PAINT;
+#endif
+}
+
+void ramwatch_sample() {
+#if defined(__AVR__) || defined(__arm__)
+  heapTop = heap_top();
+  sample(heapTop);
+#elif defined(ESP8266)
+  const unsigned long f = ESP.getFreeHeap();
+  if (f < minFree) minFree = f;
+#endif
+}
+
+ISR_CODE void ramwatch_isr() {
+#if defined(__AVR__) || defined(__arm__)
+  sample(heapTop);                          // the heap only moves in the main loop
+#endif
+}
+
+unsigned long ramwatch_free() {
+#if defined(__AVR__) || defined(__arm__)
+  return stack_ptr() - heap_top();
+#else
+  return ESP.getFreeHeap();
+#endif
+}
+
+unsigned long ramwatch_min_free() {
+#if defined(__AVR__) || defined(__arm__)
+  noInterrupts();
+  const size_t f = minFree;
+  interrupts();
+  return f;
+#elif defined(ESP32)
+  return ESP.getMinFreeHeap();
+#else
+  return minFree;
+#endif
+}
+
+unsigned long ramwatch_stack_unused() {
+#if defined(__AVR__) || defined(__arm__)
+  // from the heap up to the first byte the stack has written (the heap can
+  // have grown into the paint as well, and that's not free either)
+  const char *p = heap_top();
+  if (p < paintFrom) p = paintFrom;
+  const char *q = p;
+  const char *end = stack_ptr();
+  while (q < end && (byte)*q == PAINT) q++;
+  return q - p;
+#elif defined(ESP32)
+  return uxTaskGetStackHighWaterMark(NULL);
+#else
+  return ESP.getFreeContStack();
+#endif
+}
+
+#endif // RAM_WATCH
@@ -0,0 +1,26 @@
+#ifndef RAMWATCH_H_INCLUDED
+#define RAMWATCH_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef RAM_WATCH
+#include "Arduino.h"
+
+// Free RAM figures for sizing buffers per build, on the System menu item.
+// On the AVRs and ARMs the stack and the heap share one gap: setup()
+// paints it first thing, and the bytes still painted at the bottom are
+// what the stack has never reached.  As well, the gap between the stack
+// pointer and the top of the heap is sampled in the main loop and in
+// wave2 (which interrupts the main loop wherever it's deepest), and the
+// smallest kept.  On the ESPs the stack is the loop task's own, so those
+// show the SDK's heap low-water mark and stack high-water mark instead.
+
+void ramwatch_paint();                      // first thing in setup
+void ramwatch_sample();                     // main loop
+void ramwatch_isr();                        // first thing in wave2
+unsigned long ramwatch_free();              // free now
+unsigned long ramwatch_min_free();          // least seen free
+unsigned long ramwatch_stack_unused();      // stack never used (still painted)
+#endif
+
+#endif // RAMWATCH_H_INCLUDED
@@ -0,0 +1,315 @@
+#include "configs.h"
+#include "rateprobe.h"
+
+#ifdef RATE_PROBE
+
+#include "buffer.h"
+#include "isr.h"
+#include "TimerCounter.h"
+#include "file_utils.h"
+#include "Display.h"
+#include "buttons.h"
+#include "MaxDuino.h"
+#include "processing_state.h"
+#include "casProcessing.h"
+#include "power.h"
+#include "sddma.h"
+#include "zip.h"
+
+namespace {
+// file layout: for each encoding, the shortest period sustained (2 bytes,
+// little endian, 0 if not probed) and the headroom at it (1 byte, %)
+constexpr byte REC_SIZE = 3;
+const char DB_PATH[] PROGMEM = "/MAXRATE.DAT";
+
+// each encoding starts where every build keeps up (a zero a bit slower
+// than the ROM's, a 12.5kHz sample, 2400 baud) and goes an eighth
+// shorter a step, down to what the timers can be set to
+const word START_US[RATE_ENCODINGS] PROGMEM = {300, 80, 104};
+constexpr word FLOOR_US = 4;
+const char ENC_NAMES[RATE_ENCODINGS][7] PROGMEM = {"Bits", "Direct", "CAS"};
+
+word shortest[RATE_ENCODINGS];
+byte headroom[RATE_ENCODINGS];
+
+// the stream being made up
+word period;
+bool fromFile;
+unsigned long srcPos;
+byte srcLen;              // bytes left in filebuffer
+byte srcIdx;
+byte pattern;
+byte bits;                // the byte the pulse pairs or CAS bits come from
+byte bitsLeft;
+#ifdef DIRECT_RUNS
+byte levels;              // the sample levels to go out as runs
+byte levelsLeft;
+#endif
+bool sampleSent;          // the sample period word is out (direct words only)
+unsigned long owed;       // us of output in the words written since the timer started
+
+bool open_db(SdBaseFile &db, oflag_t flags) {
+  char path[sizeof(DB_PATH)];
+  strcpy_P(path, DB_PATH);
+  return db.open(path, flags);
+}
+
+byte next_byte() {
+  // the file's bytes 8 at a time, as the fast paths read them, round again at its end
+  if (fromFile) {
+    if (srcIdx == srcLen) {
+      srcLen = readfile(8, srcPos);
+      if (srcLen < 8) srcPos = 0;
+      else srcPos += 8;
+      srcIdx = 0;
+      if (!srcLen) return 0x55;
+    }
+    return filebuffer[srcIdx++];
+  }
+  pattern = pattern * 109 + 89;   // no file: a byte pattern that goes through all 256
+  return pattern;
+}
+
+byte next_levels(byte enc) {
+  // the next 8 sample levels, msb first: a byte as they are (ID15), or
+  // the next two bits of one, four samples each (CAS)
+#ifdef Use_CAS
+  if (enc == RATE_CAS) {
+    if (!bitsLeft) {
+      bits = next_byte();
+      bitsLeft = 8;
+    }
+    const byte l = pgm_read_byte(&CAS_PAIR_LEVELS[bits & 0x03]);
+    bits >>= 2;
+    bitsLeft -= 2;
+    return l;
+  }
+#endif
+  return next_byte();
+}
+
+word next_word(byte enc) {
+  if (enc == RATE_BITS) {
+    if (!bitsLeft) {
+      bits = next_byte();
+      bitsLeft = 8;
+    }
+    const word p = (bits & 0x80) ? period*2 : period;
+    bits <<= 1;
+    bitsLeft--;
+    owed += 2*p;
+    return p | PULSE_PAIR_FLAG;
+  }
+#ifdef DIRECT_RUNS
+  // the runs of one level as segments, as DIRECT_RUNS plays them
+  // (though a run here stops at the end of the 8 levels)
+  if (!levelsLeft) {
+    levels = next_levels(enc);
+    levelsLeft = 8;
+  }
+  const bool high = levels & 0x80;
+  byte run = 0;
+  do {
+    levels <<= 1;
+    levelsLeft--;
+    run++;
+  } while (levelsLeft && bool(levels & 0x80) == high);
+  owed += run * period;
+  return SEGMENT_FLAG | (high ? SEGMENT_HIGH : 0) | (run * period);
+#else
+  if (!sampleSent) {
+    sampleSent = true;
+    return 0x6000 | period;     // the sample period, as an ID15 starts
+  }
+  owed += 8 * period;
+  return 0x4700 | next_levels(enc);
+#endif
+}
+
+void put_word(byte enc) {
+  const word w = next_word(enc);
+  volatile byte * _wb = writeBuffer+writepos;
+  *_wb = w >> 8;
+  *(_wb+1) = w & 0xFF;
+  writepos+=2;
+}
+
+void show(byte enc, word p) {
+  char text[17];
+  strcpy_P(text, ENC_NAMES[enc]);
+  strcat_P(text, PSTR(" "));
+  utoa(p, text + strlen(text), 10);
+  strcat_P(text, PSTR("us"));
+  printtext(text, 0);
+}
+
+bool run_step(byte enc, word p, byte &room) {
+  // one step: fill the ring, start the ISR, and keep it fed for
+  // RATE_PROBE_MS.  True if it never ran out, and played all it was given
+  period = p;
+  bitsLeft = 0;
+#ifdef DIRECT_RUNS
+  levelsLeft = 0;
+#endif
+  sampleSent = false;
+  buffer_set_size(enc != RATE_BITS);   // the direct words play from the big pages, as ID15 and .cas do
+  clearBuffer();
+  reset_output_state();
+  writepos = 0;
+  for (;;) {
+    if (writepos >= buffsize) {
+      if (!next_write_page()) break;
+      writepos = 0;
+    }
+    put_word(enc);
+  }
+  owed = 0;
+
+  timerCallback isr = wave2;
+#if defined(ISR_VARIANTS) && defined(Use_CAS)
+  if (enc == RATE_CAS) isr = wave_direct;
+#endif
+  const byte seen = underruns;
+  isStopped = false;
+  Timer.initialize(1000);
+  Timer.attachInterrupt(isr);
+  const unsigned long t0 = micros();
+  unsigned long busy = 0;
+  unsigned long elapsed;
+  unsigned long shown = millis();
+  while ((elapsed = micros() - t0) < RATE_PROBE_MS * 1000UL) {
+  #ifdef SD_DMA_READ
+    sd_dma_poll();
+  #endif
+    if (writepos >= buffsize) {
+      if (!next_write_page()) {
+        // the ring is full: what playing does meanwhile
+      #ifdef READAHEAD_PREFETCH
+        if (fromFile) readahead_prefetch();
+      #endif
+        if (millis() - shown >= 1000) {
+          show(enc, p);      // as often as SHOW_CNTR does
+          shown = millis();
+        }
+        continue;
+      }
+      writepos = 0;
+    }
+    const unsigned long b = micros();
+    while (writepos < buffsize) put_word(enc);
+    busy += micros() - b;
+  }
+  Timer.stop();
+  isStopped = true;
+  reset_output_state();
+
+  room = (busy < elapsed) ? 100 - busy * 100 / elapsed : 0;
+  // a timer that can't be set that short, or an ISR that takes longer
+  // than the period, never underruns but plays slower than asked.  (An
+  // eighth either way is what the ring holds at the end against the start)
+  return underruns == seen && owed + owed/8 >= elapsed;
+}
+} // anonymous namespace
+
+void rateprobe_load() {
+  SdBaseFile db;
+  byte rec[REC_SIZE];
+  if (!open_db(db, O_RDONLY)) return;
+  for (byte e = 0; e < RATE_ENCODINGS && db.read(rec, REC_SIZE) == REC_SIZE; e++) {
+    shortest[e] = word(rec[1], rec[0]);
+    headroom[e] = rec[2];
+  }
+  db.close();
+}
+
+bool rateprobe_run() {
+#ifdef IDLE_CLOCK
+  cpu_clock(true);          // as it plays
+#endif
+  const byte id = currentID;
+  currentID = BLOCKID::ID10;              // (wave2 looks at it for C64 files)
+  const byte underrunsBefore = underruns;
+  const unsigned long size = filesize;
+  entry.close();
+  fromFile = !stream_active() && entry.open(currentDir, ZIP_ENTRY(currentFile), O_RDONLY) && !entry.isDir() && entry.fileSize();
+  filesize = entry.fileSize();            // (for the read-ahead)
+  readahead_invalidate();
+  srcPos = 0;
+  srcLen = srcIdx = 0;
+
+  word found[RATE_ENCODINGS] = {0};
+  byte rooms[RATE_ENCODINGS] = {0};
+  bool stopped = false;
+  for (byte e = 0; e < RATE_ENCODINGS && !stopped; e++) {
+  #ifndef Use_CAS
+    if (e == RATE_CAS) continue;
+  #endif
+    word p = pgm_read_word(&START_US[e]);
+    found[e] = p;             // if even that underruns, no faster than it
+    for (;;) {
+      show(e, p);
+      byte room;
+      if (!run_step(e, p, room)) break;
+      found[e] = p;
+      rooms[e] = room;
+      const word next = p - p/8 - 1;
+      if (next < FLOOR_US) break;
+      p = next;
+      if (button_stop()) {
+        stopped = true;
+        break;
+      }
+    }
+  }
+
+  entry.close();
+  readahead_invalidate();
+  currentID = id;
+  filesize = size;
+  underruns = underrunsBefore;  // else the next play would take these as its own, and slow down
+  lastbtn = true;
+  if (stopped) return false;
+
+  SdBaseFile db;
+  byte rec[REC_SIZE];
+  const bool saving = open_db(db, O_RDWR | O_CREAT | O_TRUNC);
+  for (byte e = 0; e < RATE_ENCODINGS; e++) {
+    shortest[e] = found[e];
+    headroom[e] = rooms[e];
+    rec[0] = found[e] & 0xFF;
+    rec[1] = found[e] >> 8;
+    rec[2] = rooms[e];
+    if (saving) db.write(rec, REC_SIZE);
+  }
+  if (saving) db.close();
+  return true;
+}
+
+word rateprobe_floor(byte enc) {
+  return shortest[enc];
+}
+
+byte rateprobe_headroom(byte enc) {
+  return headroom[enc];
+}
+
+void rateprobe_text(byte enc, char *text) {
+  strcpy_P(text, ENC_NAMES[enc]);
+  strcat_P(text, PSTR(" "));
+  const word p = shortest[enc];
+  if (!p) {
+    strcat_P(text, PSTR("?"));
+    return;
+  }
+  if (enc == RATE_CAS) {
+    ultoa(250000UL / p, text + strlen(text), 10);   // 4 samples a bit
+    strcat_P(text, PSTR("bd "));
+  } else {
+    utoa(p, text + strlen(text), 10);
+    strcat_P(text, PSTR("us "));
+  }
+  utoa(headroom[enc], text + strlen(text), 10);
+  strcat_P(text, PSTR("%"));
+}
+
+#endif // RATE_PROBE
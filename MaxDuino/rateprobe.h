@@ -0,0 +1,57 @@
+#ifndef RATEPROBE_H_INCLUDED
+#define RATEPROBE_H_INCLUDED
+
+#include "Arduino.h"
+#include "configs.h"
+
+// How fast this build (its display, its card, its clock) can feed each
+// kind of word to the ISR, for the Rate Probe menu item.  Each encoding's
+// stream is made up out of the selected file's bytes (or a pattern, with
+// no file), read as playing reads them, and played through the real ISR a
+// step faster at a time, until the ISR runs out of pages (the underrun
+// counter moves) or plays slower than it was asked to: the step before is
+// the shortest period it sustains.  The time the main loop spent filling
+// pages at that step gives its headroom, the rest being time it had to
+// wait for room.
+//
+// The results are kept in /MAXRATE.DAT, and the speed-ups (ZX Speed,
+// Direct Speed, and the CDT speed-up) hold back to them: they never make
+// a pulse shorter than was sustained (though never slower than recorded).
+
+enum RATE_ENC : byte {
+  RATE_BITS,          // pulse pair words, by a zero's period (a one is twice it): standard and turbo data
+  RATE_DIRECT,        // direct recording words, by the sample period: ID15
+  RATE_CAS,           // the same words 4 samples to a bit, as .cas plays (Use_CAS)
+  RATE_ENCODINGS
+};
+
+#ifdef RATE_PROBE
+
+#ifndef RATE_PROBE_MS
+  #define RATE_PROBE_MS 400         // each step plays for this long
+#endif
+
+void rateprobe_load();              // in setup, once the card is up
+// Stopped only: probe each encoding in turn (the tape output plays the
+// streams) and save.  False if stop was pressed, leaving the last results
+bool rateprobe_run();
+word rateprobe_floor(byte enc);     // the shortest period sustained, in us, 0 if not probed
+byte rateprobe_headroom(byte enc);  // % of the main loop that was spare at it
+// "Bits 92us 35%": the shortest period (a baud rate for CAS) and the headroom
+void rateprobe_text(byte enc, char *text);
+
+#else
+inline word rateprobe_floor(byte) { return 0; }
+#endif
+
+// A speed-up (a %, as ZX Speed and Direct Speed give) held back so that a
+// period of us as recorded doesn't come out shorter than enc sustained,
+// though never below 100%
+inline word rateprobe_speed(byte enc, word speed, word us) {
+  const word floor = rateprobe_floor(enc);
+  if (!floor || (unsigned long)us * 100 / speed >= floor) return speed;
+  const word most = (unsigned long)us * 100 / floor;
+  return most > 100 ? most : 100;
+}
+
+#endif // RATEPROBE_H_INCLUDED
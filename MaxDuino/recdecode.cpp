@@ -0,0 +1,414 @@
+#include "configs.h"
+#include "recdecode.h"
+
+#ifdef Use_Rec_Decode
+
+namespace {
+constexpr uint8_t HOLD = 32;                  // pulses of a possible tone kept exactly
+constexpr uint16_t PILOT_MIN_PULSES = 256;    // a shorter run of equal pulses isn't a tone
+constexpr uint8_t OUTBUF = 32;
+
+SdBaseFile *out;
+uint32_t rate100;             // CSW sample rate / 100
+uint16_t pilotMinQ;           // range of pulse lengths (in CSW samples) that could be a pilot
+uint16_t pilotMaxQ;
+
+// RLE parsing
+uint8_t longBytes = 0;        // bytes of a long (zero prefixed) length still to come
+uint32_t longValue = 0;
+
+// output, a few bytes at a time rather than one write per byte
+uint8_t outbuf[OUTBUF];
+uint8_t outlen = 0;
+
+void flush() {
+  if (outlen) {
+    out->write(outbuf, outlen);
+    outlen = 0;
+  }
+}
+
+void put(uint8_t b) {
+  outbuf[outlen++] = b;
+  if (outlen == OUTBUF) flush();
+}
+
+void put16(uint16_t v) {
+  put((uint8_t)v);
+  put((uint8_t)(v >> 8));
+}
+
+void put24(uint32_t v) {
+  put16((uint16_t)v);
+  put((uint8_t)(v >> 16));
+}
+
+void put32(uint32_t v) {
+  put16((uint16_t)v);
+  put16((uint16_t)(v >> 16));
+}
+
+void le(uint8_t *b, uint32_t v, uint8_t n) {
+  while (n--) {
+    *b++ = (uint8_t)v;
+    v >>= 8;
+  }
+}
+
+void patch(uint32_t pos, const uint8_t *b, uint8_t n) {
+  // rewrite n bytes already in the file, and carry on from the end again
+  flush();
+  const uint32_t end = out->curPosition();
+  out->seekSet(pos);
+  out->write(b, n);
+  out->seekSet(end);
+}
+
+uint16_t ticks(uint32_t q) {
+  // CSW samples to T-states (3.5MHz)
+  if (q > 100000UL) q = 100000UL;
+  const uint32_t t = (q * 35000UL + rate100/2) / rate100;
+  return (t > 0xFFFF) ? 0xFFFF : (uint16_t)t;
+}
+
+// ---- ID18 blocks, for anything that isn't recognised ----
+bool cswOpen = false;
+uint32_t cswStart;
+uint32_t cswPulses;
+uint32_t cswBytes;
+
+void csw_pulse(uint32_t q) {
+  if (!cswOpen) {
+    flush();
+    cswStart = out->curPosition();
+    put(0x18);
+    put32(0);               // block length, patched in csw_close
+    put16(0);               // pause
+    put24(rate100 * 100);
+    put(1);                 // RLE
+    put32(0);               // pulses, patched in csw_close
+    cswOpen = true;
+    cswPulses = 0;
+    cswBytes = 0;
+  }
+  if (q != 0 && q < 256) {
+    put((uint8_t)q);
+    cswBytes += 1;
+  } else {
+    put(0);
+    put32(q);
+    cswBytes += 5;
+  }
+  cswPulses++;
+}
+
+void csw_close() {
+  if (!cswOpen) return;
+  cswOpen = false;
+  uint8_t b[4];
+  le(b, 10 + cswBytes, 4);
+  patch(cswStart + 1, b, 4);
+  le(b, cswPulses, 4);
+  patch(cswStart + 11, b, 4);
+}
+
+// ---- runs of equal pulses (pilot tones) ----
+uint16_t held[HOLD];
+uint16_t runCount = 0;
+uint32_t runSum;
+uint16_t runMean;
+
+void run_start(uint16_t q) {
+  held[0] = q;
+  runCount = 1;
+  runSum = q;
+  runMean = q;
+}
+
+bool run_fits(uint32_t q) {
+  return q + runMean/8 >= runMean && q <= runMean + runMean/8;
+}
+
+void run_add(uint16_t q) {
+  if (runCount < HOLD) held[runCount] = q;
+  if (runCount == 0xFFFF) return;
+  runCount++;
+  runSum += q;
+  // the divide is slow on AVR, and the mean hardly moves once there are a few pulses
+  if (runCount <= 16 || (runCount & 15) == 0) runMean = runSum / runCount;
+}
+
+void run_to_csw() {
+  // not a tone after all.  The first HOLD pulses go out exactly as measured,
+  // any more (they were all within 1/8 of each other) as the mean
+  const uint16_t exact = (runCount < HOLD) ? runCount : HOLD;
+  for (uint16_t i = 0; i < exact; i++) csw_pulse(held[i]);
+  for (uint16_t i = exact; i < runCount; i++) csw_pulse(runMean);
+  runCount = 0;
+}
+
+void run_to_tone() {
+  csw_close();
+  put(0x12);
+  put16(ticks(runMean));
+  put16(runCount);
+  runCount = 0;
+}
+
+void sync_pulses(uint16_t a, uint16_t b, uint8_t n) {
+  put(0x13);
+  put(n);
+  put16(ticks(a));
+  if (n > 1) put16(ticks(b));
+}
+
+// ---- pilot / sync / data ----
+enum class St : uint8_t { HUNT, SYNC1, SYNC2, DATA };
+St st = St::HUNT;
+uint16_t sync1;
+uint16_t sync2;
+uint32_t blockStart;
+bool std10;                   // ROM timings, written as ID10
+uint8_t curByte;
+uint8_t bitCount;
+uint32_t dataBytes;
+bool haveHalf;
+uint16_t half;
+uint32_t zeroSum;             // sums of both pulses of each bit
+uint32_t oneSum;
+uint16_t zeroCount;
+uint16_t oneCount;
+
+bool near(uint16_t t, uint16_t ref) {
+  return (t > ref ? t - ref : ref - t) <= ref/10;
+}
+
+void hunt(uint32_t q);
+
+void data_begin() {
+  csw_close();
+  flush();
+  blockStart = out->curPosition();
+  std10 = near(ticks(runMean), 2168) && near(ticks(sync1), 667) && near(ticks(sync2), 735);
+  if (std10) {
+    put(0x10);
+    put16(0);               // pause
+    put16(0);               // length, patched in data_end
+  } else {
+    put(0x11);
+    for (uint8_t i = 0; i < 18; i++) put(0);  // timings and length, patched in data_end
+  }
+  curByte = 0;
+  bitCount = 0;
+  dataBytes = 0;
+  haveHalf = false;
+  zeroSum = oneSum = 0;
+  zeroCount = oneCount = 0;
+  st = St::DATA;
+}
+
+uint16_t bit_ticks(uint32_t sum, uint16_t count) {
+  // mean length of one pulse, from the sums of pulse pairs, in T-states
+  // (worked in 1/16 samples so the rounding doesn't cost a whole sample)
+  const uint32_t q16 = sum * 8 / count;
+  return (uint16_t)((q16 * 35000UL + rate100*8) / (rate100*16));
+}
+
+void data_end() {
+  uint8_t used = 8;
+  if (bitCount) {
+    put(curByte);           // remaining bits are already MSb aligned
+    dataBytes++;
+    used = bitCount;
+  }
+
+  if (dataBytes == 0) {
+    // pilot and syncs but no data, so make it a tone and two pulses instead
+    flush();
+    out->seekSet(blockStart);
+    run_to_tone();
+    sync_pulses(sync1, sync2, 2);
+  } else if (std10) {
+    uint8_t b[2];
+    le(b, dataBytes, 2);
+    patch(blockStart + 3, b, 2);
+  } else {
+    uint16_t zeroT = zeroCount ? bit_ticks(zeroSum, zeroCount) : 0;
+    uint16_t oneT = oneCount ? bit_ticks(oneSum, oneCount) : 0;
+    if (!zeroCount) zeroT = oneT / 2;
+    if (!oneCount) oneT = zeroT * 2;
+    uint8_t b[18];
+    le(b + 0, ticks(runMean), 2);
+    le(b + 2, ticks(sync1), 2);
+    le(b + 4, ticks(sync2), 2);
+    le(b + 6, zeroT, 2);
+    le(b + 8, oneT, 2);
+    le(b + 10, runCount, 2);
+    b[12] = used;
+    le(b + 13, 0, 2);       // pause
+    le(b + 15, dataBytes, 3);
+    patch(blockStart + 1, b, 18);
+  }
+  runCount = 0;
+  st = St::HUNT;
+}
+
+void data(uint32_t q) {
+  // both pulses of a bit are shorter than the pilot (ROM: 855 / 1710 against 2168)
+  if (q < runMean/5 || q > runMean - runMean/16) {
+    const bool h = haveHalf;
+    data_end();
+    if (h) hunt(half);
+    hunt(q);
+    return;
+  }
+  if (!haveHalf) {
+    half = q;
+    haveHalf = true;
+    return;
+  }
+  haveHalf = false;
+
+  const uint16_t a = half;
+  const uint16_t b = q;
+  if ((a > b ? a - b : b - a) > (a > b ? a : b) / 4) {
+    // the two halves don't match, so this isn't a bit
+    data_end();
+    hunt(a);
+    hunt(b);
+    return;
+  }
+
+  const uint16_t sum = a + b;
+  if (sum > runMean + runMean/5) {
+    // a one (pair about 1.6 pilot pulses long, a zero is about 0.8)
+    curByte |= 0x80 >> bitCount;
+    if (oneCount != 0xFFFF) {
+      oneSum += sum;
+      oneCount++;
+    }
+  } else if (zeroCount != 0xFFFF) {
+    zeroSum += sum;
+    zeroCount++;
+  }
+
+  if (++bitCount == 8) {
+    put(curByte);
+    dataBytes++;
+    curByte = 0;
+    bitCount = 0;
+    // ID10 has a 16 bit length, ID11 24 bits
+    if (dataBytes == (std10 ? 0xFFFFUL : 0xFFFFFFUL)) data_end();
+  }
+}
+
+void hunt(uint32_t q) {
+  if (runCount) {
+    if (run_fits(q)) {
+      run_add(q);
+      return;
+    }
+    if (runCount >= PILOT_MIN_PULSES) {
+      // end of a tone: look for the syncs
+      st = St::SYNC1;
+      sync1 = 0;
+    } else {
+      run_to_csw();
+    }
+  }
+
+  if (st == St::SYNC1) {
+    if (q >= runMean/8 && q <= runMean - runMean/8) {
+      sync1 = q;
+      st = St::SYNC2;
+    } else {
+      run_to_tone();
+      st = St::HUNT;
+      hunt(q);
+    }
+    return;
+  }
+
+  if (q >= pilotMinQ && q <= pilotMaxQ) {
+    run_start(q);
+  } else {
+    csw_pulse(q);
+  }
+}
+
+void pulse(uint32_t q) {
+  switch (st) {
+    case St::HUNT:
+    case St::SYNC1:
+      hunt(q);
+      break;
+
+    case St::SYNC2:
+      if (q >= runMean/8 && q <= runMean - runMean/8) {
+        sync2 = q;
+        data_begin();
+      } else {
+        run_to_tone();
+        sync_pulses(sync1, 0, 1);
+        st = St::HUNT;
+        hunt(q);
+      }
+      break;
+
+    case St::DATA:
+      data(q);
+      break;
+  }
+}
+} // namespace
+
+void recdecode_begin(SdBaseFile *f, uint32_t rate) {
+  out = f;
+  rate100 = rate / 100;
+  pilotMinQ = (1000UL * rate100) / 35000UL;   // 1000 to 4000 T-states covers ROM and
+  pilotMaxQ = (4000UL * rate100) / 35000UL;   // most turbo loader pilots
+  longBytes = 0;
+  outlen = 0;
+  cswOpen = false;
+  runCount = 0;
+  st = St::HUNT;
+}
+
+void recdecode_bytes(const uint8_t *p, uint16_t n) {
+  while (n--) {
+    const uint8_t c = *p++;
+    if (longBytes) {
+      longValue |= (uint32_t)c << (8 * (4 - longBytes));
+      if (--longBytes == 0) pulse(longValue);
+    } else if (c == 0) {
+      longBytes = 4;
+      longValue = 0;
+    } else {
+      pulse(c);
+    }
+  }
+}
+
+void recdecode_end() {
+  switch (st) {
+    case St::HUNT:
+      if (runCount >= PILOT_MIN_PULSES) run_to_tone();
+      else if (runCount) run_to_csw();
+      break;
+    case St::SYNC1:
+      run_to_tone();
+      break;
+    case St::SYNC2:
+      run_to_tone();
+      sync_pulses(sync1, 0, 1);
+      break;
+    case St::DATA:
+      data_end();
+      break;
+  }
+  st = St::HUNT;
+  csw_close();
+  flush();
+}
+
+#endif // Use_Rec_Decode
@@ -0,0 +1,34 @@
+#ifndef RECDECODE_H_INCLUDED
+#define RECDECODE_H_INCLUDED
+
+#include "configs.h"
+
+// Live TZX block reconstruction for the recorder (Use_Rec_Decode).
+// Takes the CSW RLE pulse stream from the Use_Rec_CSW capture and, instead
+// of writing it out as one big ID18 block, looks for Spectrum style
+// pilot / sync / data timings:
+//   pilot tone + 2 syncs + data  -> ID10 (ROM timings) or ID11 (measured timings)
+//   a tone not followed by data  -> ID12 (+ ID13 for a lone sync pulse)
+//   anything else                -> ID18 blocks
+// Runs from recording_loop(), one page of RLE bytes at a time.
+
+#ifdef Use_Rec_Decode
+
+#ifndef Use_Rec_CSW
+  #error Use_Rec_Decode works on the pulse lengths from Use_Rec_CSW
+#endif
+
+#include <Arduino.h>
+#include "sdfat_config.h"
+#include <SdFat.h>
+
+// f is positioned just after the TZX header; rate is the CSW sample rate
+void recdecode_begin(SdBaseFile *f, uint32_t rate);
+// RLE bytes, exactly as the recorder ISR packs them (may split a long length across calls)
+void recdecode_bytes(const uint8_t *p, uint16_t n);
+// close whatever block is still open; f is left at the end of the data
+void recdecode_end();
+
+#endif // Use_Rec_Decode
+
+#endif // RECDECODE_H_INCLUDED
@@ -9,9 +9,13 @@
 #include <SdFat.h>
 
 #include "Display.h"
+#include "pinSetup.h" // recPin
+#include "recdecode.h"
+#include "power.h"
 
 // MaxDuino exports the current working directory pointer.
 #include "file_utils.h" // currentDir
+#include "TimerCounter.h"
 
 // SdFat instance is owned by MaxDuino.ino
 extern SdFat sd;
@@ -19,10 +23,13 @@ extern SdFat sd;
 // -----------------
 // TZX constants
 // -----------------
-static constexpr uint16_t kSampleRate = 44100;
+#ifndef REC_SAMPLE_RATE
+  #define REC_SAMPLE_RATE 44100
+#endif
+static constexpr uint32_t kSampleRate = REC_SAMPLE_RATE;
 // ZX Spectrum nominal CPU clock is 3.5 MHz, so 3_500_000 / 44100 ≈ 79.36 T-states per sample.
-// The TZX spec recommends 79 for 44100 Hz.
-static constexpr uint16_t kTStatesPerSample = 79;
+// The TZX spec recommends 79 for 44100 Hz (40 for 88200, 36 for 96000).
+static constexpr uint16_t kTStatesPerSample = (uint16_t)(3500000UL / kSampleRate);
 static constexpr uint16_t kPauseAfterMs = 1000;
 
 static const uint8_t kTzxHeader[10] = {
@@ -31,12 +38,59 @@ static const uint8_t kTzxHeader[10] = {
   0x01, 0x20 // v1.20
 };
 
+#if defined(__AVR_ATmega328P__)
+// The Nano has no ADC recorder: Timer1's input capture (ICP1) times each
+// edge on recPin, a digital input.  It hasn't the RAM for sector pages
+// either, so the pages are small and go out through recFile (and SdFat's
+// own sector cache).
+#define REC_EDGE_CAPTURE
+#ifndef Use_Rec_CSW
+  #error the Nano records pulse lengths, so needs Use_Rec_CSW
+#endif
+#if defined(REC_PREROLL) || defined(REC_SPLIT)
+  #error REC_PREROLL and REC_SPLIT work on the ADC samples, which the Nano recorder has none of
+#endif
+#ifdef MINIDUINO_AMPLI
+  #error MINIDUINO_AMPLI drives pin 8, the input of the Nano recorder
+#endif
+#endif
+
+#ifdef Use_Rec_CSW
+// Pulse lengths (TZX ID18, CSW RLE) rather than a 1-bit sample stream.
+#ifdef REC_EDGE_CAPTURE
+// Lengths are in Timer1 counts at clk/64 (4us at 16MHz): a ZX pilot pulse is
+// 155 of them, so nearly every pulse is still one byte.
+static constexpr uint32_t kCswRate = F_CPU / 64;
+#else
+// Lengths are counted in quarter samples: where the signal crossed the
+// threshold between two ADC samples is interpolated from their values.
+static constexpr uint32_t kCswRate = kSampleRate * 4UL;
+#endif
+static constexpr uint8_t kBlockHeaderLen = 15;  // ID18: id, dword length, word pause, 3 byte rate, compression, dword pulses
+#else
+static constexpr uint8_t kBlockHeaderLen = 9;   // ID15: id, word T-states, word pause, used bits, 3 byte length
+#endif
+
+// The sample data starts on a sector boundary, so every page the recorder
+// writes is exactly one card sector.  The gap between the header and the
+// data block is filled with an ID35 custom info block, which players skip.
+static constexpr uint16_t kDataStart = 512;
+static constexpr uint16_t kPadLength = kDataStart - 10 - 21 - kBlockHeaderLen; // TZX header, ID35 header, block header
+static const char kPadIdent[16] = { 'M','a','x','D','u','i','n','o',' ','p','a','d','d','i','n','g' };
+static constexpr uint32_t kMaxDataBytes = 0xFFFFFFUL;    // ID15 data length is 24 bits
+static constexpr uint32_t kPreAllocMin = 1UL << 20;      // don't bother preallocating less than this
+
 // -----------------
 // Recording buffers
 // -----------------
 // Double-buffered 512-byte pages for SD writes.
-static uint8_t pageA[512];
-static uint8_t pageB[512];
+#ifdef REC_EDGE_CAPTURE
+static constexpr uint16_t kPageSize = 128;
+#else
+static constexpr uint16_t kPageSize = 512;
+#endif
+static uint8_t pageA[kPageSize];
+static uint8_t pageB[kPageSize];
 static volatile uint16_t pagePos = 0;
 static volatile uint8_t activePage = 0; // 0=A, 1=B
 static volatile bool pageReadyA = false;
@@ -100,14 +154,33 @@ static bool has_ext_ci(const char *name, const char *ext3) {
   return (up(dot[1]) == up(ext3[0]) && up(dot[2]) == up(ext3[1]) && up(dot[3]) == up(ext3[2]));
 }
 
-static uint16_t count_files_with_ext_in_current_dir(const char *ext3) {
+static const char kRecPrefix[] = "MaxSave";
+
+static int32_t recording_index(const char *name, const char *ext3 = "tzx") {
+  // n for MaxSave<n>.tzx (or .ext3, any case), -1 for anything else
+  for (uint8_t i = 0; i < sizeof(kRecPrefix) - 1; ++i) {
+    if ((name[i] | 0x20) != (kRecPrefix[i] | 0x20)) return -1;
+  }
+  const char *p = name + sizeof(kRecPrefix) - 1;
+  int32_t n = 0;
+  if (*p < '0' || *p > '9') return -1;
+  while (*p >= '0' && *p <= '9') {
+    n = n * 10 + (*p++ - '0');
+    if (n >= 0xFFFF) return -1;
+  }
+  return (*p == '.' && has_ext_ci(p, ext3)) ? n : -1;
+}
+
+static uint16_t scan_next_recording_index() {
+  // one past the highest MaxSave<n>.tzx in the current directory (so one
+  // that's been deleted from the middle doesn't get a later one overwritten)
   if (!currentDir) return 0;
 
   // Preserve directory stream position so the browser UI isn't disturbed.
   const uint32_t savedPos = currentDir->curPosition();
   currentDir->rewind();
 
-  uint16_t count = 0;
+  uint16_t next = 0;
   SdBaseFile tmp;
   char name[64];
 
@@ -115,24 +188,29 @@ static uint16_t count_files_with_ext_in_current_dir(const char *ext3) {
     if (tmp.isFile()) {
       name[0] = 0;
       tmp.getName(name, sizeof(name));
-      if (has_ext_ci(name, ext3)) {
-        count++;
-      }
+      const int32_t n = recording_index(name);
+      if (n >= next) next = n + 1;
     }
     tmp.close();
   }
 
   currentDir->seekSet(savedPos);
-  return count;
+  return next;
 }
 
+// The index the next recording in the directory the last one went in gets,
+// so only the first recording in a directory has to look through it (the
+// directory is known by its first sector, as the block index knows files)
+static uint32_t nextDirKey = 0;
+static uint16_t nextIndex = 0;
+static bool nextValid = false;
+
 static void format_recording_name(char *out, const size_t outSize, uint16_t index) {
   if (!out || outSize == 0) return;
 
-  static const char prefix[] = "MaxSave";
   size_t pos = 0;
-  for (; pos < sizeof(prefix) - 1 && pos + 1 < outSize; ++pos) {
-    out[pos] = prefix[pos];
+  for (; pos < sizeof(kRecPrefix) - 1 && pos + 1 < outSize; ++pos) {
+    out[pos] = kRecPrefix[pos];
   }
 
   char digits[5];
@@ -154,25 +232,328 @@ static void format_recording_name(char *out, const size_t outSize, uint16_t inde
   out[pos] = '\0';
 }
 
+// Slicer: the input is compared against its own DC level rather than mid
+// scale, with hysteresis of a quarter of the recent peak swing, so noise
+// around the threshold doesn't turn into extra edges.  A few adds and
+// shifts per sample, the same every time.
+static constexpr int16_t kHystMin = 4;   // ADC counts; hysteresis with no signal
+static uint32_t midAcc = 512UL << 12;    // DC level, 12 fractional bits
+static uint16_t env = 0;                 // peak distance from the DC level, 4 fractional bits
+static uint8_t sliceLevel = 0;
+static int16_t sliceThr = 512;           // threshold the last change of level crossed
+
+#ifdef REC_SPLIT
+// A silence (no change of level) of REC_SPLIT_MS, in a file that's had
+// something in it, starts the next file
+#ifndef REC_SPLIT_MS
+  #define REC_SPLIT_MS 2000
+#endif
+static constexpr uint32_t kSplitSamples = (uint32_t)REC_SPLIT_MS * (kSampleRate / 1000);
+static constexpr uint16_t kSplitMinEdges = 64;   // fewer than this in a file is only noise
+static uint32_t quietSamples = 0;
+static uint16_t fileEdges = 0;
+static volatile bool splitDue = false;
+static bool splitFile = false;           // this file was started by a split
+
+static inline void heard() {
+  quietSamples = 0;
+  if (fileEdges < kSplitMinEdges) fileEdges++;
+}
+#endif
+
+#ifdef Use_Rec_CSW
+// Pulse measurement
+static volatile uint32_t runQ = 0;       // quarter samples since the last edge
+static volatile uint16_t lastSample = 0;
+static volatile uint8_t lastLevel = 0;
+static volatile bool seenEdge = false;   // the run before the first edge isn't a pulse
+static volatile uint32_t pulseCount = 0;
+#else
 // Bit packing (MSb first as per TZX spec)
 static volatile uint8_t bitByte = 0;
 static volatile uint8_t bitCount = 0; // 0..7 bits already filled in bitByte
+#endif
 
 static volatile bool gRecording = false;
 static volatile bool gRecordPaused = false;
+
+#ifdef REC_PREROLL
+// While armed (the file being set up, or paused for the motor) the sampler
+// keeps going, into this ring rather than the pages, and when recording
+// starts what's in it goes to the file first: the last REC_PREROLL_BYTES
+// of input before the start are kept
+#ifndef REC_PREROLL_BYTES
+  #define REC_PREROLL_BYTES 512
+#endif
+static_assert((REC_PREROLL_BYTES & (REC_PREROLL_BYTES - 1)) == 0, "REC_PREROLL_BYTES must be a power of 2");
+static uint8_t roll[REC_PREROLL_BYTES];
+static volatile uint16_t rollHead = 0;
+static volatile uint16_t rollCount = 0;
+static volatile bool armed = false;
+#ifdef Use_Rec_CSW
+static volatile uint8_t rollPart = 0;   // length bytes of a long pulse at the tail, whose start was overwritten
+#endif
+#endif
 static char gRecName[32] = {0};
 
 // File + positions for patching header fields on stop
 static SdBaseFile recFile;
+#ifdef Use_Rec_CSW
+static uint32_t filePos_blockLen = 0;
+static uint32_t filePos_pulses = 0;
+#else
 static uint32_t filePos_usedBits = 0;
 static uint32_t filePos_len3 = 0;
+#endif
 static uint32_t dataBytesWritten = 0; // bytes already written to file (payload only)
 
+// When the file could be preallocated in one contiguous run, pages are
+// written straight to the card sectors, with no FAT lookups or cache
+static uint32_t rawSector = 0;         // card sector of the first data page
+static uint32_t rawSectorCount = 0;    // data pages that fit in the preallocated run (0 = write through recFile)
+
 // -----------------
-// MCU sampling (megaAVR 0/1-series)
+// Sample processing
 // -----------------
+// One 10-bit sample at a time: from the sampling timer ISR on megaAVR, a
+// DMA block at a time from the DMA interrupt on SAMD21 and STM32, and from
+// recording_loop() on ESP32.
+
+static inline uint8_t* active_page_ptr() {
+  return (activePage == 0) ? pageA : pageB;
+}
+
+static inline bool other_page_ready() {
+  return (activePage == 0) ? pageReadyB : pageReadyA;
+}
+
+static inline void mark_active_ready_and_swap() {
+  if (activePage == 0) pageReadyA = true;
+  else pageReadyB = true;
+  activePage ^= 1;
+  pagePos = 0;
+}
+
+static inline uint8_t slice(uint16_t sample) {
+  const int16_t mid = (int16_t)(midAcc >> 12);
+  midAcc += sample;
+  midAcc -= midAcc >> 12;              // time constant 4096 samples, ~90ms
+
+  const uint16_t dev = (uint16_t)((sample >= (uint16_t)mid) ? (sample - mid) : (mid - sample)) << 4;
+  if (dev > env) env += (dev - env) >> 2;  // fast attack
+  else env -= env >> 8;                    // ~6ms decay
+
+  int16_t h = env >> 6;                // a quarter of the peak, in ADC counts
+  if (h < kHystMin) h = kHystMin;
+
+  if (sliceLevel) {
+    if ((int16_t)sample < mid - h) {
+      sliceLevel = 0;
+      sliceThr = mid - h;
+#ifdef REC_SPLIT
+      heard();
+#endif
+    }
+  } else if ((int16_t)sample >= mid + h) {
+    sliceLevel = 1;
+    sliceThr = mid + h;
+#ifdef REC_SPLIT
+    heard();
+#endif
+  }
+#ifdef REC_SPLIT
+  if (quietSamples < kSplitSamples && ++quietSamples == kSplitSamples && fileEdges >= kSplitMinEdges) {
+    splitDue = true;
+  }
+#endif
+  return sliceLevel;
+}
+
+static inline void page_byte(uint8_t b) {
+  uint16_t pos = pagePos;
+  active_page_ptr()[pos++] = b;
+  if (pos >= kPageSize) {
+    // Page full. If the other page is still waiting to be written, drop data.
+    if (other_page_ready()) {
+      droppedBytes++;
+      pos = kPageSize - 1; // keep overwriting last byte to avoid bounds issues
+    } else {
+      mark_active_ready_and_swap();
+      return;
+    }
+  }
+  pagePos = pos;
+}
+
+#ifdef REC_PREROLL
+static inline uint8_t roll_take() {
+  const uint8_t b = roll[(rollHead - rollCount) & (REC_PREROLL_BYTES - 1)];
+  rollCount--;
+  return b;
+}
+
+static inline void roll_put(uint8_t b) {
+  if (rollCount == REC_PREROLL_BYTES) {
+    // full: the oldest byte goes
+    const uint8_t old = roll_take();
+#ifdef Use_Rec_CSW
+    if (rollPart) rollPart--;
+    else if (old == 0) rollPart = 4;
+#else
+    (void)old;
+#endif
+  }
+  roll[rollHead] = b;
+  rollHead = (rollHead + 1) & (REC_PREROLL_BYTES - 1);
+  rollCount++;
+}
+
+static void arm() {
+  noInterrupts();
+  rollHead = 0;
+  rollCount = 0;
+#ifdef Use_Rec_CSW
+  rollPart = 0;
+#endif
+  armed = true;
+  interrupts();
+}
+
+static void commit_preroll() {
+  // hand the ring to the pages, a byte at a time so the sampler (still
+  // adding to it) isn't held off, until it's caught up and can go to the
+  // pages itself
+#ifdef Use_Rec_CSW
+  uint8_t more = 0;     // length bytes still to come of a long pulse
+#endif
+  for (;;) {
+    noInterrupts();
+    if (rollCount == 0) {
+      armed = false;
+      interrupts();
+      return;
+    }
+    const uint8_t b = roll_take();
+#ifdef Use_Rec_CSW
+    if (rollPart) {
+      rollPart--;       // the rest of a pulse that started before the ring
+      interrupts();
+      continue;
+    }
+    if (more) {
+      more--;
+    } else {
+      if (b == 0) more = 4;
+      pulseCount++;
+    }
+#endif
+    page_byte(b);
+    interrupts();
+  }
+}
+#endif // REC_PREROLL
+
+static inline void push_byte(uint8_t b) {
+#ifdef REC_PREROLL
+  if (armed) {
+    roll_put(b);
+    return;
+  }
+#endif
+  page_byte(b);
+}
+
+#ifdef Use_Rec_CSW
+static inline void emit_pulse(uint32_t pulse) {
+  if (pulse == 0) pulse = 1;
+  if (pulse < 256) {
+    push_byte((uint8_t)pulse);
+  } else {
+    push_byte(0);
+    push_byte((uint8_t)pulse);
+    push_byte((uint8_t)(pulse >> 8));
+    push_byte((uint8_t)(pulse >> 16));
+    push_byte((uint8_t)(pulse >> 24));
+  }
+#ifdef REC_PREROLL
+  if (!armed)
+#endif
+  pulseCount++;
+}
+
+static inline void rec_sample(uint16_t sample) {
+  const uint8_t level = slice(sample);
+  uint32_t run = runQ + 4;
+
+  if (level != lastLevel) {
+    // The signal crossed the threshold since the last sample.  q = how many
+    // quarters of the way from the last sample to this one, rounded:
+    // 4 * (distance of the last sample from the threshold) / (total swing)
+    // (the threshold can move a little between samples, hence the clamps)
+    int16_t a = lastLevel ? ((int16_t)lastSample - sliceThr) : (sliceThr - 1 - (int16_t)lastSample);
+    int16_t sd = lastLevel ? ((int16_t)lastSample - (int16_t)sample) : ((int16_t)sample - (int16_t)lastSample);
+    if (a < 0) a = 0;
+    if (sd < 1) sd = 1;
+    const uint16_t a8 = (uint16_t)a << 3;
+    const uint16_t d = (uint16_t)sd;
+    uint8_t q = 0;
+    if (a8 >= d) q++;
+    if (a8 >= 3*d) q++;
+    if (a8 >= 5*d) q++;
+    if (a8 >= 7*d) q++;
+
+    uint32_t pulse = run - (4 - q);
+    run = 4 - q;
+    if (seenEdge) emit_pulse(pulse);
+    seenEdge = true;
+    lastLevel = level;
+  } else if (run > 0xFFFFFF00UL) {
+    run = 0xFFFFFF00UL;   // over 6 hours of one level, just hold it there
+  }
+
+  lastSample = sample;
+  runQ = run;
+}
+
+#else
+static inline void rec_sample(uint16_t sample) {
+  // slice to 1-bit and pack
+  const uint8_t bit = slice(sample);
+
+  uint8_t bb = bitByte;
+  uint8_t bc = bitCount;
+  if (bit) bb |= (uint8_t)(0x80 >> bc);
+  bc++;
+
+  if (bc >= 8) {
+    // push completed byte into current page
+    push_byte(bb);
+
+    // reset bit packer
+    bb = 0;
+    bc = 0;
+  }
+
+  bitByte = bb;
+  bitCount = bc;
+}
+#endif // Use_Rec_CSW
+
+// -----------------
+// MCU sampling
+// -----------------
+#if defined(Use_Rec_Monitor) && !defined(__AVR_ATmega4808__) && !defined(__AVR_ATmega4809__)
+  // the other boards slice a DMA block (or ADC queue) at a time, so the
+  // output would come in bursts rather than at the times it was sampled
+  #error Use_Rec_Monitor needs the per sample interrupt of the megaAVR recorder
+#endif
+
 #if defined(__AVR_ATmega4808__) || defined(__AVR_ATmega4809__)
 
+#if REC_SAMPLE_RATE != 44100
+  #error megaAVR records at 44100 Hz only (one timer interrupt per sample)
+#endif
+
 static void adc_start_freerun_record_pin() {
   // Configure ADC0 for free running conversions on the recording input.
   // ATmega4808 Nano mapping: A7 = AIN15 = PF5.
@@ -203,7 +584,7 @@ static void adc_stop() {
   ADC0.CTRLA &= ~(ADC_ENABLE_bm);
 }
 
-static void timer_start_44100() {
+static void timer_start_sampling() {
   // IMPORTANT: Do NOT use TCA0 here.
   // MaxDuino already uses TCA0 via TimerCounter.cpp on megaAVR, which would
   // create a duplicate ISR ("multiple definition of __vector_x").
@@ -235,74 +616,373 @@ static void timer_stop() {
   REC_TCB.INTFLAGS = TCB_CAPT_bm;
 }
 
-static inline uint8_t* active_page_ptr() {
-  return (activePage == 0) ? pageA : pageB;
+ISR(REC_TCB_INT_vect) {
+  // Clear interrupt flag
+  REC_TCB.INTFLAGS = TCB_CAPT_bm;
+
+  if (!gRecording) return;
+
+  // Read latest ADC sample (10-bit)
+  rec_sample(ADC0.RES);
+
+#ifdef Use_Rec_Monitor
+  // pass through: the level just sliced, at a steady sample of latency
+  if (sliceLevel && !gRecordPaused) WRITE_HIGH;
+  else WRITE_LOW;
+#endif
 }
 
-static inline bool other_page_ready() {
-  return (activePage == 0) ? pageReadyB : pageReadyA;
+#elif defined(__SAMD21__)
+
+#include "wiring_private.h" // pinPeripheral
+
+// TC4 overflows start each ADC conversion through the event system, and the
+// DMAC copies the results into two blocks of kDmaBlock samples: one fills
+// while the DMAC interrupt slices the other.  (TC3 is the playback timer.
+// SD_DMA_READ uses the DMAC while playing, with descriptors of its own.)
+static constexpr uint16_t kDmaBlock = 256;
+static uint16_t dmaBuf[2][kDmaBlock];
+static DmacDescriptor dmaDesc[1] __attribute__((aligned(16)));   // channel 0: first block
+static DmacDescriptor dmaLink __attribute__((aligned(16)));      // second block, links back to dmaDesc[0]
+static DmacDescriptor dmaWriteback[1] __attribute__((aligned(16)));
+static volatile uint8_t dmaBlock = 0;
+
+// ADC settings analogRead() relies on, put back on stop
+static uint8_t savedCtrlB;
+static uint8_t savedSampCtrl;
+static uint8_t savedAvgCtrl;
+static uint8_t savedRefCtrl;
+static uint32_t savedInputCtrl;
+
+static inline void adc_sync() {
+  while (ADC->STATUS.bit.SYNCBUSY);
 }
 
-static inline void mark_active_ready_and_swap() {
-  if (activePage == 0) pageReadyA = true;
-  else pageReadyB = true;
-  activePage ^= 1;
-  pagePos = 0;
+static void dma_block(DmacDescriptor &d, uint16_t *dst, DmacDescriptor *next) {
+  d.BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BLOCKACT_INT | DMAC_BTCTRL_BEATSIZE_HWORD | DMAC_BTCTRL_DSTINC;
+  d.BTCNT.reg = kDmaBlock;
+  d.SRCADDR.reg = (uint32_t)&ADC->RESULT.reg;
+  d.DSTADDR.reg = (uint32_t)(dst + kDmaBlock); // end address, as the destination increments
+  d.DESCADDR.reg = (uint32_t)next;
 }
 
-ISR(REC_TCB_INT_vect) {
-  // Clear interrupt flag
-  REC_TCB.INTFLAGS = TCB_CAPT_bm;
+static void adc_start_freerun_record_pin() {
+  savedCtrlB = ADC->CTRLB.reg;
+  savedSampCtrl = ADC->SAMPCTRL.reg;
+  savedAvgCtrl = ADC->AVGCTRL.reg;
+  savedRefCtrl = ADC->REFCTRL.reg;
+  savedInputCtrl = ADC->INPUTCTRL.reg;
+
+  pinPeripheral(recPin, PIO_ANALOG);
+
+  ADC->CTRLA.bit.ENABLE = 0;
+  adc_sync();
+  ADC->CTRLB.reg = ADC_CTRLB_PRESCALER_DIV32 | ADC_CTRLB_RESSEL_10BIT; // 1.5MHz ADC clock, a few us per conversion
+  ADC->SAMPCTRL.reg = 2;
+  ADC->AVGCTRL.reg = ADC_AVGCTRL_SAMPLENUM_1;
+  ADC->REFCTRL.reg = ADC_REFCTRL_REFSEL_INTVCC1;                        // VDDANA/2, with gain 1/2: 0..3.3V
+  adc_sync();
+  ADC->INPUTCTRL.reg = ADC_INPUTCTRL_MUXNEG_GND | ADC_INPUTCTRL_GAIN_DIV2 |
+                       ADC_INPUTCTRL_MUXPOS(g_APinDescription[recPin].ulADCChannelNumber);
+  adc_sync();
+  ADC->EVCTRL.reg = ADC_EVCTRL_STARTEI;
+
+  // event channel 0: TC4 overflow -> ADC start
+  PM->APBCMASK.reg |= PM_APBCMASK_EVSYS | PM_APBCMASK_TC4;
+  GCLK->CLKCTRL.reg = (uint16_t)(GCLK_CLKCTRL_CLKEN | GCLK_CLKCTRL_GEN_GCLK0 | GCLK_CLKCTRL_ID(GCM_TC4_TC5));
+  while (GCLK->STATUS.bit.SYNCBUSY);
+  EVSYS->USER.reg = (uint16_t)(EVSYS_USER_CHANNEL(1) | EVSYS_USER_USER(EVSYS_ID_USER_ADC_START)); // channel number + 1
+  EVSYS->CHANNEL.reg = EVSYS_CHANNEL_CHANNEL(0) | EVSYS_CHANNEL_EVGEN(EVSYS_ID_GEN_TC4_OVF) | EVSYS_CHANNEL_PATH_ASYNCHRONOUS;
+
+  // DMAC channel 0: one halfword per result, round the two blocks for ever
+  PM->AHBMASK.reg |= PM_AHBMASK_DMAC;
+  PM->APBBMASK.reg |= PM_APBBMASK_DMAC;
+  DMAC->CTRL.reg = 0;
+  DMAC->BASEADDR.reg = (uint32_t)dmaDesc;
+  DMAC->WRBADDR.reg = (uint32_t)dmaWriteback;
+  DMAC->CTRL.reg = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN(0xf);
+  dma_block(dmaDesc[0], dmaBuf[0], &dmaLink);
+  dma_block(dmaLink, dmaBuf[1], &dmaDesc[0]);
+  dmaBlock = 0;
+
+  DMAC->CHID.reg = DMAC_CHID_ID(0);
+  DMAC->CHCTRLA.reg = DMAC_CHCTRLA_SWRST;
+  while (DMAC->CHCTRLA.bit.SWRST);
+  DMAC->CHCTRLB.reg = DMAC_CHCTRLB_LVL(0) | DMAC_CHCTRLB_TRIGSRC(ADC_DMAC_ID_RESRDY) | DMAC_CHCTRLB_TRIGACT_BEAT;
+  DMAC->CHINTENSET.reg = DMAC_CHINTENSET_TCMPL;
+  NVIC_EnableIRQ(DMAC_IRQn);
+  DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE;
+
+  ADC->CTRLA.bit.ENABLE = 1;
+  adc_sync();
+}
+
+static void adc_stop() {
+  DMAC->CHID.reg = DMAC_CHID_ID(0);
+  DMAC->CHCTRLA.reg = 0;
+  DMAC->CHINTENCLR.reg = DMAC_CHINTENCLR_TCMPL;
+
+  ADC->CTRLA.bit.ENABLE = 0;
+  adc_sync();
+  ADC->EVCTRL.reg = 0;
+  ADC->CTRLB.reg = savedCtrlB;
+  ADC->SAMPCTRL.reg = savedSampCtrl;
+  ADC->AVGCTRL.reg = savedAvgCtrl;
+  ADC->REFCTRL.reg = savedRefCtrl;
+  adc_sync();
+  ADC->INPUTCTRL.reg = savedInputCtrl;
+  adc_sync();
+}
 
+static void timer_start_sampling() {
+  TcCount16* tc = (TcCount16*) TC4;
+  tc->CTRLA.reg &= ~TC_CTRLA_ENABLE;
+  while (tc->STATUS.bit.SYNCBUSY);
+  tc->CTRLA.reg = TC_CTRLA_MODE_COUNT16 | TC_CTRLA_WAVEGEN_MFRQ | TC_CTRLA_PRESCALER_DIV1;
+  while (tc->STATUS.bit.SYNCBUSY);
+  tc->CC[0].reg = (uint16_t)(F_CPU / kSampleRate - 1);
+  tc->EVCTRL.reg = TC_EVCTRL_OVFEO;
+  while (tc->STATUS.bit.SYNCBUSY);
+  tc->CTRLA.reg |= TC_CTRLA_ENABLE;
+  while (tc->STATUS.bit.SYNCBUSY);
+}
+
+static void timer_stop() {
+  TcCount16* tc = (TcCount16*) TC4;
+  tc->CTRLA.reg &= ~TC_CTRLA_ENABLE;
+  while (tc->STATUS.bit.SYNCBUSY);
+}
+
+void DMAC_Handler() {
+  DMAC->CHID.reg = DMAC_CHID_ID(0);
+  DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_TCMPL;
+
+  const uint16_t* s = dmaBuf[dmaBlock];
+  dmaBlock ^= 1;
   if (!gRecording) return;
+  for (uint16_t i = 0; i < kDmaBlock; i++) {
+    rec_sample(s[i]);
+  }
+}
 
-  // Read latest ADC sample (10-bit) and threshold to 1-bit.
-  // For phase 1 we use a mid-scale threshold; later phases can auto-calibrate.
-  const uint16_t sample = ADC0.RES;
-  const uint8_t bit = (sample >= 512) ? 1 : 0;
+#elif defined(__arm__) && defined(__STM32F1__)
 
-  uint8_t bb = bitByte;
-  uint8_t bc = bitCount;
-  if (bit) bb |= (uint8_t)(0x80 >> bc);
-  bc++;
+#include <libmaple/adc.h>
+#include <libmaple/dma.h>
 
-  if (bc >= 8) {
-    // push completed byte into current page
-    uint16_t pos = pagePos;
-    uint8_t* p = active_page_ptr();
-    p[pos] = bb;
-    pos++;
+// TIMER3 update events (TRGO) start each ADC1 conversion, and DMA1 channel 1
+// copies the results round dmaBuf in circular mode.  The half and full
+// transfer interrupts each slice one block.  (TIMER2 is the playback timer.)
+static constexpr uint16_t kDmaBlock = 256;
+static uint16_t dmaBuf[2 * kDmaBlock];
 
-    // reset bit packer
-    bb = 0;
-    bc = 0;
+// ADC1 settings analogRead() relies on, put back on stop
+static uint32_t savedCR2;
+static uint32_t savedSQR1;
+static uint32_t savedSQR3;
 
-    if (pos >= 512) {
-      // Page full. If the other page is still waiting to be written, drop data.
-      if (other_page_ready()) {
-        droppedBytes++;
-        pos = 511; // keep overwriting last byte to avoid bounds issues
-      } else {
-        pagePos = pos;
-        bitByte = bb;
-        bitCount = bc;
-        mark_active_ready_and_swap();
-        return;
-      }
+static void dma_isr() {
+  const uint16_t* s;
+  switch (dma_get_irq_cause(DMA1, DMA_CH1)) {
+    case DMA_TRANSFER_HALF_COMPLETE: s = dmaBuf; break;
+    case DMA_TRANSFER_COMPLETE: s = dmaBuf + kDmaBlock; break;
+    default: return;
+  }
+  if (!gRecording) return;
+  for (uint16_t i = 0; i < kDmaBlock; i++) {
+    rec_sample(s[i] >> 2); // 12-bit
+  }
+}
+
+static void adc_start_freerun_record_pin() {
+  pinMode(recPin, INPUT_ANALOG);
+
+  adc_reg_map* r = ADC1->regs;
+  savedCR2 = r->CR2;
+  savedSQR1 = r->SQR1;
+  savedSQR3 = r->SQR3;
+
+  r->SQR1 = 0; // one conversion per trigger
+  r->SQR3 = PIN_MAP[recPin].adc_channel;
+  adc_set_extsel(ADC1, ADC_ADC12_TIM3_TRGO);
+  r->CR2 |= ADC_CR2_EXTTRIG | ADC_CR2_DMA;
+
+  dma_init(DMA1);
+  dma_setup_transfer(DMA1, DMA_CH1, &r->DR, DMA_SIZE_16BITS, dmaBuf, DMA_SIZE_16BITS,
+                     DMA_MINC_MODE | DMA_CIRC_MODE | DMA_HALF_TRNS | DMA_TRNS_CMPLT);
+  dma_set_num_transfers(DMA1, DMA_CH1, 2 * kDmaBlock);
+  dma_attach_interrupt(DMA1, DMA_CH1, dma_isr);
+  dma_enable(DMA1, DMA_CH1);
+}
+
+static void adc_stop() {
+  dma_disable(DMA1, DMA_CH1);
+  dma_detach_interrupt(DMA1, DMA_CH1);
+
+  adc_reg_map* r = ADC1->regs;
+  r->CR2 = savedCR2;
+  r->SQR1 = savedSQR1;
+  r->SQR3 = savedSQR3;
+}
+
+static void timer_start_sampling() {
+  timer_pause(TIMER3);
+  timer_set_prescaler(TIMER3, 0);
+  timer_set_reload(TIMER3, F_CPU / kSampleRate - 1);
+  TIMER3->regs.gen->CR2 = (TIMER3->regs.gen->CR2 & ~TIMER_CR2_MMS) | TIMER_CR2_MMS_UPDATE;
+  timer_generate_update(TIMER3);
+  timer_resume(TIMER3);
+}
+
+static void timer_stop() {
+  timer_pause(TIMER3);
+}
+
+#elif defined(ESP32)
+
+#include <driver/adc.h>
+
+#if !defined(CONFIG_IDF_TARGET_ESP32C3)
+  #error Use_Rec on ESP32 is written for the ESP32-C3 ADC DMA output format
+#endif
+#if REC_SAMPLE_RATE > SOC_ADC_SAMPLE_FREQ_THRES_HIGH
+  #error REC_SAMPLE_RATE is above what the ESP32-C3 ADC can sample
+#endif
+
+// The ADC digital controller samples into DMA by itself and the driver
+// queues the results, so here the blocks are sliced from recording_loop()
+// rather than an interrupt.  The driver's queue has to cover the slowest
+// SD write.
+#define REC_POLLED
+static constexpr uint16_t kDmaBlock = 256;
+static uint8_t dmaBuf[kDmaBlock * SOC_ADC_DIGI_RESULT_BYTES];
+static uint8_t recChannel = 0;
+
+static void adc_start_freerun_record_pin() {
+  recChannel = digitalPinToAnalogChannel(recPin);
+
+  adc_digi_init_config_t init = {};
+  init.max_store_buf_size = 64 * 1024; // ~370ms at 44.1kHz
+  init.conv_num_each_intr = sizeof(dmaBuf);
+  init.adc1_chan_mask = BIT(recChannel);
+  init.adc2_chan_mask = 0;
+  adc_digi_initialize(&init);
+
+  adc_digi_pattern_config_t pattern = {};
+  pattern.atten = ADC_ATTEN_DB_11;
+  pattern.channel = recChannel;
+  pattern.unit = 0; // ADC1
+  pattern.bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+
+  adc_digi_configuration_t config = {};
+  config.conv_limit_en = false;
+  config.conv_limit_num = 250;
+  config.pattern_num = 1;
+  config.adc_pattern = &pattern;
+  config.sample_freq_hz = kSampleRate;
+  config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+  adc_digi_controller_configure(&config);
+}
+
+static void adc_stop() {
+  adc_digi_deinitialize();
+}
+
+static void timer_start_sampling() {
+  adc_digi_start();
+}
+
+static void timer_stop() {
+  adc_digi_stop();
+}
+
+static bool adc_poll() {
+  // slice one block of whatever the driver has queued; false once it's empty
+  uint32_t got = 0;
+  if (adc_digi_read_bytes(dmaBuf, sizeof(dmaBuf), &got, 0) != ESP_OK) return false;
+  for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= got; i += SOC_ADC_DIGI_RESULT_BYTES) {
+    const adc_digi_output_data_t* d = (const adc_digi_output_data_t*)&dmaBuf[i];
+    if (d->type2.unit == 0 && d->type2.channel == recChannel) {
+      rec_sample(d->type2.data >> 2); // 12-bit
     }
-    pagePos = pos;
   }
+  return got != 0;
+}
 
-  bitByte = bb;
-  bitCount = bc;
+#elif defined(REC_EDGE_CAPTURE)
+
+// Timer1 is the playback timer, but recording only starts when stopped.  It
+// counts at clk/64 in normal mode and the capture unit timestamps each edge,
+// so a pulse is the difference of two captures.  Overflows can't be an
+// interrupt (TIMER1_OVF_vect drives playback), so they're taken from TOV1 by
+// the capture and by recording_loop(), which comes round far more often
+// than the 262ms (at 16MHz) Timer1 takes to wrap.
+static volatile uint16_t overflows = 0;
+static uint32_t lastEdgeTicks = 0;
+
+static inline void poll_overflow() {
+  // interrupts off: an overflow with no capture waiting (one that is will
+  // sort out which came first itself)
+  if ((TIFR1 & _BV(TOV1)) && !(TIFR1 & _BV(ICF1))) {
+    TIFR1 = _BV(TOV1);
+    overflows++;
+  }
+}
+
+static void adc_start_freerun_record_pin() {
+  pinMode(recPin, INPUT);
+  Timer.stop();
+  TIMSK1 = 0;
+  TCCR1A = 0;
+  TCCR1B = _BV(ICNC1) | _BV(CS11) | _BV(CS10) | (digitalRead(recPin) ? 0 : _BV(ICES1));  // clk/64, first edge away from the level now
+  TCNT1 = 0;
+  overflows = 0;
+  TIFR1 = _BV(ICF1) | _BV(TOV1);
+}
+
+static void adc_stop() {
+  TIMSK1 = 0;
+  Timer.stop();     // as playback expects to find it
+}
+
+static void timer_start_sampling() {
+  noInterrupts();
+  poll_overflow();
+  // the next pulse is timed from now, not from before a pause
+  lastEdgeTicks = ((uint32_t)overflows << 16) | TCNT1;
+  TCCR1B = (TCCR1B & ~_BV(ICES1)) | (digitalRead(recPin) ? 0 : _BV(ICES1));  // edges went by unseen while paused
+  TIFR1 = _BV(ICF1);
+  TIMSK1 = _BV(ICIE1);
+  interrupts();
+}
+
+static void timer_stop() {
+  TIMSK1 = 0;
+}
+
+ISR(TIMER1_CAPT_vect) {
+  const uint16_t c = ICR1;
+  TCCR1B ^= _BV(ICES1);                     // both edges: look for the other one next
+  TIFR1 = _BV(ICF1);                        // changing the edge can set the flag
+  if ((TIFR1 & _BV(TOV1)) && c < 0x8000) {
+    TIFR1 = _BV(TOV1);                      // it wrapped before this capture
+    overflows++;
+  }
+  if (!gRecording) return;
+
+  const uint32_t t = ((uint32_t)overflows << 16) | c;
+  if (seenEdge) emit_pulse(t - lastEdgeTicks);
+  seenEdge = true;
+  lastEdgeTicks = t;
 }
 
 #else
 
-// Non-megaAVR targets: recording is not implemented in this phase.
-static void adc_start_freerun_ain15_pf5() {}
+// Other targets: recording is not implemented.
+static void adc_start_freerun_record_pin() {}
 static void adc_stop() {}
-static void timer_start_44100() {}
+static void timer_start_sampling() {}
 static void timer_stop() {}
 
 #endif
@@ -321,15 +1001,29 @@ bool is_recording_paused() {
 
 void pause_recording() {
   if (!gRecording || gRecordPaused) return;
+#ifdef REC_PREROLL
+  arm();            // keep sampling, into the ring
+#else
   timer_stop();
+#endif
   gRecordPaused = true;
+#ifdef Use_Rec_Monitor
+  WRITE_LOW;
+#endif
   printtext2F(PSTR("Paused       "),0);
 }
 
 void resume_recording() {
   if (!gRecording || !gRecordPaused) return;
   gRecordPaused = false;
-  timer_start_44100();
+#ifdef REC_SPLIT
+  splitDue = false;     // a gap while paused isn't one on the tape
+#endif
+#ifdef REC_PREROLL
+  commit_preroll();
+#else
+  timer_start_sampling();
+#endif
   printtext2F(PSTR("Recording    "),0);
 }
 
@@ -343,25 +1037,265 @@ static void tzx_write_u24_le(SdBaseFile &f, uint32_t v) {
   f.write(b, 3);
 }
 
-bool start_recording() {
-  if (gRecording) return true;
+#if defined(Use_Rec_CSW) || defined(REC_COMPACT)
+static void tzx_write_u32_le(SdBaseFile &f, uint32_t v) {
+  tzx_write_u16_le(f, (uint16_t)v);
+  tzx_write_u16_le(f, (uint16_t)(v >> 16));
+}
+#endif
 
-  // Create a unique filename in the *current directory* where SdFat is positioned.
-  // filecount = number of existing .tzx files in the folder.
-  const uint16_t filecount = count_files_with_ext_in_current_dir("tzx");
+#ifdef REC_COMPACT
+// Background compaction: once a recording stops, and while the player sits
+// in the browser, its ID15 samples are turned into an ID18 CSW-1 block (the
+// runs of like samples, a byte each for the most part) in MaxSave<n>.tmp,
+// one input sector per call.  The .tmp is laid out as the recording is
+// (header, ID35 padding, block header, data from kDataStart), and the start
+// of its padding keeps a checkpoint, written each time a page of output
+// goes out, so a job cut short (by power, or by the next recording, which
+// wants the pages) carries on from there.  When the block is done the
+// recording is removed and the .tmp takes its name.  Jobs left over are
+// found by looking through each directory the browser is in, once.
+static constexpr uint8_t kCswHeaderLen = 15;
+static constexpr uint16_t kCswPadLength = kDataStart - 10 - 21 - kCswHeaderLen;
+static constexpr uint16_t kCheckPos = 10 + 21;          // the ID35 block's data
+static constexpr uint32_t kCheckMagic = 0x314B4D43UL;   // "CMK1"
+
+struct CompactCheck {
+  uint32_t magic;
+  uint32_t inBit;     // next sample
+  uint32_t outLen;    // data bytes written
+  uint32_t pulses;
+  uint32_t run;       // samples of level so far
+  uint8_t level;
+};
 
-  char recName[32];
-  // Matches requested pattern: MaxSave<i>.tzx
-  format_recording_name(recName, sizeof(recName), filecount);
-  strncpy(gRecName, recName, sizeof(gRecName) - 1);
-  gRecName[sizeof(gRecName) - 1] = 0;
+static SdBaseFile compactDir;
+static SdBaseFile compactIn;
+static SdBaseFile compactOut;
+static bool compactActive = false;
+static uint32_t compactDirKey = 0;     // the directory looked through for jobs left over
+static char compactName[32];           // the recording
+static CompactCheck ck;
+static uint32_t compactBits;           // samples in the ID15 block
+static uint16_t compactTStates;
+static uint16_t compactPause;
+static uint16_t outPos;                // bytes in pageB
+
+static void compact_tmp_name(char *out, const char *name) {
+  strncpy(out, name, 31);
+  out[31] = 0;
+  char *dot = strrchr(out, '.');
+  if (dot && strlen(dot) == 4) strcpy(dot + 1, "tmp");
+}
 
-  // Open in current directory. Overwrite if exists.
-  recFile.close();
-  if (!recFile.open(currentDir, recName, O_RDWR | O_CREAT | O_TRUNC)) {
-    printtextF(PSTR("SD open fail"), 0);
+static void compact_abandon() {
+  // what's in pageB is lost; the checkpoint is from before it
+  compactIn.close();
+  compactOut.close();
+  compactActive = false;
+  compactDirKey = 0;    // so the job is found again
+}
+
+static bool compact_checkpoint() {
+  // the pending output, then where it got to
+  if (outPos) {
+    compactOut.seekSet(kDataStart + ck.outLen);
+    if (compactOut.write(pageB, outPos) != outPos) return false;
+    ck.outLen += outPos;
+    outPos = 0;
+  }
+  compactOut.seekSet(kCheckPos);
+  if (compactOut.write(&ck, sizeof(ck)) != sizeof(ck)) return false;
+  return compactOut.sync();
+}
+
+static bool compact_emit(uint32_t run) {
+  // one run, in the CSW RLE: a byte, or 0 then a dword
+  const uint8_t len = (run < 256) ? 1 : 5;
+  if (outPos + len > kPageSize && !compact_checkpoint()) return false;
+  if (len == 1) {
+    pageB[outPos++] = (uint8_t)run;
+  } else {
+    pageB[outPos++] = 0;
+    for (uint8_t i = 0; i < 4; i++) pageB[outPos++] = (uint8_t)(run >> (8 * i));
+  }
+  ck.pulses++;
+  return true;
+}
+
+static bool compact_start(SdBaseFile *dir, const char *name, bool resume) {
+  // a job for recording name in dir: false if it isn't an ID15 recording
+  compact_abandon();
+  compactDir = *dir;
+  strncpy(compactName, name, sizeof(compactName) - 1);
+  compactName[sizeof(compactName) - 1] = 0;
+  if (!compactIn.open(&compactDir, compactName, O_RDONLY)) return false;
+
+  // id, word T-states, word pause, used bits, 3 byte length
+  uint8_t h[kBlockHeaderLen];
+  compactIn.seekSet(kDataStart - kBlockHeaderLen);
+  if (compactIn.read(h, sizeof(h)) != sizeof(h) || h[0] != 0x15 || h[5] == 0 || h[5] > 8) {
+    compactIn.close();
+    return false;
+  }
+  compactTStates = h[1] | (h[2] << 8);
+  compactPause = h[3] | (h[4] << 8);
+  const uint32_t len = h[6] | ((uint32_t)h[7] << 8) | ((uint32_t)h[8] << 16);
+  compactBits = len ? len * 8 - (8 - h[5]) : 0;
+  if (compactTStates == 0 || compactIn.fileSize() < kDataStart + len) {
+    compactIn.close();
+    return false;
+  }
+
+  char tmp[32];
+  compact_tmp_name(tmp, compactName);
+  memset(&ck, 0, sizeof(ck));
+  if (resume && compactOut.open(&compactDir, tmp, O_RDWR)) {
+    CompactCheck c;
+    compactOut.seekSet(kCheckPos);
+    if (compactOut.read(&c, sizeof(c)) == sizeof(c) && c.magic == kCheckMagic &&
+        c.inBit <= compactBits && kDataStart + c.outLen <= compactOut.fileSize()) {
+      ck = c;
+    }
+  }
+  if (ck.magic != kCheckMagic) {
+    // from the start: the header and padding (with the checkpoint in it)
+    compactOut.close();
+    if (!compactOut.open(&compactDir, tmp, O_RDWR | O_CREAT | O_TRUNC)) {
+      compactIn.close();
+      return false;
+    }
+    compactOut.write(kTzxHeader, sizeof(kTzxHeader));
+    compactOut.write((uint8_t)0x35);
+    compactOut.write(kPadIdent, sizeof(kPadIdent));
+    tzx_write_u16_le(compactOut, kCswPadLength);
+    tzx_write_u16_le(compactOut, 0);
+    memset(pageB, 0, kPageSize);
+    for (uint16_t left = kCswPadLength + kCswHeaderLen; left; ) {
+      const uint16_t n = (left < kPageSize) ? left : kPageSize;
+      compactOut.write(pageB, n);
+      left -= n;
+    }
+    ck.magic = kCheckMagic;
+  }
+  outPos = 0;
+  compactActive = true;
+  return compact_checkpoint();
+}
+
+static bool compact_finish() {
+  // the last run, the block header, and the names swapped over
+  if (ck.run && !compact_emit(ck.run)) return false;
+  ck.run = 0;
+  if (!compact_checkpoint()) return false;
+  compactOut.seekSet(kDataStart - kCswHeaderLen);
+  compactOut.write((uint8_t)0x18);
+  tzx_write_u32_le(compactOut, 10 + ck.outLen);
+  tzx_write_u16_le(compactOut, compactPause);
+  tzx_write_u24_le(compactOut, (3500000UL + compactTStates/2) / compactTStates);
+  compactOut.write((uint8_t)1); // RLE
+  tzx_write_u32_le(compactOut, ck.pulses);
+  // the checkpoint goes back to padding
+  const uint32_t len = kDataStart + ck.outLen;
+  memset(&ck, 0, sizeof(ck));
+  compactOut.seekSet(kCheckPos);
+  compactOut.write(&ck, sizeof(ck));
+  compactOut.truncate(len);
+  if (!compactOut.sync()) return false;
+  // only once the new one is all there does the recording go; a .tmp with
+  // no recording is a finished one
+  compactIn.close();
+  compactDir.remove(compactName);
+  compactOut.rename(&compactDir, compactName);
+  compactOut.close();
+  compactActive = false;
+  return true;
+}
+
+static bool compact_step() {
+  // an input sector's worth; true once the job is done
+  const uint32_t at = ck.inBit / 8;
+  compactIn.seekSet(kDataStart + at);
+  const int n = compactIn.read(pageA, kPageSize);
+  if (n <= 0 && ck.inBit < compactBits) {
+    compact_abandon();
+    return false;
+  }
+  uint32_t end = (at + (uint32_t)n) * 8;
+  if (end > compactBits) end = compactBits;
+  for (; ck.inBit < end; ck.inBit++) {
+    const uint8_t b = (pageA[ck.inBit / 8 - at] >> (7 - (ck.inBit & 7))) & 1;
+    if (b != ck.level) {
+      if (ck.run && !compact_emit(ck.run)) {
+        compact_abandon();
+        return false;
+      }
+      ck.run = 0;
+      ck.level = b;
+    }
+    ck.run++;
+  }
+  if (ck.inBit < compactBits) return false;
+  if (!compact_finish()) {
+    compact_abandon();
+    return false;
+  }
+  compactDirKey = 0;    // anything else left in it
+  return true;
+}
+
+static void compact_look() {
+  // a .tmp in the current directory is a job left over: carried on if its
+  // recording is there, or only renamed if it's finished
+  compactDirKey = currentDir->firstSector();
+  const uint32_t savedPos = currentDir->curPosition();
+  currentDir->rewind();
+  SdBaseFile tmp;
+  char name[32];
+  bool found = false;
+  while (!found && tmp.openNext(currentDir, O_RDONLY)) {
+    name[0] = 0;
+    if (tmp.isFile()) tmp.getName(name, sizeof(name));
+    tmp.close();
+    found = recording_index(name, "tmp") >= 0;
+  }
+  currentDir->seekSet(savedPos);
+  if (!found) return;
+
+  char rec[32];
+  strcpy(rec, name);
+  strcpy(strrchr(rec, '.') + 1, "tzx");
+  if (currentDir->exists(rec)) {
+    if (!compact_start(currentDir, rec, true)) {
+      compact_abandon();
+      compactDirKey = currentDir->firstSector();   // (not one to try again)
+    }
+  } else if (tmp.open(currentDir, name, O_RDWR)) {
+    tmp.rename(currentDir, rec);
+    tmp.close();
+  }
+}
+
+bool recording_compact() {
+  if (gRecording || !currentDir) return false;
+  if (!compactActive) {
+    if (compactDirKey != currentDir->firstSector()) compact_look();
     return false;
   }
+  if (!compact_step()) return false;
+  // the directory's changed if it's the one the browser's showing
+  return compactDir.firstSector() == currentDir->firstSector();
+}
+#endif // REC_COMPACT
+
+bool start_recording() {
+  if (gRecording) return true;
+#ifdef IDLE_CLOCK
+  cpu_clock(true);      // the sample timer is set up for the full clock
+#endif
+#ifdef REC_COMPACT
+  compact_abandon();    // the pages are the recorder's again
+#endif
 
   // Reset buffers
   noInterrupts();
@@ -370,10 +1304,90 @@ bool start_recording() {
   pageReadyA = false;
   pageReadyB = false;
   droppedBytes = 0;
+  midAcc = 512UL << 12;
+  env = 0;
+  sliceLevel = 0;
+  sliceThr = 512;
+#ifdef REC_SPLIT
+  quietSamples = 0;
+  fileEdges = 0;
+  splitDue = false;
+#endif
+#ifdef Use_Rec_CSW
+  runQ = 0;
+  lastSample = 0;
+  lastLevel = 0;
+  seenEdge = false;
+  pulseCount = 0;
+#else
   bitByte = 0;
   bitCount = 0;
+#endif
   interrupts();
 
+#ifdef REC_PREROLL
+  // sample from now, into the ring, so the time spent setting the file up
+  // isn't lost
+  arm();
+  adc_start_freerun_record_pin();
+  gRecording = true;
+  timer_start_sampling();
+#endif
+
+  // Create a unique filename in the *current directory* where SdFat is positioned.
+  // The index remembered for this directory is only trusted as far as the
+  // name turning out to be free (the card may have been changed, or written
+  // to over USB): if it's taken, look through the directory after all.
+  const uint32_t dirKey = currentDir ? currentDir->firstSector() : 0;
+  const bool known = nextValid && dirKey == nextDirKey;
+  uint16_t index = known ? nextIndex : scan_next_recording_index();
+
+  char recName[32];
+  // Matches requested pattern: MaxSave<i>.tzx
+  format_recording_name(recName, sizeof(recName), index);
+
+  recFile.close();
+  bool opened = recFile.open(currentDir, recName, O_RDWR | O_CREAT | O_EXCL);
+  if (!opened && known) {
+    index = scan_next_recording_index();
+    format_recording_name(recName, sizeof(recName), index);
+    opened = recFile.open(currentDir, recName, O_RDWR | O_CREAT | O_EXCL);
+  }
+  strncpy(gRecName, recName, sizeof(gRecName) - 1);
+  gRecName[sizeof(gRecName) - 1] = 0;
+  nextValid = opened;
+  nextDirKey = dirKey;
+  nextIndex = index + 1;
+  if (!opened) {
+#ifdef REC_PREROLL
+    timer_stop();
+    gRecording = false;
+    armed = false;
+    adc_stop();
+#endif
+    printtextF(PSTR("SD open fail"), 0);
+    return false;
+  }
+
+  // Allocate the whole file up front, so no cluster allocation has to happen
+  // while samples are coming in.  Try smaller sizes if the card hasn't got
+  // that much free in one piece.  The file is truncated to length on stop.
+  rawSector = 0;
+  rawSectorCount = 0;
+  for (uint32_t len = kDataStart + kMaxDataBytes + 1; len >= kPreAllocMin; len >>= 1) {
+    if (recFile.preAllocate(len)) {
+      uint32_t bgn, end;
+      if (recFile.contiguousRange(&bgn, &end)) {
+        rawSector = bgn + kDataStart/512;
+        rawSectorCount = end + 1 - rawSector;
+      }
+      break;
+    }
+  }
+#if defined(Use_Rec_Decode) || defined(REC_EDGE_CAPTURE)
+  rawSectorCount = 0; // the decoder writes its blocks through recFile (and the Nano's pages aren't sectors)
+#endif
+
   dataBytesWritten = 0;
   gRecordPaused = false;
 
@@ -384,6 +1398,38 @@ bool start_recording() {
   // Write TZX header
   recFile.write(kTzxHeader, sizeof(kTzxHeader));
 
+#ifdef Use_Rec_Decode
+  // blocks are written as they are recognised
+  recdecode_begin(&recFile, kCswRate);
+#else
+  // Padding so the samples start at kDataStart (pageA isn't in use yet)
+  recFile.write((uint8_t)0x35);
+  recFile.write(kPadIdent, sizeof(kPadIdent));
+  tzx_write_u16_le(recFile, kPadLength);
+  tzx_write_u16_le(recFile, 0);
+  memset(pageA, 0, kPageSize);
+  for (uint16_t left = kPadLength; left; ) {
+    const uint16_t n = (left < kPageSize) ? left : kPageSize;
+    recFile.write(pageA, n);
+    left -= n;
+  }
+
+#ifdef Use_Rec_CSW
+  // Write CSW Recording block (0x18) with placeholder length fields.
+  recFile.write((uint8_t)0x18);
+
+  // block length after this field (patched on stop)
+  filePos_blockLen = recFile.curPosition();
+  tzx_write_u32_le(recFile, 0);
+
+  tzx_write_u16_le(recFile, kPauseAfterMs);
+  tzx_write_u24_le(recFile, kCswRate);
+  recFile.write((uint8_t)1); // RLE
+
+  // number of pulses (patched on stop)
+  filePos_pulses = recFile.curPosition();
+  tzx_write_u32_le(recFile, 0);
+#else
   // Write Direct Recording block (0x15) with placeholder length fields.
   recFile.write((uint8_t)0x15);
   tzx_write_u16_le(recFile, kTStatesPerSample);
@@ -396,29 +1442,47 @@ bool start_recording() {
   // data length (3 bytes, patched on stop)
   filePos_len3 = recFile.curPosition();
   tzx_write_u24_le(recFile, 0);
+#endif
+#endif // Use_Rec_Decode
 
   recFile.flush();
 
+#ifdef REC_PREROLL
+  commit_preroll();
+#else
   // Start ADC + timer sampling
   adc_start_freerun_record_pin();
   gRecording = true;
-  timer_start_44100();
+  timer_start_sampling();
+#endif
   return true;
 }
 
+static bool write_data(const uint8_t* p, uint16_t len) {
+  // write one (possibly partial, at the end) page of samples at dataBytesWritten
+  const uint32_t page = dataBytesWritten / 512;
+  if (page < rawSectorCount) {
+    // inside the preallocated run: one sector straight to the card
+    return sd.card()->writeSectors(rawSector + page, p, 1);
+  }
+  recFile.seekSet(kDataStart + dataBytesWritten);
+  return recFile.write(p, len) == len;
+}
+
 static void write_ready_page(uint8_t which) {
   if (!recFile.isOpen()) return;
-  if (which == 0) {
-    recFile.write(pageA, 512);
-  } else {
-    recFile.write(pageB, 512);
+#ifdef Use_Rec_Decode
+  recdecode_bytes((which == 0) ? pageA : pageB, kPageSize);
+  dataBytesWritten += kPageSize;
+  return;
+#endif
+  if (dataBytesWritten + kPageSize > kMaxDataBytes) return; // the ID15 block is full
+  if (write_data((which == 0) ? pageA : pageB, kPageSize)) {
+    dataBytesWritten += kPageSize;
   }
-  dataBytesWritten += 512;
 }
 
-void recording_loop() {
-  if (!gRecording) return;
-
+static void write_ready_pages() {
   // Write any full pages to SD.
   if (pageReadyA) {
     noInterrupts();
@@ -435,59 +1499,129 @@ void recording_loop() {
   }
 }
 
+void recording_loop() {
+  if (!gRecording) return;
+
+#ifdef REC_EDGE_CAPTURE
+  noInterrupts();
+  poll_overflow();
+  interrupts();
+#endif
+
+#ifdef REC_POLLED
+  // slice what the ADC driver has queued, writing pages out as they fill
+  while (adc_poll()) {
+    write_ready_pages();
+  }
+#endif
+  write_ready_pages();
+
+#ifdef REC_SPLIT
+  if (splitDue && !gRecordPaused) {
+    // a gap on the tape: what's gone before is one file, what comes next
+    // the next (the samples lost while the files change over are silence)
+    stop_recording();
+    start_recording();
+    splitFile = true;
+  }
+#endif
+}
+
 void stop_recording() {
   if (!gRecording) return;
 
   // Stop sampling first.
   timer_stop();
+#ifdef REC_PREROLL
+  armed = false;    // anything still in the ring was paused, so isn't kept
+#endif
   gRecording = false;
   gRecordPaused = false;
   adc_stop();
+#ifdef Use_Rec_Monitor
+  WRITE_LOW;    // leave the output where playback expects it
+#endif
 
   // Flush any ready pages.
-  recording_loop();
+  write_ready_pages();
 
   // Capture remaining partial page and bit pack state.
   uint16_t pos;
+  uint8_t which;
+#ifndef Use_Rec_CSW
   uint8_t bb;
   uint8_t bc;
-  uint8_t which;
+#endif
   noInterrupts();
   pos = pagePos;
+#ifndef Use_Rec_CSW
   bb = bitByte;
   bc = bitCount;
+#endif
   which = activePage;
   // prevent ISR from touching buffers
   pagePos = 0;
   interrupts();
 
+#ifndef Use_Rec_CSW
   // If we have a partial byte, write it into the page.
   uint8_t usedBitsLast = 8;
   if (bc != 0) {
     usedBitsLast = bc;
     uint8_t* p = (which == 0) ? pageA : pageB;
-    if (pos < 512) {
+    if (pos < kPageSize) {
       p[pos] = bb; // remaining bits are already MSb aligned
       pos++;
     }
   }
+#endif
 
-  // Write remaining payload bytes (pos may be 0..512).
-  if (pos) {
+#ifdef Use_Rec_Decode
+  recdecode_bytes((which == 0) ? pageA : pageB, pos);
+  recdecode_end();
+  recFile.truncate(recFile.curPosition());
+#else
+  // Write remaining payload bytes (pos may be 0..kPageSize).
+  if (pos && dataBytesWritten + pos <= kMaxDataBytes) {
     uint8_t* p = (which == 0) ? pageA : pageB;
-    recFile.write(p, pos);
-    dataBytesWritten += pos;
+    memset(p + pos, 0, kPageSize - pos); // a raw write is always the whole sector
+    if (write_data(p, pos)) {
+      dataBytesWritten += pos;
+    }
   }
 
+  // Give back whatever was preallocated but not used.
+  recFile.truncate(kDataStart + dataBytesWritten);
+
+#ifdef Use_Rec_CSW
+  // Patch block length + pulse count.
+  recFile.seekSet(filePos_blockLen);
+  tzx_write_u32_le(recFile, 10 + dataBytesWritten);
+
+  recFile.seekSet(filePos_pulses);
+  tzx_write_u32_le(recFile, pulseCount);
+#else
   // Patch used bits + length.
   recFile.seekSet(filePos_usedBits);
   recFile.write(usedBitsLast);
 
   recFile.seekSet(filePos_len3);
   tzx_write_u24_le(recFile, dataBytesWritten);
+#endif
+#endif // Use_Rec_Decode
 
   recFile.flush();
+#ifdef REC_SPLIT
+  if (splitFile && fileEdges < kSplitMinEdges) {
+    // nothing came after the last gap, so this one's just silence
+    recFile.remove();
+  }
+  splitFile = false;
+#endif
   recFile.close();
+#ifdef REC_COMPACT
+  if (!compact_start(currentDir, gRecName, false)) compact_abandon();
+#endif
 
   // Show completion (one-time).
   printtextF(PSTR("Saved"), 0);
@@ -4,7 +4,26 @@
 #include <Arduino.h>
 
 // Phase 1: create "test.tzx" and record a Direct Recording (TZX block 0x15)
-// by sampling the audio input on A7 at 44100 Hz.
+// by sampling the audio input (A7 on megaAVR, recPin elsewhere) at 44100 Hz,
+// or REC_SAMPLE_RATE on the boards that capture with DMA.
+// The Nano (328P) has no ADC recorder: Timer1's input capture times the
+// edges on pin 8 (ICP1, a digital input, so the signal wants squaring up
+// first), so it needs Use_Rec_CSW.  Timer1 is the playback timer, so
+// recording only starts when stopped, as on the other boards.
+// With Use_Rec_CSW the same samples are turned into pulse lengths instead,
+// and written as a CSW Recording (TZX block 0x18).
+// With Use_Rec_Monitor (megaAVR) the sliced input is also sent straight to
+// the output, one sample late, so the machine can load the tape while it's
+// being recorded and show that the capture is good.
+// With REC_PREROLL the input is sampled into a small ring from the moment
+// REC is pressed, and all the while it's paused for the motor, so the last
+// REC_PREROLL_BYTES before recording starts (the file set up, or the motor
+// running) aren't lost: a late press doesn't cost the start of the leader.
+// With REC_SPLIT a silence of REC_SPLIT_MS closes the file and recording
+// goes on in the next MaxSave<i>.tzx, so a side of a tape comes out as a
+// file for each program rather than one huge block.
+// With REC_COMPACT an ID15 recording is rewritten as an ID18 CSW block in
+// the background once it stops, while the player sits in the browser.
 
 // NOTE:
 // The rest of MaxDuino can be built with Use_Rec disabled.
@@ -31,6 +50,15 @@ void resume_recording();
 // Stop recording, finalize the TZX header/block and close the file.
 void stop_recording();
 
+#ifdef REC_COMPACT
+#ifdef Use_Rec_CSW
+  #error REC_COMPACT rewrites ID15 recordings, and Use_Rec_CSW already records ID18
+#endif
+// Called from loop() while stopped in the browser: a step of rewriting the
+// last recordings as CSW.  True when one has finished in currentDir.
+bool recording_compact();
+#endif
+
 #else
 
 static inline bool is_recording() { return false; }
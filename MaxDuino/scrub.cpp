@@ -0,0 +1,119 @@
+#include "configs.h"
+#include "scrub.h"
+
+#ifdef BLOCK_SCRUB
+
+#include "buttons.h"
+#include "Display.h"
+#include "file_utils.h"
+#include "MaxProcessing.h"
+#include "processing_state.h"
+
+namespace {
+// file positions of the current block's first data byte and the byte after
+// its last.  bytesRead+bytesToRead stays the same all through a block (it
+// only moves on when a new block's length is read), so when it no longer
+// matches dataEnd a new block has started.
+unsigned long dataStart = 0;
+unsigned long dataEnd = 0;
+word directSampleLength = 0;
+
+unsigned long usPerByte()
+{
+  // how long one byte of the current block takes to play, or 0 if the
+  // current block can't be scrubbed
+  if (dataEnd != bytesRead + bytesToRead) return 0;
+
+  if (currentBlockTask == BLOCKTASK::ID15_TDATA)
+    return (currentID == BLOCKID::ID15) ? 8UL * directSampleLength : 0;
+
+  if (currentTask != TASK::PROCESSID || currentBlockTask != BLOCKTASK::TDATA) return 0;
+  switch (currentID) {
+    case BLOCKID::ID10:
+    case BLOCKID::ID11:
+    case BLOCKID::ID14:
+    case BLOCKID::TAP:
+    case BLOCKID::JTAP:
+      // each bit is two pulses; on average half the bits are ones
+      return 8UL * (zeroPulse + onePulse);
+    default:
+      return 0;
+  }
+}
+
+bool scrub_seek(bool forward)
+{
+  const unsigned long perByte = usPerByte();
+  if (perByte == 0) return false;
+  unsigned long n = (SCRUB_SECONDS * 1000000UL) / perByte;
+  if (n == 0) n = 1;
+
+  if (forward) {
+    // leave the last two bytes, so usedBitsInLastByte and the end of block
+    // handling in getNextDataByte still happen
+    if (bytesToRead <= 2) return false;
+    if (n > bytesToRead - 2) n = bytesToRead - 2;
+    bytesRead += n;
+    bytesToRead -= n;
+  } else {
+    if (bytesRead <= dataStart) return false;
+    if (n > bytesRead - dataStart) n = bytesRead - dataStart;
+    bytesRead -= n;
+    bytesToRead += n;
+  }
+
+  // drop what's left of the current byte and start again from the next one
+  currentBit = 0;
+  pass = 0;
+  return true;
+}
+
+void scrub_show(bool forward)
+{
+  // position within the block, in seconds
+  char buf[16];
+  buf[0] = forward ? '>' : '<';
+  buf[1] = buf[0];
+  buf[2] = ' ';
+  ultoa(((bytesRead - dataStart) * usPerByte()) / 1000000UL, buf+3, 10);
+  strcat(buf, "s  ");
+  printtext(buf, 0);
+}
+} // namespace
+
+void scrub_track()
+{
+  if (dataEnd != bytesRead + bytesToRead) {
+    dataEnd = bytesRead + bytesToRead;
+    dataStart = bytesRead - 1;
+  }
+}
+
+void scrub_track_direct(word sampleLength)
+{
+  directSampleLength = sampleLength;
+  dataStart = bytesRead;
+  dataEnd = bytesRead + bytesToRead;
+}
+
+bool scrub_held(bool (*button_fn)(), bool forward)
+{
+  for (byte i = SCRUB_HOLD_MS/50; i > 0; i--) {
+    if (!button_fn()) return false;
+    delay(50);
+  }
+
+  if (!scrub_seek(forward)) return false;
+  do {
+    scrub_show(forward);
+    for (byte i = SCRUB_REPEAT_MS/50; i > 0 && button_fn(); i--) {
+      delay(50);
+    }
+  } while (button_fn() && scrub_seek(forward));
+
+  scrub_show(forward);
+  debounce(button_fn);
+  return true;
+}
+
+#endif // BLOCK_SCRUB
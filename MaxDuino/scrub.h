@@ -0,0 +1,35 @@
+#ifndef SCRUB_H_INCLUDED
+#define SCRUB_H_INCLUDED
+
+#include "Arduino.h"
+#include "configs.h"
+
+// Scrubbing within a data block.
+// While paused, holding REW or FF (instead of tapping it for a block jump)
+// moves bytesRead back or forward through the current data block, working
+// out how many bytes make SCRUB_SECONDS of output from the block's own bit
+// timings.  Playback resumes from the start of the next byte.
+// Only for blocks that are one long run of bytes: TAP, TZX ID10/11/14 and
+// ID15 direct recordings.
+
+#ifdef BLOCK_SCRUB
+
+#ifndef SCRUB_SECONDS
+  #define SCRUB_SECONDS 5           // per step while the button is held
+#endif
+#define SCRUB_HOLD_MS    600        // longer than this is a hold rather than a tap
+#define SCRUB_REPEAT_MS  250
+
+// called by getNextDataByte after each byte, so the start of the block's data is known
+void scrub_track();
+// called once the ID15 header has been read (its data skips getNextDataByte)
+void scrub_track_direct(word sampleLength);
+
+// Wait to see whether button_fn is a tap or a hold.  On a hold, scrubs
+// until it's released and returns true.  Returns false on a tap, or if the
+// current block can't be scrubbed, so the caller can carry on as before.
+bool scrub_held(bool (*button_fn)(), bool forward);
+
+#endif // BLOCK_SCRUB
+
+#endif // SCRUB_H_INCLUDED
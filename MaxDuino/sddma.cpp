@@ -0,0 +1,150 @@
+#include "configs.h"
+#include "sddma.h"
+
+#ifdef SD_DMA_READ
+
+#include "sdfat_config.h"
+#include <SdFat.h>
+#include <SPI.h>
+
+// SdFat instance is owned by MaxDuino.ino
+extern SdFat sd;
+
+namespace {
+enum class STATE : byte {
+  IDLE,
+  TOKEN,      // waiting for the sector's data token
+  DATA,       // the DMAC has the sector
+  FAILED,
+};
+
+constexpr byte DATA_START_SECTOR = 0xFE;
+constexpr unsigned long TOKEN_TIMEOUT_MS = 300;
+constexpr byte TOKEN_TRIES = 8;       // bytes looked at per poll
+
+// channel 0: SERCOM data to dst, channel 1: ones to the SERCOM.  (The
+// recorder has the DMAC with a table of its own; each puts its own back as
+// it starts, and they're never both going.)
+DmacDescriptor desc[2] __attribute__((aligned(16)));
+DmacDescriptor writeback[2] __attribute__((aligned(16)));
+const byte ones = 0xFF;
+
+STATE state = STATE::IDLE;
+byte *dst;
+word sectorsLeft;
+unsigned long tokenStart;
+
+void dmac_setup() {
+  if (DMAC->BASEADDR.reg == (uint32_t)desc) return;
+  PM->AHBMASK.reg |= PM_AHBMASK_DMAC;
+  PM->APBBMASK.reg |= PM_APBBMASK_DMAC;
+  DMAC->CTRL.reg = 0;
+  DMAC->BASEADDR.reg = (uint32_t)desc;
+  DMAC->WRBADDR.reg = (uint32_t)writeback;
+  DMAC->CTRL.reg = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN(0xf);
+}
+
+void channel_start(byte ch, byte trigger) {
+  DMAC->CHID.reg = DMAC_CHID_ID(ch);
+  DMAC->CHCTRLA.reg = DMAC_CHCTRLA_SWRST;
+  while (DMAC->CHCTRLA.bit.SWRST);
+  DMAC->CHCTRLB.reg = DMAC_CHCTRLB_LVL(0) | DMAC_CHCTRLB_TRIGSRC(trigger) | DMAC_CHCTRLB_TRIGACT_BEAT;
+  DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE;
+}
+
+void sector_start() {
+  // the destination address is the end of the block, as it increments
+  volatile uint32_t *data = &SD_DMA_SERCOM->SPI.DATA.reg;
+  desc[0].BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE | DMAC_BTCTRL_DSTINC;
+  desc[0].BTCNT.reg = 512;
+  desc[0].SRCADDR.reg = (uint32_t)data;
+  desc[0].DSTADDR.reg = (uint32_t)(dst + 512);
+  desc[0].DESCADDR.reg = 0;
+  desc[1].BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE;
+  desc[1].BTCNT.reg = 512;
+  desc[1].SRCADDR.reg = (uint32_t)&ones;
+  desc[1].DSTADDR.reg = (uint32_t)data;
+  desc[1].DESCADDR.reg = 0;
+  channel_start(0, SD_DMA_RX_TRIG);   // (before anything goes out)
+  channel_start(1, SD_DMA_TX_TRIG);
+}
+
+bool sector_done() {
+  DMAC->CHID.reg = DMAC_CHID_ID(0);
+  if (!(DMAC->CHINTFLAG.reg & DMAC_CHINTFLAG_TCMPL)) return false;
+  DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_TCMPL;
+  return true;
+}
+
+void finish(bool ok) {
+  sd.card()->readStop();
+  state = ok ? STATE::IDLE : STATE::FAILED;
+}
+} // anonymous namespace
+
+bool sd_dma_start(byte *to, uint32_t sector, word count) {
+  sd_dma_wait();
+  // whatever multi-sector read SdFat had going ends, in its own books too
+  sd.card()->syncDevice();
+  if (count == 0 || !sd.card()->readStart(sector)) {
+    state = STATE::FAILED;
+    return false;
+  }
+  dmac_setup();
+  dst = to;
+  sectorsLeft = count;
+  tokenStart = millis();
+  state = STATE::TOKEN;
+  return true;
+}
+
+bool sd_dma_busy() {
+  return state == STATE::TOKEN || state == STATE::DATA;
+}
+
+void sd_dma_poll() {
+  switch (state) {
+    case STATE::TOKEN:
+      // the card can take a while to find the sector, so only a few bytes each time
+      for (byte i = 0; i < TOKEN_TRIES; i++) {
+        const byte b = SPI.transfer(0xFF);
+        if (b == DATA_START_SECTOR) {
+          sector_start();
+          state = STATE::DATA;
+          return;
+        }
+        if (b != 0xFF) {
+          finish(false);
+          return;
+        }
+      }
+      if (millis() - tokenStart > TOKEN_TIMEOUT_MS) finish(false);
+      break;
+
+    case STATE::DATA:
+      if (!sector_done()) break;
+      // the CRC, which SdFat only checks with USE_SD_CRC
+      SPI.transfer(0xFF);
+      SPI.transfer(0xFF);
+      dst += 512;
+      if (--sectorsLeft == 0) {
+        finish(true);
+        break;
+      }
+      tokenStart = millis();
+      state = STATE::TOKEN;
+      break;
+
+    default:
+      break;
+  }
+}
+
+bool sd_dma_wait() {
+  while (sd_dma_busy()) sd_dma_poll();
+  const bool ok = (state == STATE::IDLE);
+  state = STATE::IDLE;
+  return ok;
+}
+
+#endif // SD_DMA_READ
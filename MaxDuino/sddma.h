@@ -0,0 +1,43 @@
+#ifndef SDDMA_H_INCLUDED
+#define SDDMA_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef SD_DMA_READ
+#include "Arduino.h"
+
+// Background sector reads on the SAMD21: the read-ahead window after the
+// one being played is read from the card by the DMAC while the decoders go
+// on with this one.  The card's multi-sector read is started (and stopped)
+// through SdFat; in between, the wait for each sector's data token is
+// polled a few bytes at a time from TZXLoop, and the 512 bytes themselves
+// are clocked in by two DMAC channels (0xFF out, the data in).  Only
+// SD_RAW_READ's contiguous files are read this way, and nothing else may use
+// the card (or its SPI bus) while one is going on: readahead_fill and
+// readahead_invalidate wait for it first.
+
+#if !defined(__SAMD21__)
+  #error SD_DMA_READ drives the DMAC and SERCOM of a SAMD21
+#endif
+#if !defined(SD_RAW_READ) || !defined(READAHEAD_PREFETCH)
+  #error SD_DMA_READ reads SD_RAW_READ's sectors into READAHEAD_PREFETCH's second window
+#endif
+#if defined(OLED_SPI) || defined(P8544_SPI) || defined(USB_STORAGE_TASK)
+  #error SD_DMA_READ needs the SPI bus of the card to itself
+#endif
+
+// The SERCOM the SD card's SPI is on (SPI, on the XIAO), and its DMAC triggers
+#ifndef SD_DMA_SERCOM
+  #define SD_DMA_SERCOM SERCOM0
+  #define SD_DMA_RX_TRIG SERCOM0_DMAC_ID_RX
+  #define SD_DMA_TX_TRIG SERCOM0_DMAC_ID_TX
+#endif
+
+// Read count sectors from sector into dst, in the background
+bool sd_dma_start(byte *dst, uint32_t sector, word count);
+bool sd_dma_busy();
+void sd_dma_poll();               // TZXLoop: move the read on
+bool sd_dma_wait();               // until it's done; false if it failed
+#endif
+
+#endif // SDDMA_H_INCLUDED
@@ -22,4 +22,35 @@
   #endif
 #endif
 
+// SD_SDIO: the card is on the board's 4-bit SDIO/SDMMC interface rather
+// than SPI, through SdFat's own SdioCard, so sd, entry and sd.card() (the
+// raw reads and USB storage) all work as before, only faster.  That needs
+// a board SdFat has an SDIO driver for (HAS_SDIO_CLASS, the Teensy 3.6 and
+// 4.x), checked in file_utils.cpp, and none of the boards here has one, so
+// it isn't in their configs.  The interface sets its own clock, so no
+// SD_CLOCK_PROBE.
+#if defined(SD_SDIO) && defined(SD_CLOCK_PROBE)
+  #error SD_CLOCK_PROBE is for SPI cards, SD_SDIO sets its own clock
+#endif
+
+// SD_CLOCK_PROBE: rather than one fixed clock, setup() tries the card at each
+// of these (MHz) in turn, fastest first, dedicated SPI before shared where
+// that's enabled, and keeps the first that reads the same sectors back the
+// same twice (sd_probe).  Build SdFat with USE_SD_CRC for the card's CRC to
+// be checked on every transfer as well.  The SPI driver rounds each down to
+// what the board can make.
+#ifdef SD_CLOCK_PROBE
+  #ifndef SD_PROBE_CLOCKS
+    #if defined(ESP32)
+      #define SD_PROBE_CLOCKS 40, 25, 16, 8, 4
+    #elif defined(ESP8266)
+      #define SD_PROBE_CLOCKS 20, 10, 4
+    #elif defined(__arm__)
+      #define SD_PROBE_CLOCKS 36, 24, 18, 12, 4
+    #else
+      #define SD_PROBE_CLOCKS 8, 4
+    #endif
+  #endif
+#endif
+
 #endif // SDFAT_CONFIG_H_INCLUDED
@@ -0,0 +1,35 @@
+#include "configs.h"
+#include "sdswap.h"
+
+#ifdef SD_HOTSWAP
+
+#include "file_utils.h"
+
+namespace {
+cid_t cid;                          // the card's, as mounted
+bool cidValid = false;
+unsigned long lastPoll = 0;
+} // anonymous namespace
+
+void sdswap_mounted() {
+#ifdef SD_CD_PIN
+  pinMode(SD_CD_PIN, INPUT_PULLUP);
+#endif
+  cidValid = sd.card()->readCID(&cid);
+  lastPoll = millis();
+}
+
+bool sdswap_changed(bool idle) {
+#ifdef SD_CD_PIN
+  if (digitalRead(SD_CD_PIN) != SD_CD_ACTIVE) return true;
+#endif
+  // (a card that wouldn't give its CID at mount is only seen going with SD_CD_PIN)
+  if (!cidValid || !idle || millis() - lastPoll < SD_HOTSWAP_POLL) return false;
+  lastPoll = millis();
+  sd.card()->syncDevice();          // ends a dedicated SPI card's multi-sector read first
+  cid_t now;
+  if (!sd.card()->readCID(&now)) return true;
+  return memcmp(&now, &cid, sizeof(cid)) != 0;
+}
+
+#endif // SD_HOTSWAP
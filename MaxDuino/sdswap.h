@@ -0,0 +1,35 @@
+#ifndef SDSWAP_H_INCLUDED
+#define SDSWAP_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef SD_HOTSWAP
+#include "Arduino.h"
+
+// Changing the card without a reset.  With SD_CD_PIN set to the socket's
+// card detect switch, taking the card out is seen at once (and stops a file
+// that's playing); without one, the card's CID is read back every
+// SD_HOTSWAP_POLL ms while stopped, so a card that's gone, or another in
+// its place, is seen by the next poll.  Either way the main loop then waits
+// for a card ("No SD Card", as at power on), mounts it the way setup does
+// (at SD_CLOCK_PROBE's fastest clock, if that's on), and goes back to the
+// directory it was in if the new card has the same one there (the same
+// names at the same positions all the way down), else to the root.  The
+// listing, sorted view and name window are built again from the new card,
+// and the read-ahead window and RATE_PROBE's table are thrown away.
+
+#ifndef SD_HOTSWAP_POLL
+  #define SD_HOTSWAP_POLL 1000      // ms between CID reads, with no SD_CD_PIN
+#endif
+#ifdef SD_CD_PIN
+  #ifndef SD_CD_ACTIVE
+    #define SD_CD_ACTIVE LOW        // the level SD_CD_PIN reads with a card in
+  #endif
+#endif
+
+void sdswap_mounted();              // setup, and after a remount: the card that's in now
+// From the main loop (idle: nothing playing): true once the card's gone or another's in
+bool sdswap_changed(bool idle);
+#endif
+
+#endif // SDSWAP_H_INCLUDED
@@ -0,0 +1,108 @@
+#include "configs.h"
+#include "serqueue.h"
+
+#ifdef SERIAL_QUEUE
+
+#include "sertrace.h"
+
+namespace {
+constexpr byte MASK = SERIAL_QUEUE_SIZE - 1;
+static_assert((SERIAL_QUEUE_SIZE & MASK) == 0 && SERIAL_QUEUE_SIZE <= 256, "SERIAL_QUEUE_SIZE must be a power of 2, up to 256");
+
+byte q[SERIAL_QUEUE_SIZE];
+byte head = 0;              // where the next byte goes
+byte tail = 0;              // the next to send
+word lost = 0;              // lines dropped since the last that went in
+bool blockQueued = false;   // the last line in is a block line...
+byte blockAt;               // ...starting here
+byte lineAt;                // where the last line in starts (after any note)
+
+byte used() {
+  return (head - tail) & MASK;
+}
+
+byte room() {
+  return MASK - used();     // one kept empty, so full isn't empty
+}
+
+void put_byte(char c) {
+  q[head] = c;
+  head = (head + 1) & MASK;
+}
+
+void put(const char *text, bool pgm) {
+  for (;;) {
+    const char c = pgm ? pgm_read_byte(text) : *text;
+    if (!c) break;
+    put_byte(c);
+    text++;
+  }
+  put_byte('\r');
+  put_byte('\n');
+}
+
+bool queue(const char *text, bool pgm) {
+  const word len = pgm ? strlen_P(text) : strlen(text);
+  char note[14] = "";
+  if (lost) {
+    strcpy_P(note, PSTR("("));
+    utoa(lost, note + 1, 10);
+    strcat_P(note, PSTR(" lost)"));
+  }
+  const word need = len + 2 + (lost ? strlen(note) + 2 : 0);
+  if (need > room()) {
+    if (lost < 9999) lost++;
+    return false;
+  }
+  if (lost) {
+    put(note, false);
+    lost = 0;
+  }
+  lineAt = head;
+  put(text, pgm);
+  serq_service();
+  return true;
+}
+} // anonymous namespace
+
+void serq_line(const char *text) {
+  if (queue(text, false)) blockQueued = false;
+}
+
+void serq_lineF(const char *text) {
+  if (queue(text, true)) blockQueued = false;
+}
+
+void serq_block(word block, byte id) {
+  char line[18];
+  strcpy_P(line, PSTR("BLK:"));
+  utoa(block, line + 4, 10);
+  strcat_P(line, PSTR(" ID:"));
+  char *hex = line + strlen(line);
+  utoa(id, hex, 16);
+  for (; *hex; hex++) {
+    if (*hex >= 'a') *hex -= 'a' - 'A';   // as Serial.print(id, HEX)
+  }
+  // the last block line, if none of it has gone yet, gives way to this one
+  const byte was = head;
+  if (blockQueued && used() >= ((head - blockAt) & MASK)) head = blockAt;
+  if (queue(line, false)) {
+    blockQueued = true;
+    blockAt = lineAt;
+  } else {
+    head = was;             // nothing went in, so the last one's still there
+  }
+}
+
+void serq_service() {
+#ifdef SERIAL_TRACE
+  if (trace_busy()) return;         // not in the middle of a frame
+#endif
+  int n = Serial.availableForWrite();
+  while (n-- > 0 && tail != head) {
+    Serial.write(q[tail]);
+    tail = (tail + 1) & MASK;
+  }
+}
+
+#endif // SERIAL_QUEUE
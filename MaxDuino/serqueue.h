@@ -0,0 +1,35 @@
+#ifndef SERQUEUE_H_INCLUDED
+#define SERQUEUE_H_INCLUDED
+
+#include "Arduino.h"
+#include "configs.h"
+
+// The SERIALSCREEN lines (the screen's text, the file name, the block)
+// without Serial.print's wait: once the core's transmit buffer is full,
+// that holds up the main loop, and so the buffer refill, for as long as
+// the rest takes at 115200 baud.  They go into a ring here instead, and
+// from there into the core's buffer (which its TX interrupt drains) only
+// as much as it has room for, a bit at a time from the main loop.
+//
+// A line that doesn't fit is dropped whole, never cut short, and the next
+// one that does gets "(n lost)" in front of it.  A block line while the
+// last is still waiting takes its place (only the newest block matters).
+// With SERIAL_TRACE, lines only go out between its frames.
+
+#ifdef SERIAL_QUEUE
+
+#ifndef SERIALSCREEN
+  #error SERIAL_QUEUE queues SERIALSCREEN lines, so needs SERIALSCREEN
+#endif
+
+#ifndef SERIAL_QUEUE_SIZE
+  #define SERIAL_QUEUE_SIZE 128     // a power of 2, up to 256
+#endif
+
+void serq_line(const char *text);   // as Serial.println: a line
+void serq_lineF(const char *text);  // a line from PROGMEM
+void serq_block(word block, byte id);   // "BLK:n ID:xx"
+void serq_service();                // from the main loop: what there's room for
+#endif
+
+#endif // SERQUEUE_H_INCLUDED
@@ -0,0 +1,71 @@
+#include "configs.h"
+#include "sertrace.h"
+
+#ifdef SERIAL_TRACE
+
+namespace {
+constexpr byte TRACE_HEADER = 6;
+
+byte header[TRACE_HEADER] = { 'M', 'X', 'T' };
+const volatile byte *traceData = nullptr;
+word traceLen = 0;
+word tracePos = 0;          // header, then data, then the sum
+byte traceSum = 0;
+byte traceSeq = 0;
+bool traceBusy = false;
+
+void begin_frame(const volatile byte *p, word n) {
+  header[3] = traceSeq++;
+  header[4] = n >> 8;
+  header[5] = n & 0xFF;
+  traceData = p;
+  traceLen = n;
+  tracePos = 0;
+  traceSum = 0;
+  traceBusy = true;
+}
+}
+
+void setup_serial_trace() {
+  Serial.begin(SERIAL_TRACE_BAUD);
+}
+
+void trace_start() {
+  traceSeq = 0;
+  begin_frame(nullptr, 0);
+  trace_service();
+}
+
+void trace_page(const volatile byte *p, word n) {
+  // a frame still going out is dropped: this page has to go while it's still the ISR's
+  begin_frame(p, n);
+  trace_service();
+}
+
+bool trace_busy() {
+  return traceBusy;
+}
+
+void trace_service() {
+  if (!traceBusy) return;
+  int room = Serial.availableForWrite();
+  while (room > 0) {
+    const word total = TRACE_HEADER + traceLen;
+    byte b;
+    if (tracePos < TRACE_HEADER) {
+      b = header[tracePos];
+    } else if (tracePos < total) {
+      b = traceData[tracePos - TRACE_HEADER];
+      traceSum += b;
+    } else {
+      Serial.write(traceSum);
+      traceBusy = false;
+      return;
+    }
+    Serial.write(b);
+    tracePos++;
+    room--;
+  }
+}
+
+#endif // SERIAL_TRACE
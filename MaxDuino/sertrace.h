@@ -0,0 +1,39 @@
+#ifndef SERTRACE_H_INCLUDED
+#define SERTRACE_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef SERIAL_TRACE
+#include "Arduino.h"
+
+// Sends every page of buffer words out of the serial port as the main loop
+// hands it to the ISR, so a host can rebuild the output (as a .mxw body,
+// or a WAV) and compare it with a good one.  Each page is one frame:
+//
+//   "MXT", seq, byte count (high byte first), the words (high byte first,
+//   as in a .mxw), then the 8 bit sum of the words' bytes
+//
+// seq counts the pages (and wraps); a frame with no words and seq 0 starts
+// each file.  The frame goes out a bit at a time from the main loop, only
+// ever as much as the serial driver has room for, so it never holds up
+// playback: if the next page is ready before a frame has all gone, the rest
+// is dropped, and the host sees the bad sum and the gap in seq.  Anything
+// SERIALSCREEN prints comes in between frames, so the host should look for
+// "MXT" and check the sum (with SERIAL_QUEUE, never inside one).
+
+#ifdef CDC_STREAM
+  #error SERIAL_TRACE and CDC_STREAM both need the serial port to themselves
+#endif
+
+#ifndef SERIAL_TRACE_BAUD
+  #define SERIAL_TRACE_BAUD 1000000
+#endif
+
+void setup_serial_trace();
+void trace_start();                                 // start of each file
+void trace_page(const volatile byte *p, word n);    // from next_write_page
+void trace_service();                               // from the main loop: send what there's room for
+bool trace_busy();                                  // a frame part way out (SERIAL_QUEUE waits for it)
+#endif
+
+#endif // SERTRACE_H_INCLUDED
@@ -0,0 +1,303 @@
+#include "configs.h"
+#include "compat.h"
+#include "snapshot.h"
+
+#ifdef Use_SNAPSHOT
+
+#include "MaxDuino.h"
+#include "MaxProcessing.h"
+#include "processing_state.h"
+#include "file_utils.h"
+#include "bytesrc.h"
+
+#ifndef SNAP_PAUSE
+  #define SNAP_PAUSE 250        // ms between the blocks: the loader is waiting for each
+#endif
+
+namespace {
+constexpr word PROG_AT = 23755;         // PROG, on a 48K after NEW
+constexpr word STUB_AT = 0x5700;        // where the loader runs, with its stack under 0x5800
+constexpr byte STUB_IN_PROG = 16;       // the REM's first byte, after "10 RANDOMIZE USR VAL "23771":REM "
+
+// The loader, hand assembled.  It starts in the REM and copies itself up
+// to STUB_AT, since the last part overwrites the program.  The bytes
+// marked are filled in from the snapshot.
+const byte stub[] PROGMEM = {
+  0xF3,                                 //  0  di
+  0x21, lowByte(PROG_AT+STUB_IN_PROG), highByte(PROG_AT+STUB_IN_PROG),  // ld hl,REM
+  0x11, lowByte(STUB_AT), highByte(STUB_AT),                            // ld de,STUB_AT
+  0x01, 113, 0,                         //  7  ld bc,sizeof(stub)
+  0xED, 0xB0,                           // 10  ldir
+  0xC3, 15, highByte(STUB_AT),          // 12  jp STUB_AT+15
+  0x31, 0x00, 0x58,                     // 15  ld sp,5800h
+  0xDD, 0x21, 0x00, 0x40,               // 18  ld ix,4000h   the screen, less the loader's band
+  0x11, 0x00, 0x17,                     // 22  ld de,1700h
+  0xCD, 84, highByte(STUB_AT),          // 25  call load
+  0xDD, 0x21, 0x00, 0x58,               // 28  ld ix,5800h   the attributes
+  0x11, 0x00, 0x03,                     // 32  ld de,0300h
+  0xCD, 84, highByte(STUB_AT),          // 35  call load
+  0xDD, 0x21, 0x00, 0x5B,               // 38  ld ix,5B00h   the rest
+  0x11, 0x00, 0xA5,                     // 42  ld de,A500h
+  0xCD, 84, highByte(STUB_AT),          // 45  call load
+  0x31, 93, highByte(STUB_AT),          // 48  ld sp,regs
+  0xC1, 0xD1, 0xE1, 0xD9,               // 51  pop bc / de / hl, exx
+  0xF1, 0x08,                           // 55  pop af, ex af,af'
+  0xDD, 0xE1, 0xFD, 0xE1,               // 57  pop ix, pop iy
+  0x3E, 0x00, 0xED, 0x47,               // 61  ld a,I*  ld i,a
+  0x3E, 0x00, 0xD3, 0xFE,               // 65  ld a,border*  out (FEh),a
+  0xED, 0x56,                           // 69  im 1*
+  0x3E, 0x00, 0xED, 0x4F,               // 71  ld a,R*  ld r,a
+  0xC1, 0xD1, 0xE1, 0xF1,               // 75  pop bc / de / hl / af
+  0x31, 0x00, 0x00,                     // 79  ld sp,SP*
+  0x00,                                 // 82  nop, or ei*
+  0xC9,                                 // 83  ret, to the PC on the stack
+  0x3E, 0xFF, 0x37,                     // 84  load: ld a,FFh  scf
+  0xCD, 0x56, 0x05,                     // 87  call LD-BYTES
+  0xF3, 0xD8, 0xC7,                     // 90  di, ret c, or rst 0 on a tape error
+  // 93  regs*: bc', de', hl', af', ix, iy, bc, de, hl, af
+  0,0, 0,0, 0,0, 0,0, 0,0, 0,0, 0,0, 0,0, 0,0, 0,0,
+};
+constexpr byte STUB_I = 62;
+constexpr byte STUB_BORDER = 66;
+constexpr byte STUB_IM = 70;
+constexpr byte STUB_R = 72;
+constexpr byte STUB_SP = 80;
+constexpr byte STUB_EI = 82;
+constexpr byte STUB_REGS = 93;
+static_assert(sizeof(stub) == 113, "the loader copies 113 bytes");
+static_assert(lowByte(STUB_AT) == 0, "the loader's jumps only give the high byte of STUB_AT");
+
+// 10 RANDOMIZE USR VAL "23771":REM <stub>
+const byte progStart[STUB_IN_PROG] PROGMEM = {
+  0x00, 0x0A, STUB_IN_PROG - 4 + sizeof(stub) + 1, 0x00,
+  0xF9, 0xC0, 0xB0, '"', '2', '3', '7', '7', '1', '"', ':', 0xEA,
+};
+constexpr byte PROG_LEN = STUB_IN_PROG + sizeof(stub) + 1;   // and the line's 0x0D
+
+struct SNAP_PART {
+  word at;
+  word len;
+};
+// in the order the loader takes them; the last ends the file for a .sna
+const SNAP_PART parts[] PROGMEM = {
+  { 0x4000, 0x1700 },
+  { 0x5800, 0x0300 },
+  { 0x5B00, 0xA500 },
+};
+constexpr byte PARTS = sizeof(parts) / sizeof(parts[0]);
+
+byte snapHeader[18];          // flag and the ROM header
+byte snapProg[PROG_LEN];
+byte step = 0;                // the next block: header, program, then parts
+
+// where the RAM comes from
+bool paged = false;           // .z80 v2/v3: 16K pages, each packed or not
+bool packed = false;          // the part of the file being read is packed
+unsigned long dataAt = 0;     // the start of the RAM, or of a page
+unsigned long pageAt[3];      // the pages for 4000h, 8000h and C000h (.z80 pages 8, 4 and 5)
+bool pagePacked[3];
+word pcAt = 0;                // a .z80's PC goes in RAM here, 0 for a .sna
+word pc = 0;
+
+word cur = 0;                 // the address of the next byte
+byte rleLeft = 0;
+byte rleByte = 0;
+
+byte next_file_byte() {
+  return ReadByte() ? outByte : 0;
+}
+
+byte unpack() {
+  // .z80 packing: ED ED n b is n copies of b, and the byte after a lone ED is as it is
+  if (!packed) return next_file_byte();
+  if (rleLeft) {
+    rleLeft--;
+    return rleByte;
+  }
+  const byte b = next_file_byte();
+  if (b != 0xED) return b;
+  const byte n = next_file_byte();
+  if (n != 0xED) {
+    rleLeft = 1;
+    rleByte = n;
+    return 0xED;
+  }
+  const byte count = next_file_byte();
+  rleByte = next_file_byte();
+  rleLeft = count ? count - 1 : 0;
+  return rleByte;
+}
+
+void seek(word a) {
+  rleLeft = 0;
+  if (paged) {
+    const byte i = (a >> 14) - 1;
+    bytesRead = pageAt[i];
+    packed = pagePacked[i];
+    cur = a & 0xC000;
+  } else {
+    bytesRead = dataAt;
+    cur = 0x4000;
+  }
+  if (!packed) {
+    bytesRead += a - cur;
+    cur = a;
+    return;
+  }
+  while (cur != a) {
+    unpack();
+    cur++;
+  }
+}
+
+byte snap_next() {
+  if (paged && (cur & 0x3FFF) == 0) seek(cur);   // on to the next page
+  byte b = unpack();
+  if (pcAt) {
+    if (cur == pcAt) b = lowByte(pc);
+    else if (cur == pcAt + 1) b = highByte(pc);
+  }
+  cur++;
+  return b;
+}
+
+void set_word(byte at, word w) {
+  snapProg[STUB_IN_PROG + at] = lowByte(w);
+  snapProg[STUB_IN_PROG + at + 1] = highByte(w);
+}
+
+void set_regs(byte i, byte r, byte border, byte im, bool ei, word sp, const word *regs) {
+  byte *s = snapProg + STUB_IN_PROG;
+  s[STUB_I] = i;
+  s[STUB_R] = r;
+  s[STUB_BORDER] = border & 7;
+  s[STUB_IM] = (im == 0) ? 0x46 : (im == 2) ? 0x5E : 0x56;
+  s[STUB_EI] = ei ? 0xFB : 0x00;
+  set_word(STUB_SP, sp);
+  for (byte n = 0; n < 10; n++) set_word(STUB_REGS + 2*n, regs[n]);
+}
+
+bool read_sna() {
+  // 27 byte header: i, hl' de' bc' af', hl de bc iy ix, iff2, r, af, sp, im, border; then 48K
+  byte h[27];
+  if (filesize != 27 + 49152UL || readfile_bytes(h, 27, 0) != 27) return false;
+  #define W(n) word(h[(n)+1], h[(n)])
+  const word regs[10] = { W(5), W(3), W(1), W(7), W(17), W(15), W(13), W(11), W(9), W(21) };
+  set_regs(h[0], h[20], h[26], h[25], bitRead(h[19], 2), W(23), regs);
+  #undef W
+  paged = false;
+  packed = false;
+  dataAt = 27;
+  pcAt = 0;
+  return true;
+}
+
+bool read_z80() {
+  // 30 byte header: a f, bc, hl, pc, sp, i, r, flags, de, bc' de' hl', a' f', iy, ix, iff1, iff2, im
+  byte h[35];
+  if (readfile_bytes(h, 30, 0) != 30) return false;
+  #define W(n) word(h[(n)+1], h[(n)])
+  if (h[12] == 0xFF) h[12] = 1;
+  pc = W(6);
+  if (pc == 0) {
+    // v2/v3: the PC comes after, then the hardware, and the pages after the extra header
+    if (readfile_bytes(h + 30, 5, 30) != 5) return false;
+    const word extra = W(30);
+    const byte mode = h[34];
+    if (mode > 1 && !(extra != 23 && mode == 3)) return false;   // 128K, or a v2's other machines
+    pc = W(32);
+    paged = true;
+    byte found = 0;
+    unsigned long p = 32 + extra;
+    while (p + 3 <= filesize) {
+      byte ph[3];
+      if (readfile_bytes(ph, 3, p) != 3) break;
+      const word len = word(ph[1], ph[0]);
+      const byte page = ph[2];
+      p += 3;
+      const byte i = (page == 8) ? 0 : (page == 4) ? 1 : (page == 5) ? 2 : 3;
+      if (i < 3) {
+        pageAt[i] = p;
+        pagePacked[i] = (len != 0xFFFF);
+        found |= bit(i);
+      }
+      p += (len == 0xFFFF) ? 16384 : len;
+    }
+    if (found != 7) return false;
+  } else {
+    paged = false;
+    packed = bitRead(h[12], 5);
+    dataAt = 30;
+  }
+  const word sp = W(8);
+  const word regs[10] = { W(15), W(17), W(19), word(h[21], h[22]), W(25), W(23), W(2), W(13), W(4), word(h[0], h[1]) };
+  set_regs(h[10], (h[11] & 0x7F) | ((h[12] & 1) << 7), h[12] >> 1, h[29] & 3, h[27], sp - 2, regs);
+  #undef W
+  pcAt = sp - 2;
+  return true;
+}
+
+void make_header() {
+  // a PROGRAM, named from the file, that runs from line 10
+  byte *h = snapHeader;
+  h[0] = 0x00;
+  h[1] = 0x00;
+  for (byte i = 0; i < 10; i++) {
+    byte c = (i < strlen(fileName)) ? fileName[i] : ' ';
+    if (c < 0x20 || c > 0x7f) c = '?';
+    h[2 + i] = c;
+  }
+  h[12] = PROG_LEN;
+  h[13] = 0;
+  h[14] = 10;
+  h[15] = 0;
+  h[16] = PROG_LEN;
+  h[17] = 0;
+}
+} // namespace
+
+void snap_init(const char *ext) {
+  memcpy_P(snapProg, progStart, STUB_IN_PROG);
+  memcpy_P(snapProg + STUB_IN_PROG, stub, sizeof(stub));
+  snapProg[PROG_LEN - 1] = 0x0D;
+  const bool ok = !strcasecmp_P(ext, PSTR("sna")) ? read_sna() : read_z80();
+  if (!ok) {
+    HeaderFail();
+    return;
+  }
+  make_header();
+  step = 0;
+  currentTask = TASK::PROCESSID;
+  currentID = BLOCKID::SNAP;
+}
+
+bool snap_queue_block() {
+  bytesrc_clear();
+  pauseLength = SNAP_PAUSE;
+  pilotPulses = PILOTNUMBERH + 1;
+  if (step == 0) {
+    bytesrc_ram(snapHeader, sizeof(snapHeader));
+    bytesrc_xorsum();
+    bytesToRead = sizeof(snapHeader) + 2;
+    pilotPulses = PILOTNUMBERL + 1;
+  } else if (step == 1) {
+    bytesrc_fill(0xFF, 1);
+    bytesrc_ram(snapProg, PROG_LEN);
+    bytesrc_xorsum();
+    bytesToRead = PROG_LEN + 3;
+  } else if (step < 2 + PARTS) {
+    SNAP_PART part;
+    memcpy_P(&part, &parts[step - 2], sizeof(part));
+    seek(part.at);
+    bytesrc_fill(0xFF, 1);
+    bytesrc_func(snap_next, part.len);
+    bytesrc_xorsum();
+    bytesToRead = (unsigned long)part.len + 3;
+  } else {
+    return false;
+  }
+  step++;
+  return true;
+}
+
+#endif // Use_SNAPSHOT
@@ -0,0 +1,23 @@
+#ifndef SNAPSHOT_H_INCLUDED
+#define SNAPSHOT_H_INCLUDED
+
+#include "Arduino.h"
+#include "configs.h"
+
+#ifdef Use_SNAPSHOT
+// 48K Spectrum snapshots (.sna, .z80 v1 to v3) played as a tape the ROM
+// loads: a BASIC program whose REM holds a small loader, then the RAM in
+// three ROM blocks (the screen, the attributes, and 0x5B00 on).  The
+// loader copies itself into a band of the screen (0x5700-0x57FF, which is
+// the only RAM the snapshot doesn't get back), calls the ROM's LD-BYTES for
+// each part, then puts the registers back and jumps in.
+//
+// Nothing is written out: .z80 pages are unpacked as the blocks play, and
+// a .z80's PC goes on its stack, as a .sna keeps it.  128K snapshots are
+// refused.
+
+void snap_init(const char *ext); // after the file opens ("sna" or "z80"): check it, and make up the first two blocks
+bool snap_queue_block();        // the next block's bytes (bytesrc.h) and pilot, false after the last
+#endif
+
+#endif // SNAPSHOT_H_INCLUDED
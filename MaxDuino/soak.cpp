@@ -0,0 +1,124 @@
+#include "configs.h"
+#include "soak.h"
+
+#ifdef SOAK_TEST
+
+#include "file_utils.h"
+#include "outputstats.h"
+#include "buffer.h"
+
+SOAK soakMode = SOAK::OFF;
+
+namespace {
+constexpr byte LINE_SIZE = 64;
+constexpr byte NAME_WIDTH = 14;
+const char LOG_PATH[] PROGMEM = "/MAXSOAK.LOG";
+
+char name[NAME_WIDTH + 1];     // the file of this pass (fileName has the next by the end)
+unsigned long passStart;
+word passes = 0;               // since the last summary
+word regressions;
+unsigned long baseIsrMax;      // the first pass's
+unsigned long worstIsr;
+byte leastAhead;
+unsigned long totalUnderruns;
+unsigned long totalCatchUps;
+
+char *put_number(char *p, unsigned long v, byte width) {
+  // right aligned in width, and a comma after; too big shows as all 9s
+  unsigned long most = 9;
+  for (byte i = 1; i < width; i++) most = most * 10 + 9;
+  if (v > most) v = most;
+  char digits[11];
+  ultoa(v, digits, 10);
+  const byte n = strlen(digits);
+  memset(p, ' ', width - n);
+  memcpy(p + width - n, digits, n);
+  p += width;
+  *p++ = ',';
+  return p;
+}
+
+void write_line(char *line) {
+  line[LINE_SIZE-2] = '\r';
+  line[LINE_SIZE-1] = '\n';
+  char path[sizeof(LOG_PATH)];
+  strcpy_P(path, LOG_PATH);
+  SdBaseFile log;
+  if (!log.open(path, O_RDWR | O_CREAT)) return;
+  // on a line boundary, even if something else has been at the file
+  const unsigned long at = (log.fileSize() + LINE_SIZE - 1) & ~(unsigned long)(LINE_SIZE - 1);
+  if (at > log.fileSize()) {
+    log.seekEnd();
+    while (log.fileSize() < at && log.write(" ", 1) == 1) {}
+  }
+  if (log.seekSet(at)) log.write(line, LINE_SIZE);
+  log.close();
+}
+} // anonymous namespace
+
+void soak_start() {
+  byte i = 0;
+  for (; i < NAME_WIDTH && fileName[i]; i++) {
+    name[i] = (fileName[i] == ',') ? '_' : fileName[i];
+  }
+  name[i] = '\0';
+  passStart = millis();
+}
+
+void soak_pass() {
+  OutputStats s;
+  stats_get(s);
+  if (!passes) {
+    baseIsrMax = s.isrMax;
+    worstIsr = 0;
+    leastAhead = BUFFER_PAGES;
+    regressions = 0;
+    totalUnderruns = 0;
+    totalCatchUps = 0;
+  }
+  passes++;
+  if (s.isrMax > worstIsr) worstIsr = s.isrMax;
+  if (s.pagesAheadMin < leastAhead) leastAhead = s.pagesAheadMin;
+  totalUnderruns += s.underruns;
+  totalCatchUps += s.catchUps;
+
+  char line[LINE_SIZE];
+  memset(line, ' ', LINE_SIZE);
+  memcpy(line, name, strlen(name));
+  char *p = line + NAME_WIDTH;
+  *p++ = ',';
+  p = put_number(p, passes, 5);
+  p = put_number(p, millis() - passStart, 8);
+  p = put_number(p, s.isrMax, 4);
+  p = put_number(p, s.isrAvg, 4);
+  p = put_number(p, s.lateMax, 5);
+  p = put_number(p, s.pagesAheadMin, 2);
+  p = put_number(p, s.catchUps, 4);
+  p = put_number(p, s.underruns, 4);
+  const char *flags = p;
+  if (s.underruns) *p++ = 'U';
+  if (!s.pagesAheadMin) *p++ = 'A';
+  if (s.isrMax > baseIsrMax + baseIsrMax/4) *p++ = 'I';
+  if (p != flags) regressions++;
+  write_line(line);
+}
+
+void soak_end() {
+  if (!passes) return;
+  char line[LINE_SIZE];
+  memset(line, ' ', LINE_SIZE);
+  strcpy_P(line, PSTR("SOAK,"));
+  char *p = line + 5;
+  p = put_number(p, passes, 5);
+  p = put_number(p, regressions, 5);
+  p = put_number(p, worstIsr, 4);
+  p = put_number(p, leastAhead, 2);
+  p = put_number(p, totalUnderruns, 6);
+  p = put_number(p, totalCatchUps, 6);
+  p[-1] = ' ';    // (no comma after the last)
+  write_line(line);
+  passes = 0;
+}
+
+#endif // SOAK_TEST
@@ -0,0 +1,46 @@
+#ifndef SOAK_H_INCLUDED
+#define SOAK_H_INCLUDED
+
+#include "Arduino.h"
+#include "configs.h"
+
+// Burn-in: with Soak Test on in the menu, a file that plays to the end
+// plays again (File), or the next in its directory does, round to the
+// first again after the last (Folder), until stop is pressed.  Each pass
+// puts a line in /MAXSOAK.LOG with OUTPUT_STATS's numbers for it, and
+// stop puts a summary after them, so a unit with a marginal card or clock
+// shows up in the log before it ships.  Each line is 64 bytes, as
+// /MAXPLAY.LOG's (playlog.h), comma separated:
+//
+//   name, pass, ms, ISR us max, ISR us avg, latest edge us, least pages
+//   ahead, catch-ups, underruns, flags
+//
+// The flags are what makes a pass a regression: U if it underran, A if the
+// ISR ever got to the last page (no pages ahead), I if its longest ISR was
+// more than a quarter over the first pass's.  The summary line is
+//
+//   "SOAK", passes, regressions, worst ISR us, least pages ahead,
+//   underruns, catch-ups (over all the passes)
+//
+// The lines go to the card from fileEnded and stopFile, after UniStop has
+// stopped the timer.  Needs AUTO_ADVANCE (to start the next pass) and
+// OUTPUT_STATS (for the numbers, which then needn't go over SERIALSCREEN).
+
+#ifdef SOAK_TEST
+
+#ifndef AUTO_ADVANCE
+  #error SOAK_TEST starts each pass the way AUTO_ADVANCE does, so needs AUTO_ADVANCE
+#endif
+#ifndef OUTPUT_STATS
+  #error SOAK_TEST logs OUTPUT_STATS numbers, so needs OUTPUT_STATS
+#endif
+
+enum class SOAK : byte { OFF, FILE, FOLDER };
+extern SOAK soakMode;         // the menu's, not saved
+
+void soak_start();            // playFile
+void soak_pass();             // fileEnded, with the timer stopped: a pass's line
+void soak_end();              // stopFile: the summary, if there were passes
+#endif
+
+#endif // SOAK_H_INCLUDED
@@ -0,0 +1,265 @@
+#include "configs.h"
+#include "station2.h"
+
+#ifdef STATION2
+
+#include "driver/rmt.h"
+#include "hwconfig.h"
+#include "buffer.h"
+#include "file_utils.h"
+
+#define ST2_CHANNEL       RMT_CHANNEL_1
+#define ST2_MAX_TICKS     32767           // 15 bit duration, in us at clk_div 80
+#define ST2_ENDLESS       0x7FFFFFFF
+#define ST2_WAITING       250             // us to hold while the ring is short of a whole word
+#define ST2_IDLE          1000            // and once the file has played out
+#define ST2_READ          512             // most read from the card per loop
+
+static_assert((STATION2_RING & (STATION2_RING - 1)) == 0 && STATION2_RING <= 32768, "STATION2_RING has to be a power of 2, up to 32768");
+
+namespace {
+SdBaseFile st2File;
+char st2Name[64] = "";
+bool installed = false;
+volatile bool st2Eof = false;             // loop: nothing more in the file
+const byte rmtSource = 0;
+
+byte ring[STATION2_RING];
+volatile word ringHead = 0;               // loop: bytes written, free running
+volatile word ringTail = 0;               // isr: bytes played
+volatile bool st2Playing = false;         // isr: clears it once st2Eof and the ring is empty
+
+// the translator's copy of wave2's state
+byte level = LOW;
+unsigned long left = 0;                   // us still to play at level
+word repeatLeft = 0;
+word repeatPeriod = 0;
+word repeatOther = 0;
+byte repeatPairs = 0;
+word pairPeriod = 0;                      // the second edge of a pulse pair, 0 if none
+word directSample = 0;
+word directBits = 0;                      // the direct recording word being played, 0 if none
+
+ISR_CODE word ring_word(word at) {
+  const word i = (ringTail + at) & (STATION2_RING - 1);
+  return word(ring[i], ring[(i + 1) & (STATION2_RING - 1)]);
+}
+
+ISR_CODE byte extra_words(word w) {
+  if ((w & LONG_PERIOD_MASK) == LONG_PERIOD_FLAG) return 2;
+  return ((w & PULSE_FLAG_MASK) == PULSE_REPEAT_FLAG || (w & PULSE_FLAG_MASK) == 0x6000) ? 1 : 0;
+}
+
+ISR_CODE void direct_bit() {
+  // 010xxiiibbbbbbbb: bit 7 now, and iii more after it
+  level = bitRead(directBits, 7) ? HIGH : LOW;
+  left = directSample;
+  if (directBits & 0x0700)
+    directBits = (((directBits >> 8) - 1) << 8) | ((directBits & 0x7f) << 1);
+  else
+    directBits = 0;
+}
+
+ISR_CODE void next_edge() {
+  // wave2, for the words of a .mxw (no C64 half pairs)
+  if (repeatLeft) {
+    repeatLeft--;
+    left = repeatPeriod;
+    if (repeatOther) {
+      if (repeatPairs == 1) {
+        repeatPairs = 2;
+      } else {
+        if (repeatPairs) repeatPairs = 1;
+        const word other = repeatOther;
+        repeatOther = repeatPeriod;
+        repeatPeriod = other;
+      }
+    }
+    level = !level;
+    return;
+  }
+  if (directBits) {
+    direct_bit();
+    return;
+  }
+  if (pairPeriod) {
+    left = pairPeriod;
+    pairPeriod = 0;
+    level = !level;
+    return;
+  }
+
+  const word fill = ringHead - ringTail;
+  if (!st2Playing || fill < 2) {
+    if (st2Playing && st2Eof) st2Playing = false;
+    left = st2Playing ? ST2_WAITING : ST2_IDLE;
+    return;
+  }
+  word w = ring_word(0);
+  const byte extra = extra_words(w);
+  if (fill < 2 + 2*extra) {
+    left = ST2_WAITING;
+    return;
+  }
+  ringTail += 2;
+
+  if ((w & LONG_PERIOD_MASK) == LONG_PERIOD_FLAG) {
+    if (w & LONG_PERIOD_SET)
+      level = (w & LONG_PERIOD_HIGH) ? HIGH : LOW;
+    else
+      level = !level;
+    left = ((unsigned long)ring_word(0) << 16) | ring_word(2);
+    ringTail += 4;
+  } else if ((w & PULSE_FLAG_MASK) == PULSE_PAIR_FLAG) {
+    pairPeriod = w & PULSE_PAIR_MAX;
+    left = pairPeriod;
+    level = !level;
+  } else if ((w & PULSE_FLAG_MASK) == PULSE_REPEAT_FLAG) {
+    repeatLeft = (w & PULSE_TONE_MAX) - 1;
+    const bool alt = w & PULSE_REPEAT_ALT;
+    const bool pairs = w & PULSE_REPEAT_PAIRS;
+    const word p = ring_word(0);
+    ringTail += 2;
+    if (alt && pairs) {
+      left = (p >> 8) << PULSE_REPEAT_ALT_SHIFT;
+      repeatPeriod = left;
+      repeatOther = (p & 0xFF) << PULSE_REPEAT_ALT_SHIFT;
+      repeatPairs = 2;
+    } else if (alt) {
+      left = (p >> 8) << PULSE_REPEAT_ALT_SHIFT;
+      repeatPeriod = (p & 0xFF) << PULSE_REPEAT_ALT_SHIFT;
+      repeatOther = left;
+      repeatPairs = 0;
+    } else {
+      repeatPeriod = p;
+      repeatOther = 0;
+      left = p;
+    }
+    level = !level;
+  } else if ((w & SEGMENT_MASK) == SEGMENT_FLAG) {
+    if (w & SEGMENT_TOGGLE)
+      level = !level;
+    else
+      level = (w & SEGMENT_HIGH) ? HIGH : LOW;
+    left = w & SEGMENT_MAX;
+  } else if (bitRead(w, 14)) {
+    if (bitRead(w, 13)) {
+      directSample = w & 0x1fff;
+      w = ring_word(0);
+      ringTail += 2;
+    }
+    directBits = w;
+    direct_bit();
+  } else if (w == 0) {
+    left = ST2_IDLE;
+  } else {
+    left = w;
+    level = !level;
+  }
+  if (left == 0) left = 1;                // a 0 duration would end the transmission
+}
+
+ISR_CODE rmt_item32_t next_item() {
+  word d[2];
+  byte l[2];
+  for (byte h = 0; h < 2; h++) {
+    if (left == 0) next_edge();
+    d[h] = (left > ST2_MAX_TICKS) ? ST2_MAX_TICKS : left;
+    l[h] = level;
+    left -= d[h];
+  }
+  rmt_item32_t item;
+  item.duration0 = d[0];
+  item.level0 = l[0];
+  item.duration1 = d[1];
+  item.level1 = l[1];
+  return item;
+}
+
+ISR_CODE void st2_fill(const void *src, rmt_item32_t *dest, size_t src_size,
+                      size_t wanted_num, size_t *translated_size, size_t *item_num)
+{
+  for (size_t i = 0; i < wanted_num; i++)
+    dest[i] = next_item();
+  *translated_size = wanted_num;
+  *item_num = wanted_num;
+}
+
+bool open_words(const char *name) {
+  // past the header, to the first word
+  byte head[4];
+  if (!st2File.open(currentDir, name, O_RDONLY)) return false;
+  if (st2File.read(head, 4) == 4 && head[0] == 'M' && head[1] == 'X' && head[3] == 0x04) {
+    if (head[2] == 'W' && st2File.seekSet(8)) return true;
+    if (head[2] == 'P' && st2File.seekSet(512)) return true;
+  }
+  st2File.close();
+  return false;
+}
+} // anonymous namespace
+
+bool station2_play(const char *name) {
+  station2_stop();
+  if (!open_words(name)) return false;
+  strncpy(st2Name, name, sizeof(st2Name)-1);
+  st2Name[sizeof(st2Name)-1] = '\0';
+
+  level = LOW;
+  left = ST2_IDLE;
+  repeatLeft = 0;
+  pairPeriod = 0;
+  directBits = 0;
+  ringHead = ringTail = 0;
+  st2Eof = false;
+  station2_loop();                        // something in the ring before it starts
+  st2Playing = true;
+
+  rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t)STATION2_PIN, ST2_CHANNEL);
+  config.clk_div = 80;                    // 1 tick per us, as the main output
+  config.tx_config.idle_output_en = true;
+  config.tx_config.idle_level = RMT_IDLE_LEVEL_LOW;
+  rmt_config(&config);
+  rmt_driver_install(ST2_CHANNEL, 0, 0);
+  rmt_translator_init(ST2_CHANNEL, st2_fill);
+  installed = true;
+  rmt_write_sample(ST2_CHANNEL, &rmtSource, ST2_ENDLESS, false);
+  return true;
+}
+
+void station2_stop() {
+  // as the main output's stop, the driver is uninstalled rather than waited on
+  if (installed) {
+    rmt_tx_stop(ST2_CHANNEL);
+    rmt_driver_uninstall(ST2_CHANNEL);
+    installed = false;
+  }
+  st2Playing = false;
+  st2File.close();
+  st2Name[0] = '\0';
+}
+
+void station2_loop() {
+  if (!st2File.isOpen()) return;
+  if (installed && !st2Playing) {
+    station2_stop();                      // played out
+    return;
+  }
+  if (st2Eof) return;
+  const word at = ringHead & (STATION2_RING - 1);
+  word n = STATION2_RING - (word)(ringHead - ringTail);
+  if (n > STATION2_RING - at) n = STATION2_RING - at;   // up to the end of the ring, the rest next time
+  if (n > ST2_READ) n = ST2_READ;
+  n &= ~1;
+  if (n == 0) return;
+  const int got = st2File.read(ring + at, n);
+  if (got < 2)
+    st2Eof = true;
+  else
+    ringHead += got & ~1;                 // words are never split
+}
+
+const char *station2_name() {
+  return st2Name;
+}
+
+#endif // STATION2
@@ -0,0 +1,44 @@
+#ifndef STATION2_H_INCLUDED
+#define STATION2_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef STATION2
+#include "Arduino.h"
+
+// A second loading station on the ESP32-C3: an independent player on
+// STATION2_PIN, through RMT channel 1 (the main output has channel 0 with
+// RMT_OUTPUT), with its own file, its own ring of buffer words and its own
+// copy of wave2's edge state.  So one machine can load from it while
+// another loads from the main player, each at its own pace.
+//
+// It plays .mxw/.mxp files, whose buffer words are already rendered (see
+// mxw.h), so it needs none of the main player's decoding state.  loop()
+// tops its ring up from the card between the main player's reads, and the
+// RMT's translator turns the words into edges as the main output's does.
+// It's started and stopped over WIFI_SERVICE:
+//
+//   GET /station2?file=NAME   play NAME (a .mxw or .mxp in the current directory)
+//   GET /station2?stop=1
+
+#if !defined(CONFIG_IDF_TARGET_ESP32C3) || !defined(RMT_OUTPUT)
+  #error STATION2 is for the ESP32-C3, with RMT_OUTPUT
+#endif
+#if !defined(Use_MXW) || !defined(WIFI_SERVICE)
+  #error STATION2 needs Use_MXW (the files it plays) and WIFI_SERVICE (to start them)
+#endif
+
+#ifndef STATION2_PIN
+  #define STATION2_PIN D6
+#endif
+#ifndef STATION2_RING
+  #define STATION2_RING 4096        // bytes of words read ahead, a power of 2
+#endif
+
+bool station2_play(const char *name);   // false if it isn't a .mxw/.mxp that opens
+void station2_stop();
+void station2_loop();                   // each loop: refill the ring, and tidy up at the end
+const char *station2_name();            // what's playing, "" if nothing
+#endif
+
+#endif // STATION2_H_INCLUDED
@@ -0,0 +1,196 @@
+#include "configs.h"
+#include "tzxmeta.h"
+
+#ifdef TZX_META
+
+#include "file_utils.h"
+#include "MaxDuino.h"
+#include "processing_state.h"
+
+namespace {
+// file layout: TZX_META_SLOTS records of
+//   4 bytes  FNV-1a hash of the file name (little endian, as is the size)
+//   4 bytes  file size
+//   1 byte   machine (ID33 computer ID it runs on), 0xFF if none given
+//   TZX_META_TITLE bytes of title, then TZX_META_AUTHOR of author,
+//   each padded with zeros (and not terminated when full)
+constexpr byte REC_MACHINE = 8;
+constexpr byte REC_TITLE = 9;
+constexpr byte REC_AUTHOR = REC_TITLE + TZX_META_TITLE;
+constexpr byte REC_SIZE = REC_AUTHOR + TZX_META_AUTHOR;
+const char DB_PATH[] PROGMEM = "/MAXMETA.DAT";
+
+constexpr byte NO_MACHINE = 0xFF;
+
+// short names for the ID33 computer IDs, in ID order
+const char MACHINES[][7] PROGMEM = {
+  "16K", "48K", "48K", "128K", "+2", "+3", "TC2048", "TS2068",
+  "Pent", "SAM", "DidM", "Gama", "ZX80", "ZX81", "128K", "48K",
+  "TK90X", "TK95", "Byte", "Elwro", "Scorp", "CPC", "CPC", "CPC",
+  "CPC+", "CPC+", "Ace", "Ent", "C64", "C128",
+};
+
+byte rec[REC_SIZE];
+unsigned long hash;
+
+unsigned long name_hash(const char *s) {
+  unsigned long h = 2166136261UL;
+  while (*s) {
+    h ^= (byte)*s++;
+    h *= 16777619UL;
+  }
+  return h;
+}
+
+void put_le32(byte *p, unsigned long v) {
+  p[0] = v;
+  p[1] = v >> 8;
+  p[2] = v >> 16;
+  p[3] = v >> 24;
+}
+
+unsigned long get_le32(const byte *p) {
+  return ((unsigned long)word(p[3], p[2]) << 16) | word(p[1], p[0]);
+}
+
+unsigned long slot_pos() {
+  hash = name_hash(fileName);
+  return ((hash ^ filesize) % TZX_META_SLOTS) * REC_SIZE;
+}
+
+bool open_db(SdBaseFile &db, oflag_t flags) {
+  char path[sizeof(DB_PATH)];
+  strcpy_P(path, DB_PATH);
+  return db.open(path, flags);
+}
+
+bool read_slot(SdBaseFile &db, unsigned long pos) {
+  // rec is this file's
+  return db.seekSet(pos) && db.read(rec, REC_SIZE) == REC_SIZE &&
+         get_le32(rec) == hash && get_le32(rec+4) == filesize;
+}
+
+void copy_text(byte *dst, byte max, unsigned long p, byte n) {
+  // n bytes from the file at p, as printable text, cut at max
+  if (n > max) n = max;
+  n = readfile_bytes(dst, n, p);
+  for (byte i = 0; i < n; i++) {
+    if (dst[i] < ' ' || dst[i] > '~') dst[i] = ' ';
+  }
+  while (n > 0 && dst[n-1] == ' ') dst[--n] = 0;
+}
+
+void archive_info(unsigned long p, bool &titled) {
+  // ID32: length word, count, then (type, length, text) for each string
+  if (readfile(1, p+2) != 1) return;
+  byte n = filebuffer[0];
+  p += 3;
+  while (n--) {
+    if (readfile(2, p) != 2) return;
+    const byte type = filebuffer[0];
+    const byte len = filebuffer[1];
+    if (type == 0x00) {
+      memset(rec+REC_TITLE, 0, TZX_META_TITLE);
+      copy_text(rec+REC_TITLE, TZX_META_TITLE, p+2, len);
+      titled = true;
+    } else if (type == 0x02) {
+      copy_text(rec+REC_AUTHOR, TZX_META_AUTHOR, p+2, len);
+    }
+    p += 2 + len;
+  }
+}
+
+void hardware_type(unsigned long p) {
+  // ID33: count, then (type, ID, info) for each: the first computer it runs on
+  if (readfile(1, p) != 1) return;
+  byte n = filebuffer[0];
+  p += 1;
+  while (n--) {
+    if (readfile(3, p) != 3) return;
+    if (filebuffer[0] == 0x00 && filebuffer[2] != 0x03) {  // info 3: doesn't run on it
+      rec[REC_MACHINE] = filebuffer[1];
+      return;
+    }
+    p += 3;
+  }
+}
+} // anonymous namespace
+
+void tzxmeta_scan() {
+  if (stream_active() || currentTask != TASK::INIT) return;  // TAP, UEF, CAS etc. have no TZX blocks
+
+  SdBaseFile db;
+  const unsigned long pos = slot_pos();
+  if (!open_db(db, O_RDWR | O_CREAT)) return;
+  if (read_slot(db, pos)) {
+    db.close();
+    return;
+  }
+
+  memset(rec, 0, REC_SIZE);
+  put_le32(rec, hash);
+  put_le32(rec+4, filesize);
+  rec[REC_MACHINE] = NO_MACHINE;
+
+  // walk the block headers, same rules as the block search in GetAndPlayBlock
+  const unsigned long savedBytesRead = bytesRead;
+  const byte savedID = currentID;
+  currentID = BLOCKID::IDEOF;
+  bytesRead = 10;   //skip TZXHeader
+  unsigned long blockStart;
+  bool counted;
+  bool titled = false;
+  while (SkipBlockHeader(blockStart, counted)) {
+    switch (currentID) {
+      case BLOCKID::ID30:
+        // a text description, only if there's no better title
+        if (!titled && rec[REC_TITLE] == 0 && readfile(1, blockStart+1) == 1) {
+          copy_text(rec+REC_TITLE, TZX_META_TITLE, blockStart+2, filebuffer[0]);
+        }
+        break;
+      case BLOCKID::ID32:
+        archive_info(blockStart+1, titled);
+        break;
+      case BLOCKID::ID33:
+        if (rec[REC_MACHINE] == NO_MACHINE) hardware_type(blockStart+1);
+        break;
+    }
+  }
+  bytesRead = savedBytesRead;
+  currentID = savedID;
+
+  // a new file is grown to the slot with zeros (empty slots) on the way
+  if (db.fileSize() < pos) {
+    const byte zero[REC_SIZE] = {0};
+    db.seekEnd();
+    while (db.fileSize() < pos && db.write(zero, REC_SIZE) == REC_SIZE) {}
+  }
+  if (db.seekSet(pos)) db.write(rec, REC_SIZE);
+  db.close();
+}
+
+bool tzxmeta_get(char *text, byte len) {
+  SdBaseFile db;
+  const unsigned long pos = slot_pos();
+  if (!open_db(db, O_RDONLY)) return false;
+  const bool found = read_slot(db, pos);
+  db.close();
+  if (!found) return false;
+
+  const char *what = (const char *)rec + (rec[REC_TITLE] ? REC_TITLE : REC_AUTHOR);
+  const byte whatLen = rec[REC_TITLE] ? TZX_META_TITLE : TZX_META_AUTHOR;
+  byte n = 0;
+  if (rec[REC_MACHINE] < sizeof(MACHINES)/sizeof(MACHINES[0])) {
+    strncpy_P(text, MACHINES[rec[REC_MACHINE]], len);
+    text[len] = 0;
+    n = strlen(text);
+    if (n < len && *what) text[n++] = ' ';
+  }
+  for (byte i = 0; i < whatLen && what[i] && n < len; i++) {
+    text[n++] = what[i];
+  }
+  text[n] = 0;
+  return n > 0;
+}
+
+#endif // TZX_META
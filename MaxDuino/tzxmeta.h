@@ -0,0 +1,38 @@
+#ifndef TZXMETA_H_INCLUDED
+#define TZXMETA_H_INCLUDED
+
+#include "Arduino.h"
+#include "configs.h"
+
+// Title, author and machine for the file browser, from a TZX/TSX/CDT's
+// ID32 archive info, ID33 hardware type (and ID30 text, if there's no title).
+// The first time a file plays, its block headers are walked once and what
+// they say is saved against it (a hash of its name, and its size) in
+// /MAXMETA.DAT on the SD card.  From then on the browser shows the machine
+// and title in place of the file size, with one small read per file rather
+// than opening it.
+
+#ifdef TZX_META
+
+#if !defined(BLOCKID_NOMEM_SEARCH) && !defined(BLOCK_SD_INDEX)
+  #error TZX_META needs BLOCKID_NOMEM_SEARCH or BLOCK_SD_INDEX
+#endif
+
+#ifndef TZX_META_SLOTS
+  #define TZX_META_SLOTS 256        // files remembered (one slot each, a clash replaces the older one)
+#endif
+#define TZX_META_TITLE 24           // longest title kept
+#define TZX_META_AUTHOR 16          // longest author kept
+
+// From UniPlay, after checkForEXT: for a TZX that isn't in the cache yet,
+// walk its headers and save what they say.  Leaves the file position untouched.
+void tzxmeta_scan();
+
+// For the browser: fill text (len+1 chars) with the machine and title
+// saved for fileName and filesize (the author if there's no title).
+// False if nothing was saved, or nothing worth showing.
+bool tzxmeta_get(char *text, byte len);
+
+#endif // TZX_META
+
+#endif // TZXMETA_H_INCLUDED
@@ -0,0 +1,264 @@
+#include "configs.h"
+#include "tzxprogram.h"
+
+#ifdef TZX_PROGRAM
+
+#include "file_utils.h"
+#include "MaxDuino.h"
+#include "processing_state.h"
+
+unsigned long tzxprog_looped = 0;
+
+namespace {
+unsigned long prog_offset[TZX_PROGRAM_MAX];
+byte prog_id[TZX_PROGRAM_MAX];
+bool prog_counted[TZX_PROGRAM_MAX];
+byte prog_len = 0;
+byte prog_cursor = 0;
+bool prog_complete = false;       // table covers the whole file
+unsigned long prog_total = 0;     // bytes played start to end, with loops
+#ifdef TAPE_TIME_LEFT
+word prog_tenths[TZX_PROGRAM_MAX];  // how long each block plays for, in 1/10 s
+byte prog_playing = 0;            // the block tzxprog_next last started
+word prog_played = 0;             // 1/10 s of it played so far
+
+unsigned long tstates_ms(unsigned long count, unsigned long tstates) {
+  // count lots of tstates (at 3.5MHz) in ms, without overflowing for any
+  // block length the TZX format allows in practice
+  return (count / 3500) * tstates + (count % 3500) * tstates / 3500;
+}
+
+word le16(const byte *p) {
+  return word(p[1], p[0]);
+}
+
+unsigned long le24(const byte *p) {
+  return ((unsigned long)p[2] << 16) | le16(p);
+}
+
+unsigned long data_bits(unsigned long len, byte usedBits) {
+  return len ? (len-1)*8 + usedBits : 0;
+}
+
+word block_tenths(unsigned long blockStart, byte id) {
+  const unsigned long p = blockStart+1;   // just past the ID byte
+  const byte *b = filebuffer;
+  unsigned long ms = 0;
+  switch (id) {
+    case BLOCKID::ID10:
+      if (readfile(5, p) == 5) {
+        // pause, length, then the flag byte picks the pilot length
+        ms = tstates_ms((b[4] & 0x80) ? 3223 : 8063, 2168) + tstates_ms(1, 667+735)
+           + tstates_ms(8UL*le16(b+2), 855+1710) + le16(b);
+      }
+      break;
+    case BLOCKID::ID11:
+      if (readfile(18, p) == 18) {
+        ms = tstates_ms(le16(b+10), le16(b)) + tstates_ms(1, (unsigned long)le16(b+2) + le16(b+4))
+           + tstates_ms(data_bits(le24(b+15), b[12]), (unsigned long)le16(b+6) + le16(b+8)) + le16(b+13);
+      }
+      break;
+    case BLOCKID::ID12:
+      if (readfile(4, p) == 4) {
+        ms = tstates_ms(le16(b+2), le16(b));
+      }
+      break;
+    case BLOCKID::ID13:
+      if (readfile(1, p) == 1) {
+        const byte n = b[0];
+        unsigned long t = 0;
+        for (byte i = 0; i < n; i++) {
+          if (readfile(2, p+1+2*i) == 2) t += le16(b);
+        }
+        ms = t / 3500;
+      }
+      break;
+    case BLOCKID::ID14:
+      if (readfile(10, p) == 10) {
+        ms = tstates_ms(data_bits(le24(b+7), b[4]), (unsigned long)le16(b) + le16(b+2)) + le16(b+5);
+      }
+      break;
+    case BLOCKID::ID15:
+      if (readfile(8, p) == 8) {
+        ms = tstates_ms(data_bits(le24(b+5), b[4]), le16(b)) + le16(b+2);
+      }
+      break;
+    case BLOCKID::ID20:
+      if (readfile(2, p) == 2) {
+        ms = le16(b);
+      }
+      break;
+    case BLOCKID::ID4B:
+      if (readfile(16, p) == 16) {
+        byte zeros = b[14] >> 4;
+        byte ones = b[14] & 0x0f;
+        if (!zeros) zeros = 16;
+        if (!ones) ones = 16;
+        const byte bitsPerByte = 8 + ((b[15] >> 6) & 3) + ((b[15] >> 3) & 3);
+        const unsigned long len = (unsigned long)le16(b+2) << 16 | le16(b);
+        ms = tstates_ms(le16(b+8), le16(b+6))
+           + tstates_ms((len > 12 ? len-12 : 0) * bitsPerByte, ((unsigned long)zeros*le16(b+10) + (unsigned long)ones*le16(b+12)) / 2)
+           + le16(b+4);
+      }
+      break;
+    // ID18, ID19 etc: only known by playing them, so not counted
+  }
+  ms /= 100;
+  return (ms > 0xFFFF) ? 0xFFFF : word(ms);
+}
+#endif // TAPE_TIME_LEFT
+
+bool find(unsigned long offset, byte &i) {
+  // usually the next block is the next entry, otherwise a binary search
+  // (offsets are in file order)
+  if (prog_cursor < prog_len && prog_offset[prog_cursor] == offset) {
+    i = prog_cursor;
+    return true;
+  }
+  byte lo = 0;
+  byte hi = prog_len;
+  while (lo < hi) {
+    const byte mid = lo + (hi-lo)/2;
+    if (prog_offset[mid] < offset) lo = mid+1;
+    else hi = mid;
+  }
+  if (lo < prog_len && prog_offset[lo] == offset) {
+    i = lo;
+    return true;
+  }
+  return false;
+}
+} // anonymous namespace
+
+void tzxprog_build() {
+  prog_len = 0;
+  prog_cursor = 0;
+  prog_complete = false;
+  prog_total = 0;
+  tzxprog_looped = 0;
+#ifdef TAPE_TIME_LEFT
+  prog_playing = 0;
+  prog_played = 0;
+#endif
+  if (currentTask != TASK::INIT) return; // TAP, UEF, CAS etc. have no TZX blocks
+
+  // walk the block headers, same rules as the block search in GetAndPlayBlock
+  const unsigned long savedBytesRead = bytesRead;
+  const byte savedID = currentID;
+  currentID = BLOCKID::IDEOF;
+  bytesRead = 10;   //skip TZXHeader
+
+  unsigned long loopExtra = 0;
+  unsigned long loopBody = 0;
+  word loopTimes = 0;
+  unsigned long blockStart;
+  bool counted;
+  while (SkipBlockHeader(blockStart, counted)) {
+    if (prog_len == TZX_PROGRAM_MAX) break;
+    prog_offset[prog_len] = blockStart;
+    prog_id[prog_len] = currentID;
+    prog_counted[prog_len] = counted;
+#ifdef TAPE_TIME_LEFT
+    prog_tenths[prog_len] = block_tenths(blockStart, currentID);
+#endif
+    prog_len++;
+
+    if (currentID == BLOCKID::ID24) {
+      // loop body starts after the repetition count, where ID24 sets loopStart
+      const unsigned long after = bytesRead;
+      bytesRead = blockStart+1;
+      loopTimes = ReadWord() ? outWord : 0;
+      bytesRead = after;
+      loopBody = after;
+    } else if (currentID == BLOCKID::ID25 && loopTimes > 1) {
+      // ID25 jumps back from just after its ID byte
+      loopExtra += (loopTimes-1) * (blockStart+1 - loopBody);
+      loopTimes = 0;
+    }
+  }
+  prog_complete = (bytesRead >= filesize);
+  prog_total = filesize + loopExtra;
+
+  bytesRead = savedBytesRead;
+  currentID = savedID;
+}
+
+bool tzxprog_next(byte &id) {
+  byte i;
+  if (!find(bytesRead, i)) return false;
+  id = prog_id[i];
+  bytesRead += 1;
+  prog_cursor = i+1;
+#ifdef TAPE_TIME_LEFT
+  prog_playing = i;
+  prog_played = 0;
+#endif
+  return true;
+}
+
+bool tzxprog_lookup(word &blk, unsigned long &offset, byte &id) {
+  byte last = prog_len;
+  word n = 0;
+  for (byte i = 0; i < prog_len; i++) {
+    if (!prog_counted[i]) continue;
+    last = i;
+    if (n++ == blk) break;
+  }
+  if (last == prog_len) return false;                   // no counted blocks known
+  if (n <= blk) {
+    if (!prog_complete) return false;                   // block is past the end of the table
+    blk = n-1;                                          // clamp to the last block
+  }
+  offset = prog_offset[last];
+  id = prog_id[last];
+  prog_cursor = last;
+  tzxprog_looped = 0;  // jumped, so loops played so far no longer count
+  return true;
+}
+
+bool tzxprog_jump(unsigned long from, int disp, unsigned long &offset, word &blk) {
+  byte i;
+  if (!find(from, i)) return false;
+  const int target = i + disp;
+  if (target < 0 || target >= prog_len) return false;
+  blk = 0;
+  for (byte j = 0; j < target; j++) {
+    if (prog_counted[j]) blk++;
+  }
+  offset = prog_offset[target];
+  prog_cursor = target;
+  if (offset < from) tzxprog_looped += from - offset;  // played again, as for ID25
+  return true;
+}
+
+byte tzxprog_percent() {
+  if (prog_complete && prog_total) {
+    return (100 * (tzxprog_looped + bytesRead)) / prog_total;
+  }
+  return (100 * bytesRead) / filesize;
+}
+
+#ifdef TAPE_TIME_LEFT
+void tzxprog_tick() {
+  if (prog_played < 0xFFFF-10) prog_played += 10;
+}
+
+bool tzxprog_timed() {
+  return prog_complete && prog_playing < prog_len;
+}
+
+bool tzxprog_time_left(word &block, word &tape) {
+  if (!tzxprog_timed()) return false;
+  const word b = (prog_played < prog_tenths[prog_playing]) ? prog_tenths[prog_playing] - prog_played : 0;
+  unsigned long t = b;
+  for (byte i = prog_playing+1; i < prog_len; i++) {
+    t += prog_tenths[i];
+  }
+  block = (b + 9) / 10;
+  t = (t + 9) / 10;
+  tape = (t > 0xFFFF) ? 0xFFFF : word(t);
+  return true;
+}
+#endif
+
+#endif // TZX_PROGRAM
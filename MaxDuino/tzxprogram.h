@@ -0,0 +1,80 @@
+#ifndef TZXPROGRAM_H_INCLUDED
+#define TZXPROGRAM_H_INCLUDED
+
+#include "Arduino.h"
+#include "configs.h"
+
+// Pre-parsed block table for TZX/TSX/CDT files.
+// UniPlay walks the block headers once before the audio starts and keeps the
+// start offset and ID of every block.  During playback the block IDs come from
+// the table instead of the file, block jumps are a table lookup instead of an
+// SD search, and ID24/ID25 loops are counted in, so the percentage is exact.
+// If a file has more blocks than fit, the table covers the start of the file
+// and everything past it falls back to the usual reading / searching.
+
+// the times left come from the table
+#if defined(TAPE_TIME_LEFT) && !defined(TZX_PROGRAM)
+  #error TAPE_TIME_LEFT needs TZX_PROGRAM
+#endif
+
+#ifdef TZX_PROGRAM
+
+#ifndef BLOCKID_NOMEM_SEARCH
+  #error TZX_PROGRAM needs BLOCKID_NOMEM_SEARCH
+#endif
+
+#if defined(TAPE_TIME_LEFT) && !defined(SHOW_CNTR)
+  #error TAPE_TIME_LEFT needs SHOW_CNTR
+#endif
+
+#ifndef TZX_PROGRAM_MAX
+  #if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega32U4__)
+    #define TZX_PROGRAM_MAX 32
+  #elif defined(__AVR__)
+    #define TZX_PROGRAM_MAX 64
+  #else
+    #define TZX_PROGRAM_MAX 255
+  #endif
+#endif
+
+extern unsigned long tzxprog_looped; // bytes already played again by ID25 loop jumps
+
+// Build the table for the open entry (call after checkForEXT; does nothing
+// unless it found a TZX with blocks).  Leaves the file position untouched.
+void tzxprog_build();
+
+// If bytesRead is at the start of a known block, set id, move bytesRead past
+// the ID byte and return true.  Otherwise return false (read the ID as usual).
+bool tzxprog_next(byte &id);
+
+// Same contract as blockindex_lookup.
+bool tzxprog_lookup(word &blk, unsigned long &offset, byte &id);
+
+// Same contract as blockindex_jump.
+bool tzxprog_jump(unsigned long from, int disp, unsigned long &offset, word &blk);
+
+// Playback position in percent, counting loops.  Falls back to
+// bytesRead/filesize when there's no complete table.
+byte tzxprog_percent();
+
+#ifdef TAPE_TIME_LEFT
+// With TAPE_TIME_LEFT the table also has how long each block plays for,
+// worked out from its timing parameters (pilot, syncs and pauses exactly,
+// data as if half the bits were 1s).  The counter then counts down the
+// time left on the tape, and the block's time left shows in place of the
+// percentage.
+
+// One more second played (lcdTime calls this instead of counting up).
+void tzxprog_tick();
+
+// Seconds left in the current block and on the whole tape (the current
+// block included).  False when there's no complete table.
+bool tzxprog_time_left(word &block, word &tape);
+
+// tzxprog_time_left will work (cheap enough to check on every lcdPercent)
+bool tzxprog_timed();
+#endif
+
+#endif // TZX_PROGRAM
+
+#endif // TZXPROGRAM_H_INCLUDED
@@ -5,6 +5,10 @@
 #include "MaxProcessing.h"
 #include "processing_state.h"
 #include "file_utils.h"
+#include "pwmbyte.h"
+#ifdef Use_UEF_GZ
+  #include "inflate.h"
+#endif
 
 
 #ifdef Use_UEF
@@ -12,12 +16,101 @@ PROGMEM const char UEFFile[9] = {'U','E','F',' ','F','i','l','e','!'};
 
 word chunkID = 0;
 byte UEFPASS = 0;
-byte parity = 0 ;        //0:NoParity 1:ParityOdd 2:ParityEven (default:0)
+byte parity = 0 ;        //0:NoParity 1:ParityOdd 2:ParityEven (default:0), as PWM_PARITY_*
+PWM_FORMAT uefFormat = {
+  { UEFZEROPULSE, UEFZEROPULSE },
+  { UEFONEPULSE, UEFONEPULSE },
+  2, 4, false,
+  1, false,
+  1, true,
+  PWM_PARITY_NONE
+};
 
 #ifdef Use_c116
 float outFloat;
 #endif
 
+#ifdef UEF_INDEX
+char uefName[11];
+
+namespace {
+unsigned long uefIndex[UEF_INDEX_MAX];  // where each BBC file starts: the chunks after the previous data chunk
+byte uefIndexCount = 0;
+uint32_t uefIndexKey = 0;               // first sector of the indexed file
+
+bool uef_read_chunk_header(unsigned long pos, word &id, unsigned long &len) {
+  if (readfile(6, pos) != 6) return false;
+  id = word(filebuffer[1], filebuffer[0]);
+  len = ((unsigned long)word(filebuffer[5], filebuffer[4]) << 16) | word(filebuffer[3], filebuffer[2]);
+  return true;
+}
+
+bool uef_read_block_header(unsigned long data, unsigned long len, word &blockNum) {
+  // BBC / Electron block header at the start of a 0x100 chunk: 0x2A, the file
+  // name (1 to 10 chars, 0 terminated), load and exec address, block number, ...
+  if (len < 22 || readfile(12, data) != 12 || filebuffer[0] != 0x2A) return false;
+  byte n = 0;
+  while (n < 10 && filebuffer[1+n] != 0) {
+    uefName[n] = filebuffer[1+n];
+    n++;
+  }
+  if (n == 0 || filebuffer[1+n] != 0) return false;
+  uefName[n] = 0;
+  if (readfile(2, data + n + 10) != 2) return false;
+  blockNum = word(filebuffer[1], filebuffer[0]);
+  return true;
+}
+
+void uef_build_index() {
+  // one pass over the chunk headers, reading only the first bytes of each data chunk
+  uefIndexCount = 0;
+  uefIndexKey = entry.firstSector();
+  #ifdef Use_UEF_GZ
+    if (gz_active) return;
+  #endif
+  unsigned long pos = 12;
+  unsigned long runStart = pos;
+  word id;
+  unsigned long len;
+  while (uefIndexCount < UEF_INDEX_MAX && uef_read_chunk_header(pos, id, len)) {
+    const unsigned long data = pos + 6;
+    if (id == ID0100 || id == ID0104) {
+      word blockNum;
+      if (id == ID0100 && uef_read_block_header(data, len, blockNum) && blockNum == 0) {
+        uefIndex[uefIndexCount++] = runStart;
+      }
+      runStart = data + len;
+    }
+    pos = data + len;
+  }
+}
+} // namespace
+
+bool uef_jump_block(word &blk) {
+  if (uefIndexCount == 0 || uefIndexKey != entry.firstSector()) return false;
+  if (blk >= uefIndexCount) blk = uefIndexCount - 1;
+
+  // the file's name, from the first data chunk of the entry
+  uefName[0] = 0;
+  unsigned long pos = uefIndex[blk];
+  word id;
+  unsigned long len;
+  while (uef_read_chunk_header(pos, id, len)) {
+    if (id == ID0100) {
+      word blockNum;
+      uef_read_block_header(pos + 6, len, blockNum);
+      break;
+    }
+    pos += 6 + len;
+  }
+
+  bytesRead = uefIndex[blk];
+  currentID = BLOCKID::UEF;
+  currentTask = TASK::GETCHUNKID;
+  return true;
+}
+#endif // UEF_INDEX
+
 void UEFCarrierToneBlock() {
   //Pure Tone Block - Long string of pulses with the same length
   if(!pilotPulses--) {
@@ -27,24 +120,24 @@ void UEFCarrierToneBlock() {
   }
 }
 
+void uef_set_format() {
+  // The chunk's byte layout, worked out once: start bit 0, 8 data bits LSb
+  // first, the parity bit if any, stop bit 1.  A zero is uefpassforZero
+  // zeroPulses (2 at 1200 baud, 8 at 300) and a one twice as many onePulses
+  uefFormat.zero[0] = uefFormat.zero[1] = zeroPulse;
+  uefFormat.one[0] = uefFormat.one[1] = onePulse;
+  uefFormat.zeroHalves = uefpassforZero;
+  uefFormat.oneHalves = 2*uefpassforZero;
+  uefFormat.parity = parity;
+}
+
 void writeUEFData() {
-  #ifdef DEBUG
-  //Serial.println(F("WriteUEFData"));
-  #endif
-  //Convert byte from file into string of pulses.  One pulse per pass
+  //Convert byte from file into string of pulses.  The whole byte goes
+  //straight into the buffer (pwm_write), so currentPeriod stays 0
+  currentPeriod = 0;
   if(currentBit==0) {                         //Check for byte end/first byte
-    #ifdef DEBUG
-    //Serial.println(F("currentBit==0"));
-    #endif
-    
     if(ReadByte()) {            //Read in a byte
-      currentByte = outByte;
       bytesToRead += -1;
-      bitChecksum = 0; 
-      #ifdef DEBUG
-      //Serial.print(F("  bytesToRead after decrement: "));
-      //Serial.println(bytesToRead,DEC);
-      #endif
       if(bytesToRead == 0) {                  //Check for end of data block
         lastByte = 1;
         if(pauseLength==0) {                  //Search for next ID if there is no pause
@@ -55,67 +148,27 @@ void writeUEFData() {
       }
     } else {                         // If we reached the EOF
       currentTask = TASK::GETCHUNKID;
+      return;
     }
 
-    currentBit = 11;
-    pass=0;
-  }
-
-  if ((currentBit == 2) && (parity == 0)) currentBit = 1; // parity N
-  if (currentBit == 11) {
-    currentPeriod = zeroPulse;
-  } else if (currentBit == 2) {
-    currentPeriod = (bitChecksum ^ (parity & 0x01)) ? onePulse : zeroPulse; 
-  } else if (currentBit == 1) {
-    currentPeriod = onePulse;    
-  } else {
-    if(currentByte&0x01) {                       //Set next period depending on value of bit 0
-      currentPeriod = onePulse;
-    } else {
-      currentPeriod = zeroPulse;
-    }
+    pwm_begin_byte(uefFormat, outByte);
+    currentBit = 1;
   }
 
-  pass+=1;      //Data is played as 2 x pulses for a zero, and 4 pulses for a one when speed is 1200
-
-  if (currentPeriod == zeroPulse) {
-    if(pass==uefpassforZero) {
-      if ((currentBit>1) && (currentBit<11)) {
-        currentByte >>= 1;                        //Shift along to the next bit
-      }
-      currentBit += -1;
-      pass=0; 
-      if ((lastByte) && (currentBit==0)) {
-        currentTask = TASK::GETCHUNKID;
-      } 
+  if (pwm_write()) {
+    currentBit = 0;
+    if (lastByte) {
+      currentTask = TASK::GETCHUNKID;
     }
-  } else {
-    // must be a one pulse
-    if(pass==2*uefpassforZero) {
-      if ((currentBit>1) && (currentBit<11)) {
-        bitChecksum ^= 1;
-        currentByte >>= 1;                        //Shift along to the next bit
-      }
-
-      currentBit += -1;
-      pass=0; 
-      if ((lastByte) && (currentBit==0)) {
-        currentTask = TASK::GETCHUNKID;
-      } 
-    }    
   }
-
-  #ifdef DEBUG
-  //Serial.print(F("currentBit = "));
-  //Serial.println(currentBit,DEC);
-  //Serial.print(F("currentPeriod = "));
-  //Serial.println(currentPeriod,DEC);
-  #endif
 }
 
 void ReadUEFHeader() {
   //Read and check first 12 bytes for a UEF header
   if(readfile(9, 0)==9 && memcmp_P(filebuffer, UEFFile, 9)==0) {
+    #ifdef UEF_INDEX
+      uef_build_index();
+    #endif
     bytesRead = 12;
     return;
   }
@@ -124,6 +177,9 @@ void ReadUEFHeader() {
 }
 
 void tzx_process_taskid_uef_getchunkid() {
+  #ifdef LIVE_BAUD
+  LiveBaudApply();
+  #endif
   //grab 2 byte ID
   if(ReadWord()) {
     chunkID = outWord;
@@ -163,6 +219,7 @@ void tzx_process_taskid_uef_getchunkid() {
     onePulse = UEFTURBOONEPULSE;
   }  
   lastByte=0;
+  uef_set_format();
   
   //reset data block values
   currentBit=0;
@@ -233,14 +290,14 @@ void tzx_process_taskid_uef_processchunkid() {
           UEFCarrierToneBlock();
           if(pilotPulses==0) {
             currentTask = TASK::PROCESSCHUNKID;
-            currentByte = 0xAA;
+            parity = 0; // NoParity
+            uef_set_format();
+            pwm_begin_byte(uefFormat, 0xAA);
             lastByte = 1;
-            currentBit = 11;
-            pass=0;
+            currentBit = 1;
             UEFPASS = 2;
           }
       } else if (UEFPASS == 2){
-          parity = 0; // NoParity
           writeUEFData();
           if (currentBit==0) {
             currentTask = TASK::PROCESSCHUNKID;
@@ -12,6 +12,22 @@ void ReadUEFHeader();
 void tzx_process_taskid_uef_getchunkid();
 void tzx_process_taskid_uef_processchunkid();
 
+#ifdef UEF_INDEX
+  #ifndef UEF_INDEX_MAX
+    #if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega32U4__)
+      #define UEF_INDEX_MAX 16
+    #else
+      #define UEF_INDEX_MAX 64
+    #endif
+  #endif
+// BBC files (block 0 of each) found in the UEF when it was opened.  Sets
+// up playback from the start of file number blk (clamped to the last one)
+// and its name in uefName.  False if the open file has no index (a
+// gzip'd UEF can't be read out of order, so it never has one).
+bool uef_jump_block(word &blk);
+extern char uefName[];
+#endif
+
 // UEF chunks
 #define ID0000              0x0000 // origin information chunk
 #define ID0100              0x0100 // implicit start/stop bit tape data block
@@ -0,0 +1,201 @@
+////////////////                 CONFIG FOR RASPBERRY PI PICO (RP2040)
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/*                 Add // at the beginning of lines to comment and remove selected option                                */
+
+// define USB_STORAGE_ENABLED if your device has programmable USB interface compatible with TinyUSB
+// (and you wish to enable it, so that your device appears as a mass storage USB disk when plugged into a PC
+//  exposing the filesystem from your SD card)
+// e.g. This works well with the Pico (build with USE_TINYUSB) but cannot be used with many standard AVR devices
+#define USB_STORAGE_ENABLED
+
+// play a tape image sent over the USB serial port, with or without an SD card
+// (the protocol is described in cdcstream.h; can't be used with SERIALSCREEN)
+//#define CDC_STREAM
+
+//**************************************  OPTIONAL USE TO SAVE SPACE  ***************************************************//
+#define Use_MENU                          // removing menu saves space
+#define AYPLAY
+//#define Use_SNAPSHOT                    // 48K .sna and .z80 snapshots, played as a BASIC loader and ROM blocks
+#define MenuBLK2A
+#define ID11CDTspeedup
+#define Use_GDB                           // full TZX ID19 generalized data blocks (not only ZX81)
+#define ZX81SPEEDUP
+//#define DIRECT_SPEED                    // "Direct Speed" menu item: ID15 direct recordings (and .cas) played up to 400% faster
+//#define ZX_SPEED                        // "ZX Speed" menu item: standard speed Spectrum blocks (ID10, .tap) played up to 130% faster
+//#define FAST_GAPS                       // "Fast Gaps" menu item: long pauses between blocks cut short (kept before an ID2A)
+//#define DIRECT_RUNS                     // ID15 and .cas samples as one period per run at one level, not an interrupt per sample
+//#define ISR_VARIANTS                    // a leaner ISR of its own for C64 .tap and .cas files, chosen as each starts
+//#define TAPSPEEDUP                      // .tap files: shorter pilots and zero bits, as far as the ROM loader still takes
+//#define PILOT_TRIM                      // ROM loader blocks (Spectrum, CPC firmware, MSX .cas headers): pilot tones cut to what the ROM needs
+#define Use_MTX
+    //#define MTXSPEEDUP                  // MTX turbo: the Baud Rate menu cuts all the timings (1200 = as recorded)
+#define Use_MZF
+    //#define MZFSPEEDUP                  // MZF turbo: the Baud Rate menu cuts the low halves (1200 = as recorded)
+#define Use_CAQ
+#define Use_CSW
+//#define Use_WAV                         // .wav captures, squared up as they play (best on the 32-bit boards, see wav.h)
+#define Use_MXW                           // pre-rendered .mxw/.mxp files, played with no decoding (see mxw.h)
+#define tapORIC
+    #define ORICSPEEDUP
+#define Use_CAS                           // .cas files playback on MSX / Dragon / CoCo Tandy computers
+    //#define CAS_BAUD_RANGE              // "CAS Baud" menu item: any .cas rate, in fine steps (see casProcessing.h)
+    //#define CAS_TURBO_LOADER            // with CAS_BAUD_RANGE: the first file (a turbo loader) at Baud Rate, the rest at CAS Baud
+    #define Use_DRAGON
+        #define Use_Dragon_sLeader        // short Leader of 0x55 allowed for loading TOSEC files
+            #define Expand_All            // Expand short Leaders in ALL file header blocks. 
+#define Use_UEF                           // .uef files playback on BBC Micro / Electron / Atom computers
+    //#define Use_UEF_GZ                  // gzip'd .uef files, inflated as they play (needs ~34K RAM)
+    //#define Use_ZIP                     // .zip archives browsed as directories, members played from them (needs Use_UEF_GZ)
+    //#define UEF_INDEX                   // index the BBC files in a .uef when it opens, so block jumps go straight to a file
+    #define Use_c112                      // integer gap chunk for .uef
+    #define Use_hqUEF                     // .hq.uef files playback on BBC Micro / Electron / Atom computers
+        #define Use_c104                  // defined tape format data block: data bits per packet/parity/stop bits    
+        //#define Use_c114                // security cycles replaced with carrier tone
+        //#define Use_c116                // floating point gap chunk for .hq.uef
+        #define Use_c117                // data encoding format change for 300 bauds
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//         UEF file instructions: UEF files are compressed and can not be executed directly in MAXDUINO,                 //
+/*         for that you have to decompress these files manually.                                                         */
+/*         linux / mac os: gunzip -c game.uef> game.uef.tmp && mv game.uef.tmp game.uef                                  */
+/*         windows os: add .gz to file name, then click to extract with winrar                                           */
+//***********************************************************************************************************************//
+//                                       Set Acorn UEF default speed                                                     //
+#define TURBOBAUD1500                 // default setting, 25% faster than 1200 baudios standard speed
+//#define TURBOBAUD1550
+//#define TURBOBAUD1600
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//** If Use_MENU commented to remove Menu, then vars need setting preference cause no EEPROM for read/write **//
+//** These are also the initial first-time defaults when you haven't saved preferences to EEPROM yet **//
+#define DEFAULT_BAUDRATE 3850
+#define DEFAULT_MSELECTMASK 0   // Motor control state 1=on 0=off
+#define DEFAULT_TSXzxpUEF 0     // Multiple flag: rpolarity needed for zx games: Basil the Great Mouse Detective, 
+                                //            Mask // SpeedControl for .tsx // UEF Switch Parity
+#define DEFAULT_SKIP2A 0        // Pause on for BLK:2A
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/*                                   Configure your screen settings here                                                  */
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//Set defines for various types of screen
+
+//#define SERIALSCREEN              // For testing and debugging
+//#define SERIAL_QUEUE              // SERIALSCREEN lines queued and sent as the serial port has room, never waiting for it (see serqueue.h)
+//#define HOST_CONTROL              // binary commands over the serial port (select, play, stop, block, baud, status) for driving it from a host (see hostctl.h)
+//#define OUTPUT_STATS              // ISR time, edge lateness and buffer underruns printed over SERIALSCREEN after each file
+//#define EDGE_VERIFY               // output looped back to EDGE_VERIFY_PIN (pin 48 on a Mega): edge timing errors printed over SERIALSCREEN after each file
+//#define RAM_WATCH                 // free RAM, least free RAM seen and stack never used on a System menu item (stack painted at power on)
+//#define RATE_PROBE                // a Rate Probe menu item: the fastest each kind of stream keeps up at, which the speed-ups then hold to (rateprobe.h)
+//#define SERIAL_TRACE              // every page of buffer words sent out in frames at SERIAL_TRACE_BAUD, for rebuilding the output on a host (see sertrace.h)
+//#define FREERAM                   // Changing filenameLength from 255 to 190
+//#define NAME_WINDOW 64            // Keep only 64 chars of each name, longer ones show as 8.3 (needs FAT16_32_Only)
+//#define LARGEBUFFER               // small buffer size used by default to free RAM
+//#define SD_RAW_READ               // read contiguous files straight from the card sectors, bypassing the FAT chain
+//#define READAHEAD_PREFETCH        // while the output ring is full (a long pause), read the next piece of the file ahead, into a second window
+//#define SD_CLOCK_PROBE            // at power on use the fastest SPI clock (and dedicated SPI, if enabled) the card reads back reliably at
+//#define SD_HOTSWAP                // change cards without a reset: the CID is polled while stopped (or set SD_CD_PIN to the card detect switch), then remount and back to the same directory
+//#define INSTANT_PLAY              // fill the first buffer page before starting output, so the first edge comes out sooner
+//#define RAM_PLAY                  // read files of up to RAM_PLAY_SIZE into RAM as they start, and play them from there
+//#define LOOP_CACHE                // replay ID24/ID25 loop bodies of up to LOOP_CACHE_SIZE from RAM, not the card
+//#define AUTO_ADVANCE              // when a file plays to the end, carry straight on with the next file in the directory
+//#define LIVE_BAUD                 // down/up while playing steps Baud Rate faster/slower, from the next block, without stopping
+//#define LOW_POWER_IDLE            // sleep between button checks when stopped, or paused with the buffer full (the timer stops while paused)
+//#define MOTOR_IRQ                 // motor control on an interrupt: the output holds at the next edge the REM line drops, not up to 50ms later
+//#define outputPin 0               // move the output, for FANOUT_PINS to follow on from it
+//#define FANOUT_PINS 1, 2, 3       // more outputs with the same signal, for a row of machines (the next pins up from outputPin, see fanout.h)
+    //#define FANOUT_INVERT 0b01    // with FANOUT_PINS: bit i set turns output i the other way up
+    //#define FANOUT_MOTOR 6, 7, 8  // with FANOUT_PINS: each output's own motor sense, holding it while that machine's motor is off
+//#define SORTED_DIR                // list directories first, then only the files that play, each in name order
+    //#define FAST_BROWSE             // holding up/down speeds up to 10s and 100s of files; root+up/down (btnRoot_AS_PIVOT) jump by initial letter
+//#define NAME_CACHE                // keep the names of a window of directory entries in RAM, read in one pass
+//#define ROTARY_ENCODER            // browse with a quadrature encoder on ENCODER_A and ENCODER_B (pins that interrupt): the faster it turns the further it goes
+//#define TZX_META                  // show the machine and title from the ID32/ID33 blocks in the browser, cached in /MAXMETA.DAT
+//#define BLOCK_CHECK               // check .tap and ID10 block checksums during the pilot, and show CHECKSUM if one is bad
+//#define EXFAT_SCAN                // on exFAT cards, read directories several sectors at a time and pick the names out in RAM
+//#define BAUD_CACHE                // remember the speed each file last played right through at, in /MAXBAUD.DAT
+//#define PLAY_LOG                  // a line in /MAXPLAY.LOG for each file played: time, blocks, underruns, pauses, jumps, baud, whether it finished
+//#define SOAK_TEST                 // Soak Test in the menu replays a file (or a folder) until stop, logging each pass's timing to /MAXSOAK.LOG (see soak.h)
+//#define FAST_BOOT                 // at power on go straight back to the last file played, and skip the splash and logo waits
+    //#define RESUME_CHECKPOINT       // keep the block playback has got to, and let the first PLAY at power on carry on from there
+
+//#define LCD_I2C_ADDR    0x27        // Set the i2c address of your 1602LCD usually 0x27
+//#define LCDSCREEN16x2               // Set if you are using a 1602 LCD screen
+
+//#define OLED_SETCONTRAS   0xcf      // Override default value inside Diplay.ino, bigger to increase output current per segment
+#define OLED_ROTATE180
+#define OLED_address   0x3C           //0x3C or 0x3D
+#define OLED1306                      // Set if you are using OLED 1306 display
+      #define OLED1306_128_64         // 128x64 resolution with 8 rows
+      //#define OLED1106_1_3            // Use this line as well if you have a 1.3" OLED screen
+      //#define OLED_SPI                // 4-wire SPI display on the SD card's bus: also set OLED_SPI_CS and OLED_SPI_DC pins (OLED_SPI_RST optional)
+      //#define video64text32
+//#define btnRoot_AS_PIVOT
+  #define SHOW_DIRPOS
+      //#define SHOW_STATUS_LCD
+      //#define SHOW_DIRNAMES
+      
+  #define SHOW_BLOCKPOS_LCD
+  
+//#define XY                         // use original settings for Oled line 0,1 and status for menu
+#define XY2                      // use double size font wihtout status line for menu
+#define XY2force                    // Use with care: delay interrupts and crash with other options, needs I2CFAST
+
+#define SHOW_CNTR
+#define SHOW_PCT
+#define CNTRBASE 100                // 100 for sss, 60 for m:ss (sorry, no space for separator)
+#define MAXPAUSE_PERIOD   1000 // millis
+//#define ONPAUSE_POLCHG
+#define BLOCKMODE                   // REW or FF a block when in pause and Play to select it
+//#define BLOCK_SCRUB                 // hold REW or FF in pause to scrub back/forward through the current data block
+#define BLKSJUMPwithROOT            // use menu button in pause mode to switch blocks to jump
+#define BM_BLKSJUMP 20               // when menu pressed in pause mode, how may blocks to jump with REW OR FF
+#define BLKBIGSIZE                   // max number of block > 255
+#define OLEDBLKMATCH               // Match block numbers with REW/FF
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//#define SPLASH_SCREEN   1  // Displays the logo and welcome text at the initialization and remains until a button is pressed.
+#define TIMEOUT_RESET   60 // Timeout for reset tzxduino (without pause or play activated), comment to not reset.
+//#define BLOCK_EEPROM_PUT            // must be disabled if loading many turbo short blocks, as in Amstrad cpc demo Breaking Baud
+//#define BLOCKID_INTO_MEM              // enable for blockid recording and later rewinding if EEPROM_PUT is disabled.
+#define BLOCKID_NOMEM_SEARCH          // Loop and search for a block
+    //#define BLOCK_SD_INDEX            // keep a block index per file in /BLKIDX on the SD card, so jumps don't search
+    //#define TZX_PROGRAM               // pre-parse TZX block headers into a table when playback starts (exact block jumps and loop-aware percent)
+    //#define TAPE_TIME_LEFT            // with TZX_PROGRAM and SHOW_CNTR: count down the time left on the tape, and show the block's in place of the percentage
+    //#define SCROLL_WHILE_PLAYING      // keep scrolling a long filename on the OLED/LCD while the tape plays
+#define maxblock 99                   // maxblock if not using EEPROM
+//#define BLOCKID15_IN 
+#define BLOCKID19_IN                  // trace id19 block for zx81 .tzx to be rewinded
+#define BLOCKID21_IN
+#define BLOCKTAP_IN
+#define OLEDPRINTBLOCK 
+//#define BLOCK_EEPROM_START 512
+//#define LOAD_EEPROM_SETTINGS
+//#define EEPROM_CONFIG_BYTEPOS  255     // Byte position to save configuration
+#define OSTATUSLINE
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// EEPROM LOGO. How to move to EEPROM, saving memory:
+// Phase 1: Uncomment RECORD_EEPROM_LOGO define , this copies logo from memory to EEPROM. Compile the sketch.
+// Phase 2:  Comment RECORD_EEPROM define, uncomment LOAD_EEPROM define. Complile the sketch again 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Also it's posible to select record and load both for better testing new logo activation, pressing MENU simulates a reset.
+// And both can be deactivated also showing a black screen.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//#define COMPRESS_REPEAT_ROW
+//#define EEPROM_LOGO_COMPRESS
+#define LOAD_MEM_LOGO             // the Pico doesn't have eeprom
+//#define RECORD_EEPROM_LOGO        // Uncommenting RECORD_EEPROM deactivates #define Use_MENU
+//#define LOAD_EEPROM_LOGO 
+
+// for list of logos, see filenames in "logos" folder, and remove the logo_ prefix from the filename
+// either use the below defines, or use -DLOGO
+#define LOGO_128_64 cablemax
+#define LOGO_128_32 LOGOMAXDUINO2
+#define LOGO_84_48 LOGOMAXDUINO2
+
+/////////////////////
+//      FONTS      //
+/////////////////////
+#define DoubleFont
+//#define XY2_PRESCALED    // XY2 with an 8x8 font: double it from a pre-scaled table (fonts/8x8x2), 760 bytes more flash
+
+#define FONT8x8 zxFont
+#define FONT8x16 atariST8x16
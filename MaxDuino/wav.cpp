@@ -0,0 +1,137 @@
+#include "wav.h"
+
+#ifdef Use_WAV
+
+#include "file_utils.h"
+#include "processing_state.h"
+#include "MaxDuino.h"
+#include "MaxProcessing.h"
+
+namespace {
+
+// chunk IDs, as the little-endian dwords ReadDword gives
+constexpr unsigned long RIFF_ID = 0x46464952;   // "RIFF"
+constexpr unsigned long WAVE_ID = 0x45564157;   // "WAVE"
+constexpr unsigned long FMT_ID = 0x20746D66;    // "fmt "
+constexpr unsigned long DATA_ID = 0x61746164;   // "data"
+constexpr word FORMAT_PCM = 1;
+constexpr word FORMAT_EXTENSIBLE = 0xFFFE;      // (PCM, in the files that get this far)
+constexpr word WAV_MAX_US = 0x3FFF;             // longest plain pulse word in the buffer
+constexpr byte WAV_CHUNK = 64;                  // bytes taken out of the window at a time
+
+unsigned long wavUsPerSample;     // us per sample, 24.8 fixed point
+unsigned long wavEnd;             // file position where the samples end (0 if they can't be played)
+unsigned long wavMaxRun;          // samples in the longest pulse word, before it's played as silence
+byte wavAlign;                    // bytes per sample frame (all the channels)
+bool wav16;
+bool wavHigh;                     // which side of 0 the signal is on
+byte wavBuf[WAV_CHUNK];
+byte wavLen;                      // bytes in wavBuf
+byte wavIdx;
+
+bool next_sample(int8_t &s) {
+  // the first channel of the next frame, as signed 8 bit
+  if (wavIdx + wavAlign > wavLen) {
+    if (bytesRead >= wavEnd) return false;
+    unsigned long n = wavEnd - bytesRead;
+    if (n > WAV_CHUNK) n = WAV_CHUNK - (WAV_CHUNK % wavAlign);
+    wavLen = readfile_bytes(wavBuf, n, bytesRead);
+    bytesRead += wavLen;
+    wavIdx = 0;
+    if (wavLen < wavAlign) return false;
+  }
+  // 8 bit samples are unsigned, 16 bit are signed little-endian (the high byte is enough)
+  s = wav16 ? (int8_t)wavBuf[wavIdx+1] : (int8_t)(wavBuf[wavIdx] ^ 0x80);
+  wavIdx += wavAlign;
+  return true;
+}
+
+void set_period(unsigned long samples) {
+  const unsigned long us = (samples * wavUsPerSample + 128) >> 8;
+  if (us <= WAV_MAX_US) {
+    currentPeriod = us ? us : 1;
+  } else {
+    // too long for a pulse word, so play it as silence
+    const unsigned long ms = us / 1000;
+    currentPeriod = (ms > MAXPAUSE_PERIOD) ? MAXPAUSE_PERIOD : ms;
+    bitSet(currentPeriod, 15);
+  }
+}
+
+} // anonymous namespace
+
+void wav_init() {
+  // "RIFF", size, "WAVE", then chunks of id, size and data (padded to a
+  // word), of which "fmt " has the format and "data" the samples
+  bool ok = false;
+  wavEnd = 0;
+  bytesRead = 0;
+  if (ReadDword() && outLong == RIFF_ID && ReadDword() && ReadDword() && outLong == WAVE_ID) {
+    word format = 0, channels = 0, bits = 0;
+    unsigned long rate = 0;
+    while (ReadDword()) {
+      const unsigned long id = outLong;
+      if (!ReadDword()) break;
+      const unsigned long size = outLong;
+      const unsigned long next = bytesRead + size + (size & 1);
+      if (id == FMT_ID) {
+        if (ReadWord()) format = outWord;
+        if (ReadWord()) channels = outWord;
+        if (ReadDword()) rate = outLong;
+        bytesRead += 4;       // bytes per second
+        if (ReadWord()) wavAlign = outWord;
+        if (ReadWord()) bits = outWord;
+      } else if (id == DATA_ID) {
+        ok = (format == FORMAT_PCM || format == FORMAT_EXTENSIBLE) &&
+             (channels == 1 || channels == 2) && (bits == 8 || bits == 16) &&
+             rate != 0 && wavAlign == channels * bits / 8;
+        wavEnd = (next > filesize) ? filesize : bytesRead + size;
+        break;
+      }
+      bytesRead = next;
+    }
+    if (ok) {
+      wav16 = (bits == 16);
+      wavUsPerSample = (256000000UL + rate/2) / rate;
+      wavMaxRun = ((unsigned long)WAV_MAX_US << 8) / wavUsPerSample;
+    }
+  }
+
+  // not one that can be played: wav_process reports it once playback starts
+  if (!ok) wavEnd = 0;
+  wavLen = wavIdx = 0;
+  wavHigh = false;
+  currentTask = TASK::PROCESSID;
+  currentID = BLOCKID::WAV;
+}
+
+void wav_process() {
+  if (wavEnd == 0) {
+    HeaderFail();
+    return;
+  }
+  // count samples up to the next crossing; a long quiet stretch goes out a
+  // pulse word's worth at a time, as silence
+  unsigned long run = 0;
+  int8_t s;
+  while (next_sample(s)) {
+    run++;
+    if (wavHigh ? (s < -WAV_HYSTERESIS) : (s > WAV_HYSTERESIS)) {
+      wavHigh = !wavHigh;
+      set_period(run);
+      return;
+    }
+    if (run > wavMaxRun) {
+      set_period(run);
+      return;
+    }
+  }
+  if (run) {
+    set_period(run);
+    return;
+  }
+  EndOfFile = true;
+  currentID = BLOCKID::IDEOF;
+}
+
+#endif // Use_WAV
@@ -0,0 +1,27 @@
+#ifndef WAV_H_INCLUDED
+#define WAV_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef Use_WAV
+#include "Arduino.h"
+
+// .wav captures (PCM, 8 or 16 bit, mono or stereo) squared up as they play:
+// the first channel's samples go through a zero-crossing detector with some
+// hysteresis, and each edge-to-edge run is one pulse in the buffer, as a
+// .csw plays.  The samples are read a chunk at a time out of the read-ahead
+// window, and never go out at their own rate, so this is a job the 32-bit
+// boards do best.
+
+#ifndef WAV_HYSTERESIS
+  #define WAV_HYSTERESIS 8          // how far past 0 (of +-128) a sample goes before it's an edge
+#endif
+
+// check the RIFF header and find the samples (called from checkForEXT)
+void wav_init();
+
+// Process one step of a .wav file (BLOCKID::WAV)
+void wav_process();
+#endif
+
+#endif // WAV_H_INCLUDED
@@ -0,0 +1,219 @@
+#include "configs.h"
+#include "wifiservice.h"
+
+#ifdef WIFI_SERVICE
+
+#if !defined(ESP32) && !defined(ESP8266)
+  #error WIFI_SERVICE needs an ESP32 or ESP8266
+#endif
+#if !defined(WIFI_SSID) || !defined(WIFI_PASSWORD)
+  #error WIFI_SERVICE needs WIFI_SSID and WIFI_PASSWORD
+#endif
+
+#if defined(ESP32)
+  #include <WiFi.h>
+  #include <WebServer.h>
+  WebServer server(80);
+#else
+  #include <ESP8266WiFi.h>
+  #include <ESP8266WebServer.h>
+  ESP8266WebServer server(80);
+#endif
+
+#include "file_utils.h"
+#include "MaxDuino.h"
+#include "mxw.h"
+#include "station2.h"
+
+namespace {
+WIFI_CMD pendingCmd = WIFI_CMD::NONE;
+word pendingArg = 0;
+char selectName[64] = "";
+
+#ifdef NET_STREAM
+char streamUrl[256] = "";
+#endif
+
+SdBaseFile upload;
+bool uploadOk = false;
+
+void command(WIFI_CMD cmd, word arg = 0) {
+  pendingCmd = cmd;
+  pendingArg = arg;
+  server.send(200, F("text/plain"), F("OK\n"));
+}
+
+void handle_status() {
+  String s;
+  s.reserve(96);
+  s += F("state: ");
+  s += (start==0) ? F("stopped") : (pauseOn ? F("paused") : F("playing"));
+  s += F("\nfile: ");
+  s += fileName;
+  s += F("\nblock: ");
+  s += (unsigned)block;
+  s += F("\nposition: ");
+  s += bytesRead;
+  s += '/';
+  s += filesize;
+  s += '\n';
+#ifdef MXW_RENDER
+  if (mxwTally.words) {
+    char t[MXW_TALLY_TEXT];
+    mxw_tally_text(t);
+    s += F("render: ");
+    s += t;
+    s += '\n';
+  }
+#endif
+#ifdef STATION2
+  s += F("station2: ");
+  s += *station2_name() ? station2_name() : "stopped";
+  s += '\n';
+#endif
+  server.send(200, F("text/plain"), s);
+}
+
+void handle_play() {
+  selectName[0] = '\0';
+  if (server.hasArg(F("file"))) {
+    if (start==1) {
+      server.send(409, F("text/plain"), F("stop first\n"));
+      return;
+    }
+    strncpy(selectName, server.arg(F("file")).c_str(), sizeof(selectName)-1);
+    selectName[sizeof(selectName)-1] = '\0';
+  }
+  command(WIFI_CMD::PLAY);
+}
+
+void handle_block() {
+  if (start==0 || !pauseOn || !server.hasArg(F("n"))) {
+    server.send(409, F("text/plain"), F("pause first, and give n\n"));
+    return;
+  }
+  command(WIFI_CMD::BLOCK, server.arg(F("n")).toInt());
+}
+
+#ifdef MXW_RENDER
+void handle_render() {
+  if (start==0 && server.hasArg(F("all"))) {
+    command(WIFI_CMD::RENDER_ALL);
+    return;
+  }
+  if (start==1 || !server.hasArg(F("file"))) {
+    server.send(409, F("text/plain"), F("stop first, and give file (or all)\n"));
+    return;
+  }
+  strncpy(selectName, server.arg(F("file")).c_str(), sizeof(selectName)-1);
+  selectName[sizeof(selectName)-1] = '\0';
+  command(WIFI_CMD::RENDER);
+}
+#endif
+
+#ifdef STATION2
+void handle_station2() {
+  // the second station doesn't touch the main player, so this needn't wait for loop()
+  if (server.hasArg(F("stop"))) {
+    station2_stop();
+  } else if (!server.hasArg(F("file")) || !station2_play(server.arg(F("file")).c_str())) {
+    server.send(409, F("text/plain"), F("give a .mxw or .mxp file (or stop)\n"));
+    return;
+  }
+  server.send(200, F("text/plain"), F("OK\n"));
+}
+#endif
+
+#ifdef NET_STREAM
+void handle_stream() {
+  if (start==1 || !server.hasArg(F("url"))) {
+    server.send(409, F("text/plain"), F("stop first, and give url\n"));
+    return;
+  }
+  strncpy(streamUrl, server.arg(F("url")).c_str(), sizeof(streamUrl)-1);
+  streamUrl[sizeof(streamUrl)-1] = '\0';
+  command(WIFI_CMD::STREAM);
+}
+#endif
+
+void handle_upload_data() {
+  // called for each piece of the upload as it arrives, so the file goes
+  // straight to the card a network buffer (1-2K) at a time
+  HTTPUpload &u = server.upload();
+  switch (u.status) {
+    case UPLOAD_FILE_START:
+      uploadOk = false;
+      if (start==1) return;
+      upload.close();
+      uploadOk = upload.open(currentDir, u.filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC);
+      break;
+    case UPLOAD_FILE_WRITE:
+      if (uploadOk && upload.write(u.buf, u.currentSize) != u.currentSize)
+        uploadOk = false;
+      break;
+    case UPLOAD_FILE_END:
+      if (upload.isOpen()) {
+        if (!upload.close()) uploadOk = false;
+      }
+      break;
+    case UPLOAD_FILE_ABORTED:
+      upload.close();
+      uploadOk = false;
+      break;
+  }
+}
+
+void handle_upload_done() {
+  if (!uploadOk) {
+    server.send(start==1 ? 409 : 500, F("text/plain"), F("upload failed\n"));
+    return;
+  }
+  command(WIFI_CMD::RESCAN);
+}
+} // namespace
+
+void setup_wifi_service() {
+  // don't wait for the connection, the server answers once it's up
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+
+  server.on(F("/status"), HTTP_GET, handle_status);
+  server.on(F("/play"), HTTP_GET, handle_play);
+  server.on(F("/pause"), HTTP_GET, []() { command(WIFI_CMD::PAUSE); });
+  server.on(F("/stop"), HTTP_GET, []() { command(WIFI_CMD::STOP); });
+  server.on(F("/block"), HTTP_GET, handle_block);
+  server.on(F("/upload"), HTTP_POST, handle_upload_done, handle_upload_data);
+#ifdef NET_STREAM
+  server.on(F("/stream"), HTTP_GET, handle_stream);
+#endif
+#ifdef MXW_RENDER
+  server.on(F("/render"), HTTP_GET, handle_render);
+#endif
+#ifdef STATION2
+  server.on(F("/station2"), HTTP_GET, handle_station2);
+#endif
+  server.begin();
+}
+
+void wifi_service_loop() {
+  server.handleClient();
+}
+
+WIFI_CMD wifi_take_command(word &arg) {
+  const WIFI_CMD cmd = pendingCmd;
+  arg = pendingArg;
+  pendingCmd = WIFI_CMD::NONE;
+  return cmd;
+}
+
+const char *wifi_select_name() {
+  return selectName;
+}
+
+#ifdef NET_STREAM
+const char *wifi_stream_url() {
+  return streamUrl;
+}
+#endif
+
+#endif // WIFI_SERVICE
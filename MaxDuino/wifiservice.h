@@ -0,0 +1,51 @@
+#ifndef WIFISERVICE_H_INCLUDED
+#define WIFISERVICE_H_INCLUDED
+
+#include "configs.h"
+#include "Arduino.h"
+
+#ifdef WIFI_SERVICE
+
+// HTTP upload and remote control on the ESP builds.  The server is polled
+// from loop(), so requests are handled on the main loop and never from
+// the ISR.  Control requests only leave a command here, which loop() then
+// carries out the same way as the matching button.
+//
+//   GET  /status            state, file, block (and the last render's tally, see mxw.h)
+//   GET  /play[?file=NAME]  select NAME in the current directory (when stopped) and play, or unpause
+//   GET  /pause             pause / unpause
+//   GET  /stop
+//   GET  /block?n=N         jump to block N (when paused)
+//   POST /upload            multipart file upload into the current directory (when stopped)
+//   GET  /stream?url=URL    play URL straight from the network (NET_STREAM, when stopped)
+//   GET  /render?file=NAME  write NAME's buffer words to a .mxp file (MXW_RENDER, when stopped)
+//   GET  /render?all=1      the same for every file in the current directory, reported in /MXWRENDER.TXT
+//   GET  /station2?file=NAME   play NAME on the second station (STATION2, see station2.h), or ?stop=1
+
+enum class WIFI_CMD : byte {
+  NONE,
+  PLAY,
+  PAUSE,
+  STOP,
+  BLOCK,
+  RESCAN,   // a file was uploaded, so the directory listing is out of date
+#ifdef NET_STREAM
+  STREAM,   // play wifi_stream_url() (see netstream.h)
+#endif
+#ifdef MXW_RENDER
+  RENDER,   // render wifi_select_name() (see mxw.h)
+  RENDER_ALL,   // render the whole current directory
+#endif
+};
+
+void setup_wifi_service();
+void wifi_service_loop();
+WIFI_CMD wifi_take_command(word &arg);   // arg: the block for BLOCK
+const char *wifi_select_name();          // for PLAY and RENDER: file to select first, "" for none
+#ifdef NET_STREAM
+const char *wifi_stream_url();
+#endif
+
+#endif // WIFI_SERVICE
+
+#endif // WIFISERVICE_H_INCLUDED
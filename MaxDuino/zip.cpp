@@ -0,0 +1,142 @@
+#include "configs.h"
+#include "zip.h"
+
+#ifdef Use_ZIP
+
+#include "file_utils.h"
+#include "inflate.h"
+#include "CheckForExt.h"
+
+bool zip_browsing = false;
+
+namespace {
+constexpr unsigned long SIG_END = 0x06054b50;         // end of central directory
+constexpr unsigned long SIG_CENTRAL = 0x02014b50;
+constexpr unsigned long SIG_LOCAL = 0x04034b50;
+constexpr word END_SIZE = 22;
+constexpr word END_SEARCH = END_SIZE + 256;           // comments longer than this aren't looked past
+constexpr byte CENTRAL_SIZE = 46;
+constexpr byte LOCAL_SIZE = 30;
+constexpr byte METHOD_STORED = 0;
+constexpr byte METHOD_DEFLATE = 8;
+
+SdBaseFile zipFile;
+uint16_t zipPos = 0;
+uint16_t count = 0;
+unsigned long central[ZIP_MAX];     // where each member's central directory entry is
+
+unsigned long le32(const byte *p) {
+  return ((unsigned long)word(p[3], p[2]) << 16) | word(p[1], p[0]);
+}
+
+word le16(const byte *p) {
+  return word(p[1], p[0]);
+}
+
+bool find_end(unsigned long &cdAt, word &entries) {
+  // the end record is the last thing in the file, after any comment
+  byte buf[END_SEARCH];
+  const unsigned long size = zipFile.fileSize();
+  if (size < END_SIZE) return false;
+  const word n = (size < END_SEARCH) ? size : END_SEARCH;
+  if (!zipFile.seekSet(size - n) || zipFile.read(buf, n) != n) return false;
+  for (int i = n - END_SIZE; i >= 0; i--) {
+    if (le32(buf + i) == SIG_END) {
+      entries = le16(buf + i + 10);
+      cdAt = le32(buf + i + 16);
+      return true;
+    }
+  }
+  return false;
+}
+
+const char *base_name(const char *name) {
+  const char *slash = strrchr(name, '/');
+  return slash ? slash + 1 : name;
+}
+
+bool read_central(unsigned long at, byte *h, char *name) {
+  // the entry's fixed part into h (CENTRAL_SIZE), and its name, cut to filenameLength
+  if (!zipFile.seekSet(at) || zipFile.read(h, CENTRAL_SIZE) != CENTRAL_SIZE) return false;
+  if (le32(h) != SIG_CENTRAL) return false;
+  word len = le16(h + 28);
+  if (len > filenameLength) len = filenameLength;
+  if (zipFile.read(name, len) != len) return false;
+  name[len] = '\0';
+  return true;
+}
+} // anonymous namespace
+
+bool zip_is_archive(const char *name) {
+  const char *ext = strrchr(name, '.');
+  return ext && !strcasecmp_P(ext + 1, PSTR("zip"));
+}
+
+bool zip_enter(uint16_t pos) {
+  zip_leave();
+  if (!zipFile.open(currentDir, pos, O_RDONLY)) return false;
+  unsigned long at;
+  word entries;
+  if (!find_end(at, entries)) {
+    zipFile.close();
+    return false;
+  }
+  zipPos = pos;
+  count = 0;
+  byte h[CENTRAL_SIZE];
+  char name[filenameLength + 1];
+  while (entries-- && count < ZIP_MAX) {
+    if (!read_central(at, h, name)) break;
+    const word method = le16(h + 10);
+    const char *base = base_name(name);
+    // directories (a name ending in '/'), what can't be played, and zips in the zip are left out
+    if (*base && (method == METHOD_STORED || method == METHOD_DEFLATE) && is_playable(base) && !zip_is_archive(base))
+      central[count++] = at;
+    at += CENTRAL_SIZE + le16(h + 28) + le16(h + 30) + le16(h + 32);
+  }
+  zip_browsing = true;
+  return true;
+}
+
+void zip_leave() {
+  zipFile.close();
+  zip_browsing = false;
+  count = 0;
+}
+
+uint16_t zip_count() {
+  return count;
+}
+
+uint16_t zip_archive() {
+  return zipPos;
+}
+
+bool zip_member(uint16_t i, char *name, unsigned long &size) {
+  byte h[CENTRAL_SIZE];
+  if (i >= count || !read_central(central[i], h, name)) {
+    name[0] = '\0';
+    size = 0;
+    return false;
+  }
+  const char *base = base_name(name);
+  memmove(name, base, strlen(base) + 1);
+  size = le32(h + 24);
+  return true;
+}
+
+bool zip_open_member(uint16_t i) {
+  // the data starts after the local header, whose name and extra field
+  // needn't be the same lengths as the central directory's
+  byte h[CENTRAL_SIZE];
+  char name[filenameLength + 1];
+  if (i >= count || !read_central(central[i], h, name)) return false;
+  const unsigned long local = le32(h + 42);
+  byte l[LOCAL_SIZE];
+  if (!entry.seekSet(local) || entry.read(l, LOCAL_SIZE) != LOCAL_SIZE || le32(l) != SIG_LOCAL) return false;
+  const unsigned long data = local + LOCAL_SIZE + le16(l + 26) + le16(l + 28);
+  gz_open_raw(data, le32(h + 24), le16(h + 10) == METHOD_STORED);
+  return true;
+}
+
+#endif // Use_ZIP
@@ -0,0 +1,45 @@
+#ifndef ZIP_H_INCLUDED
+#define ZIP_H_INCLUDED
+
+#include "configs.h"
+
+#ifdef Use_ZIP
+#include "Arduino.h"
+
+// .zip archives browsed as directories.  Play on a .zip goes into it, as
+// into a directory, and stop comes back out.  The central directory is read
+// once on the way in, keeping where each playable member's entry is (up to
+// ZIP_MAX of them), so moving between members is one short read of that
+// entry.  A member plays through inflate.h, which reads it out of the
+// archive: deflated members are inflated as they go, stored ones are read
+// straight into the read-ahead window.
+
+#ifndef Use_UEF_GZ
+  #error Use_ZIP needs Use_UEF_GZ (the inflate it plays members through)
+#endif
+
+#ifndef ZIP_MAX
+  #define ZIP_MAX 255               // members kept, 4 bytes each
+#endif
+
+extern bool zip_browsing;           // inside a zip: currentFile is a member, 0 to zip_count()-1
+
+bool zip_is_archive(const char *name);   // by its extension
+// Into currentDir's entry pos; false if it isn't a zip that can be read
+bool zip_enter(uint16_t pos);
+void zip_leave();
+uint16_t zip_count();
+uint16_t zip_archive();             // the zip's own position in currentDir
+// member i's name (without its path, filenameLength+1 chars) and size
+bool zip_member(uint16_t i, char *name, unsigned long &size);
+// With entry open on the archive: play member i from it (sets filesize)
+bool zip_open_member(uint16_t i);
+
+#define ZIP_ENTRY(f) (zip_browsing ? zip_archive() : (f))   // what to open in currentDir
+#define ZIP_ACTIVE zip_browsing
+#else
+#define ZIP_ENTRY(f) (f)
+#define ZIP_ACTIVE false
+#endif
+
+#endif // ZIP_H_INCLUDED
@@ -4,6 +4,7 @@
 #include "file_utils.h"
 #include "MaxProcessing.h"
 #include "current_settings.h"
+#include "buffer.h"
 
 //ZX81 Pulse Patterns - Zero Bit  - HIGH, LOW, HIGH, LOW, HIGH, LOW, HIGH, GAP
 //                    - One Bit   - HIGH, LOW, HIGH, LOW, HIGH, LOW, HIGH, LOW, HIGH, LOW, HIGH, LOW, HIGH, LOW, HIGH, LOW, HIGH, GAP
@@ -15,46 +16,47 @@ PROGMEM const byte ZX81Filename[9] = {'T','Z','X','D','U','I','N','O',0x9D};
 byte currentChar=0;
 
 void ZX80ByteWrite(){
-  currentPeriod = ZX80PULSE;
-#ifdef ZX81SPEEDUP
-  if (BAUDRATE != 1200) currentPeriod = ZX80TURBOPULSE;
-#endif
-  if(pass==1) {
-    currentPeriod=ZX80BITGAP;
-  #ifdef ZX81SPEEDUP
-    if (BAUDRATE != 1200) currentPeriod = ZX80TURBOBITGAP;
-  #endif   
-  }
+  // Each bit is two buffer entries: its whole pulse train as one repeat (the
+  // count now, the period as pendingWord on the next TZXLoop pass), then
+  // the gap on the following call (pass==1)
   if(pass==0) {
     if(currentByte&0x80) {                       //Set next period depending on value of bit 0
-      pass=19;
+      currentPeriod = PULSE_REPEAT_FLAG | ZX80ONEEDGES;
     } else {
-      pass=9;
+      currentPeriod = PULSE_REPEAT_FLAG | ZX80ZEROEDGES;
     }
+    pendingWord = ZX80PULSE;
+  #ifdef ZX81SPEEDUP
+    if (BAUDRATE != 1200) pendingWord = ZX80TURBOPULSE;
+  #endif
     currentByte <<= 1;                        //Shift along to the next bit
     currentBit += -1;
-    currentPeriod=0;
+    pass=1;
+  } else {
+    currentPeriod=ZX80BITGAP;
+  #ifdef ZX81SPEEDUP
+    if (BAUDRATE != 1200) currentPeriod = ZX80TURBOBITGAP;
+  #endif
+    pass=0;
   }
-  pass+=-1;    
 }
 
 void ZX81FilenameBlock() {
   //output ZX81 filename data
-  if(currentBit==0) {                         //Check for byte end/first byte
+  if(currentBit==0 && pass==0) {              //Check for byte end/first byte
     currentByte = pgm_read_byte(ZX81Filename+currentChar);
     currentChar+=1;
     if(currentChar==10) {
       currentBlockTask = BLOCKTASK::TDATA;
       return;
     }
-    currentBit=9;
-    pass=0;
+    currentBit=8;
   }
   ZX80ByteWrite();
 }
 
 void ZX8081DataBlock() {
-  if(currentBit==0) {                         //Check for byte end/first byte
+  if(currentBit==0 && pass==0) {              //Check for byte end/first byte
     if(ReadByte()) {            //Read in a byte
       currentByte = outByte;
     #ifdef BLOCKID19_IN        
@@ -73,8 +75,7 @@ void ZX8081DataBlock() {
       currentID = BLOCKID::IDPAUSE;
       return;
     }
-    currentBit=9;
-    pass=0;
+    currentBit=8;
   }
   
   ZX80ByteWrite();
@@ -84,6 +85,7 @@ void tzx_process_blockid_zx8081_zxp() {
   switch(currentBlockTask) {
     case BLOCKTASK::READPARAM:
       currentChar=0;
+      pass=0;
       // fallthrough->
     
     case BLOCKTASK::PAUSE:
@@ -104,6 +106,7 @@ void tzx_process_blockid_zx8081_zxo() {
   switch(currentBlockTask) {
     case BLOCKTASK::READPARAM:
       currentChar=0;
+      pass=0;
       // fallthrough ->
                 
     case BLOCKTASK::PAUSE:
@@ -10,6 +10,10 @@
 #define ZX80BITGAP                1442
 #define ZX80TURBOBITGAP           500
 
+// edges before the gap: 4 pulses for a zero bit, 9 for a one
+#define ZX80ZEROEDGES             7
+#define ZX80ONEEDGES              17
+
 void ZX8081DataBlock();
 
 void tzx_process_blockid_zx8081_zxp();
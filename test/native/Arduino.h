@@ -0,0 +1,132 @@
+#ifndef NATIVE_ARDUINO_H_INCLUDED
+#define NATIVE_ARDUINO_H_INCLUDED
+
+// Just enough of the Arduino core for the players to build on the host
+// (env:native).  The sketch's pin 9 is bit 1 of PORTB, as on a Nano, and
+// millis()/micros() are the simulated time, which sim.cpp moves on by
+// each period the timer is given.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <math.h>
+
+typedef uint8_t byte;
+typedef uint16_t word;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define DEC 10
+#define HEX 16
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+typedef char __FlashStringHelper;
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define pgm_read_ptr(p) (*(void * const *)(p))
+#define memcpy_P memcpy
+#define memcmp_P memcmp
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strcat_P strcat
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcasecmp_P strcasecmp
+#define strncasecmp_P strncasecmp
+#define strlen_P strlen
+#define strstr_P strstr
+
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+#define bit(b) (1UL << (b))
+#define bitRead(v, b) (((v) >> (b)) & 1)
+#define bitSet(v, b) ((v) |= (1UL << (b)))
+#define bitClear(v, b) ((v) &= ~(1UL << (b)))
+#define bitWrite(v, b, x) ((x) ? bitSet(v, b) : bitClear(v, b))
+#define _BV(b) (1 << (b))
+// word(w) and word(h, l), as the cores have them
+inline word makeWord(word w) { return w; }
+inline word makeWord(byte h, byte l) { return (h << 8) | l; }
+#define word(...) makeWord(__VA_ARGS__)
+template <typename A, typename B> inline auto min(A a, B b) -> decltype(a < b ? a : b) { return a < b ? a : b; }
+template <typename A, typename B> inline auto max(A a, B b) -> decltype(a > b ? a : b) { return a > b ? a : b; }
+#define constrain(x, lo, hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+
+#define ISR_CODE
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+inline void noInterrupts() {}
+inline void interrupts() {}
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline int digitalRead(int) { return HIGH; }    // buttons up, no motor sense
+inline int analogRead(int) { return 0; }
+inline void yield() {}
+
+inline char *utoa(unsigned v, char *s, int base) {
+  sprintf(s, base == 16 ? "%x" : "%u", v);
+  return s;
+}
+inline char *ultoa(unsigned long v, char *s, int base) {
+  sprintf(s, base == 16 ? "%lx" : "%lu", v);
+  return s;
+}
+inline char *itoa(int v, char *s, int base) {
+  sprintf(s, base == 16 ? "%x" : "%d", v);
+  return s;
+}
+inline char *ltoa(long v, char *s, int base) {
+  sprintf(s, base == 16 ? "%lx" : "%ld", v);
+  return s;
+}
+
+// the AVR ports pinSetup.h writes the output (and the rest) to
+extern volatile uint8_t DDRB, PORTB, PINB, DDRC, PORTC, PINC, DDRD, PORTD, PIND;
+
+class Print {
+  public:
+    virtual size_t write(uint8_t c) = 0;
+    virtual ~Print() {}
+    size_t write(const char *s) { size_t n = 0; while (*s) n += write((uint8_t)*s++); return n; }
+    size_t write(const uint8_t *b, size_t n) { for (size_t i = 0; i < n; i++) write(b[i]); return n; }
+    size_t print(const char *s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v, int base = DEC) { return print((long)v, base); }
+    size_t print(unsigned v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(long v, int base = DEC) { char b[24]; return write(ltoa(v, b, base)); }
+    size_t print(unsigned long v, int base = DEC) { char b[24]; return write(ultoa(v, b, base)); }
+    size_t print(double v, int = 2) { char b[32]; snprintf(b, sizeof(b), "%.2f", v); return write(b); }
+    size_t println() { return write("\r\n"); }
+    template <typename T> size_t println(T v) { size_t n = print(v); return n + println(); }
+    template <typename T> size_t println(T v, int base) { size_t n = print(v, base); return n + println(); }
+};
+
+class HardwareSerial : public Print {
+  public:
+    void begin(unsigned long) {}
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+    int availableForWrite() { return 64; }
+    void flush() {}
+    size_t write(uint8_t c) { return fputc(c, stderr) == EOF ? 0 : 1; }
+    using Print::write;
+    operator bool() { return true; }
+};
+extern HardwareSerial Serial;
+
+#endif // NATIVE_ARDUINO_H_INCLUDED
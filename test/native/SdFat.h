@@ -0,0 +1,157 @@
+#ifndef NATIVE_SDFAT_H_INCLUDED
+#define NATIVE_SDFAT_H_INCLUDED
+
+// The SdFat the players use, with host files for the card: a directory is
+// its names in name order (so a file's index in it is its place in that
+// order), and a file is read through stdio.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+typedef int oflag_t;
+#define O_RDONLY 0
+#define O_WRONLY 1
+#define O_RDWR 2
+#define O_CREAT 0x40
+#define O_EXCL 0x80
+#define O_TRUNC 0x200
+#define O_APPEND 0x400
+#define O_WRITE O_WRONLY
+#define O_READ O_RDONLY
+
+struct cid_t { uint8_t b[16]; };
+
+class SdCard {
+  public:
+    bool readCID(cid_t *cid) { memset(cid, 0, sizeof(*cid)); return true; }
+    bool syncDevice() { return true; }
+    bool readStart(uint32_t) { return false; }
+    bool readData(uint8_t *) { return false; }
+    bool readStop() { return true; }
+    bool readSectors(uint32_t, uint8_t *, size_t) { return false; }
+    uint32_t sectorCount() { return 0; }
+};
+
+class SdBaseFile {
+  public:
+    SdBaseFile() {}
+    ~SdBaseFile() { close(); }
+    SdBaseFile(const SdBaseFile &) = delete;
+    SdBaseFile &operator=(const SdBaseFile &) = delete;
+
+    // a host path (as the card's root, for the harness)
+    bool open(const char *path, oflag_t = O_RDONLY) {
+      close();
+      path_ = path;
+      struct stat st;
+      if (stat(path, &st) != 0) return false;
+      if (S_ISDIR(st.st_mode)) {
+        DIR *d = opendir(path);
+        if (!d) return false;
+        while (struct dirent *e = readdir(d)) {
+          if (e->d_name[0] != '.') names_.push_back(e->d_name);
+        }
+        closedir(d);
+        std::sort(names_.begin(), names_.end());
+        dir_ = true;
+        return open_ = true;
+      }
+      fp_ = fopen(path, "rb");
+      if (!fp_) return false;
+      size_ = st.st_size;
+      return open_ = true;
+    }
+    // the index'th entry of dir
+    bool open(SdBaseFile *dir, uint16_t index, oflag_t flags = O_RDONLY) {
+      if (!dir || !dir->dir_ || index >= dir->names_.size()) return false;
+      const std::string path = dir->path_ + "/" + dir->names_[index];
+      if (!open(path.c_str(), flags)) return false;
+      index_ = index;
+      name_ = dir->names_[index];
+      return true;
+    }
+    bool open(SdBaseFile *dir, const char *name, oflag_t flags = O_RDONLY) {
+      if (!dir || !dir->dir_) return false;
+      for (uint16_t i = 0; i < dir->names_.size(); i++) {
+        if (dir->names_[i] == name) return open(dir, i, flags);
+      }
+      return false;
+    }
+    bool openNext(SdBaseFile *dir, oflag_t flags = O_RDONLY) {
+      if (!dir || !dir->dir_ || dir->next_ >= dir->names_.size()) return false;
+      return open(dir, dir->next_++, flags);
+    }
+    void close() {
+      if (fp_) fclose(fp_);
+      fp_ = nullptr;
+      open_ = dir_ = false;
+      names_.clear();
+      next_ = 0;
+      size_ = 0;
+    }
+    void rewind() { next_ = 0; seekSet(0); }
+
+    bool isOpen() const { return open_; }
+    bool isDir() const { return dir_; }
+    bool isSubDir() const { return dir_; }
+    bool isFile() const { return open_ && !dir_; }
+    bool isHidden() const { return false; }
+    uint16_t dirIndex() const { return index_; }
+    uint32_t fileSize() const { return size_; }
+    size_t getName(char *name, size_t size) {
+      snprintf(name, size, "%s", name_.c_str());
+      return strlen(name);
+    }
+    size_t getSFN(char *name, size_t size) { return getName(name, size); }
+
+    int read() {
+      if (!fp_) return -1;
+      return fgetc(fp_);
+    }
+    int read(void *buf, size_t n) {
+      if (!fp_) return -1;
+      return fread(buf, 1, n, fp_);
+    }
+    int available() { return fp_ ? size_ - ftell(fp_) : 0; }
+    bool seekSet(uint32_t pos) { return fp_ && fseek(fp_, pos, SEEK_SET) == 0; }
+    bool seekCur(int32_t off) { return fp_ && fseek(fp_, off, SEEK_CUR) == 0; }
+    bool seekEnd(int32_t off = 0) { return fp_ && fseek(fp_, off, SEEK_END) == 0; }
+    uint32_t curPosition() const { return fp_ ? ftell(fp_) : 0; }
+    // no sectors to read around the file system on the host
+    bool contiguousRange(uint32_t *, uint32_t *) { return false; }
+    uint32_t firstSector() { return 0; }
+    size_t write(const void *, size_t) { return 0; }
+    size_t write(uint8_t) { return 0; }
+    bool sync() { return true; }
+    void flush() {}
+
+  private:
+    FILE *fp_ = nullptr;
+    bool open_ = false;
+    bool dir_ = false;
+    uint32_t size_ = 0;
+    uint16_t index_ = 0;
+    uint16_t next_ = 0;
+    std::string path_;
+    std::string name_;
+    std::vector<std::string> names_;
+};
+
+class FsFile : public SdBaseFile {};
+class File32 : public SdBaseFile {};
+
+class SdFat {
+  public:
+    bool begin(...) { return true; }
+    SdCard *card() { return &card_; }
+  private:
+    SdCard card_;
+};
+
+#endif // NATIVE_SDFAT_H_INCLUDED
@@ -0,0 +1,42 @@
+// pio run -e native, then:
+//   .pio/build/native/firmware_native <file> [out.txt | out.wav]
+// plays file (a path on the host) and prints how long it runs and how fast
+// the players made its periods; with a second argument the periods go to
+// a text file, or a WAV if that ends in .wav.  (pio test -e native runs
+// test/test_pipeline instead, which has its own main.)
+#ifndef PIO_UNIT_TESTING
+
+#include "sim.h"
+#include <string>
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s <file> [out.txt | out.wav]\n", argv[0]);
+    return 2;
+  }
+  const std::string path = argv[1];
+  const size_t slash = path.rfind('/');
+  const std::string dir = (slash == std::string::npos) ? "." : path.substr(0, slash);
+  const std::string name = (slash == std::string::npos) ? path : path.substr(slash + 1);
+
+  SimResult r;
+  if (!sim_play(dir.c_str(), name.c_str(), r)) {
+    fprintf(stderr, "can't open %s\n", path.c_str());
+    return 1;
+  }
+  printf("%s: %s, %lu edges, %.3fs of output\n", name.c_str(),
+         r.ended ? "played to the end" : "stopped", (unsigned long)r.levels.size(), r.simUs / 1e6);
+  printf("%lu periods in %.3fs on the host: %.0f periods/s\n",
+         r.isrCalls, r.hostSeconds, r.hostSeconds > 0 ? r.isrCalls / r.hostSeconds : 0);
+  if (argc > 2) {
+    const std::string out = argv[2];
+    const bool wav = out.size() > 4 && out.compare(out.size() - 4, 4, ".wav") == 0;
+    if (!(wav ? sim_write_wav(out.c_str(), r) : sim_write_periods(out.c_str(), r))) {
+      fprintf(stderr, "can't write %s\n", out.c_str());
+      return 1;
+    }
+  }
+  return r.ended ? 0 : 1;
+}
+
+#endif // PIO_UNIT_TESTING
@@ -0,0 +1,148 @@
+#include "sim.h"
+#include "configs.h"
+#include "MaxDuino.h"
+#include "MaxProcessing.h"
+#include "TimerCounter.h"
+#include "buffer.h"
+#include "file_utils.h"
+#include "pinSetup.h"
+#include "Display.h"
+#include <chrono>
+
+// What MaxDuino.ino and the board would have given the players
+
+volatile uint8_t DDRB, PORTB, PINB, DDRC, PORTC, PINC, DDRD, PORTD, PIND;
+HardwareSerial Serial;
+
+SdFat sd;
+SdBaseFile _tmpdirs[2];
+SdBaseFile *currentDir = &_tmpdirs[0];
+char fileName[filenameLength + 1];
+uint16_t currentFile;
+byte start = 0;
+bool pauseOn = false;
+#ifdef BLKBIGSIZE
+  word block = 0;
+#else
+  byte block = 0;
+#endif
+
+namespace {
+unsigned long long nowUs = 0;       // the simulated clock
+bool ended = false;
+
+timerCallback callback = NULL;
+unsigned long period = 0;           // us to the next callback
+bool running = false;
+} // anonymous namespace
+
+unsigned long millis() { return nowUs / 1000; }
+unsigned long micros() { return nowUs; }
+void delay(unsigned long ms) { nowUs += ms * 1000ULL; }
+void delayMicroseconds(unsigned int us) { nowUs += us; }
+
+TimerCounter::TimerCounter() {}
+void TimerCounter::initialize(unsigned long microseconds) { period = microseconds; running = true; }
+void TimerCounter::setPeriod(unsigned long microseconds) { period = microseconds; }
+void TimerCounter::stop() { running = false; }
+void TimerCounter::attachInterrupt(timerCallback isr) { callback = isr; }
+static TimerCounter simTimer;
+TimerCounter &Timer = simTimer;
+
+void stopFile() {
+  UniStop();
+  start = 0;
+}
+void fileEnded() {
+  ended = true;
+  stopFile();
+}
+void seekFile() {}
+void block_mem_oled() {}
+void printtextF(const char *, int) {}
+void printtext2F(const char *, int) {}
+// an unrecognised block waits for stop before giving up on the file
+bool button_stop() { return true; }
+
+bool sim_play(const char *dir, const char *name, SimResult &result, unsigned long long limitUs) {
+  result = SimResult();
+  entry.close();
+  if (!currentDir->open(dir)) return false;
+  SdBaseFile f;
+  if (!f.open(currentDir, name)) return false;
+  currentFile = f.dirIndex();
+  filesize = f.fileSize();          // as seekFile leaves them
+  f.close();
+  snprintf(fileName, sizeof(fileName), "%s", name);
+
+  nowUs = 0;
+  ended = false;
+  callback = NULL;
+  running = false;
+  pauseOn = false;
+  byte level = LOW;
+  unsigned long long held = 0;      // us at level so far
+  bool first = true;                // before the first edge
+
+  const auto t0 = std::chrono::steady_clock::now();
+  UniPlay();
+  start = 1;
+  while (start == 1 && nowUs < limitUs) {
+    // as loop() does: fill while there's room, then the timer has its turn
+    do {
+      UniLoop();
+    } while (start == 1 && buffer_has_room());
+    if (start != 1 || !running || !callback) break;
+    held += period;
+    nowUs += period;
+    (*callback)();
+    result.isrCalls++;
+    const byte now = (PORTB & _BV(1)) ? HIGH : LOW;
+    if (now != level) {
+      if (!first) result.levels.push_back({level, (unsigned long)held});
+      first = false;
+      level = now;
+      held = 0;
+    }
+  }
+  result.hostSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+  if (!first && held) result.levels.push_back({level, (unsigned long)held});
+  if (start == 1) stopFile();
+  result.ended = ended;
+  result.simUs = nowUs;
+  return true;
+}
+
+bool sim_write_periods(const char *path, const SimResult &result) {
+  FILE *fp = fopen(path, "w");
+  if (!fp) return false;
+  for (const SimLevel &l : result.levels) fprintf(fp, "%c %lu\n", l.level ? 'H' : 'L', l.us);
+  return fclose(fp) == 0;
+}
+
+static void put32(FILE *fp, uint32_t v) {
+  for (byte i = 0; i < 4; i++) fputc((v >> (8 * i)) & 0xFF, fp);
+}
+
+bool sim_write_wav(const char *path, const SimResult &result, unsigned long rate) {
+  FILE *fp = fopen(path, "wb");
+  if (!fp) return false;
+  unsigned long long total = 0;
+  for (const SimLevel &l : result.levels) total += l.us;
+  const uint32_t samples = total * rate / 1000000ULL;
+  fwrite("RIFF", 1, 4, fp); put32(fp, 36 + samples);
+  fwrite("WAVEfmt ", 1, 8, fp); put32(fp, 16);
+  put32(fp, 0x00010001);            // PCM, mono
+  put32(fp, rate); put32(fp, rate);
+  put32(fp, 0x00080001);            // 1 byte a sample, 8 bits
+  fwrite("data", 1, 4, fp); put32(fp, samples);
+  // each sample is the level at its time
+  unsigned long long edge = 0;
+  uint32_t n = 0;
+  for (const SimLevel &l : result.levels) {
+    edge += l.us;
+    for (; n < samples && (unsigned long long)n * 1000000ULL / rate < edge; n++)
+      fputc(l.level ? 0xE0 : 0x20, fp);
+  }
+  return fclose(fp) == 0;
+}
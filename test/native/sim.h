@@ -0,0 +1,36 @@
+#ifndef SIM_H_INCLUDED
+#define SIM_H_INCLUDED
+
+// The players on the host (env:native): a file is played the way loop()
+// plays it, UniLoop keeping the buffer full and the timer's callback
+// (wave2) taking each period out, with the simulated clock moved on by
+// each one.  What comes out is the output pin's levels and how long each
+// is held, which a test can check, or sim_write_periods/sim_write_wav
+// save for a host to look at.
+
+#include "Arduino.h"
+#include <vector>
+
+struct SimLevel {
+  byte level;                   // the output, HIGH or LOW
+  unsigned long us;             // held for
+};
+
+struct SimResult {
+  std::vector<SimLevel> levels; // from the first edge (the lead-in with the timer starting is left out)
+  bool ended = false;           // played to the end (fileEnded), not stopped on an error
+  unsigned long isrCalls = 0;   // timer callbacks, each a period from the buffer (or a wait)
+  unsigned long long simUs = 0; // output time
+  double hostSeconds = 0;       // time UniPlay, UniLoop and the callbacks took on the host
+};
+
+// Play name, in the host directory dir, for at most limitUs of output
+bool sim_play(const char *dir, const char *name, SimResult &result,
+              unsigned long long limitUs = 3600ULL * 1000000ULL);
+
+// the edges, one period in us a line ("H 619" or "L 619")
+bool sim_write_periods(const char *path, const SimResult &result);
+// the output as a mono 8-bit WAV at rate, for a tape tool or a real machine
+bool sim_write_wav(const char *path, const SimResult &result, unsigned long rate = 44100);
+
+#endif // SIM_H_INCLUDED
@@ -0,0 +1,399 @@
+// pio test -e native
+//
+// Small tapes of each kind are written to a scratch directory and played
+// through the players (see test/native/sim.h); what comes out is checked
+// against the format's own timings, data bytes decoded back from the
+// edges where there are any.  Each also reports how fast the players made
+// its periods on the host, to catch a slowdown before it's flashed.
+
+#include <unity.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include "sim.h"
+
+namespace {
+std::string scratch;
+
+typedef std::vector<byte> Bytes;
+
+void le(Bytes &b, unsigned long v, byte n) {
+  for (byte i = 0; i < n; i++) b.push_back((v >> (8 * i)) & 0xFF);
+}
+
+void write_tape(const char *name, const Bytes &b) {
+  FILE *fp = fopen((scratch + "/" + name).c_str(), "wb");
+  TEST_ASSERT_NOT_NULL(fp);
+  TEST_ASSERT_EQUAL(b.size(), fwrite(b.data(), 1, b.size(), fp));
+  fclose(fp);
+}
+
+void play(const char *name, SimResult &r) {
+  TEST_ASSERT_TRUE(sim_play(scratch.c_str(), name, r));
+  TEST_ASSERT_TRUE_MESSAGE(r.ended, "didn't play to the end");
+  char msg[96];
+  snprintf(msg, sizeof(msg), "%s: %lu periods, %.0f periods/s on the host",
+           name, r.isrCalls, r.hostSeconds > 0 ? r.isrCalls / r.hostSeconds : 0);
+  TEST_MESSAGE(msg);
+}
+
+// levels from i for as long as each is us (within 1us), i moved past them
+unsigned long run(const SimResult &r, size_t &i, unsigned long us) {
+  unsigned long n = 0;
+  while (i < r.levels.size() && r.levels[i].us + 1 >= us && r.levels[i].us <= us + 1) {
+    i++;
+    n++;
+  }
+  return n;
+}
+
+void expect(const SimResult &r, size_t &i, unsigned long us) {
+  TEST_ASSERT_TRUE_MESSAGE(i < r.levels.size(), "ran out of edges");
+  TEST_ASSERT_UINT32_WITHIN(1, us, r.levels[i].us);
+  i++;
+}
+
+// bytes sent msb first, each bit two edges of zero or one us
+Bytes decode_pairs(const SimResult &r, size_t &i, unsigned long zero, unsigned long one, size_t count) {
+  Bytes out;
+  for (size_t n = 0; n < count; n++) {
+    byte v = 0;
+    for (byte b = 0; b < 8; b++) {
+      TEST_ASSERT_TRUE_MESSAGE(i + 1 < r.levels.size(), "ran out of edges");
+      const unsigned long us = r.levels[i].us;
+      TEST_ASSERT_UINT32_WITHIN(1, us, r.levels[i + 1].us);
+      TEST_ASSERT_TRUE_MESSAGE((us + 1 >= zero && us <= zero + 1) || (us + 1 >= one && us <= one + 1), "not a bit");
+      v = (v << 1) | (us + 1 >= one ? 1 : 0);
+      i += 2;
+    }
+    out.push_back(v);
+  }
+  return out;
+}
+
+// a zlib stream of stored deflate blocks, as Z-RLE needs and without a compressor
+Bytes zlib_stored(const Bytes &data) {
+  Bytes out = {0x78, 0x01};
+  out.push_back(0x01);                      // the final block, stored
+  le(out, data.size(), 2);
+  le(out, ~data.size() & 0xFFFF, 2);
+  out.insert(out.end(), data.begin(), data.end());
+  unsigned long a = 1, b = 0;
+  for (byte c : data) {
+    a = (a + c) % 65521;
+    b = (b + a) % 65521;
+  }
+  const unsigned long adler = (b << 16) | a;
+  for (int s = 24; s >= 0; s -= 8) out.push_back((adler >> s) & 0xFF);
+  return out;
+}
+
+// CSW RLE at 100kHz (10us a sample): 20 of 300us, 5 of 600us, then a 1000us one
+Bytes csw_pulses() {
+  Bytes p(20, 30);
+  p.insert(p.end(), 5, 60);
+  p.push_back(0);
+  le(p, 100, 4);
+  return p;
+}
+
+void expect_csw_pulses(const SimResult &r, size_t &i) {
+  TEST_ASSERT_UINT32_WITHIN(1, 20, run(r, i, 300));    // the first may go as the lead-in
+  TEST_ASSERT_EQUAL_UINT32(5, run(r, i, 600));
+  expect(r, i, 1000);
+}
+
+Bytes tap_block(Bytes data) {
+  byte x = 0;
+  for (byte b : data) x ^= b;
+  data.push_back(x);
+  Bytes out;
+  le(out, data.size(), 2);
+  out.insert(out.end(), data.begin(), data.end());
+  return out;
+}
+} // anonymous namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_tap_standard_timings() {
+  // a header and a 4 byte block, at the ROM's timings (T-states at 3.5MHz)
+  Bytes header = {0x00, 0x03};
+  for (const char *c = "TEST      "; *c; c++) header.push_back(*c);
+  le(header, 4, 2);
+  le(header, 32768, 2);
+  le(header, 32768, 2);
+  const Bytes data = {0xFF, 0x01, 0x02, 0x03, 0x80};
+  Bytes tape = tap_block(header);
+  const Bytes second = tap_block(data);
+  tape.insert(tape.end(), second.begin(), second.end());
+  write_tape("test.tap", tape);
+
+  SimResult r;
+  play("test.tap", r);
+  size_t i = 0;
+  TEST_ASSERT_EQUAL_UINT32(8064, run(r, i, 619));      // 2168T, 8063 pulses and the one it starts on
+  expect(r, i, 191);                                   // 667T
+  expect(r, i, 210);                                   // 735T
+  const Bytes h = decode_pairs(r, i, 244, 489, tape[0]);   // 855T, 1710T
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(&tape[2], h.data(), h.size());
+
+  // the gap (1s), then the data block's shorter pilot
+  unsigned long gap = 0;
+  while (i < r.levels.size() && r.levels[i].us != 619) gap += r.levels[i++].us;
+  TEST_ASSERT_UINT32_WITHIN(2000, 1000000, gap);
+  TEST_ASSERT_EQUAL_UINT32(3224, run(r, i, 619));
+  expect(r, i, 191);
+  expect(r, i, 210);
+  const Bytes d = decode_pairs(r, i, 244, 489, second[0]);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(&second[2], d.data(), d.size());
+}
+
+void test_tzx_turbo_tone_pulses_pause() {
+  Bytes t;
+  for (const char *c = "ZXTape!\x1a"; *c; c++) t.push_back(*c);
+  t.push_back(1);
+  t.push_back(20);
+  // ID11: pilot 1000T x 100, syncs 300T and 400T, bits 500T and 1000T, no pause
+  t.push_back(0x11);
+  le(t, 1000, 2); le(t, 300, 2); le(t, 400, 2); le(t, 500, 2); le(t, 1000, 2); le(t, 100, 2);
+  t.push_back(8);
+  le(t, 0, 2);
+  le(t, 2, 3);
+  t.push_back(0x0F);
+  t.push_back(0xA5);
+  // ID12: 50 pulses of 700T
+  t.push_back(0x12);
+  le(t, 700, 2); le(t, 50, 2);
+  // ID13: 350T, 700T, 1050T
+  t.push_back(0x13);
+  t.push_back(3);
+  le(t, 350, 2); le(t, 700, 2); le(t, 1050, 2);
+  // ID20: 100ms
+  t.push_back(0x20);
+  le(t, 100, 2);
+  write_tape("test.tzx", t);
+
+  SimResult r;
+  play("test.tzx", r);
+  size_t i = 0;
+  TEST_ASSERT_EQUAL_UINT32(100, run(r, i, 286));
+  expect(r, i, 86);
+  expect(r, i, 114);
+  const Bytes d = decode_pairs(r, i, 143, 286, 2);
+  TEST_ASSERT_EQUAL_HEX8(0x0F, d[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xA5, d[1]);
+  TEST_ASSERT_EQUAL_UINT32(50, run(r, i, 200));
+  expect(r, i, 100);
+  expect(r, i, 200);
+  expect(r, i, 300);
+  TEST_ASSERT_TRUE(i < r.levels.size());
+  TEST_ASSERT_UINT32_WITHIN(2000, 100000, r.levels[i].us);
+}
+
+void test_tzx_generalized_data() {
+  // ID19 laid out as a standard block: pilot symbols 2168T and 667T+735T
+  // run as 200 and 1 in PRLE, data symbols 2 x 855T and 2 x 1710T
+  Bytes b;
+  le(b, 100, 2);                            // pause, ms
+  le(b, 2, 4); b.push_back(2); b.push_back(2);   // TOTP, NPP, ASP
+  le(b, 16, 4); b.push_back(2); b.push_back(2);  // TOTD, NPD, ASD
+  b.push_back(0); le(b, 2168, 2); le(b, 0, 2);
+  b.push_back(0); le(b, 667, 2); le(b, 735, 2);
+  b.push_back(0); le(b, 200, 2);
+  b.push_back(1); le(b, 1, 2);
+  b.push_back(0); le(b, 855, 2); le(b, 855, 2);
+  b.push_back(0); le(b, 1710, 2); le(b, 1710, 2);
+  b.push_back(0xA5);
+  b.push_back(0x0F);
+  Bytes t;
+  for (const char *c = "ZXTape!\x1a"; *c; c++) t.push_back(*c);
+  t.push_back(1);
+  t.push_back(20);
+  t.push_back(0x19);
+  le(t, b.size(), 4);
+  t.insert(t.end(), b.begin(), b.end());
+  write_tape("gdb.tzx", t);
+
+  SimResult r;
+  play("gdb.tzx", r);
+  size_t i = 0;
+  TEST_ASSERT_EQUAL_UINT32(200, run(r, i, 619));
+  expect(r, i, 191);
+  expect(r, i, 210);
+  const Bytes d = decode_pairs(r, i, 244, 489, 2);
+  TEST_ASSERT_EQUAL_HEX8(0xA5, d[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x0F, d[1]);
+  // the block's pause, then the end of file padding
+  unsigned long gap = 0;
+  while (i < r.levels.size() && r.levels[i].us > 100) gap += r.levels[i++].us;
+  TEST_ASSERT_UINT32_WITHIN(2000, 100000, gap);
+}
+
+void test_c64_tap_half_waves() {
+  // C64-TAPE-RAW v1: each byte is a whole wave of 8 cycles a count at
+  // 985248Hz, played as two equal halves; 0 then a 24 bit count is a long one
+  Bytes data(20, 0x30);
+  data.insert(data.end(), 5, 0x42);
+  data.push_back(0);
+  le(data, 100000, 3);
+  data.insert(data.end(), 4, 0x56);
+  Bytes t;
+  for (const char *c = "C64-TAPE-RAW"; *c; c++) t.push_back(*c);
+  t.push_back(1);
+  le(t, 0, 3);
+  le(t, data.size(), 4);
+  t.insert(t.end(), data.begin(), data.end());
+  write_tape("c64.tap", t);
+
+  SimResult r;
+  play("c64.tap", r);
+  size_t i = 0;
+  TEST_ASSERT_EQUAL_UINT32(40, run(r, i, 195));        // 0x30 * 8 / 985248Hz = 390us
+  TEST_ASSERT_EQUAL_UINT32(10, run(r, i, 268));        // 0x42
+  unsigned long longWave = 0;
+  while (i < r.levels.size() && r.levels[i].us > 1000) longWave += r.levels[i++].us;
+  TEST_ASSERT_UINT32_WITHIN(50, 101497, longWave);     // 100000 / 985248Hz, both halves
+  TEST_ASSERT_EQUAL_UINT32(8, run(r, i, 349));         // 0x56
+}
+
+void test_c64_tap_v2_half_waves() {
+  // v2: each byte is a half-wave, and two short ones go into one buffer
+  // word; they have to come out right up to the end of the file, with
+  // the player already past it and pages of them still to play
+  Bytes data;
+  for (int n = 0; n < 600; n++) {
+    data.push_back(48);                               // 384 cycles, 390us
+    data.push_back(32);                               // 256 cycles, 260us
+  }
+  Bytes t;
+  for (const char *c = "C64-TAPE-RAW"; *c; c++) t.push_back(*c);
+  t.push_back(2);
+  le(t, 0, 3);
+  le(t, data.size(), 4);
+  t.insert(t.end(), data.begin(), data.end());
+  write_tape("c64v2.tap", t);
+
+  SimResult r;
+  play("c64v2.tap", r);
+  // the first edge may go as the lead-in, and the end of file padding follows
+  size_t i = 0;
+  if (r.levels[0].us + 5 < 390) i++;
+  const size_t first = i;
+  for (; i < r.levels.size() && i < first + 1199; i++) {
+    const unsigned long want = ((i - first) % 2) ? 260 : 390;
+    TEST_ASSERT_UINT32_WITHIN_MESSAGE(4, want, r.levels[i].us, "half-wave off");
+  }
+  TEST_ASSERT_EQUAL_UINT32(first + 1199, i);
+}
+
+void test_uef_bits() {
+  // a carrier, then two bytes sent 8N1 (a start bit, lsb first, a stop bit):
+  // a zero is one cycle at the base frequency and a one two at twice it
+  Bytes u;
+  for (const char *c = "UEF File!"; *c; c++) u.push_back(*c);
+  u.push_back(0);
+  u.push_back(10);
+  u.push_back(0);
+  le(u, 0x110, 2); le(u, 2, 4); le(u, 30, 2);
+  le(u, 0x100, 2); le(u, 2, 4);
+  u.push_back(0x2A);
+  u.push_back(0x81);
+  write_tape("test.uef", u);
+
+  SimResult r;
+  play("test.uef", r);
+  size_t i = 0;
+  while (i < r.levels.size() && r.levels[i].us < 300) i++;   // the carrier
+  TEST_ASSERT_TRUE(i > 0);
+  const unsigned long zero = r.levels[i].us;                // a half cycle of a zero
+  for (const byte v : {0x2A, 0x81}) {
+    byte got = 0;
+    byte bits[10];
+    for (byte b = 0; b < 10; b++) {
+      TEST_ASSERT_TRUE_MESSAGE(i + 1 < r.levels.size(), "ran out of edges");
+      if (r.levels[i].us + 1 >= zero) {
+        TEST_ASSERT_UINT32_WITHIN(1, zero, r.levels[i + 1].us);
+        bits[b] = 0;
+        i += 2;
+      } else {
+        for (byte e = 0; e < 4; e++) TEST_ASSERT_UINT32_WITHIN(1, zero / 2, r.levels[i + e].us);
+        bits[b] = 1;
+        i += 4;
+      }
+    }
+    TEST_ASSERT_EQUAL(0, bits[0]);
+    TEST_ASSERT_EQUAL(1, bits[9]);
+    for (byte b = 0; b < 8; b++) got |= bits[1 + b] << b;
+    TEST_ASSERT_EQUAL_HEX8(v, got);
+  }
+}
+
+void test_csw_zrle() {
+  // a CSW-2 file, Z-RLE
+  const Bytes z = zlib_stored(csw_pulses());
+  Bytes c;
+  for (const char *s = "Compressed Square Wave\x1a"; *s; s++) c.push_back(*s);
+  c.push_back(2);
+  c.push_back(0);
+  le(c, 100000, 4);
+  le(c, 26, 4);
+  c.push_back(2);                           // Z-RLE
+  c.push_back(0);
+  c.push_back(0);                           // no header extension
+  c.insert(c.end(), 16, 0);
+  c.insert(c.end(), z.begin(), z.end());
+  write_tape("test.csw", c);
+
+  SimResult r;
+  play("test.csw", r);
+  size_t i = 0;
+  expect_csw_pulses(r, i);
+
+  // the same as a TZX ID18, then the file goes on after it: ID12, 50 of 700T
+  Bytes t;
+  for (const char *s = "ZXTape!\x1a"; *s; s++) t.push_back(*s);
+  t.push_back(1);
+  t.push_back(20);
+  t.push_back(0x18);
+  le(t, 10 + z.size(), 4);
+  le(t, 0, 2);                              // no pause
+  le(t, 100000, 3);
+  t.push_back(2);
+  le(t, 26, 4);
+  t.insert(t.end(), z.begin(), z.end());
+  t.push_back(0x12);
+  le(t, 700, 2); le(t, 50, 2);
+  write_tape("zrle.tzx", t);
+
+  play("zrle.tzx", r);
+  i = 0;
+  expect_csw_pulses(r, i);
+  TEST_ASSERT_UINT32_WITHIN(1, 50, run(r, i, 200));
+}
+
+void test_faster_than_real_time() {
+  // far more than the boards need, but a player gone quadratic shows up
+  SimResult r;
+  play("test.tap", r);
+  TEST_ASSERT_TRUE(r.hostSeconds * 10 < r.simUs / 1e6);
+}
+
+int main(int, char **) {
+  char dir[] = "/tmp/maxduino_testXXXXXX";
+  if (!mkdtemp(dir)) return 1;
+  scratch = dir;
+  UNITY_BEGIN();
+  RUN_TEST(test_tap_standard_timings);
+  RUN_TEST(test_tzx_turbo_tone_pulses_pause);
+  RUN_TEST(test_tzx_generalized_data);
+  RUN_TEST(test_c64_tap_half_waves);
+  RUN_TEST(test_c64_tap_v2_half_waves);
+  RUN_TEST(test_uef_bits);
+  RUN_TEST(test_csw_zrle);
+  RUN_TEST(test_faster_than_real_time);
+  const int failed = UNITY_END();
+  system(("rm -rf " + scratch).c_str());
+  return failed;
+}
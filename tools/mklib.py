@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""Pack tape files into an image for MaxDuino's FLASH_LIBRARY partition.
+
+The image is what flashlib.cpp maps: a header, an index of the files, then
+the files themselves, each on a 4 byte boundary, all little endian.
+
+  "MXLB", count (2), 0 (2)
+  count entries of name (56, 0 padded), offset (4), size (4)
+
+    python3 mklib.py -o tapes.bin GAMES/*.TZX DEMOS/*.TAP
+    python3 mklib.py -o tapes.bin --size 0x300000 GAMES/
+
+A directory adds the files in it (not its subdirectories), in name order;
+the names are the files' own, without the path, and the player lists them in
+the order given.  The board needs a partition for it in its partition table,
+a data partition of subtype 0x40 called tapes (FLASH_LIBRARY_LABEL and
+FLASH_LIBRARY_SUBTYPE), e.g. in a platformio board_build.partitions CSV
+
+  tapes,    data, 0x40,    ,        0x300000,
+
+and the image written at its offset, with esptool.py write_flash <offset>
+tapes.bin (or parttool.py write_partition --partition-name tapes).  --size
+checks it fits.
+"""
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = b'MXLB'
+HEADER = struct.Struct('<4sHH')
+ENTRY = struct.Struct('<56sII')
+NAME_SIZE = 56
+ALIGN = 4
+
+
+def gather(paths):
+    files = []
+    for path in paths:
+        if os.path.isdir(path):
+            for name in sorted(os.listdir(path), key=str.upper):
+                full = os.path.join(path, name)
+                if os.path.isfile(full):
+                    files.append(full)
+        else:
+            files.append(path)
+    return files
+
+
+def pack(files):
+    names = []
+    for f in files:
+        name = os.path.basename(f).encode('latin-1', 'replace')
+        if len(name) >= NAME_SIZE:
+            sys.exit('%s: name too long (%d chars at most)' % (f, NAME_SIZE - 1))
+        names.append(name)
+    if len(files) > 0xFFFF:
+        sys.exit('too many files')
+
+    offset = HEADER.size + ENTRY.size * len(files)
+    index = []
+    data = []
+    for f, name in zip(files, names):
+        with open(f, 'rb') as fh:
+            body = fh.read()
+        offset = -(-offset // ALIGN) * ALIGN
+        index.append(ENTRY.pack(name, offset, len(body)))
+        data.append((offset, body))
+        offset += len(body)
+
+    image = bytearray(offset)
+    HEADER.pack_into(image, 0, MAGIC, len(files), 0)
+    for i, e in enumerate(index):
+        image[HEADER.size + i * ENTRY.size:HEADER.size + (i + 1) * ENTRY.size] = e
+    for at, body in data:
+        image[at:at + len(body)] = body
+    return bytes(image)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('-o', '--output', required=True, help='the image to write')
+    ap.add_argument('--size', type=lambda s: int(s, 0),
+                    help='the partition size, to check the image fits')
+    ap.add_argument('paths', nargs='+', help='files, or directories of them')
+    args = ap.parse_args()
+
+    files = gather(args.paths)
+    if not files:
+        sys.exit('no files')
+    image = pack(files)
+    if args.size is not None and len(image) > args.size:
+        sys.exit('%d bytes, %d too many for the partition'
+                 % (len(image), len(image) - args.size))
+    with open(args.output, 'wb') as fh:
+        fh.write(image)
+    print('%d files, %d bytes' % (len(files), len(image)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,273 @@
+#!/usr/bin/env python3
+"""Build MaxDuino's SD card caches on a PC, for a card that's mounted there.
+
+Walks every file on the card (over all cores) and writes what the player
+would otherwise build the first time each file is used:
+
+  /BLKIDX/<sector>.IDX   BLOCK_SD_INDEX block index of each TZX/TSX/CDT/TAP
+  /MAXMETA.DAT           TZX_META title, author and machine of each TZX
+
+in the same format, and with the same block rules, as blockindex.cpp and
+tzxmeta.cpp (and SkipBlockHeader in MaxDuino.ino).  The block numbering
+depends on the build, so say which of OLEDBLKMATCH, BLOCKID21_IN and
+BLOCKTAP_IN it has (the defaults are as the shipped configs have them).
+
+    python3 sdprep.py /media/CARD
+    python3 sdprep.py --no-oledblkmatch --slots 128 /media/CARD
+
+The index files are named after each file's first sector on the card, which
+is read with FIEMAP (or FIBMAP, as root) from the mounted filesystem, plus
+the partition's start from sysfs; on Linux only.  An image mounted with an
+offset rather than as a partition needs --part-start.  The sorted listing
+(SORTED_DIR), NAME_CACHE and UEF_INDEX are built in RAM as each directory
+or file opens, so there's nothing for them on the card.
+"""
+import argparse
+import fcntl
+import multiprocessing
+import os
+import struct
+import sys
+
+TZX_MAGIC = b'ZXTape!'
+TAP = 0xFE
+JTAP = 0xF8
+IDX_DIR = 'BLKIDX'
+META_NAME = 'MAXMETA.DAT'
+
+META_TITLE = 24
+META_AUTHOR = 16
+REC_MACHINE = 8
+REC_TITLE = 9
+REC_AUTHOR = REC_TITLE + META_TITLE
+REC_SIZE = REC_AUTHOR + META_AUTHOR
+NO_MACHINE = 0xFF
+
+FS_IOC_FIEMAP = 0xC020660B
+FIBMAP = 1
+FIGETBSZ = 2
+
+# the id byte's data length, as SkipBlockHeader skips it: (fixed bytes first,
+# then the length field's size and multiplier)
+SKIP = {
+    0x10: (2, 2, 1), 0x11: (15, 3, 1), 0x12: (4, 0, 0), 0x13: (0, 1, 2),
+    0x14: (7, 3, 1), 0x15: (5, 3, 1), 0x18: (0, 4, 1), 0x19: (0, 4, 1),
+    0x20: (2, 0, 0), 0x21: (0, 1, 1), 0x22: (0, 0, 0), 0x23: (2, 0, 0),
+    0x24: (2, 0, 0), 0x25: (0, 0, 0), 0x26: (0, 2, 2), 0x27: (0, 0, 0),
+    0x28: (0, 2, 1), 0x2A: (4, 0, 0), 0x2B: (5, 0, 0), 0x30: (0, 1, 1),
+    0x31: (1, 1, 1), 0x32: (0, 2, 1), 0x33: (0, 1, 3), 0x35: (0x10, 4, 1),
+    0x4B: (0, 4, 1), TAP: (0, 2, 1), JTAP: (0, 2, 1),
+}
+
+
+def counted_ids(opts):
+    if not opts.oledblkmatch:
+        return None                      # every block counts
+    ids = {0x10, 0x11, 0x15, 0x18, 0x19, 0x4B}
+    if opts.blockid21:
+        ids.add(0x21)
+    if opts.blocktap:
+        ids.update((TAP, JTAP))
+    return ids
+
+
+def le(data, p, n):
+    # an n byte little endian field at p, None past the end of the file
+    if p + n > len(data):
+        return None
+    return int.from_bytes(data[p:p + n], 'little')
+
+
+def walk(data, file_id, counted):
+    # (start, id, counted) of each block, as SkipBlockHeader steps through them
+    # (a TZX block with the TAP or JTAP id turns the rest into TAP blocks there too)
+    p = 0 if file_id in (TAP, JTAP) else 10
+    cur = file_id
+    while p < len(data):
+        start = p
+        if cur not in (TAP, JTAP):
+            cur = data[p]
+            p += 1
+        fixed, size, mult = SKIP.get(cur, (0, 0, 0))
+        p += fixed
+        if size:
+            n = le(data, p, size)
+            if n is not None:
+                p += size + n * mult
+        yield start, cur, counted is None or cur in counted
+
+
+def block_index(data, file_id, counted):
+    blocks = list(walk(data, file_id, counted))
+    mine = [b for b in blocks if b[2]]
+    out = bytearray(b'MXB2')
+    out += struct.pack('<II', len(data), len(mine))
+    for start, cur, _ in mine + blocks:
+        out += struct.pack('<IB', start & 0xFFFFFFFF, cur)
+    return bytes(out)
+
+
+def copy_text(rec, at, maxlen, data, p, n):
+    # as tzxmeta.cpp: printable, cut at maxlen, trailing spaces dropped
+    n = min(n, maxlen)
+    text = bytearray(data[p:p + n])
+    for i, c in enumerate(text):
+        if c < 0x20 or c > 0x7E:
+            text[i] = 0x20
+    rec[at:at + len(text)] = text
+    n = len(text)
+    while n > 0 and rec[at + n - 1] == 0x20:
+        n -= 1
+        rec[at + n] = 0
+
+
+def meta_record(name, data):
+    size = len(data)
+    h = name_hash(name)
+    rec = bytearray(REC_SIZE)
+    rec[0:8] = struct.pack('<II', h, size)
+    rec[REC_MACHINE] = NO_MACHINE
+    titled = False
+    for start, cur, _ in walk(data, 0, None):
+        if cur == 0x30:
+            n = le(data, start + 1, 1)
+            if not titled and rec[REC_TITLE] == 0 and n is not None:
+                copy_text(rec, REC_TITLE, META_TITLE, data, start + 2, n)
+        elif cur == 0x32:
+            count = le(data, start + 3, 1)
+            p = start + 4
+            for _ in range(count or 0):
+                if p + 2 > size:
+                    break
+                kind, n = data[p], data[p + 1]
+                if kind == 0x00:
+                    rec[REC_TITLE:REC_AUTHOR] = bytes(META_TITLE)
+                    copy_text(rec, REC_TITLE, META_TITLE, data, p + 2, n)
+                    titled = True
+                elif kind == 0x02:
+                    copy_text(rec, REC_AUTHOR, META_AUTHOR, data, p + 2, n)
+                p += 2 + n
+        elif cur == 0x33 and rec[REC_MACHINE] == NO_MACHINE:
+            count = le(data, start + 1, 1)
+            p = start + 2
+            for _ in range(count or 0):
+                if p + 3 > size:
+                    break
+                if data[p] == 0x00 and data[p + 2] != 0x03:
+                    rec[REC_MACHINE] = data[p + 1]
+                    break
+                p += 3
+    return h, size, bytes(rec)
+
+
+def name_hash(name):
+    h = 2166136261
+    for c in name.encode('utf-8'):
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def first_sector(path, part_start):
+    # the card sector the file's data starts at, as entry.firstSector() has it
+    with open(path, 'rb') as f:
+        try:
+            req = struct.pack('QQIIII', 0, 1, 0, 0, 1, 0) + bytes(56)
+            res = fcntl.ioctl(f.fileno(), FS_IOC_FIEMAP, req)
+            if struct.unpack_from('I', res, 20)[0]:
+                return part_start + struct.unpack_from('Q', res, 40)[0] // 512
+        except OSError:
+            pass
+        bsz = struct.unpack('i', fcntl.ioctl(f.fileno(), FIGETBSZ, struct.pack('i', 0)))[0]
+        blk = struct.unpack('i', fcntl.ioctl(f.fileno(), FIBMAP, struct.pack('i', 0)))[0]
+        return part_start + blk * bsz // 512
+
+
+def partition_start(root):
+    dev = os.stat(root).st_dev
+    try:
+        with open('/sys/dev/block/%d:%d/start' % (os.major(dev), os.minor(dev))) as f:
+            return int(f.read())
+    except OSError:
+        return 0    # a filesystem on the whole device (or an image)
+
+
+def scan(job):
+    path, opts, part_start = job
+    with open(path, 'rb') as f:
+        data = f.read()
+    if not data:
+        return path, None, None, None
+    if data.startswith(TZX_MAGIC):
+        file_id = 0
+    elif path.lower().endswith('.tap') and not (data[0] == 0x16 and opts.oric):
+        file_id = JTAP if data[0] == 0x1A else TAP
+    else:
+        return path, None, None, None
+    idx = block_index(data, file_id, counted_ids(opts))
+    meta = meta_record(os.path.basename(path), data) if file_id == 0 else None
+    try:
+        sector = first_sector(path, part_start)
+    except OSError:
+        sector = 0          # no block map from this filesystem (or not as root)
+    return path, sector, idx, meta
+
+
+def files(root):
+    for d, dirs, names in os.walk(root):
+        if d == root:
+            dirs[:] = [x for x in dirs if x.upper() != IDX_DIR]
+        for n in sorted(names):
+            yield os.path.join(d, n)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    ap.add_argument('root', help='where the card is mounted')
+    ap.add_argument('--no-oledblkmatch', dest='oledblkmatch', action='store_false',
+                    help='the build has no OLEDBLKMATCH (every block is counted)')
+    ap.add_argument('--no-blockid21', dest='blockid21', action='store_false',
+                    help='the build has no BLOCKID21_IN')
+    ap.add_argument('--no-blocktap', dest='blocktap', action='store_false',
+                    help='the build has no BLOCKTAP_IN')
+    ap.add_argument('--no-oric', dest='oric', action='store_false',
+                    help='the build has no tapORIC (a .tap starting 0x16 is a ZX one)')
+    ap.add_argument('--slots', type=int, default=256, help='TZX_META_SLOTS (256)')
+    ap.add_argument('--part-start', type=int, help="the partition's first sector on the card")
+    ap.add_argument('--jobs', type=int, default=os.cpu_count())
+    opts = ap.parse_args()
+
+    part_start = opts.part_start if opts.part_start is not None else partition_start(opts.root)
+    idx_dir = os.path.join(opts.root, IDX_DIR)
+    os.makedirs(idx_dir, exist_ok=True)
+    meta_path = os.path.join(opts.root, META_NAME)
+    meta = bytearray()
+    if os.path.exists(meta_path):
+        with open(meta_path, 'rb') as f:
+            meta = bytearray(f.read())    # the files that aren't on the card (any more) can stay
+    indexed = described = 0
+    jobs = ((p, opts, part_start) for p in files(opts.root))
+    with multiprocessing.Pool(opts.jobs) as pool:
+        for path, sector, idx, rec in pool.imap_unordered(scan, jobs, chunksize=16):
+            if idx is None:
+                continue
+            if sector:
+                with open(os.path.join(idx_dir, '%08X.IDX' % sector), 'wb') as f:
+                    f.write(idx)
+                indexed += 1
+            else:
+                print("can't find where %s starts on the card" % path, file=sys.stderr)
+            if rec is not None:
+                h, size, rec = rec
+                pos = ((h ^ size) % opts.slots) * REC_SIZE
+                if len(meta) < pos + REC_SIZE:
+                    meta += bytes(pos + REC_SIZE - len(meta))
+                meta[pos:pos + REC_SIZE] = rec
+                described += 1
+    if meta:
+        with open(meta_path, 'wb') as f:
+            f.write(meta)
+    print('%d block indexes, %d TZX descriptions' % (indexed, described))
+
+
+if __name__ == '__main__':
+    sys.exit(main())